@@ -0,0 +1,493 @@
+// Benchmark of every kernel on every backend that the compiler targets (Linux, GCC or Clang).
+//
+// Per function code it measures the reciprocal throughput, with independent streams of
+// evaluations, and the latency, with a chain of dependent evaluations through each input
+// that the function reads (the largest is reported). Every measurement is repeated after a
+// warmup on a pinned core; the statistics are written as CSV and JSON, to diff releases.
+//
+// The kernels are the generated ones, included directly: build with -march=native (make bench)
+// to get every backend of the machine, backends whose instructions the compiler does not
+// target are skipped.
+//
+// With --counters the hardware counters of ternary_perf.h (cycles, instructions, uops, cache and
+// branch misses) are read around every repetition and written per byte and per vector; the
+// reads are system calls that the counters see, raise --iterations to make them negligible.
+//
+// usage: bench [--backend=sse,avx2,...] [--k=0x96,0xe8,...] [--iterations=N] [--repetitions=N]
+//              [--warmup=N] [--cpu=N] [--counters] [--csv=file] [--json=file]
+#include <algorithm>
+#include <array>
+#include <bitset>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <utility>		// for index_sequence
+#include <vector>
+
+#include "bench.h"
+#include "ternary_compat.h"
+#include "ternary_cost.cpp"
+#include "ternary_x86_32.cpp"
+#include "ternary_x86_64.cpp"
+#include "ternary_bitset.cpp"
+#include "ternary_bitvector.h"
+#ifdef __SSE2__
+#include "ternary_sse.cpp"
+#endif
+#ifdef __AVX2__
+#include "ternary_avx2.cpp"
+#include "ternary_avx_ps.cpp"
+#endif
+#ifdef __AVX512F__
+#include "ternary_avx512.cpp"
+#endif
+#ifdef __XOP__
+#include "ternary_xop.cpp"
+#endif
+
+namespace ternarylogic::bench
+{
+	// a backend: its type, its kernels, the number of independent streams that fit in its registers (three values each),
+	// the cost table of the generator, and an optimisation barrier: the compiler assumes that the value changes but emits
+	// no instruction, which keeps the kernels from being hoisted out of the loops or simplified across iterations
+	struct x86_32
+	{
+		using type = uint32_t;
+		static constexpr const char* name = "x86_32";
+		static constexpr int streams = 4;
+		static constexpr const kernel_cost* costs = ternarylogic::costs::x86_32;
+		template<unsigned K> static __forceinline type ternary(const type a, const type b, const type c) noexcept { return ternarylogic::x86_32::ternary<K>(a, b, c); }
+		static type make(const uint64_t x) noexcept { return static_cast<type>(x); }
+		static __forceinline void barrier(type& v) noexcept { asm volatile("" : "+r"(v)); }
+	};
+
+	struct x86_64
+	{
+		using type = uint64_t;
+		static constexpr const char* name = "x86_64";
+		static constexpr int streams = 4;
+		static constexpr const kernel_cost* costs = ternarylogic::costs::x86_64;
+		template<unsigned K> static __forceinline type ternary(const type a, const type b, const type c) noexcept { return ternarylogic::x86_64::ternary<K>(a, b, c); }
+		static type make(const uint64_t x) noexcept { return x; }
+		static __forceinline void barrier(type& v) noexcept { asm volatile("" : "+r"(v)); }
+	};
+
+	// bitvector<S> and std::bitset<S> with the same bits, every word differs; they stay in memory, thus the barrier is on
+	// the whole object
+	template<size_t S>
+	struct bitvector_of
+	{
+		using type = ternarylogic::bitvector<S>;
+		static constexpr int streams = 4;
+#if defined(__AVX512F__)
+		static constexpr const kernel_cost* costs = ternarylogic::costs::avx512raw;
+#elif defined(__AVX2__)
+		static constexpr const kernel_cost* costs = ternarylogic::costs::avx2;
+#else
+		static constexpr const kernel_cost* costs = ternarylogic::costs::sse;
+#endif
+		template<unsigned K> static __forceinline type ternary(const type& a, const type& b, const type& c) noexcept { return ternarylogic::priv::ternary_bitvector<K, 0>(a, b, c); }
+		static type make(const uint64_t x) noexcept
+		{
+			type v;
+			for (size_t i = 0; i < type::n_words; ++i) v.data()[i] = x + (0x9E3779B97F4A7C15ull * i);
+			v.trim();
+			return v;
+		}
+		static __forceinline void barrier(type& v) noexcept { asm volatile("" : "+m"(v)); }
+	};
+
+	template<size_t S>
+	struct bitset_of
+	{
+		using type = std::bitset<S>;
+		static constexpr int streams = 4;
+		static constexpr const kernel_cost* costs = ternarylogic::costs::x86_64;
+		template<unsigned K> static __forceinline type ternary(const type& a, const type& b, const type& c) noexcept { return ternarylogic::bitset::ternary<K>(a, b, c); }
+		static type make(const uint64_t x) noexcept { return bitvector_of<S>::make(x).to_bitset(); }
+		static __forceinline void barrier(type& v) noexcept { asm volatile("" : "+m"(v)); }
+	};
+
+	struct bitset : bitset_of<512> { static constexpr const char* name = "bitset"; };
+	struct bitset_32k : bitset_of<32768> { static constexpr const char* name = "bitset_32k"; };
+	struct bitvector : bitvector_of<512> { static constexpr const char* name = "bitvector"; };
+	struct bitvector_32k : bitvector_of<32768> { static constexpr const char* name = "bitvector_32k"; };
+
+#ifdef __SSE2__
+	struct sse
+	{
+		using type = __m128i;
+		static constexpr const char* name = "sse";
+		static constexpr int streams = 4;
+		static constexpr const kernel_cost* costs = ternarylogic::costs::sse;
+		template<unsigned K> static __forceinline type ternary(const type a, const type b, const type c) noexcept { return ternarylogic::sse::ternary<K>(a, b, c); }
+		static type make(const uint64_t x) noexcept { return _mm_set1_epi64x(static_cast<long long>(x)); }
+		static __forceinline void barrier(type& v) noexcept { asm volatile("" : "+x"(v)); }
+	};
+#endif
+
+#ifdef __AVX2__
+	struct avx2
+	{
+		using type = __m256i;
+		static constexpr const char* name = "avx2";
+		static constexpr int streams = 4;
+		static constexpr const kernel_cost* costs = ternarylogic::costs::avx2;
+		template<unsigned K> static __forceinline type ternary(const type a, const type b, const type c) noexcept { return ternarylogic::avx2::ternary<K>(a, b, c); }
+		static type make(const uint64_t x) noexcept { return _mm256_set1_epi64x(static_cast<long long>(x)); }
+		static __forceinline void barrier(type& v) noexcept { asm volatile("" : "+x"(v)); }
+	};
+
+	// __m256 values that FP arithmetic consumes after every evaluation: vminps of the value with itself, which is exact
+	// for every bit pattern (and no denormal assist). avx_ps evaluates with the kernels of the FP domain, avx2_ps with the
+	// integer kernels, whose values cross the bypass between the integer and FP units twice per evaluation; the
+	// difference of the latencies is the bypass delay.
+	template<typename Kernels>
+	struct fp_chain
+	{
+		using type = __m256;
+		static constexpr int streams = 4;
+		template<unsigned K> static __forceinline type ternary(const type a, const type b, const type c) noexcept
+		{
+			const type r = Kernels::template ternary<K>(a, b, c);
+			return _mm256_min_ps(r, r);
+		}
+		static type make(const uint64_t x) noexcept { return _mm256_castsi256_ps(_mm256_set1_epi64x(static_cast<long long>(x))); }
+		static __forceinline void barrier(type& v) noexcept { asm volatile("" : "+x"(v)); }
+	};
+
+	struct fp_kernels
+	{
+		template<unsigned K> static __forceinline __m256 ternary(const __m256 a, const __m256 b, const __m256 c) noexcept { return ternarylogic::avx_ps::ternary<K>(a, b, c); }
+	};
+
+	struct int_kernels
+	{
+		template<unsigned K> static __forceinline __m256 ternary(const __m256 a, const __m256 b, const __m256 c) noexcept
+		{
+			return _mm256_castsi256_ps(ternarylogic::avx2::ternary<K>(_mm256_castps_si256(a), _mm256_castps_si256(b), _mm256_castps_si256(c)));
+		}
+	};
+
+	struct avx_ps : fp_chain<fp_kernels>
+	{
+		static constexpr const char* name = "avx_ps";
+		static constexpr const kernel_cost* costs = ternarylogic::costs::avx_ps;
+	};
+
+	struct avx2_ps : fp_chain<int_kernels>
+	{
+		static constexpr const char* name = "avx2_ps";
+		static constexpr const kernel_cost* costs = ternarylogic::costs::avx2;
+	};
+#endif
+
+#ifdef __AVX512F__
+	struct avx512
+	{
+		using type = __m512i;
+		static constexpr const char* name = "avx512";
+		static constexpr int streams = 8;
+		static constexpr const kernel_cost* costs = ternarylogic::costs::avx512;
+		template<unsigned K> static __forceinline type ternary(const type a, const type b, const type c) noexcept { return ternarylogic::avx512::ternary<K>(a, b, c); }
+		static type make(const uint64_t x) noexcept { return _mm512_set1_epi64(static_cast<long long>(x)); }
+		static __forceinline void barrier(type& v) noexcept { asm volatile("" : "+v"(v)); }
+	};
+
+	struct avx512raw
+	{
+		using type = __m512i;
+		static constexpr const char* name = "avx512raw";
+		static constexpr int streams = 8;
+		static constexpr const kernel_cost* costs = ternarylogic::costs::avx512raw;
+		template<unsigned K> static __forceinline type ternary(const type a, const type b, const type c) noexcept { return ternarylogic::avx512raw::ternary<K>(a, b, c); }
+		static type make(const uint64_t x) noexcept { return _mm512_set1_epi64(static_cast<long long>(x)); }
+		static __forceinline void barrier(type& v) noexcept { asm volatile("" : "+v"(v)); }
+	};
+#endif
+
+#ifdef __XOP__
+	struct xop
+	{
+		using type = __m128i;
+		static constexpr const char* name = "xop";
+		static constexpr int streams = 4;
+		static constexpr const kernel_cost* costs = ternarylogic::costs::xop;
+		template<unsigned K> static __forceinline type ternary(const type a, const type b, const type c) noexcept { return ternarylogic::xop::ternary<K>(a, b, c); }
+		static type make(const uint64_t x) noexcept { return _mm_set1_epi64x(static_cast<long long>(x)); }
+		static __forceinline void barrier(type& v) noexcept { asm volatile("" : "+x"(v)); }
+	};
+#endif
+
+	/// <summary>
+	/// True if Boolean Function k reads input i (0 = a, 1 = b, 2 = c)
+	/// </summary>
+	[[nodiscard]] constexpr bool reads(const unsigned k, const int i) noexcept
+	{
+		constexpr unsigned masks[3] = { 0x0F, 0x33, 0x55 };
+		const int shift = 4 >> i;
+		return (((k >> shift) ^ k) & masks[i]) != 0;
+	}
+
+	/// <summary>
+	/// Independent streams of evaluations: every stream computes v[n + 3] = f(v[n], v[n + 1], v[n + 2]) in place, thus
+	/// every input changes and nothing is moved. The streams are unrolled with constant indices, which keeps v in registers.
+	/// </summary>
+	template<typename B, unsigned K, size_t... S>
+	__forceinline void run_streams(typename B::type* state, const size_t iterations, std::index_sequence<S...>) noexcept
+	{
+		typename B::type v[sizeof...(S)][3];
+		((v[S][0] = state[3 * S], v[S][1] = state[(3 * S) + 1], v[S][2] = state[(3 * S) + 2]), ...);
+		for (size_t i = 0; i < iterations; ++i) {
+			((v[S][0] = B::template ternary<K>(v[S][0], v[S][1], v[S][2]), B::barrier(v[S][0])), ...);
+			((v[S][1] = B::template ternary<K>(v[S][1], v[S][2], v[S][0]), B::barrier(v[S][1])), ...);
+			((v[S][2] = B::template ternary<K>(v[S][2], v[S][0], v[S][1]), B::barrier(v[S][2])), ...);
+		}
+		((state[3 * S] = v[S][0], state[(3 * S) + 1] = v[S][1], state[(3 * S) + 2] = v[S][2]), ...);
+	}
+
+	/// <summary>
+	/// Returns the number of evaluations
+	/// </summary>
+	template<typename B, unsigned K>
+	__attribute__((noinline)) size_t run_throughput(typename B::type* state, const size_t iterations)
+	{
+		run_streams<B, K>(state, iterations, std::make_index_sequence<B::streams>());
+		return iterations * B::streams * 3;
+	}
+
+	/// <summary>
+	/// A chain of dependent evaluations through input I; the other inputs change too, but off the chain
+	/// </summary>
+	template<typename B, unsigned K, int I>
+	__attribute__((noinline)) size_t run_latency(typename B::type* state, const size_t iterations)
+	{
+		using T = typename B::type;
+		T x = state[0];
+		T y = state[1];
+		T z = state[2];
+		for (size_t i = 0; i < iterations; ++i) {
+			B::barrier(y);
+			B::barrier(z);
+			if constexpr (I == 0) x = B::template ternary<K>(x, y, z);
+			else if constexpr (I == 1) x = B::template ternary<K>(y, x, z);
+			else x = B::template ternary<K>(y, z, x);
+			B::barrier(x);
+		}
+		state[0] = x;
+		return iterations;
+	}
+
+	struct kernel_runs
+	{
+		size_t (*throughput)(void*, size_t);
+		size_t (*latency[3])(void*, size_t);
+	};
+
+	template<typename B, unsigned K>
+	[[nodiscard]] constexpr kernel_runs make_runs() noexcept
+	{
+		using T = typename B::type;
+		return kernel_runs{
+			[](void* s, const size_t n) { return run_throughput<B, K>(static_cast<T*>(s), n); },
+			{
+				[](void* s, const size_t n) { return run_latency<B, K, 0>(static_cast<T*>(s), n); },
+				[](void* s, const size_t n) { return run_latency<B, K, 1>(static_cast<T*>(s), n); },
+				[](void* s, const size_t n) { return run_latency<B, K, 2>(static_cast<T*>(s), n); },
+			}
+		};
+	}
+
+	template<typename B, size_t... K>
+	[[nodiscard]] constexpr std::array<kernel_runs, 256> make_all_runs(std::index_sequence<K...>) noexcept
+	{
+		return { { make_runs<B, K>()... } };
+	}
+
+	struct options
+	{
+		std::vector<std::string> backends;	// empty: all
+		std::vector<unsigned> codes;		// empty: all
+		size_t iterations = 1000;
+		int repetitions = 11;
+		int warmup = 2;
+		int cpu = -1;						// -1: the one the program starts on
+		bool counters = false;
+		std::string csv;
+		std::string json;
+	};
+
+	struct result
+	{
+		const char* backend;
+		unsigned k;
+		kernel_cost cost;
+		statistics throughput;
+		statistics latency;
+	};
+
+	template<typename B>
+	void run_backend(const options& o, std::vector<result>& results)
+	{
+		if (!o.backends.empty() && (std::find(o.backends.begin(), o.backends.end(), B::name) == o.backends.end())) return;
+
+		static constexpr std::array<kernel_runs, 256> runs = make_all_runs<B>(std::make_index_sequence<256>());
+		using T = typename B::type;
+		T state[3 * B::streams];
+		for (size_t i = 0; i < std::size(state); ++i) state[i] = B::make(0x9E3779B97F4A7C15ull * (i + 1));
+
+		for (unsigned k = 0; k < 256; ++k) {
+			if (!o.codes.empty() && (std::find(o.codes.begin(), o.codes.end(), k) == o.codes.end())) continue;
+
+			result r{ B::name, k, B::costs[k], {}, {} };
+			r.throughput = measure([&] { return runs[k].throughput(state, o.iterations); }, sizeof(T), o.repetitions, o.warmup, o.counters);
+			for (int i = 0; i < 3; ++i) {
+				if (!reads(k, i)) continue;
+				const statistics l = measure([&] { return runs[k].latency[i](state, o.iterations); }, sizeof(T), o.repetitions, o.warmup, o.counters);
+				if (l.median > r.latency.median) r.latency = l;
+			}
+			results.push_back(r);
+		}
+		std::cerr << B::name << ": done" << std::endl;
+	}
+
+	inline void write_csv(const std::vector<result>& results, const options& o, std::ostream& os)
+	{
+		os << "backend,k,instructions,depth,throughput_ns_min,throughput_ns_median,throughput_ns_mean,throughput_ns_stddev,throughput_tsc_median,"
+			<< "latency_ns_min,latency_ns_median,latency_ns_mean,latency_ns_stddev,latency_tsc_median";
+		if (o.counters) {
+			perf::write_rate_header(os, "throughput_");
+			perf::write_rate_header(os, "latency_");
+		}
+		os << "\n";
+		for (const result& r : results) {
+			char line[512];
+			std::snprintf(line, sizeof(line), "%s,0x%02x,%d,%d,%.4f,%.4f,%.4f,%.4f,%.3f,%.4f,%.4f,%.4f,%.4f,%.3f",
+				r.backend, r.k, r.cost.instructions, r.cost.depth,
+				r.throughput.min, r.throughput.median, r.throughput.mean, r.throughput.stddev, r.throughput.tsc_median,
+				r.latency.min, r.latency.median, r.latency.mean, r.latency.stddev, r.latency.tsc_median);
+			os << line;
+			if (o.counters) {
+				perf::write_rates(os, r.throughput.counters);
+				perf::write_rates(os, r.latency.counters);
+			}
+			os << "\n";
+		}
+	}
+
+	inline void write_json(const std::vector<result>& results, const options& o, const int cpu, std::ostream& os)
+	{
+		auto stats = [&o](const statistics& s) {
+			char text[256];
+			std::snprintf(text, sizeof(text), "{ \"ns_min\": %.4f, \"ns_median\": %.4f, \"ns_mean\": %.4f, \"ns_stddev\": %.4f, \"tsc_median\": %.3f",
+				s.min, s.median, s.mean, s.stddev, s.tsc_median);
+			std::string result = text;
+			// the counters per vector (evaluation), of the events that are valid
+			for (size_t i = 0; o.counters && (i < perf::n_events); ++i) {
+				if (!s.counters.events.valid[i] || (s.counters.vectors == 0)) continue;
+				std::snprintf(text, sizeof(text), ", \"%s_per_vector\": %.6f", perf::event_name(static_cast<perf::event>(i)),
+					static_cast<double>(s.counters.events.value[i]) / s.counters.vectors);
+				result += text;
+			}
+			return result + " }";
+		};
+		os << "{\n";
+		os << "  \"cpu\": \"" << cpu_name() << "\",\n";
+		os << "  \"core\": " << cpu << ",\n";
+		os << "  \"compiler\": \"" << __VERSION__ << "\",\n";
+		os << "  \"iterations\": " << o.iterations << ",\n";
+		os << "  \"repetitions\": " << o.repetitions << ",\n";
+		if (o.counters) {
+			os << "  \"counters\": [";
+			const char* separator = "";
+			for (size_t i = 0; i < perf::n_events; ++i) {
+				const perf::event e = static_cast<perf::event>(i);
+				if (!perf::counters::local().available(e)) continue;
+				os << separator << "\"" << perf::event_name(e) << "\"";
+				separator = ", ";
+			}
+			os << "],\n";
+		}
+		os << "  \"results\": [\n";
+		for (size_t i = 0; i < results.size(); ++i) {
+			const result& r = results[i];
+			char head[128];
+			std::snprintf(head, sizeof(head), "    { \"backend\": \"%s\", \"k\": \"0x%02x\", \"instructions\": %d, \"depth\": %d, ",
+				r.backend, r.k, r.cost.instructions, r.cost.depth);
+			os << head << "\"throughput\": " << stats(r.throughput) << ", \"latency\": " << stats(r.latency) << " }"
+				<< ((i + 1 < results.size()) ? "," : "") << "\n";
+		}
+		os << "  ]\n";
+		os << "}\n";
+	}
+
+	[[nodiscard]] inline bool parse(int argc, char** argv, options& o)
+	{
+		for (int i = 1; i < argc; ++i) {
+			const std::string arg = argv[i];
+			const size_t eq = arg.find('=');
+			const std::string name = arg.substr(0, eq);
+			const std::string value = (eq == std::string::npos) ? "" : arg.substr(eq + 1);
+			if (name == "--backend") o.backends = split(value);
+			else if (name == "--k") for (const std::string& k : split(value)) o.codes.push_back(static_cast<unsigned>(std::stoul(k, nullptr, 0) & 0xFF));
+			else if (name == "--iterations") o.iterations = std::stoul(value);
+			else if (name == "--repetitions") o.repetitions = std::stoi(value);
+			else if (name == "--warmup") o.warmup = std::stoi(value);
+			else if (name == "--cpu") o.cpu = std::stoi(value);
+			else if (name == "--counters") o.counters = true;
+			else if (name == "--csv") o.csv = value;
+			else if (name == "--json") o.json = value;
+			else return false;
+		}
+		return (o.iterations > 0) && (o.repetitions > 0);
+	}
+
+}
+
+int main(int argc, char** argv)
+{
+	using namespace ternarylogic::bench;
+
+	options o;
+	if (!parse(argc, argv, o)) {
+		std::cerr << "usage: bench [--backend=sse,avx2,...] [--k=0x96,0xe8,...] [--iterations=N] [--repetitions=N] [--warmup=N] [--cpu=N] [--counters] [--csv=file] [--json=file]" << std::endl;
+		return 1;
+	}
+	const int cpu = pin(o.cpu);
+
+	std::vector<result> results;
+	run_backend<x86_32>(o, results);
+	run_backend<x86_64>(o, results);
+	run_backend<bitset>(o, results);
+	run_backend<bitset_32k>(o, results);
+	run_backend<bitvector>(o, results);
+	run_backend<bitvector_32k>(o, results);
+#ifdef __SSE2__
+	run_backend<sse>(o, results);
+#endif
+#ifdef __AVX2__
+	run_backend<avx2>(o, results);
+	run_backend<avx_ps>(o, results);
+	run_backend<avx2_ps>(o, results);
+#endif
+#ifdef __AVX512F__
+	run_backend<avx512>(o, results);
+	run_backend<avx512raw>(o, results);
+#endif
+#ifdef __XOP__
+	run_backend<xop>(o, results);
+#endif
+
+	if (!o.csv.empty()) {
+		std::ofstream f(o.csv);
+		write_csv(results, o, f);
+	}
+	if (!o.json.empty()) {
+		std::ofstream f(o.json);
+		write_json(results, o, cpu, f);
+	}
+	if (o.csv.empty() && o.json.empty()) write_csv(results, o, std::cout);
+	return 0;
+}
@@ -0,0 +1,115 @@
+#pragma once
+// Helpers of the benchmark programs (Linux, GCC or Clang): statistics of repeated measurements, pinning, options
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <sched.h>
+#include <x86intrin.h>
+
+#include "ternary_perf.h"
+
+namespace ternarylogic::bench
+{
+	/// <summary>
+	/// Nanoseconds and TSC ticks per evaluation of the repetitions
+	/// </summary>
+	struct statistics
+	{
+		double min = 0;
+		double median = 0;
+		double mean = 0;
+		double stddev = 0;
+		double tsc_median = 0;
+		perf::totals counters{};			// of all repetitions, when measured with counters
+	};
+
+	[[nodiscard]] inline statistics summarise(std::vector<double> ns, std::vector<double> tsc)
+	{
+		statistics s;
+		if (ns.empty()) return s;
+		std::sort(ns.begin(), ns.end());
+		std::sort(tsc.begin(), tsc.end());
+		s.min = ns.front();
+		s.median = ns[ns.size() / 2];
+		s.tsc_median = tsc[tsc.size() / 2];
+		for (const double x : ns) s.mean += x;
+		s.mean /= static_cast<double>(ns.size());
+		for (const double x : ns) s.stddev += (x - s.mean) * (x - s.mean);
+		s.stddev = std::sqrt(s.stddev / static_cast<double>(ns.size()));
+		return s;
+	}
+
+	/// <summary>
+	/// Run warmup + repetitions times; run returns the number of evaluations that it did
+	/// </summary>
+	template<typename F>
+	[[nodiscard]] inline statistics measure(const F& run, const size_t bytes_per_evaluation, const int repetitions, const int warmup, const bool with_counters)
+	{
+		std::vector<double> ns;
+		std::vector<double> tsc;
+		perf::totals counters;
+		for (int r = -warmup; r < repetitions; ++r) {
+			// the counters are read outside the timed window, their system calls are not timed
+			const perf::sample s0 = with_counters ? perf::counters::local().read() : perf::sample{};
+			const auto t0 = std::chrono::steady_clock::now();
+			const uint64_t c0 = __rdtsc();
+			const size_t n = run();
+			const uint64_t c1 = __rdtsc();
+			const auto t1 = std::chrono::steady_clock::now();
+			const perf::sample s1 = with_counters ? perf::counters::local().read() : perf::sample{};
+			if (r < 0) continue;
+			ns.push_back(std::chrono::duration<double, std::nano>(t1 - t0).count() / static_cast<double>(n));
+			tsc.push_back(static_cast<double>(c1 - c0) / static_cast<double>(n));
+			if (with_counters) counters.add(s1 - s0, n, n * bytes_per_evaluation);
+		}
+		statistics s = summarise(ns, tsc);
+		s.counters = counters;
+		return s;
+	}
+
+	inline std::string cpu_name()
+	{
+		std::ifstream f("/proc/cpuinfo");
+		std::string line;
+		while (std::getline(f, line)) {
+			if (line.rfind("model name", 0) == 0) return line.substr(line.find(':') + 2);
+		}
+		return "unknown";
+	}
+
+	[[nodiscard]] inline std::vector<std::string> split(const std::string& s)
+	{
+		std::vector<std::string> result;
+		std::stringstream ss(s);
+		std::string item;
+		while (std::getline(ss, item, ',')) {
+			if (!item.empty()) result.push_back(item);
+		}
+		return result;
+	}
+
+	/// <summary>
+	/// Pin the thread on one core and run until the clock has ramped up
+	/// </summary>
+	inline int pin(const int requested)
+	{
+		const int cpu = (requested >= 0) ? requested : sched_getcpu();
+		cpu_set_t set;
+		CPU_ZERO(&set);
+		CPU_SET(cpu, &set);
+		if (sched_setaffinity(0, sizeof(set), &set) != 0) {
+			std::cerr << "warning: cannot pin on core " << cpu << std::endl;
+		}
+		volatile uint64_t spin = 0;
+		const auto end = std::chrono::steady_clock::now() + std::chrono::milliseconds(200);
+		while (std::chrono::steady_clock::now() < end) spin = spin + 1;
+		return cpu;
+	}
+}
@@ -0,0 +1,416 @@
+// Benchmark of the strategies of runtime-k dispatch, i.e. of ternary(a, b, c, k) with k known at run time only.
+//
+// strategies:
+//   switch       priv::ternary_reduced, the switch of ternary_reduced.cpp (what ternary(a, b, c, k) runs)
+//   not_reduced  priv::ternary_not_reduced, the plain switch over the 256 kernels
+//   table        an indirect call through a table of 256 function pointers
+//   branchless   the truth table of k as eight broadcast masks, selected by c, b and a (7 selects)
+//   npn          the complements and the order of the inputs of the NPN class of k from a table, then 14 kernels
+//   visitor      a template visitor: binary search over k that instantiates the kernel per code
+//
+// Every strategy evaluates dst[i] = f(a[i], b[i], c[i], k[i]) over a stream of codes: fixed (always 0xE8),
+// sequential (0, 1, 2, ...) or random, where every code is repeated batch times. Reported per call: ns, and the
+// cycles, instructions and branch misses from ternary_perf.h where the PMU is available.
+//
+// usage: bench_dispatch [--backend=x86_64,sse,avx2,avx512raw] [--strategy=switch,table,...] [--stream=fixed,random]
+//                       [--batch=1,8,64,512] [--repetitions=N] [--warmup=N] [--passes=N] [--cpu=N] [--csv=file]
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <type_traits>
+#include <utility>		// for index_sequence
+#include <vector>
+
+#include "ternary_logic.cpp"
+#include "bench.h"
+
+namespace ternarylogic::bench::dispatch
+{
+	/// <summary>
+	/// All ones if bit is set, all zeros otherwise
+	/// </summary>
+	template<typename T> [[nodiscard]] __forceinline T ones_if(unsigned bit) noexcept;
+	template<> [[nodiscard]] __forceinline uint64_t ones_if<uint64_t>(const unsigned bit) noexcept { return uint64_t{ 0 } - bit; }
+	template<> [[nodiscard]] __forceinline __m128i ones_if<__m128i>(const unsigned bit) noexcept { return _mm_set1_epi32(-static_cast<int>(bit)); }
+#ifdef __AVX2__
+	template<> [[nodiscard]] __forceinline __m256i ones_if<__m256i>(const unsigned bit) noexcept { return _mm256_set1_epi32(-static_cast<int>(bit)); }
+#endif
+#ifdef __AVX512F__
+	template<> [[nodiscard]] __forceinline __m512i ones_if<__m512i>(const unsigned bit) noexcept { return _mm512_set1_epi32(-static_cast<int>(bit)); }
+#endif
+
+	struct switch_strategy
+	{
+		static constexpr const char* name = "switch";
+		template<typename T> [[nodiscard]] static __forceinline T eval(const T a, const T b, const T c, const bf_type k) noexcept { return ternarylogic::priv::ternary_reduced(a, b, c, k); }
+	};
+
+	struct not_reduced_strategy
+	{
+		static constexpr const char* name = "not_reduced";
+		template<typename T> [[nodiscard]] static __forceinline T eval(const T a, const T b, const T c, const bf_type k) noexcept { return ternarylogic::priv::ternary_not_reduced(a, b, c, k); }
+	};
+
+	namespace priv
+	{
+		template<bf_type K, typename T>
+		[[nodiscard]] T call(const T a, const T b, const T c) noexcept
+		{
+			return ternarylogic::ternary<K>(a, b, c);
+		}
+
+		template<typename T, size_t... K>
+		[[nodiscard]] constexpr std::array<T (*)(T, T, T) noexcept, 256> make_table(std::index_sequence<K...>) noexcept
+		{
+			return { { &call<K, T>... } };
+		}
+	}
+
+	struct table_strategy
+	{
+		static constexpr const char* name = "table";
+		template<typename T> [[nodiscard]] static __forceinline T eval(const T a, const T b, const T c, const bf_type k) noexcept
+		{
+			static constexpr std::array<T (*)(T, T, T) noexcept, 256> table = priv::make_table<T>(std::make_index_sequence<256>());
+			return table[k & 0xFF](a, b, c);
+		}
+	};
+
+	struct branchless_strategy
+	{
+		static constexpr const char* name = "branchless";
+		template<typename T> [[nodiscard]] static __forceinline T eval(const T a, const T b, const T c, const bf_type k) noexcept
+		{
+			// bit i of k is the value of minterm i = a * 4 + b * 2 + c: c selects between pairs of bits, then b, then a
+			T m[8];
+			for (unsigned i = 0; i < 8; ++i) m[i] = ones_if<T>((k >> i) & 1);
+			const T x0 = ternarylogic::ternary<0xCA>(c, m[1], m[0]);
+			const T x1 = ternarylogic::ternary<0xCA>(c, m[3], m[2]);
+			const T x2 = ternarylogic::ternary<0xCA>(c, m[5], m[4]);
+			const T x3 = ternarylogic::ternary<0xCA>(c, m[7], m[6]);
+			const T y0 = ternarylogic::ternary<0xCA>(b, x1, x0);
+			const T y1 = ternarylogic::ternary<0xCA>(b, x3, x2);
+			return ternarylogic::ternary<0xCA>(a, y1, y0);
+		}
+	};
+
+	namespace npn
+	{
+		constexpr uint8_t orders[6][3] = { { 0, 1, 2 }, { 0, 2, 1 }, { 1, 0, 2 }, { 1, 2, 0 }, { 2, 0, 1 }, { 2, 1, 0 } };
+
+		/// <summary>
+		/// Function k is o ^ r(x[order[0]], x[order[1]], x[order[2]]) with x = (a ^ na, b ^ nb, c ^ nc); bits 0, 1, 2
+		/// and 3 of negate are na, nb, nc and o, r is the least code of the NPN class of k
+		/// </summary>
+		struct entry
+		{
+			uint8_t r;
+			uint8_t order;
+			uint8_t negate;
+		};
+
+		[[nodiscard]] constexpr std::array<entry, 256> make_entries() noexcept
+		{
+			std::array<entry, 256> result{};
+			bool found[256] = {};
+			for (unsigned r = 0; r < 256; ++r) {
+				for (uint8_t order = 0; order < 6; ++order) {
+					for (uint8_t negate = 0; negate < 16; ++negate) {
+						const uint8_t x[3] = {
+							static_cast<uint8_t>(0xF0 ^ ((negate & 1) ? 0xFF : 0)),
+							static_cast<uint8_t>(0xCC ^ ((negate & 2) ? 0xFF : 0)),
+							static_cast<uint8_t>(0xAA ^ ((negate & 4) ? 0xFF : 0)) };
+						const uint8_t* o = orders[order];
+						uint8_t k = reference::vpternlog<uint8_t>(x[o[0]], x[o[1]], x[o[2]], r);
+						if (negate & 8) k = static_cast<uint8_t>(~k);
+						if (found[k]) continue;
+						found[k] = true;
+						result[k] = entry{ static_cast<uint8_t>(r), order, negate };
+					}
+				}
+			}
+			return result;
+		}
+
+		constexpr std::array<entry, 256> entries = make_entries();
+
+		constexpr size_t n_classes = 14;
+
+		[[nodiscard]] constexpr std::array<uint8_t, n_classes> make_classes() noexcept
+		{
+			std::array<uint8_t, n_classes> result{};
+			size_t n = 0;
+			for (unsigned k = 0; k < 256; ++k) {
+				if ((entries[k].r == k) && (n < n_classes)) result[n++] = static_cast<uint8_t>(k);
+			}
+			return result;
+		}
+
+		constexpr std::array<uint8_t, n_classes> classes = make_classes();
+
+		[[nodiscard]] constexpr bool valid() noexcept
+		{
+			size_t n = 0;
+			for (unsigned k = 0; k < 256; ++k) n += (entries[k].r == k) ? 1 : 0;
+			return n == n_classes;
+		}
+		static_assert(valid(), "three input functions have 14 NPN classes");
+
+		template<typename T, size_t... I>
+		[[nodiscard]] __forceinline T run_class(const T x, const T y, const T z, const uint8_t r, std::index_sequence<I...>) noexcept
+		{
+			T result = x;
+			static_cast<void>(((r == classes[I] ? (result = ternarylogic::ternary<classes[I]>(x, y, z), true) : false) || ...));
+			return result;
+		}
+	}
+
+	struct npn_strategy
+	{
+		static constexpr const char* name = "npn";
+		template<typename T> [[nodiscard]] static __forceinline T eval(const T a, const T b, const T c, const bf_type k) noexcept
+		{
+			const npn::entry e = npn::entries[k & 0xFF];
+			const T na = ones_if<T>(e.negate & 1);
+			const T nb = ones_if<T>((e.negate >> 1) & 1);
+			const T nc = ones_if<T>((e.negate >> 2) & 1);
+			const T no = ones_if<T>((e.negate >> 3) & 1);
+			const T x[3] = { ternarylogic::ternary<0x3C>(a, na, na), ternarylogic::ternary<0x3C>(b, nb, nb), ternarylogic::ternary<0x3C>(c, nc, nc) };
+			const uint8_t* o = npn::orders[e.order];
+			const T r = npn::run_class(x[o[0]], x[o[1]], x[o[2]], e.r, std::make_index_sequence<npn::n_classes>());
+			return ternarylogic::ternary<0x3C>(r, no, no);
+		}
+	};
+
+	namespace priv
+	{
+		template<bf_type Low, bf_type High, typename F>
+		[[nodiscard]] __forceinline auto visit(const bf_type k, const F& f)
+		{
+			if constexpr (Low + 1 == High) {
+				return f(std::integral_constant<bf_type, Low>{});
+			}
+			else {
+				constexpr bf_type middle = (Low + High) / 2;
+				if (k < middle) return visit<Low, middle>(k, f);
+				return visit<middle, High>(k, f);
+			}
+		}
+	}
+
+	struct visitor_strategy
+	{
+		static constexpr const char* name = "visitor";
+		template<typename T> [[nodiscard]] static __forceinline T eval(const T a, const T b, const T c, const bf_type k) noexcept
+		{
+			return priv::visit<0, 256>(k & 0xFF, [&](auto K) { return ternarylogic::ternary<decltype(K)::value>(a, b, c); });
+		}
+	};
+
+	struct options
+	{
+		std::vector<std::string> backends;		// empty: all
+		std::vector<std::string> strategies;	// empty: all
+		std::vector<std::string> streams;		// empty: all
+		std::vector<size_t> batches = { 1, 8, 64, 512 };
+		size_t n = 1024;						// calls per pass
+		size_t passes = 16;
+		int repetitions = 11;
+		int warmup = 2;
+		int cpu = -1;
+		std::string csv;
+	};
+
+	[[nodiscard]] inline bool selected(const std::vector<std::string>& names, const char* name)
+	{
+		return names.empty() || (std::find(names.begin(), names.end(), name) != names.end());
+	}
+
+	/// <summary>
+	/// The codes of the calls: every code of the stream is repeated batch times
+	/// </summary>
+	[[nodiscard]] inline std::vector<uint8_t> make_codes(const std::string& stream, const size_t batch, const size_t n)
+	{
+		std::vector<uint8_t> result(n);
+		uint64_t x = 0x9E3779B97F4A7C15ull;
+		uint8_t code = 0;
+		for (size_t i = 0; i < n; ++i) {
+			if ((i % batch) == 0) {
+				x ^= x << 13;
+				x ^= x >> 7;
+				x ^= x << 17;
+				if (stream == "fixed") code = 0xE8;
+				else if (stream == "sequential") code = static_cast<uint8_t>(i / batch);
+				else code = static_cast<uint8_t>(x >> 56);
+			}
+			result[i] = code;
+		}
+		return result;
+	}
+
+	template<typename S, typename T>
+	__attribute__((noinline)) size_t run(T* dst, const T* a, const T* b, const T* c, const uint8_t* k, const size_t n, const size_t passes)
+	{
+		for (size_t p = 0; p < passes; ++p) {
+			for (size_t i = 0; i < n; ++i) {
+				dst[i] = S::template eval<T>(a[i], b[i], c[i], k[i]);
+			}
+			asm volatile("" : : "r"(dst) : "memory");
+		}
+		return n * passes;
+	}
+
+	/// <summary>
+	/// Every strategy against the reduced switch, for all codes
+	/// </summary>
+	template<typename S, typename T>
+	[[nodiscard]] inline bool check(const std::vector<T>& a, const std::vector<T>& b, const std::vector<T>& c)
+	{
+		std::vector<uint8_t> codes(a.size());
+		std::vector<T> dst(a.size());
+		for (size_t i = 0; i < codes.size(); ++i) codes[i] = static_cast<uint8_t>(i);
+		static_cast<void>(run<S, T>(dst.data(), a.data(), b.data(), c.data(), codes.data(), codes.size(), 1));
+		for (size_t i = 0; i < codes.size(); ++i) {
+			const T expected = ternarylogic::priv::ternary_reduced(a[i], b[i], c[i], codes[i]);
+			if (std::memcmp(&expected, &dst[i], sizeof(T)) != 0) return false;
+		}
+		return true;
+	}
+
+	struct result
+	{
+		const char* backend;
+		const char* strategy;
+		std::string stream;
+		size_t batch;
+		statistics s;
+	};
+
+	template<typename S, typename T>
+	void run_strategy(const char* backend, const options& o, std::vector<result>& results,
+		std::vector<T>& dst, const std::vector<T>& a, const std::vector<T>& b, const std::vector<T>& c)
+	{
+		if (!selected(o.strategies, S::name)) return;
+		if (!check<S, T>(a, b, c)) {
+			std::cerr << "ERROR: " << backend << " " << S::name << " differs from the reduced switch" << std::endl;
+			std::exit(2);
+		}
+		for (const char* stream : { "fixed", "sequential", "random" }) {
+			if (!selected(o.streams, stream)) continue;
+			for (const size_t batch : o.batches) {
+				const std::vector<uint8_t> codes = make_codes(stream, batch, o.n);
+				const statistics s = measure([&] { return run<S, T>(dst.data(), a.data(), b.data(), c.data(), codes.data(), o.n, o.passes); },
+					sizeof(T), o.repetitions, o.warmup, true);
+				results.push_back(result{ backend, S::name, stream, batch, s });
+			}
+		}
+	}
+
+	template<typename T, typename M>
+	void run_backend(const char* backend, const M& make, const options& o, std::vector<result>& results)
+	{
+		if (!selected(o.backends, backend)) return;
+
+		std::vector<T> a(o.n);
+		std::vector<T> b(o.n);
+		std::vector<T> c(o.n);
+		std::vector<T> dst(o.n);
+		uint64_t x = 0x2545F4914F6CDD1Dull;
+		for (size_t i = 0; i < o.n; ++i) {
+			a[i] = make(x *= 0x9E3779B97F4A7C15ull);
+			b[i] = make(x *= 0x9E3779B97F4A7C15ull);
+			c[i] = make(x *= 0x9E3779B97F4A7C15ull);
+		}
+		run_strategy<switch_strategy>(backend, o, results, dst, a, b, c);
+		run_strategy<not_reduced_strategy>(backend, o, results, dst, a, b, c);
+		run_strategy<table_strategy>(backend, o, results, dst, a, b, c);
+		run_strategy<branchless_strategy>(backend, o, results, dst, a, b, c);
+		run_strategy<npn_strategy>(backend, o, results, dst, a, b, c);
+		run_strategy<visitor_strategy>(backend, o, results, dst, a, b, c);
+		std::cerr << backend << ": done" << std::endl;
+	}
+
+	inline void write_csv(const std::vector<result>& results, std::ostream& os)
+	{
+		os << "backend,strategy,stream,batch,ns_min,ns_median,ns_stddev,tsc_median,cycles_per_call,instructions_per_call,branch_misses_per_call\n";
+		for (const result& r : results) {
+			char line[256];
+			std::snprintf(line, sizeof(line), "%s,%s,%s,%zu,%.4f,%.4f,%.4f,%.3f", r.backend, r.strategy, r.stream.c_str(), r.batch,
+				r.s.min, r.s.median, r.s.stddev, r.s.tsc_median);
+			os << line;
+			for (const perf::event e : { perf::event::cycles, perf::event::instructions, perf::event::branch_misses }) {
+				if (!r.s.counters.events.has(e) || (r.s.counters.vectors == 0)) {
+					os << ",";
+					continue;
+				}
+				std::snprintf(line, sizeof(line), ",%.4f", static_cast<double>(r.s.counters.events[e]) / r.s.counters.vectors);
+				os << line;
+			}
+			os << "\n";
+		}
+	}
+
+	[[nodiscard]] inline bool parse(int argc, char** argv, options& o)
+	{
+		for (int i = 1; i < argc; ++i) {
+			const std::string arg = argv[i];
+			const size_t eq = arg.find('=');
+			const std::string name = arg.substr(0, eq);
+			const std::string value = (eq == std::string::npos) ? "" : arg.substr(eq + 1);
+			if (name == "--backend") o.backends = split(value);
+			else if (name == "--strategy") o.strategies = split(value);
+			else if (name == "--stream") o.streams = split(value);
+			else if (name == "--batch") {
+				o.batches.clear();
+				for (const std::string& b : split(value)) o.batches.push_back(std::stoul(b));
+			}
+			else if (name == "--repetitions") o.repetitions = std::stoi(value);
+			else if (name == "--warmup") o.warmup = std::stoi(value);
+			else if (name == "--passes") o.passes = std::stoul(value);
+			else if (name == "--cpu") o.cpu = std::stoi(value);
+			else if (name == "--csv") o.csv = value;
+			else return false;
+		}
+		return (o.repetitions > 0) && (o.passes > 0) && !o.batches.empty()
+			&& std::all_of(o.batches.begin(), o.batches.end(), [](const size_t b) { return b > 0; });
+	}
+}
+
+int main(int argc, char** argv)
+{
+	using namespace ternarylogic::bench;
+	using namespace ternarylogic::bench::dispatch;
+
+	options o;
+	if (!parse(argc, argv, o)) {
+		std::cerr << "usage: bench_dispatch [--backend=x86_64,sse,avx2,avx512raw] [--strategy=switch,not_reduced,table,branchless,npn,visitor] "
+			<< "[--stream=fixed,sequential,random] [--batch=1,8,64,512] [--repetitions=N] [--warmup=N] [--passes=N] [--cpu=N] [--csv=file]" << std::endl;
+		return 1;
+	}
+	static_cast<void>(pin(o.cpu));
+
+	std::vector<result> results;
+	run_backend<uint64_t>("x86_64", [](const uint64_t x) { return x; }, o, results);
+	run_backend<__m128i>("sse", [](const uint64_t x) { return _mm_set_epi64x(static_cast<long long>(x), static_cast<long long>(~x)); }, o, results);
+#ifdef __AVX2__
+	run_backend<__m256i>("avx2", [](const uint64_t x) { return _mm256_set1_epi64x(static_cast<long long>(x)); }, o, results);
+#endif
+#ifdef __AVX512F__
+	run_backend<__m512i>("avx512raw", [](const uint64_t x) { return _mm512_set1_epi64(static_cast<long long>(x)); }, o, results);
+#endif
+
+	if (!o.csv.empty()) {
+		std::ofstream f(o.csv);
+		write_csv(results, f);
+	}
+	else {
+		write_csv(results, std::cout);
+	}
+	return 0;
+}
@@ -0,0 +1,260 @@
+// Decomposition of every four input Boolean Function into ternary functions.
+//
+// A function of A, B, C and D is a 16-bit truth table (A = 0xFF00, B = 0xF0F0, C = 0xCCCC,
+// D = 0xAAAA). The search enumerates all programs of one and two ternary instructions over the
+// inputs and the earlier results; the functions that it does not reach take three, D ? f1 : f0
+// (Shannon expansion) with f1 and f0 functions of A, B and C. Among the programs of minimal
+// length it picks the one whose ternary<K> kernels are the cheapest for SSE and AVX2.
+//
+// Complementing inputs or the output, and permuting the inputs, changes neither the number of
+// instructions (the complements are absorbed into the function codes) nor which programs exist.
+// The output thus has one program per class of functions under these transformations (NPN
+// class), for its least truth table; ternary_four.h maps every other function on its class.
+//
+// usage: decompose4 output_file
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+#include "ternary_cost.cpp"
+
+namespace ternarylogic::decompose4
+{
+	constexpr int n_inputs = 4;
+	constexpr int max_length = 3;
+	constexpr uint16_t input_values[n_inputs] = { 0xFF00, 0xF0F0, 0xCCCC, 0xAAAA };
+
+	/// <summary>
+	/// Operands index the values: 0 = A, 1 = B, 2 = C, 3 = D, 4 and up = results of the earlier instructions
+	/// </summary>
+	struct instruction
+	{
+		uint8_t k;
+		uint8_t a;
+		uint8_t b;
+		uint8_t c;
+	};
+
+	struct decomposition
+	{
+		int length = max_length + 1;
+		int cost = 0;
+		std::array<instruction, max_length> code{};
+	};
+
+	[[nodiscard]] constexpr uint16_t vpternlog(const uint16_t a, const uint16_t b, const uint16_t c, const uint8_t k) noexcept
+	{
+		uint16_t result = 0;
+		for (int i = 0; i < 8; ++i) {
+			if (((k >> i) & 1) == 0) continue;
+			const uint16_t x = (i & 4) ? a : static_cast<uint16_t>(~a);
+			const uint16_t y = (i & 2) ? b : static_cast<uint16_t>(~b);
+			const uint16_t z = (i & 1) ? c : static_cast<uint16_t>(~c);
+			result |= x & y & z;
+		}
+		return result;
+	}
+
+	/// <summary>
+	/// Instructions and constants of the SSE/AVX2 kernel of k, the tie break between programs of the same length
+	/// </summary>
+	[[nodiscard]] constexpr int kernel_cost(const uint8_t k) noexcept
+	{
+		return costs::avx2[k].instructions + costs::avx2[k].constants;
+	}
+
+	/// <summary>
+	/// Function g(x) = o ^ f(y) with y[j] = x[perm[j]] ^ n[j], where bit j of negate is n[j]
+	/// </summary>
+	[[nodiscard]] inline uint16_t transform(const uint16_t f, const std::array<int, n_inputs>& perm, const int negate, const bool complement) noexcept
+	{
+		uint16_t g = 0;
+		for (int x = 0; x < 16; ++x) {
+			int y = 0;
+			for (int j = 0; j < n_inputs; ++j) {
+				const int bit = ((x >> (n_inputs - 1 - perm[j])) & 1) ^ ((negate >> j) & 1);
+				y |= bit << (n_inputs - 1 - j);
+			}
+			g |= static_cast<uint16_t>(((f >> y) & 1) << x);
+		}
+		return complement ? static_cast<uint16_t>(~g) : g;
+	}
+
+	/// <summary>
+	/// Least truth table of the NPN class of f
+	/// </summary>
+	[[nodiscard]] inline uint16_t representative(const uint16_t f) noexcept
+	{
+		std::array<int, n_inputs> perm = { 0, 1, 2, 3 };
+		uint16_t result = f;
+		do {
+			for (int negate = 0; negate < (1 << n_inputs); ++negate) {
+				result = std::min({ result, transform(f, perm, negate, false), transform(f, perm, negate, true) });
+			}
+		} while (std::next_permutation(perm.begin(), perm.end()));
+		return result;
+	}
+
+	class search
+	{
+		std::vector<decomposition> best_;
+
+		void offer(const uint16_t f, const decomposition& d)
+		{
+			decomposition& b = best_[f];
+			if ((d.length < b.length) || ((d.length == b.length) && (d.cost < b.cost))) b = d;
+		}
+
+	public:
+		search() : best_(1 << 16) {}
+
+		void run()
+		{
+			// one instruction over the inputs; operands may repeat, thus functions of fewer inputs are included
+			std::vector<uint16_t> first;
+			for (int a = 0; a < n_inputs; ++a) {
+				for (int b = 0; b < n_inputs; ++b) {
+					for (int c = 0; c < n_inputs; ++c) {
+						for (int k = 0; k < 256; ++k) {
+							const uint16_t f = vpternlog(input_values[a], input_values[b], input_values[c], static_cast<uint8_t>(k));
+							decomposition d;
+							d.length = 1;
+							d.cost = kernel_cost(static_cast<uint8_t>(k));
+							d.code[0] = instruction{ static_cast<uint8_t>(k), static_cast<uint8_t>(a), static_cast<uint8_t>(b), static_cast<uint8_t>(c) };
+							if (best_[f].length > 1) first.push_back(f);
+							offer(f, d);
+						}
+					}
+				}
+			}
+
+			// a second instruction over the inputs and the first result
+			for (const uint16_t v : first) {
+				const decomposition& d1 = best_[v];
+				const uint16_t values[n_inputs + 1] = { input_values[0], input_values[1], input_values[2], input_values[3], v };
+				for (int a = 0; a <= n_inputs; ++a) {
+					for (int b = 0; b <= n_inputs; ++b) {
+						for (int c = 0; c <= n_inputs; ++c) {
+							if ((a != n_inputs) && (b != n_inputs) && (c != n_inputs)) continue;
+							for (int k = 0; k < 256; ++k) {
+								const uint16_t f = vpternlog(values[a], values[b], values[c], static_cast<uint8_t>(k));
+								if (best_[f].length < 2) continue;
+								decomposition d;
+								d.length = 2;
+								d.cost = d1.cost + kernel_cost(static_cast<uint8_t>(k));
+								d.code[0] = d1.code[0];
+								d.code[1] = instruction{ static_cast<uint8_t>(k), static_cast<uint8_t>(a), static_cast<uint8_t>(b), static_cast<uint8_t>(c) };
+								offer(f, d);
+							}
+						}
+					}
+				}
+			}
+
+			// the rest by Shannon expansion on any of the inputs: x ? f1 : f0
+			for (int f = 0; f < (1 << 16); ++f) {
+				if (best_[f].length <= 2) continue;
+				for (int x = 0; x < n_inputs; ++x) {
+					int others[3];
+					for (int i = 0, j = 0; i < n_inputs; ++i) {
+						if (i != x) others[j++] = i;
+					}
+					// the truth tables of f1 and f0 over the other three inputs
+					uint8_t k1 = 0;
+					uint8_t k0 = 0;
+					for (int i = 0; i < 8; ++i) {
+						int index = 0;
+						for (int j = 0; j < 3; ++j) {
+							index |= ((i >> (2 - j)) & 1) << (n_inputs - 1 - others[j]);
+						}
+						k0 |= static_cast<uint8_t>(((f >> index) & 1) << i);
+						k1 |= static_cast<uint8_t>(((f >> (index | (1 << (n_inputs - 1 - x)))) & 1) << i);
+					}
+					decomposition d;
+					d.length = 3;
+					d.cost = kernel_cost(k1) + kernel_cost(k0) + kernel_cost(0xCA);
+					d.code[0] = instruction{ k1, static_cast<uint8_t>(others[0]), static_cast<uint8_t>(others[1]), static_cast<uint8_t>(others[2]) };
+					d.code[1] = instruction{ k0, static_cast<uint8_t>(others[0]), static_cast<uint8_t>(others[1]), static_cast<uint8_t>(others[2]) };
+					d.code[2] = instruction{ 0xCA, static_cast<uint8_t>(x), n_inputs, n_inputs + 1 };
+					offer(static_cast<uint16_t>(f), d);
+				}
+			}
+		}
+
+		[[nodiscard]] const decomposition& best(const uint16_t f) const noexcept { return best_[f]; }
+	};
+
+	/// <summary>
+	/// Run the program on the truth tables of the inputs
+	/// </summary>
+	[[nodiscard]] inline uint16_t evaluate(const decomposition& d) noexcept
+	{
+		uint16_t r[n_inputs + max_length] = { input_values[0], input_values[1], input_values[2], input_values[3] };
+		for (int i = 0; i < d.length; ++i) {
+			r[n_inputs + i] = vpternlog(r[d.code[i].a], r[d.code[i].b], r[d.code[i].c], d.code[i].k);
+		}
+		return r[n_inputs + d.length - 1];
+	}
+
+	inline void write(const search& s, std::ostream& os)
+	{
+		std::vector<uint16_t> classes;
+		for (int f = 0; f < (1 << 16); ++f) {
+			if (representative(static_cast<uint16_t>(f)) == f) classes.push_back(static_cast<uint16_t>(f));
+		}
+
+		int lengths[max_length + 1] = {};
+		for (const uint16_t f : classes) ++lengths[s.best(f).length];
+
+		os << "// Generated automatically by decompose4, please do not edit\n";
+		os << "#pragma once\n";
+		os << "#include <cstdint>\n\n";
+		os << "namespace ternarylogic::four {\n\n";
+		os << "    // operands: 0 = A, 1 = B, 2 = C, 3 = D, 4 and up = results of the earlier instructions\n";
+		os << "    struct instruction { uint8_t k, a, b, c; };\n\n";
+		os << "    constexpr int max_instructions = " << max_length << ";\n\n";
+		os << "    // the result is the one of the last instruction\n";
+		os << "    struct program { uint16_t k16; uint8_t size; instruction code[max_instructions]; };\n\n";
+		os << "    // the least function of every NPN class, sorted; " << lengths[1] << " take one instruction, "
+			<< lengths[2] << " two and " << lengths[3] << " three\n";
+		os << "    constexpr program classes[" << classes.size() << "] = {\n";
+		for (const uint16_t f : classes) {
+			const decomposition& d = s.best(f);
+			if (evaluate(d) != f) {
+				std::cerr << "wrong program of " << f << std::endl;
+				std::exit(2);
+			}
+			char line[128];
+			std::snprintf(line, sizeof(line), "        { 0x%04x, %d, {", f, d.length);
+			os << line;
+			for (int i = 0; i < d.length; ++i) {
+				std::snprintf(line, sizeof(line), " { 0x%02x, %d, %d, %d }%s", d.code[i].k, d.code[i].a, d.code[i].b, d.code[i].c, (i + 1 < d.length) ? "," : "");
+				os << line;
+			}
+			os << " } },\n";
+		}
+		os << "    };\n";
+		os << "}\n";
+	}
+}
+
+int main(int argc, char** argv)
+{
+	using namespace ternarylogic::decompose4;
+
+	if (argc < 2) {
+		std::cerr << "usage: decompose4 output_file" << std::endl;
+		return 1;
+	}
+
+	search s;
+	s.run();
+
+	std::ofstream file(argv[1]);
+	write(s, file);
+	return 0;
+}
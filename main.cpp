@@ -1,7 +1,17 @@
 #pragma once
 
+// the tests of ternary_logic.cpp, with the compile-time checks of all kernels
+#define TERNARYLOGIC_TESTS
 #include "ternary_logic.cpp"
 #include "shuffle_vars.h"
+#include "ternary_expr.h"
+#include "ternary_jit.h"
+#include "ternary_pairs.h"
+#include "ternary_four.h"
+#include "ternary_synth.h"
+#include "ternary_perf.h"
+#include "ternary_dyn_bitvector.h"
+#include "ternary_bulk.h"
 
 // main for testing
 int main()
@@ -9,6 +19,14 @@ int main()
 	printf("\nGoing to run:\n");
 	ternarylogic::test::tests();
 	ternarylogic::swap::test::test_shuffle_variables();
+	ternarylogic::expr::test::tests();
+	ternarylogic::jit::test::tests();
+	ternarylogic::pairs::test::tests();
+	ternarylogic::four::test::tests();
+	ternarylogic::synth::test::tests();
+	ternarylogic::perf::test::tests();
+	ternarylogic::test::test_dyn_bitvector();
+	ternarylogic::bulk::test::tests();
 	printf("\nPress RETURN to finish:");
 	static_cast<void>(getchar());
 	return 0;
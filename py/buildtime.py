@@ -0,0 +1,171 @@
+"""
+Compile time and memory of the translation units that include ternary_logic.cpp.
+
+It writes probe translation units that include ternary_logic.cpp and use it
+in the common ways (nothing, compile-time k, runtime k on every backend),
+compiles each of them in the configurations of the library:
+
+  tests    TERNARYLOGIC_TESTS: the tests and their compile-time checks of
+           all kernels, as main.cpp compiles them
+  default  what a translation unit compiles now
+  extern   TERNARYLOGIC_EXTERN_RUNTIME: the runtime-k switches come from
+           ternary_runtime.cpp, which is measured as a probe of its own
+
+and writes the wall time and the peak memory (max RSS) of the compiler per
+translation unit. With --baseline the probes are also compiled against a
+git revision of the tree, e.g. --baseline=HEAD~1, for a before and after.
+
+usage: python py/buildtime.py [--cxx=g++] [--flags="-O2 -march=native"]
+                              [--repeat=N] [--baseline=rev]
+                              [--build-dir=dir] -o buildtime.csv
+"""
+
+import os
+import subprocess
+import sys
+import time
+from os.path import dirname, join, realpath
+
+
+ROOT = dirname(dirname(realpath(__file__)))
+
+CONFIGS = [
+    ('tests',   ['-DTERNARYLOGIC_TESTS']),
+    ('default', []),
+    ('extern',  ['-DTERNARYLOGIC_EXTERN_RUNTIME']),
+]
+
+# the backends of the probes, with the guard of their target flags
+TYPES = [
+    ('uint32_t', None),
+    ('uint64_t', None),
+    ('__m128i',  None),
+    ('__m256i',  '__AVX2__'),
+    ('__m512i',  '__AVX512F__'),
+]
+
+# name: body of the probe, per type
+PROBES = [
+    ('include', None),
+    ('kernels', 'extern "C" T probe_%(NAME)s(const T a, const T b, const T c) { return ternarylogic::ternary<0x96>(ternarylogic::ternary<0xE8>(a, b, c), b, c); }'),
+    ('runtime', 'extern "C" T probe_%(NAME)s(const T a, const T b, const T c, const unsigned k) { return ternarylogic::ternary(a, b, c, k); }'),
+]
+
+
+def main():
+    options = parse_args(sys.argv)
+
+    if not os.path.isdir(options.build_dir):
+        os.makedirs(options.build_dir)
+
+    rows = []
+    for name, body in PROBES:
+        source = write_probe(options.build_dir, name, body)
+        for config, defines in CONFIGS:
+            rows.append((config, name) + measure(source, ROOT, defines, options))
+
+    # the explicit instances that the extern configuration links to
+    rows.append(('extern', 'ternary_runtime') + measure(join(ROOT, 'ternary_runtime.cpp'), ROOT, [], options))
+
+    if options.baseline:
+        tree = export(options.baseline, join(options.build_dir, 'baseline'))
+        for name, body in PROBES:
+            source = write_probe(options.build_dir, name, body)
+            rows.append(('baseline', name) + measure(source, tree, [], options))
+
+    write_csv(rows, options.output)
+    summarise(rows)
+
+
+def parse_args(args):
+    from optparse import OptionParser
+
+    parser = OptionParser()
+    parser.add_option("--cxx", default="g++", help="C++ compiler")
+    parser.add_option("--flags", default="-O2 -march=native", help="flags of the compiler")
+    parser.add_option("--repeat", type="int", default=1, help="compilations per translation unit, the fastest is reported")
+    parser.add_option("--baseline", default="", help="git revision to compare with")
+    parser.add_option("--build-dir", default="buildtime", help="directory of the translation units and objects")
+    parser.add_option("-o", "--output", help="csv file")
+
+    (options, rest) = parser.parse_args(args)
+    if options.output is None:
+        parser.error("-o is required")
+
+    return options
+
+
+def write_probe(build_dir, name, body):
+    lines = []
+    lines.append('// Generated by py/buildtime.py, please do not edit')
+    lines.append('#include "ternary_logic.cpp"')
+    if body is not None:
+        for vtype, guard in TYPES:
+            lines.append('')
+            if guard is not None:
+                lines.append('#ifdef %s' % guard)
+            lines.append('namespace types_%s { using T = %s; %s }' % (vtype, vtype, body % {'NAME': vtype}))
+            if guard is not None:
+                lines.append('#endif')
+
+    path = join(build_dir, 'buildtime_%s.cpp' % name)
+    f = open(path, 'w')
+    f.write('\n'.join(lines) + '\n')
+    f.close()
+    return path
+
+
+def export(revision, directory):
+    # the tree of revision, without touching the working copy
+    if not os.path.isdir(directory):
+        os.makedirs(directory)
+
+    archive = subprocess.Popen(['git', '-C', ROOT, 'archive', revision], stdout=subprocess.PIPE)
+    subprocess.check_call(['tar', '-x', '-C', directory], stdin=archive.stdout)
+    archive.stdout.close()
+    if archive.wait() != 0:
+        raise RuntimeError('git archive %s failed' % revision)
+
+    return directory
+
+
+def measure(source, tree, defines, options):
+    # (seconds, peak memory in MB, exit status) of the fastest compilation
+    obj = join(options.build_dir, 'buildtime.o')
+    # the flags first, so that their -I come before the one of the tree
+    command = [options.cxx, '-std=c++17', '-c'] + options.flags.split() + defines
+    command += ['-I' + tree, source, '-o', obj]
+
+    best = None
+    for _ in range(max(1, options.repeat)):
+        start = time.time()
+        process = subprocess.Popen(command)
+        _, status, usage = os.wait4(process.pid, 0)
+        seconds = time.time() - start
+        # ru_maxrss is in kB on Linux
+        result = (seconds, usage.ru_maxrss / 1024.0, os.WEXITSTATUS(status) if os.WIFEXITED(status) else -1)
+        if best is None or result[0] < best[0]:
+            best = result
+
+    return best
+
+
+def write_csv(rows, path):
+    f = open(path, 'w')
+    f.write('config,probe,seconds,max_rss_mb,status\n')
+    for config, probe, seconds, rss, status in rows:
+        f.write('%s,%s,%.2f,%.0f,%d\n' % (config, probe, seconds, rss, status))
+    f.close()
+
+
+def summarise(rows):
+    for config, probe, seconds, rss, status in rows:
+        text = '%-9s %-16s %8.2f s %7.0f MB' % (config, probe, seconds, rss)
+        if status != 0:
+            text += '  (failed: %d)' % status
+
+        print(text)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,303 @@
+"""
+Size and instruction mix of the compiled kernels.
+
+For every backend it writes a translation unit with one out-of-line function
+per ternary<K>, compiles it, disassembles it with objdump and writes, per
+function, the number of instructions, the bytes and the mnemonics. Where
+ternary_logic.cpp has them for the type, the unit includes it and also holds
+the library's runtime-k dispatcher, priv::ternary_hot (the fast paths of
+ternary_dispatch.cpp, then the switch of ternary_reduced.cpp), and the word
+kernels of bitvector, priv::ternary_words<K>, which get_words_kernel tabulates.
+
+The instructions are compared with ternary_cost.cpp: a kernel is flagged when
+the compiler emits more instructions than the generator counted (instructions
+and materialised constants), not counting the register copies, which the
+generator ignores, and the return.
+
+usage: python py/codesize.py [--cxx=g++] [--flags="-O2"] [--backend=sse,avx2]
+                             [--build-dir=dir] -o codesize.csv
+"""
+
+import os
+import re
+import subprocess
+import sys
+from os.path import dirname, join, realpath
+
+
+ROOT = dirname(dirname(realpath(__file__)))
+
+# name: generated file, namespace, type, compiler flags, runtime-k dispatcher of ternary_logic.cpp, word kernels of
+# bitvector (with the flags of the backend they use its kernels)
+BACKENDS = [
+    ('x86_32',     'ternary_x86_32.cpp',     'x86_32',     'uint32_t',  '',            True,  False),
+    ('x86_64',     'ternary_x86_64.cpp',     'x86_64',     'uint64_t',  '',            True,  False),
+    ('x86_32_bmi', 'ternary_x86_32_bmi.cpp', 'x86_32_bmi', 'uint32_t',  '-mbmi',       True,  False),
+    ('x86_64_bmi', 'ternary_x86_64_bmi.cpp', 'x86_64_bmi', 'uint64_t',  '-mbmi',       True,  False),
+    ('sse',        'ternary_sse.cpp',        'sse',        '__m128i',   '',            True,  True),
+    ('avx2',       'ternary_avx2.cpp',       'avx2',       '__m256i',   '-mavx2',      True,  True),
+    ('avx512',     'ternary_avx512.cpp',     'avx512',     '__m512i',   '-mavx512f',   False, False),
+    ('avx512raw',  'ternary_avx512.cpp',     'avx512raw',  '__m512i',   '-mavx512f',   True,  True),
+    ('avx512mask', 'ternary_avx512mask.cpp', 'avx512mask', '__mmask64', '-mavx512bw',  False, False),
+    ('xop',        'ternary_xop.cpp',        'xop',        '__m128i',   '-mxop',       False, False),
+    ('sse_ps',     'ternary_sse_ps.cpp',     'sse_ps',     '__m128',    '',            False, False),
+    ('sse_pd',     'ternary_sse_pd.cpp',     'sse_pd',     '__m128d',   '',            False, False),
+    ('avx_ps',     'ternary_avx_ps.cpp',     'avx_ps',     '__m256',    '-mavx',       False, False),
+    ('avx_pd',     'ternary_avx_pd.cpp',     'avx_pd',     '__m256d',   '-mavx',       False, False),
+]
+
+# ternary_logic.cpp with GCC and Clang, see PORTABLE_FLAGS of the Makefile
+LIBRARY_FLAGS = '-Wno-unknown-pragmas -Wno-ignored-attributes -Wno-psabi'
+
+# instructions of the calling convention, not of the kernel
+IGNORED = set(['ret', 'retq', 'vzeroupper', 'endbr64', 'endbr32'])
+
+
+def main():
+    options = parse_args(sys.argv)
+    costs = load_costs(join(ROOT, 'ternary_cost.cpp'))
+
+    if not os.path.isdir(options.build_dir):
+        os.makedirs(options.build_dir)
+
+    rows = []
+    for backend in BACKENDS:
+        name = backend[0]
+        if options.backends and name not in options.backends:
+            continue
+
+        result = measure(backend, options)
+        if result is None:
+            sys.stderr.write('%s: skipped, the compiler does not build it\n' % name)
+            continue
+
+        rows.extend(report(name, result, costs.get(name)))
+
+    write_csv(rows, options.output)
+    summarise(rows)
+
+
+def parse_args(args):
+    from optparse import OptionParser
+
+    parser = OptionParser()
+    parser.add_option("--cxx", default="g++", help="C++ compiler")
+    parser.add_option("--flags", default="-O2", help="flags of the compiler, besides the ones of the backend")
+    parser.add_option("--objdump", default="objdump")
+    parser.add_option("--backend", default="", help="comma separated backends, all by default")
+    parser.add_option("--build-dir", default="codesize", help="directory of the translation units and objects")
+    parser.add_option("-o", "--output", help="csv file")
+
+    (options, rest) = parser.parse_args(args)
+    options.backends = [b for b in options.backend.split(',') if b]
+    if options.output is None:
+        parser.error("-o is required")
+
+    return options
+
+
+def load_costs(path):
+    # name -> list of (instructions, depth, constants, operands) per function code
+    result = {}
+    name = None
+    for line in open(path):
+        m = re.search(r'constexpr kernel_cost (\w+)\[256\]', line)
+        if m:
+            name = m.group(1)
+            result[name] = []
+            continue
+
+        m = re.match(r'\s*\{ (\d+), (\d+), (\d+), (\d+) \},', line)
+        if m and name is not None:
+            result[name].append(tuple(int(x) for x in m.groups()))
+
+    return result
+
+
+def symbol(name, k, kind=''):
+    # k is a function code, or 'dispatch'; kind is '' for the kernels and 'words' for the word kernels
+    if isinstance(k, int):
+        k = '%02x' % k
+
+    return 'codesize_%s_%s%s' % (name, kind + '_' if kind else '', k)
+
+
+def translation_unit(backend):
+    name, path, namespace, vtype, flags, dispatch, words = backend
+    library = dispatch or words
+
+    lines = []
+    lines.append('// Generated by py/codesize.py, please do not edit')
+    lines.append('#include <cstdint>')
+    lines.append('#include "ternary_compat.h"')
+    lines.append('#include "%s"' % path)
+    if library:
+        lines.append('#include "ternary_logic.cpp"')
+    lines.append('')
+    lines.append('using T = %s;' % vtype)
+    lines.append('')
+    lines.append('extern "C" {')
+    for k in range(256):
+        lines.append('__attribute__((noinline, used)) T %s(const T a, const T b, const T c) noexcept { return ternarylogic::%s::ternary<0x%02x>(a, b, c); }'
+                     % (symbol(name, k), namespace, k))
+
+    if dispatch:
+        lines.append('')
+        # flatten: the switch and its kernels as in a caller that inlines ternary(a, b, c, k), the compiler keeps them out of line here
+        lines.append('__attribute__((noinline, used, flatten)) T %s(const T a, const T b, const T c, const unsigned k) noexcept { return ternarylogic::priv::ternary_hot(a, b, c, k); }'
+                     % symbol(name, 'dispatch'))
+
+    if words:
+        lines.append('')
+        for k in range(256):
+            lines.append('__attribute__((noinline, used)) void %s(uint64_t* dst, const uint64_t* a, const uint64_t* b, const uint64_t* c, const size_t n) noexcept '
+                         '{ ternarylogic::priv::ternary_words<0x%02x, static_cast<unsigned>(ternarylogic::default_uarch)>(dst, a, b, c, n); }'
+                         % (symbol(name, k, 'words'), k))
+
+    lines.append('}')
+    return '\n'.join(lines) + '\n'
+
+
+def measure(backend, options):
+    # function name -> (bytes, list of (mnemonic, operands))
+    name = backend[0]
+    flags = backend[4]
+    if backend[5] or backend[6]:
+        flags += ' ' + LIBRARY_FLAGS
+    source = join(options.build_dir, 'codesize_%s.cpp' % name)
+    obj = join(options.build_dir, 'codesize_%s.o' % name)
+
+    f = open(source, 'w')
+    f.write(translation_unit(backend))
+    f.close()
+
+    command = [options.cxx, '-std=c++17', '-c', '-ffunction-sections', '-I' + ROOT]
+    command += options.flags.split() + flags.split()
+    command += [source, '-o', obj]
+    if subprocess.call(command) != 0:
+        return None
+
+    sizes = {}
+    for line in run([options.objdump, '-t', obj]).splitlines():
+        # 0000000000000000 g     F .text.codesize_sse_96	0000000000000005 codesize_sse_96
+        fields = line.split()
+        if len(fields) >= 6 and fields[2] == 'F' and fields[-1].startswith('codesize_'):
+            sizes[fields[-1]] = int(fields[-2], 16)
+
+    result = {}
+    current = None
+    for line in run([options.objdump, '-d', '-w', '--no-show-raw-insn', obj]).splitlines():
+        m = re.match(r'[0-9a-f]+ <(\w+)>:', line)
+        if m:
+            current = m.group(1) if m.group(1) in sizes else None
+            if current is not None:
+                result[current] = (sizes[current], [])
+            continue
+
+        m = re.match(r'\s*[0-9a-f]+:\s+(\S+)\s*(.*)', line)
+        if m and current is not None:
+            result[current][1].append((m.group(1), m.group(2).strip()))
+
+    return result
+
+
+def run(command):
+    output = subprocess.check_output(command)
+    if not isinstance(output, str):
+        output = output.decode('utf-8', 'replace')
+
+    return output
+
+
+def is_copy(mnemonic, operands):
+    # a move between registers, which the two operand encodings and the calling convention need
+    if not re.match(r'(v?mov|kmov)', mnemonic):
+        return False
+
+    return '(' not in operands and '$' not in operands
+
+
+def analyse(instructions):
+    count = 0
+    copies = 0
+    mix = {}
+    for mnemonic, operands in instructions:
+        mix[mnemonic] = mix.get(mnemonic, 0) + 1
+        if mnemonic in IGNORED:
+            continue
+
+        count += 1
+        if is_copy(mnemonic, operands):
+            copies += 1
+
+    return count, copies, mix
+
+
+def report(name, result, costs):
+    rows = []
+    for k in range(256):
+        sym = symbol(name, k)
+        if sym not in result:
+            continue
+
+        size, instructions = result[sym]
+        count, copies, mix = analyse(instructions)
+        expected = None
+        longer = False
+        if costs is not None:
+            expected = costs[k][0] + costs[k][2]
+            longer = (count - copies) > expected
+
+        rows.append((name, '0x%02x' % k, count, copies, size, expected, longer, mix))
+
+    sym = symbol(name, 'dispatch')
+    if sym in result:
+        size, instructions = result[sym]
+        count, copies, mix = analyse(instructions)
+        rows.append((name, 'dispatch', count, copies, size, None, False, mix))
+
+    # the word kernels loop over the vectors: reported apart, not compared with the costs of one kernel
+    for k in range(256):
+        sym = symbol(name, k, 'words')
+        if sym in result:
+            size, instructions = result[sym]
+            count, copies, mix = analyse(instructions)
+            rows.append((name + '_words', '0x%02x' % k, count, copies, size, None, False, mix))
+
+    return rows
+
+
+def write_csv(rows, path):
+    f = open(path, 'w')
+    f.write('backend,k,instructions,copies,bytes,expected,longer,mix\n')
+    for name, k, count, copies, size, expected, longer, mix in rows:
+        text = ' '.join('%s:%d' % (m, mix[m]) for m in sorted(mix))
+        f.write('%s,%s,%d,%d,%d,%s,%s,%s\n' % (name, k, count, copies, size,
+                                               '' if expected is None else expected,
+                                               'yes' if longer else 'no', text))
+    f.close()
+
+
+def summarise(rows):
+    names = []
+    for row in rows:
+        if row[0] not in names:
+            names.append(row[0])
+
+    for name in names:
+        kernels = [row for row in rows if row[0] == name and row[1] != 'dispatch']
+        dispatch = [row for row in rows if row[0] == name and row[1] == 'dispatch']
+        longer = [row[1] for row in kernels if row[6]]
+        text = '%s: %d bytes in %d kernels' % (name, sum(row[4] for row in kernels), len(kernels))
+        if dispatch:
+            text += ', dispatcher %d bytes' % dispatch[0][4]
+
+        text += ', %d longer than expected' % len(longer)
+        if longer:
+            text += ' (%s)' % ' '.join(longer[:16] + (['...'] if len(longer) > 16 else []))
+
+        print(text)
+
+
+if __name__ == '__main__':
+    main()
@@ -24,6 +24,9 @@ class Assembler:
     def add_xor(self, var1, var2):
         raise ValueError("unsupported")
 
+    def add_xnor(self, var1, var2):
+        raise ValueError("unsupported")
+
     def add_notand(self, var1, var2):
         raise ValueError("unsupported")
 
@@ -35,3 +38,9 @@ class Assembler:
 
     def add_condition(self, cond, var1, var2):
         raise ValueError("unsupported")
+
+    def add_return(self, var):
+        return 'return %s;' % (var)
+
+    def add_return_tuple(self, vars):
+        return 'return { %s };' % ', '.join(vars)
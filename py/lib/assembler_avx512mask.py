@@ -0,0 +1,57 @@
+from assembler import Assembler
+
+class AssemblerAVX512Mask(Assembler):
+    "AVX-512 mask registers (k0..k7), AVX512BW for the 64-bit masks"
+
+    def __init__(self):
+        Assembler.__init__(self)
+        self.type = '__mmask64'
+        self.const_type = 'const %s' % (self.type)
+
+    def add_false(self):
+        var  = 'c0'
+        expr = '%s %s = _cvtu64_mask64(0);' % (self.const_type, var)
+
+        return (var, expr)
+
+    def add_true(self):
+        var  = 'c1'
+        expr = '%s %s = _cvtu64_mask64(~0ull);' % (self.const_type, var)
+
+        return (var, expr)
+
+    def add_and(self, var1, var2):
+        var  = self.get_var()
+        expr = '%s %s = _kand_mask64(%s, %s);' % (self.const_type, var, var1, var2)
+
+        return (var, expr)
+
+    def add_or(self, var1, var2):
+        var  = self.get_var()
+        expr = '%s %s = _kor_mask64(%s, %s);' % (self.const_type, var, var1, var2)
+
+        return (var, expr)
+
+    def add_xor(self, var1, var2):
+        var  = self.get_var()
+        expr = '%s %s = _kxor_mask64(%s, %s);' % (self.const_type, var, var1, var2)
+
+        return (var, expr)
+
+    def add_xnor(self, var1, var2):
+        var  = self.get_var()
+        expr = '%s %s = _kxnor_mask64(%s, %s);' % (self.const_type, var, var1, var2)
+
+        return (var, expr)
+
+    def add_notand(self, var1, var2):
+        var  = self.get_var()
+        expr = '%s %s = _kandn_mask64(%s, %s);' % (self.const_type, var, var1, var2)
+
+        return (var, expr)
+
+    def add_negation(self, var1):
+        var  = self.get_var()
+        expr = '%s %s = _knot_mask64(%s);' % (self.const_type, var, var1)
+
+        return (var, expr)
@@ -0,0 +1,62 @@
+from assembler import Assembler
+
+class AssemblerFloat(Assembler):
+    "Logic in the floating point domain (andps, orps, xorps, andnps), thus without bypass delays next to FP arithmetic"
+
+    def __init__(self, type, prefix, suffix, ones):
+        Assembler.__init__(self)
+        self.type   = type
+        self.prefix = prefix    # _mm or _mm256
+        self.suffix = suffix    # ps or pd
+        self.ones   = ones      # all ones, a cast is free
+        self.const_type = 'const %s' % (self.type)
+
+    def add_false(self):
+        var  = 'c0'
+        expr = '%s %s = %s_setzero_%s();' % (self.const_type, var, self.prefix, self.suffix)
+
+        return (var, expr)
+
+    def add_true(self):
+        var  = 'c1'
+        expr = '%s %s = %s;' % (self.const_type, var, self.ones)
+
+        return (var, expr)
+
+    def add_op(self, op, var1, var2):
+        var  = self.get_var()
+        expr = '%s %s = %s_%s_%s(%s, %s);' % (self.const_type, var, self.prefix, op, self.suffix, var1, var2)
+
+        return (var, expr)
+
+    def add_and(self, var1, var2):
+        return self.add_op('and', var1, var2)
+
+    def add_or(self, var1, var2):
+        return self.add_op('or', var1, var2)
+
+    def add_xor(self, var1, var2):
+        return self.add_op('xor', var1, var2)
+
+    def add_notand(self, var1, var2):
+        return self.add_op('andnot', var1, var2)
+
+
+class AssemblerSSE_PS(AssemblerFloat):
+    def __init__(self):
+        AssemblerFloat.__init__(self, '__m128', '_mm', 'ps', '_mm_castsi128_ps(_mm_set1_epi32(-1))')
+
+
+class AssemblerSSE_PD(AssemblerFloat):
+    def __init__(self):
+        AssemblerFloat.__init__(self, '__m128d', '_mm', 'pd', '_mm_castsi128_pd(_mm_set1_epi32(-1))')
+
+
+class AssemblerAVX_PS(AssemblerFloat):
+    def __init__(self):
+        AssemblerFloat.__init__(self, '__m256', '_mm256', 'ps', '_mm256_castsi256_ps(_mm256_set1_epi32(-1))')
+
+
+class AssemblerAVX_PD(AssemblerFloat):
+    def __init__(self):
+        AssemblerFloat.__init__(self, '__m256d', '_mm256', 'pd', '_mm256_castsi256_pd(_mm256_set1_epi32(-1))')
@@ -0,0 +1,69 @@
+from assembler import Assembler
+
+# truth tables of the operations over the operands (a, b, c), as in reference::vpternlog
+CODE = {
+    'false'  : 0x00,
+    'true'   : 0xff,
+    'not'    : 0x0f,    # not a
+    'and'    : 0xc0,
+    'or'     : 0xfc,
+    'xor'    : 0x3c,
+    'notand' : 0x0c,    # (not a) and b
+    'cond'   : 0xca,    # a ? b : c
+}
+
+# registers of ternarylogic::pairs::kernel
+INPUTS = ('A', 'B', 'C')
+
+class AssemblerPairs(Assembler):
+    """
+    Kernels of pairs as data: every instruction is the single instruction kernel
+    ternary<code> of an operation over registers, it writes the next register
+    """
+
+    def __init__(self):
+        Assembler.__init__(self)
+        self.type = 'kernel'
+        self.registers = dict((var, index) for index, var in enumerate(INPUTS))
+
+    def instruction(self, var, op, a, b=None, c=None):
+        # unused operands repeat the first one, the kernel ignores them
+        operands = [self.registers[x] for x in (a, b or a, c or a)]
+        self.registers[var] = len(self.registers)
+
+        return '{ 0x%02x, %d, %d, %d },' % (CODE[op], operands[0], operands[1], operands[2])
+
+    def add_false(self):
+        var = 'c0'
+        return (var, self.instruction(var, 'false', 'A'))
+
+    def add_true(self):
+        var = 'c1'
+        return (var, self.instruction(var, 'true', 'A'))
+
+    def add_and(self, var1, var2):
+        var = self.get_var()
+        return (var, self.instruction(var, 'and', var1, var2))
+
+    def add_or(self, var1, var2):
+        var = self.get_var()
+        return (var, self.instruction(var, 'or', var1, var2))
+
+    def add_xor(self, var1, var2):
+        var = self.get_var()
+        return (var, self.instruction(var, 'xor', var1, var2))
+
+    def add_notand(self, var1, var2):
+        var = self.get_var()
+        return (var, self.instruction(var, 'notand', var1, var2))
+
+    def add_negation(self, var1):
+        var = self.get_var()
+        return (var, self.instruction(var, 'not', var1))
+
+    def add_condition(self, cond, var1, var2):
+        var = self.get_var()
+        return (var, self.instruction(var, 'cond', cond, var1, var2))
+
+    def add_return_tuple(self, vars):
+        return ', '.join('%d' % self.registers[var] for var in vars)
@@ -0,0 +1,66 @@
+from assembler import Assembler
+
+# registers of ternarylogic::program::kernel
+REGISTER = {
+    'A' : 0,
+    'B' : 1,
+    'C' : 2,
+    'c0': 3,
+    'c1': 4,
+}
+
+class AssemblerProgram(Assembler):
+    "Kernels as data: instructions over numbered registers, used by the JIT"
+
+    def __init__(self):
+        Assembler.__init__(self)
+        self.type = 'kernel'
+
+    def register(self, var):
+        if var in REGISTER:
+            return REGISTER[var]
+
+        assert var[0] == 't'
+        return len(REGISTER) + int(var[1:])
+
+    def instruction(self, opcode, dst, a, b):
+        return '{ opcode::%s, %d, %d, %d },' % (opcode, self.register(dst), self.register(a), self.register(b))
+
+    def add_false(self):
+        var  = 'c0'
+        expr = self.instruction('zero', var, var, var)
+
+        return (var, expr)
+
+    def add_true(self):
+        var  = 'c1'
+        expr = self.instruction('ones', var, var, var)
+
+        return (var, expr)
+
+    def add_and(self, var1, var2):
+        var  = self.get_var()
+        expr = self.instruction('bit_and', var, var1, var2)
+
+        return (var, expr)
+
+    def add_or(self, var1, var2):
+        var  = self.get_var()
+        expr = self.instruction('bit_or', var, var1, var2)
+
+        return (var, expr)
+
+    def add_xor(self, var1, var2):
+        var  = self.get_var()
+        expr = self.instruction('bit_xor', var, var1, var2)
+
+        return (var, expr)
+
+    def add_notand(self, var1, var2):
+        var  = self.get_var()
+        expr = self.instruction('bit_andnot', var, var1, var2)
+
+        return (var, expr)
+
+    def add_return(self, var):
+        return self.instruction('ret', var, var, var)
@@ -0,0 +1,20 @@
+from assembler_x86 import AssemblerX86
+
+class AssemblerVext(AssemblerX86):
+    "Operators of GCC/Clang vector extensions; the kernels are templates over the vector type V"
+
+    def __init__(self):
+        AssemblerX86.__init__(self, 'V')
+
+    def add_false(self):
+        var  = 'c0'
+        expr = '%s %s = V{};' % (self.const_type, var)
+
+        return (var, expr)
+
+    def add_true(self):
+        # a vector can not be initialised from a scalar
+        var  = 'c1'
+        expr = '%s %s = ~V{};' % (self.const_type, var)
+
+        return (var, expr)
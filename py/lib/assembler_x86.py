@@ -37,6 +37,13 @@ class AssemblerX86(Assembler):
 
         return (var, expr)
 
+    def add_notand(self, var1, var2):
+        # BMI1 andn, emitted only by lowering_bmi
+        var  = self.get_var()
+        expr = '%s %s = ~%s & %s;' % (self.const_type, var, var1, var2)
+
+        return (var, expr)
+
     def add_negation(self, var1):
         var  = self.get_var()
         expr = '%s %s = ~%s;' % (self.const_type, var, var1)
@@ -57,3 +64,4 @@ class AssemblerX86_64(AssemblerX86):
 class AssemblerX86_32(AssemblerX86):
     def __init__(self):
         AssemblerX86.__init__(self, 'uint32_t')
+
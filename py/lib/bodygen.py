@@ -2,7 +2,10 @@ from ast import *
 
 class BodyGenerator:
     def __init__(self, root, assembler):
+        # a list of roots are functions computed together: their common subexpressions are emitted once
         self.root = root
+        self.roots = root if isinstance(root, (list, tuple)) else [root]
+        self.results = []       # var of every root
         self.program = []
         self.variables = {}
         self.assembler = assembler
@@ -10,9 +13,33 @@ class BodyGenerator:
         self.const0 = None
         self.const1 = None
 
+        # cost metadata of the generated body
+        self.depth = {}         # var -> length of the longest chain of instructions that computes it
+        self.instructions = 0   # instructions, without constants and the return
+        self.constants = 0      # materialised constants
+        self.operands = set()   # used input variables
+        self.ops = []           # (op, var, operand vars) of every emitted instruction, see lib.uarch
+
+    def key(self, node):
+        "Structural key of node: equal subexpressions are emitted once, thus data files can express DAGs as trees"
+        if isinstance(node, Constant):
+            return ('const', node.value)
+        elif isinstance(node, Variable):
+            return ('var', node.var)
+        elif isinstance(node, Negation):
+            return ('not', self.key(node.value))
+        elif isinstance(node, Binary):
+            return (node.op, self.key(node.a), self.key(node.b))
+        elif isinstance(node, Condition):
+            return ('cond', self.key(node.var), self.key(node.true), self.key(node.false))
+
+        assert False, node
+
+
     def emit(self, node):
-        if node in self.variables:
-            return self.variables[node]
+        key = self.key(node)
+        if key in self.variables:
+            return self.variables[key]
 
         var  = None
         expr = None
@@ -32,6 +59,7 @@ class BodyGenerator:
 
         elif isinstance(node, Variable):
             var = node.var
+            self.operands.add(var)
 
         elif isinstance(node, Negation):
             neg = self.emit(node.value)
@@ -49,6 +77,8 @@ class BodyGenerator:
                 var, expr = self.assembler.add_xor(a, b)
             elif node.op == 'notand':
                 var, expr = self.assembler.add_notand(a, b)
+            elif node.op == 'xnor':
+                var, expr = self.assembler.add_xnor(a, b)
             else:
                 assert False, "unsupported op=%s" % node.op
 
@@ -63,14 +93,52 @@ class BodyGenerator:
 
         if expr:
             self.program.append(expr)
+            if isinstance(node, Constant):
+                self.constants += 1
+                self.ops.append(('true' if node.value else 'false', var, []))
+            else:
+                children = self.children(node)
+                self.instructions += 1
+                self.depth[var] = 1 + max([0] + [self.depth.get(child, 0) for child in children])
+                self.ops.append((self.op(node), var, children))
 
-        self.variables[node] = var
+        self.variables[key] = var
         self.last = var
         return var
 
 
+    def children(self, node):
+        "Variables of the operands of node, which must be already emitted"
+        if isinstance(node, Negation):
+            return [self.emit(node.value)]
+        elif isinstance(node, Binary):
+            return [self.emit(node.a), self.emit(node.b)]
+        elif isinstance(node, Condition):
+            return [self.emit(node.var), self.emit(node.true), self.emit(node.false)]
+
+        return []
+
+
+    def op(self, node):
+        if isinstance(node, Negation):
+            return 'not'
+        elif isinstance(node, Binary):
+            return node.op
+        elif isinstance(node, Condition):
+            return 'cond'
+
+        assert False, node
+
+
+    def get_depth(self):
+        return max([0] + [self.depth.get(var, 0) for var in self.results])
+
+
     def run(self):
-        self.emit(self.root)
-        self.program.append('return %s;' % self.last)
+        self.results = [self.emit(root) for root in self.roots]
+        if len(self.results) == 1:
+            self.program.append(self.assembler.add_return(self.last))
+        else:
+            self.program.append(self.assembler.add_return_tuple(self.results))
 
         return self.program
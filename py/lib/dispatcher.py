@@ -0,0 +1,46 @@
+# Dispatcher of the runtime ternary(a, b, c, k): fast paths for the function
+# codes that a profile dump (ternarylogic::profile::dump) shows to be hot
+
+# C++ type that selects each backend, see ternarylogic::isa_of
+ISA_TYPE = {
+    'x86_32'    : 'uint32_t',
+    'x86_64'    : 'uint64_t',
+    'x86_32_bmi': 'uint32_t',
+    'x86_64_bmi': 'uint64_t',
+    'sse'       : '__m128i',
+    'avx2'      : '__m256i',
+    'avx512raw' : '__m512i',
+}
+
+
+def load_profile(file):
+    "Returns dict isa -> dict code -> number of calls"
+
+    result = {}
+    for line in file:
+        line = line.strip()
+
+        # skip empty lines, comments and the header
+        if not line or line[0] == '#' or line.startswith('isa,'):
+            continue
+
+        f = line.split(',')
+        assert(len(f) == 4)
+
+        isa   = f[0]
+        code  = int(f[1], 0)
+        calls = int(f[2])
+
+        result.setdefault(isa, {})
+        result[isa][code] = result[isa].get(code, 0) + calls
+
+    return result
+
+
+def hottest(calls, count):
+    "The count most called codes, most called first"
+
+    codes = [code for code in calls if calls[code] > 0]
+    codes.sort(key=lambda code: (-calls[code], code))
+
+    return codes[:count]
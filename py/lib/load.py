@@ -21,3 +21,27 @@ def load(file):
         result[value] = (string, expr)
 
     return result
+
+
+def load_pairs(file):
+    "Pairs of functions computed together: (code1, code2) -> ((string1, string2), (expr1, expr2))"
+
+    result = {}
+
+    for k, line in enumerate(file):
+        line = line.strip()
+
+        # skip empty lines and comments
+        if not line or line[0] == '#':
+            continue
+
+        f = line.split()
+        assert(len(f) == 4)
+
+        codes   = (int(f[0], 16), int(f[1], 16))
+        strings = (f[2], f[3])
+        exprs   = (parser.parse(f[2]), parser.parse(f[3]))
+
+        result[codes] = (strings, exprs)
+
+    return result
@@ -0,0 +1,56 @@
+# Transformations apply to AVX-512 mask registers: kand, kor, kxor, kxnor, kandn and knot
+
+from ast import *
+
+def transform_binary(root):
+
+    if isinstance(root, (Constant, Variable)):
+        return root
+
+    if isinstance(root, Binary):
+        a = transform_binary(root.a)
+        b = transform_binary(root.b)
+
+        if root.op in ('or', 'xor', 'xnor'):
+            return Binary(root.op, a, b)
+
+        # nor/nand are not supported
+        elif root.op == 'nor':
+            return Negation(Binary('or', a, b))
+        elif root.op == 'nand':
+            return Negation(Binary('and', a, b))
+        elif root.op == 'and':
+            # exploiting existence of the kandn instruction
+            if isinstance(a, Negation):
+                return Binary('notand', a.value, b)
+            elif isinstance(b, Negation):
+                return Binary('notand', b.value, a)
+            else:
+                return Binary(root.op, a, b)
+
+    if isinstance(root, Condition):
+        # x ? y : z <=> (x and y) or kandn(x, z)
+        var   = transform_binary(root.var)
+        true  = transform_binary(root.true)
+        false = transform_binary(root.false)
+
+        t1 = Binary('and', var, true)
+        t2 = Binary('notand', var, false)
+        return Binary('or', t1, t2)
+
+    if isinstance(root, Negation):
+        value = transform_binary(root.value)
+
+        # not (a xor b) is a single kxnor
+        if isinstance(value, Binary) and value.op == 'xor':
+            return Binary('xnor', value.a, value.b)
+        elif isinstance(value, Binary) and value.op == 'xnor':
+            return Binary('xor', value.a, value.b)
+
+        return Negation(value)
+
+    assert False, root
+
+
+def transform(root):
+    return transform_binary(root)
@@ -0,0 +1,50 @@
+# Transformations apply to x86 code with BMI1, which has andn (not a and b)
+
+from ast import *
+
+def transform_binary(root):
+
+    if isinstance(root, (Constant, Variable)):
+        return root
+
+    if isinstance(root, Binary):
+        a = transform_binary(root.a)
+        b = transform_binary(root.b)
+
+        if root.op in ('or', 'xor'):
+            return Binary(root.op, a, b)
+
+        # nor/nand/xnor are not supported
+        elif root.op == 'nor':
+            return Negation(Binary('or', a, b))
+        elif root.op == 'nand':
+            return Negation(Binary('and', a, b))
+        elif root.op == 'xnor':
+            return Negation(Binary('xor', a, b))
+        elif root.op == 'and':
+            # exploiting existence of the andn instruction
+            if isinstance(a, Negation):
+                return Binary('notand', a.value, b)
+            elif isinstance(b, Negation):
+                return Binary('notand', b.value, a)
+            else:
+                return Binary(root.op, a, b)
+
+    if isinstance(root, Condition):
+        # x ? y : z <=> (x and y) or andn(x, z)
+        var   = transform_binary(root.var)
+        true  = transform_binary(root.true)
+        false = transform_binary(root.false)
+
+        t1 = Binary('and', var, true)
+        t2 = Binary('notand', var, false)
+        return Binary('or', t1, t2)
+
+    if isinstance(root, Negation):
+        return Negation(transform_binary(root.value))
+
+    assert False, root
+
+
+def transform(root):
+    return transform_binary(root)
@@ -44,6 +44,15 @@ def expression(lexer):
 
                 return ret
 
+        # selS T F = S ? T : F, for the selectors that are not a variable
+        if lexer.startswith('sel'):
+            lexer.skip(len('sel'))
+            var   = expression(lexer)
+            true  = expression(lexer)
+            false = expression(lexer)
+
+            return Condition(var, true, false)
+
         if lexer.startswith('notand'):
             lexer.skip(len('notand'))
             a = Negation(expression(lexer))
@@ -0,0 +1,27 @@
+# Operand orders of a ternary function, see shuffle_vars.h
+
+ORDERS = ('abc', 'acb', 'bac', 'bca', 'cab', 'cba')
+
+# truth vectors of the inputs, as in reference::vpternlog
+INPUT = {'a': 0xf0, 'b': 0xcc, 'c': 0xaa}
+
+
+def vpternlog(a, b, c, code):
+    result = 0
+    for i in xrange(8):
+        index = (((a >> i) & 1) << 2) | (((b >> i) & 1) << 1) | ((c >> i) & 1)
+        result |= ((code >> index) & 1) << i
+
+    return result
+
+
+def permute(code, order):
+    "The function that, called with the inputs in the given order, computes function code"
+
+    target = vpternlog(INPUT['a'], INPUT['b'], INPUT['c'], code)
+    x, y, z = [INPUT[v] for v in order]
+    for k in xrange(256):
+        if vpternlog(x, y, z, k) == target:
+            return k
+
+    assert False
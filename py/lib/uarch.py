@@ -0,0 +1,224 @@
+# Microarchitecture cost profiles: the generator estimates with them, per core,
+# the reciprocal throughput and the latency of a kernel (see estimate)
+#
+# Numbers follow the published instruction tables (uops.info, Agner Fog);
+# only the instructions that the kernels use are modelled.
+
+VECTOR = 'vector'   # SSE/AVX/AVX-512 integer logic
+SCALAR = 'scalar'   # general purpose ALU
+MASK   = 'mask'     # AVX-512 mask registers
+
+# ops of BodyGenerator.ops
+LOGIC = ('and', 'or', 'xor', 'xnor', 'notand', 'not')
+
+
+class Profile:
+    def __init__(self, name, description, width, ports, latency, andn, cmov=None,
+                 vector_move_elimination=True, scalar_move_elimination=True, targets=()):
+
+        self.name        = name
+        self.description = description
+        self.width       = width     # instructions renamed per cycle
+        self.ports       = ports     # (domain, bits) -> number of ports that execute logic ops
+        self.latency     = latency   # domain -> latency of a logic op
+        self.andn        = andn      # number of ports that execute BMI1 andn
+        self.cmov        = cmov      # (latency, uops) of XOP vpcmov
+        self.vector_move_elimination = vector_move_elimination
+        self.scalar_move_elimination = scalar_move_elimination
+        self.targets     = targets   # generator targets that the core executes
+
+
+# the x86 and the SSE (also _ps and _pd) targets use legacy two operand encodings, so an
+# instruction overwrites one of its sources; AVX, AVX-512, XOP and andn do not
+DESTRUCTIVE = ('sse', 'sse_ps', 'sse_pd', 'x86_64', 'x86_32', 'x86_64_bmi', 'x86_32_bmi')
+
+# targets where notand is the three operand andn
+BMI = ('x86_64_bmi', 'x86_32_bmi')
+
+# domain and register width of each target
+DOMAIN = {
+    'sse'    : (VECTOR, 128),
+    'avx2'   : (VECTOR, 256),
+    'avx512' : (VECTOR, 512),
+    'xop'    : (VECTOR, 128),
+    'x86_64' : (SCALAR, 64),
+    'x86_32' : (SCALAR, 32),
+    'x86_64_bmi' : (SCALAR, 64),
+    'x86_32_bmi' : (SCALAR, 32),
+    'avx512mask' : (MASK, 64),
+    'sse_ps' : (VECTOR, 128),
+    'sse_pd' : (VECTOR, 128),
+    'avx_ps' : (VECTOR, 256),
+    'avx_pd' : (VECTOR, 256),
+}
+
+
+PROFILES = (
+    # andn runs on ports 1 and 5 only, the other ALU ops on 0, 1, 5 and 6
+    Profile('skylake', 'Intel Skylake, Kaby Lake, Coffee Lake (client)',
+        width   = 4,
+        ports   = {(VECTOR, 128): 3, (VECTOR, 256): 3, (SCALAR, 64): 4, (SCALAR, 32): 4},
+        latency = {VECTOR: 1, SCALAR: 1},
+        andn    = 2,
+        targets = ('sse', 'avx2', 'x86_64', 'x86_32', 'x86_64_bmi', 'x86_32_bmi')),
+
+    # 512-bit uops fuse ports 0 and 1, and the microcode disables the
+    # elimination of general purpose register moves (erratum ICL065);
+    # the mask logic (kandq, korq, ...) runs on port 0 only
+    Profile('icelake', 'Intel Ice Lake, Tiger Lake',
+        width   = 5,
+        ports   = {(VECTOR, 128): 3, (VECTOR, 256): 3, (VECTOR, 512): 2, (SCALAR, 64): 4, (SCALAR, 32): 4, (MASK, 64): 1},
+        latency = {VECTOR: 1, SCALAR: 1, MASK: 1},
+        andn    = 2,
+        scalar_move_elimination = False,
+        targets = ('sse', 'avx2', 'avx512', 'avx512mask', 'x86_64', 'x86_32', 'x86_64_bmi', 'x86_32_bmi')),
+
+    Profile('zen2', 'AMD Zen 2',
+        width   = 5,
+        ports   = {(VECTOR, 128): 4, (VECTOR, 256): 4, (SCALAR, 64): 4, (SCALAR, 32): 4},
+        latency = {VECTOR: 1, SCALAR: 1},
+        andn    = 4,
+        targets = ('sse', 'avx2', 'x86_64', 'x86_32', 'x86_64_bmi', 'x86_32_bmi')),
+
+    Profile('zen3', 'AMD Zen 3',
+        width   = 6,
+        ports   = {(VECTOR, 128): 4, (VECTOR, 256): 4, (SCALAR, 64): 4, (SCALAR, 32): 4},
+        latency = {VECTOR: 1, SCALAR: 1},
+        andn    = 4,
+        targets = ('sse', 'avx2', 'x86_64', 'x86_32', 'x86_64_bmi', 'x86_32_bmi')),
+
+    # 512-bit uops occupy both halves of the 256-bit pipes; two pipes run the mask logic
+    Profile('zen4', 'AMD Zen 4',
+        width   = 6,
+        ports   = {(VECTOR, 128): 4, (VECTOR, 256): 4, (VECTOR, 512): 2, (SCALAR, 64): 4, (SCALAR, 32): 4, (MASK, 64): 2},
+        latency = {VECTOR: 1, SCALAR: 1, MASK: 1},
+        andn    = 4,
+        targets = ('sse', 'avx2', 'avx512', 'avx512mask', 'x86_64', 'x86_32', 'x86_64_bmi', 'x86_32_bmi')),
+
+    # XOP is executed only by the Bulldozer family; vector logic takes
+    # two cycles there and vpcmov is a single uop of the same latency
+    Profile('piledriver', 'AMD Piledriver, Steamroller (XOP)',
+        width   = 4,
+        ports   = {(VECTOR, 128): 2, (SCALAR, 64): 2, (SCALAR, 32): 2},
+        latency = {VECTOR: 2, SCALAR: 1},
+        andn    = 2,
+        cmov    = (2, 1),
+        targets = ('sse', 'xop', 'x86_64', 'x86_32', 'x86_64_bmi', 'x86_32_bmi')),
+)
+
+
+def get(name):
+    for profile in PROFILES:
+        if profile.name == name:
+            return profile
+
+    raise ValueError("unknown microarchitecture '%s'" % name)
+
+
+def last_uses(ops):
+    "Index of the last op that reads each variable"
+    result = {}
+    for index, (op, var, args) in enumerate(ops):
+        for arg in args:
+            result[arg] = index
+
+    return result
+
+
+def copies(ops, inputs, andn=False):
+    "Registers that a two operand encoding must copy first, per op: the overwritten source is still live"
+    last = last_uses(ops)
+
+    def live(var, index):
+        return var in inputs or last.get(var, -1) > index
+
+    result = []
+    for index, (op, var, args) in enumerate(ops):
+        if op == 'notand' and andn:
+            # andn writes a third register
+            candidates = []
+        elif op in ('not', 'notand'):
+            # not and pandn overwrite their (first) operand
+            candidates = args[:1]
+        else:
+            # commutative ops can overwrite any operand
+            candidates = args
+
+        if candidates and all(live(arg, index) for arg in candidates):
+            result.append(candidates[0])
+        else:
+            result.append(None)
+
+    return result
+
+
+def estimate(ops, profile, target):
+    """
+    Returns (throughput, latency) of a kernel on a core: throughput is the
+    reciprocal throughput in cycles, when many independent evaluations
+    overlap; latency the cycles from the inputs to the result.
+    """
+    domain, bits = DOMAIN[target]
+    ports   = profile.ports[(domain, bits)]
+    latency = profile.latency[domain]
+
+    if target in DESTRUCTIVE:
+        copy = copies(ops, 'ABC', target in BMI)
+    else:
+        copy = [None] * len(ops)
+
+    if domain == VECTOR:
+        move_elimination = profile.vector_move_elimination
+    else:
+        move_elimination = profile.scalar_move_elimination
+
+    slots = 0   # renamed instructions
+    uops  = 0   # uops executed by the logic ports
+    andn  = 0   # uops of them that only the andn ports execute
+    ready = {}  # var -> cycle at which it is computed
+
+    for (op, var, args), copied in zip(ops, copy):
+        slots += 1
+
+        if op == 'false':
+            # the zeroing idiom (xor r, r) is resolved by the renamer
+            ready[var] = 0
+            continue
+
+        if op == 'true':
+            # pcmpeqd x, x (mov r, -1) has no input dependency, but executes;
+            # kmovq k, r runs on another port than the mask logic
+            if domain != MASK:
+                uops += 1
+            ready[var] = 0
+            continue
+
+        start = max([0] + [ready.get(arg, 0) for arg in args])
+
+        if copied:
+            slots += 1
+            if not move_elimination:
+                uops  += 1
+                start  = max(start, ready.get(copied, 0) + 1)
+
+        if op == 'cond' and domain == VECTOR:
+            cycles, n = profile.cmov
+            uops += n
+        elif op == 'cond':
+            # the x86 assembler writes (c & t) | (~c & f)
+            cycles = 3 * latency
+            uops  += 4
+            slots += 3
+        else:
+            assert op in LOGIC, op
+            cycles = latency
+            uops  += 1
+            if op == 'notand' and target in BMI:
+                andn += 1
+
+        ready[var] = start + cycles
+
+    throughput = max(float(slots) / profile.width, float(uops) / ports, float(andn) / profile.andn)
+    result     = ready[ops[-1][1]] if ops else 0
+
+    return (throughput, result)
@@ -10,6 +10,45 @@ Target_XOP      = 30
 Target_X86_64   = 40
 Target_X86_32   = 50
 Target_AVX512   = 60
+Target_PROGRAM  = 70
+Target_DISPATCHER = 80
+Target_COST     = 90
+Target_REDUCED  = 100
+Target_UARCH    = 110
+Target_X86_64_BMI = 120
+Target_X86_32_BMI = 130
+Target_AVX512MASK = 140
+Target_SSE_PS   = 150
+Target_SSE_PD   = 160
+Target_AVX_PS   = 170
+Target_AVX_PD   = 180
+Target_VEXT     = 190
+Target_PAIRS    = 200
+
+# floating point domain targets: assembler class and the zero of the type
+FLOAT_TARGETS = {
+    Target_SSE_PS : ('AssemblerSSE_PS', '_mm_setzero_ps()'),
+    Target_SSE_PD : ('AssemblerSSE_PD', '_mm_setzero_pd()'),
+    Target_AVX_PS : ('AssemblerAVX_PS', '_mm256_setzero_ps()'),
+    Target_AVX_PD : ('AssemblerAVX_PD', '_mm256_setzero_pd()'),
+}
+
+# targets that lib.uarch models
+TARGET_NAME = {
+    Target_SSE    : 'sse',
+    Target_AVX2   : 'avx2',
+    Target_AVX512 : 'avx512',
+    Target_XOP    : 'xop',
+    Target_X86_64 : 'x86_64',
+    Target_X86_32 : 'x86_32',
+    Target_X86_64_BMI : 'x86_64_bmi',
+    Target_X86_32_BMI : 'x86_32_bmi',
+    Target_AVX512MASK : 'avx512mask',
+    Target_SSE_PS : 'sse_ps',
+    Target_SSE_PD : 'sse_pd',
+    Target_AVX_PS : 'avx_ps',
+    Target_AVX_PD : 'avx_pd',
+}
 
 
 def main():
@@ -23,7 +62,24 @@ def parse_args(args):
     parser = OptionParser()
     parser.add_option(
         "--target",
-        help="choose target (SSE, AVX2, XOP, X86_64, X86_32)"
+        help="choose target (SSE, AVX2, AVX512, XOP, X86_64, X86_32, X86_64_BMI, X86_32_BMI, AVX512MASK, SSE_PS, SSE_PD, AVX_PS, AVX_PD, VEXT, PROGRAM, DISPATCHER, COST, REDUCED, PAIRS)"
+    )
+
+    parser.add_option(
+        "--profile",
+        help="dispatcher: csv written by ternarylogic::profile::dump"
+    )
+
+    parser.add_option(
+        "--hot",
+        type="int",
+        default=8,
+        help="dispatcher: number of fast paths per backend"
+    )
+
+    parser.add_option(
+        "--uarch",
+        help="select the kernels that are fastest on a microarchitecture (see py/lib/uarch.py) instead of the shortest ones"
     )
 
     parser.add_option(
@@ -51,14 +107,40 @@ def parse_args(args):
         options.target = Target_AVX2
     elif options.target.lower() == 'avx512':
         options.target = Target_AVX512
+    elif options.target.lower() == 'avx512mask':
+        options.target = Target_AVX512MASK
     elif options.target.lower() == 'xop':
         options.target = Target_XOP
     elif options.target.lower() == 'x86_64':
         options.target = Target_X86_64
     elif options.target.lower() == 'x86_32':
         options.target = Target_X86_32
+    elif options.target.lower() == 'x86_64_bmi':
+        options.target = Target_X86_64_BMI
+    elif options.target.lower() == 'x86_32_bmi':
+        options.target = Target_X86_32_BMI
+    elif options.target.lower() == 'sse_ps':
+        options.target = Target_SSE_PS
+    elif options.target.lower() == 'sse_pd':
+        options.target = Target_SSE_PD
+    elif options.target.lower() == 'avx_ps':
+        options.target = Target_AVX_PS
+    elif options.target.lower() == 'avx_pd':
+        options.target = Target_AVX_PD
+    elif options.target.lower() == 'vext':
+        options.target = Target_VEXT
+    elif options.target.lower() == 'program':
+        options.target = Target_PROGRAM
+    elif options.target.lower() == 'dispatcher':
+        options.target = Target_DISPATCHER
+    elif options.target.lower() == 'cost':
+        options.target = Target_COST
+    elif options.target.lower() == 'reduced':
+        options.target = Target_REDUCED
+    elif options.target.lower() == 'pairs':
+        options.target = Target_PAIRS
     else:
-        valid = ('sse', 'avx2', 'xop', 'x86_64', 'x86_32', 'avx512')
+        valid = ('sse', 'avx2', 'xop', 'x86_64', 'x86_32', 'x86_64_bmi', 'x86_32_bmi', 'avx512', 'avx512mask', 'sse_ps', 'sse_pd', 'avx_ps', 'avx_pd', 'vext', 'program', 'dispatcher', 'cost', 'reduced', 'pairs')
         parser.error("--target expects: %s" % ', '.join(valid))
 
     return options
@@ -82,6 +164,14 @@ def indent_lines(lines, indent):
     return '\n'.join(tmp)
 
 
+def block(text, indent):
+    "Indented lines of text, preceded by an empty line; nothing if text is empty"
+    if not text:
+        return ''
+
+    return ''.join('\n' + (' ' * indent + line if line else '') for line in text.splitlines()) + '\n'
+
+
 def get_file(name, mode='rt'):
     dir = dirname(realpath(__file__))
 
@@ -91,6 +181,11 @@ def get_file(name, mode='rt'):
 class CodeGenerator:
     def __init__(self, options):
         self.options = options
+        self.uarch   = None
+        if getattr(options, 'uarch', None):
+            import lib.uarch
+            self.uarch = lib.uarch.get(options.uarch)
+
         self.setup()
         self.load()
 
@@ -99,11 +194,17 @@ class CodeGenerator:
         import lib.lowering_sse
         import lib.lowering_xop
         import lib.lowering_x86
+        import lib.lowering_bmi
+        import lib.lowering_avx512mask
         import lib.assembler_sse
         import lib.assembler_avx2
         import lib.assembler_avx512
+        import lib.assembler_avx512mask
+        import lib.assembler_float
+        import lib.assembler_vext
         import lib.assembler_xop
         import lib.assembler_x86
+        import lib.assembler_program
 
         if self.options.target == Target_SSE:
             self.lowering  = lib.lowering_sse.transform
@@ -117,6 +218,10 @@ class CodeGenerator:
             self.lowering = lib.lowering_sse.transform
             self.assembler_class = lib.assembler_avx512.AssemblerAVX512
 
+        elif self.options.target == Target_AVX512MASK:
+            self.lowering = lib.lowering_avx512mask.transform
+            self.assembler_class = lib.assembler_avx512mask.AssemblerAVX512Mask
+
         elif self.options.target == Target_XOP:
             self.lowering = lib.lowering_xop.transform
             self.assembler_class = lib.assembler_xop.AssemblerXOP
@@ -129,6 +234,32 @@ class CodeGenerator:
             self.lowering = lib.lowering_x86.transform
             self.assembler_class = lib.assembler_x86.AssemblerX86_32
 
+        elif self.options.target == Target_X86_64_BMI:
+            self.lowering = lib.lowering_bmi.transform
+            self.assembler_class = lib.assembler_x86.AssemblerX86_64
+
+        elif self.options.target == Target_X86_32_BMI:
+            self.lowering = lib.lowering_bmi.transform
+            self.assembler_class = lib.assembler_x86.AssemblerX86_32
+
+        elif self.options.target in FLOAT_TARGETS:
+            self.lowering = lib.lowering_sse.transform
+            self.assembler_class = getattr(lib.assembler_float, FLOAT_TARGETS[self.options.target][0])
+
+        elif self.options.target == Target_VEXT:
+            # the compiler lowers ~a & b to andn, pandn or vpternlog by itself
+            self.lowering = lib.lowering_bmi.transform
+            self.assembler_class = lib.assembler_vext.AssemblerVext
+
+        elif self.options.target == Target_PROGRAM:
+            self.lowering = lib.lowering_sse.transform
+            self.assembler_class = lib.assembler_program.AssemblerProgram
+
+        if self.options.target in (Target_X86_64, Target_X86_32, Target_X86_64_BMI, Target_X86_32_BMI):
+            self.qualifiers = '__forceinline constexpr'
+        else:
+            self.qualifiers = 'inline'
+
         with get_file(self.get_function_file()) as f:
             self.function_pattern = f.read()
 
@@ -146,17 +277,35 @@ class CodeGenerator:
             return 'cpp.avx2.main'
         elif self.options.target == Target_AVX512:
             return 'cpp.avx512.main'
+        elif self.options.target == Target_AVX512MASK:
+            return 'cpp.avx512mask.main'
         elif self.options.target == Target_XOP:
             return 'cpp.xop.main'
         elif self.options.target == Target_X86_64:
             return 'cpp.x86_64.main'
         elif self.options.target == Target_X86_32:
             return 'cpp.x86_32.main'
+        elif self.options.target == Target_X86_64_BMI:
+            return 'cpp.x86_64_bmi.main'
+        elif self.options.target == Target_X86_32_BMI:
+            return 'cpp.x86_32_bmi.main'
+        elif self.options.target in FLOAT_TARGETS:
+            return 'cpp.float.main'
+        elif self.options.target == Target_VEXT:
+            return 'cpp.vext.main'
+        elif self.options.target == Target_PROGRAM:
+            return 'cpp.program.main'
         else:
             assert False
 
 
     def get_function_file(self):
+        if self.options.target == Target_PROGRAM:
+            return 'cpp.program.function'
+
+        if self.options.target == Target_VEXT:
+            return 'cpp.vext.function'
+
         return 'cpp.function'
 
 
@@ -172,6 +321,14 @@ class CodeGenerator:
             'optimized': 'data/manually_optimized.txt',
             'automat'  : 'data/sse_and_avx2.txt',
             'xop'      : 'data/xop.txt',
+            'superopt_sse' : 'data/superopt_sse.txt',
+            'superopt_x86' : 'data/superopt_x86.txt',
+            'superopt_bmi' : 'data/superopt_bmi.txt',
+            'superopt_xop' : 'data/superopt_xop.txt',
+            'superopt_lat_sse' : 'data/superopt_lat_sse.txt',
+            'superopt_lat_x86' : 'data/superopt_lat_x86.txt',
+            'superopt_lat_bmi' : 'data/superopt_lat_bmi.txt',
+            'superopt_lat_xop' : 'data/superopt_lat_xop.txt',
         }
 
         for name, path in paths.iteritems():
@@ -179,7 +336,7 @@ class CodeGenerator:
                 self.data[name] = load(f)
 
 
-    def generate_single(self, code, expr, source):
+    def generate_single(self, code, expr, source, name=None):
 
         lowered = self.lowering(expr)
         comment = "code=0x%02x, function=%s, lowered=%s, set=%s" % (code, expr, lowered, source)
@@ -188,52 +345,503 @@ class CodeGenerator:
         g = BodyGenerator(lowered, self.assembler_class())
         body = g.run()
 
+        # unused parameters are unnamed, to avoid warnings
+        type   = self.assembler_class().type
+        params = ['const %s %s' % (type, var) if var in g.operands else 'const %s' % type for var in 'ABC']
+
         params = {
-            'TYPE'  : self.assembler_class().type,
-            'NAME'  : self.options.name,
+            'TYPE'  : type,
+            'QUALIFIERS' : self.qualifiers,
+            'PARAMS': ', '.join(params),
+            'NAME'  : name or self.options.name,
             'CODE'  : code,
             'BODY'  : indent_lines(body, self.body_indent),
             'COMMENT' : comment
         }
 
-        return (len(body), self.function_pattern % params)
+        cost = (g.instructions, g.get_depth(), g.constants, g.operands)
+
+        return (len(body), self.function_pattern % params, cost, g.ops)
+
+
+    def weight(self, size, cost, ops, latency, uarch):
+        "Selection key, the lowest wins"
+        if uarch is None:
+            return (cost[1], size) if latency else (size, cost[1])
+
+        from lib.uarch import estimate
+        throughput, cycles = estimate(ops, uarch, TARGET_NAME[self.options.target])
+        if latency:
+            return (cycles, throughput, size)
+        else:
+            return (throughput, cycles, size)
+
+
+    def select(self, code, latency=False, uarch=None):
+        """
+        The cheapest function of all sets: the shortest (with latency the shallowest)
+        or the fastest on uarch (by default the one of --uarch). Returns its source,
+        cost and weight.
+        """
+        uarch  = uarch or self.uarch
+        weight = (1e10,) # It is rather unlikely that a 3-argument function would be expressed
+                         # by more than one million instructions. :)
+        src    = None
+        cost   = None
+
+        for name in self.data:
+            if code not in self.data[name]:
+                continue
+
+            expr = self.data[name][code][1]
+            if expr:
+                fname = self.options.name + '_lat' if latency else None
+                size, s, c, ops = self.generate_single(code, expr, name, fname)
+                w = self.weight(size, c, ops, latency, uarch)
+                if w < weight:
+                    src    = s
+                    cost   = c
+                    weight = w
+                    kernel = (size, c, ops)
+
+        assert src is not None
+        return (src, cost, kernel)
+
+
+    def costs(self):
+        return [self.select(code)[1] for code in xrange(256)]
+
+
+    def is_faster(self, kernel, than, latency, uarch):
+        return self.weight(*(kernel + (latency, uarch))) < self.weight(*(than + (latency, uarch)))
 
 
     def generate(self):
-        result = ''
+        result  = ''
+        latency = ''
+        kernels = []    # (kernel, latency kernel) of every function
         for code in xrange(256):
-            weight = 1e10 # It is rather unlikely that a 3-argument function would be expressed
-                          # by more than one million instructions. :)
-            src    = None
-
-            for name in self.data:
-                if code not in self.data[name]:
-                    continue
-
-                expr = self.data[name][code][1]
-                if expr:
-                    w, s = self.generate_single(code, expr, name)
-                    if w < weight:
-                        src    = s
-                        weight = w
-                        picked_set = name
-
-            assert src is not None
+            src, cost, kernel = self.select(code)
             result += src
 
+            # only the functions that have a shallower kernel get a latency variant
+            kernel_lat = kernel
+            if self.options.target != Target_PROGRAM:
+                src_lat, cost_lat, candidate = self.select(code, latency=True)
+                if self.is_faster(candidate, kernel, True, self.uarch):
+                    latency   += src_lat
+                    kernel_lat = candidate
+
+            kernels.append((kernel, kernel_lat))
+
         params = {
             'TYPE'      : self.assembler_class().type,
-            'FUNCTIONS' : indent_lines(result.splitlines(), self.global_indent)
+            'NAMESPACE' : TARGET_NAME.get(self.options.target),
+            'ZERO'      : FLOAT_TARGETS.get(self.options.target, (None, None))[1],
+            'FUNCTIONS' : indent_lines(result.splitlines(), self.global_indent),
+            'LATENCY'   : block(latency, self.global_indent),
+            'UARCH'     : block(self.generate_uarch(kernels), self.global_indent) if self.options.target in TARGET_NAME else '',
         }
 
         return self.main_pattern % params
 
 
+    def generate_uarch(self, kernels):
+        "Per microarchitecture the kernels that are faster there than the ones of kernels"
+        import lib.uarch
+
+        with get_file('cpp.uarch.main') as f:
+            main_pattern = f.read()
+
+        with get_file('cpp.uarch.namespace') as f:
+            namespace_pattern = f.read()
+
+        params = {
+            'ISA'        : TARGET_NAME[self.options.target],
+            'TYPE'       : self.assembler_class().type,
+            'QUALIFIERS' : self.qualifiers,
+        }
+
+        namespaces = ''
+        for index, uarch in enumerate(lib.uarch.PROFILES, 1):
+            if TARGET_NAME[self.options.target] not in uarch.targets:
+                continue
+
+            functions = ''
+            latency   = ''
+            for code in xrange(256):
+                kernel, kernel_lat = kernels[code]
+
+                src, cost, candidate = self.select(code, uarch=uarch)
+                if self.is_faster(candidate, kernel, False, uarch):
+                    functions += src
+
+                src, cost, candidate = self.select(code, latency=True, uarch=uarch)
+                if self.is_faster(candidate, kernel_lat, True, uarch):
+                    latency += src
+
+            if not functions and not latency:
+                continue
+
+            params.update({
+                'UARCH'       : uarch.name,
+                'DESCRIPTION' : uarch.description,
+                'INDEX'       : index,
+                'FUNCTIONS'   : block(functions, 4),
+                'LATENCY'     : block(latency, 4),
+            })
+            namespaces += namespace_pattern % params
+
+        params['NAMESPACES'] = namespaces
+        return (main_pattern % params).rstrip('\n')
+
+
+    run = generate
+
+
+class DispatcherGenerator:
+    def __init__(self, options):
+        self.options = options
+
+        with get_file('cpp.dispatch.function') as f:
+            self.function_pattern = f.read()
+
+        with get_file('cpp.dispatch.main') as f:
+            self.main_pattern = f.read()
+
+        self.profile = {}
+        if self.options.profile:
+            from lib.dispatcher import load_profile
+            with open(self.options.profile, 'rt') as f:
+                self.profile = load_profile(f)
+
+
+    def fast_paths(self, codes, indent):
+        # each fast path is followed by the indent of the next line, thus no fast paths leave no blank line
+        return ''.join('if (k == 0x%02x) return ternary_intern<0x%02x>(a, b, c);\n%s' % (code, code, ' ' * indent) for code in codes)
+
+
+    def generate(self):
+        from lib.dispatcher import ISA_TYPE, hottest
+
+        # the generic dispatcher gets the codes that are hot over all backends
+        total = {}
+        for isa in self.profile:
+            for code, calls in self.profile[isa].iteritems():
+                total[code] = total.get(code, 0) + calls
+
+        generic = self.fast_paths(hottest(total, self.options.hot), get_indent(self.main_pattern, '%(GENERIC)s'))
+
+        # backends of the same type (x86_64 with and without BMI1) share the specialization
+        types = {}
+        for isa in sorted(self.profile):
+            if isa not in ISA_TYPE:
+                continue
+
+            names, calls = types.setdefault(ISA_TYPE[isa], ([], {}))
+            names.append(isa)
+            for code, n in self.profile[isa].iteritems():
+                calls[code] = calls.get(code, 0) + n
+
+        body_indent = get_indent(self.function_pattern, '%(BODY)s')
+        functions = []
+        for type, (names, calls) in sorted(types.items(), key=lambda item: item[1][0]):
+            codes = hottest(calls, self.options.hot)
+            if not codes:
+                continue
+
+            params = {
+                'TYPE' : type,
+                'ISA'  : ', '.join(names),
+                'BODY' : self.fast_paths(codes, body_indent),
+            }
+            functions.append(self.function_pattern % params)
+
+        # the specializations follow the generic dispatcher, at its indent
+        indent = ' ' * get_indent(self.main_pattern, 'template<typename T>')
+        params = {
+            'SOURCE'    : self.options.profile or 'none',
+            'GENERIC'   : generic,
+            'FUNCTIONS' : ''.join('\n' + ''.join(indent + line + '\n' for line in f.splitlines()) for f in functions),
+        }
+
+        return self.main_pattern % params
+
+
+    run = generate
+
+
+class CostGenerator:
+    "Cost tables of the kernels that CodeGenerator picks for every target"
+
+    TARGETS = (
+        ('x86_32',  Target_X86_32,  'ternary_x86_32.cpp'),
+        ('x86_64',  Target_X86_64,  'ternary_x86_64.cpp'),
+        ('x86_32_bmi', Target_X86_32_BMI, 'ternary_x86_32_bmi.cpp'),
+        ('x86_64_bmi', Target_X86_64_BMI, 'ternary_x86_64_bmi.cpp'),
+        ('sse',     Target_SSE,     'ternary_sse.cpp'),
+        ('avx2',    Target_AVX2,    'ternary_avx2.cpp'),
+        ('avx512',  Target_AVX512,  'ternary_avx512.cpp'),
+        ('avx512mask', Target_AVX512MASK, 'ternary_avx512mask.cpp'),
+        ('sse_ps',  Target_SSE_PS,  'ternary_sse_ps.cpp'),
+        ('sse_pd',  Target_SSE_PD,  'ternary_sse_pd.cpp'),
+        ('avx_ps',  Target_AVX_PS,  'ternary_avx_ps.cpp'),
+        ('avx_pd',  Target_AVX_PD,  'ternary_avx_pd.cpp'),
+        ('xop',     Target_XOP,     'ternary_xop.cpp'),
+    )
+
+    def __init__(self, options):
+        self.options = options
+
+        with get_file('cpp.cost.main') as f:
+            self.main_pattern = f.read()
+
+        with get_file('cpp.cost.table') as f:
+            self.table_pattern = f.read()
+
+
+    def operands_mask(self, operands):
+        return (1 if 'A' in operands else 0) | (2 if 'B' in operands else 0) | (4 if 'C' in operands else 0)
+
+
+    def support_mask(self, code):
+        "Inputs that function code depends on; vpternlog reads all three, but a planner cares about these"
+        a = ((code >> 4) & 0x0f) != (code & 0x0f)
+        b = ((code >> 2) & 0x33) != (code & 0x33)
+        c = ((code >> 1) & 0x55) != (code & 0x55)
+
+        return (1 if a else 0) | (2 if b else 0) | (4 if c else 0)
+
+
+    def table(self, name, filename, costs):
+        rows = []
+        for code, (instructions, depth, constants, operands) in enumerate(costs):
+            rows.append('{ %d, %d, %d, %d }, // 0x%02x' % (instructions, depth, constants, operands, code))
+
+        indent = get_indent(self.table_pattern, '%(ROWS)s')
+        params = {
+            'NAME' : name,
+            'FILE' : filename,
+            'ROWS' : indent_lines(rows, indent),
+        }
+
+        return self.table_pattern % params
+
+
+    def generate(self):
+        import copy
+
+        tables = []
+        for name, target, filename in self.TARGETS:
+            options = copy.copy(self.options)
+            options.target = target
+
+            costs = [(i, d, c, self.operands_mask(o)) for (i, d, c, o) in CodeGenerator(options).costs()]
+            tables.append(self.table(name, filename, costs))
+
+        raw = [(1, 1, 0, self.support_mask(code)) for code in xrange(256)]
+        tables.append(self.table('avx512raw', 'vpternlogd', raw))
+
+        params = {
+            'TABLES' : indent_lines(''.join(tables).rstrip().splitlines(), get_indent(self.main_pattern, '%(TABLES)s')),
+        }
+
+        # indent_lines indents the empty lines between the tables too
+        return '\n'.join(line.rstrip() for line in (self.main_pattern % params).splitlines()) + '\n'
+
+
     run = generate
 
+
+class ReducedGenerator:
+    "Runtime dispatchers that call, per function, the cheapest kernel of all operand orders"
+
+    # the primary template serves x86_64 and bitset, which share the kernels;
+    # the BMI1 kernels of uint64_t and uint32_t exist only with TERNARYLOGIC_BMI,
+    # the specialisations of the wider vectors only where the target has them
+    TARGETS = (
+        ('x86_64',     Target_X86_64,     None,       'ternary_x86_64.cpp',     None),
+        ('x86_64_bmi', Target_X86_64_BMI, 'uint64_t', 'ternary_x86_64_bmi.cpp', '#ifdef TERNARYLOGIC_BMI'),
+        ('x86_32',     Target_X86_32,     'uint32_t', 'ternary_x86_32.cpp',     '#ifndef TERNARYLOGIC_BMI'),
+        ('x86_32_bmi', Target_X86_32_BMI, 'uint32_t', 'ternary_x86_32_bmi.cpp', '#ifdef TERNARYLOGIC_BMI'),
+        ('sse',        Target_SSE,        '__m128i',  'ternary_sse.cpp',        None),
+        ('avx2',       Target_AVX2,       '__m256i',  'ternary_avx2.cpp',       '#ifdef __AVX2__'),
+        ('avx512raw',  None,              '__m512i',  'vpternlogd',             '#ifdef __AVX512F__'),
+    )
+
+    def __init__(self, options):
+        self.options = options
+
+        with get_file('cpp.reduced.main') as f:
+            self.main_pattern = f.read()
+
+        with get_file('cpp.reduced.function') as f:
+            self.function_pattern = f.read()
+
+
+    def get_costs(self, target):
+        if target is None:
+            return [(1, 1, 0, None)] * 256
+
+        import copy
+        options = copy.copy(self.options)
+        options.target = target
+
+        return CodeGenerator(options).costs()
+
+
+    def reduce(self, costs):
+        "Per function (kernel, order) of the cheapest kernel; ties go to the lowest kernel to keep few kernels alive"
+        from lib.permute import ORDERS, permute
+
+        result = []
+        for code in xrange(256):
+            best = None
+            for index, order in enumerate(ORDERS):
+                k = permute(code, order)
+                instructions, depth, constants, _ = costs[k]
+                key = (instructions + constants, depth, k, index)
+                if best is None or key < best:
+                    best = key
+
+            result.append((best[2], ORDERS[best[3]]))
+
+        return result
+
+
+    def function(self, isa, type, filename, guard, reduction):
+        table = []
+        cases = []
+        for code, (k, order) in enumerate(reduction):
+            table.append('{ 0x%02x, order::%s }, // 0x%02x' % (k, order, code))
+            cases.append('case 0x%02x: return priv::ternary_intern<0x%02x>(%s, %s, %s);' % (code, k, order[0], order[1], order[2]))
+
+        params = {
+            'ISA'            : isa,
+            'FILE'           : filename,
+            'TYPE'           : type or 'T',
+            'TEMPLATE'       : 'template<>' if type else 'template<typename T>',
+            'SPECIALIZATION' : '<%s>' % type if type else '',
+            'TABLE'          : indent_lines(table, get_indent(self.function_pattern, '%(TABLE)s')),
+            'CASES'          : indent_lines(cases, get_indent(self.function_pattern, '%(CASES)s')),
+        }
+
+        if guard:
+            return '%s\n%s#endif\n' % (guard, self.function_pattern % params)
+
+        return self.function_pattern % params
+
+
+    def generate(self):
+        functions = []
+        for isa, target, type, filename, guard in self.TARGETS:
+            reduction = self.reduce(self.get_costs(target))
+            functions.append(self.function(isa, type, filename, guard, reduction))
+
+        indent = get_indent(self.main_pattern, '%(FUNCTIONS)s')
+        params = {
+            'FUNCTIONS' : indent_lines('\n'.join(functions).splitlines(), indent),
+        }
+
+        # preprocessor lines start at the first column
+        lines = [line.rstrip() for line in (self.main_pattern % params).splitlines()]
+        return '\n'.join(line.lstrip() if line.lstrip().startswith('#') else line for line in lines) + '\n'
+
+
+    run = generate
+
+
+class PairsGenerator:
+    "Kernels of the pairs of functions that take fewer instructions together, found by superopt --pairs"
+
+    TARGETS = (
+        ('sse', 'lowering_sse', 'data/pairs_sse.txt', 'SSE, AVX2 and AVX512 without vpternlog'),
+        ('x86', 'lowering_x86', 'data/pairs_x86.txt', 'x86 general purpose registers'),
+        ('bmi', 'lowering_bmi', 'data/pairs_bmi.txt', 'x86 general purpose registers with BMI1 andn'),
+        ('xop', 'lowering_xop', 'data/pairs_xop.txt', 'SSE with XOP vpcmov'),
+    )
+
+    def __init__(self, options):
+        self.options = options
+
+        with get_file('cpp.pairs.main') as f:
+            self.main_pattern = f.read()
+
+        with get_file('cpp.pairs.table') as f:
+            self.table_pattern = f.read()
+
+
+    def kernel(self, codes, exprs, lowering):
+        from lib.bodygen import BodyGenerator
+        from lib.assembler_pairs import AssemblerPairs
+
+        g = BodyGenerator([lowering(expr) for expr in exprs], AssemblerPairs())
+        body = g.run()
+
+        # the return lists the registers of both results
+        code = body[:-1]
+        return (codes, body[-1], code)
+
+
+    def table(self, name, path, description, lowering):
+        from lib.load import load_pairs
+
+        with get_file(path, 'rt') as f:
+            data = load_pairs(f)
+
+        rows = []
+        size = 0
+        for codes in sorted(data):
+            codes, results, code = self.kernel(codes, data[codes][1], lowering)
+            size = max(size, len(code))
+            rows.append('{ 0x%02x, 0x%02x, %s, %d, { %s } },' % (codes[0], codes[1], results, len(code), ' '.join(code).rstrip(',')))
+
+        indent = get_indent(self.table_pattern, '%(ROWS)s')
+        params = {
+            'NAME'        : name,
+            'DESCRIPTION' : description,
+            'COUNT'       : len(rows),
+            'ROWS'        : indent_lines(rows, indent),
+        }
+
+        return (self.table_pattern % params, size)
+
+
+    def generate(self):
+        import importlib
+
+        tables = []
+        size   = 0
+        for name, lowering, path, description in self.TARGETS:
+            lowering = importlib.import_module('lib.' + lowering).transform
+            table, n = self.table(name, path, description, lowering)
+            tables.append(table)
+            size = max(size, n)
+
+        params = {
+            'MAX'    : size,
+            'TABLES' : indent_lines('\n'.join(tables).rstrip().splitlines(), get_indent(self.main_pattern, '%(TABLES)s')),
+        }
+
+        # indent_lines indents the empty lines between the tables too
+        return '\n'.join(line.rstrip() for line in (self.main_pattern % params).splitlines()) + '\n'
+
+
+    run = generate
+
+
 def execute(options):
 
-    gen = CodeGenerator(options)
+    if options.target == Target_DISPATCHER:
+        gen = DispatcherGenerator(options)
+    elif options.target == Target_COST:
+        gen = CostGenerator(options)
+    elif options.target == Target_REDUCED:
+        gen = ReducedGenerator(options)
+    elif options.target == Target_PAIRS:
+        gen = PairsGenerator(options)
+    else:
+        gen = CodeGenerator(options)
     res = gen.run()
     with open(options.filename, 'wt') as f:
         f.write(res)
@@ -264,18 +264,18 @@ namespace ternarylogic::swap
 		void inline test_shuffle_variables() {
 			std::cout << "shuffle_vars::test_shuffle_variables" << std::endl;
 
-			constexpr unsigned long long a = 0b10101010;
-			constexpr unsigned long long b = 0b11001100;
-			constexpr unsigned long long c = 0b11110000;
+			constexpr uint64_t a = 0b10101010;
+			constexpr uint64_t b = 0b11001100;
+			constexpr uint64_t c = 0b11110000;
 
 			for (int i = 0; i <= 0xFF; ++i)
 			{
-				const unsigned long long r1 = ternarylogic::ternary(a, b, c, shuffle_vars_abc(i));
-				const unsigned long long r2 = ternary(b, a, c, shuffle_vars_bac(i));
-				const unsigned long long r3 = ternary(a, c, b, shuffle_vars_acb(i));
-				const unsigned long long r4 = ternary(c, b, a, shuffle_vars_cba(i));
-				const unsigned long long r5 = ternary(c, a, b, shuffle_vars_cab(i));
-				const unsigned long long r6 = ternary(b, c, a, shuffle_vars_bca(i));
+				const uint64_t r1 = ternarylogic::ternary(a, b, c, shuffle_vars_abc(i));
+				const uint64_t r2 = ternary(b, a, c, shuffle_vars_bac(i));
+				const uint64_t r3 = ternary(a, c, b, shuffle_vars_acb(i));
+				const uint64_t r4 = ternary(c, b, a, shuffle_vars_cba(i));
+				const uint64_t r5 = ternary(c, a, b, shuffle_vars_cab(i));
+				const uint64_t r6 = ternary(b, c, a, shuffle_vars_bca(i));
 
 				if (r1 != r2) {
 					std::cout << "ERROR: test_shuffle_variables: r1=" << std::bitset<8>(r1).to_string() << "; r2=" << std::bitset<8>(r2).to_string() << std::endl;
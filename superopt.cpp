@@ -0,0 +1,623 @@
+// Superoptimizer: the shortest program of every ternary function, per instruction set.
+//
+// The search is breadth first over the sets of computed values: the values a program
+// has computed determine everything it can compute next, thus programs that compute the
+// same set of values are merged. The first level at which a function shows up is the
+// minimal number of instructions, DAG sharing and constant reuse included.
+//
+// With --latency the programs have the minimal depth (longest chain of dependent
+// instructions; constants are loop invariant and have depth 0), and among those the
+// minimal number of instructions.
+//
+// With --pairs the search records the first level at which a set holds two functions: the
+// shortest program that computes both, which shares the common subexpressions. It writes the
+// pairs that take fewer instructions together than apart (py/data/pairs_*.txt), of those whose
+// joint program fits the search limit (max_length, or the one given): a pair that needs a longer
+// program is not found, even where that is still fewer than apart.
+//
+// usage: superopt [--latency | --pairs] target output_file [max_length]    with target sse, x86, bmi or xop
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+namespace ternarylogic::superopt
+{
+	enum class op : uint8_t { zeros, ones, bit_not, bit_and, bit_or, bit_xor, bit_andnot, cmov };
+
+	/// <summary>
+	/// Instruction set: the operations it has in one instruction, each of cost one
+	/// </summary>
+	struct target
+	{
+		const char* name;
+		const char* description;
+		std::vector<op> ops;
+	};
+
+	inline const std::vector<target>& targets()
+	{
+		static const std::vector<target> t = {
+			// not x is x xor ones, andnot is _mm_andnot_si128
+			{ "sse", "SSE, AVX2 and AVX512 without vpternlog", { op::zeros, op::ones, op::bit_and, op::bit_or, op::bit_xor, op::bit_andnot } },
+			{ "x86", "x86 general purpose registers", { op::zeros, op::ones, op::bit_not, op::bit_and, op::bit_or, op::bit_xor } },
+			{ "bmi", "x86 general purpose registers with BMI1 andn", { op::zeros, op::ones, op::bit_not, op::bit_and, op::bit_or, op::bit_xor, op::bit_andnot } },
+			{ "xop", "SSE with XOP vpcmov", { op::zeros, op::ones, op::bit_and, op::bit_or, op::bit_xor, op::bit_andnot, op::cmov } },
+		};
+		return t;
+	}
+
+	/// <summary>
+	/// Operands index the values: 0 = A, 1 = B, 2 = C, 3 and up = results of the earlier instructions
+	/// </summary>
+	struct instruction
+	{
+		op code;
+		uint8_t a;
+		uint8_t b;
+		uint8_t c;
+	};
+
+	enum class objective { size, latency, pairs };
+
+	constexpr int n_inputs = 3;
+	constexpr int max_length = 8;
+	constexpr uint8_t input_values[n_inputs] = { 0xF0, 0xCC, 0xAA };
+
+	/// <summary>
+	/// Index of the unordered pair of functions k1 and k2
+	/// </summary>
+	[[nodiscard]] constexpr size_t pair_index(const uint8_t k1, const uint8_t k2) noexcept
+	{
+		return (k1 < k2) ? ((k1 << 8) | k2) : ((k2 << 8) | k1);
+	}
+
+	[[nodiscard]] constexpr int arity(const op code) noexcept
+	{
+		switch (code)
+		{
+			case op::zeros: case op::ones: return 0;
+			case op::bit_not: return 1;
+			case op::cmov: return 3;
+			default: return 2;
+		}
+	}
+
+	[[nodiscard]] constexpr bool commutative(const op code) noexcept
+	{
+		return (code == op::bit_and) || (code == op::bit_or) || (code == op::bit_xor);
+	}
+
+	// cmov is vpcmov: x ? y : z with the selector last, thus (y and x) or (z andnot x)
+	[[nodiscard]] constexpr uint8_t apply(const op code, const uint8_t x, const uint8_t y, const uint8_t z) noexcept
+	{
+		switch (code)
+		{
+			case op::zeros: return 0x00;
+			case op::ones: return 0xFF;
+			case op::bit_not: return static_cast<uint8_t>(~x);
+			case op::bit_and: return x & y;
+			case op::bit_or: return x | y;
+			case op::bit_xor: return x ^ y;
+			case op::bit_andnot: return static_cast<uint8_t>(~x & y);
+			case op::cmov: return static_cast<uint8_t>((x & z) | (y & ~z));
+			default: return 0;
+		}
+	}
+
+	namespace priv
+	{
+		// a set of computed values, sorted, with the program that computed it
+		struct node
+		{
+			uint64_t values;		// sorted values, one per byte, at most max_length
+			uint32_t depths;		// depth of every value, 4 bits each; zero when the objective is size
+			uint32_t parent;		// index of the parent in the previous level
+			instruction ins;		// instruction that computed the newest value, operands are values not indices
+			uint8_t size;
+		};
+
+		struct solution
+		{
+			int length = -1;
+			int depth = 0;
+			uint32_t parent = 0;	// node in level length - 1
+			instruction ins{};		// operands are values
+		};
+
+		[[nodiscard]] inline uint8_t value(const node& n, const int i) noexcept
+		{
+			return static_cast<uint8_t>(n.values >> (8 * i));
+		}
+
+		[[nodiscard]] inline int depth(const node& n, const int i) noexcept
+		{
+			return static_cast<int>((n.depths >> (4 * i)) & 0xF);
+		}
+
+		// depth of an operand value: inputs have depth 0
+		[[nodiscard]] inline int depth_of(const node& n, const uint8_t v) noexcept
+		{
+			for (int i = 0; i < n.size; ++i) {
+				if (value(n, i) == v) return depth(n, i);
+			}
+			return 0;
+		}
+
+		[[nodiscard]] inline bool contains(const node& n, const uint8_t v) noexcept
+		{
+			for (int i = 0; i < n.size; ++i) {
+				if (value(n, i) == v) return true;
+			}
+			for (int i = 0; i < n_inputs; ++i) {
+				if (input_values[i] == v) return true;
+			}
+			return false;
+		}
+
+		inline void insert(const node& n, const uint8_t v, const int d, uint64_t& values, uint32_t& depths) noexcept
+		{
+			uint16_t tmp[max_length];	// value in the high byte, thus sorted by value
+			int size = 0;
+			for (int i = 0; i < n.size; ++i) tmp[size++] = static_cast<uint16_t>((value(n, i) << 8) | depth(n, i));
+			tmp[size++] = static_cast<uint16_t>((v << 8) | d);
+			std::sort(tmp, tmp + size);
+			values = 0;
+			depths = 0;
+			for (int i = 0; i < size; ++i) {
+				values |= static_cast<uint64_t>(tmp[i] >> 8) << (8 * i);
+				depths |= static_cast<uint32_t>(tmp[i] & 0xF) << (4 * i);
+			}
+		}
+
+		struct key_hash
+		{
+			size_t operator()(const std::pair<uint64_t, uint32_t>& k) const noexcept
+			{
+				return std::hash<uint64_t>()(k.first ^ (static_cast<uint64_t>(k.second) * 0x9E3779B97F4A7C15ull));
+			}
+		};
+
+		using key_set = std::unordered_set<std::pair<uint64_t, uint32_t>, key_hash>;
+
+		/// <summary>
+		/// Call f(instruction, result) for every instruction of the target over the values of n
+		/// </summary>
+		template<typename F>
+		void expand(const target& t, const node& n, F f)
+		{
+			uint8_t operand[n_inputs + max_length];
+			int n_operands = 0;
+			for (int i = 0; i < n_inputs; ++i) operand[n_operands++] = input_values[i];
+			for (int i = 0; i < n.size; ++i) operand[n_operands++] = value(n, i);
+
+			for (const op code : t.ops)
+			{
+				switch (arity(code))
+				{
+					case 0:
+						f(instruction{ code, 0, 0, 0 }, apply(code, 0, 0, 0));
+						break;
+					case 1:
+						for (int x = 0; x < n_operands; ++x) {
+							f(instruction{ code, operand[x], 0, 0 }, apply(code, operand[x], 0, 0));
+						}
+						break;
+					case 2:
+						for (int x = 0; x < n_operands; ++x) {
+							for (int y = commutative(code) ? x + 1 : 0; y < n_operands; ++y) {
+								if (x == y) continue;
+								f(instruction{ code, operand[x], operand[y], 0 }, apply(code, operand[x], operand[y], 0));
+							}
+						}
+						break;
+					case 3:
+						for (int x = 0; x < n_operands; ++x) {
+							for (int y = 0; y < n_operands; ++y) {
+								for (int z = 0; z < n_operands; ++z) {
+									if ((x == y) || (x == z) || (y == z)) continue;
+									f(instruction{ code, operand[x], operand[y], operand[z] }, apply(code, operand[x], operand[y], operand[z]));
+								}
+							}
+						}
+						break;
+				}
+			}
+		}
+	}
+
+	/// <summary>
+	/// Minimal depth of every function, computed level by level over single values
+	/// </summary>
+	[[nodiscard]] inline std::array<int, 256> min_depths(const target& t)
+	{
+		std::array<int, 256> result;
+		result.fill(-1);
+		for (const uint8_t v : input_values) result[v] = 0;
+		for (const op code : t.ops) {
+			if (arity(code) == 0) result[apply(code, 0, 0, 0)] = 0;
+		}
+		for (int d = 1; std::count(result.begin(), result.end(), -1) > 0; ++d)
+		{
+			std::vector<uint8_t> known;
+			for (int v = 0; v < 256; ++v) {
+				if (result[v] >= 0) known.push_back(static_cast<uint8_t>(v));
+			}
+			for (const op code : t.ops) {
+				for (const uint8_t x : known) {
+					for (const uint8_t y : known) {
+						for (const uint8_t z : known) {
+							const uint8_t v = apply(code, x, y, z);
+							if (result[v] < 0) result[v] = d;
+						}
+					}
+				}
+			}
+		}
+		return result;
+	}
+
+	/// <summary>
+	/// The shortest (or shallowest) programs of all 256 functions: per function the instructions, in order, with values as operands
+	/// </summary>
+	class search
+	{
+	public:
+		explicit search(const target& t, const objective goal = objective::size, const int limit = max_length, const unsigned n_threads = std::max(1u, std::thread::hardware_concurrency()))
+			: t_(t), goal_(goal), limit_(std::min(limit, max_length)), n_threads_(n_threads), min_depth_(min_depths(t)), pairs_(256 * 256)
+		{}
+
+		void run()
+		{
+			levels_.clear();
+			levels_.push_back({ priv::node{ 0, 0, 0, instruction{}, 0 } });
+
+			for (int i = 0; i < n_inputs; ++i) {
+				solutions_[input_values[i]].length = 0;
+			}
+			// values deeper than the deepest function are of no use
+			const int max_depth = *std::max_element(min_depth_.begin(), min_depth_.end());
+
+			// pairs need longer programs than the single functions, up to the limit
+			for (int length = 1; length <= limit_ && ((goal_ == objective::pairs) || !done()); ++length)
+			{
+				const std::vector<priv::node>& previous = levels_.back();
+				const bool last = (length == limit_);
+
+				// every thread expands a slice of the previous level
+				std::vector<std::vector<priv::node>> next(n_threads_);
+				std::vector<std::vector<std::pair<uint8_t, priv::solution>>> found(n_threads_);
+				std::vector<std::vector<std::pair<uint16_t, priv::solution>>> found_pairs(n_threads_);
+				std::atomic<size_t> cursor{ 0 };
+				auto work = [&](const unsigned id)
+				{
+					priv::key_set seen;
+					std::vector<bool> pair_seen((goal_ == objective::pairs) ? pairs_.size() : 0);
+					constexpr size_t chunk = 1024;
+					for (size_t begin = cursor.fetch_add(chunk); begin < previous.size(); begin = cursor.fetch_add(chunk))
+					{
+						const size_t end = std::min(previous.size(), begin + chunk);
+						for (size_t p = begin; p < end; ++p)
+						{
+							const priv::node& n = previous[p];
+							priv::expand(t_, n, [&](const instruction& ins, const uint8_t v)
+							{
+								if (priv::contains(n, v)) return;
+								int d = 0;
+								if (arity(ins.code) > 0) {
+									d = 1 + std::max({ priv::depth_of(n, ins.a), (arity(ins.code) > 1) ? priv::depth_of(n, ins.b) : 0, (arity(ins.code) > 2) ? priv::depth_of(n, ins.c) : 0 });
+								}
+								const bool shallow = (goal_ != objective::latency) || (d == min_depth_[v]);
+								if ((solutions_[v].length < 0) && shallow) {
+									found[id].push_back({ v, priv::solution{ length, d, static_cast<uint32_t>(p), ins } });
+								}
+								if (goal_ == objective::pairs) {
+									// the pairs of v with the values of n are new at this level, the others are not
+									auto pair = [&](const uint8_t w)
+									{
+										const size_t i = pair_index(v, w);
+										if ((pairs_[i].length < 0) && !pair_seen[i]) {
+											pair_seen[i] = true;
+											found_pairs[id].push_back({ static_cast<uint16_t>(i), priv::solution{ length, 0, static_cast<uint32_t>(p), ins } });
+										}
+									};
+									for (const uint8_t w : input_values) pair(w);
+									for (int i = 0; i < n.size; ++i) pair(priv::value(n, i));
+								}
+								if (goal_ != objective::latency) {
+									d = 0;
+								}
+								else if (d >= max_depth) {
+									return;
+								}
+								if (!last && (n.size + 1 < max_length)) {
+									priv::node child{ 0, 0, static_cast<uint32_t>(p), ins, static_cast<uint8_t>(n.size + 1) };
+									priv::insert(n, v, d, child.values, child.depths);
+									if (seen.insert({ child.values, child.depths }).second) {
+										next[id].push_back(child);
+									}
+								}
+							});
+						}
+					}
+				};
+
+				std::vector<std::thread> threads;
+				for (unsigned id = 1; id < n_threads_; ++id) threads.emplace_back(work, id);
+				work(0);
+				for (std::thread& th : threads) th.join();
+
+				for (const auto& f : found) {
+					for (const auto& [v, s] : f) {
+						if (solutions_[v].length < 0) solutions_[v] = s;
+					}
+				}
+				for (const auto& f : found_pairs) {
+					for (const auto& [i, s] : f) {
+						if (pairs_[i].length < 0) pairs_[i] = s;
+					}
+				}
+
+				// merge the slices, dropping the sets that another thread reached too
+				std::vector<priv::node> level;
+				priv::key_set seen;
+				for (const auto& slice : next) {
+					for (const priv::node& n : slice) {
+						if (seen.insert({ n.values, n.depths }).second) level.push_back(n);
+					}
+				}
+				std::cerr << t_.name << ": length " << length << ", " << level.size() << " sets, " << n_solved() << " functions solved" << std::endl;
+				levels_.push_back(std::move(level));
+			}
+		}
+
+		[[nodiscard]] bool done() const noexcept { return n_solved() == 256; }
+
+		[[nodiscard]] int n_solved() const noexcept
+		{
+			int n = 0;
+			for (const priv::solution& s : solutions_) n += (s.length >= 0) ? 1 : 0;
+			return n;
+		}
+
+		[[nodiscard]] int length(const uint8_t k) const noexcept { return solutions_[k].length; }
+
+		[[nodiscard]] int depth(const uint8_t k) const noexcept { return solutions_[k].depth; }
+
+		/// <summary>
+		/// The longest program searched
+		/// </summary>
+		[[nodiscard]] int limit() const noexcept { return limit_; }
+
+		/// <summary>
+		/// Instructions of the shortest program that computes both k1 and k2, -1 if it is longer than the limit
+		/// </summary>
+		[[nodiscard]] int length(const uint8_t k1, const uint8_t k2) const noexcept { return pairs_[pair_index(k1, k2)].length; }
+
+		/// <summary>
+		/// The program of function k, in execution order
+		/// </summary>
+		[[nodiscard]] std::vector<instruction> program(const uint8_t k) const
+		{
+			return program(solutions_[k]);
+		}
+
+		/// <summary>
+		/// The program of the pair of functions k1 and k2, in execution order
+		/// </summary>
+		[[nodiscard]] std::vector<instruction> program(const uint8_t k1, const uint8_t k2) const
+		{
+			return program(pairs_[pair_index(k1, k2)]);
+		}
+
+	private:
+		[[nodiscard]] std::vector<instruction> program(const priv::solution& s) const
+		{
+			std::vector<instruction> result;
+			if (s.length <= 0) return result;
+
+			result.push_back(s.ins);
+			uint32_t p = s.parent;
+			for (int level = s.length - 1; level > 0; --level) {
+				const priv::node& n = levels_[level][p];
+				result.push_back(n.ins);
+				p = n.parent;
+			}
+			std::reverse(result.begin(), result.end());
+			return result;
+		}
+
+		const target& t_;
+		const objective goal_;
+		const int limit_;
+		const unsigned n_threads_;
+		const std::array<int, 256> min_depth_;
+		std::vector<std::vector<priv::node>> levels_;
+		priv::solution solutions_[256];
+		std::vector<priv::solution> pairs_;	// by pair_index
+	};
+
+	/// <summary>
+	/// The program as expression in the syntax of py/data/*.txt; shared subexpressions are repeated,
+	/// the generator emits them once
+	/// </summary>
+	[[nodiscard]] inline std::string expression(const std::vector<instruction>& code, const uint8_t v)
+	{
+		for (int i = 0; i < n_inputs; ++i) {
+			if (input_values[i] == v) return std::string(1, static_cast<char>('A' + i));
+		}
+		for (const instruction& ins : code)
+		{
+			if (apply(ins.code, ins.a, ins.b, ins.c) != v) continue;
+			switch (ins.code)
+			{
+				case op::zeros: return "0";
+				case op::ones: return "1";
+				case op::bit_not: return "!" + expression(code, ins.a);
+				case op::bit_and: return "and" + expression(code, ins.a) + expression(code, ins.b);
+				case op::bit_or: return "or" + expression(code, ins.a) + expression(code, ins.b);
+				case op::bit_xor: return "xor" + expression(code, ins.a) + expression(code, ins.b);
+				case op::bit_andnot: return "notand" + expression(code, ins.a) + expression(code, ins.b);
+				case op::cmov: {
+					const std::string selector = expression(code, ins.c);
+					const std::string t = expression(code, ins.a);
+					const std::string f = expression(code, ins.b);
+					if (selector.size() == 1) return selector + "?" + t + ":" + f;
+					return "sel" + selector + t + f;
+				}
+			}
+		}
+		std::cerr << "value " << int(v) << " is not computed" << std::endl;
+		std::exit(1);
+	}
+
+	/// <summary>
+	/// The function that, called with the inputs in the given order, computes function k; order[i] is the input at position i
+	/// </summary>
+	[[nodiscard]] constexpr uint8_t permute(const uint8_t k, const int (&order)[n_inputs]) noexcept
+	{
+		const uint8_t x = input_values[order[0]];
+		const uint8_t y = input_values[order[1]];
+		const uint8_t z = input_values[order[2]];
+		unsigned result = 0;
+		for (int i = 0; i < 8; ++i) {
+			const int index = (((x >> i) & 1) << 2) | (((y >> i) & 1) << 1) | ((z >> i) & 1);
+			result |= ((k >> i) & 1u) << index;
+		}
+		return static_cast<uint8_t>(result);
+	}
+
+	/// <summary>
+	/// Whether k1 < k2 is the least pair of its class: the pairs that differ in the order of the inputs have programs
+	/// of the same length, the generator derives them from the least one
+	/// </summary>
+	[[nodiscard]] constexpr bool is_canonical(const uint8_t k1, const uint8_t k2) noexcept
+	{
+		constexpr int orders[6][n_inputs] = { { 0, 1, 2 }, { 0, 2, 1 }, { 1, 0, 2 }, { 1, 2, 0 }, { 2, 0, 1 }, { 2, 1, 0 } };
+		for (const auto& order : orders) {
+			const uint8_t p1 = permute(k1, order);
+			const uint8_t p2 = permute(k2, order);
+			if (pair_index(p1, p2) < pair_index(k1, k2)) return false;
+		}
+		return true;
+	}
+
+	/// <summary>
+	/// Distinct values that the programs compute, thus the instructions of both after common subexpression elimination
+	/// </summary>
+	[[nodiscard]] inline int n_values(const std::vector<instruction>& code1, const std::vector<instruction>& code2)
+	{
+		bool computed[256] = {};
+		int n = 0;
+		for (const std::vector<instruction>* code : { &code1, &code2 }) {
+			for (const instruction& ins : *code) {
+				const uint8_t v = apply(ins.code, ins.a, ins.b, ins.c);
+				n += computed[v] ? 0 : 1;
+				computed[v] = true;
+			}
+		}
+		return n;
+	}
+
+	/// <summary>
+	/// The pairs that take fewer instructions together than their shortest programs apart, with the common
+	/// values computed once; both expressions on one line
+	/// </summary>
+	inline void write_pairs(const target& t, const search& s, std::ostream& os)
+	{
+		os << "# pairs found by superopt --pairs " << t.name << ": " << t.description << std::endl;
+		os << "# every pair is computed with the minimal number of instructions, fewer than the programs of the two functions share;" << std::endl;
+		os << "# of the pairs that differ only in the order of the inputs the least one is listed;" << std::endl;
+		os << "# searched up to " << s.limit() << " instructions: pairs whose joint program is longer are not listed, even where it takes fewer than apart" << std::endl;
+		for (int k1 = 0; k1 < 256; ++k1)
+		{
+			for (int k2 = k1 + 1; k2 < 256; ++k2)
+			{
+				const uint8_t f1 = static_cast<uint8_t>(k1);
+				const uint8_t f2 = static_cast<uint8_t>(k2);
+				const int length = s.length(f1, f2);
+				if ((length < 0) || (s.length(f1) < 0) || (s.length(f2) < 0) || !is_canonical(f1, f2)) continue;
+
+				// inlined next to each other, the two programs share the values that both compute
+				const int apart = n_values(s.program(f1), s.program(f2));
+				if (length >= apart) continue;
+
+				const std::vector<instruction> code = s.program(f1, f2);
+				char codes[8];
+				std::snprintf(codes, sizeof(codes), "%02x %02x", k1, k2);
+				os << std::endl << "# length " << length << ", apart " << apart << " (" << s.length(f1) << " + " << s.length(f2) << ")" << std::endl;
+				os << codes << " " << expression(code, f1) << " " << expression(code, f2) << std::endl;
+			}
+		}
+	}
+
+	inline void write(const target& t, const objective goal, const search& s, std::ostream& os)
+	{
+		os << "# functions found by superopt " << ((goal == objective::latency) ? "--latency " : "") << t.name << ": " << t.description << std::endl;
+		if (goal == objective::latency) {
+			os << "# every function is computed with the minimal depth, then the minimal number of instructions" << std::endl;
+		}
+		else {
+			os << "# every function is computed with the minimal number of instructions, constants included" << std::endl;
+		}
+		for (int k = 0; k < 256; ++k)
+		{
+			const int length = s.length(static_cast<uint8_t>(k));
+			if (length < 0) {
+				os << std::endl << "# " << std::hex << k << std::dec << ": longer than the search limit" << std::endl;
+				continue;
+			}
+			char code[3];
+			std::snprintf(code, sizeof(code), "%02x", k);
+			os << std::endl << "# length " << length << ", depth " << s.depth(static_cast<uint8_t>(k)) << std::endl;
+			os << code << " " << expression(s.program(static_cast<uint8_t>(k)), static_cast<uint8_t>(k)) << std::endl;
+		}
+	}
+}
+
+int main(int argc, char** argv)
+{
+	using namespace ternarylogic::superopt;
+
+	objective goal = objective::size;
+	if ((argc > 1) && (std::string(argv[1]) == "--latency")) {
+		goal = objective::latency;
+		--argc;
+		++argv;
+	}
+	else if ((argc > 1) && (std::string(argv[1]) == "--pairs")) {
+		goal = objective::pairs;
+		--argc;
+		++argv;
+	}
+	if (argc < 3) {
+		std::cerr << "usage: superopt [--latency | --pairs] target output_file [max_length]" << std::endl;
+		return 1;
+	}
+	const auto& all = targets();
+	const auto t = std::find_if(all.begin(), all.end(), [&](const target& x) { return std::string(x.name) == argv[1]; });
+	if (t == all.end()) {
+		std::cerr << "unknown target " << argv[1] << std::endl;
+		return 1;
+	}
+	const int limit = (argc > 3) ? std::atoi(argv[3]) : max_length;
+
+	search s(*t, goal, limit);
+	s.run();
+
+	std::ofstream file(argv[2]);
+	if (goal == objective::pairs) {
+		write_pairs(*t, s, file);
+		return 0;
+	}
+	write(*t, goal, s, file);
+	return s.done() ? 0 : 2;
+}
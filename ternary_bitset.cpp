@@ -111,7 +111,7 @@ namespace ternarylogic {
 			template<size_t S> struct ternary_struct<0x0b, S> {
 				static constexpr std::bitset<S> ternary(const std::bitset<S>& A, const std::bitset<S>& B, const std::bitset<S>& C) {
 					const std::bitset<S> t0 = ~A;
-					const std::bitset<S>& c1 = std::bitset<S>().set();
+					const std::bitset<S> c1 = std::bitset<S>().set();
 					const std::bitset<S> t1 = B ^ c1;
 					const std::bitset<S> t2 = t1 | C;
 					const std::bitset<S> t3 = t0 & t2;
@@ -130,7 +130,7 @@ namespace ternarylogic {
 			template<size_t S> struct ternary_struct<0x0d, S> {
 				static constexpr std::bitset<S> ternary(const std::bitset<S>& A, const std::bitset<S>& B, const std::bitset<S>& C) {
 					const std::bitset<S> t0 = ~A;
-					const std::bitset<S>& c1 = std::bitset<S>().set();
+					const std::bitset<S> c1 = std::bitset<S>().set();
 					const std::bitset<S> t1 = C ^ c1;
 					const std::bitset<S> t2 = B | t1;
 					const std::bitset<S> t3 = t0 & t2;
@@ -340,7 +340,7 @@ namespace ternarylogic {
 			template<size_t S> struct ternary_struct<0x23, S> {
 				static constexpr std::bitset<S> ternary(const std::bitset<S>& A, const std::bitset<S>& B, const std::bitset<S>& C) {
 					const std::bitset<S> t0 = ~B;
-					const std::bitset<S>& c1 = std::bitset<S>().set();
+					const std::bitset<S> c1 = std::bitset<S>().set();
 					const std::bitset<S> t1 = A ^ c1;
 					const std::bitset<S> t2 = t1 | C;
 					const std::bitset<S> t3 = t0 & t2;
@@ -361,7 +361,7 @@ namespace ternarylogic {
 				static constexpr std::bitset<S> ternary(const std::bitset<S>& A, const std::bitset<S>& B, const std::bitset<S>& C) {
 					const std::bitset<S> t0 = A & B;
 					const std::bitset<S> t1 = ~t0;
-					const std::bitset<S>& c1 = std::bitset<S>().set();
+					const std::bitset<S> c1 = std::bitset<S>().set();
 					const std::bitset<S> t2 = C ^ c1;
 					const std::bitset<S> t3 = A ^ t2;
 					const std::bitset<S> t4 = t1 & t3;
@@ -483,7 +483,7 @@ namespace ternarylogic {
 			template<size_t S> struct ternary_struct<0x31, S> {
 				static constexpr std::bitset<S> ternary(const std::bitset<S>& A, const std::bitset<S>& B, const std::bitset<S>& C) {
 					const std::bitset<S> t0 = ~B;
-					const std::bitset<S>& c1 = std::bitset<S>().set();
+					const std::bitset<S> c1 = std::bitset<S>().set();
 					const std::bitset<S> t1 = C ^ c1;
 					const std::bitset<S> t2 = A | t1;
 					const std::bitset<S> t3 = t0 & t2;
@@ -557,7 +557,7 @@ namespace ternarylogic {
 			// code=0x39, function=(B xor (A or (C xor 1))), lowered=(B xor (A or (C xor 1))), set=automat
 			template<size_t S> struct ternary_struct<0x39, S> {
 				static constexpr std::bitset<S> ternary(const std::bitset<S>& A, const std::bitset<S>& B, const std::bitset<S>& C) {
-					const std::bitset<S>& c1 = std::bitset<S>().set();
+					const std::bitset<S> c1 = std::bitset<S>().set();
 					const std::bitset<S> t0 = C ^ c1;
 					const std::bitset<S> t1 = A | t0;
 					const std::bitset<S> t2 = B ^ t1;
@@ -580,7 +580,7 @@ namespace ternarylogic {
 				static constexpr std::bitset<S> ternary(const std::bitset<S>& A, const std::bitset<S>& B, const std::bitset<S>& C) {
 					const std::bitset<S> t0 = ~A;
 					const std::bitset<S> t1 = t0 & C;
-					const std::bitset<S>& c1 = std::bitset<S>().set();
+					const std::bitset<S> c1 = std::bitset<S>().set();
 					const std::bitset<S> t2 = B ^ c1;
 					const std::bitset<S> t3 = t1 | t2;
 					return t3;
@@ -653,7 +653,7 @@ namespace ternarylogic {
 				static constexpr std::bitset<S> ternary(const std::bitset<S>& A, const std::bitset<S>& B, const std::bitset<S>& C) {
 					const std::bitset<S> t0 = A & C;
 					const std::bitset<S> t1 = ~t0;
-					const std::bitset<S>& c1 = std::bitset<S>().set();
+					const std::bitset<S> c1 = std::bitset<S>().set();
 					const std::bitset<S> t2 = B ^ c1;
 					const std::bitset<S> t3 = A ^ t2;
 					const std::bitset<S> t4 = t1 & t3;
@@ -672,7 +672,7 @@ namespace ternarylogic {
 			template<size_t S> struct ternary_struct<0x45, S> {
 				static constexpr std::bitset<S> ternary(const std::bitset<S>& A, const std::bitset<S>& B, const std::bitset<S>& C) {
 					const std::bitset<S> t0 = ~C;
-					const std::bitset<S>& c1 = std::bitset<S>().set();
+					const std::bitset<S> c1 = std::bitset<S>().set();
 					const std::bitset<S> t1 = A ^ c1;
 					const std::bitset<S> t2 = t1 | B;
 					const std::bitset<S> t3 = t0 & t2;
@@ -796,7 +796,7 @@ namespace ternarylogic {
 			template<size_t S> struct ternary_struct<0x51, S> {
 				static constexpr std::bitset<S> ternary(const std::bitset<S>& A, const std::bitset<S>& B, const std::bitset<S>& C) {
 					const std::bitset<S> t0 = ~C;
-					const std::bitset<S>& c1 = std::bitset<S>().set();
+					const std::bitset<S> c1 = std::bitset<S>().set();
 					const std::bitset<S> t1 = B ^ c1;
 					const std::bitset<S> t2 = A | t1;
 					const std::bitset<S> t3 = t0 & t2;
@@ -870,7 +870,7 @@ namespace ternarylogic {
 			// code=0x59, function=(C xor (A or (B xor 1))), lowered=(C xor (A or (B xor 1))), set=automat
 			template<size_t S> struct ternary_struct<0x59, S> {
 				static constexpr std::bitset<S> ternary(const std::bitset<S>& A, const std::bitset<S>& B, const std::bitset<S>& C) {
-					const std::bitset<S>& c1 = std::bitset<S>().set();
+					const std::bitset<S> c1 = std::bitset<S>().set();
 					const std::bitset<S> t0 = B ^ c1;
 					const std::bitset<S> t1 = A | t0;
 					const std::bitset<S> t2 = C ^ t1;
@@ -889,7 +889,7 @@ namespace ternarylogic {
 				static constexpr std::bitset<S> ternary(const std::bitset<S>& A, const std::bitset<S>& B, const std::bitset<S>& C) {
 					const std::bitset<S> t0 = A ^ C;
 					const std::bitset<S> t1 = A | B;
-					const std::bitset<S>& c1 = std::bitset<S>().set();
+					const std::bitset<S> c1 = std::bitset<S>().set();
 					const std::bitset<S> t2 = t1 ^ c1;
 					const std::bitset<S> t3 = t0 | t2;
 					return t3;
@@ -967,7 +967,7 @@ namespace ternarylogic {
 			// code=0x63, function=(B xor ((A xor 1) or C)), lowered=(B xor ((A xor 1) or C)), set=automat
 			template<size_t S> struct ternary_struct<0x63, S> {
 				static constexpr std::bitset<S> ternary(const std::bitset<S>& A, const std::bitset<S>& B, const std::bitset<S>& C) {
-					const std::bitset<S>& c1 = std::bitset<S>().set();
+					const std::bitset<S> c1 = std::bitset<S>().set();
 					const std::bitset<S> t0 = A ^ c1;
 					const std::bitset<S> t1 = t0 | C;
 					const std::bitset<S> t2 = B ^ t1;
@@ -986,7 +986,7 @@ namespace ternarylogic {
 			// code=0x65, function=(C xor ((A xor 1) or B)), lowered=(C xor ((A xor 1) or B)), set=automat
 			template<size_t S> struct ternary_struct<0x65, S> {
 				static constexpr std::bitset<S> ternary(const std::bitset<S>& A, const std::bitset<S>& B, const std::bitset<S>& C) {
-					const std::bitset<S>& c1 = std::bitset<S>().set();
+					const std::bitset<S> c1 = std::bitset<S>().set();
 					const std::bitset<S> t0 = A ^ c1;
 					const std::bitset<S> t1 = t0 | B;
 					const std::bitset<S> t2 = C ^ t1;
@@ -1044,7 +1044,7 @@ namespace ternarylogic {
 				static constexpr std::bitset<S> ternary(const std::bitset<S>& A, const std::bitset<S>& B, const std::bitset<S>& C) {
 					const std::bitset<S> t0 = ~A;
 					const std::bitset<S> t1 = t0 & C;
-					const std::bitset<S>& c1 = std::bitset<S>().set();
+					const std::bitset<S> c1 = std::bitset<S>().set();
 					const std::bitset<S> t2 = A ^ c1;
 					const std::bitset<S> t3 = B ^ C;
 					const std::bitset<S> t4 = t2 ^ t3;
@@ -1065,7 +1065,7 @@ namespace ternarylogic {
 				static constexpr std::bitset<S> ternary(const std::bitset<S>& A, const std::bitset<S>& B, const std::bitset<S>& C) {
 					const std::bitset<S> t0 = ~A;
 					const std::bitset<S> t1 = t0 & B;
-					const std::bitset<S>& c1 = std::bitset<S>().set();
+					const std::bitset<S> c1 = std::bitset<S>().set();
 					const std::bitset<S> t2 = A ^ c1;
 					const std::bitset<S> t3 = B ^ C;
 					const std::bitset<S> t4 = t2 ^ t3;
@@ -1087,7 +1087,7 @@ namespace ternarylogic {
 			template<size_t S> struct ternary_struct<0x6f, S> {
 				static constexpr std::bitset<S> ternary(const std::bitset<S>& A, const std::bitset<S>& B, const std::bitset<S>& C) {
 					const std::bitset<S> t0 = B ^ C;
-					const std::bitset<S>& c1 = std::bitset<S>().set();
+					const std::bitset<S> c1 = std::bitset<S>().set();
 					const std::bitset<S> t1 = A ^ c1;
 					const std::bitset<S> t2 = t0 | t1;
 					return t2;
@@ -1186,7 +1186,7 @@ namespace ternarylogic {
 				static constexpr std::bitset<S> ternary(const std::bitset<S>& A, const std::bitset<S>& B, const std::bitset<S>& C) {
 					const std::bitset<S> t0 = ~B;
 					const std::bitset<S> t1 = t0 & A;
-					const std::bitset<S>& c1 = std::bitset<S>().set();
+					const std::bitset<S> c1 = std::bitset<S>().set();
 					const std::bitset<S> t2 = B ^ c1;
 					const std::bitset<S> t3 = A ^ C;
 					const std::bitset<S> t4 = t2 ^ t3;
@@ -1227,7 +1227,7 @@ namespace ternarylogic {
 			template<size_t S> struct ternary_struct<0x7d, S> {
 				static constexpr std::bitset<S> ternary(const std::bitset<S>& A, const std::bitset<S>& B, const std::bitset<S>& C) {
 					const std::bitset<S> t0 = A ^ B;
-					const std::bitset<S>& c1 = std::bitset<S>().set();
+					const std::bitset<S> c1 = std::bitset<S>().set();
 					const std::bitset<S> t1 = C ^ c1;
 					const std::bitset<S> t2 = t0 | t1;
 					return t2;
@@ -1247,7 +1247,7 @@ namespace ternarylogic {
 				static constexpr std::bitset<S> ternary(const std::bitset<S>& A, const std::bitset<S>& B, const std::bitset<S>& C) {
 					const std::bitset<S> t0 = A & B;
 					const std::bitset<S> t1 = t0 & C;
-					const std::bitset<S>& c1 = std::bitset<S>().set();
+					const std::bitset<S> c1 = std::bitset<S>().set();
 					const std::bitset<S> t2 = t1 ^ c1;
 					return t2;
 				}
@@ -1265,7 +1265,7 @@ namespace ternarylogic {
 				static constexpr std::bitset<S> ternary(const std::bitset<S>& A, const std::bitset<S>& B, const std::bitset<S>& C) {
 					const std::bitset<S> t0 = A ^ C;
 					const std::bitset<S> t1 = ~t0;
-					const std::bitset<S>& c1 = std::bitset<S>().set();
+					const std::bitset<S> c1 = std::bitset<S>().set();
 					const std::bitset<S> t2 = B ^ c1;
 					const std::bitset<S> t3 = A ^ t2;
 					const std::bitset<S> t4 = t1 & t3;
@@ -1286,7 +1286,7 @@ namespace ternarylogic {
 				static constexpr std::bitset<S> ternary(const std::bitset<S>& A, const std::bitset<S>& B, const std::bitset<S>& C) {
 					const std::bitset<S> t0 = A ^ B;
 					const std::bitset<S> t1 = ~t0;
-					const std::bitset<S>& c1 = std::bitset<S>().set();
+					const std::bitset<S> c1 = std::bitset<S>().set();
 					const std::bitset<S> t2 = A ^ c1;
 					const std::bitset<S> t3 = t2 | C;
 					const std::bitset<S> t4 = t1 & t3;
@@ -1307,7 +1307,7 @@ namespace ternarylogic {
 				static constexpr std::bitset<S> ternary(const std::bitset<S>& A, const std::bitset<S>& B, const std::bitset<S>& C) {
 					const std::bitset<S> t0 = A ^ C;
 					const std::bitset<S> t1 = ~t0;
-					const std::bitset<S>& c1 = std::bitset<S>().set();
+					const std::bitset<S> c1 = std::bitset<S>().set();
 					const std::bitset<S> t2 = C ^ c1;
 					const std::bitset<S> t3 = B | t2;
 					const std::bitset<S> t4 = t1 & t3;
@@ -1345,7 +1345,7 @@ namespace ternarylogic {
 				static constexpr std::bitset<S> ternary(const std::bitset<S>& A, const std::bitset<S>& B, const std::bitset<S>& C) {
 					const std::bitset<S> t0 = B ^ C;
 					const std::bitset<S> t1 = ~t0;
-					const std::bitset<S>& c1 = std::bitset<S>().set();
+					const std::bitset<S> c1 = std::bitset<S>().set();
 					const std::bitset<S> t2 = A ^ c1;
 					const std::bitset<S> t3 = t2 | B;
 					const std::bitset<S> t4 = t1 & t3;
@@ -1428,7 +1428,7 @@ namespace ternarylogic {
 				static constexpr std::bitset<S> ternary(const std::bitset<S>& A, const std::bitset<S>& B, const std::bitset<S>& C) {
 					const std::bitset<S> t0 = B ^ C;
 					const std::bitset<S> t1 = ~t0;
-					const std::bitset<S>& c1 = std::bitset<S>().set();
+					const std::bitset<S> c1 = std::bitset<S>().set();
 					const std::bitset<S> t2 = B ^ c1;
 					const std::bitset<S> t3 = A | t2;
 					const std::bitset<S> t4 = t1 & t3;
@@ -1527,7 +1527,7 @@ namespace ternarylogic {
 				static constexpr std::bitset<S> ternary(const std::bitset<S>& A, const std::bitset<S>& B, const std::bitset<S>& C) {
 					const std::bitset<S> t0 = ~A;
 					const std::bitset<S> t1 = t0 & C;
-					const std::bitset<S>& c1 = std::bitset<S>().set();
+					const std::bitset<S> c1 = std::bitset<S>().set();
 					const std::bitset<S> t2 = C ^ c1;
 					const std::bitset<S> t3 = B ^ t2;
 					const std::bitset<S> t4 = t1 | t3;
@@ -1548,7 +1548,7 @@ namespace ternarylogic {
 				static constexpr std::bitset<S> ternary(const std::bitset<S>& A, const std::bitset<S>& B, const std::bitset<S>& C) {
 					const std::bitset<S> t0 = ~A;
 					const std::bitset<S> t1 = t0 & B;
-					const std::bitset<S>& c1 = std::bitset<S>().set();
+					const std::bitset<S> c1 = std::bitset<S>().set();
 					const std::bitset<S> t2 = C ^ c1;
 					const std::bitset<S> t3 = B ^ t2;
 					const std::bitset<S> t4 = t1 | t3;
@@ -1586,7 +1586,7 @@ namespace ternarylogic {
 				static constexpr std::bitset<S> ternary(const std::bitset<S>& A, const std::bitset<S>& B, const std::bitset<S>& C) {
 					const std::bitset<S> t0 = A ^ C;
 					const std::bitset<S> t1 = ~t0;
-					const std::bitset<S>& c1 = std::bitset<S>().set();
+					const std::bitset<S> c1 = std::bitset<S>().set();
 					const std::bitset<S> t2 = B ^ c1;
 					const std::bitset<S> t3 = A | t2;
 					const std::bitset<S> t4 = t1 & t3;
@@ -1645,7 +1645,7 @@ namespace ternarylogic {
 				static constexpr std::bitset<S> ternary(const std::bitset<S>& A, const std::bitset<S>& B, const std::bitset<S>& C) {
 					const std::bitset<S> t0 = ~B;
 					const std::bitset<S> t1 = t0 & C;
-					const std::bitset<S>& c1 = std::bitset<S>().set();
+					const std::bitset<S> c1 = std::bitset<S>().set();
 					const std::bitset<S> t2 = C ^ c1;
 					const std::bitset<S> t3 = A ^ t2;
 					const std::bitset<S> t4 = t1 | t3;
@@ -1698,7 +1698,7 @@ namespace ternarylogic {
 			template<size_t S> struct ternary_struct<0xad, S> {
 				static constexpr std::bitset<S> ternary(const std::bitset<S>& A, const std::bitset<S>& B, const std::bitset<S>& C) {
 					const std::bitset<S> t0 = B & C;
-					const std::bitset<S>& c1 = std::bitset<S>().set();
+					const std::bitset<S> c1 = std::bitset<S>().set();
 					const std::bitset<S> t1 = C ^ c1;
 					const std::bitset<S> t2 = A ^ t1;
 					const std::bitset<S> t3 = t0 | t2;
@@ -1778,7 +1778,7 @@ namespace ternarylogic {
 				static constexpr std::bitset<S> ternary(const std::bitset<S>& A, const std::bitset<S>& B, const std::bitset<S>& C) {
 					const std::bitset<S> t0 = ~B;
 					const std::bitset<S> t1 = t0 & A;
-					const std::bitset<S>& c1 = std::bitset<S>().set();
+					const std::bitset<S> c1 = std::bitset<S>().set();
 					const std::bitset<S> t2 = C ^ c1;
 					const std::bitset<S> t3 = A ^ t2;
 					const std::bitset<S> t4 = t1 | t3;
@@ -1818,7 +1818,7 @@ namespace ternarylogic {
 			template<size_t S> struct ternary_struct<0xb9, S> {
 				static constexpr std::bitset<S> ternary(const std::bitset<S>& A, const std::bitset<S>& B, const std::bitset<S>& C) {
 					const std::bitset<S> t0 = A & C;
-					const std::bitset<S>& c1 = std::bitset<S>().set();
+					const std::bitset<S> c1 = std::bitset<S>().set();
 					const std::bitset<S> t1 = C ^ c1;
 					const std::bitset<S> t2 = B ^ t1;
 					const std::bitset<S> t3 = t0 | t2;
@@ -1855,7 +1855,7 @@ namespace ternarylogic {
 			template<size_t S> struct ternary_struct<0xbd, S> {
 				static constexpr std::bitset<S> ternary(const std::bitset<S>& A, const std::bitset<S>& B, const std::bitset<S>& C) {
 					const std::bitset<S> t0 = A ^ B;
-					const std::bitset<S>& c1 = std::bitset<S>().set();
+					const std::bitset<S> c1 = std::bitset<S>().set();
 					const std::bitset<S> t1 = C ^ c1;
 					const std::bitset<S> t2 = A ^ t1;
 					const std::bitset<S> t3 = t0 | t2;
@@ -1891,7 +1891,7 @@ namespace ternarylogic {
 				static constexpr std::bitset<S> ternary(const std::bitset<S>& A, const std::bitset<S>& B, const std::bitset<S>& C) {
 					const std::bitset<S> t0 = A ^ B;
 					const std::bitset<S> t1 = ~t0;
-					const std::bitset<S>& c1 = std::bitset<S>().set();
+					const std::bitset<S> c1 = std::bitset<S>().set();
 					const std::bitset<S> t2 = C ^ c1;
 					const std::bitset<S> t3 = A | t2;
 					const std::bitset<S> t4 = t1 & t3;
@@ -1951,7 +1951,7 @@ namespace ternarylogic {
 				static constexpr std::bitset<S> ternary(const std::bitset<S>& A, const std::bitset<S>& B, const std::bitset<S>& C) {
 					const std::bitset<S> t0 = ~C;
 					const std::bitset<S> t1 = t0 & B;
-					const std::bitset<S>& c1 = std::bitset<S>().set();
+					const std::bitset<S> c1 = std::bitset<S>().set();
 					const std::bitset<S> t2 = B ^ c1;
 					const std::bitset<S> t3 = A ^ t2;
 					const std::bitset<S> t4 = t1 | t3;
@@ -1989,7 +1989,7 @@ namespace ternarylogic {
 			template<size_t S> struct ternary_struct<0xcb, S> {
 				static constexpr std::bitset<S> ternary(const std::bitset<S>& A, const std::bitset<S>& B, const std::bitset<S>& C) {
 					const std::bitset<S> t0 = B & C;
-					const std::bitset<S>& c1 = std::bitset<S>().set();
+					const std::bitset<S> c1 = std::bitset<S>().set();
 					const std::bitset<S> t1 = B ^ c1;
 					const std::bitset<S> t2 = A ^ t1;
 					const std::bitset<S> t3 = t0 | t2;
@@ -2061,7 +2061,7 @@ namespace ternarylogic {
 				static constexpr std::bitset<S> ternary(const std::bitset<S>& A, const std::bitset<S>& B, const std::bitset<S>& C) {
 					const std::bitset<S> t0 = ~C;
 					const std::bitset<S> t1 = t0 & A;
-					const std::bitset<S>& c1 = std::bitset<S>().set();
+					const std::bitset<S> c1 = std::bitset<S>().set();
 					const std::bitset<S> t2 = B ^ c1;
 					const std::bitset<S> t3 = A ^ t2;
 					const std::bitset<S> t4 = t1 | t3;
@@ -2141,7 +2141,7 @@ namespace ternarylogic {
 			template<size_t S> struct ternary_struct<0xdb, S> {
 				static constexpr std::bitset<S> ternary(const std::bitset<S>& A, const std::bitset<S>& B, const std::bitset<S>& C) {
 					const std::bitset<S> t0 = A ^ C;
-					const std::bitset<S>& c1 = std::bitset<S>().set();
+					const std::bitset<S> c1 = std::bitset<S>().set();
 					const std::bitset<S> t1 = B ^ c1;
 					const std::bitset<S> t2 = A ^ t1;
 					const std::bitset<S> t3 = t0 | t2;
@@ -2213,7 +2213,7 @@ namespace ternarylogic {
 			template<size_t S> struct ternary_struct<0xe3, S> {
 				static constexpr std::bitset<S> ternary(const std::bitset<S>& A, const std::bitset<S>& B, const std::bitset<S>& C) {
 					const std::bitset<S> t0 = A & C;
-					const std::bitset<S>& c1 = std::bitset<S>().set();
+					const std::bitset<S> c1 = std::bitset<S>().set();
 					const std::bitset<S> t1 = B ^ c1;
 					const std::bitset<S> t2 = A ^ t1;
 					const std::bitset<S> t3 = t0 | t2;
@@ -2234,7 +2234,7 @@ namespace ternarylogic {
 			template<size_t S> struct ternary_struct<0xe5, S> {
 				static constexpr std::bitset<S> ternary(const std::bitset<S>& A, const std::bitset<S>& B, const std::bitset<S>& C) {
 					const std::bitset<S> t0 = A & B;
-					const std::bitset<S>& c1 = std::bitset<S>().set();
+					const std::bitset<S> c1 = std::bitset<S>().set();
 					const std::bitset<S> t1 = C ^ c1;
 					const std::bitset<S> t2 = A ^ t1;
 					const std::bitset<S> t3 = t0 | t2;
@@ -0,0 +1,195 @@
+#pragma once
+#include <array>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>		// for memcpy
+#include <type_traits>
+#include <utility>		// for index_sequence
+
+#include "ternary_compat.h"
+#include "ternary_sse.cpp"
+#include "ternary_avx2.cpp"
+#include "ternary_avx512.cpp"
+
+namespace ternarylogic
+{
+	/// <summary>
+	/// S bits in 64-byte aligned storage, padded to whole 512-bit vectors, thus ternary<K> runs the widest vector kernels
+	/// of the target over it without a scalar tail. Bit i is bit i % 64 of word i / 64, as in std::bitset; the bits past
+	/// S are zero.
+	/// </summary>
+	template<size_t S>
+	class alignas(64) bitvector
+	{
+		static_assert(S > 0, "Empty bitvector");
+
+	public:
+		static constexpr size_t n_words = (S + 63) / 64;
+		static constexpr size_t n_storage_words = (n_words + 7) & ~static_cast<size_t>(7);
+
+	private:
+		uint64_t words_[n_storage_words] = {};
+
+		/// <summary>
+		/// True if std::bitset<S> holds its bits in words of at least a byte from bit 0 up, on a little-endian core: its
+		/// bytes are then the first bytes of the storage (libstdc++, libc++ and MSVC)
+		/// </summary>
+		static constexpr bool bitset_layout = std::is_trivially_copyable<std::bitset<S>>::value
+			&& (sizeof(std::bitset<S>) >= ((S + 7) / 8)) && (sizeof(std::bitset<S>) <= (n_words * 8));
+
+	public:
+		constexpr bitvector() noexcept = default;
+
+		/// <summary>
+		/// The bits of b; one copy of its words where the layout allows, bit by bit otherwise
+		/// </summary>
+		explicit bitvector(const std::bitset<S>& b) noexcept
+		{
+			if constexpr (bitset_layout) {
+				std::memcpy(words_, &b, sizeof(b));
+				trim();
+			}
+			else {
+				for (size_t i = 0; i < S; ++i) {
+					if (b[i]) set(i);
+				}
+			}
+		}
+
+		[[nodiscard]] std::bitset<S> to_bitset() const noexcept
+		{
+			std::bitset<S> result;
+			if constexpr (bitset_layout) {
+				std::memcpy(&result, words_, sizeof(result));
+			}
+			else {
+				for (size_t i = 0; i < S; ++i) {
+					if (test(i)) result.set(i);
+				}
+			}
+			return result;
+		}
+
+		[[nodiscard]] static constexpr size_t size() noexcept { return S; }
+		[[nodiscard]] uint64_t* data() noexcept { return words_; }
+		[[nodiscard]] const uint64_t* data() const noexcept { return words_; }
+
+		[[nodiscard]] constexpr bool test(const size_t i) const noexcept { return ((words_[i / 64] >> (i % 64)) & 1) != 0; }
+
+		constexpr bitvector& set(const size_t i, const bool value = true) noexcept
+		{
+			const uint64_t bit = static_cast<uint64_t>(1) << (i % 64);
+			words_[i / 64] = value ? (words_[i / 64] | bit) : (words_[i / 64] & ~bit);
+			return *this;
+		}
+
+		constexpr bitvector& reset(const size_t i) noexcept { return set(i, false); }
+
+		[[nodiscard]] size_t count() const noexcept
+		{
+			size_t result = 0;
+			for (size_t i = 0; i < n_words; ++i) result += std::bitset<64>(words_[i]).count();
+			return result;
+		}
+
+		[[nodiscard]] bool any() const noexcept
+		{
+			uint64_t x = 0;
+			for (size_t i = 0; i < n_words; ++i) x |= words_[i];
+			return x != 0;
+		}
+
+		[[nodiscard]] bool none() const noexcept { return !any(); }
+
+		/// <summary>
+		/// Clear the bits past S, which the kernels of functions with f(0, 0, 0) = 1 set
+		/// </summary>
+		constexpr void trim() noexcept
+		{
+			if constexpr ((S % 64) != 0) {
+				words_[n_words - 1] &= (static_cast<uint64_t>(1) << (S % 64)) - 1;
+			}
+			for (size_t i = n_words; i < n_storage_words; ++i) words_[i] = 0;
+		}
+
+		[[nodiscard]] friend bool operator==(const bitvector& a, const bitvector& b) noexcept
+		{
+			return std::memcmp(a.words_, b.words_, sizeof(a.words_)) == 0;
+		}
+
+		[[nodiscard]] friend bool operator!=(const bitvector& a, const bitvector& b) noexcept { return !(a == b); }
+	};
+
+	namespace priv
+	{
+		/// <summary>
+		/// Function k over n words; n is a multiple of 8 and the pointers are 64-byte aligned, dst may be one of the inputs
+		/// </summary>
+		using words_kernel = void (*)(uint64_t* dst, const uint64_t* a, const uint64_t* b, const uint64_t* c, size_t n) noexcept;
+
+		/// <summary>
+		/// Boolean Function K over n words with the widest kernels of the target, those of microarchitecture U
+		/// </summary>
+		template<unsigned K, unsigned U>
+		void ternary_words(uint64_t* dst, const uint64_t* a, const uint64_t* b, const uint64_t* c, const size_t n) noexcept
+		{
+#if defined(__AVX512F__)
+			for (size_t i = 0; i < n; i += 8) {
+				const __m512i r = ternarylogic::avx512raw::ternary<K>(_mm512_load_si512(a + i), _mm512_load_si512(b + i), _mm512_load_si512(c + i));
+				_mm512_store_si512(dst + i, r);
+			}
+#elif defined(__AVX2__)
+			for (size_t i = 0; i < n; i += 4) {
+				const __m256i r = ternarylogic::avx2::kernels<U>::template ternary<K>(
+					_mm256_load_si256(reinterpret_cast<const __m256i*>(a + i)),
+					_mm256_load_si256(reinterpret_cast<const __m256i*>(b + i)),
+					_mm256_load_si256(reinterpret_cast<const __m256i*>(c + i)));
+				_mm256_store_si256(reinterpret_cast<__m256i*>(dst + i), r);
+			}
+#else
+			for (size_t i = 0; i < n; i += 2) {
+				const __m128i r = ternarylogic::sse::kernels<U>::template ternary<K>(
+					_mm_load_si128(reinterpret_cast<const __m128i*>(a + i)),
+					_mm_load_si128(reinterpret_cast<const __m128i*>(b + i)),
+					_mm_load_si128(reinterpret_cast<const __m128i*>(c + i)));
+				_mm_store_si128(reinterpret_cast<__m128i*>(dst + i), r);
+			}
+#endif
+		}
+
+		template<unsigned U, size_t... K>
+		[[nodiscard]] constexpr std::array<words_kernel, 256> make_words_kernels(std::index_sequence<K...>) noexcept
+		{
+			return { { &ternary_words<K, U>... } };
+		}
+
+		/// <summary>
+		/// The kernel of function k over words: the switch on k is taken once per bitvector instead of once per vector
+		/// </summary>
+		template<unsigned U>
+		[[nodiscard]] inline words_kernel get_words_kernel(const unsigned long long k) noexcept
+		{
+			static constexpr std::array<words_kernel, 256> kernels = make_words_kernels<U>(std::make_index_sequence<256>());
+			return kernels[k & 0xFF];
+		}
+
+		template<unsigned K, unsigned U, size_t S>
+		[[nodiscard]] inline bitvector<S> ternary_bitvector(const bitvector<S>& a, const bitvector<S>& b, const bitvector<S>& c) noexcept
+		{
+			bitvector<S> result;
+			ternary_words<K, U>(result.data(), a.data(), b.data(), c.data(), bitvector<S>::n_storage_words);
+			if constexpr ((K & 1) != 0) result.trim();
+			return result;
+		}
+
+		template<unsigned U, size_t S>
+		[[nodiscard]] inline bitvector<S> ternary_bitvector(const bitvector<S>& a, const bitvector<S>& b, const bitvector<S>& c, const unsigned long long k) noexcept
+		{
+			bitvector<S> result;
+			get_words_kernel<U>(k)(result.data(), a.data(), b.data(), c.data(), bitvector<S>::n_storage_words);
+			if ((k & 1) != 0) result.trim();
+			return result;
+		}
+	}
+}
@@ -0,0 +1,275 @@
+#pragma once
+#include <array>
+#include <cstdlib>		// for rand
+#include <cstring>		// for memcpy
+#include <iostream>		// for cout
+#include <mutex>
+#include <ostream>
+#include <type_traits>
+#include <utility>		// for index_sequence
+#include <vector>
+
+#include "ternary_logic.cpp"
+#include "ternary_perf.h"
+
+namespace ternarylogic::bulk
+{
+	/// <summary>
+	/// Kernel that evaluates one ternary function over n consecutive elements: dst[i] = f(a[i], b[i], c[i])
+	/// </summary>
+	template<typename T>
+	using kernel = void (*)(T* dst, const T* a, const T* b, const T* c, size_t n) noexcept;
+
+	/// <summary>
+	/// Below this number of elements the loop has too few independent evaluations to hide the dependency chain of one
+	/// </summary>
+	constexpr size_t latency_bound_elements = 4;
+
+	[[nodiscard]] constexpr goal goal_of(const size_t n) noexcept
+	{
+		return (n < latency_bound_elements) ? goal::latency : goal::throughput;
+	}
+
+	/// <summary>
+	/// Evaluate Boolean Function K over n consecutive elements of a, b and c, and store the result in dst
+	/// </summary>
+	template<bf_type K, typename T, goal G = goal::throughput, uarch U = default_uarch>
+	void ternary(T* dst, const T* a, const T* b, const T* c, const size_t n) noexcept
+	{
+		for (size_t i = 0; i < n; ++i) {
+			dst[i] = ternarylogic::ternary<K, G, U>(a[i], b[i], c[i]);
+		}
+	}
+
+	namespace priv
+	{
+		template<typename T, goal G, uarch U, size_t... K>
+		[[nodiscard]] constexpr std::array<kernel<T>, 256> make_kernels(std::index_sequence<K...>) noexcept
+		{
+			return { { &bulk::ternary<K, T, G, U>... } };
+		}
+
+		template<typename T, uarch U>
+		[[nodiscard]] inline kernel<T> get_kernel(const bf_type k, const goal g) noexcept
+		{
+			static constexpr std::array<kernel<T>, 256> throughput = make_kernels<T, goal::throughput, U>(std::make_index_sequence<256>());
+			static constexpr std::array<kernel<T>, 256> latency = make_kernels<T, goal::latency, U>(std::make_index_sequence<256>());
+			return (g == goal::latency) ? latency[k & 0xFF] : throughput[k & 0xFF];
+		}
+	}
+
+	/// <summary>
+	/// Get the kernel of the provided Boolean Function; the switch on k is thus taken once per block instead of once per element
+	/// </summary>
+	template<typename T>
+	[[nodiscard]] inline kernel<T> get_kernel(const bf_type k, const goal g = goal::throughput) noexcept
+	{
+		return priv::get_kernel<T, default_uarch>(k, g);
+	}
+
+	/// <summary>
+	/// Get the kernel of the provided Boolean Function for the microarchitecture u, e.g. detect_uarch(), chosen at run time
+	/// </summary>
+	template<typename T>
+	[[nodiscard]] inline kernel<T> get_kernel(const bf_type k, const goal g, const uarch u) noexcept
+	{
+		switch (u)
+		{
+			case uarch::skylake: return priv::get_kernel<T, uarch::skylake>(k, g);
+			case uarch::icelake: return priv::get_kernel<T, uarch::icelake>(k, g);
+			case uarch::zen2: return priv::get_kernel<T, uarch::zen2>(k, g);
+			case uarch::zen3: return priv::get_kernel<T, uarch::zen3>(k, g);
+			case uarch::zen4: return priv::get_kernel<T, uarch::zen4>(k, g);
+			case uarch::piledriver: return priv::get_kernel<T, uarch::piledriver>(k, g);
+			default: return priv::get_kernel<T, uarch::generic>(k, g);
+		}
+	}
+
+	namespace priv
+	{
+		/// <summary>
+		/// Hardware counters of the runtime-k calls per backend and per function code
+		/// </summary>
+		struct perf_table
+		{
+			std::mutex mutex;
+			perf::totals entries[n_isa][256];
+		};
+
+		[[nodiscard]] inline perf_table& get_perf_table()
+		{
+			static perf_table t;
+			return t;
+		}
+	}
+
+	/// <summary>
+	/// Evaluate Boolean Function k over n consecutive elements of a, b and c, and store the result in dst. With
+	/// TERNARYLOGIC_PERF defined every call is measured with the hardware counters, see dump_counters
+	/// </summary>
+	template<typename T>
+	void ternary(T* dst, const T* a, const T* b, const T* c, const size_t n, const bf_type k) noexcept
+	{
+		profile::count<T>(k, n);
+#ifdef TERNARYLOGIC_PERF
+		priv::perf_table& t = priv::get_perf_table();
+		const perf::scope s(t.entries[static_cast<size_t>(isa_of<T>::value)][k & 0xFF], n, n * sizeof(T), &t.mutex);
+#endif
+		get_kernel<T>(k, goal_of(n))(dst, a, b, c, n);
+	}
+
+	/// <summary>
+	/// Kernel that evaluates one ternary function in the 64-bit words of n consecutive elements that a bitmap selects
+	/// </summary>
+	template<typename T>
+	using mask_kernel = void (*)(T* dst, const uint64_t* mask, const T* a, const T* b, const T* c, size_t n) noexcept;
+
+	/// <summary>
+	/// Evaluate Boolean Function K in the 64-bit words of dst that the bitmap mask selects, bit j for word j, over n
+	/// elements of a, b and c; the other words of dst are not changed, dst may be one of the inputs. The bitmap has a bit
+	/// for every word of the n elements, the words that a zero word of it covers are skipped
+	/// </summary>
+	template<bf_type K, typename T>
+	void ternary_mask(T* dst, const uint64_t* mask, const T* a, const T* b, const T* c, const size_t n) noexcept
+	{
+		static_assert((sizeof(T) % sizeof(uint64_t)) == 0, "Elements of whole 64-bit words");
+		constexpr size_t words = sizeof(T) / sizeof(uint64_t);
+		constexpr uint64_t lanes = (static_cast<uint64_t>(1) << words) - 1;
+		for (size_t i = 0; i < n;) {
+			const size_t j = i * words;
+			const uint64_t m = mask[j / 64];
+			if (((j % 64) == 0) && (m == 0)) {
+				i += 64 / words;
+				continue;
+			}
+			const unsigned k = static_cast<unsigned>((m >> (j % 64)) & lanes);
+			if constexpr (std::is_integral_v<T>) {
+				if (k != 0) dst[i] = ternarylogic::ternary<K>(a[i], b[i], c[i]);
+			}
+			else {
+				dst[i] = ternarylogic::ternary_mask<K, uint64_t>(dst[i], k, a[i], b[i], c[i]);
+			}
+			++i;
+		}
+	}
+
+	namespace priv
+	{
+		template<typename T, size_t... K>
+		[[nodiscard]] constexpr std::array<mask_kernel<T>, 256> make_mask_kernels(std::index_sequence<K...>) noexcept
+		{
+			return { { &bulk::ternary_mask<K, T>... } };
+		}
+	}
+
+	/// <summary>
+	/// Get the masked kernel of the provided Boolean Function, see get_kernel
+	/// </summary>
+	template<typename T>
+	[[nodiscard]] inline mask_kernel<T> get_mask_kernel(const bf_type k) noexcept
+	{
+		static constexpr std::array<mask_kernel<T>, 256> kernels = priv::make_mask_kernels<T>(std::make_index_sequence<256>());
+		return kernels[k & 0xFF];
+	}
+
+	/// <summary>
+	/// Evaluate Boolean Function k in the 64-bit words of dst that the bitmap mask selects, see ternary_mask<K>
+	/// </summary>
+	template<typename T>
+	void ternary_mask(T* dst, const uint64_t* mask, const T* a, const T* b, const T* c, const size_t n, const bf_type k) noexcept
+	{
+		profile::count<T>(k, n);
+		get_mask_kernel<T>(k)(dst, mask, a, b, c, n);
+	}
+
+	/// <summary>
+	/// Write the counters of the measured calls as csv (isa,k,calls,bytes,vectors and the rates of every event per byte
+	/// and per vector); empty unless TERNARYLOGIC_PERF is defined
+	/// </summary>
+	inline void dump_counters(std::ostream& os)
+	{
+		priv::perf_table& t = priv::get_perf_table();
+		const std::lock_guard<std::mutex> lock(t.mutex);
+		os << "isa,k,calls,bytes,vectors";
+		perf::write_rate_header(os);
+		os << std::endl;
+		for (size_t i = 0; i < n_isa; ++i) {
+			for (size_t k = 0; k < 256; ++k) {
+				const perf::totals& e = t.entries[i][k];
+				if (e.calls == 0) continue;
+				char head[64];
+				std::snprintf(head, sizeof(head), "%s,0x%02x,", isa_name(static_cast<isa>(i)), static_cast<unsigned>(k));
+				os << head << e.calls << "," << e.bytes << "," << e.vectors;
+				perf::write_rates(os, e);
+				os << std::endl;
+			}
+		}
+	}
+
+	inline void reset_counters()
+	{
+		priv::perf_table& t = priv::get_perf_table();
+		const std::lock_guard<std::mutex> lock(t.mutex);
+		for (auto& row : t.entries) {
+			for (perf::totals& e : row) e = perf::totals{};
+		}
+	}
+
+	namespace test
+	{
+		template<typename T>
+		[[nodiscard]] inline bool mask_equals_reference()
+		{
+			constexpr size_t n = 200;
+			constexpr size_t words = sizeof(T) / sizeof(uint64_t);
+			constexpr size_t n_words = n * words;
+			auto random_word = [] { return (static_cast<uint64_t>(rand()) << 40) ^ (static_cast<uint64_t>(rand()) << 20) ^ static_cast<uint64_t>(rand()); };
+
+			std::vector<uint64_t> a(n_words), b(n_words), c(n_words), src(n_words), mask((n_words + 63) / 64);
+			for (size_t i = 0; i < n_words; ++i) {
+				a[i] = random_word();
+				b[i] = random_word();
+				c[i] = random_word();
+				src[i] = random_word();
+			}
+			// sparse, with whole words of the bitmap zero
+			for (uint64_t& m : mask) m = (rand() % 3 == 0) ? 0 : (random_word() & random_word());
+
+			std::vector<T> x(n), y(n), z(n), dst(n);
+			std::memcpy(x.data(), a.data(), n_words * sizeof(uint64_t));
+			std::memcpy(y.data(), b.data(), n_words * sizeof(uint64_t));
+			std::memcpy(z.data(), c.data(), n_words * sizeof(uint64_t));
+
+			bool equal = true;
+			for (bf_type k = 0; k < 256; ++k) {
+				std::memcpy(dst.data(), src.data(), n_words * sizeof(uint64_t));
+				if (k == 0xE8) bulk::ternary_mask<0xE8>(dst.data(), mask.data(), x.data(), y.data(), z.data(), n);
+				else bulk::ternary_mask(dst.data(), mask.data(), x.data(), y.data(), z.data(), n, k);
+
+				std::vector<uint64_t> r(n_words);
+				std::memcpy(r.data(), dst.data(), n_words * sizeof(uint64_t));
+				for (size_t j = 0; j < n_words; ++j) {
+					const bool selected = ((mask[j / 64] >> (j % 64)) & 1) != 0;
+					equal = equal && (r[j] == (selected ? reference::vpternlog(a[j], b[j], c[j], k) : src[j]));
+				}
+			}
+			return equal;
+		}
+
+		inline void tests()
+		{
+			std::cout << "ternarylogic::bulk::test::tests" << std::endl;
+
+			bool equal = mask_equals_reference<uint64_t>() && mask_equals_reference<__m128i>() && mask_equals_reference<__m256i>();
+#ifdef __AVX512F__
+			equal = equal && mask_equals_reference<__m512i>();
+#endif
+			if (!equal) {
+				std::cout << "ERROR: bulk::ternary_mask" << std::endl;
+			}
+			else {
+				std::cout << "ternarylogic::bulk::tests: No errors found!" << std::endl;
+			}
+		}
+	}
+}
@@ -0,0 +1,107 @@
+#pragma once
+// Portability between MSVC and GCC or Clang: the intrinsics, __forceinline, cpuid, bit scans and the lanes of vectors.
+// C++11, the validate programs and the generated kernels include it.
+#include <cstddef>
+#include <cstdint>
+#include <cstring>		// for memcpy
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <immintrin.h>
+#include <x86intrin.h>	// for __rdtsc
+#include <cpuid.h>
+#endif
+
+// MSVC keyword; GCC and Clang inline a function on request only with the attribute
+#if !defined(_MSC_VER) && !defined(__forceinline)
+#define __forceinline inline __attribute__((always_inline))
+#endif
+
+namespace ternarylogic {
+
+	namespace compat {
+
+		/// <summary>
+		/// The registers eax, ebx, ecx, edx of cpuid leaf (sub-leaf 0) in info, as __cpuid of MSVC
+		/// </summary>
+		inline void cpuid(int info[4], const int leaf) noexcept
+		{
+#ifdef _MSC_VER
+			__cpuid(info, leaf);
+#else
+			unsigned eax = 0;
+			unsigned ebx = 0;
+			unsigned ecx = 0;
+			unsigned edx = 0;
+			__cpuid_count(static_cast<unsigned>(leaf), 0, eax, ebx, ecx, edx);
+			info[0] = static_cast<int>(eax);
+			info[1] = static_cast<int>(ebx);
+			info[2] = static_cast<int>(ecx);
+			info[3] = static_cast<int>(edx);
+#endif
+		}
+
+		/// <summary>
+		/// Index of the lowest set bit of x, which is not zero
+		/// </summary>
+		inline unsigned ctz64(const uint64_t x) noexcept
+		{
+#ifdef _MSC_VER
+			unsigned long i = 0;
+			_BitScanForward64(&i, x);
+			return static_cast<unsigned>(i);
+#else
+			return static_cast<unsigned>(__builtin_ctzll(x));
+#endif
+		}
+
+		/// <summary>
+		/// Byte i of a vector, for the union members m128i_u8, m256i_u8 and m512i_u8 that only MSVC has
+		/// </summary>
+		inline uint8_t lane_u8(const __m128i& v, const size_t i) noexcept
+		{
+			uint8_t lanes[sizeof(__m128i)];
+			std::memcpy(lanes, &v, sizeof(lanes));
+			return lanes[i];
+		}
+
+		inline uint8_t lane_u8(const __m256i& v, const size_t i) noexcept
+		{
+			uint8_t lanes[sizeof(__m256i)];
+			std::memcpy(lanes, &v, sizeof(lanes));
+			return lanes[i];
+		}
+
+		inline uint8_t lane_u8(const __m512i& v, const size_t i) noexcept
+		{
+			uint8_t lanes[sizeof(__m512i)];
+			std::memcpy(lanes, &v, sizeof(lanes));
+			return lanes[i];
+		}
+
+		/// <summary>
+		/// Quadword i of a vector, for the union members m128i_u64, m256i_u64 and m512i_u64
+		/// </summary>
+		inline uint64_t lane_u64(const __m128i& v, const size_t i) noexcept
+		{
+			uint64_t lanes[sizeof(__m128i) / 8];
+			std::memcpy(lanes, &v, sizeof(lanes));
+			return lanes[i];
+		}
+
+		inline uint64_t lane_u64(const __m256i& v, const size_t i) noexcept
+		{
+			uint64_t lanes[sizeof(__m256i) / 8];
+			std::memcpy(lanes, &v, sizeof(lanes));
+			return lanes[i];
+		}
+
+		inline uint64_t lane_u64(const __m512i& v, const size_t i) noexcept
+		{
+			uint64_t lanes[sizeof(__m512i) / 8];
+			std::memcpy(lanes, &v, sizeof(lanes));
+			return lanes[i];
+		}
+	}
+}
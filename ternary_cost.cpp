@@ -0,0 +1,3661 @@
+// Generated automatically, please do not edit
+#pragma once
+#include <cstdint>
+
+namespace ternarylogic {
+
+    // cost of the generated kernel of one function
+    struct kernel_cost {
+        uint8_t instructions;   // instructions, without constants and the return
+        uint8_t depth;          // longest chain of dependent instructions
+        uint8_t constants;      // materialised constants (all zeros, all ones)
+        uint8_t operands;       // used inputs: 1 = A, 2 = B, 4 = C
+    };
+
+    namespace costs {
+
+        // kernels of ternary_x86_32.cpp
+        constexpr kernel_cost x86_32[256] = {
+            { 0, 0, 1, 0 }, // 0x00
+            { 3, 3, 0, 7 }, // 0x01
+            { 3, 3, 0, 7 }, // 0x02
+            { 2, 2, 0, 3 }, // 0x03
+            { 3, 3, 0, 7 }, // 0x04
+            { 2, 2, 0, 5 }, // 0x05
+            { 3, 2, 0, 7 }, // 0x06
+            { 3, 3, 0, 7 }, // 0x07
+            { 3, 2, 0, 7 }, // 0x08
+            { 3, 3, 0, 7 }, // 0x09
+            { 2, 2, 0, 5 }, // 0x0a
+            { 4, 3, 0, 7 }, // 0x0b
+            { 2, 2, 0, 3 }, // 0x0c
+            { 4, 3, 0, 7 }, // 0x0d
+            { 3, 2, 0, 7 }, // 0x0e
+            { 1, 1, 0, 1 }, // 0x0f
+            { 3, 3, 0, 7 }, // 0x10
+            { 2, 2, 0, 6 }, // 0x11
+            { 3, 2, 0, 7 }, // 0x12
+            { 3, 3, 0, 7 }, // 0x13
+            { 3, 2, 0, 7 }, // 0x14
+            { 3, 3, 0, 7 }, // 0x15
+            { 4, 3, 0, 7 }, // 0x16
+            { 4, 3, 0, 7 }, // 0x17
+            { 3, 2, 0, 7 }, // 0x18
+            { 4, 3, 0, 7 }, // 0x19
+            { 3, 3, 0, 7 }, // 0x1a
+            { 4, 3, 0, 7 }, // 0x1b
+            { 3, 3, 0, 7 }, // 0x1c
+            { 4, 3, 0, 7 }, // 0x1d
+            { 2, 2, 0, 7 }, // 0x1e
+            { 3, 3, 0, 7 }, // 0x1f
+            { 3, 2, 0, 7 }, // 0x20
+            { 3, 3, 0, 7 }, // 0x21
+            { 2, 2, 0, 6 }, // 0x22
+            { 4, 3, 0, 7 }, // 0x23
+            { 3, 2, 0, 7 }, // 0x24
+            { 4, 3, 0, 7 }, // 0x25
+            { 3, 3, 0, 7 }, // 0x26
+            { 4, 3, 0, 7 }, // 0x27
+            { 2, 2, 0, 7 }, // 0x28
+            { 5, 3, 0, 7 }, // 0x29
+            { 3, 3, 0, 7 }, // 0x2a
+            { 5, 3, 0, 7 }, // 0x2b
+            { 3, 2, 0, 7 }, // 0x2c
+            { 3, 3, 0, 7 }, // 0x2d
+            { 3, 2, 0, 7 }, // 0x2e
+            { 4, 3, 0, 7 }, // 0x2f
+            { 2, 2, 0, 3 }, // 0x30
+            { 4, 3, 0, 7 }, // 0x31
+            { 3, 2, 0, 7 }, // 0x32
+            { 1, 1, 0, 2 }, // 0x33
+            { 3, 3, 0, 7 }, // 0x34
+            { 4, 3, 0, 7 }, // 0x35
+            { 2, 2, 0, 7 }, // 0x36
+            { 3, 3, 0, 7 }, // 0x37
+            { 3, 2, 0, 7 }, // 0x38
+            { 3, 3, 0, 7 }, // 0x39
+            { 3, 2, 0, 7 }, // 0x3a
+            { 4, 3, 0, 7 }, // 0x3b
+            { 1, 1, 0, 3 }, // 0x3c
+            { 4, 3, 0, 7 }, // 0x3d
+            { 4, 3, 0, 7 }, // 0x3e
+            { 2, 2, 0, 3 }, // 0x3f
+            { 3, 2, 0, 7 }, // 0x40
+            { 3, 3, 0, 7 }, // 0x41
+            { 3, 2, 0, 7 }, // 0x42
+            { 4, 3, 0, 7 }, // 0x43
+            { 2, 2, 0, 6 }, // 0x44
+            { 4, 3, 0, 7 }, // 0x45
+            { 3, 3, 0, 7 }, // 0x46
+            { 4, 3, 0, 7 }, // 0x47
+            { 2, 2, 0, 7 }, // 0x48
+            { 5, 3, 0, 7 }, // 0x49
+            { 3, 2, 0, 7 }, // 0x4a
+            { 3, 3, 0, 7 }, // 0x4b
+            { 3, 3, 0, 7 }, // 0x4c
+            { 5, 3, 0, 7 }, // 0x4d
+            { 3, 2, 0, 7 }, // 0x4e
+            { 4, 3, 0, 7 }, // 0x4f
+            { 2, 2, 0, 5 }, // 0x50
+            { 4, 3, 0, 7 }, // 0x51
+            { 3, 3, 0, 7 }, // 0x52
+            { 4, 3, 0, 7 }, // 0x53
+            { 3, 2, 0, 7 }, // 0x54
+            { 1, 1, 0, 4 }, // 0x55
+            { 2, 2, 0, 7 }, // 0x56
+            { 3, 3, 0, 7 }, // 0x57
+            { 3, 2, 0, 7 }, // 0x58
+            { 3, 3, 0, 7 }, // 0x59
+            { 1, 1, 0, 5 }, // 0x5a
+            { 4, 3, 0, 7 }, // 0x5b
+            { 3, 2, 0, 7 }, // 0x5c
+            { 4, 3, 0, 7 }, // 0x5d
+            { 4, 3, 0, 7 }, // 0x5e
+            { 2, 2, 0, 5 }, // 0x5f
+            { 2, 2, 0, 7 }, // 0x60
+            { 5, 3, 0, 7 }, // 0x61
+            { 3, 2, 0, 7 }, // 0x62
+            { 3, 3, 0, 7 }, // 0x63
+            { 3, 2, 0, 7 }, // 0x64
+            { 3, 3, 0, 7 }, // 0x65
+            { 1, 1, 0, 6 }, // 0x66
+            { 4, 3, 0, 7 }, // 0x67
+            { 4, 3, 0, 7 }, // 0x68
+            { 3, 2, 0, 7 }, // 0x69
+            { 2, 2, 0, 7 }, // 0x6a
+            { 5, 3, 0, 7 }, // 0x6b
+            { 2, 2, 0, 7 }, // 0x6c
+            { 5, 3, 0, 7 }, // 0x6d
+            { 4, 3, 0, 7 }, // 0x6e
+            { 3, 2, 0, 7 }, // 0x6f
+            { 3, 3, 0, 7 }, // 0x70
+            { 5, 3, 0, 7 }, // 0x71
+            { 3, 2, 0, 7 }, // 0x72
+            { 4, 3, 0, 7 }, // 0x73
+            { 3, 2, 0, 7 }, // 0x74
+            { 4, 3, 0, 7 }, // 0x75
+            { 4, 3, 0, 7 }, // 0x76
+            { 2, 2, 0, 6 }, // 0x77
+            { 2, 2, 0, 7 }, // 0x78
+            { 5, 3, 0, 7 }, // 0x79
+            { 4, 3, 0, 7 }, // 0x7a
+            { 3, 2, 0, 7 }, // 0x7b
+            { 4, 3, 0, 7 }, // 0x7c
+            { 3, 2, 0, 7 }, // 0x7d
+            { 3, 2, 0, 7 }, // 0x7e
+            { 3, 3, 0, 7 }, // 0x7f
+            { 2, 2, 0, 7 }, // 0x80
+            { 4, 3, 0, 7 }, // 0x81
+            { 3, 3, 0, 7 }, // 0x82
+            { 4, 3, 0, 7 }, // 0x83
+            { 3, 3, 0, 7 }, // 0x84
+            { 4, 3, 0, 7 }, // 0x85
+            { 4, 3, 0, 7 }, // 0x86
+            { 3, 2, 0, 7 }, // 0x87
+            { 1, 1, 0, 6 }, // 0x88
+            { 4, 4, 0, 7 }, // 0x89
+            { 3, 3, 0, 7 }, // 0x8a
+            { 4, 3, 0, 7 }, // 0x8b
+            { 3, 3, 0, 7 }, // 0x8c
+            { 4, 3, 0, 7 }, // 0x8d
+            { 4, 3, 0, 7 }, // 0x8e
+            { 3, 2, 0, 7 }, // 0x8f
+            { 3, 3, 0, 7 }, // 0x90
+            { 4, 3, 0, 7 }, // 0x91
+            { 4, 3, 0, 7 }, // 0x92
+            { 3, 2, 0, 7 }, // 0x93
+            { 4, 3, 0, 7 }, // 0x94
+            { 3, 2, 0, 7 }, // 0x95
+            { 2, 2, 0, 7 }, // 0x96
+            { 5, 3, 0, 7 }, // 0x97
+            { 4, 3, 0, 7 }, // 0x98
+            { 2, 2, 0, 6 }, // 0x99
+            { 3, 2, 0, 7 }, // 0x9a
+            { 4, 3, 0, 7 }, // 0x9b
+            { 3, 2, 0, 7 }, // 0x9c
+            { 4, 3, 0, 7 }, // 0x9d
+            { 4, 3, 0, 7 }, // 0x9e
+            { 3, 3, 0, 7 }, // 0x9f
+            { 1, 1, 0, 5 }, // 0xa0
+            { 4, 4, 0, 7 }, // 0xa1
+            { 3, 3, 0, 7 }, // 0xa2
+            { 4, 3, 0, 7 }, // 0xa3
+            { 4, 3, 0, 7 }, // 0xa4
+            { 2, 2, 0, 5 }, // 0xa5
+            { 3, 2, 0, 7 }, // 0xa6
+            { 4, 3, 0, 7 }, // 0xa7
+            { 2, 2, 0, 7 }, // 0xa8
+            { 3, 2, 0, 7 }, // 0xa9
+            { 0, 0, 0, 4 }, // 0xaa
+            { 3, 3, 0, 7 }, // 0xab
+            { 3, 3, 0, 7 }, // 0xac
+            { 4, 3, 0, 7 }, // 0xad
+            { 3, 3, 0, 7 }, // 0xae
+            { 2, 2, 0, 5 }, // 0xaf
+            { 3, 3, 0, 7 }, // 0xb0
+            { 4, 3, 0, 7 }, // 0xb1
+            { 4, 3, 0, 7 }, // 0xb2
+            { 3, 2, 0, 7 }, // 0xb3
+            { 3, 2, 0, 7 }, // 0xb4
+            { 4, 3, 0, 7 }, // 0xb5
+            { 4, 3, 0, 7 }, // 0xb6
+            { 3, 3, 0, 7 }, // 0xb7
+            { 3, 3, 0, 7 }, // 0xb8
+            { 4, 3, 0, 7 }, // 0xb9
+            { 3, 3, 0, 7 }, // 0xba
+            { 2, 2, 0, 6 }, // 0xbb
+            { 3, 2, 0, 7 }, // 0xbc
+            { 4, 3, 0, 7 }, // 0xbd
+            { 2, 2, 0, 7 }, // 0xbe
+            { 3, 3, 0, 7 }, // 0xbf
+            { 1, 1, 0, 3 }, // 0xc0
+            { 4, 4, 0, 7 }, // 0xc1
+            { 4, 3, 0, 7 }, // 0xc2
+            { 2, 2, 0, 3 }, // 0xc3
+            { 3, 3, 0, 7 }, // 0xc4
+            { 4, 3, 0, 7 }, // 0xc5
+            { 3, 2, 0, 7 }, // 0xc6
+            { 4, 3, 0, 7 }, // 0xc7
+            { 2, 2, 0, 7 }, // 0xc8
+            { 3, 2, 0, 7 }, // 0xc9
+            { 3, 3, 0, 7 }, // 0xca
+            { 4, 3, 0, 7 }, // 0xcb
+            { 0, 0, 0, 2 }, // 0xcc
+            { 3, 3, 0, 7 }, // 0xcd
+            { 3, 3, 0, 7 }, // 0xce
+            { 2, 2, 0, 3 }, // 0xcf
+            { 3, 3, 0, 7 }, // 0xd0
+            { 4, 3, 0, 7 }, // 0xd1
+            { 3, 2, 0, 7 }, // 0xd2
+            { 4, 3, 0, 7 }, // 0xd3
+            { 4, 3, 0, 7 }, // 0xd4
+            { 3, 2, 0, 7 }, // 0xd5
+            { 4, 3, 0, 7 }, // 0xd6
+            { 3, 3, 0, 7 }, // 0xd7
+            { 3, 3, 0, 7 }, // 0xd8
+            { 4, 3, 0, 7 }, // 0xd9
+            { 3, 2, 0, 7 }, // 0xda
+            { 4, 3, 0, 7 }, // 0xdb
+            { 3, 3, 0, 7 }, // 0xdc
+            { 2, 2, 0, 6 }, // 0xdd
+            { 2, 2, 0, 7 }, // 0xde
+            { 3, 3, 0, 7 }, // 0xdf
+            { 2, 2, 0, 7 }, // 0xe0
+            { 3, 2, 0, 7 }, // 0xe1
+            { 3, 3, 0, 7 }, // 0xe2
+            { 4, 3, 0, 7 }, // 0xe3
+            { 3, 3, 0, 7 }, // 0xe4
+            { 4, 3, 0, 7 }, // 0xe5
+            { 3, 2, 0, 7 }, // 0xe6
+            { 4, 3, 0, 7 }, // 0xe7
+            { 4, 3, 0, 7 }, // 0xe8
+            { 5, 3, 0, 7 }, // 0xe9
+            { 2, 2, 0, 7 }, // 0xea
+            { 3, 3, 0, 7 }, // 0xeb
+            { 2, 2, 0, 7 }, // 0xec
+            { 3, 3, 0, 7 }, // 0xed
+            { 1, 1, 0, 6 }, // 0xee
+            { 3, 2, 0, 7 }, // 0xef
+            { 0, 0, 0, 1 }, // 0xf0
+            { 3, 3, 0, 7 }, // 0xf1
+            { 3, 3, 0, 7 }, // 0xf2
+            { 2, 2, 0, 3 }, // 0xf3
+            { 3, 3, 0, 7 }, // 0xf4
+            { 2, 2, 0, 5 }, // 0xf5
+            { 2, 2, 0, 7 }, // 0xf6
+            { 3, 3, 0, 7 }, // 0xf7
+            { 2, 2, 0, 7 }, // 0xf8
+            { 3, 3, 0, 7 }, // 0xf9
+            { 1, 1, 0, 5 }, // 0xfa
+            { 3, 2, 0, 7 }, // 0xfb
+            { 1, 1, 0, 3 }, // 0xfc
+            { 3, 2, 0, 7 }, // 0xfd
+            { 2, 2, 0, 7 }, // 0xfe
+            { 0, 0, 1, 0 }, // 0xff
+        };
+
+        // kernels of ternary_x86_64.cpp
+        constexpr kernel_cost x86_64[256] = {
+            { 0, 0, 1, 0 }, // 0x00
+            { 3, 3, 0, 7 }, // 0x01
+            { 3, 3, 0, 7 }, // 0x02
+            { 2, 2, 0, 3 }, // 0x03
+            { 3, 3, 0, 7 }, // 0x04
+            { 2, 2, 0, 5 }, // 0x05
+            { 3, 2, 0, 7 }, // 0x06
+            { 3, 3, 0, 7 }, // 0x07
+            { 3, 2, 0, 7 }, // 0x08
+            { 3, 3, 0, 7 }, // 0x09
+            { 2, 2, 0, 5 }, // 0x0a
+            { 4, 3, 0, 7 }, // 0x0b
+            { 2, 2, 0, 3 }, // 0x0c
+            { 4, 3, 0, 7 }, // 0x0d
+            { 3, 2, 0, 7 }, // 0x0e
+            { 1, 1, 0, 1 }, // 0x0f
+            { 3, 3, 0, 7 }, // 0x10
+            { 2, 2, 0, 6 }, // 0x11
+            { 3, 2, 0, 7 }, // 0x12
+            { 3, 3, 0, 7 }, // 0x13
+            { 3, 2, 0, 7 }, // 0x14
+            { 3, 3, 0, 7 }, // 0x15
+            { 4, 3, 0, 7 }, // 0x16
+            { 4, 3, 0, 7 }, // 0x17
+            { 3, 2, 0, 7 }, // 0x18
+            { 4, 3, 0, 7 }, // 0x19
+            { 3, 3, 0, 7 }, // 0x1a
+            { 4, 3, 0, 7 }, // 0x1b
+            { 3, 3, 0, 7 }, // 0x1c
+            { 4, 3, 0, 7 }, // 0x1d
+            { 2, 2, 0, 7 }, // 0x1e
+            { 3, 3, 0, 7 }, // 0x1f
+            { 3, 2, 0, 7 }, // 0x20
+            { 3, 3, 0, 7 }, // 0x21
+            { 2, 2, 0, 6 }, // 0x22
+            { 4, 3, 0, 7 }, // 0x23
+            { 3, 2, 0, 7 }, // 0x24
+            { 4, 3, 0, 7 }, // 0x25
+            { 3, 3, 0, 7 }, // 0x26
+            { 4, 3, 0, 7 }, // 0x27
+            { 2, 2, 0, 7 }, // 0x28
+            { 5, 3, 0, 7 }, // 0x29
+            { 3, 3, 0, 7 }, // 0x2a
+            { 5, 3, 0, 7 }, // 0x2b
+            { 3, 2, 0, 7 }, // 0x2c
+            { 3, 3, 0, 7 }, // 0x2d
+            { 3, 2, 0, 7 }, // 0x2e
+            { 4, 3, 0, 7 }, // 0x2f
+            { 2, 2, 0, 3 }, // 0x30
+            { 4, 3, 0, 7 }, // 0x31
+            { 3, 2, 0, 7 }, // 0x32
+            { 1, 1, 0, 2 }, // 0x33
+            { 3, 3, 0, 7 }, // 0x34
+            { 4, 3, 0, 7 }, // 0x35
+            { 2, 2, 0, 7 }, // 0x36
+            { 3, 3, 0, 7 }, // 0x37
+            { 3, 2, 0, 7 }, // 0x38
+            { 3, 3, 0, 7 }, // 0x39
+            { 3, 2, 0, 7 }, // 0x3a
+            { 4, 3, 0, 7 }, // 0x3b
+            { 1, 1, 0, 3 }, // 0x3c
+            { 4, 3, 0, 7 }, // 0x3d
+            { 4, 3, 0, 7 }, // 0x3e
+            { 2, 2, 0, 3 }, // 0x3f
+            { 3, 2, 0, 7 }, // 0x40
+            { 3, 3, 0, 7 }, // 0x41
+            { 3, 2, 0, 7 }, // 0x42
+            { 4, 3, 0, 7 }, // 0x43
+            { 2, 2, 0, 6 }, // 0x44
+            { 4, 3, 0, 7 }, // 0x45
+            { 3, 3, 0, 7 }, // 0x46
+            { 4, 3, 0, 7 }, // 0x47
+            { 2, 2, 0, 7 }, // 0x48
+            { 5, 3, 0, 7 }, // 0x49
+            { 3, 2, 0, 7 }, // 0x4a
+            { 3, 3, 0, 7 }, // 0x4b
+            { 3, 3, 0, 7 }, // 0x4c
+            { 5, 3, 0, 7 }, // 0x4d
+            { 3, 2, 0, 7 }, // 0x4e
+            { 4, 3, 0, 7 }, // 0x4f
+            { 2, 2, 0, 5 }, // 0x50
+            { 4, 3, 0, 7 }, // 0x51
+            { 3, 3, 0, 7 }, // 0x52
+            { 4, 3, 0, 7 }, // 0x53
+            { 3, 2, 0, 7 }, // 0x54
+            { 1, 1, 0, 4 }, // 0x55
+            { 2, 2, 0, 7 }, // 0x56
+            { 3, 3, 0, 7 }, // 0x57
+            { 3, 2, 0, 7 }, // 0x58
+            { 3, 3, 0, 7 }, // 0x59
+            { 1, 1, 0, 5 }, // 0x5a
+            { 4, 3, 0, 7 }, // 0x5b
+            { 3, 2, 0, 7 }, // 0x5c
+            { 4, 3, 0, 7 }, // 0x5d
+            { 4, 3, 0, 7 }, // 0x5e
+            { 2, 2, 0, 5 }, // 0x5f
+            { 2, 2, 0, 7 }, // 0x60
+            { 5, 3, 0, 7 }, // 0x61
+            { 3, 2, 0, 7 }, // 0x62
+            { 3, 3, 0, 7 }, // 0x63
+            { 3, 2, 0, 7 }, // 0x64
+            { 3, 3, 0, 7 }, // 0x65
+            { 1, 1, 0, 6 }, // 0x66
+            { 4, 3, 0, 7 }, // 0x67
+            { 4, 3, 0, 7 }, // 0x68
+            { 3, 2, 0, 7 }, // 0x69
+            { 2, 2, 0, 7 }, // 0x6a
+            { 5, 3, 0, 7 }, // 0x6b
+            { 2, 2, 0, 7 }, // 0x6c
+            { 5, 3, 0, 7 }, // 0x6d
+            { 4, 3, 0, 7 }, // 0x6e
+            { 3, 2, 0, 7 }, // 0x6f
+            { 3, 3, 0, 7 }, // 0x70
+            { 5, 3, 0, 7 }, // 0x71
+            { 3, 2, 0, 7 }, // 0x72
+            { 4, 3, 0, 7 }, // 0x73
+            { 3, 2, 0, 7 }, // 0x74
+            { 4, 3, 0, 7 }, // 0x75
+            { 4, 3, 0, 7 }, // 0x76
+            { 2, 2, 0, 6 }, // 0x77
+            { 2, 2, 0, 7 }, // 0x78
+            { 5, 3, 0, 7 }, // 0x79
+            { 4, 3, 0, 7 }, // 0x7a
+            { 3, 2, 0, 7 }, // 0x7b
+            { 4, 3, 0, 7 }, // 0x7c
+            { 3, 2, 0, 7 }, // 0x7d
+            { 3, 2, 0, 7 }, // 0x7e
+            { 3, 3, 0, 7 }, // 0x7f
+            { 2, 2, 0, 7 }, // 0x80
+            { 4, 3, 0, 7 }, // 0x81
+            { 3, 3, 0, 7 }, // 0x82
+            { 4, 3, 0, 7 }, // 0x83
+            { 3, 3, 0, 7 }, // 0x84
+            { 4, 3, 0, 7 }, // 0x85
+            { 4, 3, 0, 7 }, // 0x86
+            { 3, 2, 0, 7 }, // 0x87
+            { 1, 1, 0, 6 }, // 0x88
+            { 4, 4, 0, 7 }, // 0x89
+            { 3, 3, 0, 7 }, // 0x8a
+            { 4, 3, 0, 7 }, // 0x8b
+            { 3, 3, 0, 7 }, // 0x8c
+            { 4, 3, 0, 7 }, // 0x8d
+            { 4, 3, 0, 7 }, // 0x8e
+            { 3, 2, 0, 7 }, // 0x8f
+            { 3, 3, 0, 7 }, // 0x90
+            { 4, 3, 0, 7 }, // 0x91
+            { 4, 3, 0, 7 }, // 0x92
+            { 3, 2, 0, 7 }, // 0x93
+            { 4, 3, 0, 7 }, // 0x94
+            { 3, 2, 0, 7 }, // 0x95
+            { 2, 2, 0, 7 }, // 0x96
+            { 5, 3, 0, 7 }, // 0x97
+            { 4, 3, 0, 7 }, // 0x98
+            { 2, 2, 0, 6 }, // 0x99
+            { 3, 2, 0, 7 }, // 0x9a
+            { 4, 3, 0, 7 }, // 0x9b
+            { 3, 2, 0, 7 }, // 0x9c
+            { 4, 3, 0, 7 }, // 0x9d
+            { 4, 3, 0, 7 }, // 0x9e
+            { 3, 3, 0, 7 }, // 0x9f
+            { 1, 1, 0, 5 }, // 0xa0
+            { 4, 4, 0, 7 }, // 0xa1
+            { 3, 3, 0, 7 }, // 0xa2
+            { 4, 3, 0, 7 }, // 0xa3
+            { 4, 3, 0, 7 }, // 0xa4
+            { 2, 2, 0, 5 }, // 0xa5
+            { 3, 2, 0, 7 }, // 0xa6
+            { 4, 3, 0, 7 }, // 0xa7
+            { 2, 2, 0, 7 }, // 0xa8
+            { 3, 2, 0, 7 }, // 0xa9
+            { 0, 0, 0, 4 }, // 0xaa
+            { 3, 3, 0, 7 }, // 0xab
+            { 3, 3, 0, 7 }, // 0xac
+            { 4, 3, 0, 7 }, // 0xad
+            { 3, 3, 0, 7 }, // 0xae
+            { 2, 2, 0, 5 }, // 0xaf
+            { 3, 3, 0, 7 }, // 0xb0
+            { 4, 3, 0, 7 }, // 0xb1
+            { 4, 3, 0, 7 }, // 0xb2
+            { 3, 2, 0, 7 }, // 0xb3
+            { 3, 2, 0, 7 }, // 0xb4
+            { 4, 3, 0, 7 }, // 0xb5
+            { 4, 3, 0, 7 }, // 0xb6
+            { 3, 3, 0, 7 }, // 0xb7
+            { 3, 3, 0, 7 }, // 0xb8
+            { 4, 3, 0, 7 }, // 0xb9
+            { 3, 3, 0, 7 }, // 0xba
+            { 2, 2, 0, 6 }, // 0xbb
+            { 3, 2, 0, 7 }, // 0xbc
+            { 4, 3, 0, 7 }, // 0xbd
+            { 2, 2, 0, 7 }, // 0xbe
+            { 3, 3, 0, 7 }, // 0xbf
+            { 1, 1, 0, 3 }, // 0xc0
+            { 4, 4, 0, 7 }, // 0xc1
+            { 4, 3, 0, 7 }, // 0xc2
+            { 2, 2, 0, 3 }, // 0xc3
+            { 3, 3, 0, 7 }, // 0xc4
+            { 4, 3, 0, 7 }, // 0xc5
+            { 3, 2, 0, 7 }, // 0xc6
+            { 4, 3, 0, 7 }, // 0xc7
+            { 2, 2, 0, 7 }, // 0xc8
+            { 3, 2, 0, 7 }, // 0xc9
+            { 3, 3, 0, 7 }, // 0xca
+            { 4, 3, 0, 7 }, // 0xcb
+            { 0, 0, 0, 2 }, // 0xcc
+            { 3, 3, 0, 7 }, // 0xcd
+            { 3, 3, 0, 7 }, // 0xce
+            { 2, 2, 0, 3 }, // 0xcf
+            { 3, 3, 0, 7 }, // 0xd0
+            { 4, 3, 0, 7 }, // 0xd1
+            { 3, 2, 0, 7 }, // 0xd2
+            { 4, 3, 0, 7 }, // 0xd3
+            { 4, 3, 0, 7 }, // 0xd4
+            { 3, 2, 0, 7 }, // 0xd5
+            { 4, 3, 0, 7 }, // 0xd6
+            { 3, 3, 0, 7 }, // 0xd7
+            { 3, 3, 0, 7 }, // 0xd8
+            { 4, 3, 0, 7 }, // 0xd9
+            { 3, 2, 0, 7 }, // 0xda
+            { 4, 3, 0, 7 }, // 0xdb
+            { 3, 3, 0, 7 }, // 0xdc
+            { 2, 2, 0, 6 }, // 0xdd
+            { 2, 2, 0, 7 }, // 0xde
+            { 3, 3, 0, 7 }, // 0xdf
+            { 2, 2, 0, 7 }, // 0xe0
+            { 3, 2, 0, 7 }, // 0xe1
+            { 3, 3, 0, 7 }, // 0xe2
+            { 4, 3, 0, 7 }, // 0xe3
+            { 3, 3, 0, 7 }, // 0xe4
+            { 4, 3, 0, 7 }, // 0xe5
+            { 3, 2, 0, 7 }, // 0xe6
+            { 4, 3, 0, 7 }, // 0xe7
+            { 4, 3, 0, 7 }, // 0xe8
+            { 5, 3, 0, 7 }, // 0xe9
+            { 2, 2, 0, 7 }, // 0xea
+            { 3, 3, 0, 7 }, // 0xeb
+            { 2, 2, 0, 7 }, // 0xec
+            { 3, 3, 0, 7 }, // 0xed
+            { 1, 1, 0, 6 }, // 0xee
+            { 3, 2, 0, 7 }, // 0xef
+            { 0, 0, 0, 1 }, // 0xf0
+            { 3, 3, 0, 7 }, // 0xf1
+            { 3, 3, 0, 7 }, // 0xf2
+            { 2, 2, 0, 3 }, // 0xf3
+            { 3, 3, 0, 7 }, // 0xf4
+            { 2, 2, 0, 5 }, // 0xf5
+            { 2, 2, 0, 7 }, // 0xf6
+            { 3, 3, 0, 7 }, // 0xf7
+            { 2, 2, 0, 7 }, // 0xf8
+            { 3, 3, 0, 7 }, // 0xf9
+            { 1, 1, 0, 5 }, // 0xfa
+            { 3, 2, 0, 7 }, // 0xfb
+            { 1, 1, 0, 3 }, // 0xfc
+            { 3, 2, 0, 7 }, // 0xfd
+            { 2, 2, 0, 7 }, // 0xfe
+            { 0, 0, 1, 0 }, // 0xff
+        };
+
+        // kernels of ternary_x86_32_bmi.cpp
+        constexpr kernel_cost x86_32_bmi[256] = {
+            { 0, 0, 1, 0 }, // 0x00
+            { 3, 2, 0, 7 }, // 0x01
+            { 2, 2, 0, 7 }, // 0x02
+            { 2, 2, 0, 3 }, // 0x03
+            { 2, 2, 0, 7 }, // 0x04
+            { 2, 2, 0, 5 }, // 0x05
+            { 2, 2, 0, 7 }, // 0x06
+            { 3, 2, 0, 7 }, // 0x07
+            { 2, 2, 0, 7 }, // 0x08
+            { 3, 2, 0, 7 }, // 0x09
+            { 1, 1, 0, 5 }, // 0x0a
+            { 3, 2, 0, 7 }, // 0x0b
+            { 1, 1, 0, 3 }, // 0x0c
+            { 3, 2, 0, 7 }, // 0x0d
+            { 2, 2, 0, 7 }, // 0x0e
+            { 1, 1, 0, 1 }, // 0x0f
+            { 2, 2, 0, 7 }, // 0x10
+            { 2, 2, 0, 6 }, // 0x11
+            { 2, 2, 0, 7 }, // 0x12
+            { 3, 2, 0, 7 }, // 0x13
+            { 2, 2, 0, 7 }, // 0x14
+            { 3, 2, 0, 7 }, // 0x15
+            { 4, 3, 0, 7 }, // 0x16
+            { 5, 3, 0, 7 }, // 0x17
+            { 3, 2, 0, 7 }, // 0x18
+            { 4, 3, 0, 7 }, // 0x19
+            { 3, 2, 0, 7 }, // 0x1a
+            { 4, 3, 0, 7 }, // 0x1b
+            { 3, 2, 0, 7 }, // 0x1c
+            { 4, 3, 0, 7 }, // 0x1d
+            { 2, 2, 0, 7 }, // 0x1e
+            { 3, 3, 0, 7 }, // 0x1f
+            { 2, 2, 0, 7 }, // 0x20
+            { 3, 2, 0, 7 }, // 0x21
+            { 1, 1, 0, 6 }, // 0x22
+            { 3, 2, 0, 7 }, // 0x23
+            { 3, 2, 0, 7 }, // 0x24
+            { 4, 3, 0, 7 }, // 0x25
+            { 3, 2, 0, 7 }, // 0x26
+            { 4, 3, 0, 7 }, // 0x27
+            { 2, 2, 0, 7 }, // 0x28
+            { 5, 3, 0, 7 }, // 0x29
+            { 2, 2, 0, 7 }, // 0x2a
+            { 5, 3, 0, 7 }, // 0x2b
+            { 3, 2, 0, 7 }, // 0x2c
+            { 3, 2, 0, 7 }, // 0x2d
+            { 3, 2, 0, 7 }, // 0x2e
+            { 3, 2, 0, 7 }, // 0x2f
+            { 1, 1, 0, 3 }, // 0x30
+            { 3, 2, 0, 7 }, // 0x31
+            { 2, 2, 0, 7 }, // 0x32
+            { 1, 1, 0, 2 }, // 0x33
+            { 3, 2, 0, 7 }, // 0x34
+            { 4, 3, 0, 7 }, // 0x35
+            { 2, 2, 0, 7 }, // 0x36
+            { 3, 3, 0, 7 }, // 0x37
+            { 3, 2, 0, 7 }, // 0x38
+            { 3, 2, 0, 7 }, // 0x39
+            { 3, 2, 0, 7 }, // 0x3a
+            { 3, 2, 0, 7 }, // 0x3b
+            { 1, 1, 0, 3 }, // 0x3c
+            { 4, 3, 0, 7 }, // 0x3d
+            { 3, 2, 0, 7 }, // 0x3e
+            { 2, 2, 0, 3 }, // 0x3f
+            { 2, 2, 0, 7 }, // 0x40
+            { 3, 2, 0, 7 }, // 0x41
+            { 3, 2, 0, 7 }, // 0x42
+            { 4, 3, 0, 7 }, // 0x43
+            { 1, 1, 0, 6 }, // 0x44
+            { 3, 2, 0, 7 }, // 0x45
+            { 3, 2, 0, 7 }, // 0x46
+            { 4, 3, 0, 7 }, // 0x47
+            { 2, 2, 0, 7 }, // 0x48
+            { 5, 3, 0, 7 }, // 0x49
+            { 3, 2, 0, 7 }, // 0x4a
+            { 3, 2, 0, 7 }, // 0x4b
+            { 2, 2, 0, 7 }, // 0x4c
+            { 5, 3, 0, 7 }, // 0x4d
+            { 3, 2, 0, 7 }, // 0x4e
+            { 3, 2, 0, 7 }, // 0x4f
+            { 1, 1, 0, 5 }, // 0x50
+            { 3, 2, 0, 7 }, // 0x51
+            { 3, 2, 0, 7 }, // 0x52
+            { 4, 3, 0, 7 }, // 0x53
+            { 2, 2, 0, 7 }, // 0x54
+            { 1, 1, 0, 4 }, // 0x55
+            { 2, 2, 0, 7 }, // 0x56
+            { 3, 3, 0, 7 }, // 0x57
+            { 3, 2, 0, 7 }, // 0x58
+            { 3, 2, 0, 7 }, // 0x59
+            { 1, 1, 0, 5 }, // 0x5a
+            { 4, 3, 0, 7 }, // 0x5b
+            { 3, 2, 0, 7 }, // 0x5c
+            { 3, 2, 0, 7 }, // 0x5d
+            { 3, 2, 0, 7 }, // 0x5e
+            { 2, 2, 0, 5 }, // 0x5f
+            { 2, 2, 0, 7 }, // 0x60
+            { 5, 3, 0, 7 }, // 0x61
+            { 3, 2, 0, 7 }, // 0x62
+            { 3, 2, 0, 7 }, // 0x63
+            { 3, 2, 0, 7 }, // 0x64
+            { 3, 2, 0, 7 }, // 0x65
+            { 1, 1, 0, 6 }, // 0x66
+            { 4, 3, 0, 7 }, // 0x67
+            { 4, 3, 0, 7 }, // 0x68
+            { 3, 2, 0, 7 }, // 0x69
+            { 2, 2, 0, 7 }, // 0x6a
+            { 5, 3, 0, 7 }, // 0x6b
+            { 2, 2, 0, 7 }, // 0x6c
+            { 5, 3, 0, 7 }, // 0x6d
+            { 3, 2, 0, 7 }, // 0x6e
+            { 3, 2, 0, 7 }, // 0x6f
+            { 2, 2, 0, 7 }, // 0x70
+            { 5, 3, 0, 7 }, // 0x71
+            { 3, 2, 0, 7 }, // 0x72
+            { 3, 2, 0, 7 }, // 0x73
+            { 3, 2, 0, 7 }, // 0x74
+            { 3, 2, 0, 7 }, // 0x75
+            { 3, 2, 0, 7 }, // 0x76
+            { 2, 2, 0, 6 }, // 0x77
+            { 2, 2, 0, 7 }, // 0x78
+            { 5, 3, 0, 7 }, // 0x79
+            { 3, 2, 0, 7 }, // 0x7a
+            { 3, 2, 0, 7 }, // 0x7b
+            { 3, 2, 0, 7 }, // 0x7c
+            { 3, 2, 0, 7 }, // 0x7d
+            { 3, 2, 0, 7 }, // 0x7e
+            { 3, 3, 0, 7 }, // 0x7f
+            { 2, 2, 0, 7 }, // 0x80
+            { 4, 3, 0, 7 }, // 0x81
+            { 2, 2, 0, 7 }, // 0x82
+            { 4, 3, 0, 7 }, // 0x83
+            { 2, 2, 0, 7 }, // 0x84
+            { 4, 3, 0, 7 }, // 0x85
+            { 4, 3, 0, 7 }, // 0x86
+            { 3, 2, 0, 7 }, // 0x87
+            { 1, 1, 0, 6 }, // 0x88
+            { 4, 3, 0, 7 }, // 0x89
+            { 2, 2, 0, 7 }, // 0x8a
+            { 4, 3, 0, 7 }, // 0x8b
+            { 2, 2, 0, 7 }, // 0x8c
+            { 4, 3, 0, 7 }, // 0x8d
+            { 4, 3, 0, 7 }, // 0x8e
+            { 3, 2, 0, 7 }, // 0x8f
+            { 2, 2, 0, 7 }, // 0x90
+            { 4, 3, 0, 7 }, // 0x91
+            { 4, 3, 0, 7 }, // 0x92
+            { 3, 2, 0, 7 }, // 0x93
+            { 4, 3, 0, 7 }, // 0x94
+            { 3, 2, 0, 7 }, // 0x95
+            { 2, 2, 0, 7 }, // 0x96
+            { 5, 3, 0, 7 }, // 0x97
+            { 3, 2, 0, 7 }, // 0x98
+            { 2, 2, 0, 6 }, // 0x99
+            { 2, 2, 0, 7 }, // 0x9a
+            { 4, 3, 0, 7 }, // 0x9b
+            { 2, 2, 0, 7 }, // 0x9c
+            { 4, 3, 0, 7 }, // 0x9d
+            { 4, 3, 0, 7 }, // 0x9e
+            { 3, 3, 0, 7 }, // 0x9f
+            { 1, 1, 0, 5 }, // 0xa0
+            { 4, 3, 0, 7 }, // 0xa1
+            { 2, 2, 0, 7 }, // 0xa2
+            { 4, 3, 0, 7 }, // 0xa3
+            { 3, 2, 0, 7 }, // 0xa4
+            { 2, 2, 0, 5 }, // 0xa5
+            { 2, 2, 0, 7 }, // 0xa6
+            { 4, 3, 0, 7 }, // 0xa7
+            { 2, 2, 0, 7 }, // 0xa8
+            { 3, 2, 0, 7 }, // 0xa9
+            { 0, 0, 0, 4 }, // 0xaa
+            { 3, 3, 0, 7 }, // 0xab
+            { 3, 2, 0, 7 }, // 0xac
+            { 4, 3, 0, 7 }, // 0xad
+            { 2, 2, 0, 7 }, // 0xae
+            { 2, 2, 0, 5 }, // 0xaf
+            { 2, 2, 0, 7 }, // 0xb0
+            { 4, 3, 0, 7 }, // 0xb1
+            { 4, 3, 0, 7 }, // 0xb2
+            { 3, 2, 0, 7 }, // 0xb3
+            { 2, 2, 0, 7 }, // 0xb4
+            { 4, 3, 0, 7 }, // 0xb5
+            { 4, 3, 0, 7 }, // 0xb6
+            { 3, 3, 0, 7 }, // 0xb7
+            { 3, 2, 0, 7 }, // 0xb8
+            { 4, 3, 0, 7 }, // 0xb9
+            { 2, 2, 0, 7 }, // 0xba
+            { 2, 2, 0, 6 }, // 0xbb
+            { 3, 2, 0, 7 }, // 0xbc
+            { 4, 3, 0, 7 }, // 0xbd
+            { 2, 2, 0, 7 }, // 0xbe
+            { 3, 3, 0, 7 }, // 0xbf
+            { 1, 1, 0, 3 }, // 0xc0
+            { 4, 3, 0, 7 }, // 0xc1
+            { 3, 2, 0, 7 }, // 0xc2
+            { 2, 2, 0, 3 }, // 0xc3
+            { 2, 2, 0, 7 }, // 0xc4
+            { 4, 3, 0, 7 }, // 0xc5
+            { 2, 2, 0, 7 }, // 0xc6
+            { 4, 3, 0, 7 }, // 0xc7
+            { 2, 2, 0, 7 }, // 0xc8
+            { 3, 2, 0, 7 }, // 0xc9
+            { 3, 2, 0, 7 }, // 0xca
+            { 4, 3, 0, 7 }, // 0xcb
+            { 0, 0, 0, 2 }, // 0xcc
+            { 3, 3, 0, 7 }, // 0xcd
+            { 2, 2, 0, 7 }, // 0xce
+            { 2, 2, 0, 3 }, // 0xcf
+            { 2, 2, 0, 7 }, // 0xd0
+            { 4, 3, 0, 7 }, // 0xd1
+            { 2, 2, 0, 7 }, // 0xd2
+            { 4, 3, 0, 7 }, // 0xd3
+            { 4, 3, 0, 7 }, // 0xd4
+            { 3, 2, 0, 7 }, // 0xd5
+            { 4, 3, 0, 7 }, // 0xd6
+            { 3, 3, 0, 7 }, // 0xd7
+            { 3, 2, 0, 7 }, // 0xd8
+            { 4, 3, 0, 7 }, // 0xd9
+            { 3, 2, 0, 7 }, // 0xda
+            { 4, 3, 0, 7 }, // 0xdb
+            { 2, 2, 0, 7 }, // 0xdc
+            { 2, 2, 0, 6 }, // 0xdd
+            { 2, 2, 0, 7 }, // 0xde
+            { 3, 3, 0, 7 }, // 0xdf
+            { 2, 2, 0, 7 }, // 0xe0
+            { 3, 2, 0, 7 }, // 0xe1
+            { 3, 2, 0, 7 }, // 0xe2
+            { 4, 3, 0, 7 }, // 0xe3
+            { 3, 2, 0, 7 }, // 0xe4
+            { 4, 3, 0, 7 }, // 0xe5
+            { 3, 2, 0, 7 }, // 0xe6
+            { 4, 3, 0, 7 }, // 0xe7
+            { 4, 3, 0, 7 }, // 0xe8
+            { 5, 3, 0, 7 }, // 0xe9
+            { 2, 2, 0, 7 }, // 0xea
+            { 3, 3, 0, 7 }, // 0xeb
+            { 2, 2, 0, 7 }, // 0xec
+            { 3, 3, 0, 7 }, // 0xed
+            { 1, 1, 0, 6 }, // 0xee
+            { 3, 2, 0, 7 }, // 0xef
+            { 0, 0, 0, 1 }, // 0xf0
+            { 3, 3, 0, 7 }, // 0xf1
+            { 2, 2, 0, 7 }, // 0xf2
+            { 2, 2, 0, 3 }, // 0xf3
+            { 2, 2, 0, 7 }, // 0xf4
+            { 2, 2, 0, 5 }, // 0xf5
+            { 2, 2, 0, 7 }, // 0xf6
+            { 3, 3, 0, 7 }, // 0xf7
+            { 2, 2, 0, 7 }, // 0xf8
+            { 3, 3, 0, 7 }, // 0xf9
+            { 1, 1, 0, 5 }, // 0xfa
+            { 3, 2, 0, 7 }, // 0xfb
+            { 1, 1, 0, 3 }, // 0xfc
+            { 3, 2, 0, 7 }, // 0xfd
+            { 2, 2, 0, 7 }, // 0xfe
+            { 0, 0, 1, 0 }, // 0xff
+        };
+
+        // kernels of ternary_x86_64_bmi.cpp
+        constexpr kernel_cost x86_64_bmi[256] = {
+            { 0, 0, 1, 0 }, // 0x00
+            { 3, 2, 0, 7 }, // 0x01
+            { 2, 2, 0, 7 }, // 0x02
+            { 2, 2, 0, 3 }, // 0x03
+            { 2, 2, 0, 7 }, // 0x04
+            { 2, 2, 0, 5 }, // 0x05
+            { 2, 2, 0, 7 }, // 0x06
+            { 3, 2, 0, 7 }, // 0x07
+            { 2, 2, 0, 7 }, // 0x08
+            { 3, 2, 0, 7 }, // 0x09
+            { 1, 1, 0, 5 }, // 0x0a
+            { 3, 2, 0, 7 }, // 0x0b
+            { 1, 1, 0, 3 }, // 0x0c
+            { 3, 2, 0, 7 }, // 0x0d
+            { 2, 2, 0, 7 }, // 0x0e
+            { 1, 1, 0, 1 }, // 0x0f
+            { 2, 2, 0, 7 }, // 0x10
+            { 2, 2, 0, 6 }, // 0x11
+            { 2, 2, 0, 7 }, // 0x12
+            { 3, 2, 0, 7 }, // 0x13
+            { 2, 2, 0, 7 }, // 0x14
+            { 3, 2, 0, 7 }, // 0x15
+            { 4, 3, 0, 7 }, // 0x16
+            { 5, 3, 0, 7 }, // 0x17
+            { 3, 2, 0, 7 }, // 0x18
+            { 4, 3, 0, 7 }, // 0x19
+            { 3, 2, 0, 7 }, // 0x1a
+            { 4, 3, 0, 7 }, // 0x1b
+            { 3, 2, 0, 7 }, // 0x1c
+            { 4, 3, 0, 7 }, // 0x1d
+            { 2, 2, 0, 7 }, // 0x1e
+            { 3, 3, 0, 7 }, // 0x1f
+            { 2, 2, 0, 7 }, // 0x20
+            { 3, 2, 0, 7 }, // 0x21
+            { 1, 1, 0, 6 }, // 0x22
+            { 3, 2, 0, 7 }, // 0x23
+            { 3, 2, 0, 7 }, // 0x24
+            { 4, 3, 0, 7 }, // 0x25
+            { 3, 2, 0, 7 }, // 0x26
+            { 4, 3, 0, 7 }, // 0x27
+            { 2, 2, 0, 7 }, // 0x28
+            { 5, 3, 0, 7 }, // 0x29
+            { 2, 2, 0, 7 }, // 0x2a
+            { 5, 3, 0, 7 }, // 0x2b
+            { 3, 2, 0, 7 }, // 0x2c
+            { 3, 2, 0, 7 }, // 0x2d
+            { 3, 2, 0, 7 }, // 0x2e
+            { 3, 2, 0, 7 }, // 0x2f
+            { 1, 1, 0, 3 }, // 0x30
+            { 3, 2, 0, 7 }, // 0x31
+            { 2, 2, 0, 7 }, // 0x32
+            { 1, 1, 0, 2 }, // 0x33
+            { 3, 2, 0, 7 }, // 0x34
+            { 4, 3, 0, 7 }, // 0x35
+            { 2, 2, 0, 7 }, // 0x36
+            { 3, 3, 0, 7 }, // 0x37
+            { 3, 2, 0, 7 }, // 0x38
+            { 3, 2, 0, 7 }, // 0x39
+            { 3, 2, 0, 7 }, // 0x3a
+            { 3, 2, 0, 7 }, // 0x3b
+            { 1, 1, 0, 3 }, // 0x3c
+            { 4, 3, 0, 7 }, // 0x3d
+            { 3, 2, 0, 7 }, // 0x3e
+            { 2, 2, 0, 3 }, // 0x3f
+            { 2, 2, 0, 7 }, // 0x40
+            { 3, 2, 0, 7 }, // 0x41
+            { 3, 2, 0, 7 }, // 0x42
+            { 4, 3, 0, 7 }, // 0x43
+            { 1, 1, 0, 6 }, // 0x44
+            { 3, 2, 0, 7 }, // 0x45
+            { 3, 2, 0, 7 }, // 0x46
+            { 4, 3, 0, 7 }, // 0x47
+            { 2, 2, 0, 7 }, // 0x48
+            { 5, 3, 0, 7 }, // 0x49
+            { 3, 2, 0, 7 }, // 0x4a
+            { 3, 2, 0, 7 }, // 0x4b
+            { 2, 2, 0, 7 }, // 0x4c
+            { 5, 3, 0, 7 }, // 0x4d
+            { 3, 2, 0, 7 }, // 0x4e
+            { 3, 2, 0, 7 }, // 0x4f
+            { 1, 1, 0, 5 }, // 0x50
+            { 3, 2, 0, 7 }, // 0x51
+            { 3, 2, 0, 7 }, // 0x52
+            { 4, 3, 0, 7 }, // 0x53
+            { 2, 2, 0, 7 }, // 0x54
+            { 1, 1, 0, 4 }, // 0x55
+            { 2, 2, 0, 7 }, // 0x56
+            { 3, 3, 0, 7 }, // 0x57
+            { 3, 2, 0, 7 }, // 0x58
+            { 3, 2, 0, 7 }, // 0x59
+            { 1, 1, 0, 5 }, // 0x5a
+            { 4, 3, 0, 7 }, // 0x5b
+            { 3, 2, 0, 7 }, // 0x5c
+            { 3, 2, 0, 7 }, // 0x5d
+            { 3, 2, 0, 7 }, // 0x5e
+            { 2, 2, 0, 5 }, // 0x5f
+            { 2, 2, 0, 7 }, // 0x60
+            { 5, 3, 0, 7 }, // 0x61
+            { 3, 2, 0, 7 }, // 0x62
+            { 3, 2, 0, 7 }, // 0x63
+            { 3, 2, 0, 7 }, // 0x64
+            { 3, 2, 0, 7 }, // 0x65
+            { 1, 1, 0, 6 }, // 0x66
+            { 4, 3, 0, 7 }, // 0x67
+            { 4, 3, 0, 7 }, // 0x68
+            { 3, 2, 0, 7 }, // 0x69
+            { 2, 2, 0, 7 }, // 0x6a
+            { 5, 3, 0, 7 }, // 0x6b
+            { 2, 2, 0, 7 }, // 0x6c
+            { 5, 3, 0, 7 }, // 0x6d
+            { 3, 2, 0, 7 }, // 0x6e
+            { 3, 2, 0, 7 }, // 0x6f
+            { 2, 2, 0, 7 }, // 0x70
+            { 5, 3, 0, 7 }, // 0x71
+            { 3, 2, 0, 7 }, // 0x72
+            { 3, 2, 0, 7 }, // 0x73
+            { 3, 2, 0, 7 }, // 0x74
+            { 3, 2, 0, 7 }, // 0x75
+            { 3, 2, 0, 7 }, // 0x76
+            { 2, 2, 0, 6 }, // 0x77
+            { 2, 2, 0, 7 }, // 0x78
+            { 5, 3, 0, 7 }, // 0x79
+            { 3, 2, 0, 7 }, // 0x7a
+            { 3, 2, 0, 7 }, // 0x7b
+            { 3, 2, 0, 7 }, // 0x7c
+            { 3, 2, 0, 7 }, // 0x7d
+            { 3, 2, 0, 7 }, // 0x7e
+            { 3, 3, 0, 7 }, // 0x7f
+            { 2, 2, 0, 7 }, // 0x80
+            { 4, 3, 0, 7 }, // 0x81
+            { 2, 2, 0, 7 }, // 0x82
+            { 4, 3, 0, 7 }, // 0x83
+            { 2, 2, 0, 7 }, // 0x84
+            { 4, 3, 0, 7 }, // 0x85
+            { 4, 3, 0, 7 }, // 0x86
+            { 3, 2, 0, 7 }, // 0x87
+            { 1, 1, 0, 6 }, // 0x88
+            { 4, 3, 0, 7 }, // 0x89
+            { 2, 2, 0, 7 }, // 0x8a
+            { 4, 3, 0, 7 }, // 0x8b
+            { 2, 2, 0, 7 }, // 0x8c
+            { 4, 3, 0, 7 }, // 0x8d
+            { 4, 3, 0, 7 }, // 0x8e
+            { 3, 2, 0, 7 }, // 0x8f
+            { 2, 2, 0, 7 }, // 0x90
+            { 4, 3, 0, 7 }, // 0x91
+            { 4, 3, 0, 7 }, // 0x92
+            { 3, 2, 0, 7 }, // 0x93
+            { 4, 3, 0, 7 }, // 0x94
+            { 3, 2, 0, 7 }, // 0x95
+            { 2, 2, 0, 7 }, // 0x96
+            { 5, 3, 0, 7 }, // 0x97
+            { 3, 2, 0, 7 }, // 0x98
+            { 2, 2, 0, 6 }, // 0x99
+            { 2, 2, 0, 7 }, // 0x9a
+            { 4, 3, 0, 7 }, // 0x9b
+            { 2, 2, 0, 7 }, // 0x9c
+            { 4, 3, 0, 7 }, // 0x9d
+            { 4, 3, 0, 7 }, // 0x9e
+            { 3, 3, 0, 7 }, // 0x9f
+            { 1, 1, 0, 5 }, // 0xa0
+            { 4, 3, 0, 7 }, // 0xa1
+            { 2, 2, 0, 7 }, // 0xa2
+            { 4, 3, 0, 7 }, // 0xa3
+            { 3, 2, 0, 7 }, // 0xa4
+            { 2, 2, 0, 5 }, // 0xa5
+            { 2, 2, 0, 7 }, // 0xa6
+            { 4, 3, 0, 7 }, // 0xa7
+            { 2, 2, 0, 7 }, // 0xa8
+            { 3, 2, 0, 7 }, // 0xa9
+            { 0, 0, 0, 4 }, // 0xaa
+            { 3, 3, 0, 7 }, // 0xab
+            { 3, 2, 0, 7 }, // 0xac
+            { 4, 3, 0, 7 }, // 0xad
+            { 2, 2, 0, 7 }, // 0xae
+            { 2, 2, 0, 5 }, // 0xaf
+            { 2, 2, 0, 7 }, // 0xb0
+            { 4, 3, 0, 7 }, // 0xb1
+            { 4, 3, 0, 7 }, // 0xb2
+            { 3, 2, 0, 7 }, // 0xb3
+            { 2, 2, 0, 7 }, // 0xb4
+            { 4, 3, 0, 7 }, // 0xb5
+            { 4, 3, 0, 7 }, // 0xb6
+            { 3, 3, 0, 7 }, // 0xb7
+            { 3, 2, 0, 7 }, // 0xb8
+            { 4, 3, 0, 7 }, // 0xb9
+            { 2, 2, 0, 7 }, // 0xba
+            { 2, 2, 0, 6 }, // 0xbb
+            { 3, 2, 0, 7 }, // 0xbc
+            { 4, 3, 0, 7 }, // 0xbd
+            { 2, 2, 0, 7 }, // 0xbe
+            { 3, 3, 0, 7 }, // 0xbf
+            { 1, 1, 0, 3 }, // 0xc0
+            { 4, 3, 0, 7 }, // 0xc1
+            { 3, 2, 0, 7 }, // 0xc2
+            { 2, 2, 0, 3 }, // 0xc3
+            { 2, 2, 0, 7 }, // 0xc4
+            { 4, 3, 0, 7 }, // 0xc5
+            { 2, 2, 0, 7 }, // 0xc6
+            { 4, 3, 0, 7 }, // 0xc7
+            { 2, 2, 0, 7 }, // 0xc8
+            { 3, 2, 0, 7 }, // 0xc9
+            { 3, 2, 0, 7 }, // 0xca
+            { 4, 3, 0, 7 }, // 0xcb
+            { 0, 0, 0, 2 }, // 0xcc
+            { 3, 3, 0, 7 }, // 0xcd
+            { 2, 2, 0, 7 }, // 0xce
+            { 2, 2, 0, 3 }, // 0xcf
+            { 2, 2, 0, 7 }, // 0xd0
+            { 4, 3, 0, 7 }, // 0xd1
+            { 2, 2, 0, 7 }, // 0xd2
+            { 4, 3, 0, 7 }, // 0xd3
+            { 4, 3, 0, 7 }, // 0xd4
+            { 3, 2, 0, 7 }, // 0xd5
+            { 4, 3, 0, 7 }, // 0xd6
+            { 3, 3, 0, 7 }, // 0xd7
+            { 3, 2, 0, 7 }, // 0xd8
+            { 4, 3, 0, 7 }, // 0xd9
+            { 3, 2, 0, 7 }, // 0xda
+            { 4, 3, 0, 7 }, // 0xdb
+            { 2, 2, 0, 7 }, // 0xdc
+            { 2, 2, 0, 6 }, // 0xdd
+            { 2, 2, 0, 7 }, // 0xde
+            { 3, 3, 0, 7 }, // 0xdf
+            { 2, 2, 0, 7 }, // 0xe0
+            { 3, 2, 0, 7 }, // 0xe1
+            { 3, 2, 0, 7 }, // 0xe2
+            { 4, 3, 0, 7 }, // 0xe3
+            { 3, 2, 0, 7 }, // 0xe4
+            { 4, 3, 0, 7 }, // 0xe5
+            { 3, 2, 0, 7 }, // 0xe6
+            { 4, 3, 0, 7 }, // 0xe7
+            { 4, 3, 0, 7 }, // 0xe8
+            { 5, 3, 0, 7 }, // 0xe9
+            { 2, 2, 0, 7 }, // 0xea
+            { 3, 3, 0, 7 }, // 0xeb
+            { 2, 2, 0, 7 }, // 0xec
+            { 3, 3, 0, 7 }, // 0xed
+            { 1, 1, 0, 6 }, // 0xee
+            { 3, 2, 0, 7 }, // 0xef
+            { 0, 0, 0, 1 }, // 0xf0
+            { 3, 3, 0, 7 }, // 0xf1
+            { 2, 2, 0, 7 }, // 0xf2
+            { 2, 2, 0, 3 }, // 0xf3
+            { 2, 2, 0, 7 }, // 0xf4
+            { 2, 2, 0, 5 }, // 0xf5
+            { 2, 2, 0, 7 }, // 0xf6
+            { 3, 3, 0, 7 }, // 0xf7
+            { 2, 2, 0, 7 }, // 0xf8
+            { 3, 3, 0, 7 }, // 0xf9
+            { 1, 1, 0, 5 }, // 0xfa
+            { 3, 2, 0, 7 }, // 0xfb
+            { 1, 1, 0, 3 }, // 0xfc
+            { 3, 2, 0, 7 }, // 0xfd
+            { 2, 2, 0, 7 }, // 0xfe
+            { 0, 0, 1, 0 }, // 0xff
+        };
+
+        // kernels of ternary_sse.cpp
+        constexpr kernel_cost sse[256] = {
+            { 0, 0, 1, 0 }, // 0x00
+            { 3, 2, 1, 7 }, // 0x01
+            { 2, 2, 0, 7 }, // 0x02
+            { 2, 2, 1, 3 }, // 0x03
+            { 2, 2, 0, 7 }, // 0x04
+            { 2, 2, 1, 5 }, // 0x05
+            { 2, 2, 0, 7 }, // 0x06
+            { 3, 2, 1, 7 }, // 0x07
+            { 2, 2, 0, 7 }, // 0x08
+            { 3, 2, 1, 7 }, // 0x09
+            { 1, 1, 0, 5 }, // 0x0a
+            { 3, 2, 1, 7 }, // 0x0b
+            { 1, 1, 0, 3 }, // 0x0c
+            { 3, 2, 1, 7 }, // 0x0d
+            { 2, 2, 0, 7 }, // 0x0e
+            { 1, 1, 1, 1 }, // 0x0f
+            { 2, 2, 0, 7 }, // 0x10
+            { 2, 2, 1, 6 }, // 0x11
+            { 2, 2, 0, 7 }, // 0x12
+            { 3, 2, 1, 7 }, // 0x13
+            { 2, 2, 0, 7 }, // 0x14
+            { 3, 2, 1, 7 }, // 0x15
+            { 4, 3, 0, 7 }, // 0x16
+            { 5, 3, 1, 7 }, // 0x17
+            { 3, 2, 0, 7 }, // 0x18
+            { 4, 3, 1, 7 }, // 0x19
+            { 3, 2, 0, 7 }, // 0x1a
+            { 4, 3, 1, 7 }, // 0x1b
+            { 3, 2, 0, 7 }, // 0x1c
+            { 4, 3, 1, 7 }, // 0x1d
+            { 2, 2, 0, 7 }, // 0x1e
+            { 3, 3, 1, 7 }, // 0x1f
+            { 2, 2, 0, 7 }, // 0x20
+            { 3, 2, 1, 7 }, // 0x21
+            { 1, 1, 0, 6 }, // 0x22
+            { 3, 2, 1, 7 }, // 0x23
+            { 3, 2, 0, 7 }, // 0x24
+            { 4, 3, 1, 7 }, // 0x25
+            { 3, 2, 0, 7 }, // 0x26
+            { 4, 3, 1, 7 }, // 0x27
+            { 2, 2, 0, 7 }, // 0x28
+            { 5, 3, 1, 7 }, // 0x29
+            { 2, 2, 0, 7 }, // 0x2a
+            { 5, 3, 1, 7 }, // 0x2b
+            { 3, 2, 0, 7 }, // 0x2c
+            { 3, 2, 1, 7 }, // 0x2d
+            { 3, 2, 0, 7 }, // 0x2e
+            { 3, 2, 1, 7 }, // 0x2f
+            { 1, 1, 0, 3 }, // 0x30
+            { 3, 2, 1, 7 }, // 0x31
+            { 2, 2, 0, 7 }, // 0x32
+            { 1, 1, 1, 2 }, // 0x33
+            { 3, 2, 0, 7 }, // 0x34
+            { 4, 3, 1, 7 }, // 0x35
+            { 2, 2, 0, 7 }, // 0x36
+            { 3, 3, 1, 7 }, // 0x37
+            { 3, 2, 0, 7 }, // 0x38
+            { 3, 2, 1, 7 }, // 0x39
+            { 3, 2, 0, 7 }, // 0x3a
+            { 3, 2, 1, 7 }, // 0x3b
+            { 1, 1, 0, 3 }, // 0x3c
+            { 4, 3, 1, 7 }, // 0x3d
+            { 3, 2, 0, 7 }, // 0x3e
+            { 2, 2, 1, 3 }, // 0x3f
+            { 2, 2, 0, 7 }, // 0x40
+            { 3, 2, 1, 7 }, // 0x41
+            { 3, 2, 0, 7 }, // 0x42
+            { 4, 3, 1, 7 }, // 0x43
+            { 1, 1, 0, 6 }, // 0x44
+            { 3, 2, 1, 7 }, // 0x45
+            { 3, 2, 0, 7 }, // 0x46
+            { 4, 3, 1, 7 }, // 0x47
+            { 2, 2, 0, 7 }, // 0x48
+            { 5, 3, 1, 7 }, // 0x49
+            { 3, 2, 0, 7 }, // 0x4a
+            { 3, 2, 1, 7 }, // 0x4b
+            { 2, 2, 0, 7 }, // 0x4c
+            { 5, 3, 1, 7 }, // 0x4d
+            { 3, 2, 0, 7 }, // 0x4e
+            { 3, 2, 1, 7 }, // 0x4f
+            { 1, 1, 0, 5 }, // 0x50
+            { 3, 2, 1, 7 }, // 0x51
+            { 3, 2, 0, 7 }, // 0x52
+            { 4, 3, 1, 7 }, // 0x53
+            { 2, 2, 0, 7 }, // 0x54
+            { 1, 1, 1, 4 }, // 0x55
+            { 2, 2, 0, 7 }, // 0x56
+            { 3, 3, 1, 7 }, // 0x57
+            { 3, 2, 0, 7 }, // 0x58
+            { 3, 2, 1, 7 }, // 0x59
+            { 1, 1, 0, 5 }, // 0x5a
+            { 4, 3, 1, 7 }, // 0x5b
+            { 3, 2, 0, 7 }, // 0x5c
+            { 3, 2, 1, 7 }, // 0x5d
+            { 3, 2, 0, 7 }, // 0x5e
+            { 2, 2, 1, 5 }, // 0x5f
+            { 2, 2, 0, 7 }, // 0x60
+            { 5, 3, 1, 7 }, // 0x61
+            { 3, 2, 0, 7 }, // 0x62
+            { 3, 2, 1, 7 }, // 0x63
+            { 3, 2, 0, 7 }, // 0x64
+            { 3, 2, 1, 7 }, // 0x65
+            { 1, 1, 0, 6 }, // 0x66
+            { 4, 3, 1, 7 }, // 0x67
+            { 4, 3, 0, 7 }, // 0x68
+            { 3, 2, 1, 7 }, // 0x69
+            { 2, 2, 0, 7 }, // 0x6a
+            { 5, 3, 1, 7 }, // 0x6b
+            { 2, 2, 0, 7 }, // 0x6c
+            { 5, 3, 1, 7 }, // 0x6d
+            { 3, 2, 0, 7 }, // 0x6e
+            { 3, 2, 1, 7 }, // 0x6f
+            { 2, 2, 0, 7 }, // 0x70
+            { 5, 3, 1, 7 }, // 0x71
+            { 3, 2, 0, 7 }, // 0x72
+            { 3, 2, 1, 7 }, // 0x73
+            { 3, 2, 0, 7 }, // 0x74
+            { 3, 2, 1, 7 }, // 0x75
+            { 3, 2, 0, 7 }, // 0x76
+            { 2, 2, 1, 6 }, // 0x77
+            { 2, 2, 0, 7 }, // 0x78
+            { 5, 3, 1, 7 }, // 0x79
+            { 3, 2, 0, 7 }, // 0x7a
+            { 3, 2, 1, 7 }, // 0x7b
+            { 3, 2, 0, 7 }, // 0x7c
+            { 3, 2, 1, 7 }, // 0x7d
+            { 3, 2, 0, 7 }, // 0x7e
+            { 3, 3, 1, 7 }, // 0x7f
+            { 2, 2, 0, 7 }, // 0x80
+            { 4, 3, 1, 7 }, // 0x81
+            { 2, 2, 0, 7 }, // 0x82
+            { 4, 3, 1, 7 }, // 0x83
+            { 2, 2, 0, 7 }, // 0x84
+            { 4, 3, 1, 7 }, // 0x85
+            { 4, 3, 0, 7 }, // 0x86
+            { 3, 2, 1, 7 }, // 0x87
+            { 1, 1, 0, 6 }, // 0x88
+            { 4, 3, 1, 7 }, // 0x89
+            { 2, 2, 0, 7 }, // 0x8a
+            { 4, 3, 1, 7 }, // 0x8b
+            { 2, 2, 0, 7 }, // 0x8c
+            { 4, 3, 1, 7 }, // 0x8d
+            { 4, 3, 0, 7 }, // 0x8e
+            { 3, 2, 1, 7 }, // 0x8f
+            { 2, 2, 0, 7 }, // 0x90
+            { 4, 3, 1, 7 }, // 0x91
+            { 4, 3, 0, 7 }, // 0x92
+            { 3, 2, 1, 7 }, // 0x93
+            { 4, 3, 0, 7 }, // 0x94
+            { 3, 2, 1, 7 }, // 0x95
+            { 2, 2, 0, 7 }, // 0x96
+            { 5, 3, 1, 7 }, // 0x97
+            { 3, 2, 0, 7 }, // 0x98
+            { 2, 2, 1, 6 }, // 0x99
+            { 2, 2, 0, 7 }, // 0x9a
+            { 4, 3, 1, 7 }, // 0x9b
+            { 2, 2, 0, 7 }, // 0x9c
+            { 4, 3, 1, 7 }, // 0x9d
+            { 4, 3, 0, 7 }, // 0x9e
+            { 3, 3, 1, 7 }, // 0x9f
+            { 1, 1, 0, 5 }, // 0xa0
+            { 4, 3, 1, 7 }, // 0xa1
+            { 2, 2, 0, 7 }, // 0xa2
+            { 4, 3, 1, 7 }, // 0xa3
+            { 3, 2, 0, 7 }, // 0xa4
+            { 2, 2, 1, 5 }, // 0xa5
+            { 2, 2, 0, 7 }, // 0xa6
+            { 4, 3, 1, 7 }, // 0xa7
+            { 2, 2, 0, 7 }, // 0xa8
+            { 3, 2, 1, 7 }, // 0xa9
+            { 0, 0, 0, 4 }, // 0xaa
+            { 3, 3, 1, 7 }, // 0xab
+            { 3, 2, 0, 7 }, // 0xac
+            { 4, 3, 1, 7 }, // 0xad
+            { 2, 2, 0, 7 }, // 0xae
+            { 2, 2, 1, 5 }, // 0xaf
+            { 2, 2, 0, 7 }, // 0xb0
+            { 4, 3, 1, 7 }, // 0xb1
+            { 4, 3, 0, 7 }, // 0xb2
+            { 3, 2, 1, 7 }, // 0xb3
+            { 2, 2, 0, 7 }, // 0xb4
+            { 4, 3, 1, 7 }, // 0xb5
+            { 4, 3, 0, 7 }, // 0xb6
+            { 3, 3, 1, 7 }, // 0xb7
+            { 3, 2, 0, 7 }, // 0xb8
+            { 4, 3, 1, 7 }, // 0xb9
+            { 2, 2, 0, 7 }, // 0xba
+            { 2, 2, 1, 6 }, // 0xbb
+            { 3, 2, 0, 7 }, // 0xbc
+            { 4, 3, 1, 7 }, // 0xbd
+            { 2, 2, 0, 7 }, // 0xbe
+            { 3, 3, 1, 7 }, // 0xbf
+            { 1, 1, 0, 3 }, // 0xc0
+            { 4, 3, 1, 7 }, // 0xc1
+            { 3, 2, 0, 7 }, // 0xc2
+            { 2, 2, 1, 3 }, // 0xc3
+            { 2, 2, 0, 7 }, // 0xc4
+            { 4, 3, 1, 7 }, // 0xc5
+            { 2, 2, 0, 7 }, // 0xc6
+            { 4, 3, 1, 7 }, // 0xc7
+            { 2, 2, 0, 7 }, // 0xc8
+            { 3, 2, 1, 7 }, // 0xc9
+            { 3, 2, 0, 7 }, // 0xca
+            { 4, 3, 1, 7 }, // 0xcb
+            { 0, 0, 0, 2 }, // 0xcc
+            { 3, 3, 1, 7 }, // 0xcd
+            { 2, 2, 0, 7 }, // 0xce
+            { 2, 2, 1, 3 }, // 0xcf
+            { 2, 2, 0, 7 }, // 0xd0
+            { 4, 3, 1, 7 }, // 0xd1
+            { 2, 2, 0, 7 }, // 0xd2
+            { 4, 3, 1, 7 }, // 0xd3
+            { 4, 3, 0, 7 }, // 0xd4
+            { 3, 2, 1, 7 }, // 0xd5
+            { 4, 3, 0, 7 }, // 0xd6
+            { 3, 3, 1, 7 }, // 0xd7
+            { 3, 2, 0, 7 }, // 0xd8
+            { 4, 3, 1, 7 }, // 0xd9
+            { 3, 2, 0, 7 }, // 0xda
+            { 4, 3, 1, 7 }, // 0xdb
+            { 2, 2, 0, 7 }, // 0xdc
+            { 2, 2, 1, 6 }, // 0xdd
+            { 2, 2, 0, 7 }, // 0xde
+            { 3, 3, 1, 7 }, // 0xdf
+            { 2, 2, 0, 7 }, // 0xe0
+            { 3, 2, 1, 7 }, // 0xe1
+            { 3, 2, 0, 7 }, // 0xe2
+            { 4, 3, 1, 7 }, // 0xe3
+            { 3, 2, 0, 7 }, // 0xe4
+            { 4, 3, 1, 7 }, // 0xe5
+            { 3, 2, 0, 7 }, // 0xe6
+            { 4, 3, 1, 7 }, // 0xe7
+            { 4, 3, 0, 7 }, // 0xe8
+            { 5, 3, 1, 7 }, // 0xe9
+            { 2, 2, 0, 7 }, // 0xea
+            { 3, 3, 1, 7 }, // 0xeb
+            { 2, 2, 0, 7 }, // 0xec
+            { 3, 3, 1, 7 }, // 0xed
+            { 1, 1, 0, 6 }, // 0xee
+            { 3, 2, 1, 7 }, // 0xef
+            { 0, 0, 0, 1 }, // 0xf0
+            { 3, 3, 1, 7 }, // 0xf1
+            { 2, 2, 0, 7 }, // 0xf2
+            { 2, 2, 1, 3 }, // 0xf3
+            { 2, 2, 0, 7 }, // 0xf4
+            { 2, 2, 1, 5 }, // 0xf5
+            { 2, 2, 0, 7 }, // 0xf6
+            { 3, 3, 1, 7 }, // 0xf7
+            { 2, 2, 0, 7 }, // 0xf8
+            { 3, 3, 1, 7 }, // 0xf9
+            { 1, 1, 0, 5 }, // 0xfa
+            { 3, 2, 1, 7 }, // 0xfb
+            { 1, 1, 0, 3 }, // 0xfc
+            { 3, 2, 1, 7 }, // 0xfd
+            { 2, 2, 0, 7 }, // 0xfe
+            { 0, 0, 1, 0 }, // 0xff
+        };
+
+        // kernels of ternary_avx2.cpp
+        constexpr kernel_cost avx2[256] = {
+            { 0, 0, 1, 0 }, // 0x00
+            { 3, 2, 1, 7 }, // 0x01
+            { 2, 2, 0, 7 }, // 0x02
+            { 2, 2, 1, 3 }, // 0x03
+            { 2, 2, 0, 7 }, // 0x04
+            { 2, 2, 1, 5 }, // 0x05
+            { 2, 2, 0, 7 }, // 0x06
+            { 3, 2, 1, 7 }, // 0x07
+            { 2, 2, 0, 7 }, // 0x08
+            { 3, 2, 1, 7 }, // 0x09
+            { 1, 1, 0, 5 }, // 0x0a
+            { 3, 2, 1, 7 }, // 0x0b
+            { 1, 1, 0, 3 }, // 0x0c
+            { 3, 2, 1, 7 }, // 0x0d
+            { 2, 2, 0, 7 }, // 0x0e
+            { 1, 1, 1, 1 }, // 0x0f
+            { 2, 2, 0, 7 }, // 0x10
+            { 2, 2, 1, 6 }, // 0x11
+            { 2, 2, 0, 7 }, // 0x12
+            { 3, 2, 1, 7 }, // 0x13
+            { 2, 2, 0, 7 }, // 0x14
+            { 3, 2, 1, 7 }, // 0x15
+            { 4, 3, 0, 7 }, // 0x16
+            { 5, 3, 1, 7 }, // 0x17
+            { 3, 2, 0, 7 }, // 0x18
+            { 4, 3, 1, 7 }, // 0x19
+            { 3, 2, 0, 7 }, // 0x1a
+            { 4, 3, 1, 7 }, // 0x1b
+            { 3, 2, 0, 7 }, // 0x1c
+            { 4, 3, 1, 7 }, // 0x1d
+            { 2, 2, 0, 7 }, // 0x1e
+            { 3, 3, 1, 7 }, // 0x1f
+            { 2, 2, 0, 7 }, // 0x20
+            { 3, 2, 1, 7 }, // 0x21
+            { 1, 1, 0, 6 }, // 0x22
+            { 3, 2, 1, 7 }, // 0x23
+            { 3, 2, 0, 7 }, // 0x24
+            { 4, 3, 1, 7 }, // 0x25
+            { 3, 2, 0, 7 }, // 0x26
+            { 4, 3, 1, 7 }, // 0x27
+            { 2, 2, 0, 7 }, // 0x28
+            { 5, 3, 1, 7 }, // 0x29
+            { 2, 2, 0, 7 }, // 0x2a
+            { 5, 3, 1, 7 }, // 0x2b
+            { 3, 2, 0, 7 }, // 0x2c
+            { 3, 2, 1, 7 }, // 0x2d
+            { 3, 2, 0, 7 }, // 0x2e
+            { 3, 2, 1, 7 }, // 0x2f
+            { 1, 1, 0, 3 }, // 0x30
+            { 3, 2, 1, 7 }, // 0x31
+            { 2, 2, 0, 7 }, // 0x32
+            { 1, 1, 1, 2 }, // 0x33
+            { 3, 2, 0, 7 }, // 0x34
+            { 4, 3, 1, 7 }, // 0x35
+            { 2, 2, 0, 7 }, // 0x36
+            { 3, 3, 1, 7 }, // 0x37
+            { 3, 2, 0, 7 }, // 0x38
+            { 3, 2, 1, 7 }, // 0x39
+            { 3, 2, 0, 7 }, // 0x3a
+            { 3, 2, 1, 7 }, // 0x3b
+            { 1, 1, 0, 3 }, // 0x3c
+            { 4, 3, 1, 7 }, // 0x3d
+            { 3, 2, 0, 7 }, // 0x3e
+            { 2, 2, 1, 3 }, // 0x3f
+            { 2, 2, 0, 7 }, // 0x40
+            { 3, 2, 1, 7 }, // 0x41
+            { 3, 2, 0, 7 }, // 0x42
+            { 4, 3, 1, 7 }, // 0x43
+            { 1, 1, 0, 6 }, // 0x44
+            { 3, 2, 1, 7 }, // 0x45
+            { 3, 2, 0, 7 }, // 0x46
+            { 4, 3, 1, 7 }, // 0x47
+            { 2, 2, 0, 7 }, // 0x48
+            { 5, 3, 1, 7 }, // 0x49
+            { 3, 2, 0, 7 }, // 0x4a
+            { 3, 2, 1, 7 }, // 0x4b
+            { 2, 2, 0, 7 }, // 0x4c
+            { 5, 3, 1, 7 }, // 0x4d
+            { 3, 2, 0, 7 }, // 0x4e
+            { 3, 2, 1, 7 }, // 0x4f
+            { 1, 1, 0, 5 }, // 0x50
+            { 3, 2, 1, 7 }, // 0x51
+            { 3, 2, 0, 7 }, // 0x52
+            { 4, 3, 1, 7 }, // 0x53
+            { 2, 2, 0, 7 }, // 0x54
+            { 1, 1, 1, 4 }, // 0x55
+            { 2, 2, 0, 7 }, // 0x56
+            { 3, 3, 1, 7 }, // 0x57
+            { 3, 2, 0, 7 }, // 0x58
+            { 3, 2, 1, 7 }, // 0x59
+            { 1, 1, 0, 5 }, // 0x5a
+            { 4, 3, 1, 7 }, // 0x5b
+            { 3, 2, 0, 7 }, // 0x5c
+            { 3, 2, 1, 7 }, // 0x5d
+            { 3, 2, 0, 7 }, // 0x5e
+            { 2, 2, 1, 5 }, // 0x5f
+            { 2, 2, 0, 7 }, // 0x60
+            { 5, 3, 1, 7 }, // 0x61
+            { 3, 2, 0, 7 }, // 0x62
+            { 3, 2, 1, 7 }, // 0x63
+            { 3, 2, 0, 7 }, // 0x64
+            { 3, 2, 1, 7 }, // 0x65
+            { 1, 1, 0, 6 }, // 0x66
+            { 4, 3, 1, 7 }, // 0x67
+            { 4, 3, 0, 7 }, // 0x68
+            { 3, 2, 1, 7 }, // 0x69
+            { 2, 2, 0, 7 }, // 0x6a
+            { 5, 3, 1, 7 }, // 0x6b
+            { 2, 2, 0, 7 }, // 0x6c
+            { 5, 3, 1, 7 }, // 0x6d
+            { 3, 2, 0, 7 }, // 0x6e
+            { 3, 2, 1, 7 }, // 0x6f
+            { 2, 2, 0, 7 }, // 0x70
+            { 5, 3, 1, 7 }, // 0x71
+            { 3, 2, 0, 7 }, // 0x72
+            { 3, 2, 1, 7 }, // 0x73
+            { 3, 2, 0, 7 }, // 0x74
+            { 3, 2, 1, 7 }, // 0x75
+            { 3, 2, 0, 7 }, // 0x76
+            { 2, 2, 1, 6 }, // 0x77
+            { 2, 2, 0, 7 }, // 0x78
+            { 5, 3, 1, 7 }, // 0x79
+            { 3, 2, 0, 7 }, // 0x7a
+            { 3, 2, 1, 7 }, // 0x7b
+            { 3, 2, 0, 7 }, // 0x7c
+            { 3, 2, 1, 7 }, // 0x7d
+            { 3, 2, 0, 7 }, // 0x7e
+            { 3, 3, 1, 7 }, // 0x7f
+            { 2, 2, 0, 7 }, // 0x80
+            { 4, 3, 1, 7 }, // 0x81
+            { 2, 2, 0, 7 }, // 0x82
+            { 4, 3, 1, 7 }, // 0x83
+            { 2, 2, 0, 7 }, // 0x84
+            { 4, 3, 1, 7 }, // 0x85
+            { 4, 3, 0, 7 }, // 0x86
+            { 3, 2, 1, 7 }, // 0x87
+            { 1, 1, 0, 6 }, // 0x88
+            { 4, 3, 1, 7 }, // 0x89
+            { 2, 2, 0, 7 }, // 0x8a
+            { 4, 3, 1, 7 }, // 0x8b
+            { 2, 2, 0, 7 }, // 0x8c
+            { 4, 3, 1, 7 }, // 0x8d
+            { 4, 3, 0, 7 }, // 0x8e
+            { 3, 2, 1, 7 }, // 0x8f
+            { 2, 2, 0, 7 }, // 0x90
+            { 4, 3, 1, 7 }, // 0x91
+            { 4, 3, 0, 7 }, // 0x92
+            { 3, 2, 1, 7 }, // 0x93
+            { 4, 3, 0, 7 }, // 0x94
+            { 3, 2, 1, 7 }, // 0x95
+            { 2, 2, 0, 7 }, // 0x96
+            { 5, 3, 1, 7 }, // 0x97
+            { 3, 2, 0, 7 }, // 0x98
+            { 2, 2, 1, 6 }, // 0x99
+            { 2, 2, 0, 7 }, // 0x9a
+            { 4, 3, 1, 7 }, // 0x9b
+            { 2, 2, 0, 7 }, // 0x9c
+            { 4, 3, 1, 7 }, // 0x9d
+            { 4, 3, 0, 7 }, // 0x9e
+            { 3, 3, 1, 7 }, // 0x9f
+            { 1, 1, 0, 5 }, // 0xa0
+            { 4, 3, 1, 7 }, // 0xa1
+            { 2, 2, 0, 7 }, // 0xa2
+            { 4, 3, 1, 7 }, // 0xa3
+            { 3, 2, 0, 7 }, // 0xa4
+            { 2, 2, 1, 5 }, // 0xa5
+            { 2, 2, 0, 7 }, // 0xa6
+            { 4, 3, 1, 7 }, // 0xa7
+            { 2, 2, 0, 7 }, // 0xa8
+            { 3, 2, 1, 7 }, // 0xa9
+            { 0, 0, 0, 4 }, // 0xaa
+            { 3, 3, 1, 7 }, // 0xab
+            { 3, 2, 0, 7 }, // 0xac
+            { 4, 3, 1, 7 }, // 0xad
+            { 2, 2, 0, 7 }, // 0xae
+            { 2, 2, 1, 5 }, // 0xaf
+            { 2, 2, 0, 7 }, // 0xb0
+            { 4, 3, 1, 7 }, // 0xb1
+            { 4, 3, 0, 7 }, // 0xb2
+            { 3, 2, 1, 7 }, // 0xb3
+            { 2, 2, 0, 7 }, // 0xb4
+            { 4, 3, 1, 7 }, // 0xb5
+            { 4, 3, 0, 7 }, // 0xb6
+            { 3, 3, 1, 7 }, // 0xb7
+            { 3, 2, 0, 7 }, // 0xb8
+            { 4, 3, 1, 7 }, // 0xb9
+            { 2, 2, 0, 7 }, // 0xba
+            { 2, 2, 1, 6 }, // 0xbb
+            { 3, 2, 0, 7 }, // 0xbc
+            { 4, 3, 1, 7 }, // 0xbd
+            { 2, 2, 0, 7 }, // 0xbe
+            { 3, 3, 1, 7 }, // 0xbf
+            { 1, 1, 0, 3 }, // 0xc0
+            { 4, 3, 1, 7 }, // 0xc1
+            { 3, 2, 0, 7 }, // 0xc2
+            { 2, 2, 1, 3 }, // 0xc3
+            { 2, 2, 0, 7 }, // 0xc4
+            { 4, 3, 1, 7 }, // 0xc5
+            { 2, 2, 0, 7 }, // 0xc6
+            { 4, 3, 1, 7 }, // 0xc7
+            { 2, 2, 0, 7 }, // 0xc8
+            { 3, 2, 1, 7 }, // 0xc9
+            { 3, 2, 0, 7 }, // 0xca
+            { 4, 3, 1, 7 }, // 0xcb
+            { 0, 0, 0, 2 }, // 0xcc
+            { 3, 3, 1, 7 }, // 0xcd
+            { 2, 2, 0, 7 }, // 0xce
+            { 2, 2, 1, 3 }, // 0xcf
+            { 2, 2, 0, 7 }, // 0xd0
+            { 4, 3, 1, 7 }, // 0xd1
+            { 2, 2, 0, 7 }, // 0xd2
+            { 4, 3, 1, 7 }, // 0xd3
+            { 4, 3, 0, 7 }, // 0xd4
+            { 3, 2, 1, 7 }, // 0xd5
+            { 4, 3, 0, 7 }, // 0xd6
+            { 3, 3, 1, 7 }, // 0xd7
+            { 3, 2, 0, 7 }, // 0xd8
+            { 4, 3, 1, 7 }, // 0xd9
+            { 3, 2, 0, 7 }, // 0xda
+            { 4, 3, 1, 7 }, // 0xdb
+            { 2, 2, 0, 7 }, // 0xdc
+            { 2, 2, 1, 6 }, // 0xdd
+            { 2, 2, 0, 7 }, // 0xde
+            { 3, 3, 1, 7 }, // 0xdf
+            { 2, 2, 0, 7 }, // 0xe0
+            { 3, 2, 1, 7 }, // 0xe1
+            { 3, 2, 0, 7 }, // 0xe2
+            { 4, 3, 1, 7 }, // 0xe3
+            { 3, 2, 0, 7 }, // 0xe4
+            { 4, 3, 1, 7 }, // 0xe5
+            { 3, 2, 0, 7 }, // 0xe6
+            { 4, 3, 1, 7 }, // 0xe7
+            { 4, 3, 0, 7 }, // 0xe8
+            { 5, 3, 1, 7 }, // 0xe9
+            { 2, 2, 0, 7 }, // 0xea
+            { 3, 3, 1, 7 }, // 0xeb
+            { 2, 2, 0, 7 }, // 0xec
+            { 3, 3, 1, 7 }, // 0xed
+            { 1, 1, 0, 6 }, // 0xee
+            { 3, 2, 1, 7 }, // 0xef
+            { 0, 0, 0, 1 }, // 0xf0
+            { 3, 3, 1, 7 }, // 0xf1
+            { 2, 2, 0, 7 }, // 0xf2
+            { 2, 2, 1, 3 }, // 0xf3
+            { 2, 2, 0, 7 }, // 0xf4
+            { 2, 2, 1, 5 }, // 0xf5
+            { 2, 2, 0, 7 }, // 0xf6
+            { 3, 3, 1, 7 }, // 0xf7
+            { 2, 2, 0, 7 }, // 0xf8
+            { 3, 3, 1, 7 }, // 0xf9
+            { 1, 1, 0, 5 }, // 0xfa
+            { 3, 2, 1, 7 }, // 0xfb
+            { 1, 1, 0, 3 }, // 0xfc
+            { 3, 2, 1, 7 }, // 0xfd
+            { 2, 2, 0, 7 }, // 0xfe
+            { 0, 0, 1, 0 }, // 0xff
+        };
+
+        // kernels of ternary_avx512.cpp
+        constexpr kernel_cost avx512[256] = {
+            { 0, 0, 1, 0 }, // 0x00
+            { 3, 2, 1, 7 }, // 0x01
+            { 2, 2, 0, 7 }, // 0x02
+            { 2, 2, 1, 3 }, // 0x03
+            { 2, 2, 0, 7 }, // 0x04
+            { 2, 2, 1, 5 }, // 0x05
+            { 2, 2, 0, 7 }, // 0x06
+            { 3, 2, 1, 7 }, // 0x07
+            { 2, 2, 0, 7 }, // 0x08
+            { 3, 2, 1, 7 }, // 0x09
+            { 1, 1, 0, 5 }, // 0x0a
+            { 3, 2, 1, 7 }, // 0x0b
+            { 1, 1, 0, 3 }, // 0x0c
+            { 3, 2, 1, 7 }, // 0x0d
+            { 2, 2, 0, 7 }, // 0x0e
+            { 1, 1, 1, 1 }, // 0x0f
+            { 2, 2, 0, 7 }, // 0x10
+            { 2, 2, 1, 6 }, // 0x11
+            { 2, 2, 0, 7 }, // 0x12
+            { 3, 2, 1, 7 }, // 0x13
+            { 2, 2, 0, 7 }, // 0x14
+            { 3, 2, 1, 7 }, // 0x15
+            { 4, 3, 0, 7 }, // 0x16
+            { 5, 3, 1, 7 }, // 0x17
+            { 3, 2, 0, 7 }, // 0x18
+            { 4, 3, 1, 7 }, // 0x19
+            { 3, 2, 0, 7 }, // 0x1a
+            { 4, 3, 1, 7 }, // 0x1b
+            { 3, 2, 0, 7 }, // 0x1c
+            { 4, 3, 1, 7 }, // 0x1d
+            { 2, 2, 0, 7 }, // 0x1e
+            { 3, 3, 1, 7 }, // 0x1f
+            { 2, 2, 0, 7 }, // 0x20
+            { 3, 2, 1, 7 }, // 0x21
+            { 1, 1, 0, 6 }, // 0x22
+            { 3, 2, 1, 7 }, // 0x23
+            { 3, 2, 0, 7 }, // 0x24
+            { 4, 3, 1, 7 }, // 0x25
+            { 3, 2, 0, 7 }, // 0x26
+            { 4, 3, 1, 7 }, // 0x27
+            { 2, 2, 0, 7 }, // 0x28
+            { 5, 3, 1, 7 }, // 0x29
+            { 2, 2, 0, 7 }, // 0x2a
+            { 5, 3, 1, 7 }, // 0x2b
+            { 3, 2, 0, 7 }, // 0x2c
+            { 3, 2, 1, 7 }, // 0x2d
+            { 3, 2, 0, 7 }, // 0x2e
+            { 3, 2, 1, 7 }, // 0x2f
+            { 1, 1, 0, 3 }, // 0x30
+            { 3, 2, 1, 7 }, // 0x31
+            { 2, 2, 0, 7 }, // 0x32
+            { 1, 1, 1, 2 }, // 0x33
+            { 3, 2, 0, 7 }, // 0x34
+            { 4, 3, 1, 7 }, // 0x35
+            { 2, 2, 0, 7 }, // 0x36
+            { 3, 3, 1, 7 }, // 0x37
+            { 3, 2, 0, 7 }, // 0x38
+            { 3, 2, 1, 7 }, // 0x39
+            { 3, 2, 0, 7 }, // 0x3a
+            { 3, 2, 1, 7 }, // 0x3b
+            { 1, 1, 0, 3 }, // 0x3c
+            { 4, 3, 1, 7 }, // 0x3d
+            { 3, 2, 0, 7 }, // 0x3e
+            { 2, 2, 1, 3 }, // 0x3f
+            { 2, 2, 0, 7 }, // 0x40
+            { 3, 2, 1, 7 }, // 0x41
+            { 3, 2, 0, 7 }, // 0x42
+            { 4, 3, 1, 7 }, // 0x43
+            { 1, 1, 0, 6 }, // 0x44
+            { 3, 2, 1, 7 }, // 0x45
+            { 3, 2, 0, 7 }, // 0x46
+            { 4, 3, 1, 7 }, // 0x47
+            { 2, 2, 0, 7 }, // 0x48
+            { 5, 3, 1, 7 }, // 0x49
+            { 3, 2, 0, 7 }, // 0x4a
+            { 3, 2, 1, 7 }, // 0x4b
+            { 2, 2, 0, 7 }, // 0x4c
+            { 5, 3, 1, 7 }, // 0x4d
+            { 3, 2, 0, 7 }, // 0x4e
+            { 3, 2, 1, 7 }, // 0x4f
+            { 1, 1, 0, 5 }, // 0x50
+            { 3, 2, 1, 7 }, // 0x51
+            { 3, 2, 0, 7 }, // 0x52
+            { 4, 3, 1, 7 }, // 0x53
+            { 2, 2, 0, 7 }, // 0x54
+            { 1, 1, 1, 4 }, // 0x55
+            { 2, 2, 0, 7 }, // 0x56
+            { 3, 3, 1, 7 }, // 0x57
+            { 3, 2, 0, 7 }, // 0x58
+            { 3, 2, 1, 7 }, // 0x59
+            { 1, 1, 0, 5 }, // 0x5a
+            { 4, 3, 1, 7 }, // 0x5b
+            { 3, 2, 0, 7 }, // 0x5c
+            { 3, 2, 1, 7 }, // 0x5d
+            { 3, 2, 0, 7 }, // 0x5e
+            { 2, 2, 1, 5 }, // 0x5f
+            { 2, 2, 0, 7 }, // 0x60
+            { 5, 3, 1, 7 }, // 0x61
+            { 3, 2, 0, 7 }, // 0x62
+            { 3, 2, 1, 7 }, // 0x63
+            { 3, 2, 0, 7 }, // 0x64
+            { 3, 2, 1, 7 }, // 0x65
+            { 1, 1, 0, 6 }, // 0x66
+            { 4, 3, 1, 7 }, // 0x67
+            { 4, 3, 0, 7 }, // 0x68
+            { 3, 2, 1, 7 }, // 0x69
+            { 2, 2, 0, 7 }, // 0x6a
+            { 5, 3, 1, 7 }, // 0x6b
+            { 2, 2, 0, 7 }, // 0x6c
+            { 5, 3, 1, 7 }, // 0x6d
+            { 3, 2, 0, 7 }, // 0x6e
+            { 3, 2, 1, 7 }, // 0x6f
+            { 2, 2, 0, 7 }, // 0x70
+            { 5, 3, 1, 7 }, // 0x71
+            { 3, 2, 0, 7 }, // 0x72
+            { 3, 2, 1, 7 }, // 0x73
+            { 3, 2, 0, 7 }, // 0x74
+            { 3, 2, 1, 7 }, // 0x75
+            { 3, 2, 0, 7 }, // 0x76
+            { 2, 2, 1, 6 }, // 0x77
+            { 2, 2, 0, 7 }, // 0x78
+            { 5, 3, 1, 7 }, // 0x79
+            { 3, 2, 0, 7 }, // 0x7a
+            { 3, 2, 1, 7 }, // 0x7b
+            { 3, 2, 0, 7 }, // 0x7c
+            { 3, 2, 1, 7 }, // 0x7d
+            { 3, 2, 0, 7 }, // 0x7e
+            { 3, 3, 1, 7 }, // 0x7f
+            { 2, 2, 0, 7 }, // 0x80
+            { 4, 3, 1, 7 }, // 0x81
+            { 2, 2, 0, 7 }, // 0x82
+            { 4, 3, 1, 7 }, // 0x83
+            { 2, 2, 0, 7 }, // 0x84
+            { 4, 3, 1, 7 }, // 0x85
+            { 4, 3, 0, 7 }, // 0x86
+            { 3, 2, 1, 7 }, // 0x87
+            { 1, 1, 0, 6 }, // 0x88
+            { 4, 3, 1, 7 }, // 0x89
+            { 2, 2, 0, 7 }, // 0x8a
+            { 4, 3, 1, 7 }, // 0x8b
+            { 2, 2, 0, 7 }, // 0x8c
+            { 4, 3, 1, 7 }, // 0x8d
+            { 4, 3, 0, 7 }, // 0x8e
+            { 3, 2, 1, 7 }, // 0x8f
+            { 2, 2, 0, 7 }, // 0x90
+            { 4, 3, 1, 7 }, // 0x91
+            { 4, 3, 0, 7 }, // 0x92
+            { 3, 2, 1, 7 }, // 0x93
+            { 4, 3, 0, 7 }, // 0x94
+            { 3, 2, 1, 7 }, // 0x95
+            { 2, 2, 0, 7 }, // 0x96
+            { 5, 3, 1, 7 }, // 0x97
+            { 3, 2, 0, 7 }, // 0x98
+            { 2, 2, 1, 6 }, // 0x99
+            { 2, 2, 0, 7 }, // 0x9a
+            { 4, 3, 1, 7 }, // 0x9b
+            { 2, 2, 0, 7 }, // 0x9c
+            { 4, 3, 1, 7 }, // 0x9d
+            { 4, 3, 0, 7 }, // 0x9e
+            { 3, 3, 1, 7 }, // 0x9f
+            { 1, 1, 0, 5 }, // 0xa0
+            { 4, 3, 1, 7 }, // 0xa1
+            { 2, 2, 0, 7 }, // 0xa2
+            { 4, 3, 1, 7 }, // 0xa3
+            { 3, 2, 0, 7 }, // 0xa4
+            { 2, 2, 1, 5 }, // 0xa5
+            { 2, 2, 0, 7 }, // 0xa6
+            { 4, 3, 1, 7 }, // 0xa7
+            { 2, 2, 0, 7 }, // 0xa8
+            { 3, 2, 1, 7 }, // 0xa9
+            { 0, 0, 0, 4 }, // 0xaa
+            { 3, 3, 1, 7 }, // 0xab
+            { 3, 2, 0, 7 }, // 0xac
+            { 4, 3, 1, 7 }, // 0xad
+            { 2, 2, 0, 7 }, // 0xae
+            { 2, 2, 1, 5 }, // 0xaf
+            { 2, 2, 0, 7 }, // 0xb0
+            { 4, 3, 1, 7 }, // 0xb1
+            { 4, 3, 0, 7 }, // 0xb2
+            { 3, 2, 1, 7 }, // 0xb3
+            { 2, 2, 0, 7 }, // 0xb4
+            { 4, 3, 1, 7 }, // 0xb5
+            { 4, 3, 0, 7 }, // 0xb6
+            { 3, 3, 1, 7 }, // 0xb7
+            { 3, 2, 0, 7 }, // 0xb8
+            { 4, 3, 1, 7 }, // 0xb9
+            { 2, 2, 0, 7 }, // 0xba
+            { 2, 2, 1, 6 }, // 0xbb
+            { 3, 2, 0, 7 }, // 0xbc
+            { 4, 3, 1, 7 }, // 0xbd
+            { 2, 2, 0, 7 }, // 0xbe
+            { 3, 3, 1, 7 }, // 0xbf
+            { 1, 1, 0, 3 }, // 0xc0
+            { 4, 3, 1, 7 }, // 0xc1
+            { 3, 2, 0, 7 }, // 0xc2
+            { 2, 2, 1, 3 }, // 0xc3
+            { 2, 2, 0, 7 }, // 0xc4
+            { 4, 3, 1, 7 }, // 0xc5
+            { 2, 2, 0, 7 }, // 0xc6
+            { 4, 3, 1, 7 }, // 0xc7
+            { 2, 2, 0, 7 }, // 0xc8
+            { 3, 2, 1, 7 }, // 0xc9
+            { 3, 2, 0, 7 }, // 0xca
+            { 4, 3, 1, 7 }, // 0xcb
+            { 0, 0, 0, 2 }, // 0xcc
+            { 3, 3, 1, 7 }, // 0xcd
+            { 2, 2, 0, 7 }, // 0xce
+            { 2, 2, 1, 3 }, // 0xcf
+            { 2, 2, 0, 7 }, // 0xd0
+            { 4, 3, 1, 7 }, // 0xd1
+            { 2, 2, 0, 7 }, // 0xd2
+            { 4, 3, 1, 7 }, // 0xd3
+            { 4, 3, 0, 7 }, // 0xd4
+            { 3, 2, 1, 7 }, // 0xd5
+            { 4, 3, 0, 7 }, // 0xd6
+            { 3, 3, 1, 7 }, // 0xd7
+            { 3, 2, 0, 7 }, // 0xd8
+            { 4, 3, 1, 7 }, // 0xd9
+            { 3, 2, 0, 7 }, // 0xda
+            { 4, 3, 1, 7 }, // 0xdb
+            { 2, 2, 0, 7 }, // 0xdc
+            { 2, 2, 1, 6 }, // 0xdd
+            { 2, 2, 0, 7 }, // 0xde
+            { 3, 3, 1, 7 }, // 0xdf
+            { 2, 2, 0, 7 }, // 0xe0
+            { 3, 2, 1, 7 }, // 0xe1
+            { 3, 2, 0, 7 }, // 0xe2
+            { 4, 3, 1, 7 }, // 0xe3
+            { 3, 2, 0, 7 }, // 0xe4
+            { 4, 3, 1, 7 }, // 0xe5
+            { 3, 2, 0, 7 }, // 0xe6
+            { 4, 3, 1, 7 }, // 0xe7
+            { 4, 3, 0, 7 }, // 0xe8
+            { 5, 3, 1, 7 }, // 0xe9
+            { 2, 2, 0, 7 }, // 0xea
+            { 3, 3, 1, 7 }, // 0xeb
+            { 2, 2, 0, 7 }, // 0xec
+            { 3, 3, 1, 7 }, // 0xed
+            { 1, 1, 0, 6 }, // 0xee
+            { 3, 2, 1, 7 }, // 0xef
+            { 0, 0, 0, 1 }, // 0xf0
+            { 3, 3, 1, 7 }, // 0xf1
+            { 2, 2, 0, 7 }, // 0xf2
+            { 2, 2, 1, 3 }, // 0xf3
+            { 2, 2, 0, 7 }, // 0xf4
+            { 2, 2, 1, 5 }, // 0xf5
+            { 2, 2, 0, 7 }, // 0xf6
+            { 3, 3, 1, 7 }, // 0xf7
+            { 2, 2, 0, 7 }, // 0xf8
+            { 3, 3, 1, 7 }, // 0xf9
+            { 1, 1, 0, 5 }, // 0xfa
+            { 3, 2, 1, 7 }, // 0xfb
+            { 1, 1, 0, 3 }, // 0xfc
+            { 3, 2, 1, 7 }, // 0xfd
+            { 2, 2, 0, 7 }, // 0xfe
+            { 0, 0, 1, 0 }, // 0xff
+        };
+
+        // kernels of ternary_avx512mask.cpp
+        constexpr kernel_cost avx512mask[256] = {
+            { 0, 0, 1, 0 }, // 0x00
+            { 3, 2, 0, 7 }, // 0x01
+            { 2, 2, 0, 7 }, // 0x02
+            { 2, 2, 0, 3 }, // 0x03
+            { 2, 2, 0, 7 }, // 0x04
+            { 2, 2, 0, 5 }, // 0x05
+            { 2, 2, 0, 7 }, // 0x06
+            { 3, 2, 0, 7 }, // 0x07
+            { 2, 2, 0, 7 }, // 0x08
+            { 2, 2, 0, 7 }, // 0x09
+            { 1, 1, 0, 5 }, // 0x0a
+            { 3, 2, 0, 7 }, // 0x0b
+            { 1, 1, 0, 3 }, // 0x0c
+            { 3, 2, 0, 7 }, // 0x0d
+            { 2, 2, 0, 7 }, // 0x0e
+            { 1, 1, 0, 1 }, // 0x0f
+            { 2, 2, 0, 7 }, // 0x10
+            { 2, 2, 0, 6 }, // 0x11
+            { 2, 2, 0, 7 }, // 0x12
+            { 3, 2, 0, 7 }, // 0x13
+            { 2, 2, 0, 7 }, // 0x14
+            { 3, 2, 0, 7 }, // 0x15
+            { 4, 3, 0, 7 }, // 0x16
+            { 5, 3, 0, 7 }, // 0x17
+            { 3, 2, 0, 7 }, // 0x18
+            { 4, 3, 0, 7 }, // 0x19
+            { 3, 2, 0, 7 }, // 0x1a
+            { 4, 3, 0, 7 }, // 0x1b
+            { 3, 2, 0, 7 }, // 0x1c
+            { 4, 3, 0, 7 }, // 0x1d
+            { 2, 2, 0, 7 }, // 0x1e
+            { 3, 3, 0, 7 }, // 0x1f
+            { 2, 2, 0, 7 }, // 0x20
+            { 2, 2, 0, 7 }, // 0x21
+            { 1, 1, 0, 6 }, // 0x22
+            { 3, 2, 0, 7 }, // 0x23
+            { 3, 2, 0, 7 }, // 0x24
+            { 4, 3, 0, 7 }, // 0x25
+            { 3, 2, 0, 7 }, // 0x26
+            { 4, 3, 0, 7 }, // 0x27
+            { 2, 2, 0, 7 }, // 0x28
+            { 5, 3, 0, 7 }, // 0x29
+            { 2, 2, 0, 7 }, // 0x2a
+            { 5, 3, 0, 7 }, // 0x2b
+            { 3, 2, 0, 7 }, // 0x2c
+            { 3, 2, 0, 7 }, // 0x2d
+            { 3, 2, 0, 7 }, // 0x2e
+            { 3, 2, 0, 7 }, // 0x2f
+            { 1, 1, 0, 3 }, // 0x30
+            { 3, 2, 0, 7 }, // 0x31
+            { 2, 2, 0, 7 }, // 0x32
+            { 1, 1, 0, 2 }, // 0x33
+            { 3, 2, 0, 7 }, // 0x34
+            { 4, 3, 0, 7 }, // 0x35
+            { 2, 2, 0, 7 }, // 0x36
+            { 3, 3, 0, 7 }, // 0x37
+            { 3, 2, 0, 7 }, // 0x38
+            { 3, 2, 0, 7 }, // 0x39
+            { 3, 2, 0, 7 }, // 0x3a
+            { 3, 2, 0, 7 }, // 0x3b
+            { 1, 1, 0, 3 }, // 0x3c
+            { 4, 3, 0, 7 }, // 0x3d
+            { 3, 2, 0, 7 }, // 0x3e
+            { 2, 2, 0, 3 }, // 0x3f
+            { 2, 2, 0, 7 }, // 0x40
+            { 2, 2, 0, 7 }, // 0x41
+            { 3, 2, 0, 7 }, // 0x42
+            { 4, 3, 0, 7 }, // 0x43
+            { 1, 1, 0, 6 }, // 0x44
+            { 3, 2, 0, 7 }, // 0x45
+            { 3, 2, 0, 7 }, // 0x46
+            { 4, 3, 0, 7 }, // 0x47
+            { 2, 2, 0, 7 }, // 0x48
+            { 5, 3, 0, 7 }, // 0x49
+            { 3, 2, 0, 7 }, // 0x4a
+            { 3, 2, 0, 7 }, // 0x4b
+            { 2, 2, 0, 7 }, // 0x4c
+            { 5, 3, 0, 7 }, // 0x4d
+            { 3, 2, 0, 7 }, // 0x4e
+            { 3, 2, 0, 7 }, // 0x4f
+            { 1, 1, 0, 5 }, // 0x50
+            { 3, 2, 0, 7 }, // 0x51
+            { 3, 2, 0, 7 }, // 0x52
+            { 4, 3, 0, 7 }, // 0x53
+            { 2, 2, 0, 7 }, // 0x54
+            { 1, 1, 0, 4 }, // 0x55
+            { 2, 2, 0, 7 }, // 0x56
+            { 3, 3, 0, 7 }, // 0x57
+            { 3, 2, 0, 7 }, // 0x58
+            { 3, 2, 0, 7 }, // 0x59
+            { 1, 1, 0, 5 }, // 0x5a
+            { 4, 3, 0, 7 }, // 0x5b
+            { 3, 2, 0, 7 }, // 0x5c
+            { 3, 2, 0, 7 }, // 0x5d
+            { 3, 2, 0, 7 }, // 0x5e
+            { 2, 2, 0, 5 }, // 0x5f
+            { 2, 2, 0, 7 }, // 0x60
+            { 5, 3, 0, 7 }, // 0x61
+            { 3, 2, 0, 7 }, // 0x62
+            { 3, 2, 0, 7 }, // 0x63
+            { 3, 2, 0, 7 }, // 0x64
+            { 3, 2, 0, 7 }, // 0x65
+            { 1, 1, 0, 6 }, // 0x66
+            { 4, 3, 0, 7 }, // 0x67
+            { 4, 3, 0, 7 }, // 0x68
+            { 2, 2, 0, 7 }, // 0x69
+            { 2, 2, 0, 7 }, // 0x6a
+            { 5, 3, 0, 7 }, // 0x6b
+            { 2, 2, 0, 7 }, // 0x6c
+            { 5, 3, 0, 7 }, // 0x6d
+            { 3, 2, 0, 7 }, // 0x6e
+            { 3, 2, 0, 7 }, // 0x6f
+            { 2, 2, 0, 7 }, // 0x70
+            { 5, 3, 0, 7 }, // 0x71
+            { 3, 2, 0, 7 }, // 0x72
+            { 3, 2, 0, 7 }, // 0x73
+            { 3, 2, 0, 7 }, // 0x74
+            { 3, 2, 0, 7 }, // 0x75
+            { 3, 2, 0, 7 }, // 0x76
+            { 2, 2, 0, 6 }, // 0x77
+            { 2, 2, 0, 7 }, // 0x78
+            { 5, 3, 0, 7 }, // 0x79
+            { 3, 2, 0, 7 }, // 0x7a
+            { 3, 2, 0, 7 }, // 0x7b
+            { 3, 2, 0, 7 }, // 0x7c
+            { 3, 2, 0, 7 }, // 0x7d
+            { 3, 2, 0, 7 }, // 0x7e
+            { 3, 3, 0, 7 }, // 0x7f
+            { 2, 2, 0, 7 }, // 0x80
+            { 4, 3, 0, 7 }, // 0x81
+            { 2, 2, 0, 7 }, // 0x82
+            { 4, 3, 0, 7 }, // 0x83
+            { 2, 2, 0, 7 }, // 0x84
+            { 4, 3, 0, 7 }, // 0x85
+            { 4, 3, 0, 7 }, // 0x86
+            { 2, 2, 0, 7 }, // 0x87
+            { 1, 1, 0, 6 }, // 0x88
+            { 4, 3, 0, 7 }, // 0x89
+            { 2, 2, 0, 7 }, // 0x8a
+            { 4, 3, 0, 7 }, // 0x8b
+            { 2, 2, 0, 7 }, // 0x8c
+            { 4, 3, 0, 7 }, // 0x8d
+            { 4, 3, 0, 7 }, // 0x8e
+            { 3, 2, 0, 7 }, // 0x8f
+            { 2, 2, 0, 7 }, // 0x90
+            { 4, 3, 0, 7 }, // 0x91
+            { 4, 3, 0, 7 }, // 0x92
+            { 2, 2, 0, 7 }, // 0x93
+            { 4, 3, 0, 7 }, // 0x94
+            { 2, 2, 0, 7 }, // 0x95
+            { 2, 2, 0, 7 }, // 0x96
+            { 5, 3, 0, 7 }, // 0x97
+            { 3, 2, 0, 7 }, // 0x98
+            { 1, 1, 0, 6 }, // 0x99
+            { 2, 2, 0, 7 }, // 0x9a
+            { 4, 3, 0, 7 }, // 0x9b
+            { 2, 2, 0, 7 }, // 0x9c
+            { 4, 3, 0, 7 }, // 0x9d
+            { 4, 3, 0, 7 }, // 0x9e
+            { 3, 3, 0, 7 }, // 0x9f
+            { 1, 1, 0, 5 }, // 0xa0
+            { 4, 3, 0, 7 }, // 0xa1
+            { 2, 2, 0, 7 }, // 0xa2
+            { 4, 3, 0, 7 }, // 0xa3
+            { 3, 2, 0, 7 }, // 0xa4
+            { 1, 1, 0, 5 }, // 0xa5
+            { 2, 2, 0, 7 }, // 0xa6
+            { 4, 3, 0, 7 }, // 0xa7
+            { 2, 2, 0, 7 }, // 0xa8
+            { 2, 2, 0, 7 }, // 0xa9
+            { 0, 0, 0, 4 }, // 0xaa
+            { 3, 3, 0, 7 }, // 0xab
+            { 3, 2, 0, 7 }, // 0xac
+            { 4, 3, 0, 7 }, // 0xad
+            { 2, 2, 0, 7 }, // 0xae
+            { 2, 2, 0, 5 }, // 0xaf
+            { 2, 2, 0, 7 }, // 0xb0
+            { 4, 3, 0, 7 }, // 0xb1
+            { 4, 3, 0, 7 }, // 0xb2
+            { 3, 2, 0, 7 }, // 0xb3
+            { 2, 2, 0, 7 }, // 0xb4
+            { 4, 3, 0, 7 }, // 0xb5
+            { 4, 3, 0, 7 }, // 0xb6
+            { 3, 3, 0, 7 }, // 0xb7
+            { 3, 2, 0, 7 }, // 0xb8
+            { 3, 2, 0, 7 }, // 0xb9
+            { 2, 2, 0, 7 }, // 0xba
+            { 2, 2, 0, 6 }, // 0xbb
+            { 3, 2, 0, 7 }, // 0xbc
+            { 4, 3, 0, 7 }, // 0xbd
+            { 2, 2, 0, 7 }, // 0xbe
+            { 3, 3, 0, 7 }, // 0xbf
+            { 1, 1, 0, 3 }, // 0xc0
+            { 4, 3, 0, 7 }, // 0xc1
+            { 3, 2, 0, 7 }, // 0xc2
+            { 1, 1, 0, 3 }, // 0xc3
+            { 2, 2, 0, 7 }, // 0xc4
+            { 4, 3, 0, 7 }, // 0xc5
+            { 2, 2, 0, 7 }, // 0xc6
+            { 4, 3, 0, 7 }, // 0xc7
+            { 2, 2, 0, 7 }, // 0xc8
+            { 2, 2, 0, 7 }, // 0xc9
+            { 3, 2, 0, 7 }, // 0xca
+            { 4, 3, 0, 7 }, // 0xcb
+            { 0, 0, 0, 2 }, // 0xcc
+            { 3, 3, 0, 7 }, // 0xcd
+            { 2, 2, 0, 7 }, // 0xce
+            { 2, 2, 0, 3 }, // 0xcf
+            { 2, 2, 0, 7 }, // 0xd0
+            { 4, 3, 0, 7 }, // 0xd1
+            { 2, 2, 0, 7 }, // 0xd2
+            { 4, 3, 0, 7 }, // 0xd3
+            { 4, 3, 0, 7 }, // 0xd4
+            { 3, 2, 0, 7 }, // 0xd5
+            { 4, 3, 0, 7 }, // 0xd6
+            { 3, 3, 0, 7 }, // 0xd7
+            { 3, 2, 0, 7 }, // 0xd8
+            { 3, 2, 0, 7 }, // 0xd9
+            { 3, 2, 0, 7 }, // 0xda
+            { 4, 3, 0, 7 }, // 0xdb
+            { 2, 2, 0, 7 }, // 0xdc
+            { 2, 2, 0, 6 }, // 0xdd
+            { 2, 2, 0, 7 }, // 0xde
+            { 3, 3, 0, 7 }, // 0xdf
+            { 2, 2, 0, 7 }, // 0xe0
+            { 2, 2, 0, 7 }, // 0xe1
+            { 3, 2, 0, 7 }, // 0xe2
+            { 4, 3, 0, 7 }, // 0xe3
+            { 3, 2, 0, 7 }, // 0xe4
+            { 4, 3, 0, 7 }, // 0xe5
+            { 3, 2, 0, 7 }, // 0xe6
+            { 4, 3, 0, 7 }, // 0xe7
+            { 4, 3, 0, 7 }, // 0xe8
+            { 5, 3, 0, 7 }, // 0xe9
+            { 2, 2, 0, 7 }, // 0xea
+            { 2, 2, 0, 7 }, // 0xeb
+            { 2, 2, 0, 7 }, // 0xec
+            { 2, 2, 0, 7 }, // 0xed
+            { 1, 1, 0, 6 }, // 0xee
+            { 3, 2, 0, 7 }, // 0xef
+            { 0, 0, 0, 1 }, // 0xf0
+            { 3, 3, 0, 7 }, // 0xf1
+            { 2, 2, 0, 7 }, // 0xf2
+            { 2, 2, 0, 3 }, // 0xf3
+            { 2, 2, 0, 7 }, // 0xf4
+            { 2, 2, 0, 5 }, // 0xf5
+            { 2, 2, 0, 7 }, // 0xf6
+            { 3, 3, 0, 7 }, // 0xf7
+            { 2, 2, 0, 7 }, // 0xf8
+            { 2, 2, 0, 7 }, // 0xf9
+            { 1, 1, 0, 5 }, // 0xfa
+            { 3, 2, 0, 7 }, // 0xfb
+            { 1, 1, 0, 3 }, // 0xfc
+            { 3, 2, 0, 7 }, // 0xfd
+            { 2, 2, 0, 7 }, // 0xfe
+            { 0, 0, 1, 0 }, // 0xff
+        };
+
+        // kernels of ternary_sse_ps.cpp
+        constexpr kernel_cost sse_ps[256] = {
+            { 0, 0, 1, 0 }, // 0x00
+            { 3, 2, 1, 7 }, // 0x01
+            { 2, 2, 0, 7 }, // 0x02
+            { 2, 2, 1, 3 }, // 0x03
+            { 2, 2, 0, 7 }, // 0x04
+            { 2, 2, 1, 5 }, // 0x05
+            { 2, 2, 0, 7 }, // 0x06
+            { 3, 2, 1, 7 }, // 0x07
+            { 2, 2, 0, 7 }, // 0x08
+            { 3, 2, 1, 7 }, // 0x09
+            { 1, 1, 0, 5 }, // 0x0a
+            { 3, 2, 1, 7 }, // 0x0b
+            { 1, 1, 0, 3 }, // 0x0c
+            { 3, 2, 1, 7 }, // 0x0d
+            { 2, 2, 0, 7 }, // 0x0e
+            { 1, 1, 1, 1 }, // 0x0f
+            { 2, 2, 0, 7 }, // 0x10
+            { 2, 2, 1, 6 }, // 0x11
+            { 2, 2, 0, 7 }, // 0x12
+            { 3, 2, 1, 7 }, // 0x13
+            { 2, 2, 0, 7 }, // 0x14
+            { 3, 2, 1, 7 }, // 0x15
+            { 4, 3, 0, 7 }, // 0x16
+            { 5, 3, 1, 7 }, // 0x17
+            { 3, 2, 0, 7 }, // 0x18
+            { 4, 3, 1, 7 }, // 0x19
+            { 3, 2, 0, 7 }, // 0x1a
+            { 4, 3, 1, 7 }, // 0x1b
+            { 3, 2, 0, 7 }, // 0x1c
+            { 4, 3, 1, 7 }, // 0x1d
+            { 2, 2, 0, 7 }, // 0x1e
+            { 3, 3, 1, 7 }, // 0x1f
+            { 2, 2, 0, 7 }, // 0x20
+            { 3, 2, 1, 7 }, // 0x21
+            { 1, 1, 0, 6 }, // 0x22
+            { 3, 2, 1, 7 }, // 0x23
+            { 3, 2, 0, 7 }, // 0x24
+            { 4, 3, 1, 7 }, // 0x25
+            { 3, 2, 0, 7 }, // 0x26
+            { 4, 3, 1, 7 }, // 0x27
+            { 2, 2, 0, 7 }, // 0x28
+            { 5, 3, 1, 7 }, // 0x29
+            { 2, 2, 0, 7 }, // 0x2a
+            { 5, 3, 1, 7 }, // 0x2b
+            { 3, 2, 0, 7 }, // 0x2c
+            { 3, 2, 1, 7 }, // 0x2d
+            { 3, 2, 0, 7 }, // 0x2e
+            { 3, 2, 1, 7 }, // 0x2f
+            { 1, 1, 0, 3 }, // 0x30
+            { 3, 2, 1, 7 }, // 0x31
+            { 2, 2, 0, 7 }, // 0x32
+            { 1, 1, 1, 2 }, // 0x33
+            { 3, 2, 0, 7 }, // 0x34
+            { 4, 3, 1, 7 }, // 0x35
+            { 2, 2, 0, 7 }, // 0x36
+            { 3, 3, 1, 7 }, // 0x37
+            { 3, 2, 0, 7 }, // 0x38
+            { 3, 2, 1, 7 }, // 0x39
+            { 3, 2, 0, 7 }, // 0x3a
+            { 3, 2, 1, 7 }, // 0x3b
+            { 1, 1, 0, 3 }, // 0x3c
+            { 4, 3, 1, 7 }, // 0x3d
+            { 3, 2, 0, 7 }, // 0x3e
+            { 2, 2, 1, 3 }, // 0x3f
+            { 2, 2, 0, 7 }, // 0x40
+            { 3, 2, 1, 7 }, // 0x41
+            { 3, 2, 0, 7 }, // 0x42
+            { 4, 3, 1, 7 }, // 0x43
+            { 1, 1, 0, 6 }, // 0x44
+            { 3, 2, 1, 7 }, // 0x45
+            { 3, 2, 0, 7 }, // 0x46
+            { 4, 3, 1, 7 }, // 0x47
+            { 2, 2, 0, 7 }, // 0x48
+            { 5, 3, 1, 7 }, // 0x49
+            { 3, 2, 0, 7 }, // 0x4a
+            { 3, 2, 1, 7 }, // 0x4b
+            { 2, 2, 0, 7 }, // 0x4c
+            { 5, 3, 1, 7 }, // 0x4d
+            { 3, 2, 0, 7 }, // 0x4e
+            { 3, 2, 1, 7 }, // 0x4f
+            { 1, 1, 0, 5 }, // 0x50
+            { 3, 2, 1, 7 }, // 0x51
+            { 3, 2, 0, 7 }, // 0x52
+            { 4, 3, 1, 7 }, // 0x53
+            { 2, 2, 0, 7 }, // 0x54
+            { 1, 1, 1, 4 }, // 0x55
+            { 2, 2, 0, 7 }, // 0x56
+            { 3, 3, 1, 7 }, // 0x57
+            { 3, 2, 0, 7 }, // 0x58
+            { 3, 2, 1, 7 }, // 0x59
+            { 1, 1, 0, 5 }, // 0x5a
+            { 4, 3, 1, 7 }, // 0x5b
+            { 3, 2, 0, 7 }, // 0x5c
+            { 3, 2, 1, 7 }, // 0x5d
+            { 3, 2, 0, 7 }, // 0x5e
+            { 2, 2, 1, 5 }, // 0x5f
+            { 2, 2, 0, 7 }, // 0x60
+            { 5, 3, 1, 7 }, // 0x61
+            { 3, 2, 0, 7 }, // 0x62
+            { 3, 2, 1, 7 }, // 0x63
+            { 3, 2, 0, 7 }, // 0x64
+            { 3, 2, 1, 7 }, // 0x65
+            { 1, 1, 0, 6 }, // 0x66
+            { 4, 3, 1, 7 }, // 0x67
+            { 4, 3, 0, 7 }, // 0x68
+            { 3, 2, 1, 7 }, // 0x69
+            { 2, 2, 0, 7 }, // 0x6a
+            { 5, 3, 1, 7 }, // 0x6b
+            { 2, 2, 0, 7 }, // 0x6c
+            { 5, 3, 1, 7 }, // 0x6d
+            { 3, 2, 0, 7 }, // 0x6e
+            { 3, 2, 1, 7 }, // 0x6f
+            { 2, 2, 0, 7 }, // 0x70
+            { 5, 3, 1, 7 }, // 0x71
+            { 3, 2, 0, 7 }, // 0x72
+            { 3, 2, 1, 7 }, // 0x73
+            { 3, 2, 0, 7 }, // 0x74
+            { 3, 2, 1, 7 }, // 0x75
+            { 3, 2, 0, 7 }, // 0x76
+            { 2, 2, 1, 6 }, // 0x77
+            { 2, 2, 0, 7 }, // 0x78
+            { 5, 3, 1, 7 }, // 0x79
+            { 3, 2, 0, 7 }, // 0x7a
+            { 3, 2, 1, 7 }, // 0x7b
+            { 3, 2, 0, 7 }, // 0x7c
+            { 3, 2, 1, 7 }, // 0x7d
+            { 3, 2, 0, 7 }, // 0x7e
+            { 3, 3, 1, 7 }, // 0x7f
+            { 2, 2, 0, 7 }, // 0x80
+            { 4, 3, 1, 7 }, // 0x81
+            { 2, 2, 0, 7 }, // 0x82
+            { 4, 3, 1, 7 }, // 0x83
+            { 2, 2, 0, 7 }, // 0x84
+            { 4, 3, 1, 7 }, // 0x85
+            { 4, 3, 0, 7 }, // 0x86
+            { 3, 2, 1, 7 }, // 0x87
+            { 1, 1, 0, 6 }, // 0x88
+            { 4, 3, 1, 7 }, // 0x89
+            { 2, 2, 0, 7 }, // 0x8a
+            { 4, 3, 1, 7 }, // 0x8b
+            { 2, 2, 0, 7 }, // 0x8c
+            { 4, 3, 1, 7 }, // 0x8d
+            { 4, 3, 0, 7 }, // 0x8e
+            { 3, 2, 1, 7 }, // 0x8f
+            { 2, 2, 0, 7 }, // 0x90
+            { 4, 3, 1, 7 }, // 0x91
+            { 4, 3, 0, 7 }, // 0x92
+            { 3, 2, 1, 7 }, // 0x93
+            { 4, 3, 0, 7 }, // 0x94
+            { 3, 2, 1, 7 }, // 0x95
+            { 2, 2, 0, 7 }, // 0x96
+            { 5, 3, 1, 7 }, // 0x97
+            { 3, 2, 0, 7 }, // 0x98
+            { 2, 2, 1, 6 }, // 0x99
+            { 2, 2, 0, 7 }, // 0x9a
+            { 4, 3, 1, 7 }, // 0x9b
+            { 2, 2, 0, 7 }, // 0x9c
+            { 4, 3, 1, 7 }, // 0x9d
+            { 4, 3, 0, 7 }, // 0x9e
+            { 3, 3, 1, 7 }, // 0x9f
+            { 1, 1, 0, 5 }, // 0xa0
+            { 4, 3, 1, 7 }, // 0xa1
+            { 2, 2, 0, 7 }, // 0xa2
+            { 4, 3, 1, 7 }, // 0xa3
+            { 3, 2, 0, 7 }, // 0xa4
+            { 2, 2, 1, 5 }, // 0xa5
+            { 2, 2, 0, 7 }, // 0xa6
+            { 4, 3, 1, 7 }, // 0xa7
+            { 2, 2, 0, 7 }, // 0xa8
+            { 3, 2, 1, 7 }, // 0xa9
+            { 0, 0, 0, 4 }, // 0xaa
+            { 3, 3, 1, 7 }, // 0xab
+            { 3, 2, 0, 7 }, // 0xac
+            { 4, 3, 1, 7 }, // 0xad
+            { 2, 2, 0, 7 }, // 0xae
+            { 2, 2, 1, 5 }, // 0xaf
+            { 2, 2, 0, 7 }, // 0xb0
+            { 4, 3, 1, 7 }, // 0xb1
+            { 4, 3, 0, 7 }, // 0xb2
+            { 3, 2, 1, 7 }, // 0xb3
+            { 2, 2, 0, 7 }, // 0xb4
+            { 4, 3, 1, 7 }, // 0xb5
+            { 4, 3, 0, 7 }, // 0xb6
+            { 3, 3, 1, 7 }, // 0xb7
+            { 3, 2, 0, 7 }, // 0xb8
+            { 4, 3, 1, 7 }, // 0xb9
+            { 2, 2, 0, 7 }, // 0xba
+            { 2, 2, 1, 6 }, // 0xbb
+            { 3, 2, 0, 7 }, // 0xbc
+            { 4, 3, 1, 7 }, // 0xbd
+            { 2, 2, 0, 7 }, // 0xbe
+            { 3, 3, 1, 7 }, // 0xbf
+            { 1, 1, 0, 3 }, // 0xc0
+            { 4, 3, 1, 7 }, // 0xc1
+            { 3, 2, 0, 7 }, // 0xc2
+            { 2, 2, 1, 3 }, // 0xc3
+            { 2, 2, 0, 7 }, // 0xc4
+            { 4, 3, 1, 7 }, // 0xc5
+            { 2, 2, 0, 7 }, // 0xc6
+            { 4, 3, 1, 7 }, // 0xc7
+            { 2, 2, 0, 7 }, // 0xc8
+            { 3, 2, 1, 7 }, // 0xc9
+            { 3, 2, 0, 7 }, // 0xca
+            { 4, 3, 1, 7 }, // 0xcb
+            { 0, 0, 0, 2 }, // 0xcc
+            { 3, 3, 1, 7 }, // 0xcd
+            { 2, 2, 0, 7 }, // 0xce
+            { 2, 2, 1, 3 }, // 0xcf
+            { 2, 2, 0, 7 }, // 0xd0
+            { 4, 3, 1, 7 }, // 0xd1
+            { 2, 2, 0, 7 }, // 0xd2
+            { 4, 3, 1, 7 }, // 0xd3
+            { 4, 3, 0, 7 }, // 0xd4
+            { 3, 2, 1, 7 }, // 0xd5
+            { 4, 3, 0, 7 }, // 0xd6
+            { 3, 3, 1, 7 }, // 0xd7
+            { 3, 2, 0, 7 }, // 0xd8
+            { 4, 3, 1, 7 }, // 0xd9
+            { 3, 2, 0, 7 }, // 0xda
+            { 4, 3, 1, 7 }, // 0xdb
+            { 2, 2, 0, 7 }, // 0xdc
+            { 2, 2, 1, 6 }, // 0xdd
+            { 2, 2, 0, 7 }, // 0xde
+            { 3, 3, 1, 7 }, // 0xdf
+            { 2, 2, 0, 7 }, // 0xe0
+            { 3, 2, 1, 7 }, // 0xe1
+            { 3, 2, 0, 7 }, // 0xe2
+            { 4, 3, 1, 7 }, // 0xe3
+            { 3, 2, 0, 7 }, // 0xe4
+            { 4, 3, 1, 7 }, // 0xe5
+            { 3, 2, 0, 7 }, // 0xe6
+            { 4, 3, 1, 7 }, // 0xe7
+            { 4, 3, 0, 7 }, // 0xe8
+            { 5, 3, 1, 7 }, // 0xe9
+            { 2, 2, 0, 7 }, // 0xea
+            { 3, 3, 1, 7 }, // 0xeb
+            { 2, 2, 0, 7 }, // 0xec
+            { 3, 3, 1, 7 }, // 0xed
+            { 1, 1, 0, 6 }, // 0xee
+            { 3, 2, 1, 7 }, // 0xef
+            { 0, 0, 0, 1 }, // 0xf0
+            { 3, 3, 1, 7 }, // 0xf1
+            { 2, 2, 0, 7 }, // 0xf2
+            { 2, 2, 1, 3 }, // 0xf3
+            { 2, 2, 0, 7 }, // 0xf4
+            { 2, 2, 1, 5 }, // 0xf5
+            { 2, 2, 0, 7 }, // 0xf6
+            { 3, 3, 1, 7 }, // 0xf7
+            { 2, 2, 0, 7 }, // 0xf8
+            { 3, 3, 1, 7 }, // 0xf9
+            { 1, 1, 0, 5 }, // 0xfa
+            { 3, 2, 1, 7 }, // 0xfb
+            { 1, 1, 0, 3 }, // 0xfc
+            { 3, 2, 1, 7 }, // 0xfd
+            { 2, 2, 0, 7 }, // 0xfe
+            { 0, 0, 1, 0 }, // 0xff
+        };
+
+        // kernels of ternary_sse_pd.cpp
+        constexpr kernel_cost sse_pd[256] = {
+            { 0, 0, 1, 0 }, // 0x00
+            { 3, 2, 1, 7 }, // 0x01
+            { 2, 2, 0, 7 }, // 0x02
+            { 2, 2, 1, 3 }, // 0x03
+            { 2, 2, 0, 7 }, // 0x04
+            { 2, 2, 1, 5 }, // 0x05
+            { 2, 2, 0, 7 }, // 0x06
+            { 3, 2, 1, 7 }, // 0x07
+            { 2, 2, 0, 7 }, // 0x08
+            { 3, 2, 1, 7 }, // 0x09
+            { 1, 1, 0, 5 }, // 0x0a
+            { 3, 2, 1, 7 }, // 0x0b
+            { 1, 1, 0, 3 }, // 0x0c
+            { 3, 2, 1, 7 }, // 0x0d
+            { 2, 2, 0, 7 }, // 0x0e
+            { 1, 1, 1, 1 }, // 0x0f
+            { 2, 2, 0, 7 }, // 0x10
+            { 2, 2, 1, 6 }, // 0x11
+            { 2, 2, 0, 7 }, // 0x12
+            { 3, 2, 1, 7 }, // 0x13
+            { 2, 2, 0, 7 }, // 0x14
+            { 3, 2, 1, 7 }, // 0x15
+            { 4, 3, 0, 7 }, // 0x16
+            { 5, 3, 1, 7 }, // 0x17
+            { 3, 2, 0, 7 }, // 0x18
+            { 4, 3, 1, 7 }, // 0x19
+            { 3, 2, 0, 7 }, // 0x1a
+            { 4, 3, 1, 7 }, // 0x1b
+            { 3, 2, 0, 7 }, // 0x1c
+            { 4, 3, 1, 7 }, // 0x1d
+            { 2, 2, 0, 7 }, // 0x1e
+            { 3, 3, 1, 7 }, // 0x1f
+            { 2, 2, 0, 7 }, // 0x20
+            { 3, 2, 1, 7 }, // 0x21
+            { 1, 1, 0, 6 }, // 0x22
+            { 3, 2, 1, 7 }, // 0x23
+            { 3, 2, 0, 7 }, // 0x24
+            { 4, 3, 1, 7 }, // 0x25
+            { 3, 2, 0, 7 }, // 0x26
+            { 4, 3, 1, 7 }, // 0x27
+            { 2, 2, 0, 7 }, // 0x28
+            { 5, 3, 1, 7 }, // 0x29
+            { 2, 2, 0, 7 }, // 0x2a
+            { 5, 3, 1, 7 }, // 0x2b
+            { 3, 2, 0, 7 }, // 0x2c
+            { 3, 2, 1, 7 }, // 0x2d
+            { 3, 2, 0, 7 }, // 0x2e
+            { 3, 2, 1, 7 }, // 0x2f
+            { 1, 1, 0, 3 }, // 0x30
+            { 3, 2, 1, 7 }, // 0x31
+            { 2, 2, 0, 7 }, // 0x32
+            { 1, 1, 1, 2 }, // 0x33
+            { 3, 2, 0, 7 }, // 0x34
+            { 4, 3, 1, 7 }, // 0x35
+            { 2, 2, 0, 7 }, // 0x36
+            { 3, 3, 1, 7 }, // 0x37
+            { 3, 2, 0, 7 }, // 0x38
+            { 3, 2, 1, 7 }, // 0x39
+            { 3, 2, 0, 7 }, // 0x3a
+            { 3, 2, 1, 7 }, // 0x3b
+            { 1, 1, 0, 3 }, // 0x3c
+            { 4, 3, 1, 7 }, // 0x3d
+            { 3, 2, 0, 7 }, // 0x3e
+            { 2, 2, 1, 3 }, // 0x3f
+            { 2, 2, 0, 7 }, // 0x40
+            { 3, 2, 1, 7 }, // 0x41
+            { 3, 2, 0, 7 }, // 0x42
+            { 4, 3, 1, 7 }, // 0x43
+            { 1, 1, 0, 6 }, // 0x44
+            { 3, 2, 1, 7 }, // 0x45
+            { 3, 2, 0, 7 }, // 0x46
+            { 4, 3, 1, 7 }, // 0x47
+            { 2, 2, 0, 7 }, // 0x48
+            { 5, 3, 1, 7 }, // 0x49
+            { 3, 2, 0, 7 }, // 0x4a
+            { 3, 2, 1, 7 }, // 0x4b
+            { 2, 2, 0, 7 }, // 0x4c
+            { 5, 3, 1, 7 }, // 0x4d
+            { 3, 2, 0, 7 }, // 0x4e
+            { 3, 2, 1, 7 }, // 0x4f
+            { 1, 1, 0, 5 }, // 0x50
+            { 3, 2, 1, 7 }, // 0x51
+            { 3, 2, 0, 7 }, // 0x52
+            { 4, 3, 1, 7 }, // 0x53
+            { 2, 2, 0, 7 }, // 0x54
+            { 1, 1, 1, 4 }, // 0x55
+            { 2, 2, 0, 7 }, // 0x56
+            { 3, 3, 1, 7 }, // 0x57
+            { 3, 2, 0, 7 }, // 0x58
+            { 3, 2, 1, 7 }, // 0x59
+            { 1, 1, 0, 5 }, // 0x5a
+            { 4, 3, 1, 7 }, // 0x5b
+            { 3, 2, 0, 7 }, // 0x5c
+            { 3, 2, 1, 7 }, // 0x5d
+            { 3, 2, 0, 7 }, // 0x5e
+            { 2, 2, 1, 5 }, // 0x5f
+            { 2, 2, 0, 7 }, // 0x60
+            { 5, 3, 1, 7 }, // 0x61
+            { 3, 2, 0, 7 }, // 0x62
+            { 3, 2, 1, 7 }, // 0x63
+            { 3, 2, 0, 7 }, // 0x64
+            { 3, 2, 1, 7 }, // 0x65
+            { 1, 1, 0, 6 }, // 0x66
+            { 4, 3, 1, 7 }, // 0x67
+            { 4, 3, 0, 7 }, // 0x68
+            { 3, 2, 1, 7 }, // 0x69
+            { 2, 2, 0, 7 }, // 0x6a
+            { 5, 3, 1, 7 }, // 0x6b
+            { 2, 2, 0, 7 }, // 0x6c
+            { 5, 3, 1, 7 }, // 0x6d
+            { 3, 2, 0, 7 }, // 0x6e
+            { 3, 2, 1, 7 }, // 0x6f
+            { 2, 2, 0, 7 }, // 0x70
+            { 5, 3, 1, 7 }, // 0x71
+            { 3, 2, 0, 7 }, // 0x72
+            { 3, 2, 1, 7 }, // 0x73
+            { 3, 2, 0, 7 }, // 0x74
+            { 3, 2, 1, 7 }, // 0x75
+            { 3, 2, 0, 7 }, // 0x76
+            { 2, 2, 1, 6 }, // 0x77
+            { 2, 2, 0, 7 }, // 0x78
+            { 5, 3, 1, 7 }, // 0x79
+            { 3, 2, 0, 7 }, // 0x7a
+            { 3, 2, 1, 7 }, // 0x7b
+            { 3, 2, 0, 7 }, // 0x7c
+            { 3, 2, 1, 7 }, // 0x7d
+            { 3, 2, 0, 7 }, // 0x7e
+            { 3, 3, 1, 7 }, // 0x7f
+            { 2, 2, 0, 7 }, // 0x80
+            { 4, 3, 1, 7 }, // 0x81
+            { 2, 2, 0, 7 }, // 0x82
+            { 4, 3, 1, 7 }, // 0x83
+            { 2, 2, 0, 7 }, // 0x84
+            { 4, 3, 1, 7 }, // 0x85
+            { 4, 3, 0, 7 }, // 0x86
+            { 3, 2, 1, 7 }, // 0x87
+            { 1, 1, 0, 6 }, // 0x88
+            { 4, 3, 1, 7 }, // 0x89
+            { 2, 2, 0, 7 }, // 0x8a
+            { 4, 3, 1, 7 }, // 0x8b
+            { 2, 2, 0, 7 }, // 0x8c
+            { 4, 3, 1, 7 }, // 0x8d
+            { 4, 3, 0, 7 }, // 0x8e
+            { 3, 2, 1, 7 }, // 0x8f
+            { 2, 2, 0, 7 }, // 0x90
+            { 4, 3, 1, 7 }, // 0x91
+            { 4, 3, 0, 7 }, // 0x92
+            { 3, 2, 1, 7 }, // 0x93
+            { 4, 3, 0, 7 }, // 0x94
+            { 3, 2, 1, 7 }, // 0x95
+            { 2, 2, 0, 7 }, // 0x96
+            { 5, 3, 1, 7 }, // 0x97
+            { 3, 2, 0, 7 }, // 0x98
+            { 2, 2, 1, 6 }, // 0x99
+            { 2, 2, 0, 7 }, // 0x9a
+            { 4, 3, 1, 7 }, // 0x9b
+            { 2, 2, 0, 7 }, // 0x9c
+            { 4, 3, 1, 7 }, // 0x9d
+            { 4, 3, 0, 7 }, // 0x9e
+            { 3, 3, 1, 7 }, // 0x9f
+            { 1, 1, 0, 5 }, // 0xa0
+            { 4, 3, 1, 7 }, // 0xa1
+            { 2, 2, 0, 7 }, // 0xa2
+            { 4, 3, 1, 7 }, // 0xa3
+            { 3, 2, 0, 7 }, // 0xa4
+            { 2, 2, 1, 5 }, // 0xa5
+            { 2, 2, 0, 7 }, // 0xa6
+            { 4, 3, 1, 7 }, // 0xa7
+            { 2, 2, 0, 7 }, // 0xa8
+            { 3, 2, 1, 7 }, // 0xa9
+            { 0, 0, 0, 4 }, // 0xaa
+            { 3, 3, 1, 7 }, // 0xab
+            { 3, 2, 0, 7 }, // 0xac
+            { 4, 3, 1, 7 }, // 0xad
+            { 2, 2, 0, 7 }, // 0xae
+            { 2, 2, 1, 5 }, // 0xaf
+            { 2, 2, 0, 7 }, // 0xb0
+            { 4, 3, 1, 7 }, // 0xb1
+            { 4, 3, 0, 7 }, // 0xb2
+            { 3, 2, 1, 7 }, // 0xb3
+            { 2, 2, 0, 7 }, // 0xb4
+            { 4, 3, 1, 7 }, // 0xb5
+            { 4, 3, 0, 7 }, // 0xb6
+            { 3, 3, 1, 7 }, // 0xb7
+            { 3, 2, 0, 7 }, // 0xb8
+            { 4, 3, 1, 7 }, // 0xb9
+            { 2, 2, 0, 7 }, // 0xba
+            { 2, 2, 1, 6 }, // 0xbb
+            { 3, 2, 0, 7 }, // 0xbc
+            { 4, 3, 1, 7 }, // 0xbd
+            { 2, 2, 0, 7 }, // 0xbe
+            { 3, 3, 1, 7 }, // 0xbf
+            { 1, 1, 0, 3 }, // 0xc0
+            { 4, 3, 1, 7 }, // 0xc1
+            { 3, 2, 0, 7 }, // 0xc2
+            { 2, 2, 1, 3 }, // 0xc3
+            { 2, 2, 0, 7 }, // 0xc4
+            { 4, 3, 1, 7 }, // 0xc5
+            { 2, 2, 0, 7 }, // 0xc6
+            { 4, 3, 1, 7 }, // 0xc7
+            { 2, 2, 0, 7 }, // 0xc8
+            { 3, 2, 1, 7 }, // 0xc9
+            { 3, 2, 0, 7 }, // 0xca
+            { 4, 3, 1, 7 }, // 0xcb
+            { 0, 0, 0, 2 }, // 0xcc
+            { 3, 3, 1, 7 }, // 0xcd
+            { 2, 2, 0, 7 }, // 0xce
+            { 2, 2, 1, 3 }, // 0xcf
+            { 2, 2, 0, 7 }, // 0xd0
+            { 4, 3, 1, 7 }, // 0xd1
+            { 2, 2, 0, 7 }, // 0xd2
+            { 4, 3, 1, 7 }, // 0xd3
+            { 4, 3, 0, 7 }, // 0xd4
+            { 3, 2, 1, 7 }, // 0xd5
+            { 4, 3, 0, 7 }, // 0xd6
+            { 3, 3, 1, 7 }, // 0xd7
+            { 3, 2, 0, 7 }, // 0xd8
+            { 4, 3, 1, 7 }, // 0xd9
+            { 3, 2, 0, 7 }, // 0xda
+            { 4, 3, 1, 7 }, // 0xdb
+            { 2, 2, 0, 7 }, // 0xdc
+            { 2, 2, 1, 6 }, // 0xdd
+            { 2, 2, 0, 7 }, // 0xde
+            { 3, 3, 1, 7 }, // 0xdf
+            { 2, 2, 0, 7 }, // 0xe0
+            { 3, 2, 1, 7 }, // 0xe1
+            { 3, 2, 0, 7 }, // 0xe2
+            { 4, 3, 1, 7 }, // 0xe3
+            { 3, 2, 0, 7 }, // 0xe4
+            { 4, 3, 1, 7 }, // 0xe5
+            { 3, 2, 0, 7 }, // 0xe6
+            { 4, 3, 1, 7 }, // 0xe7
+            { 4, 3, 0, 7 }, // 0xe8
+            { 5, 3, 1, 7 }, // 0xe9
+            { 2, 2, 0, 7 }, // 0xea
+            { 3, 3, 1, 7 }, // 0xeb
+            { 2, 2, 0, 7 }, // 0xec
+            { 3, 3, 1, 7 }, // 0xed
+            { 1, 1, 0, 6 }, // 0xee
+            { 3, 2, 1, 7 }, // 0xef
+            { 0, 0, 0, 1 }, // 0xf0
+            { 3, 3, 1, 7 }, // 0xf1
+            { 2, 2, 0, 7 }, // 0xf2
+            { 2, 2, 1, 3 }, // 0xf3
+            { 2, 2, 0, 7 }, // 0xf4
+            { 2, 2, 1, 5 }, // 0xf5
+            { 2, 2, 0, 7 }, // 0xf6
+            { 3, 3, 1, 7 }, // 0xf7
+            { 2, 2, 0, 7 }, // 0xf8
+            { 3, 3, 1, 7 }, // 0xf9
+            { 1, 1, 0, 5 }, // 0xfa
+            { 3, 2, 1, 7 }, // 0xfb
+            { 1, 1, 0, 3 }, // 0xfc
+            { 3, 2, 1, 7 }, // 0xfd
+            { 2, 2, 0, 7 }, // 0xfe
+            { 0, 0, 1, 0 }, // 0xff
+        };
+
+        // kernels of ternary_avx_ps.cpp
+        constexpr kernel_cost avx_ps[256] = {
+            { 0, 0, 1, 0 }, // 0x00
+            { 3, 2, 1, 7 }, // 0x01
+            { 2, 2, 0, 7 }, // 0x02
+            { 2, 2, 1, 3 }, // 0x03
+            { 2, 2, 0, 7 }, // 0x04
+            { 2, 2, 1, 5 }, // 0x05
+            { 2, 2, 0, 7 }, // 0x06
+            { 3, 2, 1, 7 }, // 0x07
+            { 2, 2, 0, 7 }, // 0x08
+            { 3, 2, 1, 7 }, // 0x09
+            { 1, 1, 0, 5 }, // 0x0a
+            { 3, 2, 1, 7 }, // 0x0b
+            { 1, 1, 0, 3 }, // 0x0c
+            { 3, 2, 1, 7 }, // 0x0d
+            { 2, 2, 0, 7 }, // 0x0e
+            { 1, 1, 1, 1 }, // 0x0f
+            { 2, 2, 0, 7 }, // 0x10
+            { 2, 2, 1, 6 }, // 0x11
+            { 2, 2, 0, 7 }, // 0x12
+            { 3, 2, 1, 7 }, // 0x13
+            { 2, 2, 0, 7 }, // 0x14
+            { 3, 2, 1, 7 }, // 0x15
+            { 4, 3, 0, 7 }, // 0x16
+            { 5, 3, 1, 7 }, // 0x17
+            { 3, 2, 0, 7 }, // 0x18
+            { 4, 3, 1, 7 }, // 0x19
+            { 3, 2, 0, 7 }, // 0x1a
+            { 4, 3, 1, 7 }, // 0x1b
+            { 3, 2, 0, 7 }, // 0x1c
+            { 4, 3, 1, 7 }, // 0x1d
+            { 2, 2, 0, 7 }, // 0x1e
+            { 3, 3, 1, 7 }, // 0x1f
+            { 2, 2, 0, 7 }, // 0x20
+            { 3, 2, 1, 7 }, // 0x21
+            { 1, 1, 0, 6 }, // 0x22
+            { 3, 2, 1, 7 }, // 0x23
+            { 3, 2, 0, 7 }, // 0x24
+            { 4, 3, 1, 7 }, // 0x25
+            { 3, 2, 0, 7 }, // 0x26
+            { 4, 3, 1, 7 }, // 0x27
+            { 2, 2, 0, 7 }, // 0x28
+            { 5, 3, 1, 7 }, // 0x29
+            { 2, 2, 0, 7 }, // 0x2a
+            { 5, 3, 1, 7 }, // 0x2b
+            { 3, 2, 0, 7 }, // 0x2c
+            { 3, 2, 1, 7 }, // 0x2d
+            { 3, 2, 0, 7 }, // 0x2e
+            { 3, 2, 1, 7 }, // 0x2f
+            { 1, 1, 0, 3 }, // 0x30
+            { 3, 2, 1, 7 }, // 0x31
+            { 2, 2, 0, 7 }, // 0x32
+            { 1, 1, 1, 2 }, // 0x33
+            { 3, 2, 0, 7 }, // 0x34
+            { 4, 3, 1, 7 }, // 0x35
+            { 2, 2, 0, 7 }, // 0x36
+            { 3, 3, 1, 7 }, // 0x37
+            { 3, 2, 0, 7 }, // 0x38
+            { 3, 2, 1, 7 }, // 0x39
+            { 3, 2, 0, 7 }, // 0x3a
+            { 3, 2, 1, 7 }, // 0x3b
+            { 1, 1, 0, 3 }, // 0x3c
+            { 4, 3, 1, 7 }, // 0x3d
+            { 3, 2, 0, 7 }, // 0x3e
+            { 2, 2, 1, 3 }, // 0x3f
+            { 2, 2, 0, 7 }, // 0x40
+            { 3, 2, 1, 7 }, // 0x41
+            { 3, 2, 0, 7 }, // 0x42
+            { 4, 3, 1, 7 }, // 0x43
+            { 1, 1, 0, 6 }, // 0x44
+            { 3, 2, 1, 7 }, // 0x45
+            { 3, 2, 0, 7 }, // 0x46
+            { 4, 3, 1, 7 }, // 0x47
+            { 2, 2, 0, 7 }, // 0x48
+            { 5, 3, 1, 7 }, // 0x49
+            { 3, 2, 0, 7 }, // 0x4a
+            { 3, 2, 1, 7 }, // 0x4b
+            { 2, 2, 0, 7 }, // 0x4c
+            { 5, 3, 1, 7 }, // 0x4d
+            { 3, 2, 0, 7 }, // 0x4e
+            { 3, 2, 1, 7 }, // 0x4f
+            { 1, 1, 0, 5 }, // 0x50
+            { 3, 2, 1, 7 }, // 0x51
+            { 3, 2, 0, 7 }, // 0x52
+            { 4, 3, 1, 7 }, // 0x53
+            { 2, 2, 0, 7 }, // 0x54
+            { 1, 1, 1, 4 }, // 0x55
+            { 2, 2, 0, 7 }, // 0x56
+            { 3, 3, 1, 7 }, // 0x57
+            { 3, 2, 0, 7 }, // 0x58
+            { 3, 2, 1, 7 }, // 0x59
+            { 1, 1, 0, 5 }, // 0x5a
+            { 4, 3, 1, 7 }, // 0x5b
+            { 3, 2, 0, 7 }, // 0x5c
+            { 3, 2, 1, 7 }, // 0x5d
+            { 3, 2, 0, 7 }, // 0x5e
+            { 2, 2, 1, 5 }, // 0x5f
+            { 2, 2, 0, 7 }, // 0x60
+            { 5, 3, 1, 7 }, // 0x61
+            { 3, 2, 0, 7 }, // 0x62
+            { 3, 2, 1, 7 }, // 0x63
+            { 3, 2, 0, 7 }, // 0x64
+            { 3, 2, 1, 7 }, // 0x65
+            { 1, 1, 0, 6 }, // 0x66
+            { 4, 3, 1, 7 }, // 0x67
+            { 4, 3, 0, 7 }, // 0x68
+            { 3, 2, 1, 7 }, // 0x69
+            { 2, 2, 0, 7 }, // 0x6a
+            { 5, 3, 1, 7 }, // 0x6b
+            { 2, 2, 0, 7 }, // 0x6c
+            { 5, 3, 1, 7 }, // 0x6d
+            { 3, 2, 0, 7 }, // 0x6e
+            { 3, 2, 1, 7 }, // 0x6f
+            { 2, 2, 0, 7 }, // 0x70
+            { 5, 3, 1, 7 }, // 0x71
+            { 3, 2, 0, 7 }, // 0x72
+            { 3, 2, 1, 7 }, // 0x73
+            { 3, 2, 0, 7 }, // 0x74
+            { 3, 2, 1, 7 }, // 0x75
+            { 3, 2, 0, 7 }, // 0x76
+            { 2, 2, 1, 6 }, // 0x77
+            { 2, 2, 0, 7 }, // 0x78
+            { 5, 3, 1, 7 }, // 0x79
+            { 3, 2, 0, 7 }, // 0x7a
+            { 3, 2, 1, 7 }, // 0x7b
+            { 3, 2, 0, 7 }, // 0x7c
+            { 3, 2, 1, 7 }, // 0x7d
+            { 3, 2, 0, 7 }, // 0x7e
+            { 3, 3, 1, 7 }, // 0x7f
+            { 2, 2, 0, 7 }, // 0x80
+            { 4, 3, 1, 7 }, // 0x81
+            { 2, 2, 0, 7 }, // 0x82
+            { 4, 3, 1, 7 }, // 0x83
+            { 2, 2, 0, 7 }, // 0x84
+            { 4, 3, 1, 7 }, // 0x85
+            { 4, 3, 0, 7 }, // 0x86
+            { 3, 2, 1, 7 }, // 0x87
+            { 1, 1, 0, 6 }, // 0x88
+            { 4, 3, 1, 7 }, // 0x89
+            { 2, 2, 0, 7 }, // 0x8a
+            { 4, 3, 1, 7 }, // 0x8b
+            { 2, 2, 0, 7 }, // 0x8c
+            { 4, 3, 1, 7 }, // 0x8d
+            { 4, 3, 0, 7 }, // 0x8e
+            { 3, 2, 1, 7 }, // 0x8f
+            { 2, 2, 0, 7 }, // 0x90
+            { 4, 3, 1, 7 }, // 0x91
+            { 4, 3, 0, 7 }, // 0x92
+            { 3, 2, 1, 7 }, // 0x93
+            { 4, 3, 0, 7 }, // 0x94
+            { 3, 2, 1, 7 }, // 0x95
+            { 2, 2, 0, 7 }, // 0x96
+            { 5, 3, 1, 7 }, // 0x97
+            { 3, 2, 0, 7 }, // 0x98
+            { 2, 2, 1, 6 }, // 0x99
+            { 2, 2, 0, 7 }, // 0x9a
+            { 4, 3, 1, 7 }, // 0x9b
+            { 2, 2, 0, 7 }, // 0x9c
+            { 4, 3, 1, 7 }, // 0x9d
+            { 4, 3, 0, 7 }, // 0x9e
+            { 3, 3, 1, 7 }, // 0x9f
+            { 1, 1, 0, 5 }, // 0xa0
+            { 4, 3, 1, 7 }, // 0xa1
+            { 2, 2, 0, 7 }, // 0xa2
+            { 4, 3, 1, 7 }, // 0xa3
+            { 3, 2, 0, 7 }, // 0xa4
+            { 2, 2, 1, 5 }, // 0xa5
+            { 2, 2, 0, 7 }, // 0xa6
+            { 4, 3, 1, 7 }, // 0xa7
+            { 2, 2, 0, 7 }, // 0xa8
+            { 3, 2, 1, 7 }, // 0xa9
+            { 0, 0, 0, 4 }, // 0xaa
+            { 3, 3, 1, 7 }, // 0xab
+            { 3, 2, 0, 7 }, // 0xac
+            { 4, 3, 1, 7 }, // 0xad
+            { 2, 2, 0, 7 }, // 0xae
+            { 2, 2, 1, 5 }, // 0xaf
+            { 2, 2, 0, 7 }, // 0xb0
+            { 4, 3, 1, 7 }, // 0xb1
+            { 4, 3, 0, 7 }, // 0xb2
+            { 3, 2, 1, 7 }, // 0xb3
+            { 2, 2, 0, 7 }, // 0xb4
+            { 4, 3, 1, 7 }, // 0xb5
+            { 4, 3, 0, 7 }, // 0xb6
+            { 3, 3, 1, 7 }, // 0xb7
+            { 3, 2, 0, 7 }, // 0xb8
+            { 4, 3, 1, 7 }, // 0xb9
+            { 2, 2, 0, 7 }, // 0xba
+            { 2, 2, 1, 6 }, // 0xbb
+            { 3, 2, 0, 7 }, // 0xbc
+            { 4, 3, 1, 7 }, // 0xbd
+            { 2, 2, 0, 7 }, // 0xbe
+            { 3, 3, 1, 7 }, // 0xbf
+            { 1, 1, 0, 3 }, // 0xc0
+            { 4, 3, 1, 7 }, // 0xc1
+            { 3, 2, 0, 7 }, // 0xc2
+            { 2, 2, 1, 3 }, // 0xc3
+            { 2, 2, 0, 7 }, // 0xc4
+            { 4, 3, 1, 7 }, // 0xc5
+            { 2, 2, 0, 7 }, // 0xc6
+            { 4, 3, 1, 7 }, // 0xc7
+            { 2, 2, 0, 7 }, // 0xc8
+            { 3, 2, 1, 7 }, // 0xc9
+            { 3, 2, 0, 7 }, // 0xca
+            { 4, 3, 1, 7 }, // 0xcb
+            { 0, 0, 0, 2 }, // 0xcc
+            { 3, 3, 1, 7 }, // 0xcd
+            { 2, 2, 0, 7 }, // 0xce
+            { 2, 2, 1, 3 }, // 0xcf
+            { 2, 2, 0, 7 }, // 0xd0
+            { 4, 3, 1, 7 }, // 0xd1
+            { 2, 2, 0, 7 }, // 0xd2
+            { 4, 3, 1, 7 }, // 0xd3
+            { 4, 3, 0, 7 }, // 0xd4
+            { 3, 2, 1, 7 }, // 0xd5
+            { 4, 3, 0, 7 }, // 0xd6
+            { 3, 3, 1, 7 }, // 0xd7
+            { 3, 2, 0, 7 }, // 0xd8
+            { 4, 3, 1, 7 }, // 0xd9
+            { 3, 2, 0, 7 }, // 0xda
+            { 4, 3, 1, 7 }, // 0xdb
+            { 2, 2, 0, 7 }, // 0xdc
+            { 2, 2, 1, 6 }, // 0xdd
+            { 2, 2, 0, 7 }, // 0xde
+            { 3, 3, 1, 7 }, // 0xdf
+            { 2, 2, 0, 7 }, // 0xe0
+            { 3, 2, 1, 7 }, // 0xe1
+            { 3, 2, 0, 7 }, // 0xe2
+            { 4, 3, 1, 7 }, // 0xe3
+            { 3, 2, 0, 7 }, // 0xe4
+            { 4, 3, 1, 7 }, // 0xe5
+            { 3, 2, 0, 7 }, // 0xe6
+            { 4, 3, 1, 7 }, // 0xe7
+            { 4, 3, 0, 7 }, // 0xe8
+            { 5, 3, 1, 7 }, // 0xe9
+            { 2, 2, 0, 7 }, // 0xea
+            { 3, 3, 1, 7 }, // 0xeb
+            { 2, 2, 0, 7 }, // 0xec
+            { 3, 3, 1, 7 }, // 0xed
+            { 1, 1, 0, 6 }, // 0xee
+            { 3, 2, 1, 7 }, // 0xef
+            { 0, 0, 0, 1 }, // 0xf0
+            { 3, 3, 1, 7 }, // 0xf1
+            { 2, 2, 0, 7 }, // 0xf2
+            { 2, 2, 1, 3 }, // 0xf3
+            { 2, 2, 0, 7 }, // 0xf4
+            { 2, 2, 1, 5 }, // 0xf5
+            { 2, 2, 0, 7 }, // 0xf6
+            { 3, 3, 1, 7 }, // 0xf7
+            { 2, 2, 0, 7 }, // 0xf8
+            { 3, 3, 1, 7 }, // 0xf9
+            { 1, 1, 0, 5 }, // 0xfa
+            { 3, 2, 1, 7 }, // 0xfb
+            { 1, 1, 0, 3 }, // 0xfc
+            { 3, 2, 1, 7 }, // 0xfd
+            { 2, 2, 0, 7 }, // 0xfe
+            { 0, 0, 1, 0 }, // 0xff
+        };
+
+        // kernels of ternary_avx_pd.cpp
+        constexpr kernel_cost avx_pd[256] = {
+            { 0, 0, 1, 0 }, // 0x00
+            { 3, 2, 1, 7 }, // 0x01
+            { 2, 2, 0, 7 }, // 0x02
+            { 2, 2, 1, 3 }, // 0x03
+            { 2, 2, 0, 7 }, // 0x04
+            { 2, 2, 1, 5 }, // 0x05
+            { 2, 2, 0, 7 }, // 0x06
+            { 3, 2, 1, 7 }, // 0x07
+            { 2, 2, 0, 7 }, // 0x08
+            { 3, 2, 1, 7 }, // 0x09
+            { 1, 1, 0, 5 }, // 0x0a
+            { 3, 2, 1, 7 }, // 0x0b
+            { 1, 1, 0, 3 }, // 0x0c
+            { 3, 2, 1, 7 }, // 0x0d
+            { 2, 2, 0, 7 }, // 0x0e
+            { 1, 1, 1, 1 }, // 0x0f
+            { 2, 2, 0, 7 }, // 0x10
+            { 2, 2, 1, 6 }, // 0x11
+            { 2, 2, 0, 7 }, // 0x12
+            { 3, 2, 1, 7 }, // 0x13
+            { 2, 2, 0, 7 }, // 0x14
+            { 3, 2, 1, 7 }, // 0x15
+            { 4, 3, 0, 7 }, // 0x16
+            { 5, 3, 1, 7 }, // 0x17
+            { 3, 2, 0, 7 }, // 0x18
+            { 4, 3, 1, 7 }, // 0x19
+            { 3, 2, 0, 7 }, // 0x1a
+            { 4, 3, 1, 7 }, // 0x1b
+            { 3, 2, 0, 7 }, // 0x1c
+            { 4, 3, 1, 7 }, // 0x1d
+            { 2, 2, 0, 7 }, // 0x1e
+            { 3, 3, 1, 7 }, // 0x1f
+            { 2, 2, 0, 7 }, // 0x20
+            { 3, 2, 1, 7 }, // 0x21
+            { 1, 1, 0, 6 }, // 0x22
+            { 3, 2, 1, 7 }, // 0x23
+            { 3, 2, 0, 7 }, // 0x24
+            { 4, 3, 1, 7 }, // 0x25
+            { 3, 2, 0, 7 }, // 0x26
+            { 4, 3, 1, 7 }, // 0x27
+            { 2, 2, 0, 7 }, // 0x28
+            { 5, 3, 1, 7 }, // 0x29
+            { 2, 2, 0, 7 }, // 0x2a
+            { 5, 3, 1, 7 }, // 0x2b
+            { 3, 2, 0, 7 }, // 0x2c
+            { 3, 2, 1, 7 }, // 0x2d
+            { 3, 2, 0, 7 }, // 0x2e
+            { 3, 2, 1, 7 }, // 0x2f
+            { 1, 1, 0, 3 }, // 0x30
+            { 3, 2, 1, 7 }, // 0x31
+            { 2, 2, 0, 7 }, // 0x32
+            { 1, 1, 1, 2 }, // 0x33
+            { 3, 2, 0, 7 }, // 0x34
+            { 4, 3, 1, 7 }, // 0x35
+            { 2, 2, 0, 7 }, // 0x36
+            { 3, 3, 1, 7 }, // 0x37
+            { 3, 2, 0, 7 }, // 0x38
+            { 3, 2, 1, 7 }, // 0x39
+            { 3, 2, 0, 7 }, // 0x3a
+            { 3, 2, 1, 7 }, // 0x3b
+            { 1, 1, 0, 3 }, // 0x3c
+            { 4, 3, 1, 7 }, // 0x3d
+            { 3, 2, 0, 7 }, // 0x3e
+            { 2, 2, 1, 3 }, // 0x3f
+            { 2, 2, 0, 7 }, // 0x40
+            { 3, 2, 1, 7 }, // 0x41
+            { 3, 2, 0, 7 }, // 0x42
+            { 4, 3, 1, 7 }, // 0x43
+            { 1, 1, 0, 6 }, // 0x44
+            { 3, 2, 1, 7 }, // 0x45
+            { 3, 2, 0, 7 }, // 0x46
+            { 4, 3, 1, 7 }, // 0x47
+            { 2, 2, 0, 7 }, // 0x48
+            { 5, 3, 1, 7 }, // 0x49
+            { 3, 2, 0, 7 }, // 0x4a
+            { 3, 2, 1, 7 }, // 0x4b
+            { 2, 2, 0, 7 }, // 0x4c
+            { 5, 3, 1, 7 }, // 0x4d
+            { 3, 2, 0, 7 }, // 0x4e
+            { 3, 2, 1, 7 }, // 0x4f
+            { 1, 1, 0, 5 }, // 0x50
+            { 3, 2, 1, 7 }, // 0x51
+            { 3, 2, 0, 7 }, // 0x52
+            { 4, 3, 1, 7 }, // 0x53
+            { 2, 2, 0, 7 }, // 0x54
+            { 1, 1, 1, 4 }, // 0x55
+            { 2, 2, 0, 7 }, // 0x56
+            { 3, 3, 1, 7 }, // 0x57
+            { 3, 2, 0, 7 }, // 0x58
+            { 3, 2, 1, 7 }, // 0x59
+            { 1, 1, 0, 5 }, // 0x5a
+            { 4, 3, 1, 7 }, // 0x5b
+            { 3, 2, 0, 7 }, // 0x5c
+            { 3, 2, 1, 7 }, // 0x5d
+            { 3, 2, 0, 7 }, // 0x5e
+            { 2, 2, 1, 5 }, // 0x5f
+            { 2, 2, 0, 7 }, // 0x60
+            { 5, 3, 1, 7 }, // 0x61
+            { 3, 2, 0, 7 }, // 0x62
+            { 3, 2, 1, 7 }, // 0x63
+            { 3, 2, 0, 7 }, // 0x64
+            { 3, 2, 1, 7 }, // 0x65
+            { 1, 1, 0, 6 }, // 0x66
+            { 4, 3, 1, 7 }, // 0x67
+            { 4, 3, 0, 7 }, // 0x68
+            { 3, 2, 1, 7 }, // 0x69
+            { 2, 2, 0, 7 }, // 0x6a
+            { 5, 3, 1, 7 }, // 0x6b
+            { 2, 2, 0, 7 }, // 0x6c
+            { 5, 3, 1, 7 }, // 0x6d
+            { 3, 2, 0, 7 }, // 0x6e
+            { 3, 2, 1, 7 }, // 0x6f
+            { 2, 2, 0, 7 }, // 0x70
+            { 5, 3, 1, 7 }, // 0x71
+            { 3, 2, 0, 7 }, // 0x72
+            { 3, 2, 1, 7 }, // 0x73
+            { 3, 2, 0, 7 }, // 0x74
+            { 3, 2, 1, 7 }, // 0x75
+            { 3, 2, 0, 7 }, // 0x76
+            { 2, 2, 1, 6 }, // 0x77
+            { 2, 2, 0, 7 }, // 0x78
+            { 5, 3, 1, 7 }, // 0x79
+            { 3, 2, 0, 7 }, // 0x7a
+            { 3, 2, 1, 7 }, // 0x7b
+            { 3, 2, 0, 7 }, // 0x7c
+            { 3, 2, 1, 7 }, // 0x7d
+            { 3, 2, 0, 7 }, // 0x7e
+            { 3, 3, 1, 7 }, // 0x7f
+            { 2, 2, 0, 7 }, // 0x80
+            { 4, 3, 1, 7 }, // 0x81
+            { 2, 2, 0, 7 }, // 0x82
+            { 4, 3, 1, 7 }, // 0x83
+            { 2, 2, 0, 7 }, // 0x84
+            { 4, 3, 1, 7 }, // 0x85
+            { 4, 3, 0, 7 }, // 0x86
+            { 3, 2, 1, 7 }, // 0x87
+            { 1, 1, 0, 6 }, // 0x88
+            { 4, 3, 1, 7 }, // 0x89
+            { 2, 2, 0, 7 }, // 0x8a
+            { 4, 3, 1, 7 }, // 0x8b
+            { 2, 2, 0, 7 }, // 0x8c
+            { 4, 3, 1, 7 }, // 0x8d
+            { 4, 3, 0, 7 }, // 0x8e
+            { 3, 2, 1, 7 }, // 0x8f
+            { 2, 2, 0, 7 }, // 0x90
+            { 4, 3, 1, 7 }, // 0x91
+            { 4, 3, 0, 7 }, // 0x92
+            { 3, 2, 1, 7 }, // 0x93
+            { 4, 3, 0, 7 }, // 0x94
+            { 3, 2, 1, 7 }, // 0x95
+            { 2, 2, 0, 7 }, // 0x96
+            { 5, 3, 1, 7 }, // 0x97
+            { 3, 2, 0, 7 }, // 0x98
+            { 2, 2, 1, 6 }, // 0x99
+            { 2, 2, 0, 7 }, // 0x9a
+            { 4, 3, 1, 7 }, // 0x9b
+            { 2, 2, 0, 7 }, // 0x9c
+            { 4, 3, 1, 7 }, // 0x9d
+            { 4, 3, 0, 7 }, // 0x9e
+            { 3, 3, 1, 7 }, // 0x9f
+            { 1, 1, 0, 5 }, // 0xa0
+            { 4, 3, 1, 7 }, // 0xa1
+            { 2, 2, 0, 7 }, // 0xa2
+            { 4, 3, 1, 7 }, // 0xa3
+            { 3, 2, 0, 7 }, // 0xa4
+            { 2, 2, 1, 5 }, // 0xa5
+            { 2, 2, 0, 7 }, // 0xa6
+            { 4, 3, 1, 7 }, // 0xa7
+            { 2, 2, 0, 7 }, // 0xa8
+            { 3, 2, 1, 7 }, // 0xa9
+            { 0, 0, 0, 4 }, // 0xaa
+            { 3, 3, 1, 7 }, // 0xab
+            { 3, 2, 0, 7 }, // 0xac
+            { 4, 3, 1, 7 }, // 0xad
+            { 2, 2, 0, 7 }, // 0xae
+            { 2, 2, 1, 5 }, // 0xaf
+            { 2, 2, 0, 7 }, // 0xb0
+            { 4, 3, 1, 7 }, // 0xb1
+            { 4, 3, 0, 7 }, // 0xb2
+            { 3, 2, 1, 7 }, // 0xb3
+            { 2, 2, 0, 7 }, // 0xb4
+            { 4, 3, 1, 7 }, // 0xb5
+            { 4, 3, 0, 7 }, // 0xb6
+            { 3, 3, 1, 7 }, // 0xb7
+            { 3, 2, 0, 7 }, // 0xb8
+            { 4, 3, 1, 7 }, // 0xb9
+            { 2, 2, 0, 7 }, // 0xba
+            { 2, 2, 1, 6 }, // 0xbb
+            { 3, 2, 0, 7 }, // 0xbc
+            { 4, 3, 1, 7 }, // 0xbd
+            { 2, 2, 0, 7 }, // 0xbe
+            { 3, 3, 1, 7 }, // 0xbf
+            { 1, 1, 0, 3 }, // 0xc0
+            { 4, 3, 1, 7 }, // 0xc1
+            { 3, 2, 0, 7 }, // 0xc2
+            { 2, 2, 1, 3 }, // 0xc3
+            { 2, 2, 0, 7 }, // 0xc4
+            { 4, 3, 1, 7 }, // 0xc5
+            { 2, 2, 0, 7 }, // 0xc6
+            { 4, 3, 1, 7 }, // 0xc7
+            { 2, 2, 0, 7 }, // 0xc8
+            { 3, 2, 1, 7 }, // 0xc9
+            { 3, 2, 0, 7 }, // 0xca
+            { 4, 3, 1, 7 }, // 0xcb
+            { 0, 0, 0, 2 }, // 0xcc
+            { 3, 3, 1, 7 }, // 0xcd
+            { 2, 2, 0, 7 }, // 0xce
+            { 2, 2, 1, 3 }, // 0xcf
+            { 2, 2, 0, 7 }, // 0xd0
+            { 4, 3, 1, 7 }, // 0xd1
+            { 2, 2, 0, 7 }, // 0xd2
+            { 4, 3, 1, 7 }, // 0xd3
+            { 4, 3, 0, 7 }, // 0xd4
+            { 3, 2, 1, 7 }, // 0xd5
+            { 4, 3, 0, 7 }, // 0xd6
+            { 3, 3, 1, 7 }, // 0xd7
+            { 3, 2, 0, 7 }, // 0xd8
+            { 4, 3, 1, 7 }, // 0xd9
+            { 3, 2, 0, 7 }, // 0xda
+            { 4, 3, 1, 7 }, // 0xdb
+            { 2, 2, 0, 7 }, // 0xdc
+            { 2, 2, 1, 6 }, // 0xdd
+            { 2, 2, 0, 7 }, // 0xde
+            { 3, 3, 1, 7 }, // 0xdf
+            { 2, 2, 0, 7 }, // 0xe0
+            { 3, 2, 1, 7 }, // 0xe1
+            { 3, 2, 0, 7 }, // 0xe2
+            { 4, 3, 1, 7 }, // 0xe3
+            { 3, 2, 0, 7 }, // 0xe4
+            { 4, 3, 1, 7 }, // 0xe5
+            { 3, 2, 0, 7 }, // 0xe6
+            { 4, 3, 1, 7 }, // 0xe7
+            { 4, 3, 0, 7 }, // 0xe8
+            { 5, 3, 1, 7 }, // 0xe9
+            { 2, 2, 0, 7 }, // 0xea
+            { 3, 3, 1, 7 }, // 0xeb
+            { 2, 2, 0, 7 }, // 0xec
+            { 3, 3, 1, 7 }, // 0xed
+            { 1, 1, 0, 6 }, // 0xee
+            { 3, 2, 1, 7 }, // 0xef
+            { 0, 0, 0, 1 }, // 0xf0
+            { 3, 3, 1, 7 }, // 0xf1
+            { 2, 2, 0, 7 }, // 0xf2
+            { 2, 2, 1, 3 }, // 0xf3
+            { 2, 2, 0, 7 }, // 0xf4
+            { 2, 2, 1, 5 }, // 0xf5
+            { 2, 2, 0, 7 }, // 0xf6
+            { 3, 3, 1, 7 }, // 0xf7
+            { 2, 2, 0, 7 }, // 0xf8
+            { 3, 3, 1, 7 }, // 0xf9
+            { 1, 1, 0, 5 }, // 0xfa
+            { 3, 2, 1, 7 }, // 0xfb
+            { 1, 1, 0, 3 }, // 0xfc
+            { 3, 2, 1, 7 }, // 0xfd
+            { 2, 2, 0, 7 }, // 0xfe
+            { 0, 0, 1, 0 }, // 0xff
+        };
+
+        // kernels of ternary_xop.cpp
+        constexpr kernel_cost xop[256] = {
+            { 0, 0, 1, 0 }, // 0x00
+            { 3, 2, 1, 7 }, // 0x01
+            { 2, 2, 0, 7 }, // 0x02
+            { 2, 2, 1, 3 }, // 0x03
+            { 2, 2, 0, 7 }, // 0x04
+            { 2, 2, 1, 5 }, // 0x05
+            { 2, 2, 0, 7 }, // 0x06
+            { 3, 2, 1, 7 }, // 0x07
+            { 2, 2, 0, 7 }, // 0x08
+            { 3, 2, 1, 7 }, // 0x09
+            { 1, 1, 0, 5 }, // 0x0a
+            { 2, 2, 1, 7 }, // 0x0b
+            { 1, 1, 0, 3 }, // 0x0c
+            { 2, 2, 1, 7 }, // 0x0d
+            { 2, 2, 0, 7 }, // 0x0e
+            { 1, 1, 1, 1 }, // 0x0f
+            { 2, 2, 0, 7 }, // 0x10
+            { 2, 2, 1, 6 }, // 0x11
+            { 2, 2, 0, 7 }, // 0x12
+            { 3, 2, 1, 7 }, // 0x13
+            { 2, 2, 0, 7 }, // 0x14
+            { 3, 2, 1, 7 }, // 0x15
+            { 3, 3, 0, 7 }, // 0x16
+            { 3, 2, 1, 7 }, // 0x17
+            { 3, 2, 0, 7 }, // 0x18
+            { 3, 2, 1, 7 }, // 0x19
+            { 3, 2, 0, 7 }, // 0x1a
+            { 2, 2, 1, 7 }, // 0x1b
+            { 3, 2, 0, 7 }, // 0x1c
+            { 2, 2, 1, 7 }, // 0x1d
+            { 2, 2, 0, 7 }, // 0x1e
+            { 3, 2, 1, 7 }, // 0x1f
+            { 2, 2, 0, 7 }, // 0x20
+            { 3, 2, 1, 7 }, // 0x21
+            { 1, 1, 0, 6 }, // 0x22
+            { 2, 2, 1, 7 }, // 0x23
+            { 3, 2, 0, 7 }, // 0x24
+            { 3, 2, 1, 7 }, // 0x25
+            { 3, 2, 0, 7 }, // 0x26
+            { 2, 2, 1, 7 }, // 0x27
+            { 2, 2, 0, 7 }, // 0x28
+            { 3, 3, 1, 7 }, // 0x29
+            { 2, 2, 0, 7 }, // 0x2a
+            { 3, 2, 1, 7 }, // 0x2b
+            { 2, 2, 0, 7 }, // 0x2c
+            { 2, 2, 1, 7 }, // 0x2d
+            { 2, 2, 0, 7 }, // 0x2e
+            { 2, 2, 1, 7 }, // 0x2f
+            { 1, 1, 0, 3 }, // 0x30
+            { 2, 2, 1, 7 }, // 0x31
+            { 2, 2, 0, 7 }, // 0x32
+            { 1, 1, 1, 2 }, // 0x33
+            { 3, 2, 0, 7 }, // 0x34
+            { 2, 2, 1, 7 }, // 0x35
+            { 2, 2, 0, 7 }, // 0x36
+            { 3, 2, 1, 7 }, // 0x37
+            { 2, 2, 0, 7 }, // 0x38
+            { 2, 2, 1, 7 }, // 0x39
+            { 2, 2, 0, 7 }, // 0x3a
+            { 2, 2, 1, 7 }, // 0x3b
+            { 1, 1, 0, 3 }, // 0x3c
+            { 3, 2, 1, 7 }, // 0x3d
+            { 3, 2, 0, 7 }, // 0x3e
+            { 2, 2, 1, 3 }, // 0x3f
+            { 2, 2, 0, 7 }, // 0x40
+            { 3, 2, 1, 7 }, // 0x41
+            { 3, 2, 0, 7 }, // 0x42
+            { 3, 2, 1, 7 }, // 0x43
+            { 1, 1, 0, 6 }, // 0x44
+            { 2, 2, 1, 7 }, // 0x45
+            { 3, 2, 0, 7 }, // 0x46
+            { 2, 2, 1, 7 }, // 0x47
+            { 2, 2, 0, 7 }, // 0x48
+            { 3, 3, 1, 7 }, // 0x49
+            { 2, 2, 0, 7 }, // 0x4a
+            { 2, 2, 1, 7 }, // 0x4b
+            { 2, 2, 0, 7 }, // 0x4c
+            { 3, 2, 1, 7 }, // 0x4d
+            { 2, 2, 0, 7 }, // 0x4e
+            { 2, 2, 1, 7 }, // 0x4f
+            { 1, 1, 0, 5 }, // 0x50
+            { 2, 2, 1, 7 }, // 0x51
+            { 3, 2, 0, 7 }, // 0x52
+            { 2, 2, 1, 7 }, // 0x53
+            { 2, 2, 0, 7 }, // 0x54
+            { 1, 1, 1, 4 }, // 0x55
+            { 2, 2, 0, 7 }, // 0x56
+            { 3, 2, 1, 7 }, // 0x57
+            { 2, 2, 0, 7 }, // 0x58
+            { 2, 2, 1, 7 }, // 0x59
+            { 1, 1, 0, 5 }, // 0x5a
+            { 3, 2, 1, 7 }, // 0x5b
+            { 2, 2, 0, 7 }, // 0x5c
+            { 2, 2, 1, 7 }, // 0x5d
+            { 3, 2, 0, 7 }, // 0x5e
+            { 2, 2, 1, 5 }, // 0x5f
+            { 2, 2, 0, 7 }, // 0x60
+            { 3, 3, 1, 7 }, // 0x61
+            { 2, 2, 0, 7 }, // 0x62
+            { 2, 2, 1, 7 }, // 0x63
+            { 2, 2, 0, 7 }, // 0x64
+            { 2, 2, 1, 7 }, // 0x65
+            { 1, 1, 0, 6 }, // 0x66
+            { 3, 2, 1, 7 }, // 0x67
+            { 3, 2, 0, 7 }, // 0x68
+            { 3, 2, 1, 7 }, // 0x69
+            { 2, 2, 0, 7 }, // 0x6a
+            { 3, 2, 1, 7 }, // 0x6b
+            { 2, 2, 0, 7 }, // 0x6c
+            { 3, 2, 1, 7 }, // 0x6d
+            { 3, 2, 0, 7 }, // 0x6e
+            { 2, 2, 1, 7 }, // 0x6f
+            { 2, 2, 0, 7 }, // 0x70
+            { 3, 2, 1, 7 }, // 0x71
+            { 2, 2, 0, 7 }, // 0x72
+            { 2, 2, 1, 7 }, // 0x73
+            { 2, 2, 0, 7 }, // 0x74
+            { 2, 2, 1, 7 }, // 0x75
+            { 3, 2, 0, 7 }, // 0x76
+            { 2, 2, 1, 6 }, // 0x77
+            { 2, 2, 0, 7 }, // 0x78
+            { 3, 2, 1, 7 }, // 0x79
+            { 3, 2, 0, 7 }, // 0x7a
+            { 2, 2, 1, 7 }, // 0x7b
+            { 3, 2, 0, 7 }, // 0x7c
+            { 2, 2, 1, 7 }, // 0x7d
+            { 3, 2, 0, 7 }, // 0x7e
+            { 3, 2, 1, 7 }, // 0x7f
+            { 2, 2, 0, 7 }, // 0x80
+            { 4, 3, 1, 7 }, // 0x81
+            { 2, 2, 0, 7 }, // 0x82
+            { 3, 2, 1, 7 }, // 0x83
+            { 2, 2, 0, 7 }, // 0x84
+            { 3, 2, 1, 7 }, // 0x85
+            { 3, 2, 0, 7 }, // 0x86
+            { 3, 2, 1, 7 }, // 0x87
+            { 1, 1, 0, 6 }, // 0x88
+            { 3, 2, 1, 7 }, // 0x89
+            { 2, 2, 0, 7 }, // 0x8a
+            { 2, 2, 1, 7 }, // 0x8b
+            { 2, 2, 0, 7 }, // 0x8c
+            { 2, 2, 1, 7 }, // 0x8d
+            { 2, 2, 0, 7 }, // 0x8e
+            { 2, 2, 1, 7 }, // 0x8f
+            { 2, 2, 0, 7 }, // 0x90
+            { 3, 2, 1, 7 }, // 0x91
+            { 3, 2, 0, 7 }, // 0x92
+            { 3, 2, 1, 7 }, // 0x93
+            { 3, 2, 0, 7 }, // 0x94
+            { 3, 2, 1, 7 }, // 0x95
+            { 2, 2, 0, 7 }, // 0x96
+            { 4, 2, 1, 7 }, // 0x97
+            { 2, 2, 0, 7 }, // 0x98
+            { 2, 2, 1, 6 }, // 0x99
+            { 2, 2, 0, 7 }, // 0x9a
+            { 3, 2, 1, 7 }, // 0x9b
+            { 2, 2, 0, 7 }, // 0x9c
+            { 3, 2, 1, 7 }, // 0x9d
+            { 3, 2, 0, 7 }, // 0x9e
+            { 3, 2, 1, 7 }, // 0x9f
+            { 1, 1, 0, 5 }, // 0xa0
+            { 3, 2, 1, 7 }, // 0xa1
+            { 2, 2, 0, 7 }, // 0xa2
+            { 2, 2, 1, 7 }, // 0xa3
+            { 2, 2, 0, 7 }, // 0xa4
+            { 2, 2, 1, 5 }, // 0xa5
+            { 2, 2, 0, 7 }, // 0xa6
+            { 3, 2, 1, 7 }, // 0xa7
+            { 2, 2, 0, 7 }, // 0xa8
+            { 3, 2, 1, 7 }, // 0xa9
+            { 0, 0, 0, 4 }, // 0xaa
+            { 2, 2, 1, 7 }, // 0xab
+            { 1, 1, 0, 7 }, // 0xac
+            { 2, 2, 1, 7 }, // 0xad
+            { 2, 2, 0, 7 }, // 0xae
+            { 1, 1, 1, 5 }, // 0xaf
+            { 2, 2, 0, 7 }, // 0xb0
+            { 2, 2, 1, 7 }, // 0xb1
+            { 2, 2, 0, 7 }, // 0xb2
+            { 2, 2, 1, 7 }, // 0xb3
+            { 2, 2, 0, 7 }, // 0xb4
+            { 3, 2, 1, 7 }, // 0xb5
+            { 3, 2, 0, 7 }, // 0xb6
+            { 3, 2, 1, 7 }, // 0xb7
+            { 1, 1, 0, 7 }, // 0xb8
+            { 2, 2, 1, 7 }, // 0xb9
+            { 2, 2, 0, 7 }, // 0xba
+            { 1, 1, 1, 6 }, // 0xbb
+            { 2, 2, 0, 7 }, // 0xbc
+            { 3, 2, 1, 7 }, // 0xbd
+            { 2, 2, 0, 7 }, // 0xbe
+            { 2, 2, 1, 7 }, // 0xbf
+            { 1, 1, 0, 3 }, // 0xc0
+            { 3, 2, 1, 7 }, // 0xc1
+            { 2, 2, 0, 7 }, // 0xc2
+            { 2, 2, 1, 3 }, // 0xc3
+            { 2, 2, 0, 7 }, // 0xc4
+            { 2, 2, 1, 7 }, // 0xc5
+            { 2, 2, 0, 7 }, // 0xc6
+            { 3, 2, 1, 7 }, // 0xc7
+            { 2, 2, 0, 7 }, // 0xc8
+            { 3, 2, 1, 7 }, // 0xc9
+            { 1, 1, 0, 7 }, // 0xca
+            { 2, 2, 1, 7 }, // 0xcb
+            { 0, 0, 0, 2 }, // 0xcc
+            { 2, 2, 1, 7 }, // 0xcd
+            { 2, 2, 0, 7 }, // 0xce
+            { 1, 1, 1, 3 }, // 0xcf
+            { 2, 2, 0, 7 }, // 0xd0
+            { 2, 2, 1, 7 }, // 0xd1
+            { 2, 2, 0, 7 }, // 0xd2
+            { 3, 2, 1, 7 }, // 0xd3
+            { 2, 2, 0, 7 }, // 0xd4
+            { 2, 2, 1, 7 }, // 0xd5
+            { 3, 2, 0, 7 }, // 0xd6
+            { 3, 2, 1, 7 }, // 0xd7
+            { 1, 1, 0, 7 }, // 0xd8
+            { 2, 2, 1, 7 }, // 0xd9
+            { 2, 2, 0, 7 }, // 0xda
+            { 3, 2, 1, 7 }, // 0xdb
+            { 2, 2, 0, 7 }, // 0xdc
+            { 1, 1, 1, 6 }, // 0xdd
+            { 2, 2, 0, 7 }, // 0xde
+            { 2, 2, 1, 7 }, // 0xdf
+            { 2, 2, 0, 7 }, // 0xe0
+            { 3, 2, 1, 7 }, // 0xe1
+            { 1, 1, 0, 7 }, // 0xe2
+            { 2, 2, 1, 7 }, // 0xe3
+            { 1, 1, 0, 7 }, // 0xe4
+            { 2, 2, 1, 7 }, // 0xe5
+            { 2, 2, 0, 7 }, // 0xe6
+            { 3, 2, 1, 7 }, // 0xe7
+            { 2, 2, 0, 7 }, // 0xe8
+            { 3, 2, 1, 7 }, // 0xe9
+            { 2, 2, 0, 7 }, // 0xea
+            { 2, 2, 1, 7 }, // 0xeb
+            { 2, 2, 0, 7 }, // 0xec
+            { 2, 2, 1, 7 }, // 0xed
+            { 1, 1, 0, 6 }, // 0xee
+            { 2, 2, 1, 7 }, // 0xef
+            { 0, 0, 0, 1 }, // 0xf0
+            { 2, 2, 1, 7 }, // 0xf1
+            { 2, 2, 0, 7 }, // 0xf2
+            { 1, 1, 1, 3 }, // 0xf3
+            { 2, 2, 0, 7 }, // 0xf4
+            { 1, 1, 1, 5 }, // 0xf5
+            { 2, 2, 0, 7 }, // 0xf6
+            { 2, 2, 1, 7 }, // 0xf7
+            { 2, 2, 0, 7 }, // 0xf8
+            { 2, 2, 1, 7 }, // 0xf9
+            { 1, 1, 0, 5 }, // 0xfa
+            { 2, 2, 1, 7 }, // 0xfb
+            { 1, 1, 0, 3 }, // 0xfc
+            { 2, 2, 1, 7 }, // 0xfd
+            { 2, 2, 0, 7 }, // 0xfe
+            { 0, 0, 1, 0 }, // 0xff
+        };
+
+        // kernels of vpternlogd
+        constexpr kernel_cost avx512raw[256] = {
+            { 1, 1, 0, 0 }, // 0x00
+            { 1, 1, 0, 7 }, // 0x01
+            { 1, 1, 0, 7 }, // 0x02
+            { 1, 1, 0, 3 }, // 0x03
+            { 1, 1, 0, 7 }, // 0x04
+            { 1, 1, 0, 5 }, // 0x05
+            { 1, 1, 0, 7 }, // 0x06
+            { 1, 1, 0, 7 }, // 0x07
+            { 1, 1, 0, 7 }, // 0x08
+            { 1, 1, 0, 7 }, // 0x09
+            { 1, 1, 0, 5 }, // 0x0a
+            { 1, 1, 0, 7 }, // 0x0b
+            { 1, 1, 0, 3 }, // 0x0c
+            { 1, 1, 0, 7 }, // 0x0d
+            { 1, 1, 0, 7 }, // 0x0e
+            { 1, 1, 0, 1 }, // 0x0f
+            { 1, 1, 0, 7 }, // 0x10
+            { 1, 1, 0, 6 }, // 0x11
+            { 1, 1, 0, 7 }, // 0x12
+            { 1, 1, 0, 7 }, // 0x13
+            { 1, 1, 0, 7 }, // 0x14
+            { 1, 1, 0, 7 }, // 0x15
+            { 1, 1, 0, 7 }, // 0x16
+            { 1, 1, 0, 7 }, // 0x17
+            { 1, 1, 0, 7 }, // 0x18
+            { 1, 1, 0, 7 }, // 0x19
+            { 1, 1, 0, 7 }, // 0x1a
+            { 1, 1, 0, 7 }, // 0x1b
+            { 1, 1, 0, 7 }, // 0x1c
+            { 1, 1, 0, 7 }, // 0x1d
+            { 1, 1, 0, 7 }, // 0x1e
+            { 1, 1, 0, 7 }, // 0x1f
+            { 1, 1, 0, 7 }, // 0x20
+            { 1, 1, 0, 7 }, // 0x21
+            { 1, 1, 0, 6 }, // 0x22
+            { 1, 1, 0, 7 }, // 0x23
+            { 1, 1, 0, 7 }, // 0x24
+            { 1, 1, 0, 7 }, // 0x25
+            { 1, 1, 0, 7 }, // 0x26
+            { 1, 1, 0, 7 }, // 0x27
+            { 1, 1, 0, 7 }, // 0x28
+            { 1, 1, 0, 7 }, // 0x29
+            { 1, 1, 0, 7 }, // 0x2a
+            { 1, 1, 0, 7 }, // 0x2b
+            { 1, 1, 0, 7 }, // 0x2c
+            { 1, 1, 0, 7 }, // 0x2d
+            { 1, 1, 0, 7 }, // 0x2e
+            { 1, 1, 0, 7 }, // 0x2f
+            { 1, 1, 0, 3 }, // 0x30
+            { 1, 1, 0, 7 }, // 0x31
+            { 1, 1, 0, 7 }, // 0x32
+            { 1, 1, 0, 2 }, // 0x33
+            { 1, 1, 0, 7 }, // 0x34
+            { 1, 1, 0, 7 }, // 0x35
+            { 1, 1, 0, 7 }, // 0x36
+            { 1, 1, 0, 7 }, // 0x37
+            { 1, 1, 0, 7 }, // 0x38
+            { 1, 1, 0, 7 }, // 0x39
+            { 1, 1, 0, 7 }, // 0x3a
+            { 1, 1, 0, 7 }, // 0x3b
+            { 1, 1, 0, 3 }, // 0x3c
+            { 1, 1, 0, 7 }, // 0x3d
+            { 1, 1, 0, 7 }, // 0x3e
+            { 1, 1, 0, 3 }, // 0x3f
+            { 1, 1, 0, 7 }, // 0x40
+            { 1, 1, 0, 7 }, // 0x41
+            { 1, 1, 0, 7 }, // 0x42
+            { 1, 1, 0, 7 }, // 0x43
+            { 1, 1, 0, 6 }, // 0x44
+            { 1, 1, 0, 7 }, // 0x45
+            { 1, 1, 0, 7 }, // 0x46
+            { 1, 1, 0, 7 }, // 0x47
+            { 1, 1, 0, 7 }, // 0x48
+            { 1, 1, 0, 7 }, // 0x49
+            { 1, 1, 0, 7 }, // 0x4a
+            { 1, 1, 0, 7 }, // 0x4b
+            { 1, 1, 0, 7 }, // 0x4c
+            { 1, 1, 0, 7 }, // 0x4d
+            { 1, 1, 0, 7 }, // 0x4e
+            { 1, 1, 0, 7 }, // 0x4f
+            { 1, 1, 0, 5 }, // 0x50
+            { 1, 1, 0, 7 }, // 0x51
+            { 1, 1, 0, 7 }, // 0x52
+            { 1, 1, 0, 7 }, // 0x53
+            { 1, 1, 0, 7 }, // 0x54
+            { 1, 1, 0, 4 }, // 0x55
+            { 1, 1, 0, 7 }, // 0x56
+            { 1, 1, 0, 7 }, // 0x57
+            { 1, 1, 0, 7 }, // 0x58
+            { 1, 1, 0, 7 }, // 0x59
+            { 1, 1, 0, 5 }, // 0x5a
+            { 1, 1, 0, 7 }, // 0x5b
+            { 1, 1, 0, 7 }, // 0x5c
+            { 1, 1, 0, 7 }, // 0x5d
+            { 1, 1, 0, 7 }, // 0x5e
+            { 1, 1, 0, 5 }, // 0x5f
+            { 1, 1, 0, 7 }, // 0x60
+            { 1, 1, 0, 7 }, // 0x61
+            { 1, 1, 0, 7 }, // 0x62
+            { 1, 1, 0, 7 }, // 0x63
+            { 1, 1, 0, 7 }, // 0x64
+            { 1, 1, 0, 7 }, // 0x65
+            { 1, 1, 0, 6 }, // 0x66
+            { 1, 1, 0, 7 }, // 0x67
+            { 1, 1, 0, 7 }, // 0x68
+            { 1, 1, 0, 7 }, // 0x69
+            { 1, 1, 0, 7 }, // 0x6a
+            { 1, 1, 0, 7 }, // 0x6b
+            { 1, 1, 0, 7 }, // 0x6c
+            { 1, 1, 0, 7 }, // 0x6d
+            { 1, 1, 0, 7 }, // 0x6e
+            { 1, 1, 0, 7 }, // 0x6f
+            { 1, 1, 0, 7 }, // 0x70
+            { 1, 1, 0, 7 }, // 0x71
+            { 1, 1, 0, 7 }, // 0x72
+            { 1, 1, 0, 7 }, // 0x73
+            { 1, 1, 0, 7 }, // 0x74
+            { 1, 1, 0, 7 }, // 0x75
+            { 1, 1, 0, 7 }, // 0x76
+            { 1, 1, 0, 6 }, // 0x77
+            { 1, 1, 0, 7 }, // 0x78
+            { 1, 1, 0, 7 }, // 0x79
+            { 1, 1, 0, 7 }, // 0x7a
+            { 1, 1, 0, 7 }, // 0x7b
+            { 1, 1, 0, 7 }, // 0x7c
+            { 1, 1, 0, 7 }, // 0x7d
+            { 1, 1, 0, 7 }, // 0x7e
+            { 1, 1, 0, 7 }, // 0x7f
+            { 1, 1, 0, 7 }, // 0x80
+            { 1, 1, 0, 7 }, // 0x81
+            { 1, 1, 0, 7 }, // 0x82
+            { 1, 1, 0, 7 }, // 0x83
+            { 1, 1, 0, 7 }, // 0x84
+            { 1, 1, 0, 7 }, // 0x85
+            { 1, 1, 0, 7 }, // 0x86
+            { 1, 1, 0, 7 }, // 0x87
+            { 1, 1, 0, 6 }, // 0x88
+            { 1, 1, 0, 7 }, // 0x89
+            { 1, 1, 0, 7 }, // 0x8a
+            { 1, 1, 0, 7 }, // 0x8b
+            { 1, 1, 0, 7 }, // 0x8c
+            { 1, 1, 0, 7 }, // 0x8d
+            { 1, 1, 0, 7 }, // 0x8e
+            { 1, 1, 0, 7 }, // 0x8f
+            { 1, 1, 0, 7 }, // 0x90
+            { 1, 1, 0, 7 }, // 0x91
+            { 1, 1, 0, 7 }, // 0x92
+            { 1, 1, 0, 7 }, // 0x93
+            { 1, 1, 0, 7 }, // 0x94
+            { 1, 1, 0, 7 }, // 0x95
+            { 1, 1, 0, 7 }, // 0x96
+            { 1, 1, 0, 7 }, // 0x97
+            { 1, 1, 0, 7 }, // 0x98
+            { 1, 1, 0, 6 }, // 0x99
+            { 1, 1, 0, 7 }, // 0x9a
+            { 1, 1, 0, 7 }, // 0x9b
+            { 1, 1, 0, 7 }, // 0x9c
+            { 1, 1, 0, 7 }, // 0x9d
+            { 1, 1, 0, 7 }, // 0x9e
+            { 1, 1, 0, 7 }, // 0x9f
+            { 1, 1, 0, 5 }, // 0xa0
+            { 1, 1, 0, 7 }, // 0xa1
+            { 1, 1, 0, 7 }, // 0xa2
+            { 1, 1, 0, 7 }, // 0xa3
+            { 1, 1, 0, 7 }, // 0xa4
+            { 1, 1, 0, 5 }, // 0xa5
+            { 1, 1, 0, 7 }, // 0xa6
+            { 1, 1, 0, 7 }, // 0xa7
+            { 1, 1, 0, 7 }, // 0xa8
+            { 1, 1, 0, 7 }, // 0xa9
+            { 1, 1, 0, 4 }, // 0xaa
+            { 1, 1, 0, 7 }, // 0xab
+            { 1, 1, 0, 7 }, // 0xac
+            { 1, 1, 0, 7 }, // 0xad
+            { 1, 1, 0, 7 }, // 0xae
+            { 1, 1, 0, 5 }, // 0xaf
+            { 1, 1, 0, 7 }, // 0xb0
+            { 1, 1, 0, 7 }, // 0xb1
+            { 1, 1, 0, 7 }, // 0xb2
+            { 1, 1, 0, 7 }, // 0xb3
+            { 1, 1, 0, 7 }, // 0xb4
+            { 1, 1, 0, 7 }, // 0xb5
+            { 1, 1, 0, 7 }, // 0xb6
+            { 1, 1, 0, 7 }, // 0xb7
+            { 1, 1, 0, 7 }, // 0xb8
+            { 1, 1, 0, 7 }, // 0xb9
+            { 1, 1, 0, 7 }, // 0xba
+            { 1, 1, 0, 6 }, // 0xbb
+            { 1, 1, 0, 7 }, // 0xbc
+            { 1, 1, 0, 7 }, // 0xbd
+            { 1, 1, 0, 7 }, // 0xbe
+            { 1, 1, 0, 7 }, // 0xbf
+            { 1, 1, 0, 3 }, // 0xc0
+            { 1, 1, 0, 7 }, // 0xc1
+            { 1, 1, 0, 7 }, // 0xc2
+            { 1, 1, 0, 3 }, // 0xc3
+            { 1, 1, 0, 7 }, // 0xc4
+            { 1, 1, 0, 7 }, // 0xc5
+            { 1, 1, 0, 7 }, // 0xc6
+            { 1, 1, 0, 7 }, // 0xc7
+            { 1, 1, 0, 7 }, // 0xc8
+            { 1, 1, 0, 7 }, // 0xc9
+            { 1, 1, 0, 7 }, // 0xca
+            { 1, 1, 0, 7 }, // 0xcb
+            { 1, 1, 0, 2 }, // 0xcc
+            { 1, 1, 0, 7 }, // 0xcd
+            { 1, 1, 0, 7 }, // 0xce
+            { 1, 1, 0, 3 }, // 0xcf
+            { 1, 1, 0, 7 }, // 0xd0
+            { 1, 1, 0, 7 }, // 0xd1
+            { 1, 1, 0, 7 }, // 0xd2
+            { 1, 1, 0, 7 }, // 0xd3
+            { 1, 1, 0, 7 }, // 0xd4
+            { 1, 1, 0, 7 }, // 0xd5
+            { 1, 1, 0, 7 }, // 0xd6
+            { 1, 1, 0, 7 }, // 0xd7
+            { 1, 1, 0, 7 }, // 0xd8
+            { 1, 1, 0, 7 }, // 0xd9
+            { 1, 1, 0, 7 }, // 0xda
+            { 1, 1, 0, 7 }, // 0xdb
+            { 1, 1, 0, 7 }, // 0xdc
+            { 1, 1, 0, 6 }, // 0xdd
+            { 1, 1, 0, 7 }, // 0xde
+            { 1, 1, 0, 7 }, // 0xdf
+            { 1, 1, 0, 7 }, // 0xe0
+            { 1, 1, 0, 7 }, // 0xe1
+            { 1, 1, 0, 7 }, // 0xe2
+            { 1, 1, 0, 7 }, // 0xe3
+            { 1, 1, 0, 7 }, // 0xe4
+            { 1, 1, 0, 7 }, // 0xe5
+            { 1, 1, 0, 7 }, // 0xe6
+            { 1, 1, 0, 7 }, // 0xe7
+            { 1, 1, 0, 7 }, // 0xe8
+            { 1, 1, 0, 7 }, // 0xe9
+            { 1, 1, 0, 7 }, // 0xea
+            { 1, 1, 0, 7 }, // 0xeb
+            { 1, 1, 0, 7 }, // 0xec
+            { 1, 1, 0, 7 }, // 0xed
+            { 1, 1, 0, 6 }, // 0xee
+            { 1, 1, 0, 7 }, // 0xef
+            { 1, 1, 0, 1 }, // 0xf0
+            { 1, 1, 0, 7 }, // 0xf1
+            { 1, 1, 0, 7 }, // 0xf2
+            { 1, 1, 0, 3 }, // 0xf3
+            { 1, 1, 0, 7 }, // 0xf4
+            { 1, 1, 0, 5 }, // 0xf5
+            { 1, 1, 0, 7 }, // 0xf6
+            { 1, 1, 0, 7 }, // 0xf7
+            { 1, 1, 0, 7 }, // 0xf8
+            { 1, 1, 0, 7 }, // 0xf9
+            { 1, 1, 0, 5 }, // 0xfa
+            { 1, 1, 0, 7 }, // 0xfb
+            { 1, 1, 0, 3 }, // 0xfc
+            { 1, 1, 0, 7 }, // 0xfd
+            { 1, 1, 0, 7 }, // 0xfe
+            { 1, 1, 0, 0 }, // 0xff
+        };
+
+    } // namespace costs
+
+} // namespace ternarylogic
+
+// eof
@@ -0,0 +1,20 @@
+// Generated automatically, please do not edit
+// profile: none
+#pragma once
+
+namespace ternarylogic {
+
+    namespace priv {
+
+        // runtime dispatch: the hottest codes of the profile are tested first,
+        // all other codes go through the reduced switch
+        template<typename T>
+        [[nodiscard]] constexpr T ternary_hot(const T& a, const T& b, const T& c, const bf_type k) noexcept {
+            return ternary_reduced(a, b, c, k);
+        }
+
+    } // namespace priv
+
+} // namespace ternarylogic
+
+// eof
@@ -0,0 +1,346 @@
+#pragma once
+#include <algorithm>	// for min
+#include <bitset>
+#include <cstdint>
+#include <cstdlib>		// for rand
+#include <iostream>		// for cout
+#include <vector>
+
+#include "ternary_logic.cpp"
+#include "ternary_bulk.h"
+
+namespace ternarylogic
+{
+	/// <summary>
+	/// Bit-vector of a size known at run time, in 64-byte lines of 8 words: the storage is aligned and padded to whole
+	/// 512-bit vectors, thus the kernels of bulk::ternary run over it without a tail. The lines are a std::vector, which
+	/// grows geometrically: push_back, append and resize reallocate O(log n) times. Bit i is bit i % 64 of word i / 64;
+	/// the bits past size() are zero.
+	/// </summary>
+	class dyn_bitvector
+	{
+	public:
+		static constexpr size_t npos = static_cast<size_t>(-1);
+
+		/// <summary>
+		/// The widest vector of the target, the element type of the bulk kernels
+		/// </summary>
+#if defined(__AVX512F__)
+		using register_type = __m512i;
+#elif defined(__AVX2__)
+		using register_type = __m256i;
+#else
+		using register_type = __m128i;
+#endif
+
+	private:
+		struct alignas(64) line
+		{
+			uint64_t words[8];
+		};
+		static constexpr size_t line_bits = 512;
+
+		std::vector<line> lines_;
+		size_t size_ = 0;
+
+		[[nodiscard]] static constexpr size_t lines_for(const size_t n_bits) noexcept { return (n_bits + line_bits - 1) / line_bits; }
+
+		[[nodiscard]] size_t n_registers() const noexcept { return (lines_.size() * sizeof(line)) / sizeof(register_type); }
+		[[nodiscard]] register_type* registers() noexcept { return reinterpret_cast<register_type*>(lines_.data()); }
+		[[nodiscard]] const register_type* registers() const noexcept { return reinterpret_cast<const register_type*>(lines_.data()); }
+
+		/// <summary>
+		/// Clear the bits past size(), which the kernels of functions with f(0, 0, 0) = 1 set
+		/// </summary>
+		void trim() noexcept
+		{
+			if ((size_ % 64) != 0) {
+				data()[size_ / 64] &= (static_cast<uint64_t>(1) << (size_ % 64)) - 1;
+			}
+			for (size_t i = n_words(); i < n_storage_words(); ++i) data()[i] = 0;
+		}
+
+		/// <summary>
+		/// Set the bits [begin, end) to value, end is at most size()
+		/// </summary>
+		void fill(const size_t begin, const size_t end, const bool value) noexcept
+		{
+			if (!value) return; // the bits past the old size are zero
+			for (size_t i = begin; (i < end) && ((i % 64) != 0); ++i) set(i);
+			size_t i = ((begin + 63) / 64) * 64;
+			for (; i + 64 <= end; i += 64) data()[i / 64] = ~static_cast<uint64_t>(0);
+			for (; i < end; ++i) set(i);
+		}
+
+	public:
+		dyn_bitvector() noexcept = default;
+
+		explicit dyn_bitvector(const size_t n_bits, const bool value = false)
+		{
+			resize(n_bits, value);
+		}
+
+		[[nodiscard]] size_t size() const noexcept { return size_; }
+		[[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+		[[nodiscard]] size_t capacity() const noexcept { return lines_.capacity() * line_bits; }
+		[[nodiscard]] size_t n_words() const noexcept { return (size_ + 63) / 64; }
+		[[nodiscard]] size_t n_storage_words() const noexcept { return lines_.size() * 8; }
+		[[nodiscard]] uint64_t* data() noexcept { return reinterpret_cast<uint64_t*>(lines_.data()); }
+		[[nodiscard]] const uint64_t* data() const noexcept { return reinterpret_cast<const uint64_t*>(lines_.data()); }
+
+		void reserve(const size_t n_bits) { lines_.reserve(lines_for(n_bits)); }
+
+		/// <summary>
+		/// Grow or shrink to n_bits; new bits are value
+		/// </summary>
+		void resize(const size_t n_bits, const bool value = false)
+		{
+			const size_t old_size = size_;
+			lines_.resize(lines_for(n_bits));
+			size_ = n_bits;
+			if (n_bits > old_size) fill(old_size, n_bits, value);
+			else trim();
+		}
+
+		void clear() noexcept
+		{
+			lines_.clear();
+			size_ = 0;
+		}
+
+		void push_back(const bool value)
+		{
+			if ((size_ % line_bits) == 0) lines_.emplace_back();
+			++size_;
+			if (value) set(size_ - 1);
+		}
+
+		/// <summary>
+		/// Append the bits of other; a word at a time, shifted when size() is not a multiple of 64
+		/// </summary>
+		void append(const dyn_bitvector& other)
+		{
+			if (this == &other) {
+				const dyn_bitvector copy(other);
+				append(copy);
+				return;
+			}
+			const size_t shift = size_ % 64;
+			const size_t base = size_ / 64;
+			resize(size_ + other.size_);
+			uint64_t* w = data();
+			const uint64_t* o = other.data();
+			for (size_t i = 0; i < other.n_words(); ++i) {
+				w[base + i] |= o[i] << shift;
+				if ((shift != 0) && (base + i + 1 < n_words())) w[base + i + 1] |= o[i] >> (64 - shift);
+			}
+		}
+
+		[[nodiscard]] bool test(const size_t i) const noexcept { return ((data()[i / 64] >> (i % 64)) & 1) != 0; }
+
+		dyn_bitvector& set(const size_t i, const bool value = true) noexcept
+		{
+			const uint64_t bit = static_cast<uint64_t>(1) << (i % 64);
+			uint64_t& w = data()[i / 64];
+			w = value ? (w | bit) : (w & ~bit);
+			return *this;
+		}
+
+		dyn_bitvector& reset(const size_t i) noexcept { return set(i, false); }
+
+		[[nodiscard]] size_t count() const noexcept
+		{
+			size_t result = 0;
+			for (size_t i = 0; i < n_words(); ++i) result += std::bitset<64>(data()[i]).count();
+			return result;
+		}
+
+		[[nodiscard]] bool any() const noexcept
+		{
+			for (size_t i = 0; i < n_words(); ++i) {
+				if (data()[i] != 0) return true;
+			}
+			return false;
+		}
+
+		[[nodiscard]] bool none() const noexcept { return !any(); }
+
+		/// <summary>
+		/// True if all bits are set, also when empty
+		/// </summary>
+		[[nodiscard]] bool all() const noexcept
+		{
+			const size_t full = size_ / 64;
+			for (size_t i = 0; i < full; ++i) {
+				if (data()[i] != ~static_cast<uint64_t>(0)) return false;
+			}
+			return ((size_ % 64) == 0) || (data()[full] == ((static_cast<uint64_t>(1) << (size_ % 64)) - 1));
+		}
+
+		/// <summary>
+		/// Index of the first set bit at or after i, npos if there is none
+		/// </summary>
+		[[nodiscard]] size_t find_from(const size_t i) const noexcept
+		{
+			if (i >= size_) return npos;
+			size_t w = i / 64;
+			uint64_t x = data()[w] & (~static_cast<uint64_t>(0) << (i % 64));
+			while (x == 0) {
+				if (++w >= n_words()) return npos;
+				x = data()[w];
+			}
+			return (w * 64) + compat::ctz64(x);
+		}
+
+		[[nodiscard]] size_t find_first() const noexcept { return find_from(0); }
+
+		/// <summary>
+		/// Index of the first set bit after i, npos if there is none; with find_first it visits the set bits in order
+		/// </summary>
+		[[nodiscard]] size_t find_next(const size_t i) const noexcept { return (i + 1 == 0) ? npos : find_from(i + 1); }
+
+		/// <summary>
+		/// Set this to Boolean Function K of a, b and c, which have one size; this may be one of them
+		/// </summary>
+		template<bf_type K>
+		dyn_bitvector& assign(const dyn_bitvector& a, const dyn_bitvector& b, const dyn_bitvector& c)
+		{
+			if ((this != &a) && (this != &b) && (this != &c)) resize(a.size_);
+			bulk::ternary<K>(registers(), a.registers(), b.registers(), c.registers(), n_registers());
+			if constexpr ((K & 1) != 0) trim();
+			return *this;
+		}
+
+		/// <summary>
+		/// Set this to Boolean Function k of a, b and c; the kernel is looked up once
+		/// </summary>
+		dyn_bitvector& assign(const dyn_bitvector& a, const dyn_bitvector& b, const dyn_bitvector& c, const bf_type k)
+		{
+			if ((this != &a) && (this != &b) && (this != &c)) resize(a.size_);
+			bulk::ternary(registers(), a.registers(), b.registers(), c.registers(), n_registers(), k);
+			if ((k & 1) != 0) trim();
+			return *this;
+		}
+
+		/// <summary>
+		/// this = f_K(this, b, c) in place
+		/// </summary>
+		template<bf_type K>
+		dyn_bitvector& ternary(const dyn_bitvector& b, const dyn_bitvector& c)
+		{
+			return assign<K>(*this, b, c);
+		}
+
+		dyn_bitvector& ternary(const dyn_bitvector& b, const dyn_bitvector& c, const bf_type k)
+		{
+			return assign(*this, b, c, k);
+		}
+
+		[[nodiscard]] friend bool operator==(const dyn_bitvector& a, const dyn_bitvector& b) noexcept
+		{
+			return (a.size_ == b.size_) && std::equal(a.data(), a.data() + a.n_words(), b.data());
+		}
+
+		[[nodiscard]] friend bool operator!=(const dyn_bitvector& a, const dyn_bitvector& b) noexcept { return !(a == b); }
+	};
+
+	/// <summary>
+	/// Boolean Function K over bit-vectors of one size
+	/// </summary>
+	template<bf_type K>
+	[[nodiscard]] inline dyn_bitvector ternary(const dyn_bitvector& a, const dyn_bitvector& b, const dyn_bitvector& c)
+	{
+		dyn_bitvector result;
+		result.assign<K>(a, b, c);
+		return result;
+	}
+
+	[[nodiscard]] inline dyn_bitvector ternary(const dyn_bitvector& a, const dyn_bitvector& b, const dyn_bitvector& c, const bf_type k)
+	{
+		dyn_bitvector result;
+		result.assign(a, b, c, k);
+		return result;
+	}
+
+	namespace test
+	{
+		template<bf_type K>
+		[[nodiscard]] inline bool dyn_bitvector_equals_reference(const dyn_bitvector& a, const dyn_bitvector& b, const dyn_bitvector& c)
+		{
+			const dyn_bitvector r1 = ternary<K>(a, b, c);
+			const dyn_bitvector r2 = ternary(a, b, c, K);
+			bool equal = (r1 == r2) && (r1.size() == a.size());
+			for (size_t w = 0; w < a.n_words(); ++w) {
+				const uint64_t mask = ((w + 1) * 64 <= a.size()) ? ~static_cast<uint64_t>(0) : ((static_cast<uint64_t>(1) << (a.size() % 64)) - 1);
+				equal = equal && (r1.data()[w] == (reference::vpternlog(a.data()[w], b.data()[w], c.data()[w], K) & mask));
+			}
+			// the padding stays zero
+			for (size_t w = a.n_words(); w < r1.n_storage_words(); ++w) equal = equal && (r1.data()[w] == 0);
+			return equal;
+		}
+
+		inline void test_dyn_bitvector()
+		{
+			std::cout << "ternarylogic::test::test_dyn_bitvector" << std::endl;
+
+			bool has_error = false;
+			for (const size_t n : { 0, 1, 63, 64, 65, 511, 512, 513, 5000 })
+			{
+				std::vector<bool> naive[3];
+				dyn_bitvector v[3];
+				for (int j = 0; j < 3; ++j) {
+					// the first half bit by bit, the second half appended, at an offset that is not word aligned
+					dyn_bitvector tail;
+					for (size_t i = 0; i < n; ++i) {
+						const bool bit = (rand() % 3) == 0;
+						naive[j].push_back(bit);
+						if (i < n / 2) v[j].push_back(bit);
+						else tail.push_back(bit);
+					}
+					v[j].append(tail);
+				}
+
+				// the set bits of v[0], with find_first and find_next
+				std::vector<size_t> found;
+				for (size_t i = v[0].find_first(); i != dyn_bitvector::npos; i = v[0].find_next(i)) found.push_back(i);
+				std::vector<size_t> expected;
+				for (size_t i = 0; i < n; ++i) {
+					if (naive[0][i]) expected.push_back(i);
+					if (v[0].test(i) != naive[0][i]) has_error = true;
+				}
+				if ((found != expected) || (v[0].size() != n) || (v[0].count() != expected.size()) || (v[0].any() != !expected.empty())) {
+					std::cout << "ERROR: test_dyn_bitvector: n = " << n << ": bits, find_next or count" << std::endl;
+					has_error = true;
+				}
+
+				const dyn_bitvector ones(n, true);
+				if (!ones.all() || (ones.count() != n) || ((n > 0) && v[0].all() && (expected.size() != n))) {
+					std::cout << "ERROR: test_dyn_bitvector: n = " << n << ": all" << std::endl;
+					has_error = true;
+				}
+
+				if (!dyn_bitvector_equals_reference<0x01>(v[0], v[1], v[2])
+					|| !dyn_bitvector_equals_reference<0x96>(v[0], v[1], v[2])
+					|| !dyn_bitvector_equals_reference<0xE8>(v[0], v[1], v[2])
+					|| !dyn_bitvector_equals_reference<0xFF>(v[0], v[1], v[2])) {
+					std::cout << "ERROR: test_dyn_bitvector: n = " << n << ": ternary" << std::endl;
+					has_error = true;
+				}
+
+				// in place, and resize keeps the bits below the new size
+				dyn_bitvector x = v[0];
+				x.ternary<0xCA>(v[1], v[2]);
+				if (x != ternary<0xCA>(v[0], v[1], v[2])) {
+					std::cout << "ERROR: test_dyn_bitvector: n = " << n << ": in place" << std::endl;
+					has_error = true;
+				}
+				x.resize(n / 3);
+				x.resize(n, true);
+				for (size_t i = 0; i < n; ++i) {
+					if (x.test(i) != ((i < n / 3) ? ternary<0xCA>(v[0], v[1], v[2]).test(i) : true)) has_error = true;
+				}
+			}
+			if (!has_error) std::cout << "test_dyn_bitvector: No errors found!" << std::endl;
+		}
+	}
+}
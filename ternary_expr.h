@@ -0,0 +1,556 @@
+#pragma once
+#include <vector>
+#include <cstdint>
+#include <cstdlib>		// for rand
+#include <iostream>		// for cout
+#include <algorithm>	// for min, max, sort
+
+#include "ternary_logic.cpp"
+#include "ternary_bulk.h"
+
+namespace ternarylogic::expr
+{
+	using node_id = uint32_t;
+
+	enum class op : uint8_t { input, constant, bit_not, bit_and, bit_or, bit_xor, select };
+
+	struct node
+	{
+		op kind;
+		node_id a;
+		node_id b;
+		node_id c;
+		uint32_t value; // input slot for op::input, 0 or 1 for op::constant
+	};
+
+	/// <summary>
+	/// Lazy expression over bit-vectors. Leaves are input slots that are bound to buffers when the compiled
+	/// program is executed; nodes are created in topological order, so a node only refers to older nodes.
+	/// </summary>
+	class graph
+	{
+		std::vector<node> nodes_;
+		std::vector<node_id> outputs_;
+		uint32_t n_inputs_ = 0;
+
+		[[nodiscard]] node_id add(const op kind, const node_id a, const node_id b, const node_id c, const uint32_t value)
+		{
+			nodes_.push_back(node{ kind, a, b, c, value });
+			return static_cast<node_id>(nodes_.size() - 1);
+		}
+
+	public:
+		[[nodiscard]] node_id input() { return add(op::input, 0, 0, 0, n_inputs_++); }
+		[[nodiscard]] node_id constant(const bool value) { return add(op::constant, 0, 0, 0, value ? 1 : 0); }
+		[[nodiscard]] node_id bit_not(const node_id a) { return add(op::bit_not, a, a, a, 0); }
+		[[nodiscard]] node_id bit_and(const node_id a, const node_id b) { return add(op::bit_and, a, b, b, 0); }
+		[[nodiscard]] node_id bit_or(const node_id a, const node_id b) { return add(op::bit_or, a, b, b, 0); }
+		[[nodiscard]] node_id bit_xor(const node_id a, const node_id b) { return add(op::bit_xor, a, b, b, 0); }
+
+		/// <summary>
+		/// s ? t : f for every bit
+		/// </summary>
+		[[nodiscard]] node_id select(const node_id s, const node_id t, const node_id f) { return add(op::select, s, t, f, 0); }
+
+		/// <summary>
+		/// Mark the provided node as a result of the graph
+		/// </summary>
+		/// <returns>The output slot of the node</returns>
+		size_t output(const node_id n)
+		{
+			outputs_.push_back(n);
+			return outputs_.size() - 1;
+		}
+
+		[[nodiscard]] size_t n_inputs() const noexcept { return n_inputs_; }
+		[[nodiscard]] size_t n_outputs() const noexcept { return outputs_.size(); }
+		[[nodiscard]] const std::vector<node>& nodes() const noexcept { return nodes_; }
+		[[nodiscard]] const std::vector<node_id>& outputs() const noexcept { return outputs_; }
+	};
+
+	/// <summary>
+	/// One fused ternary operation: operand[dst] = f_k(operand[a], operand[b], operand[c]).
+	/// Operands [0, n_inputs) are the inputs, [n_inputs, n_inputs + n_outputs) the outputs, and the rest is scratch.
+	/// </summary>
+	struct instruction
+	{
+		bf_type k;
+		uint32_t dst;
+		uint32_t a;
+		uint32_t b;
+		uint32_t c;
+		bool complemented = false; // operand[dst] holds the not of the result, see compile
+	};
+
+	/// <summary>
+	/// Compiled graph. The complemented results are chosen for the backend target.
+	/// </summary>
+	struct program
+	{
+		size_t n_inputs = 0;
+		size_t n_outputs = 0;
+		size_t n_scratch = 0;
+		isa target = isa::avx2;
+		std::vector<instruction> code;
+
+		[[nodiscard]] size_t n_operands() const noexcept { return n_inputs + n_outputs + n_scratch; }
+	};
+
+	namespace priv
+	{
+		constexpr uint8_t var_mask[3] = { 0xF0, 0xCC, 0xAA };
+
+		[[nodiscard]] inline int n_children(const op kind) noexcept
+		{
+			switch (kind)
+			{
+				case op::bit_not: return 1;
+				case op::bit_and:
+				case op::bit_or:
+				case op::bit_xor: return 2;
+				case op::select: return 3;
+				default: return 0;
+			}
+		}
+
+		[[nodiscard]] inline node_id child(const node& n, const int i) noexcept
+		{
+			return (i == 0) ? n.a : ((i == 1) ? n.b : n.c);
+		}
+
+		[[nodiscard]] inline uint8_t apply(const op kind, const uint8_t a, const uint8_t b, const uint8_t c) noexcept
+		{
+			switch (kind)
+			{
+				case op::bit_not: return static_cast<uint8_t>(~a);
+				case op::bit_and: return a & b;
+				case op::bit_or: return a | b;
+				case op::bit_xor: return a ^ b;
+				case op::select: return static_cast<uint8_t>((a & b) | (~a & c));
+				default: return 0;
+			}
+		}
+
+		/// <summary>
+		/// Truth table of the cone rooted at id, with the cone inputs (at most three) mapped on A, B and C
+		/// </summary>
+		[[nodiscard]] inline uint8_t cone_function(const std::vector<node>& nodes, const std::vector<node_id>& support, const node_id id, const bool is_root)
+		{
+			if (!is_root) {
+				for (size_t i = 0; i < support.size(); ++i) {
+					if (support[i] == id) return var_mask[i];
+				}
+			}
+			const node& n = nodes[id];
+			if (n.kind == op::constant) return (n.value) ? 0xFF : 0x00;
+
+			uint8_t v[3] = { 0, 0, 0 };
+			for (int i = 0; i < n_children(n.kind); ++i) {
+				v[i] = cone_function(nodes, support, child(n, i), false);
+			}
+			return apply(n.kind, v[0], v[1], v[2]);
+		}
+	}
+
+	/// <summary>
+	/// Cover the graph with cones of at most three inputs, map every cone on a ternary function code and
+	/// allocate the cone results in scratch (reused as soon as a value is dead) or directly in the outputs.
+	/// Nodes that are used more than once are computed once. A cone result in scratch is kept complemented where
+	/// the kernel of the complement is cheaper on the target backend, and its consumers absorb the not.
+	/// </summary>
+	[[nodiscard]] inline program compile(const graph& g, const isa target)
+	{
+		const std::vector<node>& nodes = g.nodes();
+		const size_t n_nodes = nodes.size();
+		constexpr uint32_t none = 0xFFFFFFFF;
+
+		program p;
+		p.target = target;
+		p.n_inputs = g.n_inputs();
+		p.n_outputs = g.n_outputs();
+
+		// 1] reachability and fanout
+		std::vector<bool> reachable(n_nodes, false);
+		std::vector<uint32_t> fanout(n_nodes, 0);
+		for (const node_id o : g.outputs()) {
+			reachable[o] = true;
+			++fanout[o];
+		}
+		for (size_t j = n_nodes; j-- > 0;) {
+			if (!reachable[j]) continue;
+			const node& n = nodes[j];
+			for (int i = 0; i < priv::n_children(n.kind); ++i) {
+				const node_id c = priv::child(n, i);
+				if ((i > 0) && (c == priv::child(n, 0))) continue;
+				if ((i > 1) && (c == priv::child(n, 1))) continue;
+				reachable[c] = true;
+				++fanout[c];
+			}
+		}
+
+		// 2] cut points: inputs, shared nodes, outputs, and nodes needed to keep every cone at three inputs
+		std::vector<bool> cut(n_nodes, false);
+		std::vector<std::vector<node_id>> support(n_nodes);
+		for (size_t j = 0; j < n_nodes; ++j) {
+			if (!reachable[j]) continue;
+			const node& n = nodes[j];
+			if (n.kind == op::input) {
+				cut[j] = true;
+				support[j] = { static_cast<node_id>(j) };
+				continue;
+			}
+			if (n.kind == op::constant) continue;
+
+			cut[j] = (fanout[j] > 1);
+			const int n_children = priv::n_children(n.kind);
+
+			auto child_support = [&](const node_id c) -> std::vector<node_id> {
+				if (nodes[c].kind == op::constant) return {};
+				if (cut[c]) return { c };
+				return support[c];
+			};
+			auto merge = [&]() {
+				std::vector<node_id> result;
+				for (int i = 0; i < n_children; ++i) {
+					for (const node_id s : child_support(priv::child(n, i))) {
+						if (std::find(result.begin(), result.end(), s) == result.end()) result.push_back(s);
+					}
+				}
+				return result;
+			};
+
+			std::vector<node_id> merged = merge();
+			while (merged.size() > 3) {
+				node_id largest = none;
+				for (int i = 0; i < n_children; ++i) {
+					const node_id c = priv::child(n, i);
+					if (cut[c] || (nodes[c].kind == op::constant)) continue;
+					if ((largest == none) || (support[c].size() > support[largest].size())) largest = c;
+				}
+				cut[largest] = true;
+				merged = merge();
+			}
+			support[j] = merged;
+		}
+		for (const node_id o : g.outputs()) {
+			if (nodes[o].kind != op::constant) cut[o] = true;
+		}
+
+		// 3] operand of every materialized node
+		std::vector<uint32_t> operand(n_nodes, none);
+		std::vector<size_t> last_use(n_nodes, 0);
+		for (size_t j = 0; j < n_nodes; ++j) {
+			if (reachable[j] && (nodes[j].kind == op::input)) operand[j] = nodes[j].value;
+		}
+		for (size_t o = 0; o < g.n_outputs(); ++o) {
+			const node_id id = g.outputs()[o];
+			if ((operand[id] == none) && (nodes[id].kind != op::input) && (nodes[id].kind != op::constant)) {
+				operand[id] = static_cast<uint32_t>(p.n_inputs + o);
+			}
+		}
+		for (size_t j = 0; j < n_nodes; ++j) {
+			if (cut[j] && (nodes[j].kind != op::input)) {
+				for (const node_id s : support[j]) last_use[s] = j;
+			}
+		}
+
+		// 4] emit the cones in topological order, reusing dead scratch
+		std::vector<uint32_t> free_scratch;
+		std::vector<node_id> live_scratch;
+		std::vector<bool> complemented(n_nodes, false);
+		const uint32_t scratch_base = static_cast<uint32_t>(p.n_inputs + p.n_outputs);
+
+		for (size_t j = 0; j < n_nodes; ++j) {
+			if (!cut[j] || (nodes[j].kind == op::input)) continue;
+
+			const std::vector<node_id>& s = support[j];
+			uint32_t src[3];
+			for (size_t i = 0; i < 3; ++i) {
+				src[i] = (i < s.size()) ? operand[s[i]] : ((s.empty()) ? 0 : operand[s[0]]);
+			}
+			bf_type k = priv::cone_function(nodes, s, static_cast<node_id>(j), true);
+			for (size_t i = 0; i < s.size(); ++i) {
+				if (complemented[s[i]]) k = complement_input(k, static_cast<int>(i));
+			}
+
+			for (auto it = live_scratch.begin(); it != live_scratch.end();) {
+				if (last_use[*it] <= j) {
+					free_scratch.push_back(operand[*it]);
+					it = live_scratch.erase(it);
+				}
+				else ++it;
+			}
+			if (operand[j] == none) {
+				if (free_scratch.empty()) {
+					operand[j] = scratch_base + static_cast<uint32_t>(p.n_scratch++);
+				}
+				else {
+					operand[j] = free_scratch.back();
+					free_scratch.pop_back();
+				}
+				live_scratch.push_back(static_cast<node_id>(j));
+			}
+			if ((operand[j] >= scratch_base) && complement_is_cheaper(k, target)) {
+				k ^= 0xFF;
+				complemented[j] = true;
+			}
+			if (s.empty()) { // constant cone: the operands are not read, any valid operand will do
+				src[0] = src[1] = src[2] = operand[j];
+			}
+			p.code.push_back(instruction{ k, operand[j], src[0], src[1], src[2], complemented[j] });
+		}
+
+		// 5] outputs that are not computed in place: inputs, constants and duplicates
+		for (size_t o = 0; o < g.n_outputs(); ++o) {
+			const node_id id = g.outputs()[o];
+			const uint32_t dst = static_cast<uint32_t>(p.n_inputs + o);
+			if (operand[id] == dst) continue;
+			if (nodes[id].kind == op::constant) {
+				p.code.push_back(instruction{ static_cast<bf_type>((nodes[id].value) ? 0xFF : 0x00), dst, dst, dst, dst });
+			}
+			else {
+				p.code.push_back(instruction{ 0xF0, dst, operand[id], operand[id], operand[id] });
+			}
+		}
+		return p;
+	}
+
+	/// <summary>
+	/// Compile the graph for the backend of bit-vectors of T
+	/// </summary>
+	template<typename T>
+	[[nodiscard]] program compile(const graph& g)
+	{
+		return compile(g, isa_of<T>::value);
+	}
+
+	/// <summary>
+	/// The program with its complemented results chosen for the backend target instead of p.target
+	/// </summary>
+	[[nodiscard]] inline program retarget(const program& p, const isa target)
+	{
+		program r = p;
+		r.target = target;
+		const uint32_t scratch_base = static_cast<uint32_t>(p.n_inputs + p.n_outputs);
+		std::vector<bool> was(p.n_operands(), false); // operand holds a complemented result in p
+		std::vector<bool> is(p.n_operands(), false); // operand holds a complemented result in r
+
+		for (instruction& ins : r.code) {
+			bf_type k = (ins.complemented) ? static_cast<bf_type>(ins.k ^ 0xFF) : ins.k;
+			const uint32_t src[3] = { ins.a, ins.b, ins.c };
+			for (int i = 0; i < 3; ++i) {
+				if (was[src[i]] != is[src[i]]) k = complement_input(k, i);
+			}
+			was[ins.dst] = ins.complemented;
+			ins.complemented = (ins.dst >= scratch_base) && complement_is_cheaper(k, target);
+			is[ins.dst] = ins.complemented;
+			ins.k = (ins.complemented) ? static_cast<bf_type>(k ^ 0xFF) : k;
+		}
+		return r;
+	}
+
+	/// <summary>
+	/// Default working set of one tile: half of a 32 KiB L1 data cache
+	/// </summary>
+	constexpr size_t default_tile_bytes = 16 * 1024;
+
+	/// <summary>
+	/// Execute the program on n elements of every input, writing n elements of every output. The program is run
+	/// tile by tile such that the inputs, outputs and scratch of one tile fit in tile_bytes; every input element
+	/// is thus read from memory once. Every instruction is a bulk kernel over the whole tile, so intermediate
+	/// results go through the scratch of the tile in L1, not through registers (jit::execute keeps them in
+	/// registers). A program compiled for another backend than the one of T is retargeted first. Outputs may
+	/// not alias inputs.
+	/// </summary>
+	template<typename T>
+	void execute(const program& p, const T* const* inputs, T* const* outputs, const size_t n, const size_t tile_bytes = default_tile_bytes)
+	{
+		if (p.target != isa_of<T>::value) {
+			execute<T>(retarget(p, isa_of<T>::value), inputs, outputs, n, tile_bytes);
+			return;
+		}
+		const size_t n_operands = p.n_operands();
+		const size_t tile = std::max<size_t>(1, tile_bytes / (sizeof(T) * std::max<size_t>(1, n_operands)));
+
+		std::vector<bulk::kernel<T>> kernels;
+		kernels.reserve(p.code.size());
+		// with tiny tiles the program is a chain of dependent kernels
+		for (const instruction& ins : p.code) {
+			kernels.push_back(bulk::get_kernel<T>(ins.k, bulk::goal_of(std::min(n, tile))));
+			profile::count<T>(ins.k, n);
+		}
+
+		std::vector<T> scratch(p.n_scratch * tile);
+		std::vector<T*> operand(n_operands);
+		for (size_t s = 0; s < p.n_scratch; ++s) {
+			operand[p.n_inputs + p.n_outputs + s] = scratch.data() + (s * tile);
+		}
+
+		for (size_t begin = 0; begin < n; begin += tile)
+		{
+			const size_t length = std::min(tile, n - begin);
+			for (size_t i = 0; i < p.n_inputs; ++i) {
+				operand[i] = const_cast<T*>(inputs[i]) + begin;
+			}
+			for (size_t o = 0; o < p.n_outputs; ++o) {
+				operand[p.n_inputs + o] = outputs[o] + begin;
+			}
+			for (size_t i = 0; i < p.code.size(); ++i) {
+				const instruction& ins = p.code[i];
+				kernels[i](operand[ins.dst], operand[ins.a], operand[ins.b], operand[ins.c], length);
+			}
+		}
+	}
+
+	namespace test
+	{
+		/// <summary>
+		/// Evaluate the graph node by node, materializing every intermediate
+		/// </summary>
+		inline std::vector<std::vector<uint64_t>> evaluate_naive(const graph& g, const std::vector<std::vector<uint64_t>>& inputs, const size_t n)
+		{
+			std::vector<std::vector<uint64_t>> values(g.nodes().size(), std::vector<uint64_t>(n));
+			for (size_t j = 0; j < g.nodes().size(); ++j) {
+				const node& nd = g.nodes()[j];
+				for (size_t i = 0; i < n; ++i) {
+					const uint64_t a = values[nd.a][i];
+					const uint64_t b = values[nd.b][i];
+					const uint64_t c = values[nd.c][i];
+					switch (nd.kind)
+					{
+						case op::input: values[j][i] = inputs[nd.value][i]; break;
+						case op::constant: values[j][i] = (nd.value) ? ~uint64_t(0) : 0; break;
+						case op::bit_not: values[j][i] = ~a; break;
+						case op::bit_and: values[j][i] = a & b; break;
+						case op::bit_or: values[j][i] = a | b; break;
+						case op::bit_xor: values[j][i] = a ^ b; break;
+						case op::select: values[j][i] = (a & b) | (~a & c); break;
+					}
+				}
+			}
+			std::vector<std::vector<uint64_t>> result;
+			for (const node_id o : g.outputs()) result.push_back(values[o]);
+			return result;
+		}
+
+		inline uint64_t random_word()
+		{
+			return (static_cast<uint64_t>(rand()) << 48) ^ (static_cast<uint64_t>(rand()) << 32) ^ (static_cast<uint64_t>(rand()) << 16) ^ static_cast<uint64_t>(rand());
+		}
+
+		inline graph random_graph(const int n_inputs, const int n_ops, const int n_outputs)
+		{
+			graph g;
+			std::vector<node_id> pool;
+			for (int i = 0; i < n_inputs; ++i) pool.push_back(g.input());
+			pool.push_back(g.constant(true));
+			for (int i = 0; i < n_ops; ++i) {
+				const node_id a = pool[rand() % pool.size()];
+				const node_id b = pool[rand() % pool.size()];
+				const node_id c = pool[rand() % pool.size()];
+				switch (rand() % 5)
+				{
+					case 0: pool.push_back(g.bit_not(a)); break;
+					case 1: pool.push_back(g.bit_and(a, b)); break;
+					case 2: pool.push_back(g.bit_or(a, b)); break;
+					case 3: pool.push_back(g.bit_xor(a, b)); break;
+					default: pool.push_back(g.select(a, b, c)); break;
+				}
+			}
+			for (int i = 0; i < n_outputs; ++i) g.output(pool[pool.size() - 1 - (rand() % std::min<size_t>(pool.size(), 8))]);
+			return g;
+		}
+
+		inline void test_expr_equals_naive()
+		{
+			std::cout << "ternarylogic::expr::test_expr_equals_naive" << std::endl;
+
+			constexpr size_t n = 1000;
+			bool has_error = false;
+
+			for (int experiment = 0; experiment < 100; ++experiment)
+			{
+				const graph g = random_graph(12, 60, 4);
+				std::vector<std::vector<uint64_t>> inputs(g.n_inputs(), std::vector<uint64_t>(n));
+				for (auto& in : inputs) for (auto& w : in) w = random_word();
+
+				const auto expected = evaluate_naive(g, inputs, n);
+
+				std::vector<std::vector<uint64_t>> outputs(g.n_outputs(), std::vector<uint64_t>(n));
+				std::vector<const uint64_t*> in_ptr;
+				std::vector<uint64_t*> out_ptr;
+				for (auto& in : inputs) in_ptr.push_back(in.data());
+				for (auto& out : outputs) out_ptr.push_back(out.data());
+
+				// odd experiments run a program compiled for another backend
+				const program p = ((experiment & 1) == 0) ? compile<uint64_t>(g) : compile(g, isa::avx512raw);
+				execute<uint64_t>(p, in_ptr.data(), out_ptr.data(), n, 1024);
+
+				if (outputs != expected) {
+					std::cout << "ERROR: test_expr_equals_naive: experiment " << experiment << " differs" << std::endl;
+					has_error = true;
+				}
+			}
+			if (!has_error) {
+				std::cout << "test_expr_equals_naive: No errors found!" << std::endl;
+			}
+		}
+
+		inline void test_expr_fusion()
+		{
+			std::cout << "ternarylogic::expr::test_expr_fusion" << std::endl;
+
+			// full adder: sum = a ^ b ^ c and carry = maj(a, b, c) are single ternary operations
+			graph g;
+			const node_id a = g.input();
+			const node_id b = g.input();
+			const node_id c = g.input();
+			g.output(g.bit_xor(g.bit_xor(a, b), c));
+			g.output(g.bit_or(g.bit_and(a, b), g.bit_and(c, g.bit_or(a, b))));
+
+			const program p = compile<uint64_t>(g);
+			if ((p.code.size() != 2) || (p.code[0].k != 0x96) || (p.code[1].k != 0xE8) || (p.n_scratch != 0)) {
+				std::cout << "ERROR: test_expr_fusion: full adder is not fused in two operations" << std::endl;
+			}
+			else {
+				std::cout << "test_expr_fusion: No errors found!" << std::endl;
+			}
+		}
+
+		inline void test_expr_complemented()
+		{
+			std::cout << "ternarylogic::expr::test_expr_complemented" << std::endl;
+
+			// nor(a, b, c) is shared, thus a cone of its own: it is kept as a | b | c and the consumers absorb the not
+			graph g;
+			const node_id a = g.input();
+			const node_id b = g.input();
+			const node_id c = g.input();
+			const node_id d = g.input();
+			const node_id n = g.bit_not(g.bit_or(g.bit_or(a, b), c));
+			g.output(g.bit_and(n, d));
+			g.output(g.bit_xor(n, d));
+
+			const program p = compile(g, isa::sse);
+			if ((p.code.size() != 3) || (p.code[0].k != 0xFE) || (p.code[1].k != 0x0C) || (p.code[2].k != 0xC3)) {
+				std::cout << "ERROR: test_expr_complemented: the not of nor(a, b, c) is not absorbed" << std::endl;
+			}
+			else if (compile(g, isa::avx512raw).code[0].k != 0x01) {
+				std::cout << "ERROR: test_expr_complemented: a single vpternlog is complemented" << std::endl;
+			}
+			else if ((retarget(p, isa::avx512raw).code[0].k != 0x01) || (retarget(p, isa::avx512raw).code[1].k != 0xC0) || (retarget(retarget(p, isa::avx512raw), isa::sse).code[1].k != 0x0C)) {
+				std::cout << "ERROR: test_expr_complemented: retarget differs from compile" << std::endl;
+			}
+			else {
+				std::cout << "test_expr_complemented: No errors found!" << std::endl;
+			}
+		}
+
+		inline void tests()
+		{
+			test_expr_fusion();
+			test_expr_complemented();
+			test_expr_equals_naive();
+		}
+	}
+}
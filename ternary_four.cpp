@@ -0,0 +1,240 @@
+// Generated automatically by decompose4, please do not edit
+#pragma once
+#include <cstdint>
+
+namespace ternarylogic::four {
+
+    // operands: 0 = A, 1 = B, 2 = C, 3 = D, 4 and up = results of the earlier instructions
+    struct instruction { uint8_t k, a, b, c; };
+
+    constexpr int max_instructions = 3;
+
+    // the result is the one of the last instruction
+    struct program { uint16_t k16; uint8_t size; instruction code[max_instructions]; };
+
+    // the least function of every NPN class, sorted; 14 take one instruction, 117 two and 91 three
+    constexpr program classes[222] = {
+        { 0x0000, 1, { { 0x00, 0, 0, 0 } } },
+        { 0x0001, 2, { { 0x05, 0, 0, 1 }, { 0x02, 2, 3, 4 } } },
+        { 0x0003, 1, { { 0x01, 0, 1, 2 } } },
+        { 0x0006, 2, { { 0xee, 0, 0, 1 }, { 0x14, 2, 3, 4 } } },
+        { 0x0007, 2, { { 0x05, 0, 0, 1 }, { 0x2a, 2, 3, 4 } } },
+        { 0x000f, 1, { { 0x05, 0, 0, 1 } } },
+        { 0x0016, 2, { { 0x16, 1, 2, 3 }, { 0x0a, 0, 0, 4 } } },
+        { 0x0017, 2, { { 0x17, 1, 2, 3 }, { 0x0a, 0, 0, 4 } } },
+        { 0x0018, 2, { { 0x06, 0, 1, 2 }, { 0x28, 1, 3, 4 } } },
+        { 0x0019, 2, { { 0x07, 0, 1, 2 }, { 0x82, 2, 3, 4 } } },
+        { 0x001b, 2, { { 0x07, 0, 1, 3 }, { 0x8a, 2, 3, 4 } } },
+        { 0x001e, 2, { { 0xee, 0, 2, 3 }, { 0x06, 0, 1, 4 } } },
+        { 0x001f, 2, { { 0xee, 0, 2, 3 }, { 0x07, 0, 1, 4 } } },
+        { 0x003c, 1, { { 0x06, 0, 1, 2 } } },
+        { 0x003d, 2, { { 0x0e, 1, 2, 3 }, { 0x09, 0, 2, 4 } } },
+        { 0x003f, 1, { { 0x07, 0, 1, 2 } } },
+        { 0x0069, 2, { { 0x66, 0, 1, 2 }, { 0x09, 0, 3, 4 } } },
+        { 0x006b, 2, { { 0x3e, 1, 2, 3 }, { 0x09, 0, 3, 4 } } },
+        { 0x006f, 2, { { 0x66, 0, 2, 3 }, { 0x0b, 0, 1, 4 } } },
+        { 0x007e, 2, { { 0x7e, 1, 2, 3 }, { 0x0a, 0, 0, 4 } } },
+        { 0x007f, 2, { { 0x88, 0, 1, 2 }, { 0x07, 0, 3, 4 } } },
+        { 0x00ff, 1, { { 0x0f, 0, 0, 0 } } },
+        { 0x0116, 3, { { 0x01, 1, 2, 3 }, { 0x16, 1, 2, 3 }, { 0xca, 0, 4, 5 } } },
+        { 0x0117, 3, { { 0x01, 1, 2, 3 }, { 0x17, 1, 2, 3 }, { 0xca, 0, 4, 5 } } },
+        { 0x0118, 2, { { 0x16, 0, 1, 2 }, { 0x82, 2, 3, 4 } } },
+        { 0x0119, 2, { { 0x17, 0, 1, 2 }, { 0x82, 2, 3, 4 } } },
+        { 0x011a, 2, { { 0x16, 0, 1, 3 }, { 0x8a, 2, 3, 4 } } },
+        { 0x011b, 2, { { 0x17, 0, 1, 3 }, { 0x8a, 2, 3, 4 } } },
+        { 0x011e, 2, { { 0x1e, 0, 2, 3 }, { 0x26, 0, 1, 4 } } },
+        { 0x011f, 2, { { 0x1e, 0, 2, 3 }, { 0x27, 0, 1, 4 } } },
+        { 0x012c, 3, { { 0x06, 0, 1, 2 }, { 0x12, 0, 1, 2 }, { 0xca, 3, 4, 5 } } },
+        { 0x012d, 2, { { 0x12, 0, 2, 3 }, { 0x29, 0, 1, 4 } } },
+        { 0x012f, 2, { { 0x12, 0, 2, 3 }, { 0x2b, 0, 1, 4 } } },
+        { 0x013c, 2, { { 0x16, 0, 1, 2 }, { 0x2a, 0, 3, 4 } } },
+        { 0x013d, 3, { { 0x03, 0, 2, 3 }, { 0x1d, 0, 2, 3 }, { 0xca, 1, 4, 5 } } },
+        { 0x013e, 2, { { 0x3e, 1, 2, 3 }, { 0x1a, 0, 1, 4 } } },
+        { 0x013f, 2, { { 0x17, 0, 1, 2 }, { 0x2a, 0, 3, 4 } } },
+        { 0x0168, 3, { { 0x06, 0, 2, 3 }, { 0x18, 0, 2, 3 }, { 0xca, 1, 4, 5 } } },
+        { 0x0169, 2, { { 0x19, 0, 1, 2 }, { 0x26, 0, 3, 4 } } },
+        { 0x016a, 2, { { 0x18, 0, 1, 2 }, { 0x26, 0, 3, 4 } } },
+        { 0x016b, 3, { { 0x06, 0, 2, 3 }, { 0x1b, 0, 2, 3 }, { 0xca, 1, 4, 5 } } },
+        { 0x016e, 2, { { 0x6e, 1, 2, 3 }, { 0x1a, 0, 1, 4 } } },
+        { 0x016f, 2, { { 0xe6, 0, 2, 3 }, { 0x1b, 0, 1, 4 } } },
+        { 0x017e, 2, { { 0x7e, 1, 2, 3 }, { 0x1a, 0, 1, 4 } } },
+        { 0x017f, 2, { { 0x18, 0, 1, 2 }, { 0x27, 0, 3, 4 } } },
+        { 0x0180, 2, { { 0x18, 0, 1, 2 }, { 0x28, 0, 3, 4 } } },
+        { 0x0181, 2, { { 0x19, 0, 1, 2 }, { 0x82, 1, 3, 4 } } },
+        { 0x0182, 2, { { 0xe6, 0, 1, 2 }, { 0x14, 0, 3, 4 } } },
+        { 0x0183, 2, { { 0x1b, 0, 1, 3 }, { 0x82, 1, 2, 4 } } },
+        { 0x0186, 3, { { 0x08, 0, 2, 3 }, { 0x16, 0, 2, 3 }, { 0xca, 1, 4, 5 } } },
+        { 0x0187, 2, { { 0x17, 0, 2, 3 }, { 0x26, 0, 1, 4 } } },
+        { 0x0189, 2, { { 0x1b, 0, 1, 2 }, { 0x82, 2, 3, 4 } } },
+        { 0x018b, 2, { { 0x1b, 0, 2, 3 }, { 0x8a, 1, 2, 4 } } },
+        { 0x018f, 2, { { 0x18, 0, 2, 3 }, { 0x2b, 0, 1, 4 } } },
+        { 0x0196, 2, { { 0x16, 0, 1, 2 }, { 0x26, 0, 3, 4 } } },
+        { 0x0197, 3, { { 0x01, 1, 2, 3 }, { 0x97, 1, 2, 3 }, { 0xca, 0, 4, 5 } } },
+        { 0x0198, 2, { { 0x1e, 0, 1, 2 }, { 0x82, 2, 3, 4 } } },
+        { 0x0199, 2, { { 0x1f, 0, 1, 2 }, { 0x82, 2, 3, 4 } } },
+        { 0x019a, 2, { { 0x14, 0, 1, 2 }, { 0x26, 0, 3, 4 } } },
+        { 0x019b, 3, { { 0x0a, 0, 1, 3 }, { 0x17, 0, 1, 3 }, { 0xca, 2, 4, 5 } } },
+        { 0x019e, 2, { { 0x6e, 1, 2, 3 }, { 0x16, 0, 1, 4 } } },
+        { 0x019f, 2, { { 0x16, 0, 2, 3 }, { 0x27, 0, 1, 4 } } },
+        { 0x01a8, 2, { { 0x1e, 0, 1, 2 }, { 0x28, 0, 3, 4 } } },
+        { 0x01a9, 2, { { 0x11, 0, 1, 2 }, { 0x26, 0, 3, 4 } } },
+        { 0x01aa, 2, { { 0xe0, 0, 1, 2 }, { 0x14, 0, 3, 4 } } },
+        { 0x01ab, 2, { { 0x11, 0, 1, 2 }, { 0x2e, 0, 3, 4 } } },
+        { 0x01ac, 3, { { 0x0a, 0, 2, 3 }, { 0x1c, 0, 2, 3 }, { 0xca, 1, 4, 5 } } },
+        { 0x01ad, 3, { { 0x0a, 0, 2, 3 }, { 0x1d, 0, 2, 3 }, { 0xca, 1, 4, 5 } } },
+        { 0x01ae, 2, { { 0x1e, 0, 2, 3 }, { 0x8a, 1, 3, 4 } } },
+        { 0x01af, 2, { { 0x1f, 0, 2, 3 }, { 0x8a, 1, 3, 4 } } },
+        { 0x01bc, 3, { { 0x0e, 0, 1, 2 }, { 0x16, 0, 1, 2 }, { 0xca, 3, 4, 5 } } },
+        { 0x01bd, 3, { { 0x0e, 0, 1, 2 }, { 0x17, 0, 1, 2 }, { 0xca, 3, 4, 5 } } },
+        { 0x01be, 2, { { 0xe6, 0, 1, 2 }, { 0x1e, 0, 3, 4 } } },
+        { 0x01bf, 2, { { 0x18, 0, 1, 2 }, { 0x2d, 0, 3, 4 } } },
+        { 0x01e8, 3, { { 0x0e, 0, 2, 3 }, { 0x18, 0, 2, 3 }, { 0xca, 1, 4, 5 } } },
+        { 0x01e9, 3, { { 0x0e, 0, 2, 3 }, { 0x19, 0, 2, 3 }, { 0xca, 1, 4, 5 } } },
+        { 0x01ea, 2, { { 0x18, 0, 1, 2 }, { 0x2e, 0, 3, 4 } } },
+        { 0x01eb, 2, { { 0x16, 0, 1, 2 }, { 0x2d, 0, 3, 4 } } },
+        { 0x01ee, 2, { { 0xea, 0, 1, 2 }, { 0x1e, 0, 3, 4 } } },
+        { 0x01ef, 2, { { 0x14, 0, 1, 2 }, { 0x2d, 0, 3, 4 } } },
+        { 0x01fe, 2, { { 0xee, 0, 1, 2 }, { 0x1e, 0, 3, 4 } } },
+        { 0x033c, 1, { { 0x16, 0, 1, 2 } } },
+        { 0x033d, 3, { { 0x03, 1, 2, 3 }, { 0x3d, 1, 2, 3 }, { 0xca, 0, 4, 5 } } },
+        { 0x033f, 1, { { 0x17, 0, 1, 2 } } },
+        { 0x0356, 2, { { 0xee, 0, 0, 3 }, { 0x56, 1, 2, 4 } } },
+        { 0x0357, 2, { { 0xee, 0, 0, 3 }, { 0x57, 1, 2, 4 } } },
+        { 0x0358, 3, { { 0x06, 0, 1, 3 }, { 0x34, 0, 1, 3 }, { 0xca, 2, 4, 5 } } },
+        { 0x0359, 2, { { 0x12, 0, 1, 2 }, { 0xa9, 0, 3, 4 } } },
+        { 0x035a, 2, { { 0xec, 0, 1, 2 }, { 0x56, 0, 3, 4 } } },
+        { 0x035b, 2, { { 0x06, 0, 1, 3 }, { 0xab, 1, 2, 4 } } },
+        { 0x035e, 3, { { 0x03, 1, 2, 3 }, { 0x5e, 1, 2, 3 }, { 0xca, 0, 4, 5 } } },
+        { 0x035f, 2, { { 0x1f, 0, 1, 2 }, { 0x2a, 1, 3, 4 } } },
+        { 0x0368, 3, { { 0x06, 0, 2, 3 }, { 0x38, 0, 2, 3 }, { 0xca, 1, 4, 5 } } },
+        { 0x0369, 2, { { 0x19, 0, 1, 2 }, { 0xa6, 0, 3, 4 } } },
+        { 0x036a, 2, { { 0x18, 0, 1, 2 }, { 0xa6, 0, 3, 4 } } },
+        { 0x036b, 3, { { 0x06, 0, 2, 3 }, { 0x3b, 0, 2, 3 }, { 0xca, 1, 4, 5 } } },
+        { 0x036c, 2, { { 0x6c, 1, 2, 3 }, { 0x1a, 0, 1, 4 } } },
+        { 0x036d, 3, { { 0x06, 0, 2, 3 }, { 0x3d, 0, 2, 3 }, { 0xca, 1, 4, 5 } } },
+        { 0x036e, 3, { { 0x06, 0, 2, 3 }, { 0x3e, 0, 2, 3 }, { 0xca, 1, 4, 5 } } },
+        { 0x036f, 2, { { 0xc6, 0, 2, 3 }, { 0x1b, 0, 1, 4 } } },
+        { 0x037c, 2, { { 0x7c, 1, 2, 3 }, { 0x1a, 0, 1, 4 } } },
+        { 0x037d, 2, { { 0x16, 0, 1, 2 }, { 0xab, 0, 3, 4 } } },
+        { 0x037e, 3, { { 0x03, 1, 2, 3 }, { 0x7e, 1, 2, 3 }, { 0xca, 0, 4, 5 } } },
+        { 0x03c0, 1, { { 0x18, 0, 1, 2 } } },
+        { 0x03c1, 2, { { 0x0e, 0, 1, 3 }, { 0x81, 1, 2, 4 } } },
+        { 0x03c3, 1, { { 0x19, 0, 1, 2 } } },
+        { 0x03c5, 3, { { 0x0c, 0, 2, 3 }, { 0x35, 0, 2, 3 }, { 0xca, 1, 4, 5 } } },
+        { 0x03c6, 2, { { 0x32, 0, 1, 3 }, { 0x26, 0, 2, 4 } } },
+        { 0x03c7, 2, { { 0x3e, 0, 1, 3 }, { 0x87, 1, 2, 4 } } },
+        { 0x03cf, 1, { { 0x1b, 0, 1, 2 } } },
+        { 0x03d4, 3, { { 0x18, 0, 1, 2 }, { 0x1e, 0, 1, 2 }, { 0xca, 3, 4, 5 } } },
+        { 0x03d5, 2, { { 0x18, 0, 1, 2 }, { 0xab, 0, 3, 4 } } },
+        { 0x03d6, 3, { { 0x0d, 0, 2, 3 }, { 0x36, 0, 2, 3 }, { 0xca, 1, 4, 5 } } },
+        { 0x03d7, 2, { { 0xe6, 0, 1, 2 }, { 0x57, 0, 3, 4 } } },
+        { 0x03d8, 3, { { 0x0e, 0, 1, 3 }, { 0x34, 0, 1, 3 }, { 0xca, 2, 4, 5 } } },
+        { 0x03d9, 3, { { 0x0e, 0, 1, 3 }, { 0x35, 0, 1, 3 }, { 0xca, 2, 4, 5 } } },
+        { 0x03db, 3, { { 0x0e, 0, 1, 3 }, { 0x37, 0, 1, 3 }, { 0xca, 2, 4, 5 } } },
+        { 0x03dc, 2, { { 0xc4, 0, 1, 3 }, { 0x1e, 0, 2, 4 } } },
+        { 0x03dd, 2, { { 0x1a, 0, 1, 2 }, { 0xab, 0, 3, 4 } } },
+        { 0x03de, 2, { { 0xc6, 0, 1, 3 }, { 0x1e, 0, 2, 4 } } },
+        { 0x03fc, 1, { { 0x1e, 0, 1, 2 } } },
+        { 0x0660, 2, { { 0x5a, 0, 0, 1 }, { 0x28, 2, 3, 4 } } },
+        { 0x0661, 3, { { 0x06, 1, 2, 3 }, { 0x61, 1, 2, 3 }, { 0xca, 0, 4, 5 } } },
+        { 0x0662, 2, { { 0xc2, 0, 1, 2 }, { 0x14, 2, 3, 4 } } },
+        { 0x0663, 3, { { 0x06, 1, 2, 3 }, { 0x63, 1, 2, 3 }, { 0xca, 0, 4, 5 } } },
+        { 0x0666, 2, { { 0x88, 0, 0, 1 }, { 0x14, 2, 3, 4 } } },
+        { 0x0667, 3, { { 0x06, 1, 2, 3 }, { 0x67, 1, 2, 3 }, { 0xca, 0, 4, 5 } } },
+        { 0x0669, 2, { { 0x66, 0, 2, 3 }, { 0x29, 0, 1, 4 } } },
+        { 0x066b, 3, { { 0x06, 1, 2, 3 }, { 0x6b, 1, 2, 3 }, { 0xca, 0, 4, 5 } } },
+        { 0x066f, 2, { { 0x66, 0, 2, 3 }, { 0x2b, 0, 1, 4 } } },
+        { 0x0672, 3, { { 0x06, 1, 2, 3 }, { 0x72, 1, 2, 3 }, { 0xca, 0, 4, 5 } } },
+        { 0x0673, 3, { { 0x06, 1, 2, 3 }, { 0x73, 1, 2, 3 }, { 0xca, 0, 4, 5 } } },
+        { 0x0676, 2, { { 0x76, 1, 2, 3 }, { 0x2a, 0, 1, 4 } } },
+        { 0x0678, 2, { { 0x68, 0, 2, 3 }, { 0x26, 0, 1, 4 } } },
+        { 0x0679, 2, { { 0x76, 1, 2, 3 }, { 0x29, 0, 1, 4 } } },
+        { 0x067a, 3, { { 0x06, 1, 2, 3 }, { 0x7a, 1, 2, 3 }, { 0xca, 0, 4, 5 } } },
+        { 0x067b, 3, { { 0x06, 1, 2, 3 }, { 0x7b, 1, 2, 3 }, { 0xca, 0, 4, 5 } } },
+        { 0x067e, 3, { { 0x06, 1, 2, 3 }, { 0x7e, 1, 2, 3 }, { 0xca, 0, 4, 5 } } },
+        { 0x0690, 2, { { 0x66, 0, 2, 3 }, { 0x24, 0, 1, 4 } } },
+        { 0x0691, 3, { { 0x06, 1, 2, 3 }, { 0x91, 1, 2, 3 }, { 0xca, 0, 4, 5 } } },
+        { 0x0693, 3, { { 0x06, 1, 2, 3 }, { 0x93, 1, 2, 3 }, { 0xca, 0, 4, 5 } } },
+        { 0x0696, 2, { { 0x66, 0, 2, 3 }, { 0x26, 0, 1, 4 } } },
+        { 0x0697, 3, { { 0x06, 1, 2, 3 }, { 0x97, 1, 2, 3 }, { 0xca, 0, 4, 5 } } },
+        { 0x069f, 2, { { 0x66, 0, 2, 3 }, { 0x27, 0, 1, 4 } } },
+        { 0x06b0, 2, { { 0x64, 0, 2, 3 }, { 0x24, 0, 1, 4 } } },
+        { 0x06b1, 3, { { 0x06, 1, 2, 3 }, { 0xb1, 1, 2, 3 }, { 0xca, 0, 4, 5 } } },
+        { 0x06b2, 3, { { 0x06, 1, 2, 3 }, { 0xb2, 1, 2, 3 }, { 0xca, 0, 4, 5 } } },
+        { 0x06b3, 3, { { 0x06, 1, 2, 3 }, { 0xb3, 1, 2, 3 }, { 0xca, 0, 4, 5 } } },
+        { 0x06b4, 2, { { 0x64, 0, 2, 3 }, { 0x26, 0, 1, 4 } } },
+        { 0x06b5, 3, { { 0x06, 1, 2, 3 }, { 0xb5, 1, 2, 3 }, { 0xca, 0, 4, 5 } } },
+        { 0x06b6, 2, { { 0x46, 1, 2, 3 }, { 0x26, 0, 1, 4 } } },
+        { 0x06b7, 3, { { 0x06, 1, 2, 3 }, { 0xb7, 1, 2, 3 }, { 0xca, 0, 4, 5 } } },
+        { 0x06b9, 2, { { 0x46, 1, 2, 3 }, { 0x25, 0, 1, 4 } } },
+        { 0x06bd, 3, { { 0x06, 1, 2, 3 }, { 0xbd, 1, 2, 3 }, { 0xca, 0, 4, 5 } } },
+        { 0x06f0, 2, { { 0x66, 0, 2, 3 }, { 0x2c, 0, 1, 4 } } },
+        { 0x06f1, 2, { { 0x6e, 0, 2, 3 }, { 0x2d, 0, 1, 4 } } },
+        { 0x06f2, 2, { { 0x62, 0, 2, 3 }, { 0x2e, 0, 1, 4 } } },
+        { 0x06f6, 2, { { 0x66, 0, 2, 3 }, { 0x2e, 0, 1, 4 } } },
+        { 0x06f9, 2, { { 0x66, 0, 2, 3 }, { 0x2d, 0, 1, 4 } } },
+        { 0x0776, 3, { { 0x07, 1, 2, 3 }, { 0x76, 1, 2, 3 }, { 0xca, 0, 4, 5 } } },
+        { 0x0778, 2, { { 0x78, 0, 2, 3 }, { 0x26, 0, 1, 4 } } },
+        { 0x0779, 3, { { 0x16, 0, 1, 3 }, { 0x3d, 0, 1, 3 }, { 0xca, 2, 4, 5 } } },
+        { 0x077a, 3, { { 0x07, 1, 2, 3 }, { 0x7a, 1, 2, 3 }, { 0xca, 0, 4, 5 } } },
+        { 0x077e, 3, { { 0x07, 1, 2, 3 }, { 0x7e, 1, 2, 3 }, { 0xca, 0, 4, 5 } } },
+        { 0x07b0, 2, { { 0x84, 0, 2, 3 }, { 0x14, 0, 1, 4 } } },
+        { 0x07b1, 3, { { 0x18, 0, 1, 3 }, { 0x3d, 0, 1, 3 }, { 0xca, 2, 4, 5 } } },
+        { 0x07b4, 2, { { 0x74, 0, 2, 3 }, { 0x26, 0, 1, 4 } } },
+        { 0x07b5, 3, { { 0x1c, 0, 1, 2 }, { 0x37, 0, 1, 2 }, { 0xca, 3, 4, 5 } } },
+        { 0x07b6, 3, { { 0x0b, 0, 2, 3 }, { 0x76, 0, 2, 3 }, { 0xca, 1, 4, 5 } } },
+        { 0x07bc, 3, { { 0x1e, 0, 1, 2 }, { 0x36, 0, 1, 2 }, { 0xca, 3, 4, 5 } } },
+        { 0x07e0, 2, { { 0x7e, 0, 2, 3 }, { 0x28, 0, 1, 4 } } },
+        { 0x07e1, 2, { { 0x71, 0, 2, 3 }, { 0x26, 0, 1, 4 } } },
+        { 0x07e2, 3, { { 0x0e, 0, 2, 3 }, { 0x72, 0, 2, 3 }, { 0xca, 1, 4, 5 } } },
+        { 0x07e3, 3, { { 0x0e, 0, 2, 3 }, { 0x73, 0, 2, 3 }, { 0xca, 1, 4, 5 } } },
+        { 0x07e6, 3, { { 0x0e, 0, 2, 3 }, { 0x76, 0, 2, 3 }, { 0xca, 1, 4, 5 } } },
+        { 0x07e9, 3, { { 0x1e, 0, 1, 3 }, { 0x39, 0, 1, 3 }, { 0xca, 2, 4, 5 } } },
+        { 0x07f0, 2, { { 0x80, 0, 2, 3 }, { 0x14, 0, 1, 4 } } },
+        { 0x07f1, 2, { { 0x7e, 0, 2, 3 }, { 0x2d, 0, 1, 4 } } },
+        { 0x07f2, 2, { { 0x82, 0, 2, 3 }, { 0x1e, 0, 1, 4 } } },
+        { 0x07f8, 2, { { 0x88, 0, 2, 3 }, { 0x1e, 0, 1, 4 } } },
+        { 0x0ff0, 1, { { 0x5a, 0, 0, 1 } } },
+        { 0x1668, 3, { { 0x16, 1, 2, 3 }, { 0x68, 1, 2, 3 }, { 0xca, 0, 4, 5 } } },
+        { 0x1669, 3, { { 0x16, 1, 2, 3 }, { 0x69, 1, 2, 3 }, { 0xca, 0, 4, 5 } } },
+        { 0x166a, 3, { { 0x16, 1, 2, 3 }, { 0x6a, 1, 2, 3 }, { 0xca, 0, 4, 5 } } },
+        { 0x166b, 3, { { 0x16, 1, 2, 3 }, { 0x6b, 1, 2, 3 }, { 0xca, 0, 4, 5 } } },
+        { 0x166e, 3, { { 0x16, 1, 2, 3 }, { 0x6e, 1, 2, 3 }, { 0xca, 0, 4, 5 } } },
+        { 0x167e, 3, { { 0x16, 1, 2, 3 }, { 0x7e, 1, 2, 3 }, { 0xca, 0, 4, 5 } } },
+        { 0x1681, 3, { { 0x16, 1, 2, 3 }, { 0x81, 1, 2, 3 }, { 0xca, 0, 4, 5 } } },
+        { 0x1683, 3, { { 0x18, 0, 2, 3 }, { 0x63, 0, 2, 3 }, { 0xca, 1, 4, 5 } } },
+        { 0x1686, 3, { { 0x18, 0, 2, 3 }, { 0x66, 0, 2, 3 }, { 0xca, 1, 4, 5 } } },
+        { 0x1687, 3, { { 0x16, 1, 2, 3 }, { 0x87, 1, 2, 3 }, { 0xca, 0, 4, 5 } } },
+        { 0x1689, 3, { { 0x18, 0, 2, 3 }, { 0x69, 0, 2, 3 }, { 0xca, 1, 4, 5 } } },
+        { 0x168b, 3, { { 0x1a, 0, 1, 3 }, { 0x63, 0, 1, 3 }, { 0xca, 2, 4, 5 } } },
+        { 0x168e, 3, { { 0x18, 0, 2, 3 }, { 0x6e, 0, 2, 3 }, { 0xca, 1, 4, 5 } } },
+        { 0x1696, 3, { { 0x16, 1, 2, 3 }, { 0x96, 1, 2, 3 }, { 0xca, 0, 4, 5 } } },
+        { 0x1697, 3, { { 0x16, 1, 2, 3 }, { 0x97, 1, 2, 3 }, { 0xca, 0, 4, 5 } } },
+        { 0x1698, 3, { { 0x1a, 0, 1, 3 }, { 0x64, 0, 1, 3 }, { 0xca, 2, 4, 5 } } },
+        { 0x1699, 3, { { 0x16, 1, 2, 3 }, { 0x99, 1, 2, 3 }, { 0xca, 0, 4, 5 } } },
+        { 0x169a, 3, { { 0x1a, 0, 1, 3 }, { 0x66, 0, 1, 3 }, { 0xca, 2, 4, 5 } } },
+        { 0x169b, 3, { { 0x1a, 0, 1, 3 }, { 0x67, 0, 1, 3 }, { 0xca, 2, 4, 5 } } },
+        { 0x169e, 3, { { 0x1b, 0, 1, 3 }, { 0x66, 0, 1, 3 }, { 0xca, 2, 4, 5 } } },
+        { 0x16a9, 3, { { 0x1a, 0, 2, 3 }, { 0x69, 0, 2, 3 }, { 0xca, 1, 4, 5 } } },
+        { 0x16ac, 3, { { 0x1a, 0, 2, 3 }, { 0x6c, 0, 2, 3 }, { 0xca, 1, 4, 5 } } },
+        { 0x16ad, 3, { { 0x1e, 0, 1, 2 }, { 0x63, 0, 1, 2 }, { 0xca, 3, 4, 5 } } },
+        { 0x16bc, 2, { { 0xbc, 1, 2, 3 }, { 0x6a, 0, 3, 4 } } },
+        { 0x16e9, 2, { { 0x16, 1, 2, 3 }, { 0x99, 0, 0, 4 } } },
+        { 0x177e, 3, { { 0x17, 1, 2, 3 }, { 0x7e, 1, 2, 3 }, { 0xca, 0, 4, 5 } } },
+        { 0x178e, 3, { { 0x18, 0, 2, 3 }, { 0x7e, 0, 2, 3 }, { 0xca, 1, 4, 5 } } },
+        { 0x1796, 3, { { 0x17, 1, 2, 3 }, { 0x96, 1, 2, 3 }, { 0xca, 0, 4, 5 } } },
+        { 0x1798, 3, { { 0x1a, 0, 1, 3 }, { 0x74, 0, 1, 3 }, { 0xca, 2, 4, 5 } } },
+        { 0x179a, 3, { { 0x1a, 0, 1, 3 }, { 0x76, 0, 1, 3 }, { 0xca, 2, 4, 5 } } },
+        { 0x17ac, 3, { { 0x1e, 0, 1, 2 }, { 0x72, 0, 1, 2 }, { 0xca, 3, 4, 5 } } },
+        { 0x17e8, 2, { { 0x18, 1, 2, 3 }, { 0x96, 0, 1, 4 } } },
+        { 0x18e7, 2, { { 0x18, 1, 2, 3 }, { 0x99, 0, 0, 4 } } },
+        { 0x19e1, 3, { { 0x1e, 0, 2, 3 }, { 0x91, 0, 2, 3 }, { 0xca, 1, 4, 5 } } },
+        { 0x19e3, 3, { { 0x1e, 0, 2, 3 }, { 0x93, 0, 2, 3 }, { 0xca, 1, 4, 5 } } },
+        { 0x19e6, 2, { { 0x2a, 1, 2, 3 }, { 0x96, 0, 2, 4 } } },
+        { 0x1bd8, 3, { { 0x2e, 0, 1, 3 }, { 0x74, 0, 1, 3 }, { 0xca, 2, 4, 5 } } },
+        { 0x1be4, 2, { { 0x78, 0, 1, 3 }, { 0x9a, 2, 3, 4 } } },
+        { 0x1ee1, 2, { { 0x5a, 0, 0, 1 }, { 0xa9, 2, 3, 4 } } },
+        { 0x3cc3, 1, { { 0x69, 0, 1, 2 } } },
+        { 0x6996, 2, { { 0x5a, 0, 0, 1 }, { 0x96, 2, 3, 4 } } },
+    };
+}
@@ -0,0 +1,248 @@
+#pragma once
+#include <array>
+#include <vector>
+#include <utility>		// for index_sequence
+
+#include "ternary_logic.cpp"
+#include "ternary_four.cpp"
+
+namespace ternarylogic::four
+{
+	constexpr int n_inputs = 4;
+	constexpr uint16_t input_values[n_inputs] = { 0xFF00, 0xF0F0, 0xCCCC, 0xAAAA };
+	constexpr int n_transforms = 24 * 16 * 2;
+
+	namespace priv
+	{
+		constexpr uint8_t permutations[24][n_inputs] = {
+			{ 0, 1, 2, 3 }, { 0, 1, 3, 2 }, { 0, 2, 1, 3 }, { 0, 2, 3, 1 }, { 0, 3, 1, 2 }, { 0, 3, 2, 1 },
+			{ 1, 0, 2, 3 }, { 1, 0, 3, 2 }, { 1, 2, 0, 3 }, { 1, 2, 3, 0 }, { 1, 3, 0, 2 }, { 1, 3, 2, 0 },
+			{ 2, 0, 1, 3 }, { 2, 0, 3, 1 }, { 2, 1, 0, 3 }, { 2, 1, 3, 0 }, { 2, 3, 0, 1 }, { 2, 3, 1, 0 },
+			{ 3, 0, 1, 2 }, { 3, 0, 2, 1 }, { 3, 1, 0, 2 }, { 3, 1, 2, 0 }, { 3, 2, 0, 1 }, { 3, 2, 1, 0 },
+		};
+
+		/// <summary>
+		/// Function g(x) = o ^ f(y) with y[j] = x[perm[j]] ^ n[j]; transform t has perm = permutations[t / 32],
+		/// bit j of (t / 2) % 16 is n[j] and o = t % 2. The program of f computes g when its input j is input perm[j],
+		/// complemented if n[j], and its result is complemented if o
+		/// </summary>
+		[[nodiscard]] constexpr uint16_t transform(const uint16_t f, const int t) noexcept
+		{
+			const uint8_t* perm = permutations[t / 32];
+			const int negate = (t / 2) % 16;
+			unsigned g = 0;
+			for (int x = 0; x < 16; ++x) {
+				int y = 0;
+				for (int j = 0; j < n_inputs; ++j) {
+					const int bit = ((x >> (n_inputs - 1 - perm[j])) & 1) ^ ((negate >> j) & 1);
+					y |= bit << (n_inputs - 1 - j);
+				}
+				g |= ((f >> y) & 1u) << x;
+			}
+			return static_cast<uint16_t>((t % 2) ? ~g : g);
+		}
+
+		/// <summary>
+		/// Index of the class of representative f in the sorted table, -1 if there is none
+		/// </summary>
+		[[nodiscard]] constexpr int find(const uint16_t f) noexcept
+		{
+			size_t low = 0;
+			size_t high = std::size(classes);
+			while (low < high) {
+				const size_t mid = (low + high) / 2;
+				if (classes[mid].k16 == f) return static_cast<int>(mid);
+				if (classes[mid].k16 < f) low = mid + 1;
+				else high = mid;
+			}
+			return -1;
+		}
+
+		/// <summary>
+		/// The program of class c, rewritten by transform t to compute transform(classes[c].k16, t) from A, B, C and D:
+		/// the complements of the inputs and of the result are absorbed into the function codes
+		/// </summary>
+		[[nodiscard]] constexpr program specialise(const int c, const int t) noexcept
+		{
+			const uint8_t* perm = permutations[t / 32];
+			const int negate = (t / 2) % 16;
+			program p = classes[c];
+			for (int i = 0; i < p.size; ++i) {
+				instruction& ins = p.code[i];
+				uint8_t* operands[3] = { &ins.a, &ins.b, &ins.c };
+				bf_type k = ins.k;
+				for (int j = 0; j < 3; ++j) {
+					const uint8_t r = *operands[j];
+					if (r >= n_inputs) continue;
+					if ((negate >> r) & 1) k = complement_input(k, j);
+					*operands[j] = perm[r];
+				}
+				ins.k = static_cast<uint8_t>(k);
+			}
+			if (t % 2) p.code[p.size - 1].k ^= 0xFF;
+			p.k16 = transform(classes[c].k16, t);
+			return p;
+		}
+	}
+
+	/// <summary>
+	/// Program of ternary functions that computes the four input Boolean Function k16 with the fewest instructions
+	/// </summary>
+	[[nodiscard]] constexpr program decompose(const uint16_t k16) noexcept
+	{
+		uint16_t representative = k16;
+		for (int t = 0; t < n_transforms; ++t) {
+			const uint16_t g = priv::transform(k16, t);
+			if (g < representative) representative = g;
+		}
+		const int c = priv::find(representative);
+		for (int t = 0; t < n_transforms; ++t) {
+			if (priv::transform(representative, t) == k16) return priv::specialise(c, t);
+		}
+		return classes[0];
+	}
+
+	namespace priv
+	{
+		/// <summary>
+		/// Class and transform of every function, c * n_transforms + t, for the function codes known at run time only
+		/// </summary>
+		[[nodiscard]] inline const std::vector<uint32_t>& mapping()
+		{
+			static const std::vector<uint32_t> result = [] {
+				std::vector<uint32_t> m(1 << 16, 0xFFFFFFFF);
+				for (int c = 0; c < static_cast<int>(std::size(classes)); ++c) {
+					for (int t = 0; t < n_transforms; ++t) {
+						uint32_t& x = m[transform(classes[c].k16, t)];
+						if (x == 0xFFFFFFFF) x = static_cast<uint32_t>((c * n_transforms) + t);
+					}
+				}
+				return m;
+			}();
+			return result;
+		}
+
+		template<uint16_t K16, typename T, size_t... I>
+		[[nodiscard]] __forceinline constexpr T run(const T a, const T b, const T c, const T d, std::index_sequence<I...>) noexcept
+		{
+			constexpr program p = decompose(K16);
+			T r[n_inputs + max_instructions] = { a, b, c, d };
+			((r[n_inputs + I] = ternarylogic::ternary<p.code[I].k>(r[p.code[I].a], r[p.code[I].b], r[p.code[I].c])), ...);
+			return r[n_inputs + p.size - 1];
+		}
+	}
+
+	/// <summary>
+	/// Program of k16 from the tables built on first use; decompose is cheaper for a single function
+	/// </summary>
+	[[nodiscard]] inline program lookup(const uint16_t k16)
+	{
+		const uint32_t x = priv::mapping()[k16];
+		return priv::specialise(static_cast<int>(x / n_transforms), static_cast<int>(x % n_transforms));
+	}
+}
+
+namespace ternarylogic
+{
+	/// <summary>
+	/// Four input Boolean Function K16 of A = 0xFF00, B = 0xF0F0, C = 0xCCCC and D = 0xAAAA, computed with at most
+	/// three ternary<K> of the backend of T; e.g. 0x6996 is a ^ b ^ c ^ d
+	/// </summary>
+	template<bf_type K16, typename T>
+	[[nodiscard]] __forceinline constexpr T ternary4(const T a, const T b, const T c, const T d) noexcept
+	{
+		static_assert(K16 < 0x10000, "Unspecified four input function");
+		constexpr four::program p = four::decompose(static_cast<uint16_t>(K16));
+		return four::priv::run<static_cast<uint16_t>(K16)>(a, b, c, d, std::make_index_sequence<p.size>());
+	}
+
+	/// <summary>
+	/// Four input Boolean Function k16 known at run time only; hoist four::lookup(k16) out of loops
+	/// </summary>
+	template<typename T>
+	[[nodiscard]] inline T ternary4(const T a, const T b, const T c, const T d, const four::program& p) noexcept
+	{
+		T r[four::n_inputs + four::max_instructions] = { a, b, c, d };
+		for (int i = 0; i < p.size; ++i) {
+			const four::instruction& ins = p.code[i];
+			r[four::n_inputs + i] = ternary(r[ins.a], r[ins.b], r[ins.c], ins.k);
+		}
+		return r[four::n_inputs + p.size - 1];
+	}
+
+	template<typename T>
+	[[nodiscard]] inline T ternary4(const T a, const T b, const T c, const T d, const bf_type k16)
+	{
+		return ternary4(a, b, c, d, four::lookup(static_cast<uint16_t>(k16)));
+	}
+}
+
+namespace ternarylogic::four::test
+{
+	/// <summary>
+	/// Run the instructions of a program on the truth tables of the inputs
+	/// </summary>
+	[[nodiscard]] constexpr uint16_t evaluate(const program& p) noexcept
+	{
+		uint16_t r[n_inputs + max_instructions] = { input_values[0], input_values[1], input_values[2], input_values[3] };
+		for (int i = 0; i < p.size; ++i) {
+			const instruction& ins = p.code[i];
+			r[n_inputs + i] = reference::vpternlog<uint16_t>(r[ins.a], r[ins.b], r[ins.c], ins.k);
+		}
+		return r[n_inputs + p.size - 1];
+	}
+
+	static_assert(evaluate(decompose(0x6996)) == 0x6996);
+	static_assert(decompose(0x6996).size == 2);
+	static_assert(ternarylogic::ternary4<0x8000>(uint64_t{ 0xFF00 }, uint64_t{ 0xF0F0 }, uint64_t{ 0xCCCC }, uint64_t{ 0xAAAA }) == 0x8000);
+	static_assert(ternarylogic::ternary4<0x1668>(uint32_t{ 0xFF00 }, uint32_t{ 0xF0F0 }, uint32_t{ 0xCCCC }, uint32_t{ 0xAAAA }) == 0x1668);
+
+	template<bf_type K16>
+	[[nodiscard]] inline bool function_equals_reference() noexcept
+	{
+		const __m128i a = _mm_set1_epi16(static_cast<short>(input_values[0]));
+		const __m128i b = _mm_set1_epi16(static_cast<short>(input_values[1]));
+		const __m128i c = _mm_set1_epi16(static_cast<short>(input_values[2]));
+		const __m128i d = _mm_set1_epi16(static_cast<short>(input_values[3]));
+		const __m128i r = ternarylogic::ternary4<K16>(a, b, c, d);
+		const __m256i r2 = ternarylogic::ternary4<K16>(_mm256_set1_epi16(static_cast<short>(input_values[0])), _mm256_set1_epi16(static_cast<short>(input_values[1])),
+			_mm256_set1_epi16(static_cast<short>(input_values[2])), _mm256_set1_epi16(static_cast<short>(input_values[3])));
+		return (static_cast<uint16_t>(_mm_extract_epi16(r, 0)) == K16)
+			&& (static_cast<uint16_t>(_mm256_extract_epi16(r2, 0)) == K16)
+			&& (ternarylogic::ternary4<K16>(uint64_t{ 0xFF00 }, uint64_t{ 0xF0F0 }, uint64_t{ 0xCCCC }, uint64_t{ 0xAAAA }) == K16)
+			&& (ternarylogic::ternary4(uint64_t{ 0xFF00 }, uint64_t{ 0xF0F0 }, uint64_t{ 0xCCCC }, uint64_t{ 0xAAAA }, K16) == K16);
+	}
+
+	inline void tests()
+	{
+		std::cout << "ternary_four::tests" << std::endl;
+
+		bool has_error = false;
+		for (const program& p : classes) {
+			if ((evaluate(p) != p.k16) || (evaluate(decompose(p.k16)) != p.k16)) {
+				std::cout << "ERROR: class 0x" << std::hex << p.k16 << std::dec << std::endl;
+				has_error = true;
+			}
+		}
+		// every function by the tables, and some by the search that ternary4<K16> runs at compile time
+		for (uint32_t k = 0; k < 0x10000; ++k) {
+			const program p = lookup(static_cast<uint16_t>(k));
+			if ((evaluate(p) != k) || (p.k16 != k) || (((k % 251) == 0) && (evaluate(decompose(static_cast<uint16_t>(k))) != k))) {
+				std::cout << "ERROR: function 0x" << std::hex << k << std::dec << std::endl;
+				has_error = true;
+			}
+		}
+
+		// parity, and of all, majority of a, b, c and the select of a two bit index
+		has_error = has_error || !function_equals_reference<0x6996>() || !function_equals_reference<0x8000>()
+			|| !function_equals_reference<0xE880>() || !function_equals_reference<0xCAF0>() || !function_equals_reference<0x0000>();
+
+		if (has_error) {
+			std::cout << "NOT EQUAL!" << std::endl;
+			static_cast<void>(getchar());
+		}
+		else {
+			std::cout << "ternary_four::tests: No errors found!" << std::endl;
+		}
+	}
+}
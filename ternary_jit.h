@@ -0,0 +1,499 @@
+#pragma once
+#include <vector>
+#include <mutex>
+#include <cstdint>
+#include <cstring>		// for memcpy
+#include <iostream>		// for cout
+#include <type_traits>
+#include <unordered_map>
+
+#if defined(__x86_64__) && !defined(_WIN32)
+#include <sys/mman.h>
+#define TERNARYLOGIC_JIT 1
+#endif
+
+#include "ternary_logic.cpp"
+#include "ternary_program.cpp"
+#include "ternary_expr.h"
+
+namespace ternarylogic::jit
+{
+	// the code the JIT emits; the programs themselves are compiled with the costs of a ternarylogic::isa
+	enum class backend { none, avx2, avx512 };
+
+	/// <summary>
+	/// Compiled program: operands points to the inputs followed by the outputs, n_bytes is the length of every buffer
+	/// </summary>
+	using function = void (*)(void* const* operands, size_t n_bytes);
+
+	namespace priv
+	{
+		constexpr int rax = 0;
+		constexpr int rsi = 6;
+		constexpr int rdi = 7;
+		constexpr int r10 = 10;
+
+		constexpr uint8_t map_0f = 1;
+		constexpr uint8_t map_0f3a = 3;
+		constexpr uint8_t pp_66 = 1;
+		constexpr uint8_t pp_f3 = 2;
+
+		/// <summary>
+		/// Minimal x86-64 encoder for the few instructions the compiled programs need
+		/// </summary>
+		class assembler
+		{
+			std::vector<uint8_t> code_;
+
+			void bytes(std::initializer_list<uint8_t> b) { code_.insert(code_.end(), b); }
+			void int32(const int32_t v)
+			{
+				for (int i = 0; i < 4; ++i) code_.push_back(static_cast<uint8_t>(v >> (8 * i)));
+			}
+			[[nodiscard]] static uint8_t inv(const int reg, const int bit) noexcept { return static_cast<uint8_t>((~reg >> bit) & 1); }
+
+		public:
+			[[nodiscard]] const std::vector<uint8_t>& code() const noexcept { return code_; }
+			[[nodiscard]] size_t position() const noexcept { return code_.size(); }
+
+			// VEX.256 reg, vvvv, r/m
+			void vex(const uint8_t map, const uint8_t pp, const uint8_t opcode, const int reg, const int vvvv, const int rm)
+			{
+				bytes({ 0xC4,
+					static_cast<uint8_t>((inv(reg, 3) << 7) | (1 << 6) | (inv(rm, 3) << 5) | map),
+					static_cast<uint8_t>(((~vvvv & 0xF) << 3) | (1 << 2) | pp),
+					opcode,
+					static_cast<uint8_t>(0xC0 | ((reg & 7) << 3) | (rm & 7)) });
+			}
+			// VEX.256 reg, [base + index]
+			void vex_mem(const uint8_t map, const uint8_t pp, const uint8_t opcode, const int reg, const int base, const int index)
+			{
+				bytes({ 0xC4,
+					static_cast<uint8_t>((inv(reg, 3) << 7) | (inv(index, 3) << 6) | (inv(base, 3) << 5) | map),
+					static_cast<uint8_t>((0xF << 3) | (1 << 2) | pp),
+					opcode,
+					static_cast<uint8_t>(0x04 | ((reg & 7) << 3)),
+					static_cast<uint8_t>(((index & 7) << 3) | (base & 7)) });
+			}
+			// EVEX.512 reg, vvvv, r/m
+			void evex(const uint8_t map, const uint8_t pp, const uint8_t w, const uint8_t opcode, const int reg, const int vvvv, const int rm)
+			{
+				bytes({ 0x62,
+					static_cast<uint8_t>((inv(reg, 3) << 7) | (inv(rm, 4) << 6) | (inv(rm, 3) << 5) | (inv(reg, 4) << 4) | map),
+					static_cast<uint8_t>((w << 7) | ((~vvvv & 0xF) << 3) | (1 << 2) | pp),
+					static_cast<uint8_t>((2 << 5) | (inv(vvvv, 4) << 3)),
+					opcode,
+					static_cast<uint8_t>(0xC0 | ((reg & 7) << 3) | (rm & 7)) });
+			}
+			// EVEX.512 reg, [base + index]
+			void evex_mem(const uint8_t map, const uint8_t pp, const uint8_t w, const uint8_t opcode, const int reg, const int base, const int index)
+			{
+				bytes({ 0x62,
+					static_cast<uint8_t>((inv(reg, 3) << 7) | (inv(index, 3) << 6) | (inv(base, 3) << 5) | (inv(reg, 4) << 4) | map),
+					static_cast<uint8_t>((w << 7) | (0xF << 3) | (1 << 2) | pp),
+					static_cast<uint8_t>((2 << 5) | (1 << 3)),
+					opcode,
+					static_cast<uint8_t>(0x04 | ((reg & 7) << 3)),
+					static_cast<uint8_t>(((index & 7) << 3) | (base & 7)) });
+			}
+
+			void vpand(const int dst, const int a, const int b) { vex(map_0f, pp_66, 0xDB, dst, a, b); }
+			void vpandn(const int dst, const int a, const int b) { vex(map_0f, pp_66, 0xDF, dst, a, b); }
+			void vpor(const int dst, const int a, const int b) { vex(map_0f, pp_66, 0xEB, dst, a, b); }
+			void vpxor(const int dst, const int a, const int b) { vex(map_0f, pp_66, 0xEF, dst, a, b); }
+			void vpcmpeqd(const int dst, const int a, const int b) { vex(map_0f, pp_66, 0x76, dst, a, b); }
+			void vmovdqa(const int dst, const int src) { vex(map_0f, pp_66, 0x6F, dst, 0, src); }
+			void vmovdqu_load(const int dst, const int base, const int index) { vex_mem(map_0f, pp_f3, 0x6F, dst, base, index); }
+			void vmovdqu_store(const int src, const int base, const int index) { vex_mem(map_0f, pp_f3, 0x7F, src, base, index); }
+
+			void vpternlogd(const int dst, const int b, const int c, const uint8_t k) { evex(map_0f3a, pp_66, 0, 0x25, dst, b, c); code_.push_back(k); }
+			void vmovdqa64(const int dst, const int src) { evex(map_0f, pp_66, 1, 0x6F, dst, 0, src); }
+			void vmovdqu64_load(const int dst, const int base, const int index) { evex_mem(map_0f, pp_f3, 1, 0x6F, dst, base, index); }
+			void vmovdqu64_store(const int src, const int base, const int index) { evex_mem(map_0f, pp_f3, 1, 0x7F, src, base, index); }
+
+			// mov r10, [rdi + 8 * slot]
+			void load_operand_pointer(const size_t slot) { bytes({ 0x4C, 0x8B, 0x97 }); int32(static_cast<int32_t>(8 * slot)); }
+			void xor_eax_eax() { bytes({ 0x31, 0xC0 }); }
+			void add_rax(const uint8_t imm) { bytes({ 0x48, 0x83, 0xC0, imm }); }
+			void cmp_rax_rsi() { bytes({ 0x48, 0x39, 0xF0 }); }
+			void test_rsi_rsi() { bytes({ 0x48, 0x85, 0xF6 }); }
+			// jz/jb rel32 to target, or a placeholder to be patched when target is not known yet
+			size_t jcc(const uint8_t cc, const size_t target = 0)
+			{
+				bytes({ 0x0F, cc });
+				int32(static_cast<int32_t>(target) - static_cast<int32_t>(code_.size() + 4));
+				return code_.size() - 4;
+			}
+			void patch(const size_t at, const size_t target)
+			{
+				const int32_t rel = static_cast<int32_t>(target) - static_cast<int32_t>(at + 4);
+				std::memcpy(&code_[at], &rel, 4);
+			}
+			void vzeroupper() { bytes({ 0xC5, 0xF8, 0x77 }); }
+			void ret() { bytes({ 0xC3 }); }
+		};
+
+		[[nodiscard]] inline bool uses(const program::kernel& kernel, const int reg) noexcept
+		{
+			for (const program::instruction& ins : kernel.code) {
+				if ((ins.a == reg) || (ins.b == reg)) return true;
+				if (ins.code == program::opcode::ret) break;
+			}
+			return false;
+		}
+
+		[[nodiscard]] inline int n_temporaries(const program::kernel& kernel) noexcept
+		{
+			int result = 0;
+			for (const program::instruction& ins : kernel.code) {
+				if (ins.code == program::opcode::ret) break;
+				result = std::max(result, ins.dst - 4);
+			}
+			return result;
+		}
+
+		struct operands
+		{
+			const expr::program& p;
+			size_t scratch_base;
+
+			[[nodiscard]] bool is_scratch(const uint32_t operand) const noexcept { return operand >= scratch_base; }
+		};
+
+		/// <summary>
+		/// Load the operands of one instruction; scratch lives in registers, inputs and outputs are loaded into load_regs
+		/// </summary>
+		template<typename LOAD>
+		void load_operands(assembler& as, const operands& ops, const expr::instruction& ins, const bool used[3], const int load_regs[3], const int scratch_reg0, int regs[3], LOAD load)
+		{
+			const uint32_t src[3] = { ins.a, ins.b, ins.c };
+			for (int i = 0; i < 3; ++i) {
+				if (ops.is_scratch(src[i])) {
+					regs[i] = scratch_reg0 + static_cast<int>(src[i] - ops.scratch_base);
+					continue;
+				}
+				regs[i] = -1;
+				for (int j = 0; j < i; ++j) {
+					if (used[j] && (src[j] == src[i]) && !ops.is_scratch(src[j])) regs[i] = regs[j];
+				}
+				if (regs[i] < 0) {
+					regs[i] = load_regs[i];
+					if (used[i]) {
+						as.load_operand_pointer(src[i]);
+						load(regs[i]);
+					}
+				}
+			}
+		}
+
+		inline bool emit_avx2(assembler& as, const expr::program& p)
+		{
+			constexpr int ones = 15;
+			constexpr int zeros = 14;
+			constexpr int load_regs[3] = { 11, 12, 13 };
+			constexpr int n_free = 11;
+
+			int n_temp = 0;
+			for (const expr::instruction& ins : p.code) {
+				n_temp = std::max(n_temp, n_temporaries(program::kernels[ins.k & 0xFF]));
+			}
+			if (static_cast<int>(p.n_scratch) + n_temp > n_free) return false;
+
+			const operands ops{ p, p.n_inputs + p.n_outputs };
+			const int temp_reg0 = static_cast<int>(p.n_scratch);
+
+			as.vpcmpeqd(ones, ones, ones);
+			as.vpxor(zeros, zeros, zeros);
+			as.xor_eax_eax();
+			as.test_rsi_rsi();
+			const size_t exit_jump = as.jcc(0x84);
+			const size_t loop = as.position();
+
+			for (const expr::instruction& ins : p.code)
+			{
+				const program::kernel& kernel = program::kernels[ins.k & 0xFF];
+				const bool used[3] = { uses(kernel, 0), uses(kernel, 1), uses(kernel, 2) };
+				int regs[3];
+				load_operands(as, ops, ins, used, load_regs, 0, regs, [&](const int reg) { as.vmovdqu_load(reg, r10, rax); });
+
+				auto map = [&](const int r) {
+					if (r < 3) return regs[r];
+					if (r == 3) return zeros;
+					if (r == 4) return ones;
+					return temp_reg0 + (r - 5);
+				};
+				int result = -1;
+				for (const program::instruction& k : kernel.code)
+				{
+					switch (k.code)
+					{
+						case program::opcode::ret: result = map(k.a); break;
+						case program::opcode::zero: break;
+						case program::opcode::ones: break;
+						case program::opcode::bit_and: as.vpand(map(k.dst), map(k.a), map(k.b)); break;
+						case program::opcode::bit_or: as.vpor(map(k.dst), map(k.a), map(k.b)); break;
+						case program::opcode::bit_xor: as.vpxor(map(k.dst), map(k.a), map(k.b)); break;
+						case program::opcode::bit_andnot: as.vpandn(map(k.dst), map(k.a), map(k.b)); break;
+					}
+					if (result >= 0) break;
+				}
+
+				if (ops.is_scratch(ins.dst)) {
+					const int dst = static_cast<int>(ins.dst - ops.scratch_base);
+					if (dst != result) as.vmovdqa(dst, result);
+				}
+				else {
+					as.load_operand_pointer(ins.dst);
+					as.vmovdqu_store(result, r10, rax);
+				}
+			}
+
+			as.add_rax(32);
+			as.cmp_rax_rsi();
+			as.jcc(0x82, loop);
+			as.patch(exit_jump, as.position());
+			as.vzeroupper();
+			as.ret();
+			return true;
+		}
+
+		inline bool emit_avx512(assembler& as, const expr::program& p)
+		{
+			constexpr int temp = 28;
+			constexpr int load_regs[3] = { 29, 30, 31 };
+
+			if (p.n_scratch > static_cast<size_t>(temp)) return false;
+
+			const operands ops{ p, p.n_inputs + p.n_outputs };
+
+			as.xor_eax_eax();
+			as.test_rsi_rsi();
+			const size_t exit_jump = as.jcc(0x84);
+			const size_t loop = as.position();
+
+			for (const expr::instruction& ins : p.code)
+			{
+				const uint8_t k = static_cast<uint8_t>(ins.k);
+				// A, B and C are used when the function differs on the two halves of the truth table split on them
+				const bool used[3] = {
+					((k >> 4) & 0x0F) != (k & 0x0F),
+					((k >> 2) & 0x33) != (k & 0x33),
+					((k >> 1) & 0x55) != (k & 0x55) };
+				int regs[3];
+				load_operands(as, ops, ins, used, load_regs, 0, regs, [&](const int reg) { as.vmovdqu64_load(reg, r10, rax); });
+
+				const int dst = ops.is_scratch(ins.dst) ? static_cast<int>(ins.dst - ops.scratch_base) : temp;
+				if (dst == regs[0]) {
+					as.vpternlogd(dst, regs[1], regs[2], k);
+				}
+				else if ((dst != regs[1]) && (dst != regs[2])) {
+					as.vmovdqa64(dst, regs[0]);
+					as.vpternlogd(dst, regs[1], regs[2], k);
+				}
+				else {
+					as.vmovdqa64(temp, regs[0]);
+					as.vpternlogd(temp, regs[1], regs[2], k);
+					as.vmovdqa64(dst, temp);
+				}
+				if (!ops.is_scratch(ins.dst)) {
+					as.load_operand_pointer(ins.dst);
+					as.vmovdqu64_store(dst, r10, rax);
+				}
+			}
+
+			as.add_rax(64);
+			as.cmp_rax_rsi();
+			as.jcc(0x82, loop);
+			as.patch(exit_jump, as.position());
+			as.vzeroupper();
+			as.ret();
+			return true;
+		}
+
+		[[nodiscard]] inline function make_executable(const std::vector<uint8_t>& code)
+		{
+#if defined(TERNARYLOGIC_JIT)
+			void* memory = mmap(nullptr, code.size(), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+			if (memory == MAP_FAILED) return nullptr;
+			std::memcpy(memory, code.data(), code.size());
+			if (mprotect(memory, code.size(), PROT_READ | PROT_EXEC) != 0) {
+				munmap(memory, code.size());
+				return nullptr;
+			}
+			return reinterpret_cast<function>(memory);
+#else
+			static_cast<void>(code);
+			return nullptr;
+#endif
+		}
+
+		[[nodiscard]] inline uint64_t hash(const expr::program& p, const backend target) noexcept
+		{
+			uint64_t h = 0xCBF29CE484222325ull;
+			auto add = [&h](const uint64_t v) {
+				for (int i = 0; i < 8; ++i) {
+					h ^= (v >> (8 * i)) & 0xFF;
+					h *= 0x100000001B3ull;
+				}
+			};
+			add(static_cast<uint64_t>(target));
+			add(p.n_inputs);
+			add(p.n_outputs);
+			add(p.n_scratch);
+			for (const expr::instruction& ins : p.code) {
+				add(ins.k);
+				add((static_cast<uint64_t>(ins.dst) << 32) | ins.a);
+				add((static_cast<uint64_t>(ins.b) << 32) | ins.c);
+			}
+			return h;
+		}
+
+		[[nodiscard]] inline bool equal(const expr::program& p1, const expr::program& p2) noexcept
+		{
+			if ((p1.n_inputs != p2.n_inputs) || (p1.n_outputs != p2.n_outputs) || (p1.n_scratch != p2.n_scratch) || (p1.code.size() != p2.code.size())) return false;
+			for (size_t i = 0; i < p1.code.size(); ++i) {
+				const expr::instruction& a = p1.code[i];
+				const expr::instruction& b = p2.code[i];
+				if ((a.k != b.k) || (a.dst != b.dst) || (a.a != b.a) || (a.b != b.b) || (a.c != b.c)) return false;
+			}
+			return true;
+		}
+
+		struct cache_entry
+		{
+			backend target;
+			expr::program p;
+			function f;
+		};
+
+		template<typename T>
+		[[nodiscard]] constexpr backend backend_of() noexcept
+		{
+			if constexpr (std::is_same_v<T, __m256i>) return backend::avx2;
+			else if constexpr (std::is_same_v<T, __m512i>) return backend::avx512;
+			else return backend::none;
+		}
+	}
+
+	/// <summary>
+	/// Whether the JIT can run code for the provided instruction set on this platform and cpu
+	/// </summary>
+	[[nodiscard]] inline bool supported(const backend target) noexcept
+	{
+#if defined(TERNARYLOGIC_JIT)
+		switch (target)
+		{
+			case backend::avx2: return __builtin_cpu_supports("avx2");
+			case backend::avx512: return __builtin_cpu_supports("avx512f");
+			default: return false;
+		}
+#else
+		static_cast<void>(target);
+		return false;
+#endif
+	}
+
+	/// <summary>
+	/// Compile the program to a straight-line loop for the provided instruction set. Compiled code is cached by
+	/// program hash and kept for the lifetime of the process.
+	/// </summary>
+	/// <returns>The compiled function, or nullptr when the backend is not supported or the program needs too many registers</returns>
+	[[nodiscard]] inline function compile(const expr::program& p, const backend target)
+	{
+		if (!supported(target)) return nullptr;
+
+		static std::mutex mutex;
+		static std::unordered_map<uint64_t, std::vector<priv::cache_entry>> cache;
+
+		const uint64_t h = priv::hash(p, target);
+		const std::lock_guard<std::mutex> lock(mutex);
+
+		std::vector<priv::cache_entry>& bucket = cache[h];
+		for (const priv::cache_entry& e : bucket) {
+			if ((e.target == target) && priv::equal(e.p, p)) return e.f;
+		}
+
+		priv::assembler as;
+		const bool ok = (target == backend::avx512) ? priv::emit_avx512(as, p) : priv::emit_avx2(as, p);
+		const function f = (ok) ? priv::make_executable(as.code()) : nullptr;
+		bucket.push_back(priv::cache_entry{ target, p, f });
+		return f;
+	}
+
+	/// <summary>
+	/// Execute the program with compiled code when possible, and with expr::execute otherwise
+	/// </summary>
+	template<typename T>
+	void execute(const expr::program& p, const T* const* inputs, T* const* outputs, const size_t n)
+	{
+		const function f = compile(p, priv::backend_of<T>());
+		if (f == nullptr) {
+			expr::execute<T>(p, inputs, outputs, n);
+			return;
+		}
+		for (const expr::instruction& ins : p.code) {
+			profile::count<T>(ins.k, n);
+		}
+		std::vector<void*> operands(p.n_inputs + p.n_outputs);
+		for (size_t i = 0; i < p.n_inputs; ++i) operands[i] = const_cast<T*>(inputs[i]);
+		for (size_t o = 0; o < p.n_outputs; ++o) operands[p.n_inputs + o] = outputs[o];
+		f(operands.data(), n * sizeof(T));
+	}
+
+	namespace test
+	{
+		template<typename T>
+		void test_jit_equals_interpreter(const backend target, const char* name)
+		{
+			std::cout << "ternarylogic::jit::test_jit_equals_interpreter<" << name << ">" << std::endl;
+			if (!supported(target)) {
+				std::cout << "test_jit_equals_interpreter: " << name << " not supported, skipped" << std::endl;
+				return;
+			}
+			constexpr size_t n = 100;
+			constexpr size_t words = n * sizeof(T) / sizeof(uint64_t);
+			bool has_error = false;
+
+			for (int experiment = 0; experiment < 100; ++experiment)
+			{
+				const expr::graph g = expr::test::random_graph(10, 40, 3);
+				const expr::program p = expr::compile<T>(g);
+
+				std::vector<std::vector<T>> inputs(g.n_inputs(), std::vector<T>(n));
+				for (auto& in : inputs) {
+					uint64_t* w = reinterpret_cast<uint64_t*>(in.data());
+					for (size_t i = 0; i < words; ++i) w[i] = expr::test::random_word();
+				}
+				std::vector<std::vector<T>> expected(g.n_outputs(), std::vector<T>(n));
+				std::vector<std::vector<T>> outputs(g.n_outputs(), std::vector<T>(n));
+				std::vector<const T*> in_ptr;
+				std::vector<T*> expected_ptr;
+				std::vector<T*> out_ptr;
+				for (auto& in : inputs) in_ptr.push_back(in.data());
+				for (auto& e : expected) expected_ptr.push_back(e.data());
+				for (auto& out : outputs) out_ptr.push_back(out.data());
+
+				expr::execute<T>(p, in_ptr.data(), expected_ptr.data(), n);
+				const bool compiled = (compile(p, target) != nullptr);
+				jit::execute<T>(p, in_ptr.data(), out_ptr.data(), n);
+
+				for (size_t o = 0; o < g.n_outputs(); ++o) {
+					if (std::memcmp(expected[o].data(), outputs[o].data(), n * sizeof(T)) != 0) {
+						std::cout << "ERROR: test_jit_equals_interpreter: experiment " << experiment << (compiled ? " (compiled)" : " (interpreted)") << " differs" << std::endl;
+						has_error = true;
+						break;
+					}
+				}
+			}
+			if (!has_error) {
+				std::cout << "test_jit_equals_interpreter: No errors found!" << std::endl;
+			}
+		}
+
+		inline void tests()
+		{
+			test_jit_equals_interpreter<__m256i>(backend::avx2, "avx2");
+			test_jit_equals_interpreter<__m512i>(backend::avx512, "avx512");
+		}
+	}
+}
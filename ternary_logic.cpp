@@ -6,17 +6,39 @@
 #include <bitset>
 #include <algorithm>	// for min
 #include <iomanip>      // std::setprecision
+#include <mutex>
+#include <atomic>
+#include <vector>
+#include <cstdint>
+#include <memory>
+#include <utility>		// for index_sequence
+#include <type_traits>
 
-#include <intrin.h>
+#include "ternary_compat.h"
 
 #define rdtsc __rdtsc
 
+// BMI1 andn: GCC and Clang define __BMI__ (-mbmi, -march). MSVC has no such macro but every AVX2 core has BMI1; GCC and
+// Clang do not emit andn for -mavx2 alone, where the BMI kernels are longer than the plain ones
+#if defined(__BMI__) || (defined(_MSC_VER) && defined(__AVX2__))
+#define TERNARYLOGIC_BMI
+#endif
+
 #include "ternary_x86_32.cpp"
 #include "ternary_x86_64.cpp"
+#include "ternary_x86_32_bmi.cpp"
+#include "ternary_x86_64_bmi.cpp"
 #include "ternary_sse.cpp"
 #include "ternary_avx2.cpp"
 #include "ternary_avx512.cpp"
+#include "ternary_avx512mask.cpp"
+#include "ternary_sse_ps.cpp"
+#include "ternary_sse_pd.cpp"
+#include "ternary_avx_ps.cpp"
+#include "ternary_avx_pd.cpp"
 #include "ternary_bitset.cpp"
+#include "ternary_bitvector.h"
+#include "ternary_cost.cpp"
 
 
 /*
@@ -58,46 +80,371 @@ namespace ternarylogic
 {
 	using bf_type = unsigned long long;
 
+	/// <summary>
+	/// The backends; the generated kernels of each are in ternary_<name>.cpp
+	/// </summary>
+	enum class isa : uint8_t { x86_32, x86_64, x86_32_bmi, x86_64_bmi, sse, avx2, avx512, avx512raw, avx512mask, xop, bitset, sse_ps, sse_pd, avx_ps, avx_pd };
+	constexpr size_t n_isa = 15;
+
+	[[nodiscard]] constexpr const char* isa_name(const isa i) noexcept
+	{
+		switch (i)
+		{
+			case isa::x86_32: return "x86_32";
+			case isa::x86_64: return "x86_64";
+			case isa::x86_32_bmi: return "x86_32_bmi";
+			case isa::x86_64_bmi: return "x86_64_bmi";
+			case isa::sse: return "sse";
+			case isa::avx2: return "avx2";
+			case isa::avx512: return "avx512";
+			case isa::avx512raw: return "avx512raw";
+			case isa::avx512mask: return "avx512mask";
+			case isa::xop: return "xop";
+			case isa::bitset: return "bitset";
+			case isa::sse_ps: return "sse_ps";
+			case isa::sse_pd: return "sse_pd";
+			case isa::avx_ps: return "avx_ps";
+			case isa::avx_pd: return "avx_pd";
+			default: return "unknown";
+		}
+	}
+
+	/// <summary>
+	/// The backend that ternary evaluates values of type T with
+	/// </summary>
+	template<typename T> struct isa_of;
+#ifdef TERNARYLOGIC_BMI
+	template<> struct isa_of<uint32_t> { static constexpr isa value = isa::x86_32_bmi; };
+	template<> struct isa_of<uint64_t> { static constexpr isa value = isa::x86_64_bmi; };
+#else
+	template<> struct isa_of<uint32_t> { static constexpr isa value = isa::x86_32; };
+	template<> struct isa_of<uint64_t> { static constexpr isa value = isa::x86_64; };
+#endif
+	template<> struct isa_of<__m128i> { static constexpr isa value = isa::sse; };
+	template<> struct isa_of<__m256i> { static constexpr isa value = isa::avx2; };
+	template<> struct isa_of<__m512i> { static constexpr isa value = isa::avx512raw; };
+	template<size_t S> struct isa_of<std::bitset<S>> { static constexpr isa value = isa::bitset; };
+	// the widest vector kernels of the target, see priv::ternary_words
+#if defined(__AVX512F__)
+	template<size_t S> struct isa_of<bitvector<S>> { static constexpr isa value = isa::avx512raw; };
+#elif defined(__AVX2__)
+	template<size_t S> struct isa_of<bitvector<S>> { static constexpr isa value = isa::avx2; };
+#else
+	template<size_t S> struct isa_of<bitvector<S>> { static constexpr isa value = isa::sse; };
+#endif
+	template<> struct isa_of<__m128> { static constexpr isa value = isa::sse_ps; };
+	template<> struct isa_of<__m128d> { static constexpr isa value = isa::sse_pd; };
+	template<> struct isa_of<__m256> { static constexpr isa value = isa::avx_ps; };
+	template<> struct isa_of<__m256d> { static constexpr isa value = isa::avx_pd; };
+	template<> struct isa_of<__m512> { static constexpr isa value = isa::avx512raw; };
+	template<> struct isa_of<__m512d> { static constexpr isa value = isa::avx512raw; };
+
+	/// <summary>
+	/// Cost of the kernel of Boolean Function k on the provided backend, as counted by the generator
+	/// </summary>
+	[[nodiscard]] constexpr kernel_cost cost(const bf_type k, const isa i) noexcept
+	{
+		switch (i)
+		{
+			case isa::x86_32: return costs::x86_32[k & 0xFF];
+			case isa::x86_64: return costs::x86_64[k & 0xFF];
+			case isa::x86_32_bmi: return costs::x86_32_bmi[k & 0xFF];
+			case isa::x86_64_bmi: return costs::x86_64_bmi[k & 0xFF];
+			case isa::sse: return costs::sse[k & 0xFF];
+			case isa::avx2: return costs::avx2[k & 0xFF];
+			case isa::avx512: return costs::avx512[k & 0xFF];
+			case isa::avx512raw: return costs::avx512raw[k & 0xFF];
+			case isa::avx512mask: return costs::avx512mask[k & 0xFF];
+			case isa::xop: return costs::xop[k & 0xFF];
+			case isa::bitset: return costs::x86_64[k & 0xFF]; // same kernels, per 64-bit word
+			case isa::sse_ps: return costs::sse_ps[k & 0xFF];
+			case isa::sse_pd: return costs::sse_pd[k & 0xFF];
+			case isa::avx_ps: return costs::avx_ps[k & 0xFF];
+			case isa::avx_pd: return costs::avx_pd[k & 0xFF];
+			default: return costs::x86_64[k & 0xFF];
+		}
+	}
+
+	template<bf_type K, isa I>
+	[[nodiscard]] constexpr kernel_cost cost() noexcept
+	{
+		static_assert(K < 256, "Unspecified ternary function");
+		return cost(K, I);
+	}
+
+	/// <summary>
+	/// Boolean Function k with input i (0 = a, 1 = b, 2 = c) complemented, e.g. f(~a, b, c) for i = 0
+	/// </summary>
+	[[nodiscard]] constexpr bf_type complement_input(const bf_type k, const int i) noexcept
+	{
+		switch (i)
+		{
+			case 0: return ((k >> 4) & 0x0F) | ((k << 4) & 0xF0);
+			case 1: return ((k >> 2) & 0x33) | ((k << 2) & 0xCC);
+			default: return ((k >> 1) & 0x55) | ((k << 1) & 0xAA);
+		}
+	}
+
+	/// <summary>
+	/// True if the kernel of ~k is cheaper than the one of k on the provided backend; the kernel of k then ends with a not,
+	/// which SSE and AVX compute as xor with a materialised all ones constant
+	/// </summary>
+	[[nodiscard]] constexpr bool complement_is_cheaper(const bf_type k, const isa i) noexcept
+	{
+		const kernel_cost direct = cost(k, i);
+		const kernel_cost complement = cost(~k & 0xFF, i);
+		return (complement.instructions + complement.constants) < (direct.instructions + direct.constants);
+	}
+
+	/// <summary>
+	/// Microarchitectures with kernels of their own, in the order of py/lib/uarch.py; generic counts instructions.
+	/// The generated kernels of uarch u are ternarylogic::<isa>::kernels<u>
+	/// </summary>
+	enum class uarch : uint8_t { generic, skylake, icelake, zen2, zen3, zen4, piledriver };
+	constexpr size_t n_uarch = 7;
+
+	[[nodiscard]] constexpr const char* uarch_name(const uarch u) noexcept
+	{
+		switch (u)
+		{
+			case uarch::generic: return "generic";
+			case uarch::skylake: return "skylake";
+			case uarch::icelake: return "icelake";
+			case uarch::zen2: return "zen2";
+			case uarch::zen3: return "zen3";
+			case uarch::zen4: return "zen4";
+			case uarch::piledriver: return "piledriver";
+			default: return "unknown";
+		}
+	}
+
+	/// <summary>
+	/// The kernels of ternary<K>; build with TERNARYLOGIC_UARCH=zen3 (or skylake, icelake, ...) to get those of one core
+	/// </summary>
+#ifdef TERNARYLOGIC_UARCH
+	constexpr uarch default_uarch = uarch::TERNARYLOGIC_UARCH;
+#else
+	constexpr uarch default_uarch = uarch::generic;
+#endif
+
+	/// <summary>
+	/// The microarchitecture of the executing core, from cpuid; the nearest one with kernels of its own, or generic
+	/// </summary>
+	[[nodiscard]] inline uarch detect_uarch() noexcept
+	{
+		int info[4];
+		compat::cpuid(info, 0);
+		const bool intel = (info[1] == 0x756e6547); // "Genu"ineIntel
+		const bool amd = (info[1] == 0x68747541);   // "Auth"enticAMD
+
+		compat::cpuid(info, 1);
+		const unsigned base = (info[0] >> 8) & 0xF;
+		const unsigned family = (base == 0xF) ? base + ((info[0] >> 20) & 0xFF) : base;
+		const unsigned model = ((info[0] >> 4) & 0xF) | ((base == 0x6 || base == 0xF) ? ((info[0] >> 12) & 0xF0) : 0);
+
+		if (intel && (family == 0x6))
+		{
+			switch (model)
+			{
+				case 0x4E: case 0x5E: case 0x8E: case 0x9E: case 0xA5: case 0xA6: case 0x55: return uarch::skylake;
+				case 0x6A: case 0x6C: case 0x7D: case 0x7E: case 0x8C: case 0x8D: return uarch::icelake;
+				default: return uarch::generic;
+			}
+		}
+		if (amd)
+		{
+			switch (family)
+			{
+				case 0x15: return uarch::piledriver;
+				case 0x17: return uarch::zen2; // and Zen, Zen+
+				case 0x19: return ((model >= 0x10 && model < 0x20) || (model >= 0x60 && model < 0x80) || (model >= 0xA0 && model < 0xB0)) ? uarch::zen4 : uarch::zen3;
+				case 0x1A: return uarch::zen4; // Zen 5
+				default: return uarch::generic;
+			}
+		}
+		return uarch::generic;
+	}
+
 	namespace priv
 	{
 		#pragma region Ternary Intern
 
 
-		template<bf_type K, size_t S>
+		template<bf_type K, uarch U = default_uarch, size_t S>
 		[[nodiscard]] __forceinline constexpr std::bitset<S> ternary_intern(const std::bitset<S>& a, const std::bitset<S>& b, const std::bitset<S>& c)
 		{
 			return ternarylogic::bitset::ternary<K, S>(a, b, c);
 		}
 
-		template<bf_type K>
+		template<bf_type K, uarch U = default_uarch, size_t S>
+		[[nodiscard]] __forceinline bitvector<S> ternary_intern(const bitvector<S>& a, const bitvector<S>& b, const bitvector<S>& c) noexcept
+		{
+			return ternary_bitvector<static_cast<unsigned>(K), static_cast<unsigned>(U)>(a, b, c);
+		}
+
+		template<bf_type K, uarch U = default_uarch>
 		[[nodiscard]] __forceinline constexpr uint32_t ternary_intern(const uint32_t a, const uint32_t b, const uint32_t c) noexcept
 		{
-			return ternarylogic::x86_32::ternary<K>(a, b, c);
+#ifdef TERNARYLOGIC_BMI
+			return ternarylogic::x86_32_bmi::kernels<static_cast<unsigned>(U)>::template ternary<K>(a, b, c);
+#else
+			return ternarylogic::x86_32::kernels<static_cast<unsigned>(U)>::template ternary<K>(a, b, c);
+#endif
 		}
 
-		template<bf_type K>
+		template<bf_type K, uarch U = default_uarch>
 		[[nodiscard]] __forceinline constexpr uint64_t ternary_intern(const uint64_t a, const uint64_t b, const uint64_t c) noexcept
 		{
-			return ternarylogic::x86_64::ternary<K>(a, b, c);
+#ifdef TERNARYLOGIC_BMI
+			return ternarylogic::x86_64_bmi::kernels<static_cast<unsigned>(U)>::template ternary<K>(a, b, c);
+#else
+			return ternarylogic::x86_64::kernels<static_cast<unsigned>(U)>::template ternary<K>(a, b, c);
+#endif
 		}
 
-		template<bf_type K>
+		template<bf_type K, uarch U = default_uarch>
 		[[nodiscard]] __forceinline constexpr __m128i ternary_intern(const __m128i a, const __m128i b, const __m128i c) noexcept
 		{
-			return ternarylogic::sse::ternary<K>(a, b, c);
+			return ternarylogic::sse::kernels<static_cast<unsigned>(U)>::template ternary<K>(a, b, c);
 		}
 
-		template<bf_type K>
+		template<bf_type K, uarch U = default_uarch>
 		[[nodiscard]] __forceinline constexpr __m256i ternary_intern(const __m256i a, const __m256i b, const __m256i c) noexcept
 		{
-			return ternarylogic::avx2::ternary<K>(a, b, c);
+			return ternarylogic::avx2::kernels<static_cast<unsigned>(U)>::template ternary<K>(a, b, c);
 		}
 
-		template<bf_type K>
+		template<bf_type K, uarch U = default_uarch>
 		[[nodiscard]] __forceinline constexpr __m512i ternary_intern(const __m512i a, const __m512i b, const __m512i c) noexcept
 		{
 			return ternarylogic::avx512raw::ternary<K>(a, b, c); 
 		}
+
+		template<bf_type K, uarch U = default_uarch>
+		[[nodiscard]] __forceinline constexpr __m128 ternary_intern(const __m128 a, const __m128 b, const __m128 c) noexcept
+		{
+			return ternarylogic::sse_ps::kernels<static_cast<unsigned>(U)>::template ternary<K>(a, b, c);
+		}
+
+		template<bf_type K, uarch U = default_uarch>
+		[[nodiscard]] __forceinline constexpr __m128d ternary_intern(const __m128d a, const __m128d b, const __m128d c) noexcept
+		{
+			return ternarylogic::sse_pd::kernels<static_cast<unsigned>(U)>::template ternary<K>(a, b, c);
+		}
+
+		template<bf_type K, uarch U = default_uarch>
+		[[nodiscard]] __forceinline constexpr __m256 ternary_intern(const __m256 a, const __m256 b, const __m256 c) noexcept
+		{
+			return ternarylogic::avx_ps::kernels<static_cast<unsigned>(U)>::template ternary<K>(a, b, c);
+		}
+
+		template<bf_type K, uarch U = default_uarch>
+		[[nodiscard]] __forceinline constexpr __m256d ternary_intern(const __m256d a, const __m256d b, const __m256d c) noexcept
+		{
+			return ternarylogic::avx_pd::kernels<static_cast<unsigned>(U)>::template ternary<K>(a, b, c);
+		}
+
+		template<bf_type K, uarch U = default_uarch>
+		[[nodiscard]] __forceinline constexpr __m512 ternary_intern(const __m512 a, const __m512 b, const __m512 c) noexcept
+		{
+			// vandps and friends need AVX512DQ and take two operands; the casts are free and vpternlogd takes one instruction
+			return _mm512_castsi512_ps(ternarylogic::avx512raw::ternary<K>(_mm512_castps_si512(a), _mm512_castps_si512(b), _mm512_castps_si512(c)));
+		}
+
+		template<bf_type K, uarch U = default_uarch>
+		[[nodiscard]] __forceinline constexpr __m512d ternary_intern(const __m512d a, const __m512d b, const __m512d c) noexcept
+		{
+			return _mm512_castsi512_pd(ternarylogic::avx512raw::ternary<K>(_mm512_castpd_si512(a), _mm512_castpd_si512(b), _mm512_castpd_si512(c)));
+		}
+		#pragma endregion
+
+		#pragma region Ternary Intern Latency
+		template<bf_type K, uarch U = default_uarch, size_t S>
+		[[nodiscard]] __forceinline constexpr std::bitset<S> ternary_lat_intern(const std::bitset<S>& a, const std::bitset<S>& b, const std::bitset<S>& c)
+		{
+			return ternarylogic::bitset::ternary<K, S>(a, b, c);
+		}
+
+		// the vectors of a bitvector are independent evaluations, bound by throughput
+		template<bf_type K, uarch U = default_uarch, size_t S>
+		[[nodiscard]] __forceinline bitvector<S> ternary_lat_intern(const bitvector<S>& a, const bitvector<S>& b, const bitvector<S>& c) noexcept
+		{
+			return ternary_bitvector<static_cast<unsigned>(K), static_cast<unsigned>(U)>(a, b, c);
+		}
+
+		template<bf_type K, uarch U = default_uarch>
+		[[nodiscard]] __forceinline constexpr uint32_t ternary_lat_intern(const uint32_t a, const uint32_t b, const uint32_t c) noexcept
+		{
+#ifdef TERNARYLOGIC_BMI
+			return ternarylogic::x86_32_bmi::kernels<static_cast<unsigned>(U)>::template ternary_lat<K>(a, b, c);
+#else
+			return ternarylogic::x86_32::kernels<static_cast<unsigned>(U)>::template ternary_lat<K>(a, b, c);
+#endif
+		}
+
+		template<bf_type K, uarch U = default_uarch>
+		[[nodiscard]] __forceinline constexpr uint64_t ternary_lat_intern(const uint64_t a, const uint64_t b, const uint64_t c) noexcept
+		{
+#ifdef TERNARYLOGIC_BMI
+			return ternarylogic::x86_64_bmi::kernels<static_cast<unsigned>(U)>::template ternary_lat<K>(a, b, c);
+#else
+			return ternarylogic::x86_64::kernels<static_cast<unsigned>(U)>::template ternary_lat<K>(a, b, c);
+#endif
+		}
+
+		template<bf_type K, uarch U = default_uarch>
+		[[nodiscard]] __forceinline constexpr __m128i ternary_lat_intern(const __m128i a, const __m128i b, const __m128i c) noexcept
+		{
+			return ternarylogic::sse::kernels<static_cast<unsigned>(U)>::template ternary_lat<K>(a, b, c);
+		}
+
+		template<bf_type K, uarch U = default_uarch>
+		[[nodiscard]] __forceinline constexpr __m256i ternary_lat_intern(const __m256i a, const __m256i b, const __m256i c) noexcept
+		{
+			return ternarylogic::avx2::kernels<static_cast<unsigned>(U)>::template ternary_lat<K>(a, b, c);
+		}
+
+		template<bf_type K, uarch U = default_uarch>
+		[[nodiscard]] __forceinline constexpr __m512i ternary_lat_intern(const __m512i a, const __m512i b, const __m512i c) noexcept
+		{
+			return ternarylogic::avx512raw::ternary<K>(a, b, c); // one instruction, nothing to shorten
+		}
+
+		template<bf_type K, uarch U = default_uarch>
+		[[nodiscard]] __forceinline constexpr __m128 ternary_lat_intern(const __m128 a, const __m128 b, const __m128 c) noexcept
+		{
+			return ternarylogic::sse_ps::kernels<static_cast<unsigned>(U)>::template ternary_lat<K>(a, b, c);
+		}
+
+		template<bf_type K, uarch U = default_uarch>
+		[[nodiscard]] __forceinline constexpr __m128d ternary_lat_intern(const __m128d a, const __m128d b, const __m128d c) noexcept
+		{
+			return ternarylogic::sse_pd::kernels<static_cast<unsigned>(U)>::template ternary_lat<K>(a, b, c);
+		}
+
+		template<bf_type K, uarch U = default_uarch>
+		[[nodiscard]] __forceinline constexpr __m256 ternary_lat_intern(const __m256 a, const __m256 b, const __m256 c) noexcept
+		{
+			return ternarylogic::avx_ps::kernels<static_cast<unsigned>(U)>::template ternary_lat<K>(a, b, c);
+		}
+
+		template<bf_type K, uarch U = default_uarch>
+		[[nodiscard]] __forceinline constexpr __m256d ternary_lat_intern(const __m256d a, const __m256d b, const __m256d c) noexcept
+		{
+			return ternarylogic::avx_pd::kernels<static_cast<unsigned>(U)>::template ternary_lat<K>(a, b, c);
+		}
+
+		template<bf_type K, uarch U = default_uarch>
+		[[nodiscard]] __forceinline constexpr __m512 ternary_lat_intern(const __m512 a, const __m512 b, const __m512 c) noexcept
+		{
+			return _mm512_castsi512_ps(ternarylogic::avx512raw::ternary<K>(_mm512_castps_si512(a), _mm512_castps_si512(b), _mm512_castps_si512(c)));
+		}
+
+		template<bf_type K, uarch U = default_uarch>
+		[[nodiscard]] __forceinline constexpr __m512d ternary_lat_intern(const __m512d a, const __m512d b, const __m512d c) noexcept
+		{
+			return _mm512_castsi512_pd(ternarylogic::avx512raw::ternary<K>(_mm512_castpd_si512(a), _mm512_castpd_si512(b), _mm512_castpd_si512(c)));
+		}
 		#pragma endregion
 
 		#pragma region Ternary Intern No Vpternlog
@@ -423,272 +770,6 @@ namespace ternarylogic
 			}
 		}
  	
-		template<typename T>
-		[[nodiscard]] constexpr T ternary_reduced(const T& a, const T& b, const T& c, const bf_type k) noexcept
-		{
-			// method is generated with test::create_method_reduced_ternary()
-			switch (k)
-			{
-				case 0: return priv::ternary_intern<0>(a, b, c);
-				case 1: return priv::ternary_intern<1>(a, b, c);
-				case 2: return priv::ternary_intern<2>(a, b, c);
-				case 3: return priv::ternary_intern<3>(a, b, c);
-				case 4: return priv::ternary_intern<2>(a, c, b);
-				case 5: return priv::ternary_intern<3>(a, c, b);
-				case 6: return priv::ternary_intern<6>(a, b, c);
-				case 7: return priv::ternary_intern<7>(a, b, c);
-				case 8: return priv::ternary_intern<8>(a, b, c);
-				case 9: return priv::ternary_intern<9>(a, b, c);
-				case 10: return priv::ternary_intern<10>(a, b, c);
-				case 11: return priv::ternary_intern<11>(a, b, c);
-				case 12: return priv::ternary_intern<10>(a, c, b);
-				case 13: return priv::ternary_intern<11>(a, c, b);
-				case 14: return priv::ternary_intern<14>(a, b, c);
-				case 15: return priv::ternary_intern<15>(a, b, c);
-				case 16: return priv::ternary_intern<2>(c, b, a);
- 				case 17: return priv::ternary_intern<3>(c, b, a);
-				case 18: return priv::ternary_intern<6>(b, a, c);
-				case 19: return priv::ternary_intern<7>(b, a, c);
-				case 20: return priv::ternary_intern<6>(c, b, a);
-				case 21: return priv::ternary_intern<7>(c, b, a);
-				case 22: return priv::ternary_intern<22>(a, b, c);
-				case 23: return priv::ternary_intern<23>(a, b, c);
-				case 24: return priv::ternary_intern<24>(a, b, c);
-				case 25: return priv::ternary_intern<25>(a, b, c);
-				case 26: return priv::ternary_intern<26>(a, b, c);
-				case 27: return priv::ternary_intern<27>(a, b, c);
-				case 28: return priv::ternary_intern<26>(a, c, b);
-				case 29: return priv::ternary_intern<27>(a, c, b);
-				case 30: return priv::ternary_intern<30>(a, b, c);
-				case 31: return priv::ternary_intern<31>(a, b, c);
-				case 32: return priv::ternary_intern<8>(b, a, c);
-				case 33: return priv::ternary_intern<9>(b, a, c);
-				case 34: return priv::ternary_intern<10>(b, a, c);
-				case 35: return priv::ternary_intern<11>(b, a, c);
-				case 36: return priv::ternary_intern<24>(b, a, c);
-				case 37: return priv::ternary_intern<25>(b, a, c);
-				case 38: return priv::ternary_intern<26>(b, a, c);
-				case 39: return priv::ternary_intern<27>(b, a, c);
-				case 40: return priv::ternary_intern<40>(a, b, c);
-				case 41: return priv::ternary_intern<41>(a, b, c);
-				case 42: return priv::ternary_intern<42>(a, b, c);
-				case 43: return priv::ternary_intern<43>(a, b, c);
-				case 44: return priv::ternary_intern<44>(a, b, c);
-				case 45: return priv::ternary_intern<45>(a, b, c);
-				case 46: return priv::ternary_intern<46>(a, b, c);
-				case 47: return priv::ternary_intern<47>(a, b, c);
-				case 48: return priv::ternary_intern<10>(b, c, a);
-				case 49: return priv::ternary_intern<11>(b, c, a);
-				case 50: return priv::ternary_intern<14>(b, a, c);
-				case 51: return priv::ternary_intern<15>(b, a, c);
-				case 52: return priv::ternary_intern<26>(b, c, a);
-				case 53: return priv::ternary_intern<27>(b, c, a);
-				case 54: return priv::ternary_intern<30>(b, a, c);
-				case 55: return priv::ternary_intern<31>(b, a, c);
-				case 56: return priv::ternary_intern<44>(b, a, c);
-				case 57: return priv::ternary_intern<45>(b, a, c);
-				case 58: return priv::ternary_intern<46>(b, a, c);
-				case 59: return priv::ternary_intern<47>(b, a, c);
-				case 60: return priv::ternary_intern<60>(a, b, c);
-				case 61: return priv::ternary_intern<61>(a, b, c);
-				case 62: return priv::ternary_intern<62>(a, b, c);
-				case 63: return priv::ternary_intern<63>(a, b, c);
-				case 64: return priv::ternary_intern<8>(c, b, a);
-				case 65: return priv::ternary_intern<9>(c, b, a);
-				case 66: return priv::ternary_intern<24>(c, b, a);
-				case 67: return priv::ternary_intern<25>(c, b, a);
-				case 68: return priv::ternary_intern<10>(c, a, b);
-				case 69: return priv::ternary_intern<11>(c, a, b);
-				case 70: return priv::ternary_intern<26>(c, a, b);
-				case 71: return priv::ternary_intern<27>(c, a, b);
-				case 72: return priv::ternary_intern<40>(a, c, b);
-				case 73: return priv::ternary_intern<41>(a, c, b);
-				case 74: return priv::ternary_intern<44>(a, c, b);
-				case 75: return priv::ternary_intern<45>(a, c, b);
-				case 76: return priv::ternary_intern<42>(a, c, b);
-				case 77: return priv::ternary_intern<43>(a, c, b);
-				case 78: return priv::ternary_intern<46>(a, c, b);
-				case 79: return priv::ternary_intern<47>(a, c, b);
-				case 80: return priv::ternary_intern<10>(c, b, a);
-				case 81: return priv::ternary_intern<11>(c, b, a);
-				case 82: return priv::ternary_intern<26>(c, b, a);
-				case 83: return priv::ternary_intern<27>(c, b, a);
-				case 84: return priv::ternary_intern<14>(c, b, a);
-				case 85: return priv::ternary_intern<15>(c, b, a);
-				case 86: return priv::ternary_intern<30>(c, b, a);
-				case 87: return priv::ternary_intern<31>(c, b, a);
-				case 88: return priv::ternary_intern<44>(c, a, b);
-				case 89: return priv::ternary_intern<45>(c, a, b);
-				case 90: return priv::ternary_intern<60>(a, c, b);
-				case 91: return priv::ternary_intern<61>(a, c, b);
-				case 92: return priv::ternary_intern<46>(c, a, b);
-				case 93: return priv::ternary_intern<47>(c, a, b);
-				case 94: return priv::ternary_intern<62>(a, c, b);
-				case 95: return priv::ternary_intern<63>(a, c, b);
-				case 96: return priv::ternary_intern<40>(c, b, a);
-				case 97: return priv::ternary_intern<41>(c, b, a);
-				case 98: return priv::ternary_intern<44>(b, c, a);
-				case 99: return priv::ternary_intern<45>(b, c, a);
-				case 100: return priv::ternary_intern<44>(c, b, a);
-				case 101: return priv::ternary_intern<45>(c, b, a);
-				case 102: return priv::ternary_intern<60>(c, b, a);
-				case 103: return priv::ternary_intern<61>(c, b, a);
-				case 104: return priv::ternary_intern<104>(a, b, c);
-				case 105: return priv::ternary_intern<105>(a, b, c);
-				case 106: return priv::ternary_intern<106>(a, b, c);
-				case 107: return priv::ternary_intern<107>(a, b, c);
-				case 108: return priv::ternary_intern<106>(a, c, b);
-				case 109: return priv::ternary_intern<107>(a, c, b);
-				case 110: return priv::ternary_intern<110>(a, b, c);
-				case 111: return priv::ternary_intern<111>(a, b, c);
-				case 112: return priv::ternary_intern<42>(c, b, a);
-				case 113: return priv::ternary_intern<43>(c, b, a);
-				case 114: return priv::ternary_intern<46>(b, c, a);
-				case 115: return priv::ternary_intern<47>(b, c, a);
-				case 116: return priv::ternary_intern<46>(c, b, a);
-				case 117: return priv::ternary_intern<47>(c, b, a);
-				case 118: return priv::ternary_intern<62>(c, b, a);
-				case 119: return priv::ternary_intern<63>(c, b, a);
-				case 120: return priv::ternary_intern<106>(c, b, a);
-				case 121: return priv::ternary_intern<107>(c, b, a);
-				case 122: return priv::ternary_intern<110>(b, a, c);
-				case 123: return priv::ternary_intern<111>(b, a, c);
-				case 124: return priv::ternary_intern<110>(c, b, a);
-				case 125: return priv::ternary_intern<111>(c, b, a);
-				case 126: return priv::ternary_intern<126>(a, b, c);
-				case 127: return priv::ternary_intern<127>(a, b, c);
-				case 128: return priv::ternary_intern<128>(a, b, c);
-				case 129: return priv::ternary_intern<129>(a, b, c);
-				case 130: return priv::ternary_intern<130>(a, b, c);
-				case 131: return priv::ternary_intern<131>(a, b, c);
-				case 132: return priv::ternary_intern<130>(a, c, b);
-				case 133: return priv::ternary_intern<131>(a, c, b);
-				case 134: return priv::ternary_intern<134>(a, b, c);
-				case 135: return priv::ternary_intern<135>(a, b, c);
-				case 136: return priv::ternary_intern<136>(a, b, c);
-				case 137: return priv::ternary_intern<137>(a, b, c);
-				case 138: return priv::ternary_intern<138>(a, b, c);
-				case 139: return priv::ternary_intern<139>(a, b, c);
-				case 140: return priv::ternary_intern<138>(a, c, b);
-				case 141: return priv::ternary_intern<139>(a, c, b);
-				case 142: return priv::ternary_intern<142>(a, b, c);
-				case 143: return priv::ternary_intern<143>(a, b, c);
-				case 144: return priv::ternary_intern<130>(c, b, a);
-				case 145: return priv::ternary_intern<131>(c, b, a);
-				case 146: return priv::ternary_intern<134>(b, a, c);
-				case 147: return priv::ternary_intern<135>(b, a, c);
-				case 148: return priv::ternary_intern<134>(c, b, a);
-				case 149: return priv::ternary_intern<135>(c, b, a);
-				case 150: return priv::ternary_intern<150>(a, b, c);
-				case 151: return priv::ternary_intern<151>(a, b, c);
-				case 152: return priv::ternary_intern<152>(a, b, c);
-				case 153: return priv::ternary_intern<153>(a, b, c);
-				case 154: return priv::ternary_intern<154>(a, b, c);
-				case 155: return priv::ternary_intern<155>(a, b, c);
-				case 156: return priv::ternary_intern<154>(a, c, b);
-				case 157: return priv::ternary_intern<155>(a, c, b);
-				case 158: return priv::ternary_intern<158>(a, b, c);
-				case 159: return priv::ternary_intern<159>(a, b, c);
-				case 160: return priv::ternary_intern<136>(b, a, c);
-				case 161: return priv::ternary_intern<137>(b, a, c);
-				case 162: return priv::ternary_intern<138>(b, a, c);
-				case 163: return priv::ternary_intern<139>(b, a, c);
-				case 164: return priv::ternary_intern<152>(b, a, c);
-				case 165: return priv::ternary_intern<153>(b, a, c);
-				case 166: return priv::ternary_intern<154>(b, a, c);
-				case 167: return priv::ternary_intern<155>(b, a, c);
-				case 168: return priv::ternary_intern<168>(a, b, c);
-				case 169: return priv::ternary_intern<169>(a, b, c);
-				case 170: return priv::ternary_intern<170>(a, b, c);
-				case 171: return priv::ternary_intern<171>(a, b, c);
-				case 172: return priv::ternary_intern<172>(a, b, c);
-				case 173: return priv::ternary_intern<173>(a, b, c);
-				case 174: return priv::ternary_intern<174>(a, b, c);
-				case 175: return priv::ternary_intern<175>(a, b, c);
-				case 176: return priv::ternary_intern<138>(b, c, a);
-				case 177: return priv::ternary_intern<139>(b, c, a);
-				case 178: return priv::ternary_intern<142>(b, a, c);
-				case 179: return priv::ternary_intern<143>(b, a, c);
-				case 180: return priv::ternary_intern<154>(b, c, a);
-				case 181: return priv::ternary_intern<155>(b, c, a);
-				case 182: return priv::ternary_intern<158>(b, a, c);
-				case 183: return priv::ternary_intern<159>(b, a, c);
-				case 184: return priv::ternary_intern<172>(b, a, c);
-				case 185: return priv::ternary_intern<173>(b, a, c);
-				case 186: return priv::ternary_intern<174>(b, a, c);
-				case 187: return priv::ternary_intern<175>(b, a, c);
-				case 188: return priv::ternary_intern<188>(a, b, c);
-				case 189: return priv::ternary_intern<189>(a, b, c);
-				case 190: return priv::ternary_intern<190>(a, b, c);
-				case 191: return priv::ternary_intern<191>(a, b, c);
-				case 192: return priv::ternary_intern<136>(c, b, a);
-				case 193: return priv::ternary_intern<137>(c, b, a);
-				case 194: return priv::ternary_intern<152>(c, b, a);
-				case 195: return priv::ternary_intern<153>(c, b, a);
-				case 196: return priv::ternary_intern<138>(c, a, b);
-				case 197: return priv::ternary_intern<139>(c, a, b);
-				case 198: return priv::ternary_intern<154>(c, a, b);
-				case 199: return priv::ternary_intern<155>(c, a, b);
-				case 200: return priv::ternary_intern<168>(a, c, b);
-				case 201: return priv::ternary_intern<169>(a, c, b);
-				case 202: return priv::ternary_intern<172>(a, c, b);
-				case 203: return priv::ternary_intern<173>(a, c, b);
-				case 204: return priv::ternary_intern<170>(a, c, b);
-				case 205: return priv::ternary_intern<171>(a, c, b);
-				case 206: return priv::ternary_intern<174>(a, c, b);
-				case 207: return priv::ternary_intern<175>(a, c, b);
-				case 208: return priv::ternary_intern<138>(c, b, a);
-				case 209: return priv::ternary_intern<139>(c, b, a);
-				case 210: return priv::ternary_intern<154>(c, b, a);
-				case 211: return priv::ternary_intern<155>(c, b, a);
-				case 212: return priv::ternary_intern<142>(c, b, a);
-				case 213: return priv::ternary_intern<143>(c, b, a);
-				case 214: return priv::ternary_intern<158>(c, b, a);
-				case 215: return priv::ternary_intern<159>(c, b, a);
-				case 216: return priv::ternary_intern<172>(c, a, b);
-				case 217: return priv::ternary_intern<173>(c, a, b);
-				case 218: return priv::ternary_intern<188>(a, c, b);
-				case 219: return priv::ternary_intern<189>(a, c, b);
-				case 220: return priv::ternary_intern<174>(c, a, b);
-				case 221: return priv::ternary_intern<175>(c, a, b);
-				case 222: return priv::ternary_intern<190>(a, c, b);
-				case 223: return priv::ternary_intern<191>(a, c, b);
-				case 224: return priv::ternary_intern<168>(c, b, a);
-				case 225: return priv::ternary_intern<169>(c, b, a);
-				case 226: return priv::ternary_intern<172>(b, c, a);
-				case 227: return priv::ternary_intern<173>(b, c, a);
-				case 228: return priv::ternary_intern<172>(c, b, a);
-				case 229: return priv::ternary_intern<173>(c, b, a);
-				case 230: return priv::ternary_intern<188>(c, b, a);
-				case 231: return priv::ternary_intern<189>(c, b, a);
-				case 232: return priv::ternary_intern<232>(a, b, c);
-				case 233: return priv::ternary_intern<233>(a, b, c);
-				case 234: return priv::ternary_intern<234>(a, b, c);
-				case 235: return priv::ternary_intern<235>(a, b, c);
-				case 236: return priv::ternary_intern<234>(a, c, b);
-				case 237: return priv::ternary_intern<235>(a, c, b);
-				case 238: return priv::ternary_intern<238>(a, b, c);
-				case 239: return priv::ternary_intern<239>(a, b, c);
-				case 240: return priv::ternary_intern<170>(c, b, a);
-				case 241: return priv::ternary_intern<171>(c, b, a);
-				case 242: return priv::ternary_intern<174>(b, c, a);
-				case 243: return priv::ternary_intern<175>(b, c, a);
-				case 244: return priv::ternary_intern<174>(c, b, a);
-				case 245: return priv::ternary_intern<175>(c, b, a);
-				case 246: return priv::ternary_intern<190>(c, b, a);
-				case 247: return priv::ternary_intern<191>(c, b, a);
-				case 248: return priv::ternary_intern<234>(c, b, a);
-				case 249: return priv::ternary_intern<235>(c, b, a);
-				case 250: return priv::ternary_intern<238>(b, a, c);
-				case 251: return priv::ternary_intern<239>(b, a, c);
-				case 252: return priv::ternary_intern<238>(c, b, a);
-				case 253: return priv::ternary_intern<239>(c, b, a);
-				case 254: return priv::ternary_intern<254>(a, b, c);
-				case 255: return priv::ternary_intern<255>(a, b, c);
-				default: return priv::ternary_intern<0>(a, b, c);
-			}
-		}
-
 		template<typename T>
 		[[nodiscard]] constexpr T ternary_no_vpternlog(const T& a, const T& b, const T& c, const bf_type k) noexcept
 		{
@@ -980,23 +1061,177 @@ namespace ternarylogic
 			}
 		}
 	}
-	
+
 	namespace reference
 	{
 		template<typename T>
 		[[nodiscard]] constexpr inline T vpternlog(const T& a, const T& b, const T& c, const bf_type k) noexcept 
 		{
-			constexpr int n_bits = sizeof(T) * 8;
+			// or of the minterms of k, a word at a time: eight steps instead of one per bit, which matters for the
+			// compile-time checks of all kernels
 			T result = 0;
-			for (int i = 0; i < n_bits; ++i) {
-				const T index_a = ((a >> i) & 1) << 2;
-				const T index_b = ((b >> i) & 1) << 1;
-				const T index_c = ((c >> i) & 1) << 0;
-				const T index = index_a | index_b | index_c;
-				result |= ((k >> index) & 0x1) << i;
+			for (int i = 0; i < 8; ++i) {
+				if (((k >> i) & 1) == 0) continue;
+				const T x = (i & 4) ? a : static_cast<T>(~a);
+				const T y = (i & 2) ? b : static_cast<T>(~b);
+				const T z = (i & 1) ? c : static_cast<T>(~c);
+				result |= x & y & z;
+			}
+			return result;
+		}
+	}
+}
+
+// the runtime switches over all functions: py/main.py --target=reduced
+#include "ternary_reduced.cpp"
+// fast paths for the hottest function codes, generated from a profile dump: py/main.py --target=dispatcher
+#include "ternary_dispatch.cpp"
+
+namespace ternarylogic
+{
+	namespace profile
+	{
+		/// <summary>
+		/// Number of calls and bytes processed per backend and per function code, on the runtime-k paths
+		/// </summary>
+		struct counters
+		{
+			uint64_t calls[n_isa][256];
+			uint64_t bytes[n_isa][256];
+		};
+
+		namespace priv
+		{
+			struct thread_counters;
+
+			struct registry
+			{
+				std::mutex mutex;
+				std::vector<const thread_counters*> threads;
+				counters retired{};		// counts of threads that have finished
+				counters baseline{};	// counts at the last reset
+			};
+
+			[[nodiscard]] inline registry& get_registry()
+			{
+				static registry r;
+				return r;
+			}
+
+			// counters of one thread: only the owning thread writes them, snapshot reads them relaxed
+			struct thread_counters
+			{
+				std::atomic<uint64_t> calls[n_isa][256];
+				std::atomic<uint64_t> bytes[n_isa][256];
+
+				thread_counters()
+				{
+					for (size_t i = 0; i < n_isa; ++i) {
+						for (size_t k = 0; k < 256; ++k) {
+							calls[i][k].store(0, std::memory_order_relaxed);
+							bytes[i][k].store(0, std::memory_order_relaxed);
+						}
+					}
+					registry& r = get_registry();
+					const std::lock_guard<std::mutex> lock(r.mutex);
+					r.threads.push_back(this);
+				}
+				~thread_counters()
+				{
+					registry& r = get_registry();
+					const std::lock_guard<std::mutex> lock(r.mutex);
+					for (size_t i = 0; i < n_isa; ++i) {
+						for (size_t k = 0; k < 256; ++k) {
+							r.retired.calls[i][k] += calls[i][k].load(std::memory_order_relaxed);
+							r.retired.bytes[i][k] += bytes[i][k].load(std::memory_order_relaxed);
+						}
+					}
+					r.threads.erase(std::find(r.threads.begin(), r.threads.end(), this));
+				}
+			};
+
+			[[nodiscard]] inline thread_counters& local()
+			{
+				thread_local thread_counters t;
+				return t;
+			}
+
+			inline void add(std::atomic<uint64_t>& counter, const uint64_t value) noexcept
+			{
+				counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+			}
+		}
+
+		/// <summary>
+		/// Count one runtime-k evaluation of n elements of type T; compiles to nothing unless TERNARYLOGIC_PROFILE is defined
+		/// </summary>
+		template<typename T>
+		constexpr void count(const bf_type k, const size_t n) noexcept
+		{
+#ifdef TERNARYLOGIC_PROFILE
+			priv::thread_counters& t = priv::local();
+			const size_t i = static_cast<size_t>(isa_of<T>::value);
+			priv::add(t.calls[i][k & 0xFF], 1);
+			priv::add(t.bytes[i][k & 0xFF], n * sizeof(T));
+#else
+			static_cast<void>(k);
+			static_cast<void>(n);
+#endif
+		}
+
+		/// <summary>
+		/// Counts of all threads since the last reset
+		/// </summary>
+		[[nodiscard]] inline counters snapshot()
+		{
+			priv::registry& r = priv::get_registry();
+			const std::lock_guard<std::mutex> lock(r.mutex);
+			counters result = r.retired;
+			for (const priv::thread_counters* t : r.threads) {
+				for (size_t i = 0; i < n_isa; ++i) {
+					for (size_t k = 0; k < 256; ++k) {
+						result.calls[i][k] += t->calls[i][k].load(std::memory_order_relaxed);
+						result.bytes[i][k] += t->bytes[i][k].load(std::memory_order_relaxed);
+					}
+				}
+			}
+			for (size_t i = 0; i < n_isa; ++i) {
+				for (size_t k = 0; k < 256; ++k) {
+					result.calls[i][k] -= r.baseline.calls[i][k];
+					result.bytes[i][k] -= r.baseline.bytes[i][k];
+				}
 			}
 			return result;
 		}
+
+		inline void reset()
+		{
+			const counters current = snapshot();
+			priv::registry& r = priv::get_registry();
+			const std::lock_guard<std::mutex> lock(r.mutex);
+			for (size_t i = 0; i < n_isa; ++i) {
+				for (size_t k = 0; k < 256; ++k) {
+					r.baseline.calls[i][k] += current.calls[i][k];
+					r.baseline.bytes[i][k] += current.bytes[i][k];
+				}
+			}
+		}
+
+		/// <summary>
+		/// Write the non-zero counters as csv (isa,k,calls,bytes); py/main.py --target=dispatcher --profile reads this format
+		/// </summary>
+		inline void dump(std::ostream& os)
+		{
+			const std::unique_ptr<counters> c = std::make_unique<counters>(snapshot());
+			os << "isa,k,calls,bytes" << std::endl;
+			for (size_t i = 0; i < n_isa; ++i) {
+				for (size_t k = 0; k < 256; ++k) {
+					if (c->calls[i][k] == 0) continue;
+					os << isa_name(static_cast<isa>(i)) << ",0x" << std::hex << std::setw(2) << std::setfill('0') << k << std::dec << std::setfill(' ')
+						<< "," << c->calls[i][k] << "," << c->bytes[i][k] << std::endl;
+				}
+			}
+		}
 	}
 
 	template<bf_type K, typename T>
@@ -1006,12 +1241,318 @@ namespace ternarylogic
 		//return priv::ternary_intern_no_vpternlog<K>(a, b, c);
 	}
 
+	/// <summary>
+	/// Boolean Function K over bit-vectors, taken by reference: the kernel runs over the storage of the inputs
+	/// </summary>
+	template<bf_type K, size_t S>
+	[[nodiscard]] inline bitvector<S> ternary(const bitvector<S>& a, const bitvector<S>& b, const bitvector<S>& c) noexcept
+	{
+		return priv::ternary_intern<K>(a, b, c);
+	}
+
+	/// <summary>
+	/// Boolean Function K with the shortest dependency chain; ternary<K> has the fewest instructions instead
+	/// </summary>
+	template<bf_type K, typename T>
+	[[nodiscard]] constexpr T ternary_lat(const T a, const T b, const T c) noexcept
+	{
+		return priv::ternary_lat_intern<K>(a, b, c);
+	}
+
+	/// <summary>
+	/// What to optimise a kernel for: independent evaluations overlap and are bound by throughput,
+	/// a chain of dependent evaluations is bound by latency
+	/// </summary>
+	enum class goal : uint8_t { throughput, latency };
+
+	/// <summary>
+	/// Boolean Function K with the kernel for goal G on microarchitecture U
+	/// </summary>
+	template<bf_type K, goal G, uarch U = default_uarch, typename T>
+	[[nodiscard]] constexpr T ternary(const T a, const T b, const T c) noexcept
+	{
+		if constexpr (G == goal::latency) {
+			return priv::ternary_lat_intern<K, U>(a, b, c);
+		}
+		else {
+			return priv::ternary_intern<K, U>(a, b, c);
+		}
+	}
+
+	/// <summary>
+	/// Boolean Function K over predicates in AVX-512 mask registers; __mmask64 is an integer type, hence the name of its own
+	/// </summary>
+	template<bf_type K>
+	[[nodiscard]] inline __mmask64 ternary_kmask(const __mmask64 a, const __mmask64 b, const __mmask64 c) noexcept
+	{
+		return avx512mask::kernels<static_cast<unsigned>(default_uarch)>::template ternary<K>(a, b, c);
+	}
+
+	namespace priv
+	{
+		/// <summary>
+		/// Mask k with a bit per lane of L as a vector mask of T, with all ones in the lanes of the set bits; a vector mask
+		/// of T is returned as is
+		/// </summary>
+		template<typename L, typename T, typename M>
+		[[nodiscard]] inline T expand_mask(const M k) noexcept
+		{
+			// the lanes of 64 bits compare both halves with the same bit
+			constexpr bool q = std::is_same_v<L, uint64_t>;
+			if constexpr (std::is_same_v<M, T>) {
+				return k;
+			}
+			else if constexpr (std::is_same_v<T, __m256i>) {
+				const __m256i bits = q ? _mm256_setr_epi32(1, 1, 2, 2, 4, 4, 8, 8) : _mm256_setr_epi32(1, 2, 4, 8, 16, 32, 64, 128);
+				return _mm256_cmpeq_epi32(_mm256_and_si256(_mm256_set1_epi32(static_cast<int>(k)), bits), bits);
+			}
+			else if constexpr (std::is_same_v<T, __m128i>) {
+				const __m128i bits = q ? _mm_setr_epi32(1, 1, 2, 2) : _mm_setr_epi32(1, 2, 4, 8);
+				return _mm_cmpeq_epi32(_mm_and_si128(_mm_set1_epi32(static_cast<int>(k)), bits), bits);
+			}
+			else {
+				static_assert(sizeof(T) == 0, "A mask of bits needs AVX512F for __m512i");
+				return T{};
+			}
+		}
+
+		/// <summary>
+		/// m ? f : src per bit, one instruction where the target has a variable blend
+		/// </summary>
+		template<typename T>
+		[[nodiscard]] inline T blend(const T src, const T f, const T m) noexcept
+		{
+#ifdef __AVX2__
+			if constexpr (std::is_same_v<T, __m256i>) return _mm256_blendv_epi8(src, f, m);
+			else
+#endif
+#if defined(__SSE4_1__) || defined(__AVX__)
+			if constexpr (std::is_same_v<T, __m128i>) return _mm_blendv_epi8(src, f, m);
+			else
+#endif
+			return ternary_intern<0xCA>(m, f, src);
+		}
+	}
+
+	/// <summary>
+	/// Boolean Function K in the lanes of L (uint32_t or uint64_t) that k selects, and src in the other lanes; k has a bit
+	/// per lane, or is a vector mask of T. With AVX512F, and AVX512VL for __m128i and __m256i, the mask is a mask register
+	/// and the merge a masked move of the vpternlog. Otherwise the kernel of K and a blend
+	/// </summary>
+	template<bf_type K, typename L = uint32_t, typename T, typename M>
+	[[nodiscard]] inline T ternary_mask(const T src, const M k, const T a, const T b, const T c) noexcept
+	{
+		static_assert(std::is_same_v<L, uint32_t> || std::is_same_v<L, uint64_t>, "Lanes of 32 or 64 bits");
+		constexpr int imm = static_cast<int>(K & 0xFF);
+		constexpr bool q = std::is_same_v<L, uint64_t>;
+#ifdef __AVX512F__
+		if constexpr (std::is_same_v<T, __m512i> && std::is_integral_v<M>) {
+			if constexpr (q) return _mm512_mask_mov_epi64(src, static_cast<__mmask8>(k), _mm512_ternarylogic_epi64(a, b, c, imm));
+			else return _mm512_mask_mov_epi32(src, static_cast<__mmask16>(k), _mm512_ternarylogic_epi32(a, b, c, imm));
+		}
+		else
+#endif
+#ifdef __AVX512VL__
+		if constexpr (std::is_same_v<T, __m256i> && std::is_integral_v<M>) {
+			if constexpr (q) return _mm256_mask_mov_epi64(src, static_cast<__mmask8>(k), _mm256_ternarylogic_epi64(a, b, c, imm));
+			else return _mm256_mask_mov_epi32(src, static_cast<__mmask8>(k), _mm256_ternarylogic_epi32(a, b, c, imm));
+		}
+		else if constexpr (std::is_same_v<T, __m128i> && std::is_integral_v<M>) {
+			if constexpr (q) return _mm_mask_mov_epi64(src, static_cast<__mmask8>(k), _mm_ternarylogic_epi64(a, b, c, imm));
+			else return _mm_mask_mov_epi32(src, static_cast<__mmask8>(k), _mm_ternarylogic_epi32(a, b, c, imm));
+		}
+		else
+#endif
+		{
+			static_cast<void>(imm);
+			static_cast<void>(q);
+			return priv::blend(src, priv::ternary_intern<K>(a, b, c), priv::expand_mask<L, T>(k));
+		}
+	}
+
+	/// <summary>
+	/// Boolean Function K in the lanes of L that k selects, and a in the other lanes; see ternary_mask. With AVX-512 one
+	/// merge-masked vpternlog, which keeps a in its destination
+	/// </summary>
+	template<bf_type K, typename L = uint32_t, typename T, typename M>
+	[[nodiscard]] inline T ternary_mask(const M k, const T a, const T b, const T c) noexcept
+	{
+		static_assert(std::is_same_v<L, uint32_t> || std::is_same_v<L, uint64_t>, "Lanes of 32 or 64 bits");
+		constexpr int imm = static_cast<int>(K & 0xFF);
+		constexpr bool q = std::is_same_v<L, uint64_t>;
+#ifdef __AVX512F__
+		if constexpr (std::is_same_v<T, __m512i> && std::is_integral_v<M>) {
+			if constexpr (q) return _mm512_mask_ternarylogic_epi64(a, static_cast<__mmask8>(k), b, c, imm);
+			else return _mm512_mask_ternarylogic_epi32(a, static_cast<__mmask16>(k), b, c, imm);
+		}
+		else
+#endif
+#ifdef __AVX512VL__
+		if constexpr (std::is_same_v<T, __m256i> && std::is_integral_v<M>) {
+			if constexpr (q) return _mm256_mask_ternarylogic_epi64(a, static_cast<__mmask8>(k), b, c, imm);
+			else return _mm256_mask_ternarylogic_epi32(a, static_cast<__mmask8>(k), b, c, imm);
+		}
+		else if constexpr (std::is_same_v<T, __m128i> && std::is_integral_v<M>) {
+			if constexpr (q) return _mm_mask_ternarylogic_epi64(a, static_cast<__mmask8>(k), b, c, imm);
+			else return _mm_mask_ternarylogic_epi32(a, static_cast<__mmask8>(k), b, c, imm);
+		}
+		else
+#endif
+		{
+			static_cast<void>(imm);
+			static_cast<void>(q);
+			return ternary_mask<K, L>(a, k, a, b, c);
+		}
+	}
+
+	/// <summary>
+	/// Boolean Function K in the lanes of L that k selects, and zero in the other lanes; see ternary_mask. With AVX-512
+	/// one zero-masked vpternlog, otherwise the kernel of K and an and
+	/// </summary>
+	template<bf_type K, typename L = uint32_t, typename T, typename M>
+	[[nodiscard]] inline T ternary_maskz(const M k, const T a, const T b, const T c) noexcept
+	{
+		static_assert(std::is_same_v<L, uint32_t> || std::is_same_v<L, uint64_t>, "Lanes of 32 or 64 bits");
+		constexpr int imm = static_cast<int>(K & 0xFF);
+		constexpr bool q = std::is_same_v<L, uint64_t>;
+#ifdef __AVX512F__
+		if constexpr (std::is_same_v<T, __m512i> && std::is_integral_v<M>) {
+			if constexpr (q) return _mm512_maskz_ternarylogic_epi64(static_cast<__mmask8>(k), a, b, c, imm);
+			else return _mm512_maskz_ternarylogic_epi32(static_cast<__mmask16>(k), a, b, c, imm);
+		}
+		else
+#endif
+#ifdef __AVX512VL__
+		if constexpr (std::is_same_v<T, __m256i> && std::is_integral_v<M>) {
+			if constexpr (q) return _mm256_maskz_ternarylogic_epi64(static_cast<__mmask8>(k), a, b, c, imm);
+			else return _mm256_maskz_ternarylogic_epi32(static_cast<__mmask8>(k), a, b, c, imm);
+		}
+		else if constexpr (std::is_same_v<T, __m128i> && std::is_integral_v<M>) {
+			if constexpr (q) return _mm_maskz_ternarylogic_epi64(static_cast<__mmask8>(k), a, b, c, imm);
+			else return _mm_maskz_ternarylogic_epi32(static_cast<__mmask8>(k), a, b, c, imm);
+		}
+		else
+#endif
+		{
+			static_cast<void>(imm);
+			static_cast<void>(q);
+			const T f = priv::ternary_intern<K>(a, b, c);
+			return priv::ternary_intern<0xC0>(priv::expand_mask<L, T>(k), f, f);
+		}
+	}
+
+	/// <summary>
+	/// Holds the complement of the value it stands for; ternary_tagged returns it where the kernel of ~K is cheaper
+	/// than the one of K, and absorbs it into its function when it is an input
+	/// </summary>
+	template<typename T>
+	struct complemented
+	{
+		T value;
+	};
+
+	namespace priv
+	{
+		template<typename T> struct untag { using type = T; static constexpr bool complemented = false; };
+		template<typename T> struct untag<ternarylogic::complemented<T>> { using type = T; static constexpr bool complemented = true; };
+
+		template<typename T>
+		[[nodiscard]] constexpr typename untag<T>::type raw(const T x) noexcept
+		{
+			if constexpr (untag<T>::complemented) return x.value;
+			else return x;
+		}
+	}
+
+	/// <summary>
+	/// Boolean Function K of values of T or complemented<T>: the complemented inputs are absorbed into K, and the result
+	/// is complemented<T> when that drops the final not of the kernel, e.g. in a chain of ternary_tagged calls
+	/// </summary>
+	template<bf_type K, typename A, typename B, typename C>
+	[[nodiscard]] constexpr auto ternary_tagged(const A a, const B b, const C c) noexcept
+	{
+		using T = typename priv::untag<A>::type;
+		static_assert(std::is_same_v<T, typename priv::untag<B>::type> && std::is_same_v<T, typename priv::untag<C>::type>, "Inputs of different types");
+
+		constexpr bf_type ka = priv::untag<A>::complemented ? complement_input(K, 0) : K;
+		constexpr bf_type kb = priv::untag<B>::complemented ? complement_input(ka, 1) : ka;
+		constexpr bf_type k = priv::untag<C>::complemented ? complement_input(kb, 2) : kb;
+		if constexpr (complement_is_cheaper(k, isa_of<T>::value)) {
+			return complemented<T>{ ternary<k ^ 0xFF>(priv::raw(a), priv::raw(b), priv::raw(c)) };
+		}
+		else {
+			return ternary<k>(priv::raw(a), priv::raw(b), priv::raw(c));
+		}
+	}
+
+	/// <summary>
+	/// The value that x stands for; only a complemented value costs a not
+	/// </summary>
+	template<typename T>
+	[[nodiscard]] constexpr T untagged(const T x) noexcept
+	{
+		return x;
+	}
+
+	template<typename T>
+	[[nodiscard]] constexpr T untagged(const complemented<T> x) noexcept
+	{
+		return ternary<0x0F>(x.value, x.value, x.value);
+	}
+
+	namespace priv
+	{
+		/// <summary>
+		/// The runtime-k switch of T, out of line: with TERNARYLOGIC_EXTERN_RUNTIME defined a translation unit calls the
+		/// instances of ternary_runtime.cpp instead of compiling the kernels of every function code again
+		/// </summary>
+		template<typename T>
+		[[nodiscard]] T ternary_runtime(const T& a, const T& b, const T& c, const bf_type k) noexcept
+		{
+			return ternary_hot(a, b, c, k);
+		}
+
+#ifdef TERNARYLOGIC_EXTERN_RUNTIME
+		extern template uint32_t ternary_runtime(const uint32_t&, const uint32_t&, const uint32_t&, bf_type) noexcept;
+		extern template uint64_t ternary_runtime(const uint64_t&, const uint64_t&, const uint64_t&, bf_type) noexcept;
+		extern template __m128i ternary_runtime(const __m128i&, const __m128i&, const __m128i&, bf_type) noexcept;
+#ifdef __AVX2__
+		extern template __m256i ternary_runtime(const __m256i&, const __m256i&, const __m256i&, bf_type) noexcept;
+#endif
+#ifdef __AVX512F__
+		extern template __m512i ternary_runtime(const __m512i&, const __m512i&, const __m512i&, bf_type) noexcept;
+#endif
+#endif
+	}
+
+	/// <summary>
+	/// Boolean Function k, known at run time only; not a constant expression with TERNARYLOGIC_EXTERN_RUNTIME
+	/// </summary>
 	template<typename T>
 	[[nodiscard]] constexpr T ternary(const T a, const T b, const T c, const bf_type k) noexcept
 	{
-		return priv::ternary_reduced(a, b, c, k);
+		profile::count<T>(k, 1);
+#ifdef TERNARYLOGIC_EXTERN_RUNTIME
+		return priv::ternary_runtime(a, b, c, k);
+#else
+		return priv::ternary_hot(a, b, c, k);
+#endif
 	}
 
+	/// <summary>
+	/// Boolean Function k over bit-vectors: the kernel is looked up once, not once per vector of the storage
+	/// </summary>
+	template<size_t S>
+	[[nodiscard]] inline bitvector<S> ternary(const bitvector<S>& a, const bitvector<S>& b, const bitvector<S>& c, const bf_type k) noexcept
+	{
+		profile::count<bitvector<S>>(k, 1);
+		return priv::ternary_bitvector<static_cast<unsigned>(default_uarch)>(a, b, c, k);
+	}
+
+	// the tests and their exhaustive compile-time checks of the kernels are compiled where TERNARYLOGIC_TESTS is
+	// defined (main.cpp), not in every translation unit that includes this file
+#ifdef TERNARYLOGIC_TESTS
+
 	namespace test
 	{
 		void inline test_equal_referene_implentation()
@@ -1090,12 +1631,12 @@ namespace ternarylogic
 				const auto r1 = priv::ternary_not_reduced(a1, b1, c1, i);
 				const auto r2 = priv::ternary_not_reduced(a2, b2, c2, i);
 
-				if (r1.m128i_u8[0] != r2.m512i_u8[0])
+				if (compat::lane_u8(r1, 0) != compat::lane_u8(r2, 0))
 				{
 					std::cout << "NOT EQUAL!" << std::endl;
 					std::cout << "i = " << i << std::endl;
-					std::cout << "sse:    " << std::bitset<8>(r1.m128i_u8[0]).to_string() << std::endl;
-					std::cout << "avx512: " << std::bitset<8>(r2.m512i_u8[0]).to_string() << std::endl;
+					std::cout << "sse:    " << std::bitset<8>(compat::lane_u8(r1, 0)).to_string() << std::endl;
+					std::cout << "avx512: " << std::bitset<8>(compat::lane_u8(r2, 0)).to_string() << std::endl;
 					static_cast<void>(getchar());
 				}
 			}
@@ -1117,12 +1658,12 @@ namespace ternarylogic
 				const auto r1 = priv::ternary_not_reduced(a1, b1, c1, i);
 				const auto r2 = priv::ternary_not_reduced(a2, b2, c2, i);
 
-				if (r1.m128i_u8[0] != r2.m256i_u8[0])
+				if (compat::lane_u8(r1, 0) != compat::lane_u8(r2, 0))
 				{
 					std::cout << "NOT EQUAL!" << std::endl;
 					std::cout << "i = " << i << std::endl;
-					std::cout << "sse:    " << std::bitset<8>(r1.m128i_u8[0]).to_string() << std::endl;
-					std::cout << "avx512: " << std::bitset<8>(r2.m256i_u8[0]).to_string() << std::endl;
+					std::cout << "sse:    " << std::bitset<8>(compat::lane_u8(r1, 0)).to_string() << std::endl;
+					std::cout << "avx512: " << std::bitset<8>(compat::lane_u8(r2, 0)).to_string() << std::endl;
 					static_cast<void>(getchar());
 				}
 			}
@@ -1140,16 +1681,151 @@ namespace ternarylogic
 				const auto r1 = priv::ternary_not_reduced(a, b, c, i);
 				const auto r2 = ternary(a, b, c, i);
 
-				if (r1.m128i_u8[0] != r2.m128i_u8[0])
+				if (compat::lane_u8(r1, 0) != compat::lane_u8(r2, 0))
+				{
+					std::cout << "NOT EQUAL!" << std::endl;
+					std::cout << "i = " << i << std::endl;
+					std::cout << "not reduced: " << std::bitset<8>(compat::lane_u8(r1, 0)).to_string() << std::endl;
+					std::cout << "reduced:     " << std::bitset<8>(compat::lane_u8(r2, 0)).to_string() << std::endl;
+					static_cast<void>(getchar());
+				}
+			}
+		}
+		template<typename T>
+		[[nodiscard]] constexpr bool reduced_equals_reference() noexcept
+		{
+			constexpr T a = static_cast<T>(0xF0F0F0F0F0F0F0F0ull);
+			constexpr T b = static_cast<T>(0xCCCCCCCCCCCCCCCCull);
+			constexpr T c = static_cast<T>(0xAAAAAAAAAAAAAAAAull);
+			for (bf_type k = 0; k <= 0xFF; ++k) {
+				if (priv::ternary_reduced(a, b, c, k) != reference::vpternlog(a, b, c, k)) return false;
+			}
+			return true;
+		}
+		void inline test_equal_reduced_equals_reference()
+		{
+			std::cout << "ternary_logic::test_equal_reduced_equals_reference" << std::endl;
+
+			static_assert(reduced_equals_reference<uint32_t>());
+			static_assert(reduced_equals_reference<uint64_t>());
+
+			const auto a = _mm256_set1_epi8((unsigned char)0b11110000);
+			const auto b = _mm256_set1_epi8((unsigned char)0b11001100);
+			const auto c = _mm256_set1_epi8((unsigned char)0b10101010);
+
+			for (auto i = 0; i <= 0xFF; ++i)
+			{
+				const auto r = priv::ternary_reduced(a, b, c, i);
+				if (compat::lane_u8(r, 0) != i)
 				{
 					std::cout << "NOT EQUAL!" << std::endl;
 					std::cout << "i = " << i << std::endl;
-					std::cout << "not reduced: " << std::bitset<8>(r1.m128i_u8[0]).to_string() << std::endl;
-					std::cout << "reduced:     " << std::bitset<8>(r2.m128i_u8[0]).to_string() << std::endl;
+					std::cout << "reduced: " << std::bitset<8>(compat::lane_u8(r, 0)).to_string() << std::endl;
 					static_cast<void>(getchar());
 				}
 			}
 		}
+		template<size_t... K>
+		[[nodiscard]] constexpr bool latency_equals_reference(std::index_sequence<K...>) noexcept
+		{
+			constexpr uint64_t a = 0xF0F0F0F0F0F0F0F0ull;
+			constexpr uint64_t b = 0xCCCCCCCCCCCCCCCCull;
+			constexpr uint64_t c = 0xAAAAAAAAAAAAAAAAull;
+			return ((ternary_lat<K>(a, b, c) == reference::vpternlog(a, b, c, K)) && ...)
+				&& ((ternary_lat<K>(static_cast<uint32_t>(a), static_cast<uint32_t>(b), static_cast<uint32_t>(c)) == static_cast<uint32_t>(reference::vpternlog(a, b, c, K))) && ...);
+		}
+		template<size_t... K>
+		[[nodiscard]] inline bool latency_equals_size(std::index_sequence<K...>) noexcept
+		{
+			const auto a = _mm256_set1_epi8((unsigned char)0b11110000);
+			const auto b = _mm256_set1_epi8((unsigned char)0b11001100);
+			const auto c = _mm256_set1_epi8((unsigned char)0b10101010);
+			return ((_mm256_movemask_epi8(_mm256_cmpeq_epi8(ternary_lat<K>(a, b, c), ternary<K>(a, b, c))) == -1) && ...);
+		}
+		void inline test_equal_latency_equals_reference()
+		{
+			std::cout << "ternary_logic::test_equal_latency_equals_reference" << std::endl;
+
+			static_assert(latency_equals_reference(std::make_index_sequence<256>()));
+			if (!latency_equals_size(std::make_index_sequence<256>())) {
+				std::cout << "NOT EQUAL!" << std::endl;
+				static_cast<void>(getchar());
+			}
+		}
+		template<uarch U, size_t... K>
+		[[nodiscard]] constexpr bool uarch_equals_reference(std::index_sequence<K...>) noexcept
+		{
+			constexpr uint64_t a = 0xF0F0F0F0F0F0F0F0ull;
+			constexpr uint64_t b = 0xCCCCCCCCCCCCCCCCull;
+			constexpr uint64_t c = 0xAAAAAAAAAAAAAAAAull;
+			return ((ternary<K, goal::throughput, U>(a, b, c) == reference::vpternlog(a, b, c, K)) && ...)
+				&& ((ternary<K, goal::latency, U>(a, b, c) == reference::vpternlog(a, b, c, K)) && ...)
+				&& ((ternary<K, goal::throughput, U>(static_cast<uint32_t>(a), static_cast<uint32_t>(b), static_cast<uint32_t>(c)) == static_cast<uint32_t>(reference::vpternlog(a, b, c, K))) && ...);
+		}
+		template<uarch U, size_t... K>
+		[[nodiscard]] inline bool uarch_equals_generic(std::index_sequence<K...>) noexcept
+		{
+			const auto a = _mm_set1_epi8((unsigned char)0b11110000);
+			const auto b = _mm_set1_epi8((unsigned char)0b11001100);
+			const auto c = _mm_set1_epi8((unsigned char)0b10101010);
+			return ((_mm_movemask_epi8(_mm_cmpeq_epi8(ternary<K, goal::throughput, U>(a, b, c), ternary<K, goal::throughput, uarch::generic>(a, b, c))) == 0xFFFF) && ...)
+				&& ((_mm_movemask_epi8(_mm_cmpeq_epi8(ternary<K, goal::latency, U>(a, b, c), ternary<K, goal::throughput, uarch::generic>(a, b, c))) == 0xFFFF) && ...);
+		}
+		template<size_t... U>
+		[[nodiscard]] inline bool all_uarch_equal(std::index_sequence<U...>) noexcept
+		{
+			static_assert((uarch_equals_reference<static_cast<uarch>(U)>(std::make_index_sequence<256>()) && ...));
+			return (uarch_equals_generic<static_cast<uarch>(U)>(std::make_index_sequence<256>()) && ...);
+		}
+		void inline test_equal_uarch_equals_reference()
+		{
+			std::cout << "ternary_logic::test_equal_uarch_equals_reference (this core: " << uarch_name(detect_uarch()) << ")" << std::endl;
+
+			if (!all_uarch_equal(std::make_index_sequence<n_uarch>())) {
+				std::cout << "NOT EQUAL!" << std::endl;
+				static_cast<void>(getchar());
+			}
+		}
+		template<size_t... K>
+		[[nodiscard]] inline bool mask_equals_reference(std::index_sequence<K...>) noexcept
+		{
+			constexpr uint64_t a = 0xF0F0F0F0F0F0F0F0ull;
+			constexpr uint64_t b = 0xCCCCCCCCCCCCCCCCull;
+			constexpr uint64_t c = 0xAAAAAAAAAAAAAAAAull;
+			return ((_cvtmask64_u64(ternary_kmask<K>(_cvtu64_mask64(a), _cvtu64_mask64(b), _cvtu64_mask64(c))) == reference::vpternlog(a, b, c, K)) && ...);
+		}
+		void inline test_equal_mask_equals_reference()
+		{
+			std::cout << "ternary_logic::test_equal_mask_equals_reference" << std::endl;
+
+			if (!mask_equals_reference(std::make_index_sequence<256>())) {
+				std::cout << "NOT EQUAL!" << std::endl;
+				static_cast<void>(getchar());
+			}
+		}
+		template<goal G, size_t... K>
+		[[nodiscard]] inline bool float_equals_reference(std::index_sequence<K...>) noexcept
+		{
+			const auto a = _mm256_set1_epi8((unsigned char)0b11110000);
+			const auto b = _mm256_set1_epi8((unsigned char)0b11001100);
+			const auto c = _mm256_set1_epi8((unsigned char)0b10101010);
+			const auto a128 = _mm256_castsi256_si128(a);
+			const auto b128 = _mm256_castsi256_si128(b);
+			const auto c128 = _mm256_castsi256_si128(c);
+			return ((_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_castps_si128(ternary<K, G>(_mm_castsi128_ps(a128), _mm_castsi128_ps(b128), _mm_castsi128_ps(c128))), _mm_set1_epi8(static_cast<char>(K)))) == 0xFFFF) && ...)
+				&& ((_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_castpd_si128(ternary<K, G>(_mm_castsi128_pd(a128), _mm_castsi128_pd(b128), _mm_castsi128_pd(c128))), _mm_set1_epi8(static_cast<char>(K)))) == 0xFFFF) && ...)
+				&& ((_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_castps_si256(ternary<K, G>(_mm256_castsi256_ps(a), _mm256_castsi256_ps(b), _mm256_castsi256_ps(c))), _mm256_set1_epi8(static_cast<char>(K)))) == -1) && ...)
+				&& ((_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_castpd_si256(ternary<K, G>(_mm256_castsi256_pd(a), _mm256_castsi256_pd(b), _mm256_castsi256_pd(c))), _mm256_set1_epi8(static_cast<char>(K)))) == -1) && ...);
+		}
+		void inline test_equal_float_equals_reference()
+		{
+			std::cout << "ternary_logic::test_equal_float_equals_reference" << std::endl;
+
+			if (!float_equals_reference<goal::throughput>(std::make_index_sequence<256>()) || !float_equals_reference<goal::latency>(std::make_index_sequence<256>())) {
+				std::cout << "NOT EQUAL!" << std::endl;
+				static_cast<void>(getchar());
+			}
+		}
 		void inline test_equal_avx512_equals_avx512raw()
 		{
 			std::cout << "ternary_logic::test_equal_avx512_equals_avx512raw" << std::endl;
@@ -1163,12 +1839,12 @@ namespace ternarylogic
 				const auto r1 = priv::ternary_not_reduced(a, b, c, i);
 				const auto r2 = priv::ternary_no_vpternlog(a, b, c, i);
 
-				if (r1.m512i_u8[0] != r2.m512i_u8[0])
+				if (compat::lane_u8(r1, 0) != compat::lane_u8(r2, 0))
 				{
 					std::cout << "NOT EQUAL!" << std::endl;
 					std::cout << "i = " << i << std::endl;
-					std::cout << "not reduced: " << std::bitset<8>(r1.m512i_u8[0]).to_string() << std::endl;
-					std::cout << "reduced:     " << std::bitset<8>(r2.m512i_u8[0]).to_string() << std::endl;
+					std::cout << "not reduced: " << std::bitset<8>(compat::lane_u8(r1, 0)).to_string() << std::endl;
+					std::cout << "reduced:     " << std::bitset<8>(compat::lane_u8(r2, 0)).to_string() << std::endl;
 					static_cast<void>(getchar());
 				}
 			}
@@ -1190,7 +1866,7 @@ namespace ternarylogic
 				const auto r1 = priv::ternary_not_reduced(a1, b1, c1, i);
 				const auto r2 = priv::ternary_not_reduced(a2, b2, c2, i);
 
-				const auto r1_char = r1.m128i_u8[0];
+				const auto r1_char = compat::lane_u8(r1, 0);
 				const auto r2_char = static_cast<unsigned char>(r2);
 
 				if (r1_char != r2_char)
@@ -1211,16 +1887,16 @@ namespace ternarylogic
 			const auto b1 = _mm_set1_epi8((unsigned char)0b11001100);
 			const auto c1 = _mm_set1_epi8((unsigned char)0b11110000);
 
-			const unsigned long long a2 = 0b10101010;
-			const unsigned long long b2 = 0b11001100;
-			const unsigned long long c2 = 0b11110000;
+			const uint64_t a2 = 0b10101010;
+			const uint64_t b2 = 0b11001100;
+			const uint64_t c2 = 0b11110000;
 
 			for (auto i = 0; i <= 0xFF; ++i)
 			{
 				const auto r1 = priv::ternary_not_reduced(a1, b1, c1, i);
 				const auto r2 = priv::ternary_not_reduced(a2, b2, c2, i);
 
-				const auto r1_char = r1.m128i_u8[0];
+				const auto r1_char = compat::lane_u8(r1, 0);
 				const auto r2_char = static_cast<unsigned char>(r2);
 
 				if (r1_char != r2_char)
@@ -1266,6 +1942,7 @@ namespace ternarylogic
 
 
 		template <bf_type K>
+		// a single evaluation per measurement, see bench.cpp for the throughput and latency of every kernel
 		void inline test_speed_vpternlog()
 		{
 			const int n_experiments = 100000;
@@ -1289,12 +1966,12 @@ namespace ternarylogic
 				}
 				{
 					const unsigned long long timing_start = rdtsc();
-					sum1 = _mm512_add_epi32(sum1, priv::ternary_intern_no_vpternlog<K>(a, b, c));
+					sum2 = _mm512_add_epi32(sum2, priv::ternary_intern_no_vpternlog<K>(a, b, c));
 					min_duration2 = std::min(min_duration2, rdtsc() - timing_start);
 				}
 			}
-			std::cout << "BF3[" << K << "] not_reduced  takes " << std::fixed << std::setprecision(8) << static_cast<float>(min_duration1) / n_loops << " cycles. Result = " << std::to_string(sum1.m512i_u8[0]) << std::endl;
-			std::cout << "BF3[" << K << "] no_vpternlog takes " << std::fixed << std::setprecision(8) << static_cast<float>(min_duration2) / n_loops << " cycles. Result = " << std::to_string(sum2.m512i_u8[0]) << std::endl;
+			std::cout << "BF3[" << K << "] not_reduced  takes " << std::fixed << std::setprecision(8) << static_cast<float>(min_duration1) / n_loops << " cycles. Result = " << std::to_string(compat::lane_u8(sum1, 0)) << std::endl;
+			std::cout << "BF3[" << K << "] no_vpternlog takes " << std::fixed << std::setprecision(8) << static_cast<float>(min_duration2) / n_loops << " cycles. Result = " << std::to_string(compat::lane_u8(sum2, 0)) << std::endl;
 
 		}
 		void inline test_speed_vpternlog_all()
@@ -1322,6 +1999,199 @@ namespace ternarylogic
 			test_speed_vpternlog<20>();
 		}
 
+		void inline test_profile_counts()
+		{
+			std::cout << "ternary_logic::test_profile_counts" << std::endl;
+#ifdef TERNARYLOGIC_PROFILE
+			profile::reset();
+			const uint64_t a = 0xF0F0F0F0F0F0F0F0ull;
+			for (int i = 0; i < 3; ++i) {
+				static_cast<void>(ternary(a, a, a, 0x96));
+			}
+			static_cast<void>(ternary(a, a, a, 0xE8));
+
+			const std::unique_ptr<profile::counters> c = std::make_unique<profile::counters>(profile::snapshot());
+			const size_t i = static_cast<size_t>(isa_of<uint64_t>::value);
+			if ((c->calls[i][0x96] != 3) || (c->bytes[i][0x96] != 3 * sizeof(uint64_t)) || (c->calls[i][0xE8] != 1)) {
+				std::cout << "ERROR: unexpected counts" << std::endl;
+			}
+			profile::reset();
+			if (profile::snapshot().calls[i][0x96] != 0) {
+				std::cout << "ERROR: reset did not clear the counts" << std::endl;
+			}
+#else
+			std::cout << "skipped: TERNARYLOGIC_PROFILE is not defined" << std::endl;
+#endif
+		}
+
+		void inline test_cost_operands()
+		{
+			std::cout << "ternary_logic::test_cost_operands" << std::endl;
+
+			static_assert(cost<0x00, isa::sse>().instructions == 0);
+			static_assert(cost<0x00, isa::sse>().constants == 1);
+			static_assert(cost<0xF0, isa::avx2>().instructions == 0);
+			static_assert(cost<0x96, isa::avx512raw>().instructions == 1);
+			static_assert(cost<0xCA, isa::xop>().instructions == 1);
+
+			// a kernel reads exactly the inputs that its function depends on
+			bool has_error = false;
+			for (size_t i = 0; i < n_isa; ++i) {
+				for (bf_type k = 0; k <= 0xFF; ++k) {
+					const uint8_t a = reference::vpternlog(0xF0, 0xCC, 0xAA, k) != reference::vpternlog(0x00, 0xCC, 0xAA, k) ? 1 : 0;
+					const uint8_t b = reference::vpternlog(0xF0, 0xCC, 0xAA, k) != reference::vpternlog(0xF0, 0x00, 0xAA, k) ? 2 : 0;
+					const uint8_t c = reference::vpternlog(0xF0, 0xCC, 0xAA, k) != reference::vpternlog(0xF0, 0xCC, 0x00, k) ? 4 : 0;
+					if (cost(k, static_cast<isa>(i)).operands != (a | b | c)) {
+						std::cout << "ERROR: isa " << isa_name(static_cast<isa>(i)) << " k " << k << std::endl;
+						has_error = true;
+					}
+				}
+			}
+			if (!has_error) std::cout << "test_cost_operands: No errors found!" << std::endl;
+		}
+
+		void inline test_complemented_output()
+		{
+			std::cout << "ternary_logic::test_complemented_output" << std::endl;
+
+			static_assert(complement_input(0x80, 0) == 0x08);	// a & b & c -> ~a & b & c
+			static_assert(complement_input(0x80, 1) == 0x20);
+			static_assert(complement_input(0x80, 2) == 0x40);
+			static_assert(complement_is_cheaper(0x01, isa::sse) && !complement_is_cheaper(0xFE, isa::sse));
+			static_assert(!complement_is_cheaper(0x01, isa::avx512raw));
+			static_assert(std::is_same_v<decltype(ternary_tagged<0x01>(__m128i{}, __m128i{}, __m128i{})), complemented<__m128i>>);
+			static_assert(std::is_same_v<decltype(ternary_tagged<0xFE>(__m128i{}, __m128i{}, __m128i{})), __m128i>);
+
+			constexpr uint64_t a = 0xF0F0F0F0F0F0F0F0ull;
+			constexpr uint64_t b = 0xCCCCCCCCCCCCCCCCull;
+			constexpr uint64_t c = 0xAAAAAAAAAAAAAAAAull;
+			constexpr uint64_t d = 0xFF00FF00FF00FF00ull;
+
+			bool has_error = false;
+			for (bf_type k = 0; k <= 0xFF; ++k) {
+				for (int i = 0; i < 3; ++i) {
+					const uint64_t x[3] = { (i == 0) ? ~a : a, (i == 1) ? ~b : b, (i == 2) ? ~c : c };
+					if (reference::vpternlog(x[0], x[1], x[2], complement_input(k, i)) != reference::vpternlog(a, b, c, k)) {
+						std::cout << "ERROR: complement_input k " << k << " input " << i << std::endl;
+						has_error = true;
+					}
+				}
+			}
+
+			// nor(a, b, c) is kept as a | b | c, and the and with ~d absorbs the not
+			const auto n = ternary_tagged<0x01>(_mm_set1_epi64x(a), _mm_set1_epi64x(b), _mm_set1_epi64x(c));
+			const __m128i r = untagged(ternary_tagged<0xC0>(n, _mm_set1_epi64x(~d), _mm_set1_epi64x(c)));
+			const __m128i m = untagged(n);
+			if ((static_cast<uint64_t>(_mm_cvtsi128_si64(r)) != (~(a | b | c) & ~d))
+				|| (static_cast<uint64_t>(_mm_cvtsi128_si64(m)) != ~(a | b | c))
+				|| (untagged(ternary_tagged<0x96>(uint32_t(a), uint32_t(b), uint32_t(c))) != uint32_t(a ^ b ^ c))) {
+				std::cout << "ERROR: ternary_tagged" << std::endl;
+				has_error = true;
+			}
+			if (!has_error) std::cout << "test_complemented_output: No errors found!" << std::endl;
+		}
+
+		template<size_t S, size_t... K>
+		[[nodiscard]] inline bool bitvector_equals_bitset(const std::bitset<S>& a, const std::bitset<S>& b, const std::bitset<S>& c, std::index_sequence<K...>)
+		{
+			const bitvector<S> a2(a);
+			const bitvector<S> b2(b);
+			const bitvector<S> c2(c);
+			return ((ternary<K>(a2, b2, c2).to_bitset() == ternarylogic::bitset::ternary<K>(a, b, c)) && ...)
+				&& ((ternary(a2, b2, c2, K) == bitvector<S>(ternarylogic::bitset::ternary<K>(a, b, c))) && ...);
+		}
+		void inline test_equal_bitvector_equals_bitset()
+		{
+			std::cout << "ternary_logic::test_equal_bitvector_equals_bitset" << std::endl;
+
+			// not a multiple of 64: the bits past S stay zero for the functions with f(0, 0, 0) = 1
+			constexpr size_t S = 1000;
+			std::bitset<S> a;
+			std::bitset<S> b;
+			std::bitset<S> c;
+			for (size_t i = 0; i < S; ++i) {
+				a[i] = (rand() & 1) != 0;
+				b[i] = (rand() & 1) != 0;
+				c[i] = (rand() & 1) != 0;
+			}
+			const bitvector<S> a2(a);
+			if ((a2.to_bitset() != a) || (a2.count() != a.count())) {
+				std::cout << "NOT EQUAL: conversion" << std::endl;
+				static_cast<void>(getchar());
+			}
+			if (!bitvector_equals_bitset(a, b, c, std::make_index_sequence<256>())) {
+				std::cout << "NOT EQUAL!" << std::endl;
+				static_cast<void>(getchar());
+			}
+		}
+
+		template<bf_type K, typename L, typename T>
+		[[nodiscard]] inline bool masked_equals_reference(const T src, const unsigned k, const T a, const T b, const T c)
+		{
+			constexpr size_t n = sizeof(T) / sizeof(L);
+			L s[n], x[n], y[n], z[n], m[n], r1[n], r2[n], r3[n], r4[n];
+			std::memcpy(s, &src, sizeof(T));
+			std::memcpy(x, &a, sizeof(T));
+			std::memcpy(y, &b, sizeof(T));
+			std::memcpy(z, &c, sizeof(T));
+			for (size_t i = 0; i < n; ++i) m[i] = ((k >> i) & 1) ? static_cast<L>(~static_cast<L>(0)) : 0;
+			T mv;
+			std::memcpy(&mv, m, sizeof(T));
+
+			const T t1 = ternary_mask<K, L>(src, k, a, b, c);
+			const T t2 = ternary_maskz<K, L>(k, a, b, c);
+			const T t3 = ternary_mask<K, L>(src, mv, a, b, c);
+			const T t4 = ternary_mask<K, L>(k, a, b, c);
+			std::memcpy(r1, &t1, sizeof(T));
+			std::memcpy(r2, &t2, sizeof(T));
+			std::memcpy(r3, &t3, sizeof(T));
+			std::memcpy(r4, &t4, sizeof(T));
+			for (size_t i = 0; i < n; ++i) {
+				const L f = reference::vpternlog(x[i], y[i], z[i], K);
+				if ((r1[i] != (m[i] ? f : s[i])) || (r2[i] != (m[i] ? f : 0)) || (r3[i] != r1[i]) || (r4[i] != (m[i] ? f : x[i]))) return false;
+			}
+			return true;
+		}
+		template<typename L, typename T, bf_type... K>
+		[[nodiscard]] inline bool masked_equals_reference_all(const T src, const unsigned k, const T a, const T b, const T c)
+		{
+			return (masked_equals_reference<K, L>(src, k, a, b, c) && ...);
+		}
+		void inline test_masked_equals_reference()
+		{
+			std::cout << "ternary_logic::test_masked_equals_reference" << std::endl;
+
+			bool has_error = false;
+			for (int experiment = 0; experiment < 100; ++experiment)
+			{
+				uint64_t w[4][8];
+				for (auto& v : w) for (uint64_t& x : v) x = (static_cast<uint64_t>(rand()) << 40) ^ (static_cast<uint64_t>(rand()) << 20) ^ static_cast<uint64_t>(rand());
+				const unsigned k = static_cast<unsigned>(rand()) & 0xFFFF;
+				__m128i x1[4];
+				__m256i x2[4];
+				__m512i x3[4];
+				for (int i = 0; i < 4; ++i) {
+					std::memcpy(&x1[i], w[i], sizeof(__m128i));
+					std::memcpy(&x2[i], w[i], sizeof(__m256i));
+					std::memcpy(&x3[i], w[i], sizeof(__m512i));
+				}
+				const bool ok = masked_equals_reference_all<uint32_t, __m128i, 0x00, 0x01, 0x96, 0xCA, 0xE8, 0xFF>(x1[0], k & 0xF, x1[1], x1[2], x1[3])
+					&& masked_equals_reference_all<uint64_t, __m128i, 0x00, 0x01, 0x96, 0xCA, 0xE8, 0xFF>(x1[0], k & 0x3, x1[1], x1[2], x1[3])
+					&& masked_equals_reference_all<uint32_t, __m256i, 0x00, 0x01, 0x96, 0xCA, 0xE8, 0xFF>(x2[0], k & 0xFF, x2[1], x2[2], x2[3])
+					&& masked_equals_reference_all<uint64_t, __m256i, 0x00, 0x01, 0x96, 0xCA, 0xE8, 0xFF>(x2[0], k & 0xF, x2[1], x2[2], x2[3])
+#ifdef __AVX512F__
+					&& masked_equals_reference_all<uint32_t, __m512i, 0x00, 0x01, 0x96, 0xCA, 0xE8, 0xFF>(x3[0], k, x3[1], x3[2], x3[3])
+					&& masked_equals_reference_all<uint64_t, __m512i, 0x00, 0x01, 0x96, 0xCA, 0xE8, 0xFF>(x3[0], k & 0xFF, x3[1], x3[2], x3[3])
+#endif
+					;
+				if (!ok) {
+					std::cout << "NOT EQUAL: experiment " << experiment << std::endl;
+					has_error = true;
+				}
+			}
+			if (!has_error) std::cout << "test_masked_equals_reference: No errors found!" << std::endl;
+		}
+
 		void inline tests()
 		{
 			test_equal_referene_implentation();
@@ -1330,10 +2200,21 @@ namespace ternarylogic
 			test_equal_x86_32_equals_sse();
 			test_equal_x86_64_equals_sse();
 			test_equal_bitset_equals_sse();
+			test_equal_bitvector_equals_bitset();
 			test_equal_raw_equals_reduced();
+			test_equal_reduced_equals_reference();
+			test_equal_latency_equals_reference();
+			test_equal_uarch_equals_reference();
+			test_equal_mask_equals_reference();
+			test_masked_equals_reference();
+			test_equal_float_equals_reference();
 			test_equal_avx512_equals_avx512raw();
+			test_profile_counts();
+			test_cost_operands();
+			test_complemented_output();
 
 			//test_speed_vpternlog_all();
 		}
 	}
+#endif
 }
@@ -0,0 +1,224 @@
+#pragma once
+#include <utility>		// for pair, index_sequence
+
+#include "ternary_logic.cpp"
+#include "ternary_pairs.cpp"
+
+namespace ternarylogic::pairs
+{
+	/// <summary>
+	/// Where a table has the pair k1, k2: the kernel at index, called with the inputs x, y and z (0 = a, 1 = b, 2 = c),
+	/// computes the pair, in swapped order if swapped; index is -1 if the table has no kernel of the pair
+	/// </summary>
+	struct match
+	{
+		int index;
+		uint8_t x;
+		uint8_t y;
+		uint8_t z;
+		bool swapped;
+	};
+
+	/// <summary>
+	/// The function that, called with the inputs x, y and z (0 = a, 1 = b, 2 = c), computes function k
+	/// </summary>
+	[[nodiscard]] constexpr uint8_t permute(const bf_type k, const uint8_t x, const uint8_t y, const uint8_t z) noexcept
+	{
+		constexpr uint8_t inputs[3] = { 0xF0, 0xCC, 0xAA };
+		unsigned result = 0;
+		for (int i = 0; i < 8; ++i) {
+			const int index = (((inputs[x] >> i) & 1) << 2) | (((inputs[y] >> i) & 1) << 1) | ((inputs[z] >> i) & 1);
+			result |= ((k >> i) & 1u) << index;
+		}
+		return static_cast<uint8_t>(result);
+	}
+
+	/// <summary>
+	/// Index of the kernel of k1 < k2 in the sorted table, -1 if there is none
+	/// </summary>
+	template<size_t N>
+	[[nodiscard]] constexpr int find(const kernel (&table)[N], const uint8_t k1, const uint8_t k2) noexcept
+	{
+		size_t low = 0;
+		size_t high = N;
+		while (low < high) {
+			const size_t mid = (low + high) / 2;
+			const kernel& p = table[mid];
+			if ((p.k1 == k1) && (p.k2 == k2)) return static_cast<int>(mid);
+			if ((p.k1 < k1) || ((p.k1 == k1) && (p.k2 < k2))) low = mid + 1;
+			else high = mid;
+		}
+		return -1;
+	}
+
+	/// <summary>
+	/// The tables hold one pair of the pairs that differ in the order of the inputs; try all six orders
+	/// </summary>
+	template<size_t N>
+	[[nodiscard]] constexpr match lookup(const kernel (&table)[N], const bf_type k1, const bf_type k2) noexcept
+	{
+		constexpr uint8_t orders[6][3] = { { 0, 1, 2 }, { 0, 2, 1 }, { 1, 0, 2 }, { 1, 2, 0 }, { 2, 0, 1 }, { 2, 1, 0 } };
+		if ((k1 & 0xFF) == (k2 & 0xFF)) return match{ -1, 0, 1, 2, false };
+
+		for (const auto& o : orders) {
+			const uint8_t p1 = permute(k1, o[0], o[1], o[2]);
+			const uint8_t p2 = permute(k2, o[0], o[1], o[2]);
+			const int index = (p1 < p2) ? find(table, p1, p2) : find(table, p2, p1);
+			if (index >= 0) return match{ index, o[0], o[1], o[2], p1 > p2 };
+		}
+		return match{ -1, 0, 1, 2, false };
+	}
+
+	/// <summary>
+	/// The single instruction kernels of the backend of T on microarchitecture U
+	/// </summary>
+	template<uarch U>
+	struct intern
+	{
+		template<bf_type K, typename T>
+		[[nodiscard]] static __forceinline constexpr T ternary(const T a, const T b, const T c) noexcept
+		{
+			return ternarylogic::priv::ternary_intern<K, U>(a, b, c);
+		}
+	};
+
+	namespace priv
+	{
+		template<const auto& Table, int Index, typename Kernels, typename T, size_t... I>
+		[[nodiscard]] __forceinline constexpr std::pair<T, T> run(const T a, const T b, const T c, std::index_sequence<I...>) noexcept
+		{
+			constexpr kernel p = Table[Index];
+			T r[3 + max_instructions] = { a, b, c };
+			((r[3 + I] = Kernels::template ternary<p.code[I].k>(r[p.code[I].a], r[p.code[I].b], r[p.code[I].c])), ...);
+			return { r[p.r1], r[p.r2] };
+		}
+	}
+
+	/// <summary>
+	/// Boolean Functions K1 and K2 of the same inputs with the kernel of Table, whose instructions are the single
+	/// instruction kernels Kernels::ternary; apart if Table has no kernel of the pair. E.g. with ternary_xop.cpp:
+	/// pairs::ternary2&lt;0x96, 0xE8, xop::kernels&lt;0&gt;, pairs::xop&gt;(a, b, c)
+	/// </summary>
+	template<bf_type K1, bf_type K2, typename Kernels, const auto& Table, typename T>
+	[[nodiscard]] __forceinline constexpr std::pair<T, T> ternary2(const T a, const T b, const T c) noexcept
+	{
+		constexpr match m = lookup(Table, K1, K2);
+		if constexpr (m.index < 0) {
+			return { Kernels::template ternary<K1>(a, b, c), Kernels::template ternary<K2>(a, b, c) };
+		}
+		else {
+			const T in[3] = { a, b, c };
+			const std::pair<T, T> r = priv::run<Table, m.index, Kernels>(in[m.x], in[m.y], in[m.z], std::make_index_sequence<Table[m.index].size>());
+			if constexpr (m.swapped) {
+				return { r.second, r.first };
+			}
+			else {
+				return r;
+			}
+		}
+	}
+}
+
+namespace ternarylogic
+{
+	/// <summary>
+	/// Boolean Functions K1 and K2 of the same inputs, computed together: e.g. the sum 0x96 and the carry 0xE8 of a
+	/// full adder share a ^ b. Pairs without a shorter joint kernel are computed apart, as are all pairs on AVX-512,
+	/// where vpternlog takes a single instruction per function
+	/// </summary>
+	template<bf_type K1, bf_type K2, uarch U = default_uarch, typename T>
+	[[nodiscard]] __forceinline constexpr std::pair<T, T> ternary2(const T a, const T b, const T c) noexcept
+	{
+		using kernels = pairs::intern<U>;
+		constexpr isa i = isa_of<T>::value;
+		if constexpr ((i == isa::x86_32) || (i == isa::x86_64) || (i == isa::bitset)) {
+			return pairs::ternary2<K1, K2, kernels, pairs::x86>(a, b, c);
+		}
+		else if constexpr ((i == isa::x86_32_bmi) || (i == isa::x86_64_bmi)) {
+			return pairs::ternary2<K1, K2, kernels, pairs::bmi>(a, b, c);
+		}
+		else if constexpr (i == isa::avx512raw) {
+			return { ternary<K1, goal::throughput, U>(a, b, c), ternary<K2, goal::throughput, U>(a, b, c) };
+		}
+		else {
+			return pairs::ternary2<K1, K2, kernels, pairs::sse>(a, b, c);
+		}
+	}
+}
+
+namespace ternarylogic::pairs::test
+{
+	/// <summary>
+	/// Run the instructions of a kernel on the truth vectors of the inputs
+	/// </summary>
+	[[nodiscard]] inline std::pair<uint8_t, uint8_t> evaluate(const kernel& p) noexcept
+	{
+		uint8_t r[3 + max_instructions] = { 0xF0, 0xCC, 0xAA };
+		for (int i = 0; i < p.size; ++i) {
+			const instruction& ins = p.code[i];
+			r[3 + i] = static_cast<uint8_t>(reference::vpternlog(r[ins.a], r[ins.b], r[ins.c], ins.k));
+		}
+		return { r[p.r1], r[p.r2] };
+	}
+
+	template<size_t N>
+	[[nodiscard]] inline bool table_equals_reference(const char* name, const kernel (&table)[N])
+	{
+		bool result = true;
+		for (size_t i = 0; i < N; ++i) {
+			const kernel& p = table[i];
+			const std::pair<uint8_t, uint8_t> r = evaluate(p);
+			if ((r.first != p.k1) || (r.second != p.k2) || ((i > 0) && (find(table, p.k1, p.k2) != static_cast<int>(i)))) {
+				std::cout << "ERROR: pairs::" << name << " 0x" << std::hex << int(p.k1) << " 0x" << int(p.k2) << std::dec << std::endl;
+				result = false;
+			}
+		}
+		return result;
+	}
+
+	template<bf_type K1, bf_type K2, typename T>
+	[[nodiscard]] inline bool pair_equals_reference(const T a, const T b, const T c, const uint64_t mask) noexcept
+	{
+		const std::pair<T, T> r = ternarylogic::ternary2<K1, K2>(a, b, c);
+		return ((static_cast<uint64_t>(r.first) & mask) == (reference::vpternlog(a, b, c, K1) & mask))
+			&& ((static_cast<uint64_t>(r.second) & mask) == (reference::vpternlog(a, b, c, K2) & mask));
+	}
+
+	template<bf_type K1, bf_type K2>
+	[[nodiscard]] inline bool pair_equals_reference() noexcept
+	{
+		constexpr uint64_t a = 0xF0F0F0F0F0F0F0F0ull;
+		constexpr uint64_t b = 0xCCCCCCCCCCCCCCCCull;
+		constexpr uint64_t c = 0xAAAAAAAAAAAAAAAAull;
+		const auto [s1, s2] = ternarylogic::ternary2<K1, K2>(_mm_set1_epi64x(a), _mm_set1_epi64x(b), _mm_set1_epi64x(c));
+		return pair_equals_reference<K1, K2>(a, b, c, ~0ull)
+			&& pair_equals_reference<K1, K2>(static_cast<uint32_t>(a), static_cast<uint32_t>(b), static_cast<uint32_t>(c), 0xFFFFFFFFull)
+			&& (static_cast<uint64_t>(_mm_cvtsi128_si64(s1)) == reference::vpternlog(a, b, c, K1))
+			&& (static_cast<uint64_t>(_mm_cvtsi128_si64(s2)) == reference::vpternlog(a, b, c, K2));
+	}
+
+	// the sum and the carry of a full adder share a ^ b, in any order of the inputs and of the results
+	static_assert(lookup(x86, 0x96, 0xE8).index >= 0);
+	static_assert(ternarylogic::ternary2<0x96, 0xE8>(uint64_t{ 0xF0 }, uint64_t{ 0xCC }, uint64_t{ 0xAA }) == std::pair<uint64_t, uint64_t>(0x96, 0xE8));
+	static_assert(ternarylogic::ternary2<0xE8, 0x96>(uint32_t{ 0xF0 }, uint32_t{ 0xCC }, uint32_t{ 0xAA }) == std::pair<uint32_t, uint32_t>(0xE8, 0x96));
+
+	inline void tests()
+	{
+		std::cout << "ternary_pairs::tests" << std::endl;
+
+		bool ok = table_equals_reference("sse", sse) && table_equals_reference("x86", x86)
+			&& table_equals_reference("bmi", bmi) && table_equals_reference("xop", xop);
+
+		// SHA-256 Ch and Maj, the full adder, an order of the inputs and of the results that the tables do not hold,
+		// a pair without a joint kernel and a pair of the same function
+		ok = ok && pair_equals_reference<0xCA, 0xE8>() && pair_equals_reference<0xE8, 0xCA>()
+			&& pair_equals_reference<0x96, 0xE8>() && pair_equals_reference<0xE8, 0x96>()
+			&& pair_equals_reference<0xB8, 0xE2>() && pair_equals_reference<0x00, 0xFF>()
+			&& pair_equals_reference<0x96, 0x96>();
+
+		if (!ok) {
+			std::cout << "NOT EQUAL!" << std::endl;
+			static_cast<void>(getchar());
+		}
+	}
+}
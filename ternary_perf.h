@@ -0,0 +1,285 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <iostream>		// for cout
+#include <mutex>
+#include <ostream>
+
+#ifdef __linux__
+#include <cpuid.h>
+#include <cstring>		// for memset
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace ternarylogic::perf
+{
+	/// <summary>
+	/// Counted events: task_clock is the time on the CPU in ns (a software event, available without a PMU), uops are the
+	/// issued uops on Intel and the retired ops on AMD, l1d_misses are the L1 data cache read misses
+	/// </summary>
+	enum class event : uint8_t { task_clock, cycles, instructions, uops, l1d_misses, llc_misses, branch_misses };
+	constexpr size_t n_events = 7;
+
+	[[nodiscard]] constexpr const char* event_name(const event e) noexcept
+	{
+		switch (e)
+		{
+			case event::task_clock: return "task_clock";
+			case event::cycles: return "cycles";
+			case event::instructions: return "instructions";
+			case event::uops: return "uops";
+			case event::l1d_misses: return "l1d_misses";
+			case event::llc_misses: return "llc_misses";
+			case event::branch_misses: return "branch_misses";
+			default: return "unknown";
+		}
+	}
+
+	/// <summary>
+	/// Counter values, scaled when the kernel multiplexes the PMU; an event is not valid when the CPU, the kernel or
+	/// perf_event_paranoid does not allow it, e.g. all hardware events in most virtual machines
+	/// </summary>
+	struct sample
+	{
+		std::array<uint64_t, n_events> value{};
+		std::array<bool, n_events> valid{};
+
+		[[nodiscard]] uint64_t operator[](const event e) const noexcept { return value[static_cast<size_t>(e)]; }
+		[[nodiscard]] bool has(const event e) const noexcept { return valid[static_cast<size_t>(e)]; }
+	};
+
+	[[nodiscard]] inline sample operator-(const sample& a, const sample& b) noexcept
+	{
+		sample result;
+		for (size_t i = 0; i < n_events; ++i) {
+			result.valid[i] = a.valid[i] && b.valid[i];
+			result.value[i] = result.valid[i] ? (a.value[i] - b.value[i]) : 0;
+		}
+		return result;
+	}
+
+	/// <summary>
+	/// The events of the calling thread, in user mode, opened with perf_event_open; without Linux no event is valid
+	/// </summary>
+	class counters
+	{
+		std::array<int, n_events> fd_;
+
+#ifdef __linux__
+		[[nodiscard]] static int open(const uint32_t type, const uint64_t config) noexcept
+		{
+			perf_event_attr attr;
+			std::memset(&attr, 0, sizeof(attr));
+			attr.size = sizeof(attr);
+			attr.type = type;
+			attr.config = config;
+			attr.exclude_kernel = 1;
+			attr.exclude_hv = 1;
+			attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+			return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+		}
+
+		/// <summary>
+		/// The raw event of the uops, which perf has no generic event for; 0 when the vendor is unknown
+		/// </summary>
+		[[nodiscard]] static uint64_t uops_config() noexcept
+		{
+			unsigned eax = 0;
+			unsigned ebx = 0;
+			unsigned ecx = 0;
+			unsigned edx = 0;
+			if (__get_cpuid(0, &eax, &ebx, &ecx, &edx) == 0) return 0;
+			if (ebx == 0x756e6547) return 0x010E;	// "Genu"ineIntel: UOPS_ISSUED.ANY
+			if (ebx == 0x68747541) return 0x00C1;	// "Auth"enticAMD: retired ops
+			return 0;
+		}
+#endif
+
+	public:
+		counters() noexcept
+		{
+			fd_.fill(-1);
+#ifdef __linux__
+			constexpr uint64_t l1d_read_miss = PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+			fd_[static_cast<size_t>(event::task_clock)] = open(PERF_TYPE_SOFTWARE, PERF_COUNT_SW_TASK_CLOCK);
+			fd_[static_cast<size_t>(event::cycles)] = open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+			fd_[static_cast<size_t>(event::instructions)] = open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+			const uint64_t uops = uops_config();
+			if (uops != 0) fd_[static_cast<size_t>(event::uops)] = open(PERF_TYPE_RAW, uops);
+			fd_[static_cast<size_t>(event::l1d_misses)] = open(PERF_TYPE_HW_CACHE, l1d_read_miss);
+			fd_[static_cast<size_t>(event::llc_misses)] = open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES);
+			fd_[static_cast<size_t>(event::branch_misses)] = open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES);
+#endif
+		}
+
+		~counters()
+		{
+#ifdef __linux__
+			for (const int fd : fd_) {
+				if (fd >= 0) close(fd);
+			}
+#endif
+		}
+
+		counters(const counters&) = delete;
+		counters& operator=(const counters&) = delete;
+
+		[[nodiscard]] bool available(const event e) const noexcept { return fd_[static_cast<size_t>(e)] >= 0; }
+
+		[[nodiscard]] sample read() const noexcept
+		{
+			sample result;
+#ifdef __linux__
+			for (size_t i = 0; i < n_events; ++i) {
+				if (fd_[i] < 0) continue;
+				uint64_t data[3];	// value, time enabled, time running
+				if (::read(fd_[i], data, sizeof(data)) != static_cast<ssize_t>(sizeof(data)) || (data[2] == 0)) continue;
+				result.value[i] = (data[1] == data[2]) ? data[0] : static_cast<uint64_t>(static_cast<double>(data[0]) * data[1] / data[2]);
+				result.valid[i] = true;
+			}
+#endif
+			return result;
+		}
+
+		/// <summary>
+		/// The counters of the calling thread, opened on first use
+		/// </summary>
+		[[nodiscard]] static const counters& local()
+		{
+			thread_local const counters c;
+			return c;
+		}
+	};
+
+	/// <summary>
+	/// Events of a number of measured calls, with the bytes and the vectors (elements of the backend type) they processed
+	/// </summary>
+	struct totals
+	{
+		uint64_t calls = 0;
+		uint64_t bytes = 0;
+		uint64_t vectors = 0;
+		sample events{};
+
+		void add(const sample& s, const uint64_t n_vectors, const uint64_t n_bytes) noexcept
+		{
+			for (size_t i = 0; i < n_events; ++i) {
+				// an event counts only when it was valid for every call
+				events.valid[i] = s.valid[i] && ((calls == 0) || events.valid[i]);
+				events.value[i] += s.value[i];
+			}
+			calls += 1;
+			vectors += n_vectors;
+			bytes += n_bytes;
+		}
+	};
+
+	/// <summary>
+	/// Scoped measurement: the events of the calling thread between construction and destruction are added to t,
+	/// under mutex when t is shared between threads. Every scope costs two reads per event, i.e. system calls:
+	/// measure whole blocks, not single elements.
+	/// </summary>
+	class scope
+	{
+		totals& totals_;
+		std::mutex* mutex_;
+		uint64_t vectors_;
+		uint64_t bytes_;
+		sample start_;
+
+	public:
+		scope(totals& t, const uint64_t vectors, const uint64_t bytes, std::mutex* mutex = nullptr)
+			: totals_(t), mutex_(mutex), vectors_(vectors), bytes_(bytes), start_(counters::local().read())
+		{}
+
+		~scope()
+		{
+			const sample s = counters::local().read() - start_;
+			if (mutex_ != nullptr) {
+				const std::lock_guard<std::mutex> lock(*mutex_);
+				totals_.add(s, vectors_, bytes_);
+			}
+			else {
+				totals_.add(s, vectors_, bytes_);
+			}
+		}
+
+		scope(const scope&) = delete;
+		scope& operator=(const scope&) = delete;
+	};
+
+	/// <summary>
+	/// Columns of write_rates: per event its rate per byte and per vector, with prefix
+	/// </summary>
+	inline void write_rate_header(std::ostream& os, const char* prefix = "")
+	{
+		for (size_t i = 0; i < n_events; ++i) {
+			const char* name = event_name(static_cast<event>(i));
+			os << "," << prefix << name << "_per_byte," << prefix << name << "_per_vector";
+		}
+	}
+
+	/// <summary>
+	/// Rates of t as csv columns, empty for the events that are not valid
+	/// </summary>
+	inline void write_rates(std::ostream& os, const totals& t)
+	{
+		for (size_t i = 0; i < n_events; ++i) {
+			if (!t.events.valid[i] || (t.bytes == 0) || (t.vectors == 0)) {
+				os << ",,";
+				continue;
+			}
+			char text[64];
+			std::snprintf(text, sizeof(text), ",%.6f,%.6f", static_cast<double>(t.events.value[i]) / t.bytes, static_cast<double>(t.events.value[i]) / t.vectors);
+			os << text;
+		}
+	}
+}
+
+namespace ternarylogic::perf::test
+{
+	inline void tests()
+	{
+		std::cout << "ternary_perf::tests" << std::endl;
+
+		bool has_error = false;
+		totals t;
+		{
+			const scope s(t, 1000, 64000);
+			volatile uint64_t x = 0;
+			for (int i = 0; i < 1000000; ++i) x = x + 1;
+		}
+		{
+			const scope s(t, 24, 1536);
+		}
+		has_error = (t.calls != 2) || (t.vectors != 1024) || (t.bytes != 65536);
+
+		sample a;
+		sample b;
+		a.valid.fill(true);
+		b.valid.fill(true);
+		a.value[0] = 10;
+		b.value[0] = 4;
+		b.valid[1] = false;
+		const sample d = a - b;
+		has_error = has_error || (d.value[0] != 6) || !d.valid[0] || d.valid[1];
+
+		for (size_t i = 0; i < n_events; ++i) {
+			const event e = static_cast<event>(i);
+			std::cout << "  " << event_name(e) << ": " << (counters::local().available(e) ? "available" : "not available");
+			if (t.events.has(e)) std::cout << ", " << t.events[e] << " in the test loop";
+			std::cout << std::endl;
+		}
+
+		if (has_error) {
+			std::cout << "NOT EQUAL!" << std::endl;
+			static_cast<void>(getchar());
+		}
+		else {
+			std::cout << "ternary_perf::tests: No errors found!" << std::endl;
+		}
+	}
+}
@@ -0,0 +1,3723 @@
+// Generated automatically, please do not edit
+#pragma once
+
+namespace ternarylogic {
+
+    namespace priv {
+
+        // the reduced dispatchers call, per function, the cheapest kernel of all operand orders
+        enum class order : uint8_t { abc, acb, bac, bca, cab, cba };
+
+        struct reduction {
+            uint8_t k;      // function of the called kernel
+            order o;        // order of the inputs of the called kernel
+        };
+
+        [[nodiscard]] constexpr bool valid_reduction(const reduction* table) noexcept {
+            constexpr uint32_t a = 0xF0, b = 0xCC, c = 0xAA;
+            for (bf_type k = 0; k < 256; ++k) {
+                const reduction& r = table[k];
+                const uint32_t x = (r.o == order::abc || r.o == order::acb) ? a : (r.o == order::bac || r.o == order::bca) ? b : c;
+                const uint32_t y = (r.o == order::bac || r.o == order::cab) ? a : (r.o == order::abc || r.o == order::cba) ? b : c;
+                const uint32_t z = (r.o == order::bca || r.o == order::cba) ? a : (r.o == order::acb || r.o == order::cab) ? b : c;
+                if (reference::vpternlog(x, y, z, r.k) != reference::vpternlog(a, b, c, k)) return false;
+            }
+            return true;
+        }
+
+        // kernels of ternary_x86_64.cpp
+        constexpr reduction reduced_x86_64[256] = {
+            { 0x00, order::abc }, // 0x00
+            { 0x01, order::abc }, // 0x01
+            { 0x02, order::abc }, // 0x02
+            { 0x03, order::abc }, // 0x03
+            { 0x02, order::acb }, // 0x04
+            { 0x03, order::acb }, // 0x05
+            { 0x06, order::abc }, // 0x06
+            { 0x07, order::abc }, // 0x07
+            { 0x08, order::abc }, // 0x08
+            { 0x09, order::abc }, // 0x09
+            { 0x0a, order::abc }, // 0x0a
+            { 0x0b, order::abc }, // 0x0b
+            { 0x0a, order::acb }, // 0x0c
+            { 0x0b, order::acb }, // 0x0d
+            { 0x0e, order::abc }, // 0x0e
+            { 0x0f, order::abc }, // 0x0f
+            { 0x02, order::bca }, // 0x10
+            { 0x03, order::bca }, // 0x11
+            { 0x06, order::bac }, // 0x12
+            { 0x07, order::bac }, // 0x13
+            { 0x06, order::cab }, // 0x14
+            { 0x07, order::cab }, // 0x15
+            { 0x16, order::abc }, // 0x16
+            { 0x17, order::abc }, // 0x17
+            { 0x18, order::abc }, // 0x18
+            { 0x19, order::abc }, // 0x19
+            { 0x1a, order::abc }, // 0x1a
+            { 0x1b, order::abc }, // 0x1b
+            { 0x1a, order::acb }, // 0x1c
+            { 0x1b, order::acb }, // 0x1d
+            { 0x1e, order::abc }, // 0x1e
+            { 0x1f, order::abc }, // 0x1f
+            { 0x08, order::bac }, // 0x20
+            { 0x09, order::bac }, // 0x21
+            { 0x0a, order::bac }, // 0x22
+            { 0x0b, order::bac }, // 0x23
+            { 0x18, order::bac }, // 0x24
+            { 0x19, order::bac }, // 0x25
+            { 0x1a, order::bac }, // 0x26
+            { 0x1b, order::bac }, // 0x27
+            { 0x28, order::abc }, // 0x28
+            { 0x29, order::abc }, // 0x29
+            { 0x2a, order::abc }, // 0x2a
+            { 0x2b, order::abc }, // 0x2b
+            { 0x2c, order::abc }, // 0x2c
+            { 0x2d, order::abc }, // 0x2d
+            { 0x2e, order::abc }, // 0x2e
+            { 0x2f, order::abc }, // 0x2f
+            { 0x0a, order::bca }, // 0x30
+            { 0x0b, order::bca }, // 0x31
+            { 0x0e, order::bac }, // 0x32
+            { 0x0f, order::bac }, // 0x33
+            { 0x1a, order::bca }, // 0x34
+            { 0x1b, order::bca }, // 0x35
+            { 0x1e, order::bac }, // 0x36
+            { 0x1f, order::bac }, // 0x37
+            { 0x2c, order::bac }, // 0x38
+            { 0x2d, order::bac }, // 0x39
+            { 0x2e, order::bac }, // 0x3a
+            { 0x2f, order::bac }, // 0x3b
+            { 0x3c, order::abc }, // 0x3c
+            { 0x3d, order::abc }, // 0x3d
+            { 0x3e, order::abc }, // 0x3e
+            { 0x3f, order::abc }, // 0x3f
+            { 0x08, order::cab }, // 0x40
+            { 0x09, order::cab }, // 0x41
+            { 0x18, order::cab }, // 0x42
+            { 0x19, order::cab }, // 0x43
+            { 0x0a, order::cab }, // 0x44
+            { 0x0b, order::cab }, // 0x45
+            { 0x1a, order::cab }, // 0x46
+            { 0x1b, order::cab }, // 0x47
+            { 0x28, order::acb }, // 0x48
+            { 0x29, order::acb }, // 0x49
+            { 0x2c, order::acb }, // 0x4a
+            { 0x2d, order::acb }, // 0x4b
+            { 0x2a, order::acb }, // 0x4c
+            { 0x2b, order::acb }, // 0x4d
+            { 0x2e, order::acb }, // 0x4e
+            { 0x2f, order::acb }, // 0x4f
+            { 0x0a, order::cba }, // 0x50
+            { 0x0b, order::cba }, // 0x51
+            { 0x1a, order::cba }, // 0x52
+            { 0x1b, order::cba }, // 0x53
+            { 0x0e, order::cab }, // 0x54
+            { 0x0f, order::cab }, // 0x55
+            { 0x1e, order::cab }, // 0x56
+            { 0x1f, order::cab }, // 0x57
+            { 0x2c, order::cab }, // 0x58
+            { 0x2d, order::cab }, // 0x59
+            { 0x3c, order::acb }, // 0x5a
+            { 0x3d, order::acb }, // 0x5b
+            { 0x2e, order::cab }, // 0x5c
+            { 0x2f, order::cab }, // 0x5d
+            { 0x3e, order::acb }, // 0x5e
+            { 0x3f, order::acb }, // 0x5f
+            { 0x28, order::bca }, // 0x60
+            { 0x29, order::bca }, // 0x61
+            { 0x2c, order::bca }, // 0x62
+            { 0x2d, order::bca }, // 0x63
+            { 0x2c, order::cba }, // 0x64
+            { 0x2d, order::cba }, // 0x65
+            { 0x3c, order::bca }, // 0x66
+            { 0x3d, order::bca }, // 0x67
+            { 0x68, order::abc }, // 0x68
+            { 0x69, order::abc }, // 0x69
+            { 0x6a, order::abc }, // 0x6a
+            { 0x6b, order::abc }, // 0x6b
+            { 0x6a, order::acb }, // 0x6c
+            { 0x6b, order::acb }, // 0x6d
+            { 0x6e, order::abc }, // 0x6e
+            { 0x6f, order::abc }, // 0x6f
+            { 0x2a, order::bca }, // 0x70
+            { 0x2b, order::bca }, // 0x71
+            { 0x2e, order::bca }, // 0x72
+            { 0x2f, order::bca }, // 0x73
+            { 0x2e, order::cba }, // 0x74
+            { 0x2f, order::cba }, // 0x75
+            { 0x3e, order::bca }, // 0x76
+            { 0x3f, order::bca }, // 0x77
+            { 0x6a, order::bca }, // 0x78
+            { 0x6b, order::bca }, // 0x79
+            { 0x6e, order::bac }, // 0x7a
+            { 0x6f, order::bac }, // 0x7b
+            { 0x6e, order::cab }, // 0x7c
+            { 0x6f, order::cab }, // 0x7d
+            { 0x7e, order::abc }, // 0x7e
+            { 0x7f, order::abc }, // 0x7f
+            { 0x80, order::abc }, // 0x80
+            { 0x81, order::abc }, // 0x81
+            { 0x82, order::abc }, // 0x82
+            { 0x83, order::abc }, // 0x83
+            { 0x82, order::acb }, // 0x84
+            { 0x83, order::acb }, // 0x85
+            { 0x86, order::abc }, // 0x86
+            { 0x87, order::abc }, // 0x87
+            { 0x88, order::abc }, // 0x88
+            { 0x89, order::abc }, // 0x89
+            { 0x8a, order::abc }, // 0x8a
+            { 0x8b, order::abc }, // 0x8b
+            { 0x8a, order::acb }, // 0x8c
+            { 0x8b, order::acb }, // 0x8d
+            { 0x8e, order::abc }, // 0x8e
+            { 0x8f, order::abc }, // 0x8f
+            { 0x82, order::bca }, // 0x90
+            { 0x83, order::bca }, // 0x91
+            { 0x86, order::bac }, // 0x92
+            { 0x87, order::bac }, // 0x93
+            { 0x86, order::cab }, // 0x94
+            { 0x87, order::cab }, // 0x95
+            { 0x96, order::abc }, // 0x96
+            { 0x97, order::abc }, // 0x97
+            { 0x98, order::abc }, // 0x98
+            { 0x99, order::abc }, // 0x99
+            { 0x9a, order::abc }, // 0x9a
+            { 0x9b, order::abc }, // 0x9b
+            { 0x9a, order::acb }, // 0x9c
+            { 0x9b, order::acb }, // 0x9d
+            { 0x9e, order::abc }, // 0x9e
+            { 0x9f, order::abc }, // 0x9f
+            { 0x88, order::bac }, // 0xa0
+            { 0x89, order::bac }, // 0xa1
+            { 0x8a, order::bac }, // 0xa2
+            { 0x8b, order::bac }, // 0xa3
+            { 0x98, order::bac }, // 0xa4
+            { 0x99, order::bac }, // 0xa5
+            { 0x9a, order::bac }, // 0xa6
+            { 0x9b, order::bac }, // 0xa7
+            { 0xa8, order::abc }, // 0xa8
+            { 0xa9, order::abc }, // 0xa9
+            { 0xaa, order::abc }, // 0xaa
+            { 0xab, order::abc }, // 0xab
+            { 0xac, order::abc }, // 0xac
+            { 0xad, order::abc }, // 0xad
+            { 0xae, order::abc }, // 0xae
+            { 0xaf, order::abc }, // 0xaf
+            { 0x8a, order::bca }, // 0xb0
+            { 0x8b, order::bca }, // 0xb1
+            { 0x8e, order::bac }, // 0xb2
+            { 0x8f, order::bac }, // 0xb3
+            { 0x9a, order::bca }, // 0xb4
+            { 0x9b, order::bca }, // 0xb5
+            { 0x9e, order::bac }, // 0xb6
+            { 0x9f, order::bac }, // 0xb7
+            { 0xac, order::bac }, // 0xb8
+            { 0xad, order::bac }, // 0xb9
+            { 0xae, order::bac }, // 0xba
+            { 0xaf, order::bac }, // 0xbb
+            { 0xbc, order::abc }, // 0xbc
+            { 0xbd, order::abc }, // 0xbd
+            { 0xbe, order::abc }, // 0xbe
+            { 0xbf, order::abc }, // 0xbf
+            { 0x88, order::cab }, // 0xc0
+            { 0x89, order::cab }, // 0xc1
+            { 0x98, order::cab }, // 0xc2
+            { 0x99, order::cab }, // 0xc3
+            { 0x8a, order::cab }, // 0xc4
+            { 0x8b, order::cab }, // 0xc5
+            { 0x9a, order::cab }, // 0xc6
+            { 0x9b, order::cab }, // 0xc7
+            { 0xa8, order::acb }, // 0xc8
+            { 0xa9, order::acb }, // 0xc9
+            { 0xac, order::acb }, // 0xca
+            { 0xad, order::acb }, // 0xcb
+            { 0xaa, order::acb }, // 0xcc
+            { 0xab, order::acb }, // 0xcd
+            { 0xae, order::acb }, // 0xce
+            { 0xaf, order::acb }, // 0xcf
+            { 0x8a, order::cba }, // 0xd0
+            { 0x8b, order::cba }, // 0xd1
+            { 0x9a, order::cba }, // 0xd2
+            { 0x9b, order::cba }, // 0xd3
+            { 0x8e, order::cab }, // 0xd4
+            { 0x8f, order::cab }, // 0xd5
+            { 0x9e, order::cab }, // 0xd6
+            { 0x9f, order::cab }, // 0xd7
+            { 0xac, order::cab }, // 0xd8
+            { 0xad, order::cab }, // 0xd9
+            { 0xbc, order::acb }, // 0xda
+            { 0xbd, order::acb }, // 0xdb
+            { 0xae, order::cab }, // 0xdc
+            { 0xaf, order::cab }, // 0xdd
+            { 0xbe, order::acb }, // 0xde
+            { 0xbf, order::acb }, // 0xdf
+            { 0xa8, order::bca }, // 0xe0
+            { 0xa9, order::bca }, // 0xe1
+            { 0xac, order::bca }, // 0xe2
+            { 0xad, order::bca }, // 0xe3
+            { 0xac, order::cba }, // 0xe4
+            { 0xad, order::cba }, // 0xe5
+            { 0xbc, order::bca }, // 0xe6
+            { 0xbd, order::bca }, // 0xe7
+            { 0xe8, order::abc }, // 0xe8
+            { 0xe9, order::abc }, // 0xe9
+            { 0xea, order::abc }, // 0xea
+            { 0xeb, order::abc }, // 0xeb
+            { 0xea, order::acb }, // 0xec
+            { 0xeb, order::acb }, // 0xed
+            { 0xee, order::abc }, // 0xee
+            { 0xef, order::abc }, // 0xef
+            { 0xaa, order::bca }, // 0xf0
+            { 0xab, order::bca }, // 0xf1
+            { 0xae, order::bca }, // 0xf2
+            { 0xaf, order::bca }, // 0xf3
+            { 0xae, order::cba }, // 0xf4
+            { 0xaf, order::cba }, // 0xf5
+            { 0xbe, order::bca }, // 0xf6
+            { 0xbf, order::bca }, // 0xf7
+            { 0xea, order::bca }, // 0xf8
+            { 0xeb, order::bca }, // 0xf9
+            { 0xee, order::bac }, // 0xfa
+            { 0xef, order::bac }, // 0xfb
+            { 0xee, order::cab }, // 0xfc
+            { 0xef, order::cab }, // 0xfd
+            { 0xfe, order::abc }, // 0xfe
+            { 0xff, order::abc }, // 0xff
+        };
+#ifdef TERNARYLOGIC_TESTS
+        static_assert(valid_reduction(reduced_x86_64), "invalid reduction of x86_64");
+#endif
+
+        template<typename T>
+        [[nodiscard]] constexpr T ternary_reduced(const T& a, const T& b, const T& c, const bf_type k) noexcept {
+            switch (k) {
+                case 0x00: return priv::ternary_intern<0x00>(a, b, c);
+                case 0x01: return priv::ternary_intern<0x01>(a, b, c);
+                case 0x02: return priv::ternary_intern<0x02>(a, b, c);
+                case 0x03: return priv::ternary_intern<0x03>(a, b, c);
+                case 0x04: return priv::ternary_intern<0x02>(a, c, b);
+                case 0x05: return priv::ternary_intern<0x03>(a, c, b);
+                case 0x06: return priv::ternary_intern<0x06>(a, b, c);
+                case 0x07: return priv::ternary_intern<0x07>(a, b, c);
+                case 0x08: return priv::ternary_intern<0x08>(a, b, c);
+                case 0x09: return priv::ternary_intern<0x09>(a, b, c);
+                case 0x0a: return priv::ternary_intern<0x0a>(a, b, c);
+                case 0x0b: return priv::ternary_intern<0x0b>(a, b, c);
+                case 0x0c: return priv::ternary_intern<0x0a>(a, c, b);
+                case 0x0d: return priv::ternary_intern<0x0b>(a, c, b);
+                case 0x0e: return priv::ternary_intern<0x0e>(a, b, c);
+                case 0x0f: return priv::ternary_intern<0x0f>(a, b, c);
+                case 0x10: return priv::ternary_intern<0x02>(b, c, a);
+                case 0x11: return priv::ternary_intern<0x03>(b, c, a);
+                case 0x12: return priv::ternary_intern<0x06>(b, a, c);
+                case 0x13: return priv::ternary_intern<0x07>(b, a, c);
+                case 0x14: return priv::ternary_intern<0x06>(c, a, b);
+                case 0x15: return priv::ternary_intern<0x07>(c, a, b);
+                case 0x16: return priv::ternary_intern<0x16>(a, b, c);
+                case 0x17: return priv::ternary_intern<0x17>(a, b, c);
+                case 0x18: return priv::ternary_intern<0x18>(a, b, c);
+                case 0x19: return priv::ternary_intern<0x19>(a, b, c);
+                case 0x1a: return priv::ternary_intern<0x1a>(a, b, c);
+                case 0x1b: return priv::ternary_intern<0x1b>(a, b, c);
+                case 0x1c: return priv::ternary_intern<0x1a>(a, c, b);
+                case 0x1d: return priv::ternary_intern<0x1b>(a, c, b);
+                case 0x1e: return priv::ternary_intern<0x1e>(a, b, c);
+                case 0x1f: return priv::ternary_intern<0x1f>(a, b, c);
+                case 0x20: return priv::ternary_intern<0x08>(b, a, c);
+                case 0x21: return priv::ternary_intern<0x09>(b, a, c);
+                case 0x22: return priv::ternary_intern<0x0a>(b, a, c);
+                case 0x23: return priv::ternary_intern<0x0b>(b, a, c);
+                case 0x24: return priv::ternary_intern<0x18>(b, a, c);
+                case 0x25: return priv::ternary_intern<0x19>(b, a, c);
+                case 0x26: return priv::ternary_intern<0x1a>(b, a, c);
+                case 0x27: return priv::ternary_intern<0x1b>(b, a, c);
+                case 0x28: return priv::ternary_intern<0x28>(a, b, c);
+                case 0x29: return priv::ternary_intern<0x29>(a, b, c);
+                case 0x2a: return priv::ternary_intern<0x2a>(a, b, c);
+                case 0x2b: return priv::ternary_intern<0x2b>(a, b, c);
+                case 0x2c: return priv::ternary_intern<0x2c>(a, b, c);
+                case 0x2d: return priv::ternary_intern<0x2d>(a, b, c);
+                case 0x2e: return priv::ternary_intern<0x2e>(a, b, c);
+                case 0x2f: return priv::ternary_intern<0x2f>(a, b, c);
+                case 0x30: return priv::ternary_intern<0x0a>(b, c, a);
+                case 0x31: return priv::ternary_intern<0x0b>(b, c, a);
+                case 0x32: return priv::ternary_intern<0x0e>(b, a, c);
+                case 0x33: return priv::ternary_intern<0x0f>(b, a, c);
+                case 0x34: return priv::ternary_intern<0x1a>(b, c, a);
+                case 0x35: return priv::ternary_intern<0x1b>(b, c, a);
+                case 0x36: return priv::ternary_intern<0x1e>(b, a, c);
+                case 0x37: return priv::ternary_intern<0x1f>(b, a, c);
+                case 0x38: return priv::ternary_intern<0x2c>(b, a, c);
+                case 0x39: return priv::ternary_intern<0x2d>(b, a, c);
+                case 0x3a: return priv::ternary_intern<0x2e>(b, a, c);
+                case 0x3b: return priv::ternary_intern<0x2f>(b, a, c);
+                case 0x3c: return priv::ternary_intern<0x3c>(a, b, c);
+                case 0x3d: return priv::ternary_intern<0x3d>(a, b, c);
+                case 0x3e: return priv::ternary_intern<0x3e>(a, b, c);
+                case 0x3f: return priv::ternary_intern<0x3f>(a, b, c);
+                case 0x40: return priv::ternary_intern<0x08>(c, a, b);
+                case 0x41: return priv::ternary_intern<0x09>(c, a, b);
+                case 0x42: return priv::ternary_intern<0x18>(c, a, b);
+                case 0x43: return priv::ternary_intern<0x19>(c, a, b);
+                case 0x44: return priv::ternary_intern<0x0a>(c, a, b);
+                case 0x45: return priv::ternary_intern<0x0b>(c, a, b);
+                case 0x46: return priv::ternary_intern<0x1a>(c, a, b);
+                case 0x47: return priv::ternary_intern<0x1b>(c, a, b);
+                case 0x48: return priv::ternary_intern<0x28>(a, c, b);
+                case 0x49: return priv::ternary_intern<0x29>(a, c, b);
+                case 0x4a: return priv::ternary_intern<0x2c>(a, c, b);
+                case 0x4b: return priv::ternary_intern<0x2d>(a, c, b);
+                case 0x4c: return priv::ternary_intern<0x2a>(a, c, b);
+                case 0x4d: return priv::ternary_intern<0x2b>(a, c, b);
+                case 0x4e: return priv::ternary_intern<0x2e>(a, c, b);
+                case 0x4f: return priv::ternary_intern<0x2f>(a, c, b);
+                case 0x50: return priv::ternary_intern<0x0a>(c, b, a);
+                case 0x51: return priv::ternary_intern<0x0b>(c, b, a);
+                case 0x52: return priv::ternary_intern<0x1a>(c, b, a);
+                case 0x53: return priv::ternary_intern<0x1b>(c, b, a);
+                case 0x54: return priv::ternary_intern<0x0e>(c, a, b);
+                case 0x55: return priv::ternary_intern<0x0f>(c, a, b);
+                case 0x56: return priv::ternary_intern<0x1e>(c, a, b);
+                case 0x57: return priv::ternary_intern<0x1f>(c, a, b);
+                case 0x58: return priv::ternary_intern<0x2c>(c, a, b);
+                case 0x59: return priv::ternary_intern<0x2d>(c, a, b);
+                case 0x5a: return priv::ternary_intern<0x3c>(a, c, b);
+                case 0x5b: return priv::ternary_intern<0x3d>(a, c, b);
+                case 0x5c: return priv::ternary_intern<0x2e>(c, a, b);
+                case 0x5d: return priv::ternary_intern<0x2f>(c, a, b);
+                case 0x5e: return priv::ternary_intern<0x3e>(a, c, b);
+                case 0x5f: return priv::ternary_intern<0x3f>(a, c, b);
+                case 0x60: return priv::ternary_intern<0x28>(b, c, a);
+                case 0x61: return priv::ternary_intern<0x29>(b, c, a);
+                case 0x62: return priv::ternary_intern<0x2c>(b, c, a);
+                case 0x63: return priv::ternary_intern<0x2d>(b, c, a);
+                case 0x64: return priv::ternary_intern<0x2c>(c, b, a);
+                case 0x65: return priv::ternary_intern<0x2d>(c, b, a);
+                case 0x66: return priv::ternary_intern<0x3c>(b, c, a);
+                case 0x67: return priv::ternary_intern<0x3d>(b, c, a);
+                case 0x68: return priv::ternary_intern<0x68>(a, b, c);
+                case 0x69: return priv::ternary_intern<0x69>(a, b, c);
+                case 0x6a: return priv::ternary_intern<0x6a>(a, b, c);
+                case 0x6b: return priv::ternary_intern<0x6b>(a, b, c);
+                case 0x6c: return priv::ternary_intern<0x6a>(a, c, b);
+                case 0x6d: return priv::ternary_intern<0x6b>(a, c, b);
+                case 0x6e: return priv::ternary_intern<0x6e>(a, b, c);
+                case 0x6f: return priv::ternary_intern<0x6f>(a, b, c);
+                case 0x70: return priv::ternary_intern<0x2a>(b, c, a);
+                case 0x71: return priv::ternary_intern<0x2b>(b, c, a);
+                case 0x72: return priv::ternary_intern<0x2e>(b, c, a);
+                case 0x73: return priv::ternary_intern<0x2f>(b, c, a);
+                case 0x74: return priv::ternary_intern<0x2e>(c, b, a);
+                case 0x75: return priv::ternary_intern<0x2f>(c, b, a);
+                case 0x76: return priv::ternary_intern<0x3e>(b, c, a);
+                case 0x77: return priv::ternary_intern<0x3f>(b, c, a);
+                case 0x78: return priv::ternary_intern<0x6a>(b, c, a);
+                case 0x79: return priv::ternary_intern<0x6b>(b, c, a);
+                case 0x7a: return priv::ternary_intern<0x6e>(b, a, c);
+                case 0x7b: return priv::ternary_intern<0x6f>(b, a, c);
+                case 0x7c: return priv::ternary_intern<0x6e>(c, a, b);
+                case 0x7d: return priv::ternary_intern<0x6f>(c, a, b);
+                case 0x7e: return priv::ternary_intern<0x7e>(a, b, c);
+                case 0x7f: return priv::ternary_intern<0x7f>(a, b, c);
+                case 0x80: return priv::ternary_intern<0x80>(a, b, c);
+                case 0x81: return priv::ternary_intern<0x81>(a, b, c);
+                case 0x82: return priv::ternary_intern<0x82>(a, b, c);
+                case 0x83: return priv::ternary_intern<0x83>(a, b, c);
+                case 0x84: return priv::ternary_intern<0x82>(a, c, b);
+                case 0x85: return priv::ternary_intern<0x83>(a, c, b);
+                case 0x86: return priv::ternary_intern<0x86>(a, b, c);
+                case 0x87: return priv::ternary_intern<0x87>(a, b, c);
+                case 0x88: return priv::ternary_intern<0x88>(a, b, c);
+                case 0x89: return priv::ternary_intern<0x89>(a, b, c);
+                case 0x8a: return priv::ternary_intern<0x8a>(a, b, c);
+                case 0x8b: return priv::ternary_intern<0x8b>(a, b, c);
+                case 0x8c: return priv::ternary_intern<0x8a>(a, c, b);
+                case 0x8d: return priv::ternary_intern<0x8b>(a, c, b);
+                case 0x8e: return priv::ternary_intern<0x8e>(a, b, c);
+                case 0x8f: return priv::ternary_intern<0x8f>(a, b, c);
+                case 0x90: return priv::ternary_intern<0x82>(b, c, a);
+                case 0x91: return priv::ternary_intern<0x83>(b, c, a);
+                case 0x92: return priv::ternary_intern<0x86>(b, a, c);
+                case 0x93: return priv::ternary_intern<0x87>(b, a, c);
+                case 0x94: return priv::ternary_intern<0x86>(c, a, b);
+                case 0x95: return priv::ternary_intern<0x87>(c, a, b);
+                case 0x96: return priv::ternary_intern<0x96>(a, b, c);
+                case 0x97: return priv::ternary_intern<0x97>(a, b, c);
+                case 0x98: return priv::ternary_intern<0x98>(a, b, c);
+                case 0x99: return priv::ternary_intern<0x99>(a, b, c);
+                case 0x9a: return priv::ternary_intern<0x9a>(a, b, c);
+                case 0x9b: return priv::ternary_intern<0x9b>(a, b, c);
+                case 0x9c: return priv::ternary_intern<0x9a>(a, c, b);
+                case 0x9d: return priv::ternary_intern<0x9b>(a, c, b);
+                case 0x9e: return priv::ternary_intern<0x9e>(a, b, c);
+                case 0x9f: return priv::ternary_intern<0x9f>(a, b, c);
+                case 0xa0: return priv::ternary_intern<0x88>(b, a, c);
+                case 0xa1: return priv::ternary_intern<0x89>(b, a, c);
+                case 0xa2: return priv::ternary_intern<0x8a>(b, a, c);
+                case 0xa3: return priv::ternary_intern<0x8b>(b, a, c);
+                case 0xa4: return priv::ternary_intern<0x98>(b, a, c);
+                case 0xa5: return priv::ternary_intern<0x99>(b, a, c);
+                case 0xa6: return priv::ternary_intern<0x9a>(b, a, c);
+                case 0xa7: return priv::ternary_intern<0x9b>(b, a, c);
+                case 0xa8: return priv::ternary_intern<0xa8>(a, b, c);
+                case 0xa9: return priv::ternary_intern<0xa9>(a, b, c);
+                case 0xaa: return priv::ternary_intern<0xaa>(a, b, c);
+                case 0xab: return priv::ternary_intern<0xab>(a, b, c);
+                case 0xac: return priv::ternary_intern<0xac>(a, b, c);
+                case 0xad: return priv::ternary_intern<0xad>(a, b, c);
+                case 0xae: return priv::ternary_intern<0xae>(a, b, c);
+                case 0xaf: return priv::ternary_intern<0xaf>(a, b, c);
+                case 0xb0: return priv::ternary_intern<0x8a>(b, c, a);
+                case 0xb1: return priv::ternary_intern<0x8b>(b, c, a);
+                case 0xb2: return priv::ternary_intern<0x8e>(b, a, c);
+                case 0xb3: return priv::ternary_intern<0x8f>(b, a, c);
+                case 0xb4: return priv::ternary_intern<0x9a>(b, c, a);
+                case 0xb5: return priv::ternary_intern<0x9b>(b, c, a);
+                case 0xb6: return priv::ternary_intern<0x9e>(b, a, c);
+                case 0xb7: return priv::ternary_intern<0x9f>(b, a, c);
+                case 0xb8: return priv::ternary_intern<0xac>(b, a, c);
+                case 0xb9: return priv::ternary_intern<0xad>(b, a, c);
+                case 0xba: return priv::ternary_intern<0xae>(b, a, c);
+                case 0xbb: return priv::ternary_intern<0xaf>(b, a, c);
+                case 0xbc: return priv::ternary_intern<0xbc>(a, b, c);
+                case 0xbd: return priv::ternary_intern<0xbd>(a, b, c);
+                case 0xbe: return priv::ternary_intern<0xbe>(a, b, c);
+                case 0xbf: return priv::ternary_intern<0xbf>(a, b, c);
+                case 0xc0: return priv::ternary_intern<0x88>(c, a, b);
+                case 0xc1: return priv::ternary_intern<0x89>(c, a, b);
+                case 0xc2: return priv::ternary_intern<0x98>(c, a, b);
+                case 0xc3: return priv::ternary_intern<0x99>(c, a, b);
+                case 0xc4: return priv::ternary_intern<0x8a>(c, a, b);
+                case 0xc5: return priv::ternary_intern<0x8b>(c, a, b);
+                case 0xc6: return priv::ternary_intern<0x9a>(c, a, b);
+                case 0xc7: return priv::ternary_intern<0x9b>(c, a, b);
+                case 0xc8: return priv::ternary_intern<0xa8>(a, c, b);
+                case 0xc9: return priv::ternary_intern<0xa9>(a, c, b);
+                case 0xca: return priv::ternary_intern<0xac>(a, c, b);
+                case 0xcb: return priv::ternary_intern<0xad>(a, c, b);
+                case 0xcc: return priv::ternary_intern<0xaa>(a, c, b);
+                case 0xcd: return priv::ternary_intern<0xab>(a, c, b);
+                case 0xce: return priv::ternary_intern<0xae>(a, c, b);
+                case 0xcf: return priv::ternary_intern<0xaf>(a, c, b);
+                case 0xd0: return priv::ternary_intern<0x8a>(c, b, a);
+                case 0xd1: return priv::ternary_intern<0x8b>(c, b, a);
+                case 0xd2: return priv::ternary_intern<0x9a>(c, b, a);
+                case 0xd3: return priv::ternary_intern<0x9b>(c, b, a);
+                case 0xd4: return priv::ternary_intern<0x8e>(c, a, b);
+                case 0xd5: return priv::ternary_intern<0x8f>(c, a, b);
+                case 0xd6: return priv::ternary_intern<0x9e>(c, a, b);
+                case 0xd7: return priv::ternary_intern<0x9f>(c, a, b);
+                case 0xd8: return priv::ternary_intern<0xac>(c, a, b);
+                case 0xd9: return priv::ternary_intern<0xad>(c, a, b);
+                case 0xda: return priv::ternary_intern<0xbc>(a, c, b);
+                case 0xdb: return priv::ternary_intern<0xbd>(a, c, b);
+                case 0xdc: return priv::ternary_intern<0xae>(c, a, b);
+                case 0xdd: return priv::ternary_intern<0xaf>(c, a, b);
+                case 0xde: return priv::ternary_intern<0xbe>(a, c, b);
+                case 0xdf: return priv::ternary_intern<0xbf>(a, c, b);
+                case 0xe0: return priv::ternary_intern<0xa8>(b, c, a);
+                case 0xe1: return priv::ternary_intern<0xa9>(b, c, a);
+                case 0xe2: return priv::ternary_intern<0xac>(b, c, a);
+                case 0xe3: return priv::ternary_intern<0xad>(b, c, a);
+                case 0xe4: return priv::ternary_intern<0xac>(c, b, a);
+                case 0xe5: return priv::ternary_intern<0xad>(c, b, a);
+                case 0xe6: return priv::ternary_intern<0xbc>(b, c, a);
+                case 0xe7: return priv::ternary_intern<0xbd>(b, c, a);
+                case 0xe8: return priv::ternary_intern<0xe8>(a, b, c);
+                case 0xe9: return priv::ternary_intern<0xe9>(a, b, c);
+                case 0xea: return priv::ternary_intern<0xea>(a, b, c);
+                case 0xeb: return priv::ternary_intern<0xeb>(a, b, c);
+                case 0xec: return priv::ternary_intern<0xea>(a, c, b);
+                case 0xed: return priv::ternary_intern<0xeb>(a, c, b);
+                case 0xee: return priv::ternary_intern<0xee>(a, b, c);
+                case 0xef: return priv::ternary_intern<0xef>(a, b, c);
+                case 0xf0: return priv::ternary_intern<0xaa>(b, c, a);
+                case 0xf1: return priv::ternary_intern<0xab>(b, c, a);
+                case 0xf2: return priv::ternary_intern<0xae>(b, c, a);
+                case 0xf3: return priv::ternary_intern<0xaf>(b, c, a);
+                case 0xf4: return priv::ternary_intern<0xae>(c, b, a);
+                case 0xf5: return priv::ternary_intern<0xaf>(c, b, a);
+                case 0xf6: return priv::ternary_intern<0xbe>(b, c, a);
+                case 0xf7: return priv::ternary_intern<0xbf>(b, c, a);
+                case 0xf8: return priv::ternary_intern<0xea>(b, c, a);
+                case 0xf9: return priv::ternary_intern<0xeb>(b, c, a);
+                case 0xfa: return priv::ternary_intern<0xee>(b, a, c);
+                case 0xfb: return priv::ternary_intern<0xef>(b, a, c);
+                case 0xfc: return priv::ternary_intern<0xee>(c, a, b);
+                case 0xfd: return priv::ternary_intern<0xef>(c, a, b);
+                case 0xfe: return priv::ternary_intern<0xfe>(a, b, c);
+                case 0xff: return priv::ternary_intern<0xff>(a, b, c);
+                default: return priv::ternary_intern<0>(a, b, c);
+            }
+        }
+
+#ifdef TERNARYLOGIC_BMI
+        // kernels of ternary_x86_64_bmi.cpp
+        constexpr reduction reduced_x86_64_bmi[256] = {
+            { 0x00, order::abc }, // 0x00
+            { 0x01, order::abc }, // 0x01
+            { 0x02, order::abc }, // 0x02
+            { 0x03, order::abc }, // 0x03
+            { 0x02, order::acb }, // 0x04
+            { 0x03, order::acb }, // 0x05
+            { 0x06, order::abc }, // 0x06
+            { 0x07, order::abc }, // 0x07
+            { 0x08, order::abc }, // 0x08
+            { 0x09, order::abc }, // 0x09
+            { 0x0a, order::abc }, // 0x0a
+            { 0x0b, order::abc }, // 0x0b
+            { 0x0a, order::acb }, // 0x0c
+            { 0x0b, order::acb }, // 0x0d
+            { 0x0e, order::abc }, // 0x0e
+            { 0x0f, order::abc }, // 0x0f
+            { 0x02, order::bca }, // 0x10
+            { 0x03, order::bca }, // 0x11
+            { 0x06, order::bac }, // 0x12
+            { 0x07, order::bac }, // 0x13
+            { 0x06, order::cab }, // 0x14
+            { 0x07, order::cab }, // 0x15
+            { 0x16, order::abc }, // 0x16
+            { 0x17, order::abc }, // 0x17
+            { 0x18, order::abc }, // 0x18
+            { 0x19, order::abc }, // 0x19
+            { 0x1a, order::abc }, // 0x1a
+            { 0x1b, order::abc }, // 0x1b
+            { 0x1a, order::acb }, // 0x1c
+            { 0x1b, order::acb }, // 0x1d
+            { 0x1e, order::abc }, // 0x1e
+            { 0x1f, order::abc }, // 0x1f
+            { 0x08, order::bac }, // 0x20
+            { 0x09, order::bac }, // 0x21
+            { 0x0a, order::bac }, // 0x22
+            { 0x0b, order::bac }, // 0x23
+            { 0x18, order::bac }, // 0x24
+            { 0x19, order::bac }, // 0x25
+            { 0x1a, order::bac }, // 0x26
+            { 0x1b, order::bac }, // 0x27
+            { 0x28, order::abc }, // 0x28
+            { 0x29, order::abc }, // 0x29
+            { 0x2a, order::abc }, // 0x2a
+            { 0x2b, order::abc }, // 0x2b
+            { 0x2c, order::abc }, // 0x2c
+            { 0x2d, order::abc }, // 0x2d
+            { 0x2e, order::abc }, // 0x2e
+            { 0x2f, order::abc }, // 0x2f
+            { 0x0a, order::bca }, // 0x30
+            { 0x0b, order::bca }, // 0x31
+            { 0x0e, order::bac }, // 0x32
+            { 0x0f, order::bac }, // 0x33
+            { 0x1a, order::bca }, // 0x34
+            { 0x1b, order::bca }, // 0x35
+            { 0x1e, order::bac }, // 0x36
+            { 0x1f, order::bac }, // 0x37
+            { 0x2c, order::bac }, // 0x38
+            { 0x2d, order::bac }, // 0x39
+            { 0x2e, order::bac }, // 0x3a
+            { 0x2f, order::bac }, // 0x3b
+            { 0x3c, order::abc }, // 0x3c
+            { 0x3d, order::abc }, // 0x3d
+            { 0x3e, order::abc }, // 0x3e
+            { 0x3f, order::abc }, // 0x3f
+            { 0x08, order::cab }, // 0x40
+            { 0x09, order::cab }, // 0x41
+            { 0x18, order::cab }, // 0x42
+            { 0x19, order::cab }, // 0x43
+            { 0x0a, order::cab }, // 0x44
+            { 0x0b, order::cab }, // 0x45
+            { 0x1a, order::cab }, // 0x46
+            { 0x1b, order::cab }, // 0x47
+            { 0x28, order::acb }, // 0x48
+            { 0x29, order::acb }, // 0x49
+            { 0x2c, order::acb }, // 0x4a
+            { 0x2d, order::acb }, // 0x4b
+            { 0x2a, order::acb }, // 0x4c
+            { 0x2b, order::acb }, // 0x4d
+            { 0x2e, order::acb }, // 0x4e
+            { 0x2f, order::acb }, // 0x4f
+            { 0x0a, order::cba }, // 0x50
+            { 0x0b, order::cba }, // 0x51
+            { 0x1a, order::cba }, // 0x52
+            { 0x1b, order::cba }, // 0x53
+            { 0x0e, order::cab }, // 0x54
+            { 0x0f, order::cab }, // 0x55
+            { 0x1e, order::cab }, // 0x56
+            { 0x1f, order::cab }, // 0x57
+            { 0x2c, order::cab }, // 0x58
+            { 0x2d, order::cab }, // 0x59
+            { 0x3c, order::acb }, // 0x5a
+            { 0x3d, order::acb }, // 0x5b
+            { 0x2e, order::cab }, // 0x5c
+            { 0x2f, order::cab }, // 0x5d
+            { 0x3e, order::acb }, // 0x5e
+            { 0x3f, order::acb }, // 0x5f
+            { 0x28, order::bca }, // 0x60
+            { 0x29, order::bca }, // 0x61
+            { 0x2c, order::bca }, // 0x62
+            { 0x2d, order::bca }, // 0x63
+            { 0x2c, order::cba }, // 0x64
+            { 0x2d, order::cba }, // 0x65
+            { 0x3c, order::bca }, // 0x66
+            { 0x3d, order::bca }, // 0x67
+            { 0x68, order::abc }, // 0x68
+            { 0x69, order::abc }, // 0x69
+            { 0x6a, order::abc }, // 0x6a
+            { 0x6b, order::abc }, // 0x6b
+            { 0x6a, order::acb }, // 0x6c
+            { 0x6b, order::acb }, // 0x6d
+            { 0x6e, order::abc }, // 0x6e
+            { 0x6f, order::abc }, // 0x6f
+            { 0x2a, order::bca }, // 0x70
+            { 0x2b, order::bca }, // 0x71
+            { 0x2e, order::bca }, // 0x72
+            { 0x2f, order::bca }, // 0x73
+            { 0x2e, order::cba }, // 0x74
+            { 0x2f, order::cba }, // 0x75
+            { 0x3e, order::bca }, // 0x76
+            { 0x3f, order::bca }, // 0x77
+            { 0x6a, order::bca }, // 0x78
+            { 0x6b, order::bca }, // 0x79
+            { 0x6e, order::bac }, // 0x7a
+            { 0x6f, order::bac }, // 0x7b
+            { 0x6e, order::cab }, // 0x7c
+            { 0x6f, order::cab }, // 0x7d
+            { 0x7e, order::abc }, // 0x7e
+            { 0x7f, order::abc }, // 0x7f
+            { 0x80, order::abc }, // 0x80
+            { 0x81, order::abc }, // 0x81
+            { 0x82, order::abc }, // 0x82
+            { 0x83, order::abc }, // 0x83
+            { 0x82, order::acb }, // 0x84
+            { 0x83, order::acb }, // 0x85
+            { 0x86, order::abc }, // 0x86
+            { 0x87, order::abc }, // 0x87
+            { 0x88, order::abc }, // 0x88
+            { 0x89, order::abc }, // 0x89
+            { 0x8a, order::abc }, // 0x8a
+            { 0x8b, order::abc }, // 0x8b
+            { 0x8a, order::acb }, // 0x8c
+            { 0x8b, order::acb }, // 0x8d
+            { 0x8e, order::abc }, // 0x8e
+            { 0x8f, order::abc }, // 0x8f
+            { 0x82, order::bca }, // 0x90
+            { 0x83, order::bca }, // 0x91
+            { 0x86, order::bac }, // 0x92
+            { 0x87, order::bac }, // 0x93
+            { 0x86, order::cab }, // 0x94
+            { 0x87, order::cab }, // 0x95
+            { 0x96, order::abc }, // 0x96
+            { 0x97, order::abc }, // 0x97
+            { 0x98, order::abc }, // 0x98
+            { 0x99, order::abc }, // 0x99
+            { 0x9a, order::abc }, // 0x9a
+            { 0x9b, order::abc }, // 0x9b
+            { 0x9a, order::acb }, // 0x9c
+            { 0x9b, order::acb }, // 0x9d
+            { 0x9e, order::abc }, // 0x9e
+            { 0x9f, order::abc }, // 0x9f
+            { 0x88, order::bac }, // 0xa0
+            { 0x89, order::bac }, // 0xa1
+            { 0x8a, order::bac }, // 0xa2
+            { 0x8b, order::bac }, // 0xa3
+            { 0x98, order::bac }, // 0xa4
+            { 0x99, order::bac }, // 0xa5
+            { 0x9a, order::bac }, // 0xa6
+            { 0x9b, order::bac }, // 0xa7
+            { 0xa8, order::abc }, // 0xa8
+            { 0xa9, order::abc }, // 0xa9
+            { 0xaa, order::abc }, // 0xaa
+            { 0xab, order::abc }, // 0xab
+            { 0xac, order::abc }, // 0xac
+            { 0xad, order::abc }, // 0xad
+            { 0xae, order::abc }, // 0xae
+            { 0xaf, order::abc }, // 0xaf
+            { 0x8a, order::bca }, // 0xb0
+            { 0x8b, order::bca }, // 0xb1
+            { 0x8e, order::bac }, // 0xb2
+            { 0x8f, order::bac }, // 0xb3
+            { 0x9a, order::bca }, // 0xb4
+            { 0x9b, order::bca }, // 0xb5
+            { 0x9e, order::bac }, // 0xb6
+            { 0x9f, order::bac }, // 0xb7
+            { 0xac, order::bac }, // 0xb8
+            { 0xad, order::bac }, // 0xb9
+            { 0xae, order::bac }, // 0xba
+            { 0xaf, order::bac }, // 0xbb
+            { 0xbc, order::abc }, // 0xbc
+            { 0xbd, order::abc }, // 0xbd
+            { 0xbe, order::abc }, // 0xbe
+            { 0xbf, order::abc }, // 0xbf
+            { 0x88, order::cab }, // 0xc0
+            { 0x89, order::cab }, // 0xc1
+            { 0x98, order::cab }, // 0xc2
+            { 0x99, order::cab }, // 0xc3
+            { 0x8a, order::cab }, // 0xc4
+            { 0x8b, order::cab }, // 0xc5
+            { 0x9a, order::cab }, // 0xc6
+            { 0x9b, order::cab }, // 0xc7
+            { 0xa8, order::acb }, // 0xc8
+            { 0xa9, order::acb }, // 0xc9
+            { 0xac, order::acb }, // 0xca
+            { 0xad, order::acb }, // 0xcb
+            { 0xaa, order::acb }, // 0xcc
+            { 0xab, order::acb }, // 0xcd
+            { 0xae, order::acb }, // 0xce
+            { 0xaf, order::acb }, // 0xcf
+            { 0x8a, order::cba }, // 0xd0
+            { 0x8b, order::cba }, // 0xd1
+            { 0x9a, order::cba }, // 0xd2
+            { 0x9b, order::cba }, // 0xd3
+            { 0x8e, order::cab }, // 0xd4
+            { 0x8f, order::cab }, // 0xd5
+            { 0x9e, order::cab }, // 0xd6
+            { 0x9f, order::cab }, // 0xd7
+            { 0xac, order::cab }, // 0xd8
+            { 0xad, order::cab }, // 0xd9
+            { 0xbc, order::acb }, // 0xda
+            { 0xbd, order::acb }, // 0xdb
+            { 0xae, order::cab }, // 0xdc
+            { 0xaf, order::cab }, // 0xdd
+            { 0xbe, order::acb }, // 0xde
+            { 0xbf, order::acb }, // 0xdf
+            { 0xa8, order::bca }, // 0xe0
+            { 0xa9, order::bca }, // 0xe1
+            { 0xac, order::bca }, // 0xe2
+            { 0xad, order::bca }, // 0xe3
+            { 0xac, order::cba }, // 0xe4
+            { 0xad, order::cba }, // 0xe5
+            { 0xbc, order::bca }, // 0xe6
+            { 0xbd, order::bca }, // 0xe7
+            { 0xe8, order::abc }, // 0xe8
+            { 0xe9, order::abc }, // 0xe9
+            { 0xea, order::abc }, // 0xea
+            { 0xeb, order::abc }, // 0xeb
+            { 0xea, order::acb }, // 0xec
+            { 0xeb, order::acb }, // 0xed
+            { 0xee, order::abc }, // 0xee
+            { 0xef, order::abc }, // 0xef
+            { 0xaa, order::bca }, // 0xf0
+            { 0xab, order::bca }, // 0xf1
+            { 0xae, order::bca }, // 0xf2
+            { 0xaf, order::bca }, // 0xf3
+            { 0xae, order::cba }, // 0xf4
+            { 0xaf, order::cba }, // 0xf5
+            { 0xbe, order::bca }, // 0xf6
+            { 0xbf, order::bca }, // 0xf7
+            { 0xea, order::bca }, // 0xf8
+            { 0xeb, order::bca }, // 0xf9
+            { 0xee, order::bac }, // 0xfa
+            { 0xef, order::bac }, // 0xfb
+            { 0xee, order::cab }, // 0xfc
+            { 0xef, order::cab }, // 0xfd
+            { 0xfe, order::abc }, // 0xfe
+            { 0xff, order::abc }, // 0xff
+        };
+#ifdef TERNARYLOGIC_TESTS
+        static_assert(valid_reduction(reduced_x86_64_bmi), "invalid reduction of x86_64_bmi");
+#endif
+
+        template<>
+        [[nodiscard]] constexpr uint64_t ternary_reduced<uint64_t>(const uint64_t& a, const uint64_t& b, const uint64_t& c, const bf_type k) noexcept {
+            switch (k) {
+                case 0x00: return priv::ternary_intern<0x00>(a, b, c);
+                case 0x01: return priv::ternary_intern<0x01>(a, b, c);
+                case 0x02: return priv::ternary_intern<0x02>(a, b, c);
+                case 0x03: return priv::ternary_intern<0x03>(a, b, c);
+                case 0x04: return priv::ternary_intern<0x02>(a, c, b);
+                case 0x05: return priv::ternary_intern<0x03>(a, c, b);
+                case 0x06: return priv::ternary_intern<0x06>(a, b, c);
+                case 0x07: return priv::ternary_intern<0x07>(a, b, c);
+                case 0x08: return priv::ternary_intern<0x08>(a, b, c);
+                case 0x09: return priv::ternary_intern<0x09>(a, b, c);
+                case 0x0a: return priv::ternary_intern<0x0a>(a, b, c);
+                case 0x0b: return priv::ternary_intern<0x0b>(a, b, c);
+                case 0x0c: return priv::ternary_intern<0x0a>(a, c, b);
+                case 0x0d: return priv::ternary_intern<0x0b>(a, c, b);
+                case 0x0e: return priv::ternary_intern<0x0e>(a, b, c);
+                case 0x0f: return priv::ternary_intern<0x0f>(a, b, c);
+                case 0x10: return priv::ternary_intern<0x02>(b, c, a);
+                case 0x11: return priv::ternary_intern<0x03>(b, c, a);
+                case 0x12: return priv::ternary_intern<0x06>(b, a, c);
+                case 0x13: return priv::ternary_intern<0x07>(b, a, c);
+                case 0x14: return priv::ternary_intern<0x06>(c, a, b);
+                case 0x15: return priv::ternary_intern<0x07>(c, a, b);
+                case 0x16: return priv::ternary_intern<0x16>(a, b, c);
+                case 0x17: return priv::ternary_intern<0x17>(a, b, c);
+                case 0x18: return priv::ternary_intern<0x18>(a, b, c);
+                case 0x19: return priv::ternary_intern<0x19>(a, b, c);
+                case 0x1a: return priv::ternary_intern<0x1a>(a, b, c);
+                case 0x1b: return priv::ternary_intern<0x1b>(a, b, c);
+                case 0x1c: return priv::ternary_intern<0x1a>(a, c, b);
+                case 0x1d: return priv::ternary_intern<0x1b>(a, c, b);
+                case 0x1e: return priv::ternary_intern<0x1e>(a, b, c);
+                case 0x1f: return priv::ternary_intern<0x1f>(a, b, c);
+                case 0x20: return priv::ternary_intern<0x08>(b, a, c);
+                case 0x21: return priv::ternary_intern<0x09>(b, a, c);
+                case 0x22: return priv::ternary_intern<0x0a>(b, a, c);
+                case 0x23: return priv::ternary_intern<0x0b>(b, a, c);
+                case 0x24: return priv::ternary_intern<0x18>(b, a, c);
+                case 0x25: return priv::ternary_intern<0x19>(b, a, c);
+                case 0x26: return priv::ternary_intern<0x1a>(b, a, c);
+                case 0x27: return priv::ternary_intern<0x1b>(b, a, c);
+                case 0x28: return priv::ternary_intern<0x28>(a, b, c);
+                case 0x29: return priv::ternary_intern<0x29>(a, b, c);
+                case 0x2a: return priv::ternary_intern<0x2a>(a, b, c);
+                case 0x2b: return priv::ternary_intern<0x2b>(a, b, c);
+                case 0x2c: return priv::ternary_intern<0x2c>(a, b, c);
+                case 0x2d: return priv::ternary_intern<0x2d>(a, b, c);
+                case 0x2e: return priv::ternary_intern<0x2e>(a, b, c);
+                case 0x2f: return priv::ternary_intern<0x2f>(a, b, c);
+                case 0x30: return priv::ternary_intern<0x0a>(b, c, a);
+                case 0x31: return priv::ternary_intern<0x0b>(b, c, a);
+                case 0x32: return priv::ternary_intern<0x0e>(b, a, c);
+                case 0x33: return priv::ternary_intern<0x0f>(b, a, c);
+                case 0x34: return priv::ternary_intern<0x1a>(b, c, a);
+                case 0x35: return priv::ternary_intern<0x1b>(b, c, a);
+                case 0x36: return priv::ternary_intern<0x1e>(b, a, c);
+                case 0x37: return priv::ternary_intern<0x1f>(b, a, c);
+                case 0x38: return priv::ternary_intern<0x2c>(b, a, c);
+                case 0x39: return priv::ternary_intern<0x2d>(b, a, c);
+                case 0x3a: return priv::ternary_intern<0x2e>(b, a, c);
+                case 0x3b: return priv::ternary_intern<0x2f>(b, a, c);
+                case 0x3c: return priv::ternary_intern<0x3c>(a, b, c);
+                case 0x3d: return priv::ternary_intern<0x3d>(a, b, c);
+                case 0x3e: return priv::ternary_intern<0x3e>(a, b, c);
+                case 0x3f: return priv::ternary_intern<0x3f>(a, b, c);
+                case 0x40: return priv::ternary_intern<0x08>(c, a, b);
+                case 0x41: return priv::ternary_intern<0x09>(c, a, b);
+                case 0x42: return priv::ternary_intern<0x18>(c, a, b);
+                case 0x43: return priv::ternary_intern<0x19>(c, a, b);
+                case 0x44: return priv::ternary_intern<0x0a>(c, a, b);
+                case 0x45: return priv::ternary_intern<0x0b>(c, a, b);
+                case 0x46: return priv::ternary_intern<0x1a>(c, a, b);
+                case 0x47: return priv::ternary_intern<0x1b>(c, a, b);
+                case 0x48: return priv::ternary_intern<0x28>(a, c, b);
+                case 0x49: return priv::ternary_intern<0x29>(a, c, b);
+                case 0x4a: return priv::ternary_intern<0x2c>(a, c, b);
+                case 0x4b: return priv::ternary_intern<0x2d>(a, c, b);
+                case 0x4c: return priv::ternary_intern<0x2a>(a, c, b);
+                case 0x4d: return priv::ternary_intern<0x2b>(a, c, b);
+                case 0x4e: return priv::ternary_intern<0x2e>(a, c, b);
+                case 0x4f: return priv::ternary_intern<0x2f>(a, c, b);
+                case 0x50: return priv::ternary_intern<0x0a>(c, b, a);
+                case 0x51: return priv::ternary_intern<0x0b>(c, b, a);
+                case 0x52: return priv::ternary_intern<0x1a>(c, b, a);
+                case 0x53: return priv::ternary_intern<0x1b>(c, b, a);
+                case 0x54: return priv::ternary_intern<0x0e>(c, a, b);
+                case 0x55: return priv::ternary_intern<0x0f>(c, a, b);
+                case 0x56: return priv::ternary_intern<0x1e>(c, a, b);
+                case 0x57: return priv::ternary_intern<0x1f>(c, a, b);
+                case 0x58: return priv::ternary_intern<0x2c>(c, a, b);
+                case 0x59: return priv::ternary_intern<0x2d>(c, a, b);
+                case 0x5a: return priv::ternary_intern<0x3c>(a, c, b);
+                case 0x5b: return priv::ternary_intern<0x3d>(a, c, b);
+                case 0x5c: return priv::ternary_intern<0x2e>(c, a, b);
+                case 0x5d: return priv::ternary_intern<0x2f>(c, a, b);
+                case 0x5e: return priv::ternary_intern<0x3e>(a, c, b);
+                case 0x5f: return priv::ternary_intern<0x3f>(a, c, b);
+                case 0x60: return priv::ternary_intern<0x28>(b, c, a);
+                case 0x61: return priv::ternary_intern<0x29>(b, c, a);
+                case 0x62: return priv::ternary_intern<0x2c>(b, c, a);
+                case 0x63: return priv::ternary_intern<0x2d>(b, c, a);
+                case 0x64: return priv::ternary_intern<0x2c>(c, b, a);
+                case 0x65: return priv::ternary_intern<0x2d>(c, b, a);
+                case 0x66: return priv::ternary_intern<0x3c>(b, c, a);
+                case 0x67: return priv::ternary_intern<0x3d>(b, c, a);
+                case 0x68: return priv::ternary_intern<0x68>(a, b, c);
+                case 0x69: return priv::ternary_intern<0x69>(a, b, c);
+                case 0x6a: return priv::ternary_intern<0x6a>(a, b, c);
+                case 0x6b: return priv::ternary_intern<0x6b>(a, b, c);
+                case 0x6c: return priv::ternary_intern<0x6a>(a, c, b);
+                case 0x6d: return priv::ternary_intern<0x6b>(a, c, b);
+                case 0x6e: return priv::ternary_intern<0x6e>(a, b, c);
+                case 0x6f: return priv::ternary_intern<0x6f>(a, b, c);
+                case 0x70: return priv::ternary_intern<0x2a>(b, c, a);
+                case 0x71: return priv::ternary_intern<0x2b>(b, c, a);
+                case 0x72: return priv::ternary_intern<0x2e>(b, c, a);
+                case 0x73: return priv::ternary_intern<0x2f>(b, c, a);
+                case 0x74: return priv::ternary_intern<0x2e>(c, b, a);
+                case 0x75: return priv::ternary_intern<0x2f>(c, b, a);
+                case 0x76: return priv::ternary_intern<0x3e>(b, c, a);
+                case 0x77: return priv::ternary_intern<0x3f>(b, c, a);
+                case 0x78: return priv::ternary_intern<0x6a>(b, c, a);
+                case 0x79: return priv::ternary_intern<0x6b>(b, c, a);
+                case 0x7a: return priv::ternary_intern<0x6e>(b, a, c);
+                case 0x7b: return priv::ternary_intern<0x6f>(b, a, c);
+                case 0x7c: return priv::ternary_intern<0x6e>(c, a, b);
+                case 0x7d: return priv::ternary_intern<0x6f>(c, a, b);
+                case 0x7e: return priv::ternary_intern<0x7e>(a, b, c);
+                case 0x7f: return priv::ternary_intern<0x7f>(a, b, c);
+                case 0x80: return priv::ternary_intern<0x80>(a, b, c);
+                case 0x81: return priv::ternary_intern<0x81>(a, b, c);
+                case 0x82: return priv::ternary_intern<0x82>(a, b, c);
+                case 0x83: return priv::ternary_intern<0x83>(a, b, c);
+                case 0x84: return priv::ternary_intern<0x82>(a, c, b);
+                case 0x85: return priv::ternary_intern<0x83>(a, c, b);
+                case 0x86: return priv::ternary_intern<0x86>(a, b, c);
+                case 0x87: return priv::ternary_intern<0x87>(a, b, c);
+                case 0x88: return priv::ternary_intern<0x88>(a, b, c);
+                case 0x89: return priv::ternary_intern<0x89>(a, b, c);
+                case 0x8a: return priv::ternary_intern<0x8a>(a, b, c);
+                case 0x8b: return priv::ternary_intern<0x8b>(a, b, c);
+                case 0x8c: return priv::ternary_intern<0x8a>(a, c, b);
+                case 0x8d: return priv::ternary_intern<0x8b>(a, c, b);
+                case 0x8e: return priv::ternary_intern<0x8e>(a, b, c);
+                case 0x8f: return priv::ternary_intern<0x8f>(a, b, c);
+                case 0x90: return priv::ternary_intern<0x82>(b, c, a);
+                case 0x91: return priv::ternary_intern<0x83>(b, c, a);
+                case 0x92: return priv::ternary_intern<0x86>(b, a, c);
+                case 0x93: return priv::ternary_intern<0x87>(b, a, c);
+                case 0x94: return priv::ternary_intern<0x86>(c, a, b);
+                case 0x95: return priv::ternary_intern<0x87>(c, a, b);
+                case 0x96: return priv::ternary_intern<0x96>(a, b, c);
+                case 0x97: return priv::ternary_intern<0x97>(a, b, c);
+                case 0x98: return priv::ternary_intern<0x98>(a, b, c);
+                case 0x99: return priv::ternary_intern<0x99>(a, b, c);
+                case 0x9a: return priv::ternary_intern<0x9a>(a, b, c);
+                case 0x9b: return priv::ternary_intern<0x9b>(a, b, c);
+                case 0x9c: return priv::ternary_intern<0x9a>(a, c, b);
+                case 0x9d: return priv::ternary_intern<0x9b>(a, c, b);
+                case 0x9e: return priv::ternary_intern<0x9e>(a, b, c);
+                case 0x9f: return priv::ternary_intern<0x9f>(a, b, c);
+                case 0xa0: return priv::ternary_intern<0x88>(b, a, c);
+                case 0xa1: return priv::ternary_intern<0x89>(b, a, c);
+                case 0xa2: return priv::ternary_intern<0x8a>(b, a, c);
+                case 0xa3: return priv::ternary_intern<0x8b>(b, a, c);
+                case 0xa4: return priv::ternary_intern<0x98>(b, a, c);
+                case 0xa5: return priv::ternary_intern<0x99>(b, a, c);
+                case 0xa6: return priv::ternary_intern<0x9a>(b, a, c);
+                case 0xa7: return priv::ternary_intern<0x9b>(b, a, c);
+                case 0xa8: return priv::ternary_intern<0xa8>(a, b, c);
+                case 0xa9: return priv::ternary_intern<0xa9>(a, b, c);
+                case 0xaa: return priv::ternary_intern<0xaa>(a, b, c);
+                case 0xab: return priv::ternary_intern<0xab>(a, b, c);
+                case 0xac: return priv::ternary_intern<0xac>(a, b, c);
+                case 0xad: return priv::ternary_intern<0xad>(a, b, c);
+                case 0xae: return priv::ternary_intern<0xae>(a, b, c);
+                case 0xaf: return priv::ternary_intern<0xaf>(a, b, c);
+                case 0xb0: return priv::ternary_intern<0x8a>(b, c, a);
+                case 0xb1: return priv::ternary_intern<0x8b>(b, c, a);
+                case 0xb2: return priv::ternary_intern<0x8e>(b, a, c);
+                case 0xb3: return priv::ternary_intern<0x8f>(b, a, c);
+                case 0xb4: return priv::ternary_intern<0x9a>(b, c, a);
+                case 0xb5: return priv::ternary_intern<0x9b>(b, c, a);
+                case 0xb6: return priv::ternary_intern<0x9e>(b, a, c);
+                case 0xb7: return priv::ternary_intern<0x9f>(b, a, c);
+                case 0xb8: return priv::ternary_intern<0xac>(b, a, c);
+                case 0xb9: return priv::ternary_intern<0xad>(b, a, c);
+                case 0xba: return priv::ternary_intern<0xae>(b, a, c);
+                case 0xbb: return priv::ternary_intern<0xaf>(b, a, c);
+                case 0xbc: return priv::ternary_intern<0xbc>(a, b, c);
+                case 0xbd: return priv::ternary_intern<0xbd>(a, b, c);
+                case 0xbe: return priv::ternary_intern<0xbe>(a, b, c);
+                case 0xbf: return priv::ternary_intern<0xbf>(a, b, c);
+                case 0xc0: return priv::ternary_intern<0x88>(c, a, b);
+                case 0xc1: return priv::ternary_intern<0x89>(c, a, b);
+                case 0xc2: return priv::ternary_intern<0x98>(c, a, b);
+                case 0xc3: return priv::ternary_intern<0x99>(c, a, b);
+                case 0xc4: return priv::ternary_intern<0x8a>(c, a, b);
+                case 0xc5: return priv::ternary_intern<0x8b>(c, a, b);
+                case 0xc6: return priv::ternary_intern<0x9a>(c, a, b);
+                case 0xc7: return priv::ternary_intern<0x9b>(c, a, b);
+                case 0xc8: return priv::ternary_intern<0xa8>(a, c, b);
+                case 0xc9: return priv::ternary_intern<0xa9>(a, c, b);
+                case 0xca: return priv::ternary_intern<0xac>(a, c, b);
+                case 0xcb: return priv::ternary_intern<0xad>(a, c, b);
+                case 0xcc: return priv::ternary_intern<0xaa>(a, c, b);
+                case 0xcd: return priv::ternary_intern<0xab>(a, c, b);
+                case 0xce: return priv::ternary_intern<0xae>(a, c, b);
+                case 0xcf: return priv::ternary_intern<0xaf>(a, c, b);
+                case 0xd0: return priv::ternary_intern<0x8a>(c, b, a);
+                case 0xd1: return priv::ternary_intern<0x8b>(c, b, a);
+                case 0xd2: return priv::ternary_intern<0x9a>(c, b, a);
+                case 0xd3: return priv::ternary_intern<0x9b>(c, b, a);
+                case 0xd4: return priv::ternary_intern<0x8e>(c, a, b);
+                case 0xd5: return priv::ternary_intern<0x8f>(c, a, b);
+                case 0xd6: return priv::ternary_intern<0x9e>(c, a, b);
+                case 0xd7: return priv::ternary_intern<0x9f>(c, a, b);
+                case 0xd8: return priv::ternary_intern<0xac>(c, a, b);
+                case 0xd9: return priv::ternary_intern<0xad>(c, a, b);
+                case 0xda: return priv::ternary_intern<0xbc>(a, c, b);
+                case 0xdb: return priv::ternary_intern<0xbd>(a, c, b);
+                case 0xdc: return priv::ternary_intern<0xae>(c, a, b);
+                case 0xdd: return priv::ternary_intern<0xaf>(c, a, b);
+                case 0xde: return priv::ternary_intern<0xbe>(a, c, b);
+                case 0xdf: return priv::ternary_intern<0xbf>(a, c, b);
+                case 0xe0: return priv::ternary_intern<0xa8>(b, c, a);
+                case 0xe1: return priv::ternary_intern<0xa9>(b, c, a);
+                case 0xe2: return priv::ternary_intern<0xac>(b, c, a);
+                case 0xe3: return priv::ternary_intern<0xad>(b, c, a);
+                case 0xe4: return priv::ternary_intern<0xac>(c, b, a);
+                case 0xe5: return priv::ternary_intern<0xad>(c, b, a);
+                case 0xe6: return priv::ternary_intern<0xbc>(b, c, a);
+                case 0xe7: return priv::ternary_intern<0xbd>(b, c, a);
+                case 0xe8: return priv::ternary_intern<0xe8>(a, b, c);
+                case 0xe9: return priv::ternary_intern<0xe9>(a, b, c);
+                case 0xea: return priv::ternary_intern<0xea>(a, b, c);
+                case 0xeb: return priv::ternary_intern<0xeb>(a, b, c);
+                case 0xec: return priv::ternary_intern<0xea>(a, c, b);
+                case 0xed: return priv::ternary_intern<0xeb>(a, c, b);
+                case 0xee: return priv::ternary_intern<0xee>(a, b, c);
+                case 0xef: return priv::ternary_intern<0xef>(a, b, c);
+                case 0xf0: return priv::ternary_intern<0xaa>(b, c, a);
+                case 0xf1: return priv::ternary_intern<0xab>(b, c, a);
+                case 0xf2: return priv::ternary_intern<0xae>(b, c, a);
+                case 0xf3: return priv::ternary_intern<0xaf>(b, c, a);
+                case 0xf4: return priv::ternary_intern<0xae>(c, b, a);
+                case 0xf5: return priv::ternary_intern<0xaf>(c, b, a);
+                case 0xf6: return priv::ternary_intern<0xbe>(b, c, a);
+                case 0xf7: return priv::ternary_intern<0xbf>(b, c, a);
+                case 0xf8: return priv::ternary_intern<0xea>(b, c, a);
+                case 0xf9: return priv::ternary_intern<0xeb>(b, c, a);
+                case 0xfa: return priv::ternary_intern<0xee>(b, a, c);
+                case 0xfb: return priv::ternary_intern<0xef>(b, a, c);
+                case 0xfc: return priv::ternary_intern<0xee>(c, a, b);
+                case 0xfd: return priv::ternary_intern<0xef>(c, a, b);
+                case 0xfe: return priv::ternary_intern<0xfe>(a, b, c);
+                case 0xff: return priv::ternary_intern<0xff>(a, b, c);
+                default: return priv::ternary_intern<0>(a, b, c);
+            }
+        }
+#endif
+
+#ifndef TERNARYLOGIC_BMI
+        // kernels of ternary_x86_32.cpp
+        constexpr reduction reduced_x86_32[256] = {
+            { 0x00, order::abc }, // 0x00
+            { 0x01, order::abc }, // 0x01
+            { 0x02, order::abc }, // 0x02
+            { 0x03, order::abc }, // 0x03
+            { 0x02, order::acb }, // 0x04
+            { 0x03, order::acb }, // 0x05
+            { 0x06, order::abc }, // 0x06
+            { 0x07, order::abc }, // 0x07
+            { 0x08, order::abc }, // 0x08
+            { 0x09, order::abc }, // 0x09
+            { 0x0a, order::abc }, // 0x0a
+            { 0x0b, order::abc }, // 0x0b
+            { 0x0a, order::acb }, // 0x0c
+            { 0x0b, order::acb }, // 0x0d
+            { 0x0e, order::abc }, // 0x0e
+            { 0x0f, order::abc }, // 0x0f
+            { 0x02, order::bca }, // 0x10
+            { 0x03, order::bca }, // 0x11
+            { 0x06, order::bac }, // 0x12
+            { 0x07, order::bac }, // 0x13
+            { 0x06, order::cab }, // 0x14
+            { 0x07, order::cab }, // 0x15
+            { 0x16, order::abc }, // 0x16
+            { 0x17, order::abc }, // 0x17
+            { 0x18, order::abc }, // 0x18
+            { 0x19, order::abc }, // 0x19
+            { 0x1a, order::abc }, // 0x1a
+            { 0x1b, order::abc }, // 0x1b
+            { 0x1a, order::acb }, // 0x1c
+            { 0x1b, order::acb }, // 0x1d
+            { 0x1e, order::abc }, // 0x1e
+            { 0x1f, order::abc }, // 0x1f
+            { 0x08, order::bac }, // 0x20
+            { 0x09, order::bac }, // 0x21
+            { 0x0a, order::bac }, // 0x22
+            { 0x0b, order::bac }, // 0x23
+            { 0x18, order::bac }, // 0x24
+            { 0x19, order::bac }, // 0x25
+            { 0x1a, order::bac }, // 0x26
+            { 0x1b, order::bac }, // 0x27
+            { 0x28, order::abc }, // 0x28
+            { 0x29, order::abc }, // 0x29
+            { 0x2a, order::abc }, // 0x2a
+            { 0x2b, order::abc }, // 0x2b
+            { 0x2c, order::abc }, // 0x2c
+            { 0x2d, order::abc }, // 0x2d
+            { 0x2e, order::abc }, // 0x2e
+            { 0x2f, order::abc }, // 0x2f
+            { 0x0a, order::bca }, // 0x30
+            { 0x0b, order::bca }, // 0x31
+            { 0x0e, order::bac }, // 0x32
+            { 0x0f, order::bac }, // 0x33
+            { 0x1a, order::bca }, // 0x34
+            { 0x1b, order::bca }, // 0x35
+            { 0x1e, order::bac }, // 0x36
+            { 0x1f, order::bac }, // 0x37
+            { 0x2c, order::bac }, // 0x38
+            { 0x2d, order::bac }, // 0x39
+            { 0x2e, order::bac }, // 0x3a
+            { 0x2f, order::bac }, // 0x3b
+            { 0x3c, order::abc }, // 0x3c
+            { 0x3d, order::abc }, // 0x3d
+            { 0x3e, order::abc }, // 0x3e
+            { 0x3f, order::abc }, // 0x3f
+            { 0x08, order::cab }, // 0x40
+            { 0x09, order::cab }, // 0x41
+            { 0x18, order::cab }, // 0x42
+            { 0x19, order::cab }, // 0x43
+            { 0x0a, order::cab }, // 0x44
+            { 0x0b, order::cab }, // 0x45
+            { 0x1a, order::cab }, // 0x46
+            { 0x1b, order::cab }, // 0x47
+            { 0x28, order::acb }, // 0x48
+            { 0x29, order::acb }, // 0x49
+            { 0x2c, order::acb }, // 0x4a
+            { 0x2d, order::acb }, // 0x4b
+            { 0x2a, order::acb }, // 0x4c
+            { 0x2b, order::acb }, // 0x4d
+            { 0x2e, order::acb }, // 0x4e
+            { 0x2f, order::acb }, // 0x4f
+            { 0x0a, order::cba }, // 0x50
+            { 0x0b, order::cba }, // 0x51
+            { 0x1a, order::cba }, // 0x52
+            { 0x1b, order::cba }, // 0x53
+            { 0x0e, order::cab }, // 0x54
+            { 0x0f, order::cab }, // 0x55
+            { 0x1e, order::cab }, // 0x56
+            { 0x1f, order::cab }, // 0x57
+            { 0x2c, order::cab }, // 0x58
+            { 0x2d, order::cab }, // 0x59
+            { 0x3c, order::acb }, // 0x5a
+            { 0x3d, order::acb }, // 0x5b
+            { 0x2e, order::cab }, // 0x5c
+            { 0x2f, order::cab }, // 0x5d
+            { 0x3e, order::acb }, // 0x5e
+            { 0x3f, order::acb }, // 0x5f
+            { 0x28, order::bca }, // 0x60
+            { 0x29, order::bca }, // 0x61
+            { 0x2c, order::bca }, // 0x62
+            { 0x2d, order::bca }, // 0x63
+            { 0x2c, order::cba }, // 0x64
+            { 0x2d, order::cba }, // 0x65
+            { 0x3c, order::bca }, // 0x66
+            { 0x3d, order::bca }, // 0x67
+            { 0x68, order::abc }, // 0x68
+            { 0x69, order::abc }, // 0x69
+            { 0x6a, order::abc }, // 0x6a
+            { 0x6b, order::abc }, // 0x6b
+            { 0x6a, order::acb }, // 0x6c
+            { 0x6b, order::acb }, // 0x6d
+            { 0x6e, order::abc }, // 0x6e
+            { 0x6f, order::abc }, // 0x6f
+            { 0x2a, order::bca }, // 0x70
+            { 0x2b, order::bca }, // 0x71
+            { 0x2e, order::bca }, // 0x72
+            { 0x2f, order::bca }, // 0x73
+            { 0x2e, order::cba }, // 0x74
+            { 0x2f, order::cba }, // 0x75
+            { 0x3e, order::bca }, // 0x76
+            { 0x3f, order::bca }, // 0x77
+            { 0x6a, order::bca }, // 0x78
+            { 0x6b, order::bca }, // 0x79
+            { 0x6e, order::bac }, // 0x7a
+            { 0x6f, order::bac }, // 0x7b
+            { 0x6e, order::cab }, // 0x7c
+            { 0x6f, order::cab }, // 0x7d
+            { 0x7e, order::abc }, // 0x7e
+            { 0x7f, order::abc }, // 0x7f
+            { 0x80, order::abc }, // 0x80
+            { 0x81, order::abc }, // 0x81
+            { 0x82, order::abc }, // 0x82
+            { 0x83, order::abc }, // 0x83
+            { 0x82, order::acb }, // 0x84
+            { 0x83, order::acb }, // 0x85
+            { 0x86, order::abc }, // 0x86
+            { 0x87, order::abc }, // 0x87
+            { 0x88, order::abc }, // 0x88
+            { 0x89, order::abc }, // 0x89
+            { 0x8a, order::abc }, // 0x8a
+            { 0x8b, order::abc }, // 0x8b
+            { 0x8a, order::acb }, // 0x8c
+            { 0x8b, order::acb }, // 0x8d
+            { 0x8e, order::abc }, // 0x8e
+            { 0x8f, order::abc }, // 0x8f
+            { 0x82, order::bca }, // 0x90
+            { 0x83, order::bca }, // 0x91
+            { 0x86, order::bac }, // 0x92
+            { 0x87, order::bac }, // 0x93
+            { 0x86, order::cab }, // 0x94
+            { 0x87, order::cab }, // 0x95
+            { 0x96, order::abc }, // 0x96
+            { 0x97, order::abc }, // 0x97
+            { 0x98, order::abc }, // 0x98
+            { 0x99, order::abc }, // 0x99
+            { 0x9a, order::abc }, // 0x9a
+            { 0x9b, order::abc }, // 0x9b
+            { 0x9a, order::acb }, // 0x9c
+            { 0x9b, order::acb }, // 0x9d
+            { 0x9e, order::abc }, // 0x9e
+            { 0x9f, order::abc }, // 0x9f
+            { 0x88, order::bac }, // 0xa0
+            { 0x89, order::bac }, // 0xa1
+            { 0x8a, order::bac }, // 0xa2
+            { 0x8b, order::bac }, // 0xa3
+            { 0x98, order::bac }, // 0xa4
+            { 0x99, order::bac }, // 0xa5
+            { 0x9a, order::bac }, // 0xa6
+            { 0x9b, order::bac }, // 0xa7
+            { 0xa8, order::abc }, // 0xa8
+            { 0xa9, order::abc }, // 0xa9
+            { 0xaa, order::abc }, // 0xaa
+            { 0xab, order::abc }, // 0xab
+            { 0xac, order::abc }, // 0xac
+            { 0xad, order::abc }, // 0xad
+            { 0xae, order::abc }, // 0xae
+            { 0xaf, order::abc }, // 0xaf
+            { 0x8a, order::bca }, // 0xb0
+            { 0x8b, order::bca }, // 0xb1
+            { 0x8e, order::bac }, // 0xb2
+            { 0x8f, order::bac }, // 0xb3
+            { 0x9a, order::bca }, // 0xb4
+            { 0x9b, order::bca }, // 0xb5
+            { 0x9e, order::bac }, // 0xb6
+            { 0x9f, order::bac }, // 0xb7
+            { 0xac, order::bac }, // 0xb8
+            { 0xad, order::bac }, // 0xb9
+            { 0xae, order::bac }, // 0xba
+            { 0xaf, order::bac }, // 0xbb
+            { 0xbc, order::abc }, // 0xbc
+            { 0xbd, order::abc }, // 0xbd
+            { 0xbe, order::abc }, // 0xbe
+            { 0xbf, order::abc }, // 0xbf
+            { 0x88, order::cab }, // 0xc0
+            { 0x89, order::cab }, // 0xc1
+            { 0x98, order::cab }, // 0xc2
+            { 0x99, order::cab }, // 0xc3
+            { 0x8a, order::cab }, // 0xc4
+            { 0x8b, order::cab }, // 0xc5
+            { 0x9a, order::cab }, // 0xc6
+            { 0x9b, order::cab }, // 0xc7
+            { 0xa8, order::acb }, // 0xc8
+            { 0xa9, order::acb }, // 0xc9
+            { 0xac, order::acb }, // 0xca
+            { 0xad, order::acb }, // 0xcb
+            { 0xaa, order::acb }, // 0xcc
+            { 0xab, order::acb }, // 0xcd
+            { 0xae, order::acb }, // 0xce
+            { 0xaf, order::acb }, // 0xcf
+            { 0x8a, order::cba }, // 0xd0
+            { 0x8b, order::cba }, // 0xd1
+            { 0x9a, order::cba }, // 0xd2
+            { 0x9b, order::cba }, // 0xd3
+            { 0x8e, order::cab }, // 0xd4
+            { 0x8f, order::cab }, // 0xd5
+            { 0x9e, order::cab }, // 0xd6
+            { 0x9f, order::cab }, // 0xd7
+            { 0xac, order::cab }, // 0xd8
+            { 0xad, order::cab }, // 0xd9
+            { 0xbc, order::acb }, // 0xda
+            { 0xbd, order::acb }, // 0xdb
+            { 0xae, order::cab }, // 0xdc
+            { 0xaf, order::cab }, // 0xdd
+            { 0xbe, order::acb }, // 0xde
+            { 0xbf, order::acb }, // 0xdf
+            { 0xa8, order::bca }, // 0xe0
+            { 0xa9, order::bca }, // 0xe1
+            { 0xac, order::bca }, // 0xe2
+            { 0xad, order::bca }, // 0xe3
+            { 0xac, order::cba }, // 0xe4
+            { 0xad, order::cba }, // 0xe5
+            { 0xbc, order::bca }, // 0xe6
+            { 0xbd, order::bca }, // 0xe7
+            { 0xe8, order::abc }, // 0xe8
+            { 0xe9, order::abc }, // 0xe9
+            { 0xea, order::abc }, // 0xea
+            { 0xeb, order::abc }, // 0xeb
+            { 0xea, order::acb }, // 0xec
+            { 0xeb, order::acb }, // 0xed
+            { 0xee, order::abc }, // 0xee
+            { 0xef, order::abc }, // 0xef
+            { 0xaa, order::bca }, // 0xf0
+            { 0xab, order::bca }, // 0xf1
+            { 0xae, order::bca }, // 0xf2
+            { 0xaf, order::bca }, // 0xf3
+            { 0xae, order::cba }, // 0xf4
+            { 0xaf, order::cba }, // 0xf5
+            { 0xbe, order::bca }, // 0xf6
+            { 0xbf, order::bca }, // 0xf7
+            { 0xea, order::bca }, // 0xf8
+            { 0xeb, order::bca }, // 0xf9
+            { 0xee, order::bac }, // 0xfa
+            { 0xef, order::bac }, // 0xfb
+            { 0xee, order::cab }, // 0xfc
+            { 0xef, order::cab }, // 0xfd
+            { 0xfe, order::abc }, // 0xfe
+            { 0xff, order::abc }, // 0xff
+        };
+#ifdef TERNARYLOGIC_TESTS
+        static_assert(valid_reduction(reduced_x86_32), "invalid reduction of x86_32");
+#endif
+
+        template<>
+        [[nodiscard]] constexpr uint32_t ternary_reduced<uint32_t>(const uint32_t& a, const uint32_t& b, const uint32_t& c, const bf_type k) noexcept {
+            switch (k) {
+                case 0x00: return priv::ternary_intern<0x00>(a, b, c);
+                case 0x01: return priv::ternary_intern<0x01>(a, b, c);
+                case 0x02: return priv::ternary_intern<0x02>(a, b, c);
+                case 0x03: return priv::ternary_intern<0x03>(a, b, c);
+                case 0x04: return priv::ternary_intern<0x02>(a, c, b);
+                case 0x05: return priv::ternary_intern<0x03>(a, c, b);
+                case 0x06: return priv::ternary_intern<0x06>(a, b, c);
+                case 0x07: return priv::ternary_intern<0x07>(a, b, c);
+                case 0x08: return priv::ternary_intern<0x08>(a, b, c);
+                case 0x09: return priv::ternary_intern<0x09>(a, b, c);
+                case 0x0a: return priv::ternary_intern<0x0a>(a, b, c);
+                case 0x0b: return priv::ternary_intern<0x0b>(a, b, c);
+                case 0x0c: return priv::ternary_intern<0x0a>(a, c, b);
+                case 0x0d: return priv::ternary_intern<0x0b>(a, c, b);
+                case 0x0e: return priv::ternary_intern<0x0e>(a, b, c);
+                case 0x0f: return priv::ternary_intern<0x0f>(a, b, c);
+                case 0x10: return priv::ternary_intern<0x02>(b, c, a);
+                case 0x11: return priv::ternary_intern<0x03>(b, c, a);
+                case 0x12: return priv::ternary_intern<0x06>(b, a, c);
+                case 0x13: return priv::ternary_intern<0x07>(b, a, c);
+                case 0x14: return priv::ternary_intern<0x06>(c, a, b);
+                case 0x15: return priv::ternary_intern<0x07>(c, a, b);
+                case 0x16: return priv::ternary_intern<0x16>(a, b, c);
+                case 0x17: return priv::ternary_intern<0x17>(a, b, c);
+                case 0x18: return priv::ternary_intern<0x18>(a, b, c);
+                case 0x19: return priv::ternary_intern<0x19>(a, b, c);
+                case 0x1a: return priv::ternary_intern<0x1a>(a, b, c);
+                case 0x1b: return priv::ternary_intern<0x1b>(a, b, c);
+                case 0x1c: return priv::ternary_intern<0x1a>(a, c, b);
+                case 0x1d: return priv::ternary_intern<0x1b>(a, c, b);
+                case 0x1e: return priv::ternary_intern<0x1e>(a, b, c);
+                case 0x1f: return priv::ternary_intern<0x1f>(a, b, c);
+                case 0x20: return priv::ternary_intern<0x08>(b, a, c);
+                case 0x21: return priv::ternary_intern<0x09>(b, a, c);
+                case 0x22: return priv::ternary_intern<0x0a>(b, a, c);
+                case 0x23: return priv::ternary_intern<0x0b>(b, a, c);
+                case 0x24: return priv::ternary_intern<0x18>(b, a, c);
+                case 0x25: return priv::ternary_intern<0x19>(b, a, c);
+                case 0x26: return priv::ternary_intern<0x1a>(b, a, c);
+                case 0x27: return priv::ternary_intern<0x1b>(b, a, c);
+                case 0x28: return priv::ternary_intern<0x28>(a, b, c);
+                case 0x29: return priv::ternary_intern<0x29>(a, b, c);
+                case 0x2a: return priv::ternary_intern<0x2a>(a, b, c);
+                case 0x2b: return priv::ternary_intern<0x2b>(a, b, c);
+                case 0x2c: return priv::ternary_intern<0x2c>(a, b, c);
+                case 0x2d: return priv::ternary_intern<0x2d>(a, b, c);
+                case 0x2e: return priv::ternary_intern<0x2e>(a, b, c);
+                case 0x2f: return priv::ternary_intern<0x2f>(a, b, c);
+                case 0x30: return priv::ternary_intern<0x0a>(b, c, a);
+                case 0x31: return priv::ternary_intern<0x0b>(b, c, a);
+                case 0x32: return priv::ternary_intern<0x0e>(b, a, c);
+                case 0x33: return priv::ternary_intern<0x0f>(b, a, c);
+                case 0x34: return priv::ternary_intern<0x1a>(b, c, a);
+                case 0x35: return priv::ternary_intern<0x1b>(b, c, a);
+                case 0x36: return priv::ternary_intern<0x1e>(b, a, c);
+                case 0x37: return priv::ternary_intern<0x1f>(b, a, c);
+                case 0x38: return priv::ternary_intern<0x2c>(b, a, c);
+                case 0x39: return priv::ternary_intern<0x2d>(b, a, c);
+                case 0x3a: return priv::ternary_intern<0x2e>(b, a, c);
+                case 0x3b: return priv::ternary_intern<0x2f>(b, a, c);
+                case 0x3c: return priv::ternary_intern<0x3c>(a, b, c);
+                case 0x3d: return priv::ternary_intern<0x3d>(a, b, c);
+                case 0x3e: return priv::ternary_intern<0x3e>(a, b, c);
+                case 0x3f: return priv::ternary_intern<0x3f>(a, b, c);
+                case 0x40: return priv::ternary_intern<0x08>(c, a, b);
+                case 0x41: return priv::ternary_intern<0x09>(c, a, b);
+                case 0x42: return priv::ternary_intern<0x18>(c, a, b);
+                case 0x43: return priv::ternary_intern<0x19>(c, a, b);
+                case 0x44: return priv::ternary_intern<0x0a>(c, a, b);
+                case 0x45: return priv::ternary_intern<0x0b>(c, a, b);
+                case 0x46: return priv::ternary_intern<0x1a>(c, a, b);
+                case 0x47: return priv::ternary_intern<0x1b>(c, a, b);
+                case 0x48: return priv::ternary_intern<0x28>(a, c, b);
+                case 0x49: return priv::ternary_intern<0x29>(a, c, b);
+                case 0x4a: return priv::ternary_intern<0x2c>(a, c, b);
+                case 0x4b: return priv::ternary_intern<0x2d>(a, c, b);
+                case 0x4c: return priv::ternary_intern<0x2a>(a, c, b);
+                case 0x4d: return priv::ternary_intern<0x2b>(a, c, b);
+                case 0x4e: return priv::ternary_intern<0x2e>(a, c, b);
+                case 0x4f: return priv::ternary_intern<0x2f>(a, c, b);
+                case 0x50: return priv::ternary_intern<0x0a>(c, b, a);
+                case 0x51: return priv::ternary_intern<0x0b>(c, b, a);
+                case 0x52: return priv::ternary_intern<0x1a>(c, b, a);
+                case 0x53: return priv::ternary_intern<0x1b>(c, b, a);
+                case 0x54: return priv::ternary_intern<0x0e>(c, a, b);
+                case 0x55: return priv::ternary_intern<0x0f>(c, a, b);
+                case 0x56: return priv::ternary_intern<0x1e>(c, a, b);
+                case 0x57: return priv::ternary_intern<0x1f>(c, a, b);
+                case 0x58: return priv::ternary_intern<0x2c>(c, a, b);
+                case 0x59: return priv::ternary_intern<0x2d>(c, a, b);
+                case 0x5a: return priv::ternary_intern<0x3c>(a, c, b);
+                case 0x5b: return priv::ternary_intern<0x3d>(a, c, b);
+                case 0x5c: return priv::ternary_intern<0x2e>(c, a, b);
+                case 0x5d: return priv::ternary_intern<0x2f>(c, a, b);
+                case 0x5e: return priv::ternary_intern<0x3e>(a, c, b);
+                case 0x5f: return priv::ternary_intern<0x3f>(a, c, b);
+                case 0x60: return priv::ternary_intern<0x28>(b, c, a);
+                case 0x61: return priv::ternary_intern<0x29>(b, c, a);
+                case 0x62: return priv::ternary_intern<0x2c>(b, c, a);
+                case 0x63: return priv::ternary_intern<0x2d>(b, c, a);
+                case 0x64: return priv::ternary_intern<0x2c>(c, b, a);
+                case 0x65: return priv::ternary_intern<0x2d>(c, b, a);
+                case 0x66: return priv::ternary_intern<0x3c>(b, c, a);
+                case 0x67: return priv::ternary_intern<0x3d>(b, c, a);
+                case 0x68: return priv::ternary_intern<0x68>(a, b, c);
+                case 0x69: return priv::ternary_intern<0x69>(a, b, c);
+                case 0x6a: return priv::ternary_intern<0x6a>(a, b, c);
+                case 0x6b: return priv::ternary_intern<0x6b>(a, b, c);
+                case 0x6c: return priv::ternary_intern<0x6a>(a, c, b);
+                case 0x6d: return priv::ternary_intern<0x6b>(a, c, b);
+                case 0x6e: return priv::ternary_intern<0x6e>(a, b, c);
+                case 0x6f: return priv::ternary_intern<0x6f>(a, b, c);
+                case 0x70: return priv::ternary_intern<0x2a>(b, c, a);
+                case 0x71: return priv::ternary_intern<0x2b>(b, c, a);
+                case 0x72: return priv::ternary_intern<0x2e>(b, c, a);
+                case 0x73: return priv::ternary_intern<0x2f>(b, c, a);
+                case 0x74: return priv::ternary_intern<0x2e>(c, b, a);
+                case 0x75: return priv::ternary_intern<0x2f>(c, b, a);
+                case 0x76: return priv::ternary_intern<0x3e>(b, c, a);
+                case 0x77: return priv::ternary_intern<0x3f>(b, c, a);
+                case 0x78: return priv::ternary_intern<0x6a>(b, c, a);
+                case 0x79: return priv::ternary_intern<0x6b>(b, c, a);
+                case 0x7a: return priv::ternary_intern<0x6e>(b, a, c);
+                case 0x7b: return priv::ternary_intern<0x6f>(b, a, c);
+                case 0x7c: return priv::ternary_intern<0x6e>(c, a, b);
+                case 0x7d: return priv::ternary_intern<0x6f>(c, a, b);
+                case 0x7e: return priv::ternary_intern<0x7e>(a, b, c);
+                case 0x7f: return priv::ternary_intern<0x7f>(a, b, c);
+                case 0x80: return priv::ternary_intern<0x80>(a, b, c);
+                case 0x81: return priv::ternary_intern<0x81>(a, b, c);
+                case 0x82: return priv::ternary_intern<0x82>(a, b, c);
+                case 0x83: return priv::ternary_intern<0x83>(a, b, c);
+                case 0x84: return priv::ternary_intern<0x82>(a, c, b);
+                case 0x85: return priv::ternary_intern<0x83>(a, c, b);
+                case 0x86: return priv::ternary_intern<0x86>(a, b, c);
+                case 0x87: return priv::ternary_intern<0x87>(a, b, c);
+                case 0x88: return priv::ternary_intern<0x88>(a, b, c);
+                case 0x89: return priv::ternary_intern<0x89>(a, b, c);
+                case 0x8a: return priv::ternary_intern<0x8a>(a, b, c);
+                case 0x8b: return priv::ternary_intern<0x8b>(a, b, c);
+                case 0x8c: return priv::ternary_intern<0x8a>(a, c, b);
+                case 0x8d: return priv::ternary_intern<0x8b>(a, c, b);
+                case 0x8e: return priv::ternary_intern<0x8e>(a, b, c);
+                case 0x8f: return priv::ternary_intern<0x8f>(a, b, c);
+                case 0x90: return priv::ternary_intern<0x82>(b, c, a);
+                case 0x91: return priv::ternary_intern<0x83>(b, c, a);
+                case 0x92: return priv::ternary_intern<0x86>(b, a, c);
+                case 0x93: return priv::ternary_intern<0x87>(b, a, c);
+                case 0x94: return priv::ternary_intern<0x86>(c, a, b);
+                case 0x95: return priv::ternary_intern<0x87>(c, a, b);
+                case 0x96: return priv::ternary_intern<0x96>(a, b, c);
+                case 0x97: return priv::ternary_intern<0x97>(a, b, c);
+                case 0x98: return priv::ternary_intern<0x98>(a, b, c);
+                case 0x99: return priv::ternary_intern<0x99>(a, b, c);
+                case 0x9a: return priv::ternary_intern<0x9a>(a, b, c);
+                case 0x9b: return priv::ternary_intern<0x9b>(a, b, c);
+                case 0x9c: return priv::ternary_intern<0x9a>(a, c, b);
+                case 0x9d: return priv::ternary_intern<0x9b>(a, c, b);
+                case 0x9e: return priv::ternary_intern<0x9e>(a, b, c);
+                case 0x9f: return priv::ternary_intern<0x9f>(a, b, c);
+                case 0xa0: return priv::ternary_intern<0x88>(b, a, c);
+                case 0xa1: return priv::ternary_intern<0x89>(b, a, c);
+                case 0xa2: return priv::ternary_intern<0x8a>(b, a, c);
+                case 0xa3: return priv::ternary_intern<0x8b>(b, a, c);
+                case 0xa4: return priv::ternary_intern<0x98>(b, a, c);
+                case 0xa5: return priv::ternary_intern<0x99>(b, a, c);
+                case 0xa6: return priv::ternary_intern<0x9a>(b, a, c);
+                case 0xa7: return priv::ternary_intern<0x9b>(b, a, c);
+                case 0xa8: return priv::ternary_intern<0xa8>(a, b, c);
+                case 0xa9: return priv::ternary_intern<0xa9>(a, b, c);
+                case 0xaa: return priv::ternary_intern<0xaa>(a, b, c);
+                case 0xab: return priv::ternary_intern<0xab>(a, b, c);
+                case 0xac: return priv::ternary_intern<0xac>(a, b, c);
+                case 0xad: return priv::ternary_intern<0xad>(a, b, c);
+                case 0xae: return priv::ternary_intern<0xae>(a, b, c);
+                case 0xaf: return priv::ternary_intern<0xaf>(a, b, c);
+                case 0xb0: return priv::ternary_intern<0x8a>(b, c, a);
+                case 0xb1: return priv::ternary_intern<0x8b>(b, c, a);
+                case 0xb2: return priv::ternary_intern<0x8e>(b, a, c);
+                case 0xb3: return priv::ternary_intern<0x8f>(b, a, c);
+                case 0xb4: return priv::ternary_intern<0x9a>(b, c, a);
+                case 0xb5: return priv::ternary_intern<0x9b>(b, c, a);
+                case 0xb6: return priv::ternary_intern<0x9e>(b, a, c);
+                case 0xb7: return priv::ternary_intern<0x9f>(b, a, c);
+                case 0xb8: return priv::ternary_intern<0xac>(b, a, c);
+                case 0xb9: return priv::ternary_intern<0xad>(b, a, c);
+                case 0xba: return priv::ternary_intern<0xae>(b, a, c);
+                case 0xbb: return priv::ternary_intern<0xaf>(b, a, c);
+                case 0xbc: return priv::ternary_intern<0xbc>(a, b, c);
+                case 0xbd: return priv::ternary_intern<0xbd>(a, b, c);
+                case 0xbe: return priv::ternary_intern<0xbe>(a, b, c);
+                case 0xbf: return priv::ternary_intern<0xbf>(a, b, c);
+                case 0xc0: return priv::ternary_intern<0x88>(c, a, b);
+                case 0xc1: return priv::ternary_intern<0x89>(c, a, b);
+                case 0xc2: return priv::ternary_intern<0x98>(c, a, b);
+                case 0xc3: return priv::ternary_intern<0x99>(c, a, b);
+                case 0xc4: return priv::ternary_intern<0x8a>(c, a, b);
+                case 0xc5: return priv::ternary_intern<0x8b>(c, a, b);
+                case 0xc6: return priv::ternary_intern<0x9a>(c, a, b);
+                case 0xc7: return priv::ternary_intern<0x9b>(c, a, b);
+                case 0xc8: return priv::ternary_intern<0xa8>(a, c, b);
+                case 0xc9: return priv::ternary_intern<0xa9>(a, c, b);
+                case 0xca: return priv::ternary_intern<0xac>(a, c, b);
+                case 0xcb: return priv::ternary_intern<0xad>(a, c, b);
+                case 0xcc: return priv::ternary_intern<0xaa>(a, c, b);
+                case 0xcd: return priv::ternary_intern<0xab>(a, c, b);
+                case 0xce: return priv::ternary_intern<0xae>(a, c, b);
+                case 0xcf: return priv::ternary_intern<0xaf>(a, c, b);
+                case 0xd0: return priv::ternary_intern<0x8a>(c, b, a);
+                case 0xd1: return priv::ternary_intern<0x8b>(c, b, a);
+                case 0xd2: return priv::ternary_intern<0x9a>(c, b, a);
+                case 0xd3: return priv::ternary_intern<0x9b>(c, b, a);
+                case 0xd4: return priv::ternary_intern<0x8e>(c, a, b);
+                case 0xd5: return priv::ternary_intern<0x8f>(c, a, b);
+                case 0xd6: return priv::ternary_intern<0x9e>(c, a, b);
+                case 0xd7: return priv::ternary_intern<0x9f>(c, a, b);
+                case 0xd8: return priv::ternary_intern<0xac>(c, a, b);
+                case 0xd9: return priv::ternary_intern<0xad>(c, a, b);
+                case 0xda: return priv::ternary_intern<0xbc>(a, c, b);
+                case 0xdb: return priv::ternary_intern<0xbd>(a, c, b);
+                case 0xdc: return priv::ternary_intern<0xae>(c, a, b);
+                case 0xdd: return priv::ternary_intern<0xaf>(c, a, b);
+                case 0xde: return priv::ternary_intern<0xbe>(a, c, b);
+                case 0xdf: return priv::ternary_intern<0xbf>(a, c, b);
+                case 0xe0: return priv::ternary_intern<0xa8>(b, c, a);
+                case 0xe1: return priv::ternary_intern<0xa9>(b, c, a);
+                case 0xe2: return priv::ternary_intern<0xac>(b, c, a);
+                case 0xe3: return priv::ternary_intern<0xad>(b, c, a);
+                case 0xe4: return priv::ternary_intern<0xac>(c, b, a);
+                case 0xe5: return priv::ternary_intern<0xad>(c, b, a);
+                case 0xe6: return priv::ternary_intern<0xbc>(b, c, a);
+                case 0xe7: return priv::ternary_intern<0xbd>(b, c, a);
+                case 0xe8: return priv::ternary_intern<0xe8>(a, b, c);
+                case 0xe9: return priv::ternary_intern<0xe9>(a, b, c);
+                case 0xea: return priv::ternary_intern<0xea>(a, b, c);
+                case 0xeb: return priv::ternary_intern<0xeb>(a, b, c);
+                case 0xec: return priv::ternary_intern<0xea>(a, c, b);
+                case 0xed: return priv::ternary_intern<0xeb>(a, c, b);
+                case 0xee: return priv::ternary_intern<0xee>(a, b, c);
+                case 0xef: return priv::ternary_intern<0xef>(a, b, c);
+                case 0xf0: return priv::ternary_intern<0xaa>(b, c, a);
+                case 0xf1: return priv::ternary_intern<0xab>(b, c, a);
+                case 0xf2: return priv::ternary_intern<0xae>(b, c, a);
+                case 0xf3: return priv::ternary_intern<0xaf>(b, c, a);
+                case 0xf4: return priv::ternary_intern<0xae>(c, b, a);
+                case 0xf5: return priv::ternary_intern<0xaf>(c, b, a);
+                case 0xf6: return priv::ternary_intern<0xbe>(b, c, a);
+                case 0xf7: return priv::ternary_intern<0xbf>(b, c, a);
+                case 0xf8: return priv::ternary_intern<0xea>(b, c, a);
+                case 0xf9: return priv::ternary_intern<0xeb>(b, c, a);
+                case 0xfa: return priv::ternary_intern<0xee>(b, a, c);
+                case 0xfb: return priv::ternary_intern<0xef>(b, a, c);
+                case 0xfc: return priv::ternary_intern<0xee>(c, a, b);
+                case 0xfd: return priv::ternary_intern<0xef>(c, a, b);
+                case 0xfe: return priv::ternary_intern<0xfe>(a, b, c);
+                case 0xff: return priv::ternary_intern<0xff>(a, b, c);
+                default: return priv::ternary_intern<0>(a, b, c);
+            }
+        }
+#endif
+
+#ifdef TERNARYLOGIC_BMI
+        // kernels of ternary_x86_32_bmi.cpp
+        constexpr reduction reduced_x86_32_bmi[256] = {
+            { 0x00, order::abc }, // 0x00
+            { 0x01, order::abc }, // 0x01
+            { 0x02, order::abc }, // 0x02
+            { 0x03, order::abc }, // 0x03
+            { 0x02, order::acb }, // 0x04
+            { 0x03, order::acb }, // 0x05
+            { 0x06, order::abc }, // 0x06
+            { 0x07, order::abc }, // 0x07
+            { 0x08, order::abc }, // 0x08
+            { 0x09, order::abc }, // 0x09
+            { 0x0a, order::abc }, // 0x0a
+            { 0x0b, order::abc }, // 0x0b
+            { 0x0a, order::acb }, // 0x0c
+            { 0x0b, order::acb }, // 0x0d
+            { 0x0e, order::abc }, // 0x0e
+            { 0x0f, order::abc }, // 0x0f
+            { 0x02, order::bca }, // 0x10
+            { 0x03, order::bca }, // 0x11
+            { 0x06, order::bac }, // 0x12
+            { 0x07, order::bac }, // 0x13
+            { 0x06, order::cab }, // 0x14
+            { 0x07, order::cab }, // 0x15
+            { 0x16, order::abc }, // 0x16
+            { 0x17, order::abc }, // 0x17
+            { 0x18, order::abc }, // 0x18
+            { 0x19, order::abc }, // 0x19
+            { 0x1a, order::abc }, // 0x1a
+            { 0x1b, order::abc }, // 0x1b
+            { 0x1a, order::acb }, // 0x1c
+            { 0x1b, order::acb }, // 0x1d
+            { 0x1e, order::abc }, // 0x1e
+            { 0x1f, order::abc }, // 0x1f
+            { 0x08, order::bac }, // 0x20
+            { 0x09, order::bac }, // 0x21
+            { 0x0a, order::bac }, // 0x22
+            { 0x0b, order::bac }, // 0x23
+            { 0x18, order::bac }, // 0x24
+            { 0x19, order::bac }, // 0x25
+            { 0x1a, order::bac }, // 0x26
+            { 0x1b, order::bac }, // 0x27
+            { 0x28, order::abc }, // 0x28
+            { 0x29, order::abc }, // 0x29
+            { 0x2a, order::abc }, // 0x2a
+            { 0x2b, order::abc }, // 0x2b
+            { 0x2c, order::abc }, // 0x2c
+            { 0x2d, order::abc }, // 0x2d
+            { 0x2e, order::abc }, // 0x2e
+            { 0x2f, order::abc }, // 0x2f
+            { 0x0a, order::bca }, // 0x30
+            { 0x0b, order::bca }, // 0x31
+            { 0x0e, order::bac }, // 0x32
+            { 0x0f, order::bac }, // 0x33
+            { 0x1a, order::bca }, // 0x34
+            { 0x1b, order::bca }, // 0x35
+            { 0x1e, order::bac }, // 0x36
+            { 0x1f, order::bac }, // 0x37
+            { 0x2c, order::bac }, // 0x38
+            { 0x2d, order::bac }, // 0x39
+            { 0x2e, order::bac }, // 0x3a
+            { 0x2f, order::bac }, // 0x3b
+            { 0x3c, order::abc }, // 0x3c
+            { 0x3d, order::abc }, // 0x3d
+            { 0x3e, order::abc }, // 0x3e
+            { 0x3f, order::abc }, // 0x3f
+            { 0x08, order::cab }, // 0x40
+            { 0x09, order::cab }, // 0x41
+            { 0x18, order::cab }, // 0x42
+            { 0x19, order::cab }, // 0x43
+            { 0x0a, order::cab }, // 0x44
+            { 0x0b, order::cab }, // 0x45
+            { 0x1a, order::cab }, // 0x46
+            { 0x1b, order::cab }, // 0x47
+            { 0x28, order::acb }, // 0x48
+            { 0x29, order::acb }, // 0x49
+            { 0x2c, order::acb }, // 0x4a
+            { 0x2d, order::acb }, // 0x4b
+            { 0x2a, order::acb }, // 0x4c
+            { 0x2b, order::acb }, // 0x4d
+            { 0x2e, order::acb }, // 0x4e
+            { 0x2f, order::acb }, // 0x4f
+            { 0x0a, order::cba }, // 0x50
+            { 0x0b, order::cba }, // 0x51
+            { 0x1a, order::cba }, // 0x52
+            { 0x1b, order::cba }, // 0x53
+            { 0x0e, order::cab }, // 0x54
+            { 0x0f, order::cab }, // 0x55
+            { 0x1e, order::cab }, // 0x56
+            { 0x1f, order::cab }, // 0x57
+            { 0x2c, order::cab }, // 0x58
+            { 0x2d, order::cab }, // 0x59
+            { 0x3c, order::acb }, // 0x5a
+            { 0x3d, order::acb }, // 0x5b
+            { 0x2e, order::cab }, // 0x5c
+            { 0x2f, order::cab }, // 0x5d
+            { 0x3e, order::acb }, // 0x5e
+            { 0x3f, order::acb }, // 0x5f
+            { 0x28, order::bca }, // 0x60
+            { 0x29, order::bca }, // 0x61
+            { 0x2c, order::bca }, // 0x62
+            { 0x2d, order::bca }, // 0x63
+            { 0x2c, order::cba }, // 0x64
+            { 0x2d, order::cba }, // 0x65
+            { 0x3c, order::bca }, // 0x66
+            { 0x3d, order::bca }, // 0x67
+            { 0x68, order::abc }, // 0x68
+            { 0x69, order::abc }, // 0x69
+            { 0x6a, order::abc }, // 0x6a
+            { 0x6b, order::abc }, // 0x6b
+            { 0x6a, order::acb }, // 0x6c
+            { 0x6b, order::acb }, // 0x6d
+            { 0x6e, order::abc }, // 0x6e
+            { 0x6f, order::abc }, // 0x6f
+            { 0x2a, order::bca }, // 0x70
+            { 0x2b, order::bca }, // 0x71
+            { 0x2e, order::bca }, // 0x72
+            { 0x2f, order::bca }, // 0x73
+            { 0x2e, order::cba }, // 0x74
+            { 0x2f, order::cba }, // 0x75
+            { 0x3e, order::bca }, // 0x76
+            { 0x3f, order::bca }, // 0x77
+            { 0x6a, order::bca }, // 0x78
+            { 0x6b, order::bca }, // 0x79
+            { 0x6e, order::bac }, // 0x7a
+            { 0x6f, order::bac }, // 0x7b
+            { 0x6e, order::cab }, // 0x7c
+            { 0x6f, order::cab }, // 0x7d
+            { 0x7e, order::abc }, // 0x7e
+            { 0x7f, order::abc }, // 0x7f
+            { 0x80, order::abc }, // 0x80
+            { 0x81, order::abc }, // 0x81
+            { 0x82, order::abc }, // 0x82
+            { 0x83, order::abc }, // 0x83
+            { 0x82, order::acb }, // 0x84
+            { 0x83, order::acb }, // 0x85
+            { 0x86, order::abc }, // 0x86
+            { 0x87, order::abc }, // 0x87
+            { 0x88, order::abc }, // 0x88
+            { 0x89, order::abc }, // 0x89
+            { 0x8a, order::abc }, // 0x8a
+            { 0x8b, order::abc }, // 0x8b
+            { 0x8a, order::acb }, // 0x8c
+            { 0x8b, order::acb }, // 0x8d
+            { 0x8e, order::abc }, // 0x8e
+            { 0x8f, order::abc }, // 0x8f
+            { 0x82, order::bca }, // 0x90
+            { 0x83, order::bca }, // 0x91
+            { 0x86, order::bac }, // 0x92
+            { 0x87, order::bac }, // 0x93
+            { 0x86, order::cab }, // 0x94
+            { 0x87, order::cab }, // 0x95
+            { 0x96, order::abc }, // 0x96
+            { 0x97, order::abc }, // 0x97
+            { 0x98, order::abc }, // 0x98
+            { 0x99, order::abc }, // 0x99
+            { 0x9a, order::abc }, // 0x9a
+            { 0x9b, order::abc }, // 0x9b
+            { 0x9a, order::acb }, // 0x9c
+            { 0x9b, order::acb }, // 0x9d
+            { 0x9e, order::abc }, // 0x9e
+            { 0x9f, order::abc }, // 0x9f
+            { 0x88, order::bac }, // 0xa0
+            { 0x89, order::bac }, // 0xa1
+            { 0x8a, order::bac }, // 0xa2
+            { 0x8b, order::bac }, // 0xa3
+            { 0x98, order::bac }, // 0xa4
+            { 0x99, order::bac }, // 0xa5
+            { 0x9a, order::bac }, // 0xa6
+            { 0x9b, order::bac }, // 0xa7
+            { 0xa8, order::abc }, // 0xa8
+            { 0xa9, order::abc }, // 0xa9
+            { 0xaa, order::abc }, // 0xaa
+            { 0xab, order::abc }, // 0xab
+            { 0xac, order::abc }, // 0xac
+            { 0xad, order::abc }, // 0xad
+            { 0xae, order::abc }, // 0xae
+            { 0xaf, order::abc }, // 0xaf
+            { 0x8a, order::bca }, // 0xb0
+            { 0x8b, order::bca }, // 0xb1
+            { 0x8e, order::bac }, // 0xb2
+            { 0x8f, order::bac }, // 0xb3
+            { 0x9a, order::bca }, // 0xb4
+            { 0x9b, order::bca }, // 0xb5
+            { 0x9e, order::bac }, // 0xb6
+            { 0x9f, order::bac }, // 0xb7
+            { 0xac, order::bac }, // 0xb8
+            { 0xad, order::bac }, // 0xb9
+            { 0xae, order::bac }, // 0xba
+            { 0xaf, order::bac }, // 0xbb
+            { 0xbc, order::abc }, // 0xbc
+            { 0xbd, order::abc }, // 0xbd
+            { 0xbe, order::abc }, // 0xbe
+            { 0xbf, order::abc }, // 0xbf
+            { 0x88, order::cab }, // 0xc0
+            { 0x89, order::cab }, // 0xc1
+            { 0x98, order::cab }, // 0xc2
+            { 0x99, order::cab }, // 0xc3
+            { 0x8a, order::cab }, // 0xc4
+            { 0x8b, order::cab }, // 0xc5
+            { 0x9a, order::cab }, // 0xc6
+            { 0x9b, order::cab }, // 0xc7
+            { 0xa8, order::acb }, // 0xc8
+            { 0xa9, order::acb }, // 0xc9
+            { 0xac, order::acb }, // 0xca
+            { 0xad, order::acb }, // 0xcb
+            { 0xaa, order::acb }, // 0xcc
+            { 0xab, order::acb }, // 0xcd
+            { 0xae, order::acb }, // 0xce
+            { 0xaf, order::acb }, // 0xcf
+            { 0x8a, order::cba }, // 0xd0
+            { 0x8b, order::cba }, // 0xd1
+            { 0x9a, order::cba }, // 0xd2
+            { 0x9b, order::cba }, // 0xd3
+            { 0x8e, order::cab }, // 0xd4
+            { 0x8f, order::cab }, // 0xd5
+            { 0x9e, order::cab }, // 0xd6
+            { 0x9f, order::cab }, // 0xd7
+            { 0xac, order::cab }, // 0xd8
+            { 0xad, order::cab }, // 0xd9
+            { 0xbc, order::acb }, // 0xda
+            { 0xbd, order::acb }, // 0xdb
+            { 0xae, order::cab }, // 0xdc
+            { 0xaf, order::cab }, // 0xdd
+            { 0xbe, order::acb }, // 0xde
+            { 0xbf, order::acb }, // 0xdf
+            { 0xa8, order::bca }, // 0xe0
+            { 0xa9, order::bca }, // 0xe1
+            { 0xac, order::bca }, // 0xe2
+            { 0xad, order::bca }, // 0xe3
+            { 0xac, order::cba }, // 0xe4
+            { 0xad, order::cba }, // 0xe5
+            { 0xbc, order::bca }, // 0xe6
+            { 0xbd, order::bca }, // 0xe7
+            { 0xe8, order::abc }, // 0xe8
+            { 0xe9, order::abc }, // 0xe9
+            { 0xea, order::abc }, // 0xea
+            { 0xeb, order::abc }, // 0xeb
+            { 0xea, order::acb }, // 0xec
+            { 0xeb, order::acb }, // 0xed
+            { 0xee, order::abc }, // 0xee
+            { 0xef, order::abc }, // 0xef
+            { 0xaa, order::bca }, // 0xf0
+            { 0xab, order::bca }, // 0xf1
+            { 0xae, order::bca }, // 0xf2
+            { 0xaf, order::bca }, // 0xf3
+            { 0xae, order::cba }, // 0xf4
+            { 0xaf, order::cba }, // 0xf5
+            { 0xbe, order::bca }, // 0xf6
+            { 0xbf, order::bca }, // 0xf7
+            { 0xea, order::bca }, // 0xf8
+            { 0xeb, order::bca }, // 0xf9
+            { 0xee, order::bac }, // 0xfa
+            { 0xef, order::bac }, // 0xfb
+            { 0xee, order::cab }, // 0xfc
+            { 0xef, order::cab }, // 0xfd
+            { 0xfe, order::abc }, // 0xfe
+            { 0xff, order::abc }, // 0xff
+        };
+#ifdef TERNARYLOGIC_TESTS
+        static_assert(valid_reduction(reduced_x86_32_bmi), "invalid reduction of x86_32_bmi");
+#endif
+
+        template<>
+        [[nodiscard]] constexpr uint32_t ternary_reduced<uint32_t>(const uint32_t& a, const uint32_t& b, const uint32_t& c, const bf_type k) noexcept {
+            switch (k) {
+                case 0x00: return priv::ternary_intern<0x00>(a, b, c);
+                case 0x01: return priv::ternary_intern<0x01>(a, b, c);
+                case 0x02: return priv::ternary_intern<0x02>(a, b, c);
+                case 0x03: return priv::ternary_intern<0x03>(a, b, c);
+                case 0x04: return priv::ternary_intern<0x02>(a, c, b);
+                case 0x05: return priv::ternary_intern<0x03>(a, c, b);
+                case 0x06: return priv::ternary_intern<0x06>(a, b, c);
+                case 0x07: return priv::ternary_intern<0x07>(a, b, c);
+                case 0x08: return priv::ternary_intern<0x08>(a, b, c);
+                case 0x09: return priv::ternary_intern<0x09>(a, b, c);
+                case 0x0a: return priv::ternary_intern<0x0a>(a, b, c);
+                case 0x0b: return priv::ternary_intern<0x0b>(a, b, c);
+                case 0x0c: return priv::ternary_intern<0x0a>(a, c, b);
+                case 0x0d: return priv::ternary_intern<0x0b>(a, c, b);
+                case 0x0e: return priv::ternary_intern<0x0e>(a, b, c);
+                case 0x0f: return priv::ternary_intern<0x0f>(a, b, c);
+                case 0x10: return priv::ternary_intern<0x02>(b, c, a);
+                case 0x11: return priv::ternary_intern<0x03>(b, c, a);
+                case 0x12: return priv::ternary_intern<0x06>(b, a, c);
+                case 0x13: return priv::ternary_intern<0x07>(b, a, c);
+                case 0x14: return priv::ternary_intern<0x06>(c, a, b);
+                case 0x15: return priv::ternary_intern<0x07>(c, a, b);
+                case 0x16: return priv::ternary_intern<0x16>(a, b, c);
+                case 0x17: return priv::ternary_intern<0x17>(a, b, c);
+                case 0x18: return priv::ternary_intern<0x18>(a, b, c);
+                case 0x19: return priv::ternary_intern<0x19>(a, b, c);
+                case 0x1a: return priv::ternary_intern<0x1a>(a, b, c);
+                case 0x1b: return priv::ternary_intern<0x1b>(a, b, c);
+                case 0x1c: return priv::ternary_intern<0x1a>(a, c, b);
+                case 0x1d: return priv::ternary_intern<0x1b>(a, c, b);
+                case 0x1e: return priv::ternary_intern<0x1e>(a, b, c);
+                case 0x1f: return priv::ternary_intern<0x1f>(a, b, c);
+                case 0x20: return priv::ternary_intern<0x08>(b, a, c);
+                case 0x21: return priv::ternary_intern<0x09>(b, a, c);
+                case 0x22: return priv::ternary_intern<0x0a>(b, a, c);
+                case 0x23: return priv::ternary_intern<0x0b>(b, a, c);
+                case 0x24: return priv::ternary_intern<0x18>(b, a, c);
+                case 0x25: return priv::ternary_intern<0x19>(b, a, c);
+                case 0x26: return priv::ternary_intern<0x1a>(b, a, c);
+                case 0x27: return priv::ternary_intern<0x1b>(b, a, c);
+                case 0x28: return priv::ternary_intern<0x28>(a, b, c);
+                case 0x29: return priv::ternary_intern<0x29>(a, b, c);
+                case 0x2a: return priv::ternary_intern<0x2a>(a, b, c);
+                case 0x2b: return priv::ternary_intern<0x2b>(a, b, c);
+                case 0x2c: return priv::ternary_intern<0x2c>(a, b, c);
+                case 0x2d: return priv::ternary_intern<0x2d>(a, b, c);
+                case 0x2e: return priv::ternary_intern<0x2e>(a, b, c);
+                case 0x2f: return priv::ternary_intern<0x2f>(a, b, c);
+                case 0x30: return priv::ternary_intern<0x0a>(b, c, a);
+                case 0x31: return priv::ternary_intern<0x0b>(b, c, a);
+                case 0x32: return priv::ternary_intern<0x0e>(b, a, c);
+                case 0x33: return priv::ternary_intern<0x0f>(b, a, c);
+                case 0x34: return priv::ternary_intern<0x1a>(b, c, a);
+                case 0x35: return priv::ternary_intern<0x1b>(b, c, a);
+                case 0x36: return priv::ternary_intern<0x1e>(b, a, c);
+                case 0x37: return priv::ternary_intern<0x1f>(b, a, c);
+                case 0x38: return priv::ternary_intern<0x2c>(b, a, c);
+                case 0x39: return priv::ternary_intern<0x2d>(b, a, c);
+                case 0x3a: return priv::ternary_intern<0x2e>(b, a, c);
+                case 0x3b: return priv::ternary_intern<0x2f>(b, a, c);
+                case 0x3c: return priv::ternary_intern<0x3c>(a, b, c);
+                case 0x3d: return priv::ternary_intern<0x3d>(a, b, c);
+                case 0x3e: return priv::ternary_intern<0x3e>(a, b, c);
+                case 0x3f: return priv::ternary_intern<0x3f>(a, b, c);
+                case 0x40: return priv::ternary_intern<0x08>(c, a, b);
+                case 0x41: return priv::ternary_intern<0x09>(c, a, b);
+                case 0x42: return priv::ternary_intern<0x18>(c, a, b);
+                case 0x43: return priv::ternary_intern<0x19>(c, a, b);
+                case 0x44: return priv::ternary_intern<0x0a>(c, a, b);
+                case 0x45: return priv::ternary_intern<0x0b>(c, a, b);
+                case 0x46: return priv::ternary_intern<0x1a>(c, a, b);
+                case 0x47: return priv::ternary_intern<0x1b>(c, a, b);
+                case 0x48: return priv::ternary_intern<0x28>(a, c, b);
+                case 0x49: return priv::ternary_intern<0x29>(a, c, b);
+                case 0x4a: return priv::ternary_intern<0x2c>(a, c, b);
+                case 0x4b: return priv::ternary_intern<0x2d>(a, c, b);
+                case 0x4c: return priv::ternary_intern<0x2a>(a, c, b);
+                case 0x4d: return priv::ternary_intern<0x2b>(a, c, b);
+                case 0x4e: return priv::ternary_intern<0x2e>(a, c, b);
+                case 0x4f: return priv::ternary_intern<0x2f>(a, c, b);
+                case 0x50: return priv::ternary_intern<0x0a>(c, b, a);
+                case 0x51: return priv::ternary_intern<0x0b>(c, b, a);
+                case 0x52: return priv::ternary_intern<0x1a>(c, b, a);
+                case 0x53: return priv::ternary_intern<0x1b>(c, b, a);
+                case 0x54: return priv::ternary_intern<0x0e>(c, a, b);
+                case 0x55: return priv::ternary_intern<0x0f>(c, a, b);
+                case 0x56: return priv::ternary_intern<0x1e>(c, a, b);
+                case 0x57: return priv::ternary_intern<0x1f>(c, a, b);
+                case 0x58: return priv::ternary_intern<0x2c>(c, a, b);
+                case 0x59: return priv::ternary_intern<0x2d>(c, a, b);
+                case 0x5a: return priv::ternary_intern<0x3c>(a, c, b);
+                case 0x5b: return priv::ternary_intern<0x3d>(a, c, b);
+                case 0x5c: return priv::ternary_intern<0x2e>(c, a, b);
+                case 0x5d: return priv::ternary_intern<0x2f>(c, a, b);
+                case 0x5e: return priv::ternary_intern<0x3e>(a, c, b);
+                case 0x5f: return priv::ternary_intern<0x3f>(a, c, b);
+                case 0x60: return priv::ternary_intern<0x28>(b, c, a);
+                case 0x61: return priv::ternary_intern<0x29>(b, c, a);
+                case 0x62: return priv::ternary_intern<0x2c>(b, c, a);
+                case 0x63: return priv::ternary_intern<0x2d>(b, c, a);
+                case 0x64: return priv::ternary_intern<0x2c>(c, b, a);
+                case 0x65: return priv::ternary_intern<0x2d>(c, b, a);
+                case 0x66: return priv::ternary_intern<0x3c>(b, c, a);
+                case 0x67: return priv::ternary_intern<0x3d>(b, c, a);
+                case 0x68: return priv::ternary_intern<0x68>(a, b, c);
+                case 0x69: return priv::ternary_intern<0x69>(a, b, c);
+                case 0x6a: return priv::ternary_intern<0x6a>(a, b, c);
+                case 0x6b: return priv::ternary_intern<0x6b>(a, b, c);
+                case 0x6c: return priv::ternary_intern<0x6a>(a, c, b);
+                case 0x6d: return priv::ternary_intern<0x6b>(a, c, b);
+                case 0x6e: return priv::ternary_intern<0x6e>(a, b, c);
+                case 0x6f: return priv::ternary_intern<0x6f>(a, b, c);
+                case 0x70: return priv::ternary_intern<0x2a>(b, c, a);
+                case 0x71: return priv::ternary_intern<0x2b>(b, c, a);
+                case 0x72: return priv::ternary_intern<0x2e>(b, c, a);
+                case 0x73: return priv::ternary_intern<0x2f>(b, c, a);
+                case 0x74: return priv::ternary_intern<0x2e>(c, b, a);
+                case 0x75: return priv::ternary_intern<0x2f>(c, b, a);
+                case 0x76: return priv::ternary_intern<0x3e>(b, c, a);
+                case 0x77: return priv::ternary_intern<0x3f>(b, c, a);
+                case 0x78: return priv::ternary_intern<0x6a>(b, c, a);
+                case 0x79: return priv::ternary_intern<0x6b>(b, c, a);
+                case 0x7a: return priv::ternary_intern<0x6e>(b, a, c);
+                case 0x7b: return priv::ternary_intern<0x6f>(b, a, c);
+                case 0x7c: return priv::ternary_intern<0x6e>(c, a, b);
+                case 0x7d: return priv::ternary_intern<0x6f>(c, a, b);
+                case 0x7e: return priv::ternary_intern<0x7e>(a, b, c);
+                case 0x7f: return priv::ternary_intern<0x7f>(a, b, c);
+                case 0x80: return priv::ternary_intern<0x80>(a, b, c);
+                case 0x81: return priv::ternary_intern<0x81>(a, b, c);
+                case 0x82: return priv::ternary_intern<0x82>(a, b, c);
+                case 0x83: return priv::ternary_intern<0x83>(a, b, c);
+                case 0x84: return priv::ternary_intern<0x82>(a, c, b);
+                case 0x85: return priv::ternary_intern<0x83>(a, c, b);
+                case 0x86: return priv::ternary_intern<0x86>(a, b, c);
+                case 0x87: return priv::ternary_intern<0x87>(a, b, c);
+                case 0x88: return priv::ternary_intern<0x88>(a, b, c);
+                case 0x89: return priv::ternary_intern<0x89>(a, b, c);
+                case 0x8a: return priv::ternary_intern<0x8a>(a, b, c);
+                case 0x8b: return priv::ternary_intern<0x8b>(a, b, c);
+                case 0x8c: return priv::ternary_intern<0x8a>(a, c, b);
+                case 0x8d: return priv::ternary_intern<0x8b>(a, c, b);
+                case 0x8e: return priv::ternary_intern<0x8e>(a, b, c);
+                case 0x8f: return priv::ternary_intern<0x8f>(a, b, c);
+                case 0x90: return priv::ternary_intern<0x82>(b, c, a);
+                case 0x91: return priv::ternary_intern<0x83>(b, c, a);
+                case 0x92: return priv::ternary_intern<0x86>(b, a, c);
+                case 0x93: return priv::ternary_intern<0x87>(b, a, c);
+                case 0x94: return priv::ternary_intern<0x86>(c, a, b);
+                case 0x95: return priv::ternary_intern<0x87>(c, a, b);
+                case 0x96: return priv::ternary_intern<0x96>(a, b, c);
+                case 0x97: return priv::ternary_intern<0x97>(a, b, c);
+                case 0x98: return priv::ternary_intern<0x98>(a, b, c);
+                case 0x99: return priv::ternary_intern<0x99>(a, b, c);
+                case 0x9a: return priv::ternary_intern<0x9a>(a, b, c);
+                case 0x9b: return priv::ternary_intern<0x9b>(a, b, c);
+                case 0x9c: return priv::ternary_intern<0x9a>(a, c, b);
+                case 0x9d: return priv::ternary_intern<0x9b>(a, c, b);
+                case 0x9e: return priv::ternary_intern<0x9e>(a, b, c);
+                case 0x9f: return priv::ternary_intern<0x9f>(a, b, c);
+                case 0xa0: return priv::ternary_intern<0x88>(b, a, c);
+                case 0xa1: return priv::ternary_intern<0x89>(b, a, c);
+                case 0xa2: return priv::ternary_intern<0x8a>(b, a, c);
+                case 0xa3: return priv::ternary_intern<0x8b>(b, a, c);
+                case 0xa4: return priv::ternary_intern<0x98>(b, a, c);
+                case 0xa5: return priv::ternary_intern<0x99>(b, a, c);
+                case 0xa6: return priv::ternary_intern<0x9a>(b, a, c);
+                case 0xa7: return priv::ternary_intern<0x9b>(b, a, c);
+                case 0xa8: return priv::ternary_intern<0xa8>(a, b, c);
+                case 0xa9: return priv::ternary_intern<0xa9>(a, b, c);
+                case 0xaa: return priv::ternary_intern<0xaa>(a, b, c);
+                case 0xab: return priv::ternary_intern<0xab>(a, b, c);
+                case 0xac: return priv::ternary_intern<0xac>(a, b, c);
+                case 0xad: return priv::ternary_intern<0xad>(a, b, c);
+                case 0xae: return priv::ternary_intern<0xae>(a, b, c);
+                case 0xaf: return priv::ternary_intern<0xaf>(a, b, c);
+                case 0xb0: return priv::ternary_intern<0x8a>(b, c, a);
+                case 0xb1: return priv::ternary_intern<0x8b>(b, c, a);
+                case 0xb2: return priv::ternary_intern<0x8e>(b, a, c);
+                case 0xb3: return priv::ternary_intern<0x8f>(b, a, c);
+                case 0xb4: return priv::ternary_intern<0x9a>(b, c, a);
+                case 0xb5: return priv::ternary_intern<0x9b>(b, c, a);
+                case 0xb6: return priv::ternary_intern<0x9e>(b, a, c);
+                case 0xb7: return priv::ternary_intern<0x9f>(b, a, c);
+                case 0xb8: return priv::ternary_intern<0xac>(b, a, c);
+                case 0xb9: return priv::ternary_intern<0xad>(b, a, c);
+                case 0xba: return priv::ternary_intern<0xae>(b, a, c);
+                case 0xbb: return priv::ternary_intern<0xaf>(b, a, c);
+                case 0xbc: return priv::ternary_intern<0xbc>(a, b, c);
+                case 0xbd: return priv::ternary_intern<0xbd>(a, b, c);
+                case 0xbe: return priv::ternary_intern<0xbe>(a, b, c);
+                case 0xbf: return priv::ternary_intern<0xbf>(a, b, c);
+                case 0xc0: return priv::ternary_intern<0x88>(c, a, b);
+                case 0xc1: return priv::ternary_intern<0x89>(c, a, b);
+                case 0xc2: return priv::ternary_intern<0x98>(c, a, b);
+                case 0xc3: return priv::ternary_intern<0x99>(c, a, b);
+                case 0xc4: return priv::ternary_intern<0x8a>(c, a, b);
+                case 0xc5: return priv::ternary_intern<0x8b>(c, a, b);
+                case 0xc6: return priv::ternary_intern<0x9a>(c, a, b);
+                case 0xc7: return priv::ternary_intern<0x9b>(c, a, b);
+                case 0xc8: return priv::ternary_intern<0xa8>(a, c, b);
+                case 0xc9: return priv::ternary_intern<0xa9>(a, c, b);
+                case 0xca: return priv::ternary_intern<0xac>(a, c, b);
+                case 0xcb: return priv::ternary_intern<0xad>(a, c, b);
+                case 0xcc: return priv::ternary_intern<0xaa>(a, c, b);
+                case 0xcd: return priv::ternary_intern<0xab>(a, c, b);
+                case 0xce: return priv::ternary_intern<0xae>(a, c, b);
+                case 0xcf: return priv::ternary_intern<0xaf>(a, c, b);
+                case 0xd0: return priv::ternary_intern<0x8a>(c, b, a);
+                case 0xd1: return priv::ternary_intern<0x8b>(c, b, a);
+                case 0xd2: return priv::ternary_intern<0x9a>(c, b, a);
+                case 0xd3: return priv::ternary_intern<0x9b>(c, b, a);
+                case 0xd4: return priv::ternary_intern<0x8e>(c, a, b);
+                case 0xd5: return priv::ternary_intern<0x8f>(c, a, b);
+                case 0xd6: return priv::ternary_intern<0x9e>(c, a, b);
+                case 0xd7: return priv::ternary_intern<0x9f>(c, a, b);
+                case 0xd8: return priv::ternary_intern<0xac>(c, a, b);
+                case 0xd9: return priv::ternary_intern<0xad>(c, a, b);
+                case 0xda: return priv::ternary_intern<0xbc>(a, c, b);
+                case 0xdb: return priv::ternary_intern<0xbd>(a, c, b);
+                case 0xdc: return priv::ternary_intern<0xae>(c, a, b);
+                case 0xdd: return priv::ternary_intern<0xaf>(c, a, b);
+                case 0xde: return priv::ternary_intern<0xbe>(a, c, b);
+                case 0xdf: return priv::ternary_intern<0xbf>(a, c, b);
+                case 0xe0: return priv::ternary_intern<0xa8>(b, c, a);
+                case 0xe1: return priv::ternary_intern<0xa9>(b, c, a);
+                case 0xe2: return priv::ternary_intern<0xac>(b, c, a);
+                case 0xe3: return priv::ternary_intern<0xad>(b, c, a);
+                case 0xe4: return priv::ternary_intern<0xac>(c, b, a);
+                case 0xe5: return priv::ternary_intern<0xad>(c, b, a);
+                case 0xe6: return priv::ternary_intern<0xbc>(b, c, a);
+                case 0xe7: return priv::ternary_intern<0xbd>(b, c, a);
+                case 0xe8: return priv::ternary_intern<0xe8>(a, b, c);
+                case 0xe9: return priv::ternary_intern<0xe9>(a, b, c);
+                case 0xea: return priv::ternary_intern<0xea>(a, b, c);
+                case 0xeb: return priv::ternary_intern<0xeb>(a, b, c);
+                case 0xec: return priv::ternary_intern<0xea>(a, c, b);
+                case 0xed: return priv::ternary_intern<0xeb>(a, c, b);
+                case 0xee: return priv::ternary_intern<0xee>(a, b, c);
+                case 0xef: return priv::ternary_intern<0xef>(a, b, c);
+                case 0xf0: return priv::ternary_intern<0xaa>(b, c, a);
+                case 0xf1: return priv::ternary_intern<0xab>(b, c, a);
+                case 0xf2: return priv::ternary_intern<0xae>(b, c, a);
+                case 0xf3: return priv::ternary_intern<0xaf>(b, c, a);
+                case 0xf4: return priv::ternary_intern<0xae>(c, b, a);
+                case 0xf5: return priv::ternary_intern<0xaf>(c, b, a);
+                case 0xf6: return priv::ternary_intern<0xbe>(b, c, a);
+                case 0xf7: return priv::ternary_intern<0xbf>(b, c, a);
+                case 0xf8: return priv::ternary_intern<0xea>(b, c, a);
+                case 0xf9: return priv::ternary_intern<0xeb>(b, c, a);
+                case 0xfa: return priv::ternary_intern<0xee>(b, a, c);
+                case 0xfb: return priv::ternary_intern<0xef>(b, a, c);
+                case 0xfc: return priv::ternary_intern<0xee>(c, a, b);
+                case 0xfd: return priv::ternary_intern<0xef>(c, a, b);
+                case 0xfe: return priv::ternary_intern<0xfe>(a, b, c);
+                case 0xff: return priv::ternary_intern<0xff>(a, b, c);
+                default: return priv::ternary_intern<0>(a, b, c);
+            }
+        }
+#endif
+
+        // kernels of ternary_sse.cpp
+        constexpr reduction reduced_sse[256] = {
+            { 0x00, order::abc }, // 0x00
+            { 0x01, order::abc }, // 0x01
+            { 0x02, order::abc }, // 0x02
+            { 0x03, order::abc }, // 0x03
+            { 0x02, order::acb }, // 0x04
+            { 0x03, order::acb }, // 0x05
+            { 0x06, order::abc }, // 0x06
+            { 0x07, order::abc }, // 0x07
+            { 0x08, order::abc }, // 0x08
+            { 0x09, order::abc }, // 0x09
+            { 0x0a, order::abc }, // 0x0a
+            { 0x0b, order::abc }, // 0x0b
+            { 0x0a, order::acb }, // 0x0c
+            { 0x0b, order::acb }, // 0x0d
+            { 0x0e, order::abc }, // 0x0e
+            { 0x0f, order::abc }, // 0x0f
+            { 0x02, order::bca }, // 0x10
+            { 0x03, order::bca }, // 0x11
+            { 0x06, order::bac }, // 0x12
+            { 0x07, order::bac }, // 0x13
+            { 0x06, order::cab }, // 0x14
+            { 0x07, order::cab }, // 0x15
+            { 0x16, order::abc }, // 0x16
+            { 0x17, order::abc }, // 0x17
+            { 0x18, order::abc }, // 0x18
+            { 0x19, order::abc }, // 0x19
+            { 0x1a, order::abc }, // 0x1a
+            { 0x1b, order::abc }, // 0x1b
+            { 0x1a, order::acb }, // 0x1c
+            { 0x1b, order::acb }, // 0x1d
+            { 0x1e, order::abc }, // 0x1e
+            { 0x1f, order::abc }, // 0x1f
+            { 0x08, order::bac }, // 0x20
+            { 0x09, order::bac }, // 0x21
+            { 0x0a, order::bac }, // 0x22
+            { 0x0b, order::bac }, // 0x23
+            { 0x18, order::bac }, // 0x24
+            { 0x19, order::bac }, // 0x25
+            { 0x1a, order::bac }, // 0x26
+            { 0x1b, order::bac }, // 0x27
+            { 0x28, order::abc }, // 0x28
+            { 0x29, order::abc }, // 0x29
+            { 0x2a, order::abc }, // 0x2a
+            { 0x2b, order::abc }, // 0x2b
+            { 0x2c, order::abc }, // 0x2c
+            { 0x2d, order::abc }, // 0x2d
+            { 0x2e, order::abc }, // 0x2e
+            { 0x2f, order::abc }, // 0x2f
+            { 0x0a, order::bca }, // 0x30
+            { 0x0b, order::bca }, // 0x31
+            { 0x0e, order::bac }, // 0x32
+            { 0x0f, order::bac }, // 0x33
+            { 0x1a, order::bca }, // 0x34
+            { 0x1b, order::bca }, // 0x35
+            { 0x1e, order::bac }, // 0x36
+            { 0x1f, order::bac }, // 0x37
+            { 0x2c, order::bac }, // 0x38
+            { 0x2d, order::bac }, // 0x39
+            { 0x2e, order::bac }, // 0x3a
+            { 0x2f, order::bac }, // 0x3b
+            { 0x3c, order::abc }, // 0x3c
+            { 0x3d, order::abc }, // 0x3d
+            { 0x3e, order::abc }, // 0x3e
+            { 0x3f, order::abc }, // 0x3f
+            { 0x08, order::cab }, // 0x40
+            { 0x09, order::cab }, // 0x41
+            { 0x18, order::cab }, // 0x42
+            { 0x19, order::cab }, // 0x43
+            { 0x0a, order::cab }, // 0x44
+            { 0x0b, order::cab }, // 0x45
+            { 0x1a, order::cab }, // 0x46
+            { 0x1b, order::cab }, // 0x47
+            { 0x28, order::acb }, // 0x48
+            { 0x29, order::acb }, // 0x49
+            { 0x2c, order::acb }, // 0x4a
+            { 0x2d, order::acb }, // 0x4b
+            { 0x2a, order::acb }, // 0x4c
+            { 0x2b, order::acb }, // 0x4d
+            { 0x2e, order::acb }, // 0x4e
+            { 0x2f, order::acb }, // 0x4f
+            { 0x0a, order::cba }, // 0x50
+            { 0x0b, order::cba }, // 0x51
+            { 0x1a, order::cba }, // 0x52
+            { 0x1b, order::cba }, // 0x53
+            { 0x0e, order::cab }, // 0x54
+            { 0x0f, order::cab }, // 0x55
+            { 0x1e, order::cab }, // 0x56
+            { 0x1f, order::cab }, // 0x57
+            { 0x2c, order::cab }, // 0x58
+            { 0x2d, order::cab }, // 0x59
+            { 0x3c, order::acb }, // 0x5a
+            { 0x3d, order::acb }, // 0x5b
+            { 0x2e, order::cab }, // 0x5c
+            { 0x2f, order::cab }, // 0x5d
+            { 0x3e, order::acb }, // 0x5e
+            { 0x3f, order::acb }, // 0x5f
+            { 0x28, order::bca }, // 0x60
+            { 0x29, order::bca }, // 0x61
+            { 0x2c, order::bca }, // 0x62
+            { 0x2d, order::bca }, // 0x63
+            { 0x2c, order::cba }, // 0x64
+            { 0x2d, order::cba }, // 0x65
+            { 0x3c, order::bca }, // 0x66
+            { 0x3d, order::bca }, // 0x67
+            { 0x68, order::abc }, // 0x68
+            { 0x69, order::abc }, // 0x69
+            { 0x6a, order::abc }, // 0x6a
+            { 0x6b, order::abc }, // 0x6b
+            { 0x6a, order::acb }, // 0x6c
+            { 0x6b, order::acb }, // 0x6d
+            { 0x6e, order::abc }, // 0x6e
+            { 0x6f, order::abc }, // 0x6f
+            { 0x2a, order::bca }, // 0x70
+            { 0x2b, order::bca }, // 0x71
+            { 0x2e, order::bca }, // 0x72
+            { 0x2f, order::bca }, // 0x73
+            { 0x2e, order::cba }, // 0x74
+            { 0x2f, order::cba }, // 0x75
+            { 0x3e, order::bca }, // 0x76
+            { 0x3f, order::bca }, // 0x77
+            { 0x6a, order::bca }, // 0x78
+            { 0x6b, order::bca }, // 0x79
+            { 0x6e, order::bac }, // 0x7a
+            { 0x6f, order::bac }, // 0x7b
+            { 0x6e, order::cab }, // 0x7c
+            { 0x6f, order::cab }, // 0x7d
+            { 0x7e, order::abc }, // 0x7e
+            { 0x7f, order::abc }, // 0x7f
+            { 0x80, order::abc }, // 0x80
+            { 0x81, order::abc }, // 0x81
+            { 0x82, order::abc }, // 0x82
+            { 0x83, order::abc }, // 0x83
+            { 0x82, order::acb }, // 0x84
+            { 0x83, order::acb }, // 0x85
+            { 0x86, order::abc }, // 0x86
+            { 0x87, order::abc }, // 0x87
+            { 0x88, order::abc }, // 0x88
+            { 0x89, order::abc }, // 0x89
+            { 0x8a, order::abc }, // 0x8a
+            { 0x8b, order::abc }, // 0x8b
+            { 0x8a, order::acb }, // 0x8c
+            { 0x8b, order::acb }, // 0x8d
+            { 0x8e, order::abc }, // 0x8e
+            { 0x8f, order::abc }, // 0x8f
+            { 0x82, order::bca }, // 0x90
+            { 0x83, order::bca }, // 0x91
+            { 0x86, order::bac }, // 0x92
+            { 0x87, order::bac }, // 0x93
+            { 0x86, order::cab }, // 0x94
+            { 0x87, order::cab }, // 0x95
+            { 0x96, order::abc }, // 0x96
+            { 0x97, order::abc }, // 0x97
+            { 0x98, order::abc }, // 0x98
+            { 0x99, order::abc }, // 0x99
+            { 0x9a, order::abc }, // 0x9a
+            { 0x9b, order::abc }, // 0x9b
+            { 0x9a, order::acb }, // 0x9c
+            { 0x9b, order::acb }, // 0x9d
+            { 0x9e, order::abc }, // 0x9e
+            { 0x9f, order::abc }, // 0x9f
+            { 0x88, order::bac }, // 0xa0
+            { 0x89, order::bac }, // 0xa1
+            { 0x8a, order::bac }, // 0xa2
+            { 0x8b, order::bac }, // 0xa3
+            { 0x98, order::bac }, // 0xa4
+            { 0x99, order::bac }, // 0xa5
+            { 0x9a, order::bac }, // 0xa6
+            { 0x9b, order::bac }, // 0xa7
+            { 0xa8, order::abc }, // 0xa8
+            { 0xa9, order::abc }, // 0xa9
+            { 0xaa, order::abc }, // 0xaa
+            { 0xab, order::abc }, // 0xab
+            { 0xac, order::abc }, // 0xac
+            { 0xad, order::abc }, // 0xad
+            { 0xae, order::abc }, // 0xae
+            { 0xaf, order::abc }, // 0xaf
+            { 0x8a, order::bca }, // 0xb0
+            { 0x8b, order::bca }, // 0xb1
+            { 0x8e, order::bac }, // 0xb2
+            { 0x8f, order::bac }, // 0xb3
+            { 0x9a, order::bca }, // 0xb4
+            { 0x9b, order::bca }, // 0xb5
+            { 0x9e, order::bac }, // 0xb6
+            { 0x9f, order::bac }, // 0xb7
+            { 0xac, order::bac }, // 0xb8
+            { 0xad, order::bac }, // 0xb9
+            { 0xae, order::bac }, // 0xba
+            { 0xaf, order::bac }, // 0xbb
+            { 0xbc, order::abc }, // 0xbc
+            { 0xbd, order::abc }, // 0xbd
+            { 0xbe, order::abc }, // 0xbe
+            { 0xbf, order::abc }, // 0xbf
+            { 0x88, order::cab }, // 0xc0
+            { 0x89, order::cab }, // 0xc1
+            { 0x98, order::cab }, // 0xc2
+            { 0x99, order::cab }, // 0xc3
+            { 0x8a, order::cab }, // 0xc4
+            { 0x8b, order::cab }, // 0xc5
+            { 0x9a, order::cab }, // 0xc6
+            { 0x9b, order::cab }, // 0xc7
+            { 0xa8, order::acb }, // 0xc8
+            { 0xa9, order::acb }, // 0xc9
+            { 0xac, order::acb }, // 0xca
+            { 0xad, order::acb }, // 0xcb
+            { 0xaa, order::acb }, // 0xcc
+            { 0xab, order::acb }, // 0xcd
+            { 0xae, order::acb }, // 0xce
+            { 0xaf, order::acb }, // 0xcf
+            { 0x8a, order::cba }, // 0xd0
+            { 0x8b, order::cba }, // 0xd1
+            { 0x9a, order::cba }, // 0xd2
+            { 0x9b, order::cba }, // 0xd3
+            { 0x8e, order::cab }, // 0xd4
+            { 0x8f, order::cab }, // 0xd5
+            { 0x9e, order::cab }, // 0xd6
+            { 0x9f, order::cab }, // 0xd7
+            { 0xac, order::cab }, // 0xd8
+            { 0xad, order::cab }, // 0xd9
+            { 0xbc, order::acb }, // 0xda
+            { 0xbd, order::acb }, // 0xdb
+            { 0xae, order::cab }, // 0xdc
+            { 0xaf, order::cab }, // 0xdd
+            { 0xbe, order::acb }, // 0xde
+            { 0xbf, order::acb }, // 0xdf
+            { 0xa8, order::bca }, // 0xe0
+            { 0xa9, order::bca }, // 0xe1
+            { 0xac, order::bca }, // 0xe2
+            { 0xad, order::bca }, // 0xe3
+            { 0xac, order::cba }, // 0xe4
+            { 0xad, order::cba }, // 0xe5
+            { 0xbc, order::bca }, // 0xe6
+            { 0xbd, order::bca }, // 0xe7
+            { 0xe8, order::abc }, // 0xe8
+            { 0xe9, order::abc }, // 0xe9
+            { 0xea, order::abc }, // 0xea
+            { 0xeb, order::abc }, // 0xeb
+            { 0xea, order::acb }, // 0xec
+            { 0xeb, order::acb }, // 0xed
+            { 0xee, order::abc }, // 0xee
+            { 0xef, order::abc }, // 0xef
+            { 0xaa, order::bca }, // 0xf0
+            { 0xab, order::bca }, // 0xf1
+            { 0xae, order::bca }, // 0xf2
+            { 0xaf, order::bca }, // 0xf3
+            { 0xae, order::cba }, // 0xf4
+            { 0xaf, order::cba }, // 0xf5
+            { 0xbe, order::bca }, // 0xf6
+            { 0xbf, order::bca }, // 0xf7
+            { 0xea, order::bca }, // 0xf8
+            { 0xeb, order::bca }, // 0xf9
+            { 0xee, order::bac }, // 0xfa
+            { 0xef, order::bac }, // 0xfb
+            { 0xee, order::cab }, // 0xfc
+            { 0xef, order::cab }, // 0xfd
+            { 0xfe, order::abc }, // 0xfe
+            { 0xff, order::abc }, // 0xff
+        };
+#ifdef TERNARYLOGIC_TESTS
+        static_assert(valid_reduction(reduced_sse), "invalid reduction of sse");
+#endif
+
+        template<>
+        [[nodiscard]] constexpr __m128i ternary_reduced<__m128i>(const __m128i& a, const __m128i& b, const __m128i& c, const bf_type k) noexcept {
+            switch (k) {
+                case 0x00: return priv::ternary_intern<0x00>(a, b, c);
+                case 0x01: return priv::ternary_intern<0x01>(a, b, c);
+                case 0x02: return priv::ternary_intern<0x02>(a, b, c);
+                case 0x03: return priv::ternary_intern<0x03>(a, b, c);
+                case 0x04: return priv::ternary_intern<0x02>(a, c, b);
+                case 0x05: return priv::ternary_intern<0x03>(a, c, b);
+                case 0x06: return priv::ternary_intern<0x06>(a, b, c);
+                case 0x07: return priv::ternary_intern<0x07>(a, b, c);
+                case 0x08: return priv::ternary_intern<0x08>(a, b, c);
+                case 0x09: return priv::ternary_intern<0x09>(a, b, c);
+                case 0x0a: return priv::ternary_intern<0x0a>(a, b, c);
+                case 0x0b: return priv::ternary_intern<0x0b>(a, b, c);
+                case 0x0c: return priv::ternary_intern<0x0a>(a, c, b);
+                case 0x0d: return priv::ternary_intern<0x0b>(a, c, b);
+                case 0x0e: return priv::ternary_intern<0x0e>(a, b, c);
+                case 0x0f: return priv::ternary_intern<0x0f>(a, b, c);
+                case 0x10: return priv::ternary_intern<0x02>(b, c, a);
+                case 0x11: return priv::ternary_intern<0x03>(b, c, a);
+                case 0x12: return priv::ternary_intern<0x06>(b, a, c);
+                case 0x13: return priv::ternary_intern<0x07>(b, a, c);
+                case 0x14: return priv::ternary_intern<0x06>(c, a, b);
+                case 0x15: return priv::ternary_intern<0x07>(c, a, b);
+                case 0x16: return priv::ternary_intern<0x16>(a, b, c);
+                case 0x17: return priv::ternary_intern<0x17>(a, b, c);
+                case 0x18: return priv::ternary_intern<0x18>(a, b, c);
+                case 0x19: return priv::ternary_intern<0x19>(a, b, c);
+                case 0x1a: return priv::ternary_intern<0x1a>(a, b, c);
+                case 0x1b: return priv::ternary_intern<0x1b>(a, b, c);
+                case 0x1c: return priv::ternary_intern<0x1a>(a, c, b);
+                case 0x1d: return priv::ternary_intern<0x1b>(a, c, b);
+                case 0x1e: return priv::ternary_intern<0x1e>(a, b, c);
+                case 0x1f: return priv::ternary_intern<0x1f>(a, b, c);
+                case 0x20: return priv::ternary_intern<0x08>(b, a, c);
+                case 0x21: return priv::ternary_intern<0x09>(b, a, c);
+                case 0x22: return priv::ternary_intern<0x0a>(b, a, c);
+                case 0x23: return priv::ternary_intern<0x0b>(b, a, c);
+                case 0x24: return priv::ternary_intern<0x18>(b, a, c);
+                case 0x25: return priv::ternary_intern<0x19>(b, a, c);
+                case 0x26: return priv::ternary_intern<0x1a>(b, a, c);
+                case 0x27: return priv::ternary_intern<0x1b>(b, a, c);
+                case 0x28: return priv::ternary_intern<0x28>(a, b, c);
+                case 0x29: return priv::ternary_intern<0x29>(a, b, c);
+                case 0x2a: return priv::ternary_intern<0x2a>(a, b, c);
+                case 0x2b: return priv::ternary_intern<0x2b>(a, b, c);
+                case 0x2c: return priv::ternary_intern<0x2c>(a, b, c);
+                case 0x2d: return priv::ternary_intern<0x2d>(a, b, c);
+                case 0x2e: return priv::ternary_intern<0x2e>(a, b, c);
+                case 0x2f: return priv::ternary_intern<0x2f>(a, b, c);
+                case 0x30: return priv::ternary_intern<0x0a>(b, c, a);
+                case 0x31: return priv::ternary_intern<0x0b>(b, c, a);
+                case 0x32: return priv::ternary_intern<0x0e>(b, a, c);
+                case 0x33: return priv::ternary_intern<0x0f>(b, a, c);
+                case 0x34: return priv::ternary_intern<0x1a>(b, c, a);
+                case 0x35: return priv::ternary_intern<0x1b>(b, c, a);
+                case 0x36: return priv::ternary_intern<0x1e>(b, a, c);
+                case 0x37: return priv::ternary_intern<0x1f>(b, a, c);
+                case 0x38: return priv::ternary_intern<0x2c>(b, a, c);
+                case 0x39: return priv::ternary_intern<0x2d>(b, a, c);
+                case 0x3a: return priv::ternary_intern<0x2e>(b, a, c);
+                case 0x3b: return priv::ternary_intern<0x2f>(b, a, c);
+                case 0x3c: return priv::ternary_intern<0x3c>(a, b, c);
+                case 0x3d: return priv::ternary_intern<0x3d>(a, b, c);
+                case 0x3e: return priv::ternary_intern<0x3e>(a, b, c);
+                case 0x3f: return priv::ternary_intern<0x3f>(a, b, c);
+                case 0x40: return priv::ternary_intern<0x08>(c, a, b);
+                case 0x41: return priv::ternary_intern<0x09>(c, a, b);
+                case 0x42: return priv::ternary_intern<0x18>(c, a, b);
+                case 0x43: return priv::ternary_intern<0x19>(c, a, b);
+                case 0x44: return priv::ternary_intern<0x0a>(c, a, b);
+                case 0x45: return priv::ternary_intern<0x0b>(c, a, b);
+                case 0x46: return priv::ternary_intern<0x1a>(c, a, b);
+                case 0x47: return priv::ternary_intern<0x1b>(c, a, b);
+                case 0x48: return priv::ternary_intern<0x28>(a, c, b);
+                case 0x49: return priv::ternary_intern<0x29>(a, c, b);
+                case 0x4a: return priv::ternary_intern<0x2c>(a, c, b);
+                case 0x4b: return priv::ternary_intern<0x2d>(a, c, b);
+                case 0x4c: return priv::ternary_intern<0x2a>(a, c, b);
+                case 0x4d: return priv::ternary_intern<0x2b>(a, c, b);
+                case 0x4e: return priv::ternary_intern<0x2e>(a, c, b);
+                case 0x4f: return priv::ternary_intern<0x2f>(a, c, b);
+                case 0x50: return priv::ternary_intern<0x0a>(c, b, a);
+                case 0x51: return priv::ternary_intern<0x0b>(c, b, a);
+                case 0x52: return priv::ternary_intern<0x1a>(c, b, a);
+                case 0x53: return priv::ternary_intern<0x1b>(c, b, a);
+                case 0x54: return priv::ternary_intern<0x0e>(c, a, b);
+                case 0x55: return priv::ternary_intern<0x0f>(c, a, b);
+                case 0x56: return priv::ternary_intern<0x1e>(c, a, b);
+                case 0x57: return priv::ternary_intern<0x1f>(c, a, b);
+                case 0x58: return priv::ternary_intern<0x2c>(c, a, b);
+                case 0x59: return priv::ternary_intern<0x2d>(c, a, b);
+                case 0x5a: return priv::ternary_intern<0x3c>(a, c, b);
+                case 0x5b: return priv::ternary_intern<0x3d>(a, c, b);
+                case 0x5c: return priv::ternary_intern<0x2e>(c, a, b);
+                case 0x5d: return priv::ternary_intern<0x2f>(c, a, b);
+                case 0x5e: return priv::ternary_intern<0x3e>(a, c, b);
+                case 0x5f: return priv::ternary_intern<0x3f>(a, c, b);
+                case 0x60: return priv::ternary_intern<0x28>(b, c, a);
+                case 0x61: return priv::ternary_intern<0x29>(b, c, a);
+                case 0x62: return priv::ternary_intern<0x2c>(b, c, a);
+                case 0x63: return priv::ternary_intern<0x2d>(b, c, a);
+                case 0x64: return priv::ternary_intern<0x2c>(c, b, a);
+                case 0x65: return priv::ternary_intern<0x2d>(c, b, a);
+                case 0x66: return priv::ternary_intern<0x3c>(b, c, a);
+                case 0x67: return priv::ternary_intern<0x3d>(b, c, a);
+                case 0x68: return priv::ternary_intern<0x68>(a, b, c);
+                case 0x69: return priv::ternary_intern<0x69>(a, b, c);
+                case 0x6a: return priv::ternary_intern<0x6a>(a, b, c);
+                case 0x6b: return priv::ternary_intern<0x6b>(a, b, c);
+                case 0x6c: return priv::ternary_intern<0x6a>(a, c, b);
+                case 0x6d: return priv::ternary_intern<0x6b>(a, c, b);
+                case 0x6e: return priv::ternary_intern<0x6e>(a, b, c);
+                case 0x6f: return priv::ternary_intern<0x6f>(a, b, c);
+                case 0x70: return priv::ternary_intern<0x2a>(b, c, a);
+                case 0x71: return priv::ternary_intern<0x2b>(b, c, a);
+                case 0x72: return priv::ternary_intern<0x2e>(b, c, a);
+                case 0x73: return priv::ternary_intern<0x2f>(b, c, a);
+                case 0x74: return priv::ternary_intern<0x2e>(c, b, a);
+                case 0x75: return priv::ternary_intern<0x2f>(c, b, a);
+                case 0x76: return priv::ternary_intern<0x3e>(b, c, a);
+                case 0x77: return priv::ternary_intern<0x3f>(b, c, a);
+                case 0x78: return priv::ternary_intern<0x6a>(b, c, a);
+                case 0x79: return priv::ternary_intern<0x6b>(b, c, a);
+                case 0x7a: return priv::ternary_intern<0x6e>(b, a, c);
+                case 0x7b: return priv::ternary_intern<0x6f>(b, a, c);
+                case 0x7c: return priv::ternary_intern<0x6e>(c, a, b);
+                case 0x7d: return priv::ternary_intern<0x6f>(c, a, b);
+                case 0x7e: return priv::ternary_intern<0x7e>(a, b, c);
+                case 0x7f: return priv::ternary_intern<0x7f>(a, b, c);
+                case 0x80: return priv::ternary_intern<0x80>(a, b, c);
+                case 0x81: return priv::ternary_intern<0x81>(a, b, c);
+                case 0x82: return priv::ternary_intern<0x82>(a, b, c);
+                case 0x83: return priv::ternary_intern<0x83>(a, b, c);
+                case 0x84: return priv::ternary_intern<0x82>(a, c, b);
+                case 0x85: return priv::ternary_intern<0x83>(a, c, b);
+                case 0x86: return priv::ternary_intern<0x86>(a, b, c);
+                case 0x87: return priv::ternary_intern<0x87>(a, b, c);
+                case 0x88: return priv::ternary_intern<0x88>(a, b, c);
+                case 0x89: return priv::ternary_intern<0x89>(a, b, c);
+                case 0x8a: return priv::ternary_intern<0x8a>(a, b, c);
+                case 0x8b: return priv::ternary_intern<0x8b>(a, b, c);
+                case 0x8c: return priv::ternary_intern<0x8a>(a, c, b);
+                case 0x8d: return priv::ternary_intern<0x8b>(a, c, b);
+                case 0x8e: return priv::ternary_intern<0x8e>(a, b, c);
+                case 0x8f: return priv::ternary_intern<0x8f>(a, b, c);
+                case 0x90: return priv::ternary_intern<0x82>(b, c, a);
+                case 0x91: return priv::ternary_intern<0x83>(b, c, a);
+                case 0x92: return priv::ternary_intern<0x86>(b, a, c);
+                case 0x93: return priv::ternary_intern<0x87>(b, a, c);
+                case 0x94: return priv::ternary_intern<0x86>(c, a, b);
+                case 0x95: return priv::ternary_intern<0x87>(c, a, b);
+                case 0x96: return priv::ternary_intern<0x96>(a, b, c);
+                case 0x97: return priv::ternary_intern<0x97>(a, b, c);
+                case 0x98: return priv::ternary_intern<0x98>(a, b, c);
+                case 0x99: return priv::ternary_intern<0x99>(a, b, c);
+                case 0x9a: return priv::ternary_intern<0x9a>(a, b, c);
+                case 0x9b: return priv::ternary_intern<0x9b>(a, b, c);
+                case 0x9c: return priv::ternary_intern<0x9a>(a, c, b);
+                case 0x9d: return priv::ternary_intern<0x9b>(a, c, b);
+                case 0x9e: return priv::ternary_intern<0x9e>(a, b, c);
+                case 0x9f: return priv::ternary_intern<0x9f>(a, b, c);
+                case 0xa0: return priv::ternary_intern<0x88>(b, a, c);
+                case 0xa1: return priv::ternary_intern<0x89>(b, a, c);
+                case 0xa2: return priv::ternary_intern<0x8a>(b, a, c);
+                case 0xa3: return priv::ternary_intern<0x8b>(b, a, c);
+                case 0xa4: return priv::ternary_intern<0x98>(b, a, c);
+                case 0xa5: return priv::ternary_intern<0x99>(b, a, c);
+                case 0xa6: return priv::ternary_intern<0x9a>(b, a, c);
+                case 0xa7: return priv::ternary_intern<0x9b>(b, a, c);
+                case 0xa8: return priv::ternary_intern<0xa8>(a, b, c);
+                case 0xa9: return priv::ternary_intern<0xa9>(a, b, c);
+                case 0xaa: return priv::ternary_intern<0xaa>(a, b, c);
+                case 0xab: return priv::ternary_intern<0xab>(a, b, c);
+                case 0xac: return priv::ternary_intern<0xac>(a, b, c);
+                case 0xad: return priv::ternary_intern<0xad>(a, b, c);
+                case 0xae: return priv::ternary_intern<0xae>(a, b, c);
+                case 0xaf: return priv::ternary_intern<0xaf>(a, b, c);
+                case 0xb0: return priv::ternary_intern<0x8a>(b, c, a);
+                case 0xb1: return priv::ternary_intern<0x8b>(b, c, a);
+                case 0xb2: return priv::ternary_intern<0x8e>(b, a, c);
+                case 0xb3: return priv::ternary_intern<0x8f>(b, a, c);
+                case 0xb4: return priv::ternary_intern<0x9a>(b, c, a);
+                case 0xb5: return priv::ternary_intern<0x9b>(b, c, a);
+                case 0xb6: return priv::ternary_intern<0x9e>(b, a, c);
+                case 0xb7: return priv::ternary_intern<0x9f>(b, a, c);
+                case 0xb8: return priv::ternary_intern<0xac>(b, a, c);
+                case 0xb9: return priv::ternary_intern<0xad>(b, a, c);
+                case 0xba: return priv::ternary_intern<0xae>(b, a, c);
+                case 0xbb: return priv::ternary_intern<0xaf>(b, a, c);
+                case 0xbc: return priv::ternary_intern<0xbc>(a, b, c);
+                case 0xbd: return priv::ternary_intern<0xbd>(a, b, c);
+                case 0xbe: return priv::ternary_intern<0xbe>(a, b, c);
+                case 0xbf: return priv::ternary_intern<0xbf>(a, b, c);
+                case 0xc0: return priv::ternary_intern<0x88>(c, a, b);
+                case 0xc1: return priv::ternary_intern<0x89>(c, a, b);
+                case 0xc2: return priv::ternary_intern<0x98>(c, a, b);
+                case 0xc3: return priv::ternary_intern<0x99>(c, a, b);
+                case 0xc4: return priv::ternary_intern<0x8a>(c, a, b);
+                case 0xc5: return priv::ternary_intern<0x8b>(c, a, b);
+                case 0xc6: return priv::ternary_intern<0x9a>(c, a, b);
+                case 0xc7: return priv::ternary_intern<0x9b>(c, a, b);
+                case 0xc8: return priv::ternary_intern<0xa8>(a, c, b);
+                case 0xc9: return priv::ternary_intern<0xa9>(a, c, b);
+                case 0xca: return priv::ternary_intern<0xac>(a, c, b);
+                case 0xcb: return priv::ternary_intern<0xad>(a, c, b);
+                case 0xcc: return priv::ternary_intern<0xaa>(a, c, b);
+                case 0xcd: return priv::ternary_intern<0xab>(a, c, b);
+                case 0xce: return priv::ternary_intern<0xae>(a, c, b);
+                case 0xcf: return priv::ternary_intern<0xaf>(a, c, b);
+                case 0xd0: return priv::ternary_intern<0x8a>(c, b, a);
+                case 0xd1: return priv::ternary_intern<0x8b>(c, b, a);
+                case 0xd2: return priv::ternary_intern<0x9a>(c, b, a);
+                case 0xd3: return priv::ternary_intern<0x9b>(c, b, a);
+                case 0xd4: return priv::ternary_intern<0x8e>(c, a, b);
+                case 0xd5: return priv::ternary_intern<0x8f>(c, a, b);
+                case 0xd6: return priv::ternary_intern<0x9e>(c, a, b);
+                case 0xd7: return priv::ternary_intern<0x9f>(c, a, b);
+                case 0xd8: return priv::ternary_intern<0xac>(c, a, b);
+                case 0xd9: return priv::ternary_intern<0xad>(c, a, b);
+                case 0xda: return priv::ternary_intern<0xbc>(a, c, b);
+                case 0xdb: return priv::ternary_intern<0xbd>(a, c, b);
+                case 0xdc: return priv::ternary_intern<0xae>(c, a, b);
+                case 0xdd: return priv::ternary_intern<0xaf>(c, a, b);
+                case 0xde: return priv::ternary_intern<0xbe>(a, c, b);
+                case 0xdf: return priv::ternary_intern<0xbf>(a, c, b);
+                case 0xe0: return priv::ternary_intern<0xa8>(b, c, a);
+                case 0xe1: return priv::ternary_intern<0xa9>(b, c, a);
+                case 0xe2: return priv::ternary_intern<0xac>(b, c, a);
+                case 0xe3: return priv::ternary_intern<0xad>(b, c, a);
+                case 0xe4: return priv::ternary_intern<0xac>(c, b, a);
+                case 0xe5: return priv::ternary_intern<0xad>(c, b, a);
+                case 0xe6: return priv::ternary_intern<0xbc>(b, c, a);
+                case 0xe7: return priv::ternary_intern<0xbd>(b, c, a);
+                case 0xe8: return priv::ternary_intern<0xe8>(a, b, c);
+                case 0xe9: return priv::ternary_intern<0xe9>(a, b, c);
+                case 0xea: return priv::ternary_intern<0xea>(a, b, c);
+                case 0xeb: return priv::ternary_intern<0xeb>(a, b, c);
+                case 0xec: return priv::ternary_intern<0xea>(a, c, b);
+                case 0xed: return priv::ternary_intern<0xeb>(a, c, b);
+                case 0xee: return priv::ternary_intern<0xee>(a, b, c);
+                case 0xef: return priv::ternary_intern<0xef>(a, b, c);
+                case 0xf0: return priv::ternary_intern<0xaa>(b, c, a);
+                case 0xf1: return priv::ternary_intern<0xab>(b, c, a);
+                case 0xf2: return priv::ternary_intern<0xae>(b, c, a);
+                case 0xf3: return priv::ternary_intern<0xaf>(b, c, a);
+                case 0xf4: return priv::ternary_intern<0xae>(c, b, a);
+                case 0xf5: return priv::ternary_intern<0xaf>(c, b, a);
+                case 0xf6: return priv::ternary_intern<0xbe>(b, c, a);
+                case 0xf7: return priv::ternary_intern<0xbf>(b, c, a);
+                case 0xf8: return priv::ternary_intern<0xea>(b, c, a);
+                case 0xf9: return priv::ternary_intern<0xeb>(b, c, a);
+                case 0xfa: return priv::ternary_intern<0xee>(b, a, c);
+                case 0xfb: return priv::ternary_intern<0xef>(b, a, c);
+                case 0xfc: return priv::ternary_intern<0xee>(c, a, b);
+                case 0xfd: return priv::ternary_intern<0xef>(c, a, b);
+                case 0xfe: return priv::ternary_intern<0xfe>(a, b, c);
+                case 0xff: return priv::ternary_intern<0xff>(a, b, c);
+                default: return priv::ternary_intern<0>(a, b, c);
+            }
+        }
+
+#ifdef __AVX2__
+        // kernels of ternary_avx2.cpp
+        constexpr reduction reduced_avx2[256] = {
+            { 0x00, order::abc }, // 0x00
+            { 0x01, order::abc }, // 0x01
+            { 0x02, order::abc }, // 0x02
+            { 0x03, order::abc }, // 0x03
+            { 0x02, order::acb }, // 0x04
+            { 0x03, order::acb }, // 0x05
+            { 0x06, order::abc }, // 0x06
+            { 0x07, order::abc }, // 0x07
+            { 0x08, order::abc }, // 0x08
+            { 0x09, order::abc }, // 0x09
+            { 0x0a, order::abc }, // 0x0a
+            { 0x0b, order::abc }, // 0x0b
+            { 0x0a, order::acb }, // 0x0c
+            { 0x0b, order::acb }, // 0x0d
+            { 0x0e, order::abc }, // 0x0e
+            { 0x0f, order::abc }, // 0x0f
+            { 0x02, order::bca }, // 0x10
+            { 0x03, order::bca }, // 0x11
+            { 0x06, order::bac }, // 0x12
+            { 0x07, order::bac }, // 0x13
+            { 0x06, order::cab }, // 0x14
+            { 0x07, order::cab }, // 0x15
+            { 0x16, order::abc }, // 0x16
+            { 0x17, order::abc }, // 0x17
+            { 0x18, order::abc }, // 0x18
+            { 0x19, order::abc }, // 0x19
+            { 0x1a, order::abc }, // 0x1a
+            { 0x1b, order::abc }, // 0x1b
+            { 0x1a, order::acb }, // 0x1c
+            { 0x1b, order::acb }, // 0x1d
+            { 0x1e, order::abc }, // 0x1e
+            { 0x1f, order::abc }, // 0x1f
+            { 0x08, order::bac }, // 0x20
+            { 0x09, order::bac }, // 0x21
+            { 0x0a, order::bac }, // 0x22
+            { 0x0b, order::bac }, // 0x23
+            { 0x18, order::bac }, // 0x24
+            { 0x19, order::bac }, // 0x25
+            { 0x1a, order::bac }, // 0x26
+            { 0x1b, order::bac }, // 0x27
+            { 0x28, order::abc }, // 0x28
+            { 0x29, order::abc }, // 0x29
+            { 0x2a, order::abc }, // 0x2a
+            { 0x2b, order::abc }, // 0x2b
+            { 0x2c, order::abc }, // 0x2c
+            { 0x2d, order::abc }, // 0x2d
+            { 0x2e, order::abc }, // 0x2e
+            { 0x2f, order::abc }, // 0x2f
+            { 0x0a, order::bca }, // 0x30
+            { 0x0b, order::bca }, // 0x31
+            { 0x0e, order::bac }, // 0x32
+            { 0x0f, order::bac }, // 0x33
+            { 0x1a, order::bca }, // 0x34
+            { 0x1b, order::bca }, // 0x35
+            { 0x1e, order::bac }, // 0x36
+            { 0x1f, order::bac }, // 0x37
+            { 0x2c, order::bac }, // 0x38
+            { 0x2d, order::bac }, // 0x39
+            { 0x2e, order::bac }, // 0x3a
+            { 0x2f, order::bac }, // 0x3b
+            { 0x3c, order::abc }, // 0x3c
+            { 0x3d, order::abc }, // 0x3d
+            { 0x3e, order::abc }, // 0x3e
+            { 0x3f, order::abc }, // 0x3f
+            { 0x08, order::cab }, // 0x40
+            { 0x09, order::cab }, // 0x41
+            { 0x18, order::cab }, // 0x42
+            { 0x19, order::cab }, // 0x43
+            { 0x0a, order::cab }, // 0x44
+            { 0x0b, order::cab }, // 0x45
+            { 0x1a, order::cab }, // 0x46
+            { 0x1b, order::cab }, // 0x47
+            { 0x28, order::acb }, // 0x48
+            { 0x29, order::acb }, // 0x49
+            { 0x2c, order::acb }, // 0x4a
+            { 0x2d, order::acb }, // 0x4b
+            { 0x2a, order::acb }, // 0x4c
+            { 0x2b, order::acb }, // 0x4d
+            { 0x2e, order::acb }, // 0x4e
+            { 0x2f, order::acb }, // 0x4f
+            { 0x0a, order::cba }, // 0x50
+            { 0x0b, order::cba }, // 0x51
+            { 0x1a, order::cba }, // 0x52
+            { 0x1b, order::cba }, // 0x53
+            { 0x0e, order::cab }, // 0x54
+            { 0x0f, order::cab }, // 0x55
+            { 0x1e, order::cab }, // 0x56
+            { 0x1f, order::cab }, // 0x57
+            { 0x2c, order::cab }, // 0x58
+            { 0x2d, order::cab }, // 0x59
+            { 0x3c, order::acb }, // 0x5a
+            { 0x3d, order::acb }, // 0x5b
+            { 0x2e, order::cab }, // 0x5c
+            { 0x2f, order::cab }, // 0x5d
+            { 0x3e, order::acb }, // 0x5e
+            { 0x3f, order::acb }, // 0x5f
+            { 0x28, order::bca }, // 0x60
+            { 0x29, order::bca }, // 0x61
+            { 0x2c, order::bca }, // 0x62
+            { 0x2d, order::bca }, // 0x63
+            { 0x2c, order::cba }, // 0x64
+            { 0x2d, order::cba }, // 0x65
+            { 0x3c, order::bca }, // 0x66
+            { 0x3d, order::bca }, // 0x67
+            { 0x68, order::abc }, // 0x68
+            { 0x69, order::abc }, // 0x69
+            { 0x6a, order::abc }, // 0x6a
+            { 0x6b, order::abc }, // 0x6b
+            { 0x6a, order::acb }, // 0x6c
+            { 0x6b, order::acb }, // 0x6d
+            { 0x6e, order::abc }, // 0x6e
+            { 0x6f, order::abc }, // 0x6f
+            { 0x2a, order::bca }, // 0x70
+            { 0x2b, order::bca }, // 0x71
+            { 0x2e, order::bca }, // 0x72
+            { 0x2f, order::bca }, // 0x73
+            { 0x2e, order::cba }, // 0x74
+            { 0x2f, order::cba }, // 0x75
+            { 0x3e, order::bca }, // 0x76
+            { 0x3f, order::bca }, // 0x77
+            { 0x6a, order::bca }, // 0x78
+            { 0x6b, order::bca }, // 0x79
+            { 0x6e, order::bac }, // 0x7a
+            { 0x6f, order::bac }, // 0x7b
+            { 0x6e, order::cab }, // 0x7c
+            { 0x6f, order::cab }, // 0x7d
+            { 0x7e, order::abc }, // 0x7e
+            { 0x7f, order::abc }, // 0x7f
+            { 0x80, order::abc }, // 0x80
+            { 0x81, order::abc }, // 0x81
+            { 0x82, order::abc }, // 0x82
+            { 0x83, order::abc }, // 0x83
+            { 0x82, order::acb }, // 0x84
+            { 0x83, order::acb }, // 0x85
+            { 0x86, order::abc }, // 0x86
+            { 0x87, order::abc }, // 0x87
+            { 0x88, order::abc }, // 0x88
+            { 0x89, order::abc }, // 0x89
+            { 0x8a, order::abc }, // 0x8a
+            { 0x8b, order::abc }, // 0x8b
+            { 0x8a, order::acb }, // 0x8c
+            { 0x8b, order::acb }, // 0x8d
+            { 0x8e, order::abc }, // 0x8e
+            { 0x8f, order::abc }, // 0x8f
+            { 0x82, order::bca }, // 0x90
+            { 0x83, order::bca }, // 0x91
+            { 0x86, order::bac }, // 0x92
+            { 0x87, order::bac }, // 0x93
+            { 0x86, order::cab }, // 0x94
+            { 0x87, order::cab }, // 0x95
+            { 0x96, order::abc }, // 0x96
+            { 0x97, order::abc }, // 0x97
+            { 0x98, order::abc }, // 0x98
+            { 0x99, order::abc }, // 0x99
+            { 0x9a, order::abc }, // 0x9a
+            { 0x9b, order::abc }, // 0x9b
+            { 0x9a, order::acb }, // 0x9c
+            { 0x9b, order::acb }, // 0x9d
+            { 0x9e, order::abc }, // 0x9e
+            { 0x9f, order::abc }, // 0x9f
+            { 0x88, order::bac }, // 0xa0
+            { 0x89, order::bac }, // 0xa1
+            { 0x8a, order::bac }, // 0xa2
+            { 0x8b, order::bac }, // 0xa3
+            { 0x98, order::bac }, // 0xa4
+            { 0x99, order::bac }, // 0xa5
+            { 0x9a, order::bac }, // 0xa6
+            { 0x9b, order::bac }, // 0xa7
+            { 0xa8, order::abc }, // 0xa8
+            { 0xa9, order::abc }, // 0xa9
+            { 0xaa, order::abc }, // 0xaa
+            { 0xab, order::abc }, // 0xab
+            { 0xac, order::abc }, // 0xac
+            { 0xad, order::abc }, // 0xad
+            { 0xae, order::abc }, // 0xae
+            { 0xaf, order::abc }, // 0xaf
+            { 0x8a, order::bca }, // 0xb0
+            { 0x8b, order::bca }, // 0xb1
+            { 0x8e, order::bac }, // 0xb2
+            { 0x8f, order::bac }, // 0xb3
+            { 0x9a, order::bca }, // 0xb4
+            { 0x9b, order::bca }, // 0xb5
+            { 0x9e, order::bac }, // 0xb6
+            { 0x9f, order::bac }, // 0xb7
+            { 0xac, order::bac }, // 0xb8
+            { 0xad, order::bac }, // 0xb9
+            { 0xae, order::bac }, // 0xba
+            { 0xaf, order::bac }, // 0xbb
+            { 0xbc, order::abc }, // 0xbc
+            { 0xbd, order::abc }, // 0xbd
+            { 0xbe, order::abc }, // 0xbe
+            { 0xbf, order::abc }, // 0xbf
+            { 0x88, order::cab }, // 0xc0
+            { 0x89, order::cab }, // 0xc1
+            { 0x98, order::cab }, // 0xc2
+            { 0x99, order::cab }, // 0xc3
+            { 0x8a, order::cab }, // 0xc4
+            { 0x8b, order::cab }, // 0xc5
+            { 0x9a, order::cab }, // 0xc6
+            { 0x9b, order::cab }, // 0xc7
+            { 0xa8, order::acb }, // 0xc8
+            { 0xa9, order::acb }, // 0xc9
+            { 0xac, order::acb }, // 0xca
+            { 0xad, order::acb }, // 0xcb
+            { 0xaa, order::acb }, // 0xcc
+            { 0xab, order::acb }, // 0xcd
+            { 0xae, order::acb }, // 0xce
+            { 0xaf, order::acb }, // 0xcf
+            { 0x8a, order::cba }, // 0xd0
+            { 0x8b, order::cba }, // 0xd1
+            { 0x9a, order::cba }, // 0xd2
+            { 0x9b, order::cba }, // 0xd3
+            { 0x8e, order::cab }, // 0xd4
+            { 0x8f, order::cab }, // 0xd5
+            { 0x9e, order::cab }, // 0xd6
+            { 0x9f, order::cab }, // 0xd7
+            { 0xac, order::cab }, // 0xd8
+            { 0xad, order::cab }, // 0xd9
+            { 0xbc, order::acb }, // 0xda
+            { 0xbd, order::acb }, // 0xdb
+            { 0xae, order::cab }, // 0xdc
+            { 0xaf, order::cab }, // 0xdd
+            { 0xbe, order::acb }, // 0xde
+            { 0xbf, order::acb }, // 0xdf
+            { 0xa8, order::bca }, // 0xe0
+            { 0xa9, order::bca }, // 0xe1
+            { 0xac, order::bca }, // 0xe2
+            { 0xad, order::bca }, // 0xe3
+            { 0xac, order::cba }, // 0xe4
+            { 0xad, order::cba }, // 0xe5
+            { 0xbc, order::bca }, // 0xe6
+            { 0xbd, order::bca }, // 0xe7
+            { 0xe8, order::abc }, // 0xe8
+            { 0xe9, order::abc }, // 0xe9
+            { 0xea, order::abc }, // 0xea
+            { 0xeb, order::abc }, // 0xeb
+            { 0xea, order::acb }, // 0xec
+            { 0xeb, order::acb }, // 0xed
+            { 0xee, order::abc }, // 0xee
+            { 0xef, order::abc }, // 0xef
+            { 0xaa, order::bca }, // 0xf0
+            { 0xab, order::bca }, // 0xf1
+            { 0xae, order::bca }, // 0xf2
+            { 0xaf, order::bca }, // 0xf3
+            { 0xae, order::cba }, // 0xf4
+            { 0xaf, order::cba }, // 0xf5
+            { 0xbe, order::bca }, // 0xf6
+            { 0xbf, order::bca }, // 0xf7
+            { 0xea, order::bca }, // 0xf8
+            { 0xeb, order::bca }, // 0xf9
+            { 0xee, order::bac }, // 0xfa
+            { 0xef, order::bac }, // 0xfb
+            { 0xee, order::cab }, // 0xfc
+            { 0xef, order::cab }, // 0xfd
+            { 0xfe, order::abc }, // 0xfe
+            { 0xff, order::abc }, // 0xff
+        };
+#ifdef TERNARYLOGIC_TESTS
+        static_assert(valid_reduction(reduced_avx2), "invalid reduction of avx2");
+#endif
+
+        template<>
+        [[nodiscard]] constexpr __m256i ternary_reduced<__m256i>(const __m256i& a, const __m256i& b, const __m256i& c, const bf_type k) noexcept {
+            switch (k) {
+                case 0x00: return priv::ternary_intern<0x00>(a, b, c);
+                case 0x01: return priv::ternary_intern<0x01>(a, b, c);
+                case 0x02: return priv::ternary_intern<0x02>(a, b, c);
+                case 0x03: return priv::ternary_intern<0x03>(a, b, c);
+                case 0x04: return priv::ternary_intern<0x02>(a, c, b);
+                case 0x05: return priv::ternary_intern<0x03>(a, c, b);
+                case 0x06: return priv::ternary_intern<0x06>(a, b, c);
+                case 0x07: return priv::ternary_intern<0x07>(a, b, c);
+                case 0x08: return priv::ternary_intern<0x08>(a, b, c);
+                case 0x09: return priv::ternary_intern<0x09>(a, b, c);
+                case 0x0a: return priv::ternary_intern<0x0a>(a, b, c);
+                case 0x0b: return priv::ternary_intern<0x0b>(a, b, c);
+                case 0x0c: return priv::ternary_intern<0x0a>(a, c, b);
+                case 0x0d: return priv::ternary_intern<0x0b>(a, c, b);
+                case 0x0e: return priv::ternary_intern<0x0e>(a, b, c);
+                case 0x0f: return priv::ternary_intern<0x0f>(a, b, c);
+                case 0x10: return priv::ternary_intern<0x02>(b, c, a);
+                case 0x11: return priv::ternary_intern<0x03>(b, c, a);
+                case 0x12: return priv::ternary_intern<0x06>(b, a, c);
+                case 0x13: return priv::ternary_intern<0x07>(b, a, c);
+                case 0x14: return priv::ternary_intern<0x06>(c, a, b);
+                case 0x15: return priv::ternary_intern<0x07>(c, a, b);
+                case 0x16: return priv::ternary_intern<0x16>(a, b, c);
+                case 0x17: return priv::ternary_intern<0x17>(a, b, c);
+                case 0x18: return priv::ternary_intern<0x18>(a, b, c);
+                case 0x19: return priv::ternary_intern<0x19>(a, b, c);
+                case 0x1a: return priv::ternary_intern<0x1a>(a, b, c);
+                case 0x1b: return priv::ternary_intern<0x1b>(a, b, c);
+                case 0x1c: return priv::ternary_intern<0x1a>(a, c, b);
+                case 0x1d: return priv::ternary_intern<0x1b>(a, c, b);
+                case 0x1e: return priv::ternary_intern<0x1e>(a, b, c);
+                case 0x1f: return priv::ternary_intern<0x1f>(a, b, c);
+                case 0x20: return priv::ternary_intern<0x08>(b, a, c);
+                case 0x21: return priv::ternary_intern<0x09>(b, a, c);
+                case 0x22: return priv::ternary_intern<0x0a>(b, a, c);
+                case 0x23: return priv::ternary_intern<0x0b>(b, a, c);
+                case 0x24: return priv::ternary_intern<0x18>(b, a, c);
+                case 0x25: return priv::ternary_intern<0x19>(b, a, c);
+                case 0x26: return priv::ternary_intern<0x1a>(b, a, c);
+                case 0x27: return priv::ternary_intern<0x1b>(b, a, c);
+                case 0x28: return priv::ternary_intern<0x28>(a, b, c);
+                case 0x29: return priv::ternary_intern<0x29>(a, b, c);
+                case 0x2a: return priv::ternary_intern<0x2a>(a, b, c);
+                case 0x2b: return priv::ternary_intern<0x2b>(a, b, c);
+                case 0x2c: return priv::ternary_intern<0x2c>(a, b, c);
+                case 0x2d: return priv::ternary_intern<0x2d>(a, b, c);
+                case 0x2e: return priv::ternary_intern<0x2e>(a, b, c);
+                case 0x2f: return priv::ternary_intern<0x2f>(a, b, c);
+                case 0x30: return priv::ternary_intern<0x0a>(b, c, a);
+                case 0x31: return priv::ternary_intern<0x0b>(b, c, a);
+                case 0x32: return priv::ternary_intern<0x0e>(b, a, c);
+                case 0x33: return priv::ternary_intern<0x0f>(b, a, c);
+                case 0x34: return priv::ternary_intern<0x1a>(b, c, a);
+                case 0x35: return priv::ternary_intern<0x1b>(b, c, a);
+                case 0x36: return priv::ternary_intern<0x1e>(b, a, c);
+                case 0x37: return priv::ternary_intern<0x1f>(b, a, c);
+                case 0x38: return priv::ternary_intern<0x2c>(b, a, c);
+                case 0x39: return priv::ternary_intern<0x2d>(b, a, c);
+                case 0x3a: return priv::ternary_intern<0x2e>(b, a, c);
+                case 0x3b: return priv::ternary_intern<0x2f>(b, a, c);
+                case 0x3c: return priv::ternary_intern<0x3c>(a, b, c);
+                case 0x3d: return priv::ternary_intern<0x3d>(a, b, c);
+                case 0x3e: return priv::ternary_intern<0x3e>(a, b, c);
+                case 0x3f: return priv::ternary_intern<0x3f>(a, b, c);
+                case 0x40: return priv::ternary_intern<0x08>(c, a, b);
+                case 0x41: return priv::ternary_intern<0x09>(c, a, b);
+                case 0x42: return priv::ternary_intern<0x18>(c, a, b);
+                case 0x43: return priv::ternary_intern<0x19>(c, a, b);
+                case 0x44: return priv::ternary_intern<0x0a>(c, a, b);
+                case 0x45: return priv::ternary_intern<0x0b>(c, a, b);
+                case 0x46: return priv::ternary_intern<0x1a>(c, a, b);
+                case 0x47: return priv::ternary_intern<0x1b>(c, a, b);
+                case 0x48: return priv::ternary_intern<0x28>(a, c, b);
+                case 0x49: return priv::ternary_intern<0x29>(a, c, b);
+                case 0x4a: return priv::ternary_intern<0x2c>(a, c, b);
+                case 0x4b: return priv::ternary_intern<0x2d>(a, c, b);
+                case 0x4c: return priv::ternary_intern<0x2a>(a, c, b);
+                case 0x4d: return priv::ternary_intern<0x2b>(a, c, b);
+                case 0x4e: return priv::ternary_intern<0x2e>(a, c, b);
+                case 0x4f: return priv::ternary_intern<0x2f>(a, c, b);
+                case 0x50: return priv::ternary_intern<0x0a>(c, b, a);
+                case 0x51: return priv::ternary_intern<0x0b>(c, b, a);
+                case 0x52: return priv::ternary_intern<0x1a>(c, b, a);
+                case 0x53: return priv::ternary_intern<0x1b>(c, b, a);
+                case 0x54: return priv::ternary_intern<0x0e>(c, a, b);
+                case 0x55: return priv::ternary_intern<0x0f>(c, a, b);
+                case 0x56: return priv::ternary_intern<0x1e>(c, a, b);
+                case 0x57: return priv::ternary_intern<0x1f>(c, a, b);
+                case 0x58: return priv::ternary_intern<0x2c>(c, a, b);
+                case 0x59: return priv::ternary_intern<0x2d>(c, a, b);
+                case 0x5a: return priv::ternary_intern<0x3c>(a, c, b);
+                case 0x5b: return priv::ternary_intern<0x3d>(a, c, b);
+                case 0x5c: return priv::ternary_intern<0x2e>(c, a, b);
+                case 0x5d: return priv::ternary_intern<0x2f>(c, a, b);
+                case 0x5e: return priv::ternary_intern<0x3e>(a, c, b);
+                case 0x5f: return priv::ternary_intern<0x3f>(a, c, b);
+                case 0x60: return priv::ternary_intern<0x28>(b, c, a);
+                case 0x61: return priv::ternary_intern<0x29>(b, c, a);
+                case 0x62: return priv::ternary_intern<0x2c>(b, c, a);
+                case 0x63: return priv::ternary_intern<0x2d>(b, c, a);
+                case 0x64: return priv::ternary_intern<0x2c>(c, b, a);
+                case 0x65: return priv::ternary_intern<0x2d>(c, b, a);
+                case 0x66: return priv::ternary_intern<0x3c>(b, c, a);
+                case 0x67: return priv::ternary_intern<0x3d>(b, c, a);
+                case 0x68: return priv::ternary_intern<0x68>(a, b, c);
+                case 0x69: return priv::ternary_intern<0x69>(a, b, c);
+                case 0x6a: return priv::ternary_intern<0x6a>(a, b, c);
+                case 0x6b: return priv::ternary_intern<0x6b>(a, b, c);
+                case 0x6c: return priv::ternary_intern<0x6a>(a, c, b);
+                case 0x6d: return priv::ternary_intern<0x6b>(a, c, b);
+                case 0x6e: return priv::ternary_intern<0x6e>(a, b, c);
+                case 0x6f: return priv::ternary_intern<0x6f>(a, b, c);
+                case 0x70: return priv::ternary_intern<0x2a>(b, c, a);
+                case 0x71: return priv::ternary_intern<0x2b>(b, c, a);
+                case 0x72: return priv::ternary_intern<0x2e>(b, c, a);
+                case 0x73: return priv::ternary_intern<0x2f>(b, c, a);
+                case 0x74: return priv::ternary_intern<0x2e>(c, b, a);
+                case 0x75: return priv::ternary_intern<0x2f>(c, b, a);
+                case 0x76: return priv::ternary_intern<0x3e>(b, c, a);
+                case 0x77: return priv::ternary_intern<0x3f>(b, c, a);
+                case 0x78: return priv::ternary_intern<0x6a>(b, c, a);
+                case 0x79: return priv::ternary_intern<0x6b>(b, c, a);
+                case 0x7a: return priv::ternary_intern<0x6e>(b, a, c);
+                case 0x7b: return priv::ternary_intern<0x6f>(b, a, c);
+                case 0x7c: return priv::ternary_intern<0x6e>(c, a, b);
+                case 0x7d: return priv::ternary_intern<0x6f>(c, a, b);
+                case 0x7e: return priv::ternary_intern<0x7e>(a, b, c);
+                case 0x7f: return priv::ternary_intern<0x7f>(a, b, c);
+                case 0x80: return priv::ternary_intern<0x80>(a, b, c);
+                case 0x81: return priv::ternary_intern<0x81>(a, b, c);
+                case 0x82: return priv::ternary_intern<0x82>(a, b, c);
+                case 0x83: return priv::ternary_intern<0x83>(a, b, c);
+                case 0x84: return priv::ternary_intern<0x82>(a, c, b);
+                case 0x85: return priv::ternary_intern<0x83>(a, c, b);
+                case 0x86: return priv::ternary_intern<0x86>(a, b, c);
+                case 0x87: return priv::ternary_intern<0x87>(a, b, c);
+                case 0x88: return priv::ternary_intern<0x88>(a, b, c);
+                case 0x89: return priv::ternary_intern<0x89>(a, b, c);
+                case 0x8a: return priv::ternary_intern<0x8a>(a, b, c);
+                case 0x8b: return priv::ternary_intern<0x8b>(a, b, c);
+                case 0x8c: return priv::ternary_intern<0x8a>(a, c, b);
+                case 0x8d: return priv::ternary_intern<0x8b>(a, c, b);
+                case 0x8e: return priv::ternary_intern<0x8e>(a, b, c);
+                case 0x8f: return priv::ternary_intern<0x8f>(a, b, c);
+                case 0x90: return priv::ternary_intern<0x82>(b, c, a);
+                case 0x91: return priv::ternary_intern<0x83>(b, c, a);
+                case 0x92: return priv::ternary_intern<0x86>(b, a, c);
+                case 0x93: return priv::ternary_intern<0x87>(b, a, c);
+                case 0x94: return priv::ternary_intern<0x86>(c, a, b);
+                case 0x95: return priv::ternary_intern<0x87>(c, a, b);
+                case 0x96: return priv::ternary_intern<0x96>(a, b, c);
+                case 0x97: return priv::ternary_intern<0x97>(a, b, c);
+                case 0x98: return priv::ternary_intern<0x98>(a, b, c);
+                case 0x99: return priv::ternary_intern<0x99>(a, b, c);
+                case 0x9a: return priv::ternary_intern<0x9a>(a, b, c);
+                case 0x9b: return priv::ternary_intern<0x9b>(a, b, c);
+                case 0x9c: return priv::ternary_intern<0x9a>(a, c, b);
+                case 0x9d: return priv::ternary_intern<0x9b>(a, c, b);
+                case 0x9e: return priv::ternary_intern<0x9e>(a, b, c);
+                case 0x9f: return priv::ternary_intern<0x9f>(a, b, c);
+                case 0xa0: return priv::ternary_intern<0x88>(b, a, c);
+                case 0xa1: return priv::ternary_intern<0x89>(b, a, c);
+                case 0xa2: return priv::ternary_intern<0x8a>(b, a, c);
+                case 0xa3: return priv::ternary_intern<0x8b>(b, a, c);
+                case 0xa4: return priv::ternary_intern<0x98>(b, a, c);
+                case 0xa5: return priv::ternary_intern<0x99>(b, a, c);
+                case 0xa6: return priv::ternary_intern<0x9a>(b, a, c);
+                case 0xa7: return priv::ternary_intern<0x9b>(b, a, c);
+                case 0xa8: return priv::ternary_intern<0xa8>(a, b, c);
+                case 0xa9: return priv::ternary_intern<0xa9>(a, b, c);
+                case 0xaa: return priv::ternary_intern<0xaa>(a, b, c);
+                case 0xab: return priv::ternary_intern<0xab>(a, b, c);
+                case 0xac: return priv::ternary_intern<0xac>(a, b, c);
+                case 0xad: return priv::ternary_intern<0xad>(a, b, c);
+                case 0xae: return priv::ternary_intern<0xae>(a, b, c);
+                case 0xaf: return priv::ternary_intern<0xaf>(a, b, c);
+                case 0xb0: return priv::ternary_intern<0x8a>(b, c, a);
+                case 0xb1: return priv::ternary_intern<0x8b>(b, c, a);
+                case 0xb2: return priv::ternary_intern<0x8e>(b, a, c);
+                case 0xb3: return priv::ternary_intern<0x8f>(b, a, c);
+                case 0xb4: return priv::ternary_intern<0x9a>(b, c, a);
+                case 0xb5: return priv::ternary_intern<0x9b>(b, c, a);
+                case 0xb6: return priv::ternary_intern<0x9e>(b, a, c);
+                case 0xb7: return priv::ternary_intern<0x9f>(b, a, c);
+                case 0xb8: return priv::ternary_intern<0xac>(b, a, c);
+                case 0xb9: return priv::ternary_intern<0xad>(b, a, c);
+                case 0xba: return priv::ternary_intern<0xae>(b, a, c);
+                case 0xbb: return priv::ternary_intern<0xaf>(b, a, c);
+                case 0xbc: return priv::ternary_intern<0xbc>(a, b, c);
+                case 0xbd: return priv::ternary_intern<0xbd>(a, b, c);
+                case 0xbe: return priv::ternary_intern<0xbe>(a, b, c);
+                case 0xbf: return priv::ternary_intern<0xbf>(a, b, c);
+                case 0xc0: return priv::ternary_intern<0x88>(c, a, b);
+                case 0xc1: return priv::ternary_intern<0x89>(c, a, b);
+                case 0xc2: return priv::ternary_intern<0x98>(c, a, b);
+                case 0xc3: return priv::ternary_intern<0x99>(c, a, b);
+                case 0xc4: return priv::ternary_intern<0x8a>(c, a, b);
+                case 0xc5: return priv::ternary_intern<0x8b>(c, a, b);
+                case 0xc6: return priv::ternary_intern<0x9a>(c, a, b);
+                case 0xc7: return priv::ternary_intern<0x9b>(c, a, b);
+                case 0xc8: return priv::ternary_intern<0xa8>(a, c, b);
+                case 0xc9: return priv::ternary_intern<0xa9>(a, c, b);
+                case 0xca: return priv::ternary_intern<0xac>(a, c, b);
+                case 0xcb: return priv::ternary_intern<0xad>(a, c, b);
+                case 0xcc: return priv::ternary_intern<0xaa>(a, c, b);
+                case 0xcd: return priv::ternary_intern<0xab>(a, c, b);
+                case 0xce: return priv::ternary_intern<0xae>(a, c, b);
+                case 0xcf: return priv::ternary_intern<0xaf>(a, c, b);
+                case 0xd0: return priv::ternary_intern<0x8a>(c, b, a);
+                case 0xd1: return priv::ternary_intern<0x8b>(c, b, a);
+                case 0xd2: return priv::ternary_intern<0x9a>(c, b, a);
+                case 0xd3: return priv::ternary_intern<0x9b>(c, b, a);
+                case 0xd4: return priv::ternary_intern<0x8e>(c, a, b);
+                case 0xd5: return priv::ternary_intern<0x8f>(c, a, b);
+                case 0xd6: return priv::ternary_intern<0x9e>(c, a, b);
+                case 0xd7: return priv::ternary_intern<0x9f>(c, a, b);
+                case 0xd8: return priv::ternary_intern<0xac>(c, a, b);
+                case 0xd9: return priv::ternary_intern<0xad>(c, a, b);
+                case 0xda: return priv::ternary_intern<0xbc>(a, c, b);
+                case 0xdb: return priv::ternary_intern<0xbd>(a, c, b);
+                case 0xdc: return priv::ternary_intern<0xae>(c, a, b);
+                case 0xdd: return priv::ternary_intern<0xaf>(c, a, b);
+                case 0xde: return priv::ternary_intern<0xbe>(a, c, b);
+                case 0xdf: return priv::ternary_intern<0xbf>(a, c, b);
+                case 0xe0: return priv::ternary_intern<0xa8>(b, c, a);
+                case 0xe1: return priv::ternary_intern<0xa9>(b, c, a);
+                case 0xe2: return priv::ternary_intern<0xac>(b, c, a);
+                case 0xe3: return priv::ternary_intern<0xad>(b, c, a);
+                case 0xe4: return priv::ternary_intern<0xac>(c, b, a);
+                case 0xe5: return priv::ternary_intern<0xad>(c, b, a);
+                case 0xe6: return priv::ternary_intern<0xbc>(b, c, a);
+                case 0xe7: return priv::ternary_intern<0xbd>(b, c, a);
+                case 0xe8: return priv::ternary_intern<0xe8>(a, b, c);
+                case 0xe9: return priv::ternary_intern<0xe9>(a, b, c);
+                case 0xea: return priv::ternary_intern<0xea>(a, b, c);
+                case 0xeb: return priv::ternary_intern<0xeb>(a, b, c);
+                case 0xec: return priv::ternary_intern<0xea>(a, c, b);
+                case 0xed: return priv::ternary_intern<0xeb>(a, c, b);
+                case 0xee: return priv::ternary_intern<0xee>(a, b, c);
+                case 0xef: return priv::ternary_intern<0xef>(a, b, c);
+                case 0xf0: return priv::ternary_intern<0xaa>(b, c, a);
+                case 0xf1: return priv::ternary_intern<0xab>(b, c, a);
+                case 0xf2: return priv::ternary_intern<0xae>(b, c, a);
+                case 0xf3: return priv::ternary_intern<0xaf>(b, c, a);
+                case 0xf4: return priv::ternary_intern<0xae>(c, b, a);
+                case 0xf5: return priv::ternary_intern<0xaf>(c, b, a);
+                case 0xf6: return priv::ternary_intern<0xbe>(b, c, a);
+                case 0xf7: return priv::ternary_intern<0xbf>(b, c, a);
+                case 0xf8: return priv::ternary_intern<0xea>(b, c, a);
+                case 0xf9: return priv::ternary_intern<0xeb>(b, c, a);
+                case 0xfa: return priv::ternary_intern<0xee>(b, a, c);
+                case 0xfb: return priv::ternary_intern<0xef>(b, a, c);
+                case 0xfc: return priv::ternary_intern<0xee>(c, a, b);
+                case 0xfd: return priv::ternary_intern<0xef>(c, a, b);
+                case 0xfe: return priv::ternary_intern<0xfe>(a, b, c);
+                case 0xff: return priv::ternary_intern<0xff>(a, b, c);
+                default: return priv::ternary_intern<0>(a, b, c);
+            }
+        }
+#endif
+
+#ifdef __AVX512F__
+        // kernels of vpternlogd
+        constexpr reduction reduced_avx512raw[256] = {
+            { 0x00, order::abc }, // 0x00
+            { 0x01, order::abc }, // 0x01
+            { 0x02, order::abc }, // 0x02
+            { 0x03, order::abc }, // 0x03
+            { 0x02, order::acb }, // 0x04
+            { 0x03, order::acb }, // 0x05
+            { 0x06, order::abc }, // 0x06
+            { 0x07, order::abc }, // 0x07
+            { 0x08, order::abc }, // 0x08
+            { 0x09, order::abc }, // 0x09
+            { 0x0a, order::abc }, // 0x0a
+            { 0x0b, order::abc }, // 0x0b
+            { 0x0a, order::acb }, // 0x0c
+            { 0x0b, order::acb }, // 0x0d
+            { 0x0e, order::abc }, // 0x0e
+            { 0x0f, order::abc }, // 0x0f
+            { 0x02, order::bca }, // 0x10
+            { 0x03, order::bca }, // 0x11
+            { 0x06, order::bac }, // 0x12
+            { 0x07, order::bac }, // 0x13
+            { 0x06, order::cab }, // 0x14
+            { 0x07, order::cab }, // 0x15
+            { 0x16, order::abc }, // 0x16
+            { 0x17, order::abc }, // 0x17
+            { 0x18, order::abc }, // 0x18
+            { 0x19, order::abc }, // 0x19
+            { 0x1a, order::abc }, // 0x1a
+            { 0x1b, order::abc }, // 0x1b
+            { 0x1a, order::acb }, // 0x1c
+            { 0x1b, order::acb }, // 0x1d
+            { 0x1e, order::abc }, // 0x1e
+            { 0x1f, order::abc }, // 0x1f
+            { 0x08, order::bac }, // 0x20
+            { 0x09, order::bac }, // 0x21
+            { 0x0a, order::bac }, // 0x22
+            { 0x0b, order::bac }, // 0x23
+            { 0x18, order::bac }, // 0x24
+            { 0x19, order::bac }, // 0x25
+            { 0x1a, order::bac }, // 0x26
+            { 0x1b, order::bac }, // 0x27
+            { 0x28, order::abc }, // 0x28
+            { 0x29, order::abc }, // 0x29
+            { 0x2a, order::abc }, // 0x2a
+            { 0x2b, order::abc }, // 0x2b
+            { 0x2c, order::abc }, // 0x2c
+            { 0x2d, order::abc }, // 0x2d
+            { 0x2e, order::abc }, // 0x2e
+            { 0x2f, order::abc }, // 0x2f
+            { 0x0a, order::bca }, // 0x30
+            { 0x0b, order::bca }, // 0x31
+            { 0x0e, order::bac }, // 0x32
+            { 0x0f, order::bac }, // 0x33
+            { 0x1a, order::bca }, // 0x34
+            { 0x1b, order::bca }, // 0x35
+            { 0x1e, order::bac }, // 0x36
+            { 0x1f, order::bac }, // 0x37
+            { 0x2c, order::bac }, // 0x38
+            { 0x2d, order::bac }, // 0x39
+            { 0x2e, order::bac }, // 0x3a
+            { 0x2f, order::bac }, // 0x3b
+            { 0x3c, order::abc }, // 0x3c
+            { 0x3d, order::abc }, // 0x3d
+            { 0x3e, order::abc }, // 0x3e
+            { 0x3f, order::abc }, // 0x3f
+            { 0x08, order::cab }, // 0x40
+            { 0x09, order::cab }, // 0x41
+            { 0x18, order::cab }, // 0x42
+            { 0x19, order::cab }, // 0x43
+            { 0x0a, order::cab }, // 0x44
+            { 0x0b, order::cab }, // 0x45
+            { 0x1a, order::cab }, // 0x46
+            { 0x1b, order::cab }, // 0x47
+            { 0x28, order::acb }, // 0x48
+            { 0x29, order::acb }, // 0x49
+            { 0x2c, order::acb }, // 0x4a
+            { 0x2d, order::acb }, // 0x4b
+            { 0x2a, order::acb }, // 0x4c
+            { 0x2b, order::acb }, // 0x4d
+            { 0x2e, order::acb }, // 0x4e
+            { 0x2f, order::acb }, // 0x4f
+            { 0x0a, order::cba }, // 0x50
+            { 0x0b, order::cba }, // 0x51
+            { 0x1a, order::cba }, // 0x52
+            { 0x1b, order::cba }, // 0x53
+            { 0x0e, order::cab }, // 0x54
+            { 0x0f, order::cab }, // 0x55
+            { 0x1e, order::cab }, // 0x56
+            { 0x1f, order::cab }, // 0x57
+            { 0x2c, order::cab }, // 0x58
+            { 0x2d, order::cab }, // 0x59
+            { 0x3c, order::acb }, // 0x5a
+            { 0x3d, order::acb }, // 0x5b
+            { 0x2e, order::cab }, // 0x5c
+            { 0x2f, order::cab }, // 0x5d
+            { 0x3e, order::acb }, // 0x5e
+            { 0x3f, order::acb }, // 0x5f
+            { 0x28, order::bca }, // 0x60
+            { 0x29, order::bca }, // 0x61
+            { 0x2c, order::bca }, // 0x62
+            { 0x2d, order::bca }, // 0x63
+            { 0x2c, order::cba }, // 0x64
+            { 0x2d, order::cba }, // 0x65
+            { 0x3c, order::bca }, // 0x66
+            { 0x3d, order::bca }, // 0x67
+            { 0x68, order::abc }, // 0x68
+            { 0x69, order::abc }, // 0x69
+            { 0x6a, order::abc }, // 0x6a
+            { 0x6b, order::abc }, // 0x6b
+            { 0x6a, order::acb }, // 0x6c
+            { 0x6b, order::acb }, // 0x6d
+            { 0x6e, order::abc }, // 0x6e
+            { 0x6f, order::abc }, // 0x6f
+            { 0x2a, order::bca }, // 0x70
+            { 0x2b, order::bca }, // 0x71
+            { 0x2e, order::bca }, // 0x72
+            { 0x2f, order::bca }, // 0x73
+            { 0x2e, order::cba }, // 0x74
+            { 0x2f, order::cba }, // 0x75
+            { 0x3e, order::bca }, // 0x76
+            { 0x3f, order::bca }, // 0x77
+            { 0x6a, order::bca }, // 0x78
+            { 0x6b, order::bca }, // 0x79
+            { 0x6e, order::bac }, // 0x7a
+            { 0x6f, order::bac }, // 0x7b
+            { 0x6e, order::cab }, // 0x7c
+            { 0x6f, order::cab }, // 0x7d
+            { 0x7e, order::abc }, // 0x7e
+            { 0x7f, order::abc }, // 0x7f
+            { 0x80, order::abc }, // 0x80
+            { 0x81, order::abc }, // 0x81
+            { 0x82, order::abc }, // 0x82
+            { 0x83, order::abc }, // 0x83
+            { 0x82, order::acb }, // 0x84
+            { 0x83, order::acb }, // 0x85
+            { 0x86, order::abc }, // 0x86
+            { 0x87, order::abc }, // 0x87
+            { 0x88, order::abc }, // 0x88
+            { 0x89, order::abc }, // 0x89
+            { 0x8a, order::abc }, // 0x8a
+            { 0x8b, order::abc }, // 0x8b
+            { 0x8a, order::acb }, // 0x8c
+            { 0x8b, order::acb }, // 0x8d
+            { 0x8e, order::abc }, // 0x8e
+            { 0x8f, order::abc }, // 0x8f
+            { 0x82, order::bca }, // 0x90
+            { 0x83, order::bca }, // 0x91
+            { 0x86, order::bac }, // 0x92
+            { 0x87, order::bac }, // 0x93
+            { 0x86, order::cab }, // 0x94
+            { 0x87, order::cab }, // 0x95
+            { 0x96, order::abc }, // 0x96
+            { 0x97, order::abc }, // 0x97
+            { 0x98, order::abc }, // 0x98
+            { 0x99, order::abc }, // 0x99
+            { 0x9a, order::abc }, // 0x9a
+            { 0x9b, order::abc }, // 0x9b
+            { 0x9a, order::acb }, // 0x9c
+            { 0x9b, order::acb }, // 0x9d
+            { 0x9e, order::abc }, // 0x9e
+            { 0x9f, order::abc }, // 0x9f
+            { 0x88, order::bac }, // 0xa0
+            { 0x89, order::bac }, // 0xa1
+            { 0x8a, order::bac }, // 0xa2
+            { 0x8b, order::bac }, // 0xa3
+            { 0x98, order::bac }, // 0xa4
+            { 0x99, order::bac }, // 0xa5
+            { 0x9a, order::bac }, // 0xa6
+            { 0x9b, order::bac }, // 0xa7
+            { 0xa8, order::abc }, // 0xa8
+            { 0xa9, order::abc }, // 0xa9
+            { 0xaa, order::abc }, // 0xaa
+            { 0xab, order::abc }, // 0xab
+            { 0xac, order::abc }, // 0xac
+            { 0xad, order::abc }, // 0xad
+            { 0xae, order::abc }, // 0xae
+            { 0xaf, order::abc }, // 0xaf
+            { 0x8a, order::bca }, // 0xb0
+            { 0x8b, order::bca }, // 0xb1
+            { 0x8e, order::bac }, // 0xb2
+            { 0x8f, order::bac }, // 0xb3
+            { 0x9a, order::bca }, // 0xb4
+            { 0x9b, order::bca }, // 0xb5
+            { 0x9e, order::bac }, // 0xb6
+            { 0x9f, order::bac }, // 0xb7
+            { 0xac, order::bac }, // 0xb8
+            { 0xad, order::bac }, // 0xb9
+            { 0xae, order::bac }, // 0xba
+            { 0xaf, order::bac }, // 0xbb
+            { 0xbc, order::abc }, // 0xbc
+            { 0xbd, order::abc }, // 0xbd
+            { 0xbe, order::abc }, // 0xbe
+            { 0xbf, order::abc }, // 0xbf
+            { 0x88, order::cab }, // 0xc0
+            { 0x89, order::cab }, // 0xc1
+            { 0x98, order::cab }, // 0xc2
+            { 0x99, order::cab }, // 0xc3
+            { 0x8a, order::cab }, // 0xc4
+            { 0x8b, order::cab }, // 0xc5
+            { 0x9a, order::cab }, // 0xc6
+            { 0x9b, order::cab }, // 0xc7
+            { 0xa8, order::acb }, // 0xc8
+            { 0xa9, order::acb }, // 0xc9
+            { 0xac, order::acb }, // 0xca
+            { 0xad, order::acb }, // 0xcb
+            { 0xaa, order::acb }, // 0xcc
+            { 0xab, order::acb }, // 0xcd
+            { 0xae, order::acb }, // 0xce
+            { 0xaf, order::acb }, // 0xcf
+            { 0x8a, order::cba }, // 0xd0
+            { 0x8b, order::cba }, // 0xd1
+            { 0x9a, order::cba }, // 0xd2
+            { 0x9b, order::cba }, // 0xd3
+            { 0x8e, order::cab }, // 0xd4
+            { 0x8f, order::cab }, // 0xd5
+            { 0x9e, order::cab }, // 0xd6
+            { 0x9f, order::cab }, // 0xd7
+            { 0xac, order::cab }, // 0xd8
+            { 0xad, order::cab }, // 0xd9
+            { 0xbc, order::acb }, // 0xda
+            { 0xbd, order::acb }, // 0xdb
+            { 0xae, order::cab }, // 0xdc
+            { 0xaf, order::cab }, // 0xdd
+            { 0xbe, order::acb }, // 0xde
+            { 0xbf, order::acb }, // 0xdf
+            { 0xa8, order::bca }, // 0xe0
+            { 0xa9, order::bca }, // 0xe1
+            { 0xac, order::bca }, // 0xe2
+            { 0xad, order::bca }, // 0xe3
+            { 0xac, order::cba }, // 0xe4
+            { 0xad, order::cba }, // 0xe5
+            { 0xbc, order::bca }, // 0xe6
+            { 0xbd, order::bca }, // 0xe7
+            { 0xe8, order::abc }, // 0xe8
+            { 0xe9, order::abc }, // 0xe9
+            { 0xea, order::abc }, // 0xea
+            { 0xeb, order::abc }, // 0xeb
+            { 0xea, order::acb }, // 0xec
+            { 0xeb, order::acb }, // 0xed
+            { 0xee, order::abc }, // 0xee
+            { 0xef, order::abc }, // 0xef
+            { 0xaa, order::bca }, // 0xf0
+            { 0xab, order::bca }, // 0xf1
+            { 0xae, order::bca }, // 0xf2
+            { 0xaf, order::bca }, // 0xf3
+            { 0xae, order::cba }, // 0xf4
+            { 0xaf, order::cba }, // 0xf5
+            { 0xbe, order::bca }, // 0xf6
+            { 0xbf, order::bca }, // 0xf7
+            { 0xea, order::bca }, // 0xf8
+            { 0xeb, order::bca }, // 0xf9
+            { 0xee, order::bac }, // 0xfa
+            { 0xef, order::bac }, // 0xfb
+            { 0xee, order::cab }, // 0xfc
+            { 0xef, order::cab }, // 0xfd
+            { 0xfe, order::abc }, // 0xfe
+            { 0xff, order::abc }, // 0xff
+        };
+#ifdef TERNARYLOGIC_TESTS
+        static_assert(valid_reduction(reduced_avx512raw), "invalid reduction of avx512raw");
+#endif
+
+        template<>
+        [[nodiscard]] constexpr __m512i ternary_reduced<__m512i>(const __m512i& a, const __m512i& b, const __m512i& c, const bf_type k) noexcept {
+            switch (k) {
+                case 0x00: return priv::ternary_intern<0x00>(a, b, c);
+                case 0x01: return priv::ternary_intern<0x01>(a, b, c);
+                case 0x02: return priv::ternary_intern<0x02>(a, b, c);
+                case 0x03: return priv::ternary_intern<0x03>(a, b, c);
+                case 0x04: return priv::ternary_intern<0x02>(a, c, b);
+                case 0x05: return priv::ternary_intern<0x03>(a, c, b);
+                case 0x06: return priv::ternary_intern<0x06>(a, b, c);
+                case 0x07: return priv::ternary_intern<0x07>(a, b, c);
+                case 0x08: return priv::ternary_intern<0x08>(a, b, c);
+                case 0x09: return priv::ternary_intern<0x09>(a, b, c);
+                case 0x0a: return priv::ternary_intern<0x0a>(a, b, c);
+                case 0x0b: return priv::ternary_intern<0x0b>(a, b, c);
+                case 0x0c: return priv::ternary_intern<0x0a>(a, c, b);
+                case 0x0d: return priv::ternary_intern<0x0b>(a, c, b);
+                case 0x0e: return priv::ternary_intern<0x0e>(a, b, c);
+                case 0x0f: return priv::ternary_intern<0x0f>(a, b, c);
+                case 0x10: return priv::ternary_intern<0x02>(b, c, a);
+                case 0x11: return priv::ternary_intern<0x03>(b, c, a);
+                case 0x12: return priv::ternary_intern<0x06>(b, a, c);
+                case 0x13: return priv::ternary_intern<0x07>(b, a, c);
+                case 0x14: return priv::ternary_intern<0x06>(c, a, b);
+                case 0x15: return priv::ternary_intern<0x07>(c, a, b);
+                case 0x16: return priv::ternary_intern<0x16>(a, b, c);
+                case 0x17: return priv::ternary_intern<0x17>(a, b, c);
+                case 0x18: return priv::ternary_intern<0x18>(a, b, c);
+                case 0x19: return priv::ternary_intern<0x19>(a, b, c);
+                case 0x1a: return priv::ternary_intern<0x1a>(a, b, c);
+                case 0x1b: return priv::ternary_intern<0x1b>(a, b, c);
+                case 0x1c: return priv::ternary_intern<0x1a>(a, c, b);
+                case 0x1d: return priv::ternary_intern<0x1b>(a, c, b);
+                case 0x1e: return priv::ternary_intern<0x1e>(a, b, c);
+                case 0x1f: return priv::ternary_intern<0x1f>(a, b, c);
+                case 0x20: return priv::ternary_intern<0x08>(b, a, c);
+                case 0x21: return priv::ternary_intern<0x09>(b, a, c);
+                case 0x22: return priv::ternary_intern<0x0a>(b, a, c);
+                case 0x23: return priv::ternary_intern<0x0b>(b, a, c);
+                case 0x24: return priv::ternary_intern<0x18>(b, a, c);
+                case 0x25: return priv::ternary_intern<0x19>(b, a, c);
+                case 0x26: return priv::ternary_intern<0x1a>(b, a, c);
+                case 0x27: return priv::ternary_intern<0x1b>(b, a, c);
+                case 0x28: return priv::ternary_intern<0x28>(a, b, c);
+                case 0x29: return priv::ternary_intern<0x29>(a, b, c);
+                case 0x2a: return priv::ternary_intern<0x2a>(a, b, c);
+                case 0x2b: return priv::ternary_intern<0x2b>(a, b, c);
+                case 0x2c: return priv::ternary_intern<0x2c>(a, b, c);
+                case 0x2d: return priv::ternary_intern<0x2d>(a, b, c);
+                case 0x2e: return priv::ternary_intern<0x2e>(a, b, c);
+                case 0x2f: return priv::ternary_intern<0x2f>(a, b, c);
+                case 0x30: return priv::ternary_intern<0x0a>(b, c, a);
+                case 0x31: return priv::ternary_intern<0x0b>(b, c, a);
+                case 0x32: return priv::ternary_intern<0x0e>(b, a, c);
+                case 0x33: return priv::ternary_intern<0x0f>(b, a, c);
+                case 0x34: return priv::ternary_intern<0x1a>(b, c, a);
+                case 0x35: return priv::ternary_intern<0x1b>(b, c, a);
+                case 0x36: return priv::ternary_intern<0x1e>(b, a, c);
+                case 0x37: return priv::ternary_intern<0x1f>(b, a, c);
+                case 0x38: return priv::ternary_intern<0x2c>(b, a, c);
+                case 0x39: return priv::ternary_intern<0x2d>(b, a, c);
+                case 0x3a: return priv::ternary_intern<0x2e>(b, a, c);
+                case 0x3b: return priv::ternary_intern<0x2f>(b, a, c);
+                case 0x3c: return priv::ternary_intern<0x3c>(a, b, c);
+                case 0x3d: return priv::ternary_intern<0x3d>(a, b, c);
+                case 0x3e: return priv::ternary_intern<0x3e>(a, b, c);
+                case 0x3f: return priv::ternary_intern<0x3f>(a, b, c);
+                case 0x40: return priv::ternary_intern<0x08>(c, a, b);
+                case 0x41: return priv::ternary_intern<0x09>(c, a, b);
+                case 0x42: return priv::ternary_intern<0x18>(c, a, b);
+                case 0x43: return priv::ternary_intern<0x19>(c, a, b);
+                case 0x44: return priv::ternary_intern<0x0a>(c, a, b);
+                case 0x45: return priv::ternary_intern<0x0b>(c, a, b);
+                case 0x46: return priv::ternary_intern<0x1a>(c, a, b);
+                case 0x47: return priv::ternary_intern<0x1b>(c, a, b);
+                case 0x48: return priv::ternary_intern<0x28>(a, c, b);
+                case 0x49: return priv::ternary_intern<0x29>(a, c, b);
+                case 0x4a: return priv::ternary_intern<0x2c>(a, c, b);
+                case 0x4b: return priv::ternary_intern<0x2d>(a, c, b);
+                case 0x4c: return priv::ternary_intern<0x2a>(a, c, b);
+                case 0x4d: return priv::ternary_intern<0x2b>(a, c, b);
+                case 0x4e: return priv::ternary_intern<0x2e>(a, c, b);
+                case 0x4f: return priv::ternary_intern<0x2f>(a, c, b);
+                case 0x50: return priv::ternary_intern<0x0a>(c, b, a);
+                case 0x51: return priv::ternary_intern<0x0b>(c, b, a);
+                case 0x52: return priv::ternary_intern<0x1a>(c, b, a);
+                case 0x53: return priv::ternary_intern<0x1b>(c, b, a);
+                case 0x54: return priv::ternary_intern<0x0e>(c, a, b);
+                case 0x55: return priv::ternary_intern<0x0f>(c, a, b);
+                case 0x56: return priv::ternary_intern<0x1e>(c, a, b);
+                case 0x57: return priv::ternary_intern<0x1f>(c, a, b);
+                case 0x58: return priv::ternary_intern<0x2c>(c, a, b);
+                case 0x59: return priv::ternary_intern<0x2d>(c, a, b);
+                case 0x5a: return priv::ternary_intern<0x3c>(a, c, b);
+                case 0x5b: return priv::ternary_intern<0x3d>(a, c, b);
+                case 0x5c: return priv::ternary_intern<0x2e>(c, a, b);
+                case 0x5d: return priv::ternary_intern<0x2f>(c, a, b);
+                case 0x5e: return priv::ternary_intern<0x3e>(a, c, b);
+                case 0x5f: return priv::ternary_intern<0x3f>(a, c, b);
+                case 0x60: return priv::ternary_intern<0x28>(b, c, a);
+                case 0x61: return priv::ternary_intern<0x29>(b, c, a);
+                case 0x62: return priv::ternary_intern<0x2c>(b, c, a);
+                case 0x63: return priv::ternary_intern<0x2d>(b, c, a);
+                case 0x64: return priv::ternary_intern<0x2c>(c, b, a);
+                case 0x65: return priv::ternary_intern<0x2d>(c, b, a);
+                case 0x66: return priv::ternary_intern<0x3c>(b, c, a);
+                case 0x67: return priv::ternary_intern<0x3d>(b, c, a);
+                case 0x68: return priv::ternary_intern<0x68>(a, b, c);
+                case 0x69: return priv::ternary_intern<0x69>(a, b, c);
+                case 0x6a: return priv::ternary_intern<0x6a>(a, b, c);
+                case 0x6b: return priv::ternary_intern<0x6b>(a, b, c);
+                case 0x6c: return priv::ternary_intern<0x6a>(a, c, b);
+                case 0x6d: return priv::ternary_intern<0x6b>(a, c, b);
+                case 0x6e: return priv::ternary_intern<0x6e>(a, b, c);
+                case 0x6f: return priv::ternary_intern<0x6f>(a, b, c);
+                case 0x70: return priv::ternary_intern<0x2a>(b, c, a);
+                case 0x71: return priv::ternary_intern<0x2b>(b, c, a);
+                case 0x72: return priv::ternary_intern<0x2e>(b, c, a);
+                case 0x73: return priv::ternary_intern<0x2f>(b, c, a);
+                case 0x74: return priv::ternary_intern<0x2e>(c, b, a);
+                case 0x75: return priv::ternary_intern<0x2f>(c, b, a);
+                case 0x76: return priv::ternary_intern<0x3e>(b, c, a);
+                case 0x77: return priv::ternary_intern<0x3f>(b, c, a);
+                case 0x78: return priv::ternary_intern<0x6a>(b, c, a);
+                case 0x79: return priv::ternary_intern<0x6b>(b, c, a);
+                case 0x7a: return priv::ternary_intern<0x6e>(b, a, c);
+                case 0x7b: return priv::ternary_intern<0x6f>(b, a, c);
+                case 0x7c: return priv::ternary_intern<0x6e>(c, a, b);
+                case 0x7d: return priv::ternary_intern<0x6f>(c, a, b);
+                case 0x7e: return priv::ternary_intern<0x7e>(a, b, c);
+                case 0x7f: return priv::ternary_intern<0x7f>(a, b, c);
+                case 0x80: return priv::ternary_intern<0x80>(a, b, c);
+                case 0x81: return priv::ternary_intern<0x81>(a, b, c);
+                case 0x82: return priv::ternary_intern<0x82>(a, b, c);
+                case 0x83: return priv::ternary_intern<0x83>(a, b, c);
+                case 0x84: return priv::ternary_intern<0x82>(a, c, b);
+                case 0x85: return priv::ternary_intern<0x83>(a, c, b);
+                case 0x86: return priv::ternary_intern<0x86>(a, b, c);
+                case 0x87: return priv::ternary_intern<0x87>(a, b, c);
+                case 0x88: return priv::ternary_intern<0x88>(a, b, c);
+                case 0x89: return priv::ternary_intern<0x89>(a, b, c);
+                case 0x8a: return priv::ternary_intern<0x8a>(a, b, c);
+                case 0x8b: return priv::ternary_intern<0x8b>(a, b, c);
+                case 0x8c: return priv::ternary_intern<0x8a>(a, c, b);
+                case 0x8d: return priv::ternary_intern<0x8b>(a, c, b);
+                case 0x8e: return priv::ternary_intern<0x8e>(a, b, c);
+                case 0x8f: return priv::ternary_intern<0x8f>(a, b, c);
+                case 0x90: return priv::ternary_intern<0x82>(b, c, a);
+                case 0x91: return priv::ternary_intern<0x83>(b, c, a);
+                case 0x92: return priv::ternary_intern<0x86>(b, a, c);
+                case 0x93: return priv::ternary_intern<0x87>(b, a, c);
+                case 0x94: return priv::ternary_intern<0x86>(c, a, b);
+                case 0x95: return priv::ternary_intern<0x87>(c, a, b);
+                case 0x96: return priv::ternary_intern<0x96>(a, b, c);
+                case 0x97: return priv::ternary_intern<0x97>(a, b, c);
+                case 0x98: return priv::ternary_intern<0x98>(a, b, c);
+                case 0x99: return priv::ternary_intern<0x99>(a, b, c);
+                case 0x9a: return priv::ternary_intern<0x9a>(a, b, c);
+                case 0x9b: return priv::ternary_intern<0x9b>(a, b, c);
+                case 0x9c: return priv::ternary_intern<0x9a>(a, c, b);
+                case 0x9d: return priv::ternary_intern<0x9b>(a, c, b);
+                case 0x9e: return priv::ternary_intern<0x9e>(a, b, c);
+                case 0x9f: return priv::ternary_intern<0x9f>(a, b, c);
+                case 0xa0: return priv::ternary_intern<0x88>(b, a, c);
+                case 0xa1: return priv::ternary_intern<0x89>(b, a, c);
+                case 0xa2: return priv::ternary_intern<0x8a>(b, a, c);
+                case 0xa3: return priv::ternary_intern<0x8b>(b, a, c);
+                case 0xa4: return priv::ternary_intern<0x98>(b, a, c);
+                case 0xa5: return priv::ternary_intern<0x99>(b, a, c);
+                case 0xa6: return priv::ternary_intern<0x9a>(b, a, c);
+                case 0xa7: return priv::ternary_intern<0x9b>(b, a, c);
+                case 0xa8: return priv::ternary_intern<0xa8>(a, b, c);
+                case 0xa9: return priv::ternary_intern<0xa9>(a, b, c);
+                case 0xaa: return priv::ternary_intern<0xaa>(a, b, c);
+                case 0xab: return priv::ternary_intern<0xab>(a, b, c);
+                case 0xac: return priv::ternary_intern<0xac>(a, b, c);
+                case 0xad: return priv::ternary_intern<0xad>(a, b, c);
+                case 0xae: return priv::ternary_intern<0xae>(a, b, c);
+                case 0xaf: return priv::ternary_intern<0xaf>(a, b, c);
+                case 0xb0: return priv::ternary_intern<0x8a>(b, c, a);
+                case 0xb1: return priv::ternary_intern<0x8b>(b, c, a);
+                case 0xb2: return priv::ternary_intern<0x8e>(b, a, c);
+                case 0xb3: return priv::ternary_intern<0x8f>(b, a, c);
+                case 0xb4: return priv::ternary_intern<0x9a>(b, c, a);
+                case 0xb5: return priv::ternary_intern<0x9b>(b, c, a);
+                case 0xb6: return priv::ternary_intern<0x9e>(b, a, c);
+                case 0xb7: return priv::ternary_intern<0x9f>(b, a, c);
+                case 0xb8: return priv::ternary_intern<0xac>(b, a, c);
+                case 0xb9: return priv::ternary_intern<0xad>(b, a, c);
+                case 0xba: return priv::ternary_intern<0xae>(b, a, c);
+                case 0xbb: return priv::ternary_intern<0xaf>(b, a, c);
+                case 0xbc: return priv::ternary_intern<0xbc>(a, b, c);
+                case 0xbd: return priv::ternary_intern<0xbd>(a, b, c);
+                case 0xbe: return priv::ternary_intern<0xbe>(a, b, c);
+                case 0xbf: return priv::ternary_intern<0xbf>(a, b, c);
+                case 0xc0: return priv::ternary_intern<0x88>(c, a, b);
+                case 0xc1: return priv::ternary_intern<0x89>(c, a, b);
+                case 0xc2: return priv::ternary_intern<0x98>(c, a, b);
+                case 0xc3: return priv::ternary_intern<0x99>(c, a, b);
+                case 0xc4: return priv::ternary_intern<0x8a>(c, a, b);
+                case 0xc5: return priv::ternary_intern<0x8b>(c, a, b);
+                case 0xc6: return priv::ternary_intern<0x9a>(c, a, b);
+                case 0xc7: return priv::ternary_intern<0x9b>(c, a, b);
+                case 0xc8: return priv::ternary_intern<0xa8>(a, c, b);
+                case 0xc9: return priv::ternary_intern<0xa9>(a, c, b);
+                case 0xca: return priv::ternary_intern<0xac>(a, c, b);
+                case 0xcb: return priv::ternary_intern<0xad>(a, c, b);
+                case 0xcc: return priv::ternary_intern<0xaa>(a, c, b);
+                case 0xcd: return priv::ternary_intern<0xab>(a, c, b);
+                case 0xce: return priv::ternary_intern<0xae>(a, c, b);
+                case 0xcf: return priv::ternary_intern<0xaf>(a, c, b);
+                case 0xd0: return priv::ternary_intern<0x8a>(c, b, a);
+                case 0xd1: return priv::ternary_intern<0x8b>(c, b, a);
+                case 0xd2: return priv::ternary_intern<0x9a>(c, b, a);
+                case 0xd3: return priv::ternary_intern<0x9b>(c, b, a);
+                case 0xd4: return priv::ternary_intern<0x8e>(c, a, b);
+                case 0xd5: return priv::ternary_intern<0x8f>(c, a, b);
+                case 0xd6: return priv::ternary_intern<0x9e>(c, a, b);
+                case 0xd7: return priv::ternary_intern<0x9f>(c, a, b);
+                case 0xd8: return priv::ternary_intern<0xac>(c, a, b);
+                case 0xd9: return priv::ternary_intern<0xad>(c, a, b);
+                case 0xda: return priv::ternary_intern<0xbc>(a, c, b);
+                case 0xdb: return priv::ternary_intern<0xbd>(a, c, b);
+                case 0xdc: return priv::ternary_intern<0xae>(c, a, b);
+                case 0xdd: return priv::ternary_intern<0xaf>(c, a, b);
+                case 0xde: return priv::ternary_intern<0xbe>(a, c, b);
+                case 0xdf: return priv::ternary_intern<0xbf>(a, c, b);
+                case 0xe0: return priv::ternary_intern<0xa8>(b, c, a);
+                case 0xe1: return priv::ternary_intern<0xa9>(b, c, a);
+                case 0xe2: return priv::ternary_intern<0xac>(b, c, a);
+                case 0xe3: return priv::ternary_intern<0xad>(b, c, a);
+                case 0xe4: return priv::ternary_intern<0xac>(c, b, a);
+                case 0xe5: return priv::ternary_intern<0xad>(c, b, a);
+                case 0xe6: return priv::ternary_intern<0xbc>(b, c, a);
+                case 0xe7: return priv::ternary_intern<0xbd>(b, c, a);
+                case 0xe8: return priv::ternary_intern<0xe8>(a, b, c);
+                case 0xe9: return priv::ternary_intern<0xe9>(a, b, c);
+                case 0xea: return priv::ternary_intern<0xea>(a, b, c);
+                case 0xeb: return priv::ternary_intern<0xeb>(a, b, c);
+                case 0xec: return priv::ternary_intern<0xea>(a, c, b);
+                case 0xed: return priv::ternary_intern<0xeb>(a, c, b);
+                case 0xee: return priv::ternary_intern<0xee>(a, b, c);
+                case 0xef: return priv::ternary_intern<0xef>(a, b, c);
+                case 0xf0: return priv::ternary_intern<0xaa>(b, c, a);
+                case 0xf1: return priv::ternary_intern<0xab>(b, c, a);
+                case 0xf2: return priv::ternary_intern<0xae>(b, c, a);
+                case 0xf3: return priv::ternary_intern<0xaf>(b, c, a);
+                case 0xf4: return priv::ternary_intern<0xae>(c, b, a);
+                case 0xf5: return priv::ternary_intern<0xaf>(c, b, a);
+                case 0xf6: return priv::ternary_intern<0xbe>(b, c, a);
+                case 0xf7: return priv::ternary_intern<0xbf>(b, c, a);
+                case 0xf8: return priv::ternary_intern<0xea>(b, c, a);
+                case 0xf9: return priv::ternary_intern<0xeb>(b, c, a);
+                case 0xfa: return priv::ternary_intern<0xee>(b, a, c);
+                case 0xfb: return priv::ternary_intern<0xef>(b, a, c);
+                case 0xfc: return priv::ternary_intern<0xee>(c, a, b);
+                case 0xfd: return priv::ternary_intern<0xef>(c, a, b);
+                case 0xfe: return priv::ternary_intern<0xfe>(a, b, c);
+                case 0xff: return priv::ternary_intern<0xff>(a, b, c);
+                default: return priv::ternary_intern<0>(a, b, c);
+            }
+        }
+#endif
+    } // namespace priv
+
+} // namespace ternarylogic
+
+// eof
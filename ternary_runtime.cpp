@@ -0,0 +1,16 @@
+// The runtime-k switches of ternary(a, b, c, k), compiled once: build this translation unit with the target flags of
+// the program (-mavx2, -mavx512f, ...) and the other translation units with TERNARYLOGIC_EXTERN_RUNTIME defined
+#include "ternary_logic.cpp"
+
+namespace ternarylogic::priv
+{
+	template uint32_t ternary_runtime(const uint32_t&, const uint32_t&, const uint32_t&, bf_type) noexcept;
+	template uint64_t ternary_runtime(const uint64_t&, const uint64_t&, const uint64_t&, bf_type) noexcept;
+	template __m128i ternary_runtime(const __m128i&, const __m128i&, const __m128i&, bf_type) noexcept;
+#ifdef __AVX2__
+	template __m256i ternary_runtime(const __m256i&, const __m256i&, const __m256i&, bf_type) noexcept;
+#endif
+#ifdef __AVX512F__
+	template __m512i ternary_runtime(const __m512i&, const __m512i&, const __m512i&, bf_type) noexcept;
+#endif
+}
@@ -0,0 +1,521 @@
+#pragma once
+#include <array>
+#include <vector>
+#include <mutex>
+#include <cstdint>
+#include <cstdlib>		// for rand
+#include <iostream>		// for cout
+#include <unordered_map>
+#include <algorithm>	// for find
+
+#include "ternary_logic.cpp"
+#include "ternary_expr.h"
+#include "ternary_four.h"
+
+namespace ternarylogic::synth
+{
+	constexpr int max_inputs = 8;
+
+	/// <summary>
+	/// Truth table of a function of at most eight inputs: bit x is the value for the inputs that the bits of x hold,
+	/// input 0 in the most significant one (as A is in the function codes of ternary<K>). A function of n inputs
+	/// uses the least 2^n bits.
+	/// </summary>
+	using table = std::array<uint64_t, 4>;
+
+	namespace priv
+	{
+		struct table_hash
+		{
+			[[nodiscard]] size_t operator()(const table& t) const noexcept
+			{
+				uint64_t h = 0xcbf29ce484222325ull;
+				for (const uint64_t w : t) h = (h ^ w) * 0x100000001b3ull;
+				return static_cast<size_t>(h ^ (h >> 32));
+			}
+		};
+
+		[[nodiscard]] inline table operator~(const table& t) noexcept
+		{
+			return { ~t[0], ~t[1], ~t[2], ~t[3] };
+		}
+
+		/// <summary>
+		/// Table of the bit p of the index, the variable of input n - 1 - p of an n input function
+		/// </summary>
+		[[nodiscard]] inline table variable(const int p) noexcept
+		{
+			constexpr uint64_t masks[6] = { 0xAAAAAAAAAAAAAAAAull, 0xCCCCCCCCCCCCCCCCull, 0xF0F0F0F0F0F0F0F0ull,
+				0xFF00FF00FF00FF00ull, 0xFFFF0000FFFF0000ull, 0xFFFFFFFF00000000ull };
+			if (p < 6) return { masks[p], masks[p], masks[p], masks[p] };
+			if (p == 6) return { 0, ~0ull, 0, ~0ull };
+			return { 0, 0, ~0ull, ~0ull };
+		}
+
+		/// <summary>
+		/// f with the bit p of the index fixed to v: a function that does not depend on it
+		/// </summary>
+		[[nodiscard]] inline table cofactor(const table& f, const int p, const bool v) noexcept
+		{
+			if (p < 6) {
+				const uint64_t m = variable(p)[0];
+				const int s = 1 << p;
+				table r;
+				for (int i = 0; i < 4; ++i) {
+					r[i] = (v) ? ((f[i] & m) | ((f[i] & m) >> s)) : ((f[i] & ~m) | ((f[i] & ~m) << s));
+				}
+				return r;
+			}
+			if (p == 6) return (v) ? table{ f[1], f[1], f[3], f[3] } : table{ f[0], f[0], f[2], f[2] };
+			return (v) ? table{ f[2], f[3], f[2], f[3] } : table{ f[0], f[1], f[0], f[1] };
+		}
+
+		[[nodiscard]] inline bool depends(const table& f, const int p) noexcept
+		{
+			return cofactor(f, p, false) != cofactor(f, p, true);
+		}
+
+		[[nodiscard]] inline bool get(const table& t, const int x) noexcept
+		{
+			return (t[x >> 6] >> (x & 63)) & 1;
+		}
+
+		[[nodiscard]] inline bool is_constant(const table& f) noexcept
+		{
+			return (f == table{}) || (f == ~table{});
+		}
+
+		/// <summary>
+		/// f or ~f, the one whose bit 0 is zero: a function and its complement take the same nodes
+		/// </summary>
+		[[nodiscard]] inline table canonical(const table& f) noexcept
+		{
+			return (f[0] & 1) ? ~f : f;
+		}
+
+		/// <summary>
+		/// Decomposition of a function: one ternary node over inputs and other functions
+		/// </summary>
+		struct plan
+		{
+			enum class kind : uint8_t { leaf, four, split, pair };
+
+			int nodes;
+			kind how;
+			int p;	// bit of the index that split and pair decompose on
+			int q;	// second bit of pair
+		};
+
+		/// <summary>
+		/// Chooses the decompositions with the fewest nodes, memoised per function; sharing between the branches
+		/// is not counted, but the program shares equal functions
+		/// </summary>
+		class planner
+		{
+			std::unordered_map<table, plan, table_hash> plans_;
+
+		public:
+			[[nodiscard]] static std::vector<int> support(const table& f)
+			{
+				std::vector<int> result;
+				for (int p = max_inputs - 1; p >= 0; --p) {
+					if (depends(f, p)) result.push_back(p);
+				}
+				return result;
+			}
+
+			/// <summary>
+			/// The function g, if every cofactor of f on the bits p and q is constant, g or ~g; f is then one node over them
+			/// </summary>
+			[[nodiscard]] static bool pair_function(const table& f, const int p, const int q, table& g)
+			{
+				bool found = false;
+				for (int v = 0; v < 4; ++v) {
+					const table c = canonical(cofactor(cofactor(f, p, v & 1), q, (v >> 1) & 1));
+					if (is_constant(c)) continue;
+					if (found && (c != g)) return false;
+					g = c;
+					found = true;
+				}
+				return found;
+			}
+
+			/// <summary>
+			/// Nodes of a function that is no input and no constant; inputs and constants take none
+			/// </summary>
+			[[nodiscard]] int nodes(const table& f)
+			{
+				if (is_constant(f)) return 0;
+				return get_plan(f).nodes;
+			}
+
+			const plan& get_plan(const table& x)
+			{
+				const table f = canonical(x);
+				const auto it = plans_.find(f);
+				if (it != plans_.end()) return it->second;
+
+				const std::vector<int> s = support(f);
+				plan best{ 0, plan::kind::leaf, 0, 0 };
+				if ((s.size() == 1) && (f == canonical(variable(s[0])))) {
+					best.nodes = 0;
+				}
+				else if (s.size() <= 3) {
+					best.nodes = 1;
+				}
+				else if (s.size() == 4) {
+					best = plan{ four_program(f, s).size, plan::kind::four, 0, 0 };
+				}
+				else {
+					best.nodes = 1 << 30;
+					for (const int p : s) {
+						const table f1 = cofactor(f, p, true);
+						const table f0 = cofactor(f, p, false);
+						int n;
+						if (is_constant(f1) || (f1 == ~f0)) n = 1 + nodes(f0);
+						else if (is_constant(f0)) n = 1 + nodes(f1);
+						else n = 1 + nodes(f1) + nodes(f0);
+						if (n < best.nodes) best = plan{ n, plan::kind::split, p, 0 };
+					}
+					for (size_t i = 0; i < s.size(); ++i) {
+						for (size_t j = i + 1; j < s.size(); ++j) {
+							table g;
+							if (!pair_function(f, s[i], s[j], g)) continue;
+							const int n = 1 + nodes(g);
+							if (n < best.nodes) best = plan{ n, plan::kind::pair, s[i], s[j] };
+						}
+					}
+				}
+				return plans_.emplace(f, best).first->second;
+			}
+
+			/// <summary>
+			/// Program of the function f of the four bits s of the index
+			/// </summary>
+			[[nodiscard]] static four::program four_program(const table& f, const std::vector<int>& s)
+			{
+				uint16_t k16 = 0;
+				for (int i = 0; i < 16; ++i) {
+					int x = 0;
+					for (int j = 0; j < 4; ++j) {
+						if ((i >> (3 - j)) & 1) x |= 1 << s[j];
+					}
+					if (get(f, x)) k16 |= static_cast<uint16_t>(1 << i);
+				}
+				return four::decompose(k16);
+			}
+		};
+
+		/// <summary>
+		/// Emits the nodes of the plans; registers 0 to n - 1 are the inputs, the nodes follow
+		/// </summary>
+		class builder
+		{
+			struct value
+			{
+				uint32_t reg;
+				table stored;	// the function or its complement
+			};
+
+			planner& planner_;
+			const int n_inputs_;
+			const isa target_;
+			std::unordered_map<table, value, table_hash> values_;
+
+		public:
+			std::vector<expr::instruction> code;
+
+			builder(planner& p, const int n_inputs, const isa target) : planner_(p), n_inputs_(n_inputs), target_(target)
+			{
+				for (int i = 0; i < n_inputs; ++i) {
+					const table v = variable(n_inputs - 1 - i);
+					values_.emplace(canonical(v), value{ static_cast<uint32_t>(i), v });
+				}
+			}
+
+			/// <summary>
+			/// Register that holds f or ~f
+			/// </summary>
+			value get(const table& f, const bool root = false)
+			{
+				const auto it = values_.find(canonical(f));
+				if ((it != values_.end()) && (!root || (it->second.stored == f))) return it->second;
+
+				const plan& pl = planner_.get_plan(f);
+				const std::vector<int> s = planner::support(f);
+				std::vector<value> operands;
+				if (pl.how == plan::kind::four) {
+					const four::program p = planner::four_program(f, s);
+					uint32_t regs[four::n_inputs + four::max_instructions];
+					for (int j = 0; j < 4; ++j) regs[j] = get(variable(s[j])).reg;
+					for (int i = 0; i < p.size - 1; ++i) {
+						const four::instruction& ins = p.code[i];
+						regs[four::n_inputs + i] = emit(ins.k, regs[ins.a], regs[ins.b], regs[ins.c]);
+					}
+					const four::instruction& last = p.code[p.size - 1];
+					const bool complement = !root && complement_is_cheaper(last.k, target_);
+					const uint32_t reg = emit(complement ? (last.k ^ 0xFF) : last.k, regs[last.a], regs[last.b], regs[last.c], complement);
+					return remember(f, value{ reg, complement ? ~f : f });
+				}
+				if (pl.how == plan::kind::leaf) {
+					for (const int p : s) operands.push_back(get(variable(p)));
+				}
+				else if (pl.how == plan::kind::split) {
+					operands.push_back(get(variable(pl.p)));
+					const table f1 = cofactor(f, pl.p, true);
+					const table f0 = cofactor(f, pl.p, false);
+					if (!is_constant(f1) && (f1 != ~f0)) operands.push_back(get(f1));
+					if (!is_constant(f0)) operands.push_back(get(f0));
+				}
+				else {
+					table g;
+					static_cast<void>(planner::pair_function(f, pl.p, pl.q, g));
+					operands = { get(variable(pl.p)), get(variable(pl.q)), get(g) };
+				}
+				return node(f, operands, root);
+			}
+
+		private:
+			uint32_t emit(const uint8_t k, const uint32_t a, const uint32_t b, const uint32_t c, const bool complemented = false)
+			{
+				const uint32_t reg = static_cast<uint32_t>(n_inputs_ + code.size());
+				code.push_back(expr::instruction{ k, reg, a, b, c, complemented });
+				return reg;
+			}
+
+			value remember(const table& f, const value& v)
+			{
+				values_[canonical(f)] = v;
+				return v;
+			}
+
+			/// <summary>
+			/// One node that computes f from the values of the operands: its function code is read off the tables
+			/// </summary>
+			value node(const table& f, std::vector<value> operands, const bool root)
+			{
+				while (operands.size() < 3) operands.push_back(operands[0]);
+				unsigned k = 0;
+				for (int x = 0; x < 256; ++x) {
+					const int index = (priv::get(operands[0].stored, x) << 2) | (priv::get(operands[1].stored, x) << 1) | priv::get(operands[2].stored, x);
+					if (priv::get(f, x)) k |= 1u << index;
+				}
+				const bool complement = !root && complement_is_cheaper(k, target_);
+				const uint32_t reg = emit(static_cast<uint8_t>(complement ? (k ^ 0xFF) : k), operands[0].reg, operands[1].reg, operands[2].reg, complement);
+				return remember(f, value{ reg, complement ? ~f : f });
+			}
+		};
+
+		/// <summary>
+		/// The function of n inputs over the 256 bits: it does not depend on the bits of the index from n up
+		/// </summary>
+		[[nodiscard]] inline table expand(const table& t, const int n) noexcept
+		{
+			table r{};
+			for (int x = 0; x < 256; ++x) {
+				if (get(t, x & ((1 << n) - 1))) r[x >> 6] |= 1ull << (x & 63);
+			}
+			return r;
+		}
+	}
+
+	/// <summary>
+	/// Program of ternary functions that computes the function of n inputs (at most eight) of truth table t; each
+	/// node is a ternary<K>, and results in scratch are kept complemented where that is cheaper on the target
+	/// backend (see expr::compile). Run it with expr::execute.
+	/// </summary>
+	[[nodiscard]] inline expr::program synthesise(const table& t, const int n, const isa target)
+	{
+		const table f = priv::expand(t, n);
+
+		expr::program p;
+		p.target = target;
+		p.n_inputs = static_cast<size_t>(n);
+		p.n_outputs = 1;
+		const uint32_t output = static_cast<uint32_t>(n);
+
+		if (priv::is_constant(f)) {
+			p.code.push_back(expr::instruction{ f[0] ? 0xFFu : 0x00u, output, output, output, output });
+			return p;
+		}
+
+		priv::planner planner;
+		priv::builder b(planner, n, target);
+		const uint32_t root = b.get(f, true).reg;
+		if (root < static_cast<uint32_t>(n)) { // an input or its complement
+			const bool same = (f == priv::variable(n - 1 - static_cast<int>(root)));
+			p.code.push_back(expr::instruction{ same ? 0xF0u : 0x0Fu, output, root, root, root });
+			return p;
+		}
+
+		// registers of the nodes to operands: the root to the output, the others to scratch as soon as one is dead
+		const size_t n_nodes = b.code.size();
+		std::vector<size_t> last_use(n + n_nodes, 0);
+		for (size_t i = 0; i < n_nodes; ++i) {
+			for (const uint32_t r : { b.code[i].a, b.code[i].b, b.code[i].c }) last_use[r] = i;
+		}
+		std::vector<uint32_t> operand(n + n_nodes);
+		for (int i = 0; i < n; ++i) operand[i] = static_cast<uint32_t>(i);
+		std::vector<uint32_t> free_scratch;
+		for (size_t i = 0; i < n_nodes; ++i) {
+			const expr::instruction& ins = b.code[i];
+			const uint32_t a = operand[ins.a];
+			const uint32_t bb = operand[ins.b];
+			const uint32_t c = operand[ins.c];
+			for (const uint32_t r : { ins.a, ins.b, ins.c }) {
+				if ((r >= static_cast<uint32_t>(n)) && (last_use[r] == i) && (std::find(free_scratch.begin(), free_scratch.end(), operand[r]) == free_scratch.end())) {
+					free_scratch.push_back(operand[r]);
+				}
+			}
+			if (ins.dst == root) {
+				operand[ins.dst] = output;
+			}
+			else if (free_scratch.empty()) {
+				operand[ins.dst] = static_cast<uint32_t>(n + 1 + p.n_scratch++);
+			}
+			else {
+				operand[ins.dst] = free_scratch.back();
+				free_scratch.pop_back();
+			}
+			p.code.push_back(expr::instruction{ ins.k, operand[ins.dst], a, bb, c, ins.complemented });
+		}
+		return p;
+	}
+
+	/// <summary>
+	/// The program of synthesise, from a cache keyed by the truth table: rule tables are synthesised once
+	/// </summary>
+	[[nodiscard]] inline const expr::program& cached(const table& t, const int n, const isa target)
+	{
+		struct key_hash
+		{
+			[[nodiscard]] size_t operator()(const std::pair<table, int>& k) const noexcept { return priv::table_hash()(k.first) ^ static_cast<size_t>(k.second); }
+		};
+		static std::mutex mutex;
+		static std::unordered_map<std::pair<table, int>, expr::program, key_hash> cache;
+
+		const std::pair<table, int> key(priv::expand(t, n), (n << 8) | static_cast<int>(target));
+		const std::lock_guard<std::mutex> lock(mutex);
+		const auto it = cache.find(key);
+		if (it != cache.end()) return it->second;
+		return cache.emplace(key, synthesise(t, n, target)).first->second;
+	}
+
+	/// <summary>
+	/// The program of synthesise for the backend of bit-vectors of T
+	/// </summary>
+	template<typename T>
+	[[nodiscard]] expr::program synthesise(const table& t, const int n)
+	{
+		return synthesise(t, n, isa_of<T>::value);
+	}
+
+	/// <summary>
+	/// The program of cached for the backend of bit-vectors of T
+	/// </summary>
+	template<typename T>
+	[[nodiscard]] const expr::program& cached(const table& t, const int n)
+	{
+		return cached(t, n, isa_of<T>::value);
+	}
+
+	/// <summary>
+	/// Evaluate the function of n inputs of truth table t over n elements of each input buffer, with the bulk engine
+	/// </summary>
+	template<typename T>
+	void execute(const table& t, const int n_inputs, const T* const* inputs, T* output, const size_t n)
+	{
+		expr::execute<T>(cached<T>(t, n_inputs), inputs, &output, n);
+	}
+}
+
+namespace ternarylogic::synth::test
+{
+	/// <summary>
+	/// Value of the function for every bit of the inputs
+	/// </summary>
+	[[nodiscard]] inline uint64_t evaluate_naive(const table& t, const int n_inputs, const uint64_t* x) noexcept
+	{
+		uint64_t result = 0;
+		for (int bit = 0; bit < 64; ++bit) {
+			int index = 0;
+			for (int i = 0; i < n_inputs; ++i) index = (index << 1) | static_cast<int>((x[i] >> bit) & 1);
+			if (priv::get(t, index)) result |= 1ull << bit;
+		}
+		return result;
+	}
+
+	[[nodiscard]] inline bool program_equals_naive(const table& t, const int n_inputs)
+	{
+		constexpr size_t n = 64;
+		std::vector<std::vector<uint64_t>> inputs(n_inputs, std::vector<uint64_t>(n));
+		for (auto& in : inputs) for (auto& w : in) w = expr::test::random_word();
+		std::vector<const uint64_t*> in_ptr;
+		for (auto& in : inputs) in_ptr.push_back(in.data());
+		std::vector<uint64_t> output(n);
+		execute<uint64_t>(t, n_inputs, in_ptr.data(), output.data(), n);
+
+		for (size_t i = 0; i < n; ++i) {
+			uint64_t x[max_inputs];
+			for (int j = 0; j < n_inputs; ++j) x[j] = inputs[j][i];
+			if (output[i] != evaluate_naive(t, n_inputs, x)) return false;
+		}
+		return true;
+	}
+
+	[[nodiscard]] inline table parity(const int n_inputs)
+	{
+		table t{};
+		for (int x = 0; x < (1 << n_inputs); ++x) {
+			int ones = 0;
+			for (int i = 0; i < n_inputs; ++i) ones += (x >> i) & 1;
+			if (ones & 1) t[x >> 6] |= 1ull << (x & 63);
+		}
+		return t;
+	}
+
+	inline void tests()
+	{
+		std::cout << "ternary_synth::tests" << std::endl;
+		bool has_error = false;
+
+		// random rule tables of every size, and functions with fewer inputs than the table
+		for (int n_inputs = 1; n_inputs <= max_inputs; ++n_inputs) {
+			for (int experiment = 0; experiment < 20; ++experiment) {
+				table t{};
+				for (auto& w : t) w = expr::test::random_word();
+				if (experiment == 1) t = { 0, 0, 0, 0 };
+				if (experiment == 2) t = { 0xAAAAAAAAAAAAAAAAull, 0xAAAAAAAAAAAAAAAAull, 0xAAAAAAAAAAAAAAAAull, 0xAAAAAAAAAAAAAAAAull };
+				if (experiment == 3) t = { 0xF0F0F0F0F0F0F0F0ull & 0xCCCCCCCCCCCCCCCCull, 0xF0F0F0F0F0F0F0F0ull & 0xCCCCCCCCCCCCCCCCull, 0, 0 };
+				if (!program_equals_naive(t, n_inputs)) {
+					std::cout << "ERROR: " << n_inputs << " inputs, experiment " << experiment << std::endl;
+					has_error = true;
+				}
+			}
+		}
+
+		// parity of eight inputs takes four xor3, a multiplexer of four inputs three nodes
+		const expr::program p = synthesise<uint64_t>(parity(8), 8);
+		table mux{};
+		for (int x = 0; x < 64; ++x) {
+			const int select = x >> 4;
+			if ((x >> (3 - select)) & 1) mux[0] |= 1ull << x;
+		}
+		if ((p.code.size() != 4) || (synthesise(mux, 6, isa::avx2).code.size() != 3) || !program_equals_naive(parity(8), 8) || !program_equals_naive(mux, 6)) {
+			std::cout << "ERROR: parity takes " << p.code.size() << " nodes" << std::endl;
+			has_error = true;
+		}
+		if (&cached<uint64_t>(parity(8), 8) != &cached(parity(8), 8, isa_of<uint64_t>::value)) {
+			std::cout << "ERROR: not cached" << std::endl;
+			has_error = true;
+		}
+
+		if (has_error) {
+			std::cout << "NOT EQUAL!" << std::endl;
+			static_cast<void>(getchar());
+		}
+		else {
+			std::cout << "ternary_synth::tests: No errors found!" << std::endl;
+		}
+	}
+}
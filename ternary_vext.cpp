@@ -0,0 +1,2308 @@
+// Generated automatically, please do not edit
+#pragma once
+#include <cstdint>
+#if defined(__has_include)
+#if __has_include(<experimental/simd>) && (__cplusplus >= 201703L)
+#include <experimental/simd>
+#endif
+#endif
+
+namespace ternarylogic {
+
+    namespace vext {
+
+        // GCC and Clang vector extensions: no intrinsics, the compiler picks the instructions
+        // of -march (vpternlog with AVX-512, andn/pandn, or several registers per vector)
+
+        typedef uint64_t v128  __attribute__((vector_size(16)));
+        typedef uint64_t v256  __attribute__((vector_size(32)));
+        typedef uint64_t v512  __attribute__((vector_size(64)));
+        typedef uint64_t v1024 __attribute__((vector_size(128)));
+
+#if defined(__cpp_lib_experimental_parallel_simd)
+        // width of the target, e.g. four lanes with AVX2
+        typedef std::experimental::native_simd<uint64_t> simd;
+#endif
+
+        // the kernels take any V with ~, &, | and ^ whose value initialisation V{} is zero:
+        // the vectors above, std::experimental::simd of an integer type, and the integer types
+        template<unsigned k> struct ternary_kernel {
+            static_assert(k < 256, "Unspecified ternary function");
+        };
+
+        // code=0x00, function=0, lowered=0, set=superopt_lat_xop
+        template<> struct ternary_kernel<0x00> {
+            template<typename V> static constexpr V apply(const V, const V, const V) noexcept {
+                const V c0 = V{};
+                return c0;
+            }
+        };
+        // code=0x01, function=(not ((B or C)) and not (A)), lowered=((B or C) notand not (A)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x01> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = B | C;
+                const V t1 = ~A;
+                const V t2 = ~t0 & t1;
+                return t2;
+            }
+        };
+        // code=0x02, function=(not ((A or B)) and C), lowered=((A or B) notand C), set=superopt_lat_xop
+        template<> struct ternary_kernel<0x02> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = A | B;
+                const V t1 = ~t0 & C;
+                return t1;
+            }
+        };
+        // code=0x03, function=(not (B) and not (A)), lowered=(B notand not (A)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x03> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V) noexcept {
+                const V t0 = ~A;
+                const V t1 = ~B & t0;
+                return t1;
+            }
+        };
+        // code=0x04, function=(not ((A or C)) and B), lowered=((A or C) notand B), set=superopt_lat_xop
+        template<> struct ternary_kernel<0x04> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = A | C;
+                const V t1 = ~t0 & B;
+                return t1;
+            }
+        };
+        // code=0x05, function=(not (C) and not (A)), lowered=(C notand not (A)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x05> {
+            template<typename V> static constexpr V apply(const V A, const V, const V C) noexcept {
+                const V t0 = ~A;
+                const V t1 = ~C & t0;
+                return t1;
+            }
+        };
+        // code=0x06, function=(not (A) and (B xor C)), lowered=(A notand (B xor C)), set=superopt_lat_xop
+        template<> struct ternary_kernel<0x06> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = B ^ C;
+                const V t1 = ~A & t0;
+                return t1;
+            }
+        };
+        // code=0x07, function=(not ((B and C)) and not (A)), lowered=((B and C) notand not (A)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x07> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = B & C;
+                const V t1 = ~A;
+                const V t2 = ~t0 & t1;
+                return t2;
+            }
+        };
+        // code=0x08, function=(not (A) and (B and C)), lowered=(A notand (B and C)), set=superopt_lat_xop
+        template<> struct ternary_kernel<0x08> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = B & C;
+                const V t1 = ~A & t0;
+                return t1;
+            }
+        };
+        // code=0x09, function=(not ((B xor C)) and not (A)), lowered=((B xor C) notand not (A)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x09> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = B ^ C;
+                const V t1 = ~A;
+                const V t2 = ~t0 & t1;
+                return t2;
+            }
+        };
+        // code=0x0a, function=(not (A) and C), lowered=(A notand C), set=superopt_lat_xop
+        template<> struct ternary_kernel<0x0a> {
+            template<typename V> static constexpr V apply(const V A, const V, const V C) noexcept {
+                const V t0 = ~A & C;
+                return t0;
+            }
+        };
+        // code=0x0b, function=(not ((not (C) and B)) and not (A)), lowered=((C notand B) notand not (A)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x0b> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~C & B;
+                const V t1 = ~A;
+                const V t2 = ~t0 & t1;
+                return t2;
+            }
+        };
+        // code=0x0c, function=(not (A) and B), lowered=(A notand B), set=superopt_lat_xop
+        template<> struct ternary_kernel<0x0c> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V) noexcept {
+                const V t0 = ~A & B;
+                return t0;
+            }
+        };
+        // code=0x0d, function=(not ((not (B) and C)) and not (A)), lowered=((B notand C) notand not (A)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x0d> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~B & C;
+                const V t1 = ~A;
+                const V t2 = ~t0 & t1;
+                return t2;
+            }
+        };
+        // code=0x0e, function=(not (A) and (B or C)), lowered=(A notand (B or C)), set=superopt_lat_xop
+        template<> struct ternary_kernel<0x0e> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = B | C;
+                const V t1 = ~A & t0;
+                return t1;
+            }
+        };
+        // code=0x0f, function=not (A), lowered=not (A), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x0f> {
+            template<typename V> static constexpr V apply(const V A, const V, const V) noexcept {
+                const V t0 = ~A;
+                return t0;
+            }
+        };
+        // code=0x10, function=(not ((B or C)) and A), lowered=((B or C) notand A), set=superopt_lat_xop
+        template<> struct ternary_kernel<0x10> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = B | C;
+                const V t1 = ~t0 & A;
+                return t1;
+            }
+        };
+        // code=0x11, function=(not (C) and not (B)), lowered=(C notand not (B)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x11> {
+            template<typename V> static constexpr V apply(const V, const V B, const V C) noexcept {
+                const V t0 = ~B;
+                const V t1 = ~C & t0;
+                return t1;
+            }
+        };
+        // code=0x12, function=(not (B) and (A xor C)), lowered=(B notand (A xor C)), set=superopt_lat_xop
+        template<> struct ternary_kernel<0x12> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = A ^ C;
+                const V t1 = ~B & t0;
+                return t1;
+            }
+        };
+        // code=0x13, function=(not ((A and C)) and not (B)), lowered=((A and C) notand not (B)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x13> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = A & C;
+                const V t1 = ~B;
+                const V t2 = ~t0 & t1;
+                return t2;
+            }
+        };
+        // code=0x14, function=(not (C) and (A xor B)), lowered=(C notand (A xor B)), set=superopt_lat_xop
+        template<> struct ternary_kernel<0x14> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = A ^ B;
+                const V t1 = ~C & t0;
+                return t1;
+            }
+        };
+        // code=0x15, function=(not ((A and B)) and not (C)), lowered=((A and B) notand not (C)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x15> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = A & B;
+                const V t1 = ~C;
+                const V t2 = ~t0 & t1;
+                return t2;
+            }
+        };
+        // code=0x16, function=((C or (A and B)) xor (A or B)), lowered=((C or (A and B)) xor (A or B)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x16> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = A & B;
+                const V t1 = C | t0;
+                const V t2 = A | B;
+                const V t3 = t1 ^ t2;
+                return t3;
+            }
+        };
+        // code=0x17, function=((C and (A xor B)) xor (not (A) or (A xor B))), lowered=((C and (A xor B)) xor (not (A) or (A xor B))), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x17> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = A ^ B;
+                const V t1 = C & t0;
+                const V t2 = ~A;
+                const V t3 = t2 | t0;
+                const V t4 = t1 ^ t3;
+                return t4;
+            }
+        };
+        // code=0x18, function=((A xor B) and (A xor C)), lowered=((A xor B) and (A xor C)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x18> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = A ^ B;
+                const V t1 = A ^ C;
+                const V t2 = t0 & t1;
+                return t2;
+            }
+        };
+        // code=0x19, function=(not ((A and B)) and (C xor not (B))), lowered=((A and B) notand (C xor not (B))), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x19> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = A & B;
+                const V t1 = ~B;
+                const V t2 = C ^ t1;
+                const V t3 = ~t0 & t2;
+                return t3;
+            }
+        };
+        // code=0x1a, function=(not ((A and B)) and (A xor C)), lowered=((A and B) notand (A xor C)), set=superopt_lat_xop
+        template<> struct ternary_kernel<0x1a> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = A & B;
+                const V t1 = A ^ C;
+                const V t2 = ~t0 & t1;
+                return t2;
+            }
+        };
+        // code=0x1b, function=(not (A) xor (not (C) and (A xor B))), lowered=(not (A) xor (C notand (A xor B))), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x1b> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~A;
+                const V t1 = A ^ B;
+                const V t2 = ~C & t1;
+                const V t3 = t0 ^ t2;
+                return t3;
+            }
+        };
+        // code=0x1c, function=(not ((A and C)) and (A xor B)), lowered=((A and C) notand (A xor B)), set=superopt_lat_xop
+        template<> struct ternary_kernel<0x1c> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = A & C;
+                const V t1 = A ^ B;
+                const V t2 = ~t0 & t1;
+                return t2;
+            }
+        };
+        // code=0x1d, function=(not (A) xor (not (B) and (A xor C))), lowered=(not (A) xor (B notand (A xor C))), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x1d> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~A;
+                const V t1 = A ^ C;
+                const V t2 = ~B & t1;
+                const V t3 = t0 ^ t2;
+                return t3;
+            }
+        };
+        // code=0x1e, function=(A xor (B or C)), lowered=(A xor (B or C)), set=superopt_lat_xop
+        template<> struct ternary_kernel<0x1e> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = B | C;
+                const V t1 = A ^ t0;
+                return t1;
+            }
+        };
+        // code=0x1f, function=not ((A and (B or C))), lowered=not ((A and (B or C))), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x1f> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = B | C;
+                const V t1 = A & t0;
+                const V t2 = ~t1;
+                return t2;
+            }
+        };
+        // code=0x20, function=(not (B) and (A and C)), lowered=(B notand (A and C)), set=superopt_lat_xop
+        template<> struct ternary_kernel<0x20> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = A & C;
+                const V t1 = ~B & t0;
+                return t1;
+            }
+        };
+        // code=0x21, function=(not ((A xor C)) and not (B)), lowered=((A xor C) notand not (B)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x21> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = A ^ C;
+                const V t1 = ~B;
+                const V t2 = ~t0 & t1;
+                return t2;
+            }
+        };
+        // code=0x22, function=(not (B) and C), lowered=(B notand C), set=superopt_lat_xop
+        template<> struct ternary_kernel<0x22> {
+            template<typename V> static constexpr V apply(const V, const V B, const V C) noexcept {
+                const V t0 = ~B & C;
+                return t0;
+            }
+        };
+        // code=0x23, function=(not ((not (C) and A)) and not (B)), lowered=((C notand A) notand not (B)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x23> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~C & A;
+                const V t1 = ~B;
+                const V t2 = ~t0 & t1;
+                return t2;
+            }
+        };
+        // code=0x24, function=(not ((A xor C)) and (A xor B)), lowered=((A xor C) notand (A xor B)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x24> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = A ^ C;
+                const V t1 = A ^ B;
+                const V t2 = ~t0 & t1;
+                return t2;
+            }
+        };
+        // code=0x25, function=(not ((A and B)) and (C xor not (A))), lowered=((A and B) notand (C xor not (A))), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x25> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = A & B;
+                const V t1 = ~A;
+                const V t2 = C ^ t1;
+                const V t3 = ~t0 & t2;
+                return t3;
+            }
+        };
+        // code=0x26, function=(not ((A and B)) and (B xor C)), lowered=((A and B) notand (B xor C)), set=superopt_lat_xop
+        template<> struct ternary_kernel<0x26> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = A & B;
+                const V t1 = B ^ C;
+                const V t2 = ~t0 & t1;
+                return t2;
+            }
+        };
+        // code=0x27, function=((B and C) xor (C or not (A))), lowered=((B and C) xor (C or not (A))), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x27> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = B & C;
+                const V t1 = ~A;
+                const V t2 = C | t1;
+                const V t3 = t0 ^ t2;
+                return t3;
+            }
+        };
+        // code=0x28, function=(C and (A xor B)), lowered=(C and (A xor B)), set=superopt_lat_xop
+        template<> struct ternary_kernel<0x28> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = A ^ B;
+                const V t1 = C & t0;
+                return t1;
+            }
+        };
+        // code=0x29, function=((B xor not (A)) xor (C or (A and B))), lowered=((B xor not (A)) xor (C or (A and B))), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x29> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~A;
+                const V t1 = B ^ t0;
+                const V t2 = A & B;
+                const V t3 = C | t2;
+                const V t4 = t1 ^ t3;
+                return t4;
+            }
+        };
+        // code=0x2a, function=(not ((A and B)) and C), lowered=((A and B) notand C), set=superopt_lat_xop
+        template<> struct ternary_kernel<0x2a> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = A & B;
+                const V t1 = ~t0 & C;
+                return t1;
+            }
+        };
+        // code=0x2b, function=((not (B) and not (A)) or (not ((A and B)) and C)), lowered=((B notand not (A)) or ((A and B) notand C)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x2b> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~A;
+                const V t1 = ~B & t0;
+                const V t2 = A & B;
+                const V t3 = ~t2 & C;
+                const V t4 = t1 | t3;
+                return t4;
+            }
+        };
+        // code=0x2c, function=((A xor B) and (B or C)), lowered=((A xor B) and (B or C)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x2c> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = A ^ B;
+                const V t1 = B | C;
+                const V t2 = t0 & t1;
+                return t2;
+            }
+        };
+        // code=0x2d, function=(not (A) xor (not (B) and C)), lowered=(not (A) xor (B notand C)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x2d> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~A;
+                const V t1 = ~B & C;
+                const V t2 = t0 ^ t1;
+                return t2;
+            }
+        };
+        // code=0x2e, function=((A and B) xor (B or C)), lowered=((A and B) xor (B or C)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x2e> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = A & B;
+                const V t1 = B | C;
+                const V t2 = t0 ^ t1;
+                return t2;
+            }
+        };
+        // code=0x2f, function=(not (A) or (not (B) and C)), lowered=(not (A) or (B notand C)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x2f> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~A;
+                const V t1 = ~B & C;
+                const V t2 = t0 | t1;
+                return t2;
+            }
+        };
+        // code=0x30, function=(not (B) and A), lowered=(B notand A), set=superopt_lat_xop
+        template<> struct ternary_kernel<0x30> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V) noexcept {
+                const V t0 = ~B & A;
+                return t0;
+            }
+        };
+        // code=0x31, function=(not ((not (A) and C)) and not (B)), lowered=((A notand C) notand not (B)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x31> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~A & C;
+                const V t1 = ~B;
+                const V t2 = ~t0 & t1;
+                return t2;
+            }
+        };
+        // code=0x32, function=(not (B) and (A or C)), lowered=(B notand (A or C)), set=superopt_lat_xop
+        template<> struct ternary_kernel<0x32> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = A | C;
+                const V t1 = ~B & t0;
+                return t1;
+            }
+        };
+        // code=0x33, function=not (B), lowered=not (B), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x33> {
+            template<typename V> static constexpr V apply(const V, const V B, const V) noexcept {
+                const V t0 = ~B;
+                return t0;
+            }
+        };
+        // code=0x34, function=(not ((B and C)) and (A xor B)), lowered=((B and C) notand (A xor B)), set=superopt_lat_xop
+        template<> struct ternary_kernel<0x34> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = B & C;
+                const V t1 = A ^ B;
+                const V t2 = ~t0 & t1;
+                return t2;
+            }
+        };
+        // code=0x35, function=((B or not (A)) xor (A or C)), lowered=((B or not (A)) xor (A or C)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x35> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~A;
+                const V t1 = B | t0;
+                const V t2 = A | C;
+                const V t3 = t1 ^ t2;
+                return t3;
+            }
+        };
+        // code=0x36, function=(B xor (A or C)), lowered=(B xor (A or C)), set=superopt_lat_xop
+        template<> struct ternary_kernel<0x36> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = A | C;
+                const V t1 = B ^ t0;
+                return t1;
+            }
+        };
+        // code=0x37, function=not ((B and (A or C))), lowered=not ((B and (A or C))), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x37> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = A | C;
+                const V t1 = B & t0;
+                const V t2 = ~t1;
+                return t2;
+            }
+        };
+        // code=0x38, function=((A xor B) and (A or C)), lowered=((A xor B) and (A or C)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x38> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = A ^ B;
+                const V t1 = A | C;
+                const V t2 = t0 & t1;
+                return t2;
+            }
+        };
+        // code=0x39, function=((not (A) and C) xor not (B)), lowered=((A notand C) xor not (B)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x39> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~A & C;
+                const V t1 = ~B;
+                const V t2 = t0 ^ t1;
+                return t2;
+            }
+        };
+        // code=0x3a, function=((A and B) xor (A or C)), lowered=((A and B) xor (A or C)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x3a> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = A & B;
+                const V t1 = A | C;
+                const V t2 = t0 ^ t1;
+                return t2;
+            }
+        };
+        // code=0x3b, function=((not (A) and C) or not (B)), lowered=((A notand C) or not (B)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x3b> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~A & C;
+                const V t1 = ~B;
+                const V t2 = t0 | t1;
+                return t2;
+            }
+        };
+        // code=0x3c, function=(A xor B), lowered=(A xor B), set=superopt_lat_xop
+        template<> struct ternary_kernel<0x3c> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V) noexcept {
+                const V t0 = A ^ B;
+                return t0;
+            }
+        };
+        // code=0x3d, function=(not (A) xor (not (B) and (A or C))), lowered=(not (A) xor (B notand (A or C))), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x3d> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~A;
+                const V t1 = A | C;
+                const V t2 = ~B & t1;
+                const V t3 = t0 ^ t2;
+                return t3;
+            }
+        };
+        // code=0x3e, function=((not (A) and C) or (A xor B)), lowered=((A notand C) or (A xor B)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x3e> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~A & C;
+                const V t1 = A ^ B;
+                const V t2 = t0 | t1;
+                return t2;
+            }
+        };
+        // code=0x3f, function=not ((A and B)), lowered=not ((A and B)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x3f> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V) noexcept {
+                const V t0 = A & B;
+                const V t1 = ~t0;
+                return t1;
+            }
+        };
+        // code=0x40, function=(not (C) and (A and B)), lowered=(C notand (A and B)), set=superopt_lat_xop
+        template<> struct ternary_kernel<0x40> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = A & B;
+                const V t1 = ~C & t0;
+                return t1;
+            }
+        };
+        // code=0x41, function=(not ((A xor B)) and not (C)), lowered=((A xor B) notand not (C)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x41> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = A ^ B;
+                const V t1 = ~C;
+                const V t2 = ~t0 & t1;
+                return t2;
+            }
+        };
+        // code=0x42, function=(not ((A xor B)) and (A xor C)), lowered=((A xor B) notand (A xor C)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x42> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = A ^ B;
+                const V t1 = A ^ C;
+                const V t2 = ~t0 & t1;
+                return t2;
+            }
+        };
+        // code=0x43, function=(not ((A and C)) and (B xor not (A))), lowered=((A and C) notand (B xor not (A))), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x43> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = A & C;
+                const V t1 = ~A;
+                const V t2 = B ^ t1;
+                const V t3 = ~t0 & t2;
+                return t3;
+            }
+        };
+        // code=0x44, function=(not (C) and B), lowered=(C notand B), set=superopt_lat_xop
+        template<> struct ternary_kernel<0x44> {
+            template<typename V> static constexpr V apply(const V, const V B, const V C) noexcept {
+                const V t0 = ~C & B;
+                return t0;
+            }
+        };
+        // code=0x45, function=(not ((not (B) and A)) and not (C)), lowered=((B notand A) notand not (C)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x45> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~B & A;
+                const V t1 = ~C;
+                const V t2 = ~t0 & t1;
+                return t2;
+            }
+        };
+        // code=0x46, function=(not ((A and C)) and (B xor C)), lowered=((A and C) notand (B xor C)), set=superopt_lat_xop
+        template<> struct ternary_kernel<0x46> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = A & C;
+                const V t1 = B ^ C;
+                const V t2 = ~t0 & t1;
+                return t2;
+            }
+        };
+        // code=0x47, function=((B and C) xor (B or not (A))), lowered=((B and C) xor (B or not (A))), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x47> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = B & C;
+                const V t1 = ~A;
+                const V t2 = B | t1;
+                const V t3 = t0 ^ t2;
+                return t3;
+            }
+        };
+        // code=0x48, function=(B and (A xor C)), lowered=(B and (A xor C)), set=superopt_lat_xop
+        template<> struct ternary_kernel<0x48> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = A ^ C;
+                const V t1 = B & t0;
+                return t1;
+            }
+        };
+        // code=0x49, function=((C xor not (A)) xor (B or (A and C))), lowered=((C xor not (A)) xor (B or (A and C))), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x49> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~A;
+                const V t1 = C ^ t0;
+                const V t2 = A & C;
+                const V t3 = B | t2;
+                const V t4 = t1 ^ t3;
+                return t4;
+            }
+        };
+        // code=0x4a, function=((A xor C) and (B or C)), lowered=((A xor C) and (B or C)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x4a> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = A ^ C;
+                const V t1 = B | C;
+                const V t2 = t0 & t1;
+                return t2;
+            }
+        };
+        // code=0x4b, function=(not (A) xor (not (C) and B)), lowered=(not (A) xor (C notand B)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x4b> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~A;
+                const V t1 = ~C & B;
+                const V t2 = t0 ^ t1;
+                return t2;
+            }
+        };
+        // code=0x4c, function=(not ((A and C)) and B), lowered=((A and C) notand B), set=superopt_lat_xop
+        template<> struct ternary_kernel<0x4c> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = A & C;
+                const V t1 = ~t0 & B;
+                return t1;
+            }
+        };
+        // code=0x4d, function=((not (C) and not (A)) or (not ((A and C)) and B)), lowered=((C notand not (A)) or ((A and C) notand B)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x4d> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~A;
+                const V t1 = ~C & t0;
+                const V t2 = A & C;
+                const V t3 = ~t2 & B;
+                const V t4 = t1 | t3;
+                return t4;
+            }
+        };
+        // code=0x4e, function=((A and C) xor (B or C)), lowered=((A and C) xor (B or C)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x4e> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = A & C;
+                const V t1 = B | C;
+                const V t2 = t0 ^ t1;
+                return t2;
+            }
+        };
+        // code=0x4f, function=(not (A) or (not (C) and B)), lowered=(not (A) or (C notand B)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x4f> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~A;
+                const V t1 = ~C & B;
+                const V t2 = t0 | t1;
+                return t2;
+            }
+        };
+        // code=0x50, function=(not (C) and A), lowered=(C notand A), set=superopt_lat_xop
+        template<> struct ternary_kernel<0x50> {
+            template<typename V> static constexpr V apply(const V A, const V, const V C) noexcept {
+                const V t0 = ~C & A;
+                return t0;
+            }
+        };
+        // code=0x51, function=(not ((not (A) and B)) and not (C)), lowered=((A notand B) notand not (C)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x51> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~A & B;
+                const V t1 = ~C;
+                const V t2 = ~t0 & t1;
+                return t2;
+            }
+        };
+        // code=0x52, function=(not ((B and C)) and (A xor C)), lowered=((B and C) notand (A xor C)), set=superopt_lat_xop
+        template<> struct ternary_kernel<0x52> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = B & C;
+                const V t1 = A ^ C;
+                const V t2 = ~t0 & t1;
+                return t2;
+            }
+        };
+        // code=0x53, function=((C or not (A)) xor (A or B)), lowered=((C or not (A)) xor (A or B)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x53> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~A;
+                const V t1 = C | t0;
+                const V t2 = A | B;
+                const V t3 = t1 ^ t2;
+                return t3;
+            }
+        };
+        // code=0x54, function=(not (C) and (A or B)), lowered=(C notand (A or B)), set=superopt_lat_xop
+        template<> struct ternary_kernel<0x54> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = A | B;
+                const V t1 = ~C & t0;
+                return t1;
+            }
+        };
+        // code=0x55, function=not (C), lowered=not (C), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x55> {
+            template<typename V> static constexpr V apply(const V, const V, const V C) noexcept {
+                const V t0 = ~C;
+                return t0;
+            }
+        };
+        // code=0x56, function=(C xor (A or B)), lowered=(C xor (A or B)), set=superopt_lat_xop
+        template<> struct ternary_kernel<0x56> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = A | B;
+                const V t1 = C ^ t0;
+                return t1;
+            }
+        };
+        // code=0x57, function=not ((C and (A or B))), lowered=not ((C and (A or B))), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x57> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = A | B;
+                const V t1 = C & t0;
+                const V t2 = ~t1;
+                return t2;
+            }
+        };
+        // code=0x58, function=((A xor C) and (A or B)), lowered=((A xor C) and (A or B)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x58> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = A ^ C;
+                const V t1 = A | B;
+                const V t2 = t0 & t1;
+                return t2;
+            }
+        };
+        // code=0x59, function=((not (A) and B) xor not (C)), lowered=((A notand B) xor not (C)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x59> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~A & B;
+                const V t1 = ~C;
+                const V t2 = t0 ^ t1;
+                return t2;
+            }
+        };
+        // code=0x5a, function=(A xor C), lowered=(A xor C), set=superopt_lat_xop
+        template<> struct ternary_kernel<0x5a> {
+            template<typename V> static constexpr V apply(const V A, const V, const V C) noexcept {
+                const V t0 = A ^ C;
+                return t0;
+            }
+        };
+        // code=0x5b, function=(not (A) xor (not (C) and (A or B))), lowered=(not (A) xor (C notand (A or B))), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x5b> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~A;
+                const V t1 = A | B;
+                const V t2 = ~C & t1;
+                const V t3 = t0 ^ t2;
+                return t3;
+            }
+        };
+        // code=0x5c, function=((A and C) xor (A or B)), lowered=((A and C) xor (A or B)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x5c> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = A & C;
+                const V t1 = A | B;
+                const V t2 = t0 ^ t1;
+                return t2;
+            }
+        };
+        // code=0x5d, function=((not (A) and B) or not (C)), lowered=((A notand B) or not (C)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x5d> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~A & B;
+                const V t1 = ~C;
+                const V t2 = t0 | t1;
+                return t2;
+            }
+        };
+        // code=0x5e, function=((not (A) and B) or (A xor C)), lowered=((A notand B) or (A xor C)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x5e> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~A & B;
+                const V t1 = A ^ C;
+                const V t2 = t0 | t1;
+                return t2;
+            }
+        };
+        // code=0x5f, function=not ((A and C)), lowered=not ((A and C)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x5f> {
+            template<typename V> static constexpr V apply(const V A, const V, const V C) noexcept {
+                const V t0 = A & C;
+                const V t1 = ~t0;
+                return t1;
+            }
+        };
+        // code=0x60, function=(A and (B xor C)), lowered=(A and (B xor C)), set=superopt_lat_xop
+        template<> struct ternary_kernel<0x60> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = B ^ C;
+                const V t1 = A & t0;
+                return t1;
+            }
+        };
+        // code=0x61, function=((not (A) or (B and C)) xor (B or C)), lowered=((not (A) or (B and C)) xor (B or C)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x61> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~A;
+                const V t1 = B & C;
+                const V t2 = t0 | t1;
+                const V t3 = B | C;
+                const V t4 = t2 ^ t3;
+                return t4;
+            }
+        };
+        // code=0x62, function=((B xor C) and (A or C)), lowered=((B xor C) and (A or C)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x62> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = B ^ C;
+                const V t1 = A | C;
+                const V t2 = t0 & t1;
+                return t2;
+            }
+        };
+        // code=0x63, function=(not (B) xor (not (C) and A)), lowered=(not (B) xor (C notand A)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x63> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~B;
+                const V t1 = ~C & A;
+                const V t2 = t0 ^ t1;
+                return t2;
+            }
+        };
+        // code=0x64, function=((B xor C) and (A or B)), lowered=((B xor C) and (A or B)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x64> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = B ^ C;
+                const V t1 = A | B;
+                const V t2 = t0 & t1;
+                return t2;
+            }
+        };
+        // code=0x65, function=((not (B) and A) xor not (C)), lowered=((B notand A) xor not (C)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x65> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~B & A;
+                const V t1 = ~C;
+                const V t2 = t0 ^ t1;
+                return t2;
+            }
+        };
+        // code=0x66, function=(B xor C), lowered=(B xor C), set=superopt_lat_xop
+        template<> struct ternary_kernel<0x66> {
+            template<typename V> static constexpr V apply(const V, const V B, const V C) noexcept {
+                const V t0 = B ^ C;
+                return t0;
+            }
+        };
+        // code=0x67, function=((not (B) and not (A)) or (B xor C)), lowered=((B notand not (A)) or (B xor C)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x67> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~A;
+                const V t1 = ~B & t0;
+                const V t2 = B ^ C;
+                const V t3 = t1 | t2;
+                return t3;
+            }
+        };
+        // code=0x68, function=((C and (A or B)) xor (A and B)), lowered=((C and (A or B)) xor (A and B)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x68> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = A | B;
+                const V t1 = C & t0;
+                const V t2 = A & B;
+                const V t3 = t1 ^ t2;
+                return t3;
+            }
+        };
+        // code=0x69, function=(not (A) xor (B xor C)), lowered=(not (A) xor (B xor C)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x69> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~A;
+                const V t1 = B ^ C;
+                const V t2 = t0 ^ t1;
+                return t2;
+            }
+        };
+        // code=0x6a, function=(C xor (A and B)), lowered=(C xor (A and B)), set=superopt_lat_xop
+        template<> struct ternary_kernel<0x6a> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = A & B;
+                const V t1 = C ^ t0;
+                return t1;
+            }
+        };
+        // code=0x6b, function=((not (B) and not (A)) or (C xor (A and B))), lowered=((B notand not (A)) or (C xor (A and B))), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x6b> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~A;
+                const V t1 = ~B & t0;
+                const V t2 = A & B;
+                const V t3 = C ^ t2;
+                const V t4 = t1 | t3;
+                return t4;
+            }
+        };
+        // code=0x6c, function=(B xor (A and C)), lowered=(B xor (A and C)), set=superopt_lat_xop
+        template<> struct ternary_kernel<0x6c> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = A & C;
+                const V t1 = B ^ t0;
+                return t1;
+            }
+        };
+        // code=0x6d, function=((not (C) and not (A)) or (B xor (A and C))), lowered=((C notand not (A)) or (B xor (A and C))), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x6d> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~A;
+                const V t1 = ~C & t0;
+                const V t2 = A & C;
+                const V t3 = B ^ t2;
+                const V t4 = t1 | t3;
+                return t4;
+            }
+        };
+        // code=0x6e, function=((not (A) and B) or (B xor C)), lowered=((A notand B) or (B xor C)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x6e> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~A & B;
+                const V t1 = B ^ C;
+                const V t2 = t0 | t1;
+                return t2;
+            }
+        };
+        // code=0x6f, function=(not (A) or (B xor C)), lowered=(not (A) or (B xor C)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x6f> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~A;
+                const V t1 = B ^ C;
+                const V t2 = t0 | t1;
+                return t2;
+            }
+        };
+        // code=0x70, function=(not ((B and C)) and A), lowered=((B and C) notand A), set=superopt_lat_xop
+        template<> struct ternary_kernel<0x70> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = B & C;
+                const V t1 = ~t0 & A;
+                return t1;
+            }
+        };
+        // code=0x71, function=((C or (A xor B)) xor (B or not (A))), lowered=((C or (A xor B)) xor (B or not (A))), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x71> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = A ^ B;
+                const V t1 = C | t0;
+                const V t2 = ~A;
+                const V t3 = B | t2;
+                const V t4 = t1 ^ t3;
+                return t4;
+            }
+        };
+        // code=0x72, function=((B and C) xor (A or C)), lowered=((B and C) xor (A or C)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x72> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = B & C;
+                const V t1 = A | C;
+                const V t2 = t0 ^ t1;
+                return t2;
+            }
+        };
+        // code=0x73, function=(not (B) or (not (C) and A)), lowered=(not (B) or (C notand A)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x73> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~B;
+                const V t1 = ~C & A;
+                const V t2 = t0 | t1;
+                return t2;
+            }
+        };
+        // code=0x74, function=((B and C) xor (A or B)), lowered=((B and C) xor (A or B)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x74> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = B & C;
+                const V t1 = A | B;
+                const V t2 = t0 ^ t1;
+                return t2;
+            }
+        };
+        // code=0x75, function=((not (B) and A) or not (C)), lowered=((B notand A) or not (C)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x75> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~B & A;
+                const V t1 = ~C;
+                const V t2 = t0 | t1;
+                return t2;
+            }
+        };
+        // code=0x76, function=((not (B) and A) or (B xor C)), lowered=((B notand A) or (B xor C)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x76> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~B & A;
+                const V t1 = B ^ C;
+                const V t2 = t0 | t1;
+                return t2;
+            }
+        };
+        // code=0x77, function=not ((B and C)), lowered=not ((B and C)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x77> {
+            template<typename V> static constexpr V apply(const V, const V B, const V C) noexcept {
+                const V t0 = B & C;
+                const V t1 = ~t0;
+                return t1;
+            }
+        };
+        // code=0x78, function=(A xor (B and C)), lowered=(A xor (B and C)), set=superopt_lat_xop
+        template<> struct ternary_kernel<0x78> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = B & C;
+                const V t1 = A ^ t0;
+                return t1;
+            }
+        };
+        // code=0x79, function=((not (B) and A) or (not (A) xor (B xor C))), lowered=((B notand A) or (not (A) xor (B xor C))), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x79> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~B & A;
+                const V t1 = ~A;
+                const V t2 = B ^ C;
+                const V t3 = t1 ^ t2;
+                const V t4 = t0 | t3;
+                return t4;
+            }
+        };
+        // code=0x7a, function=((not (B) and A) or (A xor C)), lowered=((B notand A) or (A xor C)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x7a> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~B & A;
+                const V t1 = A ^ C;
+                const V t2 = t0 | t1;
+                return t2;
+            }
+        };
+        // code=0x7b, function=(not (B) or (A xor C)), lowered=(not (B) or (A xor C)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x7b> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~B;
+                const V t1 = A ^ C;
+                const V t2 = t0 | t1;
+                return t2;
+            }
+        };
+        // code=0x7c, function=((A xor B) or (not (C) and A)), lowered=((A xor B) or (C notand A)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x7c> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = A ^ B;
+                const V t1 = ~C & A;
+                const V t2 = t0 | t1;
+                return t2;
+            }
+        };
+        // code=0x7d, function=((A xor B) or not (C)), lowered=((A xor B) or not (C)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x7d> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = A ^ B;
+                const V t1 = ~C;
+                const V t2 = t0 | t1;
+                return t2;
+            }
+        };
+        // code=0x7e, function=((A xor B) or (A xor C)), lowered=((A xor B) or (A xor C)), set=superopt_lat_xop
+        template<> struct ternary_kernel<0x7e> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = A ^ B;
+                const V t1 = A ^ C;
+                const V t2 = t0 | t1;
+                return t2;
+            }
+        };
+        // code=0x7f, function=not ((C and (A and B))), lowered=not ((C and (A and B))), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x7f> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = A & B;
+                const V t1 = C & t0;
+                const V t2 = ~t1;
+                return t2;
+            }
+        };
+        // code=0x80, function=(C and (A and B)), lowered=(C and (A and B)), set=superopt_lat_xop
+        template<> struct ternary_kernel<0x80> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = A & B;
+                const V t1 = C & t0;
+                return t1;
+            }
+        };
+        // code=0x81, function=(not ((A xor B)) and (C xor not (A))), lowered=((A xor B) notand (C xor not (A))), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x81> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = A ^ B;
+                const V t1 = ~A;
+                const V t2 = C ^ t1;
+                const V t3 = ~t0 & t2;
+                return t3;
+            }
+        };
+        // code=0x82, function=(not ((A xor B)) and C), lowered=((A xor B) notand C), set=superopt_lat_xop
+        template<> struct ternary_kernel<0x82> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = A ^ B;
+                const V t1 = ~t0 & C;
+                return t1;
+            }
+        };
+        // code=0x83, function=(not ((A xor B)) and (C or not (A))), lowered=((A xor B) notand (C or not (A))), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x83> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = A ^ B;
+                const V t1 = ~A;
+                const V t2 = C | t1;
+                const V t3 = ~t0 & t2;
+                return t3;
+            }
+        };
+        // code=0x84, function=(not ((A xor C)) and B), lowered=((A xor C) notand B), set=superopt_lat_xop
+        template<> struct ternary_kernel<0x84> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = A ^ C;
+                const V t1 = ~t0 & B;
+                return t1;
+            }
+        };
+        // code=0x85, function=(not ((A xor C)) and (B or not (A))), lowered=((A xor C) notand (B or not (A))), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x85> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = A ^ C;
+                const V t1 = ~A;
+                const V t2 = B | t1;
+                const V t3 = ~t0 & t2;
+                return t3;
+            }
+        };
+        // code=0x86, function=(not ((A xor (B and C))) and (B or C)), lowered=((A xor (B and C)) notand (B or C)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x86> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = B & C;
+                const V t1 = A ^ t0;
+                const V t2 = B | C;
+                const V t3 = ~t1 & t2;
+                return t3;
+            }
+        };
+        // code=0x87, function=(not (A) xor (B and C)), lowered=(not (A) xor (B and C)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x87> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~A;
+                const V t1 = B & C;
+                const V t2 = t0 ^ t1;
+                return t2;
+            }
+        };
+        // code=0x88, function=(B and C), lowered=(B and C), set=superopt_lat_xop
+        template<> struct ternary_kernel<0x88> {
+            template<typename V> static constexpr V apply(const V, const V B, const V C) noexcept {
+                const V t0 = B & C;
+                return t0;
+            }
+        };
+        // code=0x89, function=(not ((B xor C)) and (B or not (A))), lowered=((B xor C) notand (B or not (A))), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x89> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = B ^ C;
+                const V t1 = ~A;
+                const V t2 = B | t1;
+                const V t3 = ~t0 & t2;
+                return t3;
+            }
+        };
+        // code=0x8a, function=(not ((not (B) and A)) and C), lowered=((B notand A) notand C), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x8a> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~B & A;
+                const V t1 = ~t0 & C;
+                return t1;
+            }
+        };
+        // code=0x8b, function=((not (B) and not (A)) or (B and C)), lowered=((B notand not (A)) or (B and C)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x8b> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~A;
+                const V t1 = ~B & t0;
+                const V t2 = B & C;
+                const V t3 = t1 | t2;
+                return t3;
+            }
+        };
+        // code=0x8c, function=(not ((not (C) and A)) and B), lowered=((C notand A) notand B), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x8c> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~C & A;
+                const V t1 = ~t0 & B;
+                return t1;
+            }
+        };
+        // code=0x8d, function=((not (C) and not (A)) or (B and C)), lowered=((C notand not (A)) or (B and C)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x8d> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~A;
+                const V t1 = ~C & t0;
+                const V t2 = B & C;
+                const V t3 = t1 | t2;
+                return t3;
+            }
+        };
+        // code=0x8e, function=((A xor B) ? B : C), lowered=(((A xor B) and B) or ((A xor B) notand C)), set=superopt_lat_xop
+        template<> struct ternary_kernel<0x8e> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = A ^ B;
+                const V t1 = t0 & B;
+                const V t2 = ~t0 & C;
+                const V t3 = t1 | t2;
+                return t3;
+            }
+        };
+        // code=0x8f, function=(not (A) or (B and C)), lowered=(not (A) or (B and C)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x8f> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~A;
+                const V t1 = B & C;
+                const V t2 = t0 | t1;
+                return t2;
+            }
+        };
+        // code=0x90, function=(not ((B xor C)) and A), lowered=((B xor C) notand A), set=superopt_lat_xop
+        template<> struct ternary_kernel<0x90> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = B ^ C;
+                const V t1 = ~t0 & A;
+                return t1;
+            }
+        };
+        // code=0x91, function=(not ((B xor C)) and (A or not (B))), lowered=((B xor C) notand (A or not (B))), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x91> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = B ^ C;
+                const V t1 = ~B;
+                const V t2 = A | t1;
+                const V t3 = ~t0 & t2;
+                return t3;
+            }
+        };
+        // code=0x92, function=(not ((B xor (A and C))) and (A or C)), lowered=((B xor (A and C)) notand (A or C)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x92> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = A & C;
+                const V t1 = B ^ t0;
+                const V t2 = A | C;
+                const V t3 = ~t1 & t2;
+                return t3;
+            }
+        };
+        // code=0x93, function=(not (B) xor (A and C)), lowered=(not (B) xor (A and C)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x93> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~B;
+                const V t1 = A & C;
+                const V t2 = t0 ^ t1;
+                return t2;
+            }
+        };
+        // code=0x94, function=(not ((C xor (A and B))) and (A or B)), lowered=((C xor (A and B)) notand (A or B)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x94> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = A & B;
+                const V t1 = C ^ t0;
+                const V t2 = A | B;
+                const V t3 = ~t1 & t2;
+                return t3;
+            }
+        };
+        // code=0x95, function=(not (C) xor (A and B)), lowered=(not (C) xor (A and B)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x95> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~C;
+                const V t1 = A & B;
+                const V t2 = t0 ^ t1;
+                return t2;
+            }
+        };
+        // code=0x96, function=(C xor (A xor B)), lowered=(C xor (A xor B)), set=superopt_lat_xop
+        template<> struct ternary_kernel<0x96> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = A ^ B;
+                const V t1 = C ^ t0;
+                return t1;
+            }
+        };
+        // code=0x97, function=(not (A) xor (not ((B xor C)) and (A or B))), lowered=(not (A) xor ((B xor C) notand (A or B))), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x97> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~A;
+                const V t1 = B ^ C;
+                const V t2 = A | B;
+                const V t3 = ~t1 & t2;
+                const V t4 = t0 ^ t3;
+                return t4;
+            }
+        };
+        // code=0x98, function=(not ((B xor C)) and (A or B)), lowered=((B xor C) notand (A or B)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x98> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = B ^ C;
+                const V t1 = A | B;
+                const V t2 = ~t0 & t1;
+                return t2;
+            }
+        };
+        // code=0x99, function=(C xor not (B)), lowered=(C xor not (B)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x99> {
+            template<typename V> static constexpr V apply(const V, const V B, const V C) noexcept {
+                const V t0 = ~B;
+                const V t1 = C ^ t0;
+                return t1;
+            }
+        };
+        // code=0x9a, function=(C xor (not (B) and A)), lowered=(C xor (B notand A)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x9a> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~B & A;
+                const V t1 = C ^ t0;
+                return t1;
+            }
+        };
+        // code=0x9b, function=(not (B) xor (C and (A or B))), lowered=(not (B) xor (C and (A or B))), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x9b> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~B;
+                const V t1 = A | B;
+                const V t2 = C & t1;
+                const V t3 = t0 ^ t2;
+                return t3;
+            }
+        };
+        // code=0x9c, function=(B xor (not (C) and A)), lowered=(B xor (C notand A)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x9c> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~C & A;
+                const V t1 = B ^ t0;
+                return t1;
+            }
+        };
+        // code=0x9d, function=((not (A) and B) or (C xor not (B))), lowered=((A notand B) or (C xor not (B))), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x9d> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~A & B;
+                const V t1 = ~B;
+                const V t2 = C ^ t1;
+                const V t3 = t0 | t2;
+                return t3;
+            }
+        };
+        // code=0x9e, function=((B xor C) xor (A or (B and C))), lowered=((B xor C) xor (A or (B and C))), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x9e> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = B ^ C;
+                const V t1 = B & C;
+                const V t2 = A | t1;
+                const V t3 = t0 ^ t2;
+                return t3;
+            }
+        };
+        // code=0x9f, function=not ((A and (B xor C))), lowered=not ((A and (B xor C))), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0x9f> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = B ^ C;
+                const V t1 = A & t0;
+                const V t2 = ~t1;
+                return t2;
+            }
+        };
+        // code=0xa0, function=(A and C), lowered=(A and C), set=superopt_lat_xop
+        template<> struct ternary_kernel<0xa0> {
+            template<typename V> static constexpr V apply(const V A, const V, const V C) noexcept {
+                const V t0 = A & C;
+                return t0;
+            }
+        };
+        // code=0xa1, function=(not ((B and not (A))) and (C xor not (A))), lowered=((A notand B) notand (C xor not (A))), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0xa1> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~A & B;
+                const V t1 = ~A;
+                const V t2 = C ^ t1;
+                const V t3 = ~t0 & t2;
+                return t3;
+            }
+        };
+        // code=0xa2, function=(not ((not (A) and B)) and C), lowered=((A notand B) notand C), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0xa2> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~A & B;
+                const V t1 = ~t0 & C;
+                return t1;
+            }
+        };
+        // code=0xa3, function=((not (B) and not (A)) or (A and C)), lowered=((B notand not (A)) or (A and C)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0xa3> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~A;
+                const V t1 = ~B & t0;
+                const V t2 = A & C;
+                const V t3 = t1 | t2;
+                return t3;
+            }
+        };
+        // code=0xa4, function=(not ((A xor C)) and (A or B)), lowered=((A xor C) notand (A or B)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0xa4> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = A ^ C;
+                const V t1 = A | B;
+                const V t2 = ~t0 & t1;
+                return t2;
+            }
+        };
+        // code=0xa5, function=(C xor not (A)), lowered=(C xor not (A)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0xa5> {
+            template<typename V> static constexpr V apply(const V A, const V, const V C) noexcept {
+                const V t0 = ~A;
+                const V t1 = C ^ t0;
+                return t1;
+            }
+        };
+        // code=0xa6, function=(C xor (not (A) and B)), lowered=(C xor (A notand B)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0xa6> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~A & B;
+                const V t1 = C ^ t0;
+                return t1;
+            }
+        };
+        // code=0xa7, function=(not (A) xor (C and (A or B))), lowered=(not (A) xor (C and (A or B))), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0xa7> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~A;
+                const V t1 = A | B;
+                const V t2 = C & t1;
+                const V t3 = t0 ^ t2;
+                return t3;
+            }
+        };
+        // code=0xa8, function=(C and (A or B)), lowered=(C and (A or B)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0xa8> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = A | B;
+                const V t1 = C & t0;
+                return t1;
+            }
+        };
+        // code=0xa9, function=(not (C) xor (A or B)), lowered=(not (C) xor (A or B)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0xa9> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~C;
+                const V t1 = A | B;
+                const V t2 = t0 ^ t1;
+                return t2;
+            }
+        };
+        // code=0xaa, function=C, lowered=C, set=superopt_lat_xop
+        template<> struct ternary_kernel<0xaa> {
+            template<typename V> static constexpr V apply(const V, const V, const V C) noexcept {
+                return C;
+            }
+        };
+        // code=0xab, function=(C or (not (B) and not (A))), lowered=(C or (B notand not (A))), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0xab> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~A;
+                const V t1 = ~B & t0;
+                const V t2 = C | t1;
+                return t2;
+            }
+        };
+        // code=0xac, function=(A ? C : B), lowered=((A and C) or (A notand B)), set=superopt_lat_xop
+        template<> struct ternary_kernel<0xac> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = A & C;
+                const V t1 = ~A & B;
+                const V t2 = t0 | t1;
+                return t2;
+            }
+        };
+        // code=0xad, function=((B and C) or (C xor not (A))), lowered=((B and C) or (C xor not (A))), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0xad> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = B & C;
+                const V t1 = ~A;
+                const V t2 = C ^ t1;
+                const V t3 = t0 | t2;
+                return t3;
+            }
+        };
+        // code=0xae, function=(C or (not (A) and B)), lowered=(C or (A notand B)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0xae> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~A & B;
+                const V t1 = C | t0;
+                return t1;
+            }
+        };
+        // code=0xaf, function=(C or not (A)), lowered=(C or not (A)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0xaf> {
+            template<typename V> static constexpr V apply(const V A, const V, const V C) noexcept {
+                const V t0 = ~A;
+                const V t1 = C | t0;
+                return t1;
+            }
+        };
+        // code=0xb0, function=(not ((not (C) and B)) and A), lowered=((C notand B) notand A), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0xb0> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~C & B;
+                const V t1 = ~t0 & A;
+                return t1;
+            }
+        };
+        // code=0xb1, function=(not (A) xor (C or (A xor B))), lowered=(not (A) xor (C or (A xor B))), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0xb1> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~A;
+                const V t1 = A ^ B;
+                const V t2 = C | t1;
+                const V t3 = t0 ^ t2;
+                return t3;
+            }
+        };
+        // code=0xb2, function=((A xor B) ? A : C), lowered=(((A xor B) and A) or ((A xor B) notand C)), set=superopt_lat_xop
+        template<> struct ternary_kernel<0xb2> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = A ^ B;
+                const V t1 = t0 & A;
+                const V t2 = ~t0 & C;
+                const V t3 = t1 | t2;
+                return t3;
+            }
+        };
+        // code=0xb3, function=(not (B) or (A and C)), lowered=(not (B) or (A and C)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0xb3> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~B;
+                const V t1 = A & C;
+                const V t2 = t0 | t1;
+                return t2;
+            }
+        };
+        // code=0xb4, function=(A xor (not (C) and B)), lowered=(A xor (C notand B)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0xb4> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~C & B;
+                const V t1 = A ^ t0;
+                return t1;
+            }
+        };
+        // code=0xb5, function=((not (B) and A) or (C xor not (A))), lowered=((B notand A) or (C xor not (A))), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0xb5> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~B & A;
+                const V t1 = ~A;
+                const V t2 = C ^ t1;
+                const V t3 = t0 | t2;
+                return t3;
+            }
+        };
+        // code=0xb6, function=((B xor (A or C)) or (A and C)), lowered=((B xor (A or C)) or (A and C)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0xb6> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = A | C;
+                const V t1 = B ^ t0;
+                const V t2 = A & C;
+                const V t3 = t1 | t2;
+                return t3;
+            }
+        };
+        // code=0xb7, function=not ((B and (A xor C))), lowered=not ((B and (A xor C))), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0xb7> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = A ^ C;
+                const V t1 = B & t0;
+                const V t2 = ~t1;
+                return t2;
+            }
+        };
+        // code=0xb8, function=(B ? C : A), lowered=((B and C) or (B notand A)), set=superopt_lat_xop
+        template<> struct ternary_kernel<0xb8> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = B & C;
+                const V t1 = ~B & A;
+                const V t2 = t0 | t1;
+                return t2;
+            }
+        };
+        // code=0xb9, function=((C xor not (B)) or (A and C)), lowered=((C xor not (B)) or (A and C)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0xb9> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~B;
+                const V t1 = C ^ t0;
+                const V t2 = A & C;
+                const V t3 = t1 | t2;
+                return t3;
+            }
+        };
+        // code=0xba, function=(C or (not (B) and A)), lowered=(C or (B notand A)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0xba> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~B & A;
+                const V t1 = C | t0;
+                return t1;
+            }
+        };
+        // code=0xbb, function=(C or not (B)), lowered=(C or not (B)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0xbb> {
+            template<typename V> static constexpr V apply(const V, const V B, const V C) noexcept {
+                const V t0 = ~B;
+                const V t1 = C | t0;
+                return t1;
+            }
+        };
+        // code=0xbc, function=((A xor B) or (A and C)), lowered=((A xor B) or (A and C)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0xbc> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = A ^ B;
+                const V t1 = A & C;
+                const V t2 = t0 | t1;
+                return t2;
+            }
+        };
+        // code=0xbd, function=((A xor B) or (C xor not (A))), lowered=((A xor B) or (C xor not (A))), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0xbd> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = A ^ B;
+                const V t1 = ~A;
+                const V t2 = C ^ t1;
+                const V t3 = t0 | t2;
+                return t3;
+            }
+        };
+        // code=0xbe, function=(C or (A xor B)), lowered=(C or (A xor B)), set=superopt_lat_xop
+        template<> struct ternary_kernel<0xbe> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = A ^ B;
+                const V t1 = C | t0;
+                return t1;
+            }
+        };
+        // code=0xbf, function=(C or not ((A and B))), lowered=(C or not ((A and B))), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0xbf> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = A & B;
+                const V t1 = ~t0;
+                const V t2 = C | t1;
+                return t2;
+            }
+        };
+        // code=0xc0, function=(A and B), lowered=(A and B), set=superopt_lat_xop
+        template<> struct ternary_kernel<0xc0> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V) noexcept {
+                const V t0 = A & B;
+                return t0;
+            }
+        };
+        // code=0xc1, function=(not ((C and not (A))) and (B xor not (A))), lowered=((A notand C) notand (B xor not (A))), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0xc1> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~A & C;
+                const V t1 = ~A;
+                const V t2 = B ^ t1;
+                const V t3 = ~t0 & t2;
+                return t3;
+            }
+        };
+        // code=0xc2, function=(not ((A xor B)) and (A or C)), lowered=((A xor B) notand (A or C)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0xc2> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = A ^ B;
+                const V t1 = A | C;
+                const V t2 = ~t0 & t1;
+                return t2;
+            }
+        };
+        // code=0xc3, function=(B xor not (A)), lowered=(B xor not (A)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0xc3> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V) noexcept {
+                const V t0 = ~A;
+                const V t1 = B ^ t0;
+                return t1;
+            }
+        };
+        // code=0xc4, function=(not ((not (A) and C)) and B), lowered=((A notand C) notand B), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0xc4> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~A & C;
+                const V t1 = ~t0 & B;
+                return t1;
+            }
+        };
+        // code=0xc5, function=((not (C) and not (A)) or (A and B)), lowered=((C notand not (A)) or (A and B)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0xc5> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~A;
+                const V t1 = ~C & t0;
+                const V t2 = A & B;
+                const V t3 = t1 | t2;
+                return t3;
+            }
+        };
+        // code=0xc6, function=(B xor (not (A) and C)), lowered=(B xor (A notand C)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0xc6> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~A & C;
+                const V t1 = B ^ t0;
+                return t1;
+            }
+        };
+        // code=0xc7, function=(not (A) xor (B and (A or C))), lowered=(not (A) xor (B and (A or C))), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0xc7> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~A;
+                const V t1 = A | C;
+                const V t2 = B & t1;
+                const V t3 = t0 ^ t2;
+                return t3;
+            }
+        };
+        // code=0xc8, function=(B and (A or C)), lowered=(B and (A or C)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0xc8> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = A | C;
+                const V t1 = B & t0;
+                return t1;
+            }
+        };
+        // code=0xc9, function=(not (B) xor (A or C)), lowered=(not (B) xor (A or C)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0xc9> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~B;
+                const V t1 = A | C;
+                const V t2 = t0 ^ t1;
+                return t2;
+            }
+        };
+        // code=0xca, function=(A ? B : C), lowered=((A and B) or (A notand C)), set=superopt_lat_xop
+        template<> struct ternary_kernel<0xca> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = A & B;
+                const V t1 = ~A & C;
+                const V t2 = t0 | t1;
+                return t2;
+            }
+        };
+        // code=0xcb, function=((B and C) or (B xor not (A))), lowered=((B and C) or (B xor not (A))), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0xcb> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = B & C;
+                const V t1 = ~A;
+                const V t2 = B ^ t1;
+                const V t3 = t0 | t2;
+                return t3;
+            }
+        };
+        // code=0xcc, function=B, lowered=B, set=superopt_lat_xop
+        template<> struct ternary_kernel<0xcc> {
+            template<typename V> static constexpr V apply(const V, const V B, const V) noexcept {
+                return B;
+            }
+        };
+        // code=0xcd, function=(B or (not (C) and not (A))), lowered=(B or (C notand not (A))), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0xcd> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~A;
+                const V t1 = ~C & t0;
+                const V t2 = B | t1;
+                return t2;
+            }
+        };
+        // code=0xce, function=(B or (not (A) and C)), lowered=(B or (A notand C)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0xce> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~A & C;
+                const V t1 = B | t0;
+                return t1;
+            }
+        };
+        // code=0xcf, function=(B or not (A)), lowered=(B or not (A)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0xcf> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V) noexcept {
+                const V t0 = ~A;
+                const V t1 = B | t0;
+                return t1;
+            }
+        };
+        // code=0xd0, function=(not ((not (B) and C)) and A), lowered=((B notand C) notand A), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0xd0> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~B & C;
+                const V t1 = ~t0 & A;
+                return t1;
+            }
+        };
+        // code=0xd1, function=(not (A) xor (B or (A xor C))), lowered=(not (A) xor (B or (A xor C))), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0xd1> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~A;
+                const V t1 = A ^ C;
+                const V t2 = B | t1;
+                const V t3 = t0 ^ t2;
+                return t3;
+            }
+        };
+        // code=0xd2, function=(A xor (not (B) and C)), lowered=(A xor (B notand C)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0xd2> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~B & C;
+                const V t1 = A ^ t0;
+                return t1;
+            }
+        };
+        // code=0xd3, function=((not (C) and A) or (B xor not (A))), lowered=((C notand A) or (B xor not (A))), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0xd3> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~C & A;
+                const V t1 = ~A;
+                const V t2 = B ^ t1;
+                const V t3 = t0 | t2;
+                return t3;
+            }
+        };
+        // code=0xd4, function=((A xor C) ? A : B), lowered=(((A xor C) and A) or ((A xor C) notand B)), set=superopt_lat_xop
+        template<> struct ternary_kernel<0xd4> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = A ^ C;
+                const V t1 = t0 & A;
+                const V t2 = ~t0 & B;
+                const V t3 = t1 | t2;
+                return t3;
+            }
+        };
+        // code=0xd5, function=(not (C) or (A and B)), lowered=(not (C) or (A and B)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0xd5> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~C;
+                const V t1 = A & B;
+                const V t2 = t0 | t1;
+                return t2;
+            }
+        };
+        // code=0xd6, function=((C xor (A or B)) or (A and B)), lowered=((C xor (A or B)) or (A and B)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0xd6> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = A | B;
+                const V t1 = C ^ t0;
+                const V t2 = A & B;
+                const V t3 = t1 | t2;
+                return t3;
+            }
+        };
+        // code=0xd7, function=not ((C and (A xor B))), lowered=not ((C and (A xor B))), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0xd7> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = A ^ B;
+                const V t1 = C & t0;
+                const V t2 = ~t1;
+                return t2;
+            }
+        };
+        // code=0xd8, function=(C ? B : A), lowered=((C and B) or (C notand A)), set=superopt_lat_xop
+        template<> struct ternary_kernel<0xd8> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = C & B;
+                const V t1 = ~C & A;
+                const V t2 = t0 | t1;
+                return t2;
+            }
+        };
+        // code=0xd9, function=(not (B) xor (C or (A and B))), lowered=(not (B) xor (C or (A and B))), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0xd9> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~B;
+                const V t1 = A & B;
+                const V t2 = C | t1;
+                const V t3 = t0 ^ t2;
+                return t3;
+            }
+        };
+        // code=0xda, function=((A xor C) or (A and B)), lowered=((A xor C) or (A and B)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0xda> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = A ^ C;
+                const V t1 = A & B;
+                const V t2 = t0 | t1;
+                return t2;
+            }
+        };
+        // code=0xdb, function=((A xor C) or (B xor not (A))), lowered=((A xor C) or (B xor not (A))), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0xdb> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = A ^ C;
+                const V t1 = ~A;
+                const V t2 = B ^ t1;
+                const V t3 = t0 | t2;
+                return t3;
+            }
+        };
+        // code=0xdc, function=(B or (not (C) and A)), lowered=(B or (C notand A)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0xdc> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~C & A;
+                const V t1 = B | t0;
+                return t1;
+            }
+        };
+        // code=0xdd, function=(B or not (C)), lowered=(B or not (C)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0xdd> {
+            template<typename V> static constexpr V apply(const V, const V B, const V C) noexcept {
+                const V t0 = ~C;
+                const V t1 = B | t0;
+                return t1;
+            }
+        };
+        // code=0xde, function=(B or (A xor C)), lowered=(B or (A xor C)), set=superopt_lat_xop
+        template<> struct ternary_kernel<0xde> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = A ^ C;
+                const V t1 = B | t0;
+                return t1;
+            }
+        };
+        // code=0xdf, function=(B or not ((A and C))), lowered=(B or not ((A and C))), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0xdf> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = A & C;
+                const V t1 = ~t0;
+                const V t2 = B | t1;
+                return t2;
+            }
+        };
+        // code=0xe0, function=(A and (B or C)), lowered=(A and (B or C)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0xe0> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = B | C;
+                const V t1 = A & t0;
+                return t1;
+            }
+        };
+        // code=0xe1, function=(not (A) xor (B or C)), lowered=(not (A) xor (B or C)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0xe1> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~A;
+                const V t1 = B | C;
+                const V t2 = t0 ^ t1;
+                return t2;
+            }
+        };
+        // code=0xe2, function=(B ? A : C), lowered=((B and A) or (B notand C)), set=superopt_lat_xop
+        template<> struct ternary_kernel<0xe2> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = B & A;
+                const V t1 = ~B & C;
+                const V t2 = t0 | t1;
+                return t2;
+            }
+        };
+        // code=0xe3, function=(not (A) xor (B or (A and C))), lowered=(not (A) xor (B or (A and C))), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0xe3> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~A;
+                const V t1 = A & C;
+                const V t2 = B | t1;
+                const V t3 = t0 ^ t2;
+                return t3;
+            }
+        };
+        // code=0xe4, function=(C ? A : B), lowered=((C and A) or (C notand B)), set=superopt_lat_xop
+        template<> struct ternary_kernel<0xe4> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = C & A;
+                const V t1 = ~C & B;
+                const V t2 = t0 | t1;
+                return t2;
+            }
+        };
+        // code=0xe5, function=(not (A) xor (C or (A and B))), lowered=(not (A) xor (C or (A and B))), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0xe5> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~A;
+                const V t1 = A & B;
+                const V t2 = C | t1;
+                const V t3 = t0 ^ t2;
+                return t3;
+            }
+        };
+        // code=0xe6, function=((B xor C) or (A and B)), lowered=((B xor C) or (A and B)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0xe6> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = B ^ C;
+                const V t1 = A & B;
+                const V t2 = t0 | t1;
+                return t2;
+            }
+        };
+        // code=0xe7, function=((B xor C) or (B xor not (A))), lowered=((B xor C) or (B xor not (A))), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0xe7> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = B ^ C;
+                const V t1 = ~A;
+                const V t2 = B ^ t1;
+                const V t3 = t0 | t2;
+                return t3;
+            }
+        };
+        // code=0xe8, function=((A xor B) ? C : A), lowered=(((A xor B) and C) or ((A xor B) notand A)), set=superopt_lat_xop
+        template<> struct ternary_kernel<0xe8> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = A ^ B;
+                const V t1 = t0 & C;
+                const V t2 = ~t0 & A;
+                const V t3 = t1 | t2;
+                return t3;
+            }
+        };
+        // code=0xe9, function=((not (B) and not (A)) xor (C or (A and B))), lowered=((B notand not (A)) xor (C or (A and B))), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0xe9> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~A;
+                const V t1 = ~B & t0;
+                const V t2 = A & B;
+                const V t3 = C | t2;
+                const V t4 = t1 ^ t3;
+                return t4;
+            }
+        };
+        // code=0xea, function=(C or (A and B)), lowered=(C or (A and B)), set=superopt_lat_xop
+        template<> struct ternary_kernel<0xea> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = A & B;
+                const V t1 = C | t0;
+                return t1;
+            }
+        };
+        // code=0xeb, function=(C or (B xor not (A))), lowered=(C or (B xor not (A))), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0xeb> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~A;
+                const V t1 = B ^ t0;
+                const V t2 = C | t1;
+                return t2;
+            }
+        };
+        // code=0xec, function=(B or (A and C)), lowered=(B or (A and C)), set=superopt_lat_xop
+        template<> struct ternary_kernel<0xec> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = A & C;
+                const V t1 = B | t0;
+                return t1;
+            }
+        };
+        // code=0xed, function=(B or (C xor not (A))), lowered=(B or (C xor not (A))), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0xed> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~A;
+                const V t1 = C ^ t0;
+                const V t2 = B | t1;
+                return t2;
+            }
+        };
+        // code=0xee, function=(B or C), lowered=(B or C), set=superopt_lat_xop
+        template<> struct ternary_kernel<0xee> {
+            template<typename V> static constexpr V apply(const V, const V B, const V C) noexcept {
+                const V t0 = B | C;
+                return t0;
+            }
+        };
+        // code=0xef, function=(not (A) or (B or C)), lowered=(not (A) or (B or C)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0xef> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~A;
+                const V t1 = B | C;
+                const V t2 = t0 | t1;
+                return t2;
+            }
+        };
+        // code=0xf0, function=A, lowered=A, set=superopt_lat_xop
+        template<> struct ternary_kernel<0xf0> {
+            template<typename V> static constexpr V apply(const V A, const V, const V) noexcept {
+                return A;
+            }
+        };
+        // code=0xf1, function=(A or (not (C) and not (B))), lowered=(A or (C notand not (B))), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0xf1> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~B;
+                const V t1 = ~C & t0;
+                const V t2 = A | t1;
+                return t2;
+            }
+        };
+        // code=0xf2, function=(A or (not (B) and C)), lowered=(A or (B notand C)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0xf2> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~B & C;
+                const V t1 = A | t0;
+                return t1;
+            }
+        };
+        // code=0xf3, function=(A or not (B)), lowered=(A or not (B)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0xf3> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V) noexcept {
+                const V t0 = ~B;
+                const V t1 = A | t0;
+                return t1;
+            }
+        };
+        // code=0xf4, function=(A or (not (C) and B)), lowered=(A or (C notand B)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0xf4> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~C & B;
+                const V t1 = A | t0;
+                return t1;
+            }
+        };
+        // code=0xf5, function=(A or not (C)), lowered=(A or not (C)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0xf5> {
+            template<typename V> static constexpr V apply(const V A, const V, const V C) noexcept {
+                const V t0 = ~C;
+                const V t1 = A | t0;
+                return t1;
+            }
+        };
+        // code=0xf6, function=(A or (B xor C)), lowered=(A or (B xor C)), set=superopt_lat_xop
+        template<> struct ternary_kernel<0xf6> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = B ^ C;
+                const V t1 = A | t0;
+                return t1;
+            }
+        };
+        // code=0xf7, function=(A or not ((B and C))), lowered=(A or not ((B and C))), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0xf7> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = B & C;
+                const V t1 = ~t0;
+                const V t2 = A | t1;
+                return t2;
+            }
+        };
+        // code=0xf8, function=(A or (B and C)), lowered=(A or (B and C)), set=superopt_lat_xop
+        template<> struct ternary_kernel<0xf8> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = B & C;
+                const V t1 = A | t0;
+                return t1;
+            }
+        };
+        // code=0xf9, function=(A or (C xor not (B))), lowered=(A or (C xor not (B))), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0xf9> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~B;
+                const V t1 = C ^ t0;
+                const V t2 = A | t1;
+                return t2;
+            }
+        };
+        // code=0xfa, function=(A or C), lowered=(A or C), set=superopt_lat_xop
+        template<> struct ternary_kernel<0xfa> {
+            template<typename V> static constexpr V apply(const V A, const V, const V C) noexcept {
+                const V t0 = A | C;
+                return t0;
+            }
+        };
+        // code=0xfb, function=(not (B) or (A or C)), lowered=(not (B) or (A or C)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0xfb> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~B;
+                const V t1 = A | C;
+                const V t2 = t0 | t1;
+                return t2;
+            }
+        };
+        // code=0xfc, function=(A or B), lowered=(A or B), set=superopt_lat_xop
+        template<> struct ternary_kernel<0xfc> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V) noexcept {
+                const V t0 = A | B;
+                return t0;
+            }
+        };
+        // code=0xfd, function=(not (C) or (A or B)), lowered=(not (C) or (A or B)), set=superopt_lat_bmi
+        template<> struct ternary_kernel<0xfd> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = ~C;
+                const V t1 = A | B;
+                const V t2 = t0 | t1;
+                return t2;
+            }
+        };
+        // code=0xfe, function=(C or (A or B)), lowered=(C or (A or B)), set=superopt_lat_xop
+        template<> struct ternary_kernel<0xfe> {
+            template<typename V> static constexpr V apply(const V A, const V B, const V C) noexcept {
+                const V t0 = A | B;
+                const V t1 = C | t0;
+                return t1;
+            }
+        };
+        // code=0xff, function=1, lowered=1, set=superopt_lat_xop
+        template<> struct ternary_kernel<0xff> {
+            template<typename V> static constexpr V apply(const V, const V, const V) noexcept {
+                const V c1 = ~V{};
+                return c1;
+            }
+        };
+
+        // ternary_lat_kernel<k> is ternary_kernel<k>, unless a kernel with a shorter dependency chain exists
+        template<unsigned k> struct ternary_lat_kernel : ternary_kernel<k> {};
+
+        template<unsigned k, typename V> constexpr V ternary(const V A, const V B, const V C) noexcept {
+            return ternary_kernel<k>::apply(A, B, C);
+        }
+
+        template<unsigned k, typename V> constexpr V ternary_lat(const V A, const V B, const V C) noexcept {
+            return ternary_lat_kernel<k>::apply(A, B, C);
+        }
+
+    } // namespace vext
+
+} // namespace ternarylogic
+
+// eof
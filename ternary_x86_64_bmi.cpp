@@ -0,0 +1,5087 @@
+// Generated automatically, please do not edit
+#pragma once
+#include <cstdint>
+#include "ternary_compat.h"
+
+namespace ternarylogic {
+
+    namespace x86_64_bmi {
+
+        // for cores with BMI1: ~a & b is a single andn (compile with -mbmi, or /arch:AVX2 with MSVC)
+
+        template<unsigned k> __forceinline constexpr uint64_t ternary(const uint64_t, const uint64_t, const uint64_t) noexcept {
+            static_assert(k < 256, "Unspecified ternary function");
+            return 0;
+        }
+
+        // code=0x00, function=0, lowered=0, set=superopt_lat_xop
+        template<> __forceinline constexpr uint64_t ternary<0x00>(const uint64_t, const uint64_t, const uint64_t) noexcept {
+            const uint64_t c0 = 0;
+            return c0;
+        }
+        // code=0x01, function=(not ((B or C)) and not (A)), lowered=((B or C) notand not (A)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x01>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = B | C;
+            const uint64_t t1 = ~A;
+            const uint64_t t2 = ~t0 & t1;
+            return t2;
+        }
+        // code=0x02, function=(not ((A or B)) and C), lowered=((A or B) notand C), set=superopt_lat_xop
+        template<> __forceinline constexpr uint64_t ternary<0x02>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = A | B;
+            const uint64_t t1 = ~t0 & C;
+            return t1;
+        }
+        // code=0x03, function=(not (B) and not (A)), lowered=(B notand not (A)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x03>(const uint64_t A, const uint64_t B, const uint64_t) noexcept {
+            const uint64_t t0 = ~A;
+            const uint64_t t1 = ~B & t0;
+            return t1;
+        }
+        // code=0x04, function=(not ((A or C)) and B), lowered=((A or C) notand B), set=superopt_lat_xop
+        template<> __forceinline constexpr uint64_t ternary<0x04>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = A | C;
+            const uint64_t t1 = ~t0 & B;
+            return t1;
+        }
+        // code=0x05, function=(not (C) and not (A)), lowered=(C notand not (A)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x05>(const uint64_t A, const uint64_t, const uint64_t C) noexcept {
+            const uint64_t t0 = ~A;
+            const uint64_t t1 = ~C & t0;
+            return t1;
+        }
+        // code=0x06, function=(not (A) and (B xor C)), lowered=(A notand (B xor C)), set=superopt_lat_xop
+        template<> __forceinline constexpr uint64_t ternary<0x06>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = B ^ C;
+            const uint64_t t1 = ~A & t0;
+            return t1;
+        }
+        // code=0x07, function=(not ((B and C)) and not (A)), lowered=((B and C) notand not (A)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x07>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = B & C;
+            const uint64_t t1 = ~A;
+            const uint64_t t2 = ~t0 & t1;
+            return t2;
+        }
+        // code=0x08, function=(not (A) and (B and C)), lowered=(A notand (B and C)), set=superopt_lat_xop
+        template<> __forceinline constexpr uint64_t ternary<0x08>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = B & C;
+            const uint64_t t1 = ~A & t0;
+            return t1;
+        }
+        // code=0x09, function=(not ((B xor C)) and not (A)), lowered=((B xor C) notand not (A)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x09>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = B ^ C;
+            const uint64_t t1 = ~A;
+            const uint64_t t2 = ~t0 & t1;
+            return t2;
+        }
+        // code=0x0a, function=(not (A) and C), lowered=(A notand C), set=superopt_lat_xop
+        template<> __forceinline constexpr uint64_t ternary<0x0a>(const uint64_t A, const uint64_t, const uint64_t C) noexcept {
+            const uint64_t t0 = ~A & C;
+            return t0;
+        }
+        // code=0x0b, function=(not ((not (C) and B)) and not (A)), lowered=((C notand B) notand not (A)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x0b>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~C & B;
+            const uint64_t t1 = ~A;
+            const uint64_t t2 = ~t0 & t1;
+            return t2;
+        }
+        // code=0x0c, function=(not (A) and B), lowered=(A notand B), set=superopt_lat_xop
+        template<> __forceinline constexpr uint64_t ternary<0x0c>(const uint64_t A, const uint64_t B, const uint64_t) noexcept {
+            const uint64_t t0 = ~A & B;
+            return t0;
+        }
+        // code=0x0d, function=(not ((not (B) and C)) and not (A)), lowered=((B notand C) notand not (A)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x0d>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~B & C;
+            const uint64_t t1 = ~A;
+            const uint64_t t2 = ~t0 & t1;
+            return t2;
+        }
+        // code=0x0e, function=(not (A) and (B or C)), lowered=(A notand (B or C)), set=superopt_lat_xop
+        template<> __forceinline constexpr uint64_t ternary<0x0e>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = B | C;
+            const uint64_t t1 = ~A & t0;
+            return t1;
+        }
+        // code=0x0f, function=not (A), lowered=not (A), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x0f>(const uint64_t A, const uint64_t, const uint64_t) noexcept {
+            const uint64_t t0 = ~A;
+            return t0;
+        }
+        // code=0x10, function=(not ((B or C)) and A), lowered=((B or C) notand A), set=superopt_lat_xop
+        template<> __forceinline constexpr uint64_t ternary<0x10>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = B | C;
+            const uint64_t t1 = ~t0 & A;
+            return t1;
+        }
+        // code=0x11, function=(not (C) and not (B)), lowered=(C notand not (B)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x11>(const uint64_t, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~B;
+            const uint64_t t1 = ~C & t0;
+            return t1;
+        }
+        // code=0x12, function=(not (B) and (A xor C)), lowered=(B notand (A xor C)), set=superopt_lat_xop
+        template<> __forceinline constexpr uint64_t ternary<0x12>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = A ^ C;
+            const uint64_t t1 = ~B & t0;
+            return t1;
+        }
+        // code=0x13, function=(not ((A and C)) and not (B)), lowered=((A and C) notand not (B)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x13>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = A & C;
+            const uint64_t t1 = ~B;
+            const uint64_t t2 = ~t0 & t1;
+            return t2;
+        }
+        // code=0x14, function=(not (C) and (A xor B)), lowered=(C notand (A xor B)), set=superopt_lat_xop
+        template<> __forceinline constexpr uint64_t ternary<0x14>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = A ^ B;
+            const uint64_t t1 = ~C & t0;
+            return t1;
+        }
+        // code=0x15, function=(not ((A and B)) and not (C)), lowered=((A and B) notand not (C)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x15>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = A & B;
+            const uint64_t t1 = ~C;
+            const uint64_t t2 = ~t0 & t1;
+            return t2;
+        }
+        // code=0x16, function=((C or (A and B)) xor (A or B)), lowered=((C or (A and B)) xor (A or B)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x16>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = A & B;
+            const uint64_t t1 = C | t0;
+            const uint64_t t2 = A | B;
+            const uint64_t t3 = t1 ^ t2;
+            return t3;
+        }
+        // code=0x17, function=((C and (A xor B)) xor (not (A) or (A xor B))), lowered=((C and (A xor B)) xor (not (A) or (A xor B))), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x17>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = A ^ B;
+            const uint64_t t1 = C & t0;
+            const uint64_t t2 = ~A;
+            const uint64_t t3 = t2 | t0;
+            const uint64_t t4 = t1 ^ t3;
+            return t4;
+        }
+        // code=0x18, function=((A xor B) and (A xor C)), lowered=((A xor B) and (A xor C)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x18>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = A ^ B;
+            const uint64_t t1 = A ^ C;
+            const uint64_t t2 = t0 & t1;
+            return t2;
+        }
+        // code=0x19, function=(not ((A and B)) and (C xor not (B))), lowered=((A and B) notand (C xor not (B))), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x19>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = A & B;
+            const uint64_t t1 = ~B;
+            const uint64_t t2 = C ^ t1;
+            const uint64_t t3 = ~t0 & t2;
+            return t3;
+        }
+        // code=0x1a, function=(not ((A and B)) and (A xor C)), lowered=((A and B) notand (A xor C)), set=superopt_lat_xop
+        template<> __forceinline constexpr uint64_t ternary<0x1a>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = A & B;
+            const uint64_t t1 = A ^ C;
+            const uint64_t t2 = ~t0 & t1;
+            return t2;
+        }
+        // code=0x1b, function=(not (A) xor (not (C) and (A xor B))), lowered=(not (A) xor (C notand (A xor B))), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x1b>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~A;
+            const uint64_t t1 = A ^ B;
+            const uint64_t t2 = ~C & t1;
+            const uint64_t t3 = t0 ^ t2;
+            return t3;
+        }
+        // code=0x1c, function=(not ((A and C)) and (A xor B)), lowered=((A and C) notand (A xor B)), set=superopt_lat_xop
+        template<> __forceinline constexpr uint64_t ternary<0x1c>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = A & C;
+            const uint64_t t1 = A ^ B;
+            const uint64_t t2 = ~t0 & t1;
+            return t2;
+        }
+        // code=0x1d, function=(not (A) xor (not (B) and (A xor C))), lowered=(not (A) xor (B notand (A xor C))), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x1d>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~A;
+            const uint64_t t1 = A ^ C;
+            const uint64_t t2 = ~B & t1;
+            const uint64_t t3 = t0 ^ t2;
+            return t3;
+        }
+        // code=0x1e, function=(A xor (B or C)), lowered=(A xor (B or C)), set=superopt_lat_xop
+        template<> __forceinline constexpr uint64_t ternary<0x1e>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = B | C;
+            const uint64_t t1 = A ^ t0;
+            return t1;
+        }
+        // code=0x1f, function=not ((A and (B or C))), lowered=not ((A and (B or C))), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x1f>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = B | C;
+            const uint64_t t1 = A & t0;
+            const uint64_t t2 = ~t1;
+            return t2;
+        }
+        // code=0x20, function=(not (B) and (A and C)), lowered=(B notand (A and C)), set=superopt_lat_xop
+        template<> __forceinline constexpr uint64_t ternary<0x20>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = A & C;
+            const uint64_t t1 = ~B & t0;
+            return t1;
+        }
+        // code=0x21, function=(not ((A xor C)) and not (B)), lowered=((A xor C) notand not (B)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x21>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = A ^ C;
+            const uint64_t t1 = ~B;
+            const uint64_t t2 = ~t0 & t1;
+            return t2;
+        }
+        // code=0x22, function=(not (B) and C), lowered=(B notand C), set=superopt_lat_xop
+        template<> __forceinline constexpr uint64_t ternary<0x22>(const uint64_t, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~B & C;
+            return t0;
+        }
+        // code=0x23, function=(not ((not (C) and A)) and not (B)), lowered=((C notand A) notand not (B)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x23>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~C & A;
+            const uint64_t t1 = ~B;
+            const uint64_t t2 = ~t0 & t1;
+            return t2;
+        }
+        // code=0x24, function=(not ((A xor C)) and (A xor B)), lowered=((A xor C) notand (A xor B)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x24>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = A ^ C;
+            const uint64_t t1 = A ^ B;
+            const uint64_t t2 = ~t0 & t1;
+            return t2;
+        }
+        // code=0x25, function=(not ((A and B)) and (C xor not (A))), lowered=((A and B) notand (C xor not (A))), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x25>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = A & B;
+            const uint64_t t1 = ~A;
+            const uint64_t t2 = C ^ t1;
+            const uint64_t t3 = ~t0 & t2;
+            return t3;
+        }
+        // code=0x26, function=(not ((A and B)) and (B xor C)), lowered=((A and B) notand (B xor C)), set=superopt_lat_xop
+        template<> __forceinline constexpr uint64_t ternary<0x26>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = A & B;
+            const uint64_t t1 = B ^ C;
+            const uint64_t t2 = ~t0 & t1;
+            return t2;
+        }
+        // code=0x27, function=((B and C) xor (C or not (A))), lowered=((B and C) xor (C or not (A))), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x27>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = B & C;
+            const uint64_t t1 = ~A;
+            const uint64_t t2 = C | t1;
+            const uint64_t t3 = t0 ^ t2;
+            return t3;
+        }
+        // code=0x28, function=(C and (A xor B)), lowered=(C and (A xor B)), set=superopt_lat_xop
+        template<> __forceinline constexpr uint64_t ternary<0x28>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = A ^ B;
+            const uint64_t t1 = C & t0;
+            return t1;
+        }
+        // code=0x29, function=((B xor not (A)) xor (C or (A and B))), lowered=((B xor not (A)) xor (C or (A and B))), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x29>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~A;
+            const uint64_t t1 = B ^ t0;
+            const uint64_t t2 = A & B;
+            const uint64_t t3 = C | t2;
+            const uint64_t t4 = t1 ^ t3;
+            return t4;
+        }
+        // code=0x2a, function=(not ((A and B)) and C), lowered=((A and B) notand C), set=superopt_lat_xop
+        template<> __forceinline constexpr uint64_t ternary<0x2a>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = A & B;
+            const uint64_t t1 = ~t0 & C;
+            return t1;
+        }
+        // code=0x2b, function=((not (B) and not (A)) or (not ((A and B)) and C)), lowered=((B notand not (A)) or ((A and B) notand C)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x2b>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~A;
+            const uint64_t t1 = ~B & t0;
+            const uint64_t t2 = A & B;
+            const uint64_t t3 = ~t2 & C;
+            const uint64_t t4 = t1 | t3;
+            return t4;
+        }
+        // code=0x2c, function=((A xor B) and (B or C)), lowered=((A xor B) and (B or C)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x2c>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = A ^ B;
+            const uint64_t t1 = B | C;
+            const uint64_t t2 = t0 & t1;
+            return t2;
+        }
+        // code=0x2d, function=(not (A) xor (not (B) and C)), lowered=(not (A) xor (B notand C)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x2d>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~A;
+            const uint64_t t1 = ~B & C;
+            const uint64_t t2 = t0 ^ t1;
+            return t2;
+        }
+        // code=0x2e, function=((A and B) xor (B or C)), lowered=((A and B) xor (B or C)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x2e>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = A & B;
+            const uint64_t t1 = B | C;
+            const uint64_t t2 = t0 ^ t1;
+            return t2;
+        }
+        // code=0x2f, function=(not (A) or (not (B) and C)), lowered=(not (A) or (B notand C)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x2f>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~A;
+            const uint64_t t1 = ~B & C;
+            const uint64_t t2 = t0 | t1;
+            return t2;
+        }
+        // code=0x30, function=(not (B) and A), lowered=(B notand A), set=superopt_lat_xop
+        template<> __forceinline constexpr uint64_t ternary<0x30>(const uint64_t A, const uint64_t B, const uint64_t) noexcept {
+            const uint64_t t0 = ~B & A;
+            return t0;
+        }
+        // code=0x31, function=(not ((not (A) and C)) and not (B)), lowered=((A notand C) notand not (B)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x31>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~A & C;
+            const uint64_t t1 = ~B;
+            const uint64_t t2 = ~t0 & t1;
+            return t2;
+        }
+        // code=0x32, function=(not (B) and (A or C)), lowered=(B notand (A or C)), set=superopt_lat_xop
+        template<> __forceinline constexpr uint64_t ternary<0x32>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = A | C;
+            const uint64_t t1 = ~B & t0;
+            return t1;
+        }
+        // code=0x33, function=not (B), lowered=not (B), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x33>(const uint64_t, const uint64_t B, const uint64_t) noexcept {
+            const uint64_t t0 = ~B;
+            return t0;
+        }
+        // code=0x34, function=(not ((B and C)) and (A xor B)), lowered=((B and C) notand (A xor B)), set=superopt_lat_xop
+        template<> __forceinline constexpr uint64_t ternary<0x34>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = B & C;
+            const uint64_t t1 = A ^ B;
+            const uint64_t t2 = ~t0 & t1;
+            return t2;
+        }
+        // code=0x35, function=((B or not (A)) xor (A or C)), lowered=((B or not (A)) xor (A or C)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x35>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~A;
+            const uint64_t t1 = B | t0;
+            const uint64_t t2 = A | C;
+            const uint64_t t3 = t1 ^ t2;
+            return t3;
+        }
+        // code=0x36, function=(B xor (A or C)), lowered=(B xor (A or C)), set=superopt_lat_xop
+        template<> __forceinline constexpr uint64_t ternary<0x36>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = A | C;
+            const uint64_t t1 = B ^ t0;
+            return t1;
+        }
+        // code=0x37, function=not ((B and (A or C))), lowered=not ((B and (A or C))), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x37>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = A | C;
+            const uint64_t t1 = B & t0;
+            const uint64_t t2 = ~t1;
+            return t2;
+        }
+        // code=0x38, function=((A xor B) and (A or C)), lowered=((A xor B) and (A or C)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x38>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = A ^ B;
+            const uint64_t t1 = A | C;
+            const uint64_t t2 = t0 & t1;
+            return t2;
+        }
+        // code=0x39, function=((not (A) and C) xor not (B)), lowered=((A notand C) xor not (B)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x39>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~A & C;
+            const uint64_t t1 = ~B;
+            const uint64_t t2 = t0 ^ t1;
+            return t2;
+        }
+        // code=0x3a, function=((A and B) xor (A or C)), lowered=((A and B) xor (A or C)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x3a>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = A & B;
+            const uint64_t t1 = A | C;
+            const uint64_t t2 = t0 ^ t1;
+            return t2;
+        }
+        // code=0x3b, function=((not (A) and C) or not (B)), lowered=((A notand C) or not (B)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x3b>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~A & C;
+            const uint64_t t1 = ~B;
+            const uint64_t t2 = t0 | t1;
+            return t2;
+        }
+        // code=0x3c, function=(A xor B), lowered=(A xor B), set=superopt_lat_xop
+        template<> __forceinline constexpr uint64_t ternary<0x3c>(const uint64_t A, const uint64_t B, const uint64_t) noexcept {
+            const uint64_t t0 = A ^ B;
+            return t0;
+        }
+        // code=0x3d, function=(not (A) xor (not (B) and (A or C))), lowered=(not (A) xor (B notand (A or C))), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x3d>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~A;
+            const uint64_t t1 = A | C;
+            const uint64_t t2 = ~B & t1;
+            const uint64_t t3 = t0 ^ t2;
+            return t3;
+        }
+        // code=0x3e, function=((not (A) and C) or (A xor B)), lowered=((A notand C) or (A xor B)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x3e>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~A & C;
+            const uint64_t t1 = A ^ B;
+            const uint64_t t2 = t0 | t1;
+            return t2;
+        }
+        // code=0x3f, function=not ((A and B)), lowered=not ((A and B)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x3f>(const uint64_t A, const uint64_t B, const uint64_t) noexcept {
+            const uint64_t t0 = A & B;
+            const uint64_t t1 = ~t0;
+            return t1;
+        }
+        // code=0x40, function=(not (C) and (A and B)), lowered=(C notand (A and B)), set=superopt_lat_xop
+        template<> __forceinline constexpr uint64_t ternary<0x40>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = A & B;
+            const uint64_t t1 = ~C & t0;
+            return t1;
+        }
+        // code=0x41, function=(not ((A xor B)) and not (C)), lowered=((A xor B) notand not (C)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x41>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = A ^ B;
+            const uint64_t t1 = ~C;
+            const uint64_t t2 = ~t0 & t1;
+            return t2;
+        }
+        // code=0x42, function=(not ((A xor B)) and (A xor C)), lowered=((A xor B) notand (A xor C)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x42>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = A ^ B;
+            const uint64_t t1 = A ^ C;
+            const uint64_t t2 = ~t0 & t1;
+            return t2;
+        }
+        // code=0x43, function=(not ((A and C)) and (B xor not (A))), lowered=((A and C) notand (B xor not (A))), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x43>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = A & C;
+            const uint64_t t1 = ~A;
+            const uint64_t t2 = B ^ t1;
+            const uint64_t t3 = ~t0 & t2;
+            return t3;
+        }
+        // code=0x44, function=(not (C) and B), lowered=(C notand B), set=superopt_lat_xop
+        template<> __forceinline constexpr uint64_t ternary<0x44>(const uint64_t, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~C & B;
+            return t0;
+        }
+        // code=0x45, function=(not ((not (B) and A)) and not (C)), lowered=((B notand A) notand not (C)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x45>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~B & A;
+            const uint64_t t1 = ~C;
+            const uint64_t t2 = ~t0 & t1;
+            return t2;
+        }
+        // code=0x46, function=(not ((A and C)) and (B xor C)), lowered=((A and C) notand (B xor C)), set=superopt_lat_xop
+        template<> __forceinline constexpr uint64_t ternary<0x46>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = A & C;
+            const uint64_t t1 = B ^ C;
+            const uint64_t t2 = ~t0 & t1;
+            return t2;
+        }
+        // code=0x47, function=((B and C) xor (B or not (A))), lowered=((B and C) xor (B or not (A))), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x47>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = B & C;
+            const uint64_t t1 = ~A;
+            const uint64_t t2 = B | t1;
+            const uint64_t t3 = t0 ^ t2;
+            return t3;
+        }
+        // code=0x48, function=(B and (A xor C)), lowered=(B and (A xor C)), set=superopt_lat_xop
+        template<> __forceinline constexpr uint64_t ternary<0x48>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = A ^ C;
+            const uint64_t t1 = B & t0;
+            return t1;
+        }
+        // code=0x49, function=((C xor not (A)) xor (B or (A and C))), lowered=((C xor not (A)) xor (B or (A and C))), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x49>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~A;
+            const uint64_t t1 = C ^ t0;
+            const uint64_t t2 = A & C;
+            const uint64_t t3 = B | t2;
+            const uint64_t t4 = t1 ^ t3;
+            return t4;
+        }
+        // code=0x4a, function=((A xor C) and (B or C)), lowered=((A xor C) and (B or C)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x4a>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = A ^ C;
+            const uint64_t t1 = B | C;
+            const uint64_t t2 = t0 & t1;
+            return t2;
+        }
+        // code=0x4b, function=(not (A) xor (not (C) and B)), lowered=(not (A) xor (C notand B)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x4b>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~A;
+            const uint64_t t1 = ~C & B;
+            const uint64_t t2 = t0 ^ t1;
+            return t2;
+        }
+        // code=0x4c, function=(not ((A and C)) and B), lowered=((A and C) notand B), set=superopt_lat_xop
+        template<> __forceinline constexpr uint64_t ternary<0x4c>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = A & C;
+            const uint64_t t1 = ~t0 & B;
+            return t1;
+        }
+        // code=0x4d, function=((not (C) and not (A)) or (not ((A and C)) and B)), lowered=((C notand not (A)) or ((A and C) notand B)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x4d>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~A;
+            const uint64_t t1 = ~C & t0;
+            const uint64_t t2 = A & C;
+            const uint64_t t3 = ~t2 & B;
+            const uint64_t t4 = t1 | t3;
+            return t4;
+        }
+        // code=0x4e, function=((A and C) xor (B or C)), lowered=((A and C) xor (B or C)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x4e>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = A & C;
+            const uint64_t t1 = B | C;
+            const uint64_t t2 = t0 ^ t1;
+            return t2;
+        }
+        // code=0x4f, function=(not (A) or (not (C) and B)), lowered=(not (A) or (C notand B)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x4f>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~A;
+            const uint64_t t1 = ~C & B;
+            const uint64_t t2 = t0 | t1;
+            return t2;
+        }
+        // code=0x50, function=(not (C) and A), lowered=(C notand A), set=superopt_lat_xop
+        template<> __forceinline constexpr uint64_t ternary<0x50>(const uint64_t A, const uint64_t, const uint64_t C) noexcept {
+            const uint64_t t0 = ~C & A;
+            return t0;
+        }
+        // code=0x51, function=(not ((not (A) and B)) and not (C)), lowered=((A notand B) notand not (C)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x51>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~A & B;
+            const uint64_t t1 = ~C;
+            const uint64_t t2 = ~t0 & t1;
+            return t2;
+        }
+        // code=0x52, function=(not ((B and C)) and (A xor C)), lowered=((B and C) notand (A xor C)), set=superopt_lat_xop
+        template<> __forceinline constexpr uint64_t ternary<0x52>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = B & C;
+            const uint64_t t1 = A ^ C;
+            const uint64_t t2 = ~t0 & t1;
+            return t2;
+        }
+        // code=0x53, function=((C or not (A)) xor (A or B)), lowered=((C or not (A)) xor (A or B)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x53>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~A;
+            const uint64_t t1 = C | t0;
+            const uint64_t t2 = A | B;
+            const uint64_t t3 = t1 ^ t2;
+            return t3;
+        }
+        // code=0x54, function=(not (C) and (A or B)), lowered=(C notand (A or B)), set=superopt_lat_xop
+        template<> __forceinline constexpr uint64_t ternary<0x54>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = A | B;
+            const uint64_t t1 = ~C & t0;
+            return t1;
+        }
+        // code=0x55, function=not (C), lowered=not (C), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x55>(const uint64_t, const uint64_t, const uint64_t C) noexcept {
+            const uint64_t t0 = ~C;
+            return t0;
+        }
+        // code=0x56, function=(C xor (A or B)), lowered=(C xor (A or B)), set=superopt_lat_xop
+        template<> __forceinline constexpr uint64_t ternary<0x56>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = A | B;
+            const uint64_t t1 = C ^ t0;
+            return t1;
+        }
+        // code=0x57, function=not ((C and (A or B))), lowered=not ((C and (A or B))), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x57>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = A | B;
+            const uint64_t t1 = C & t0;
+            const uint64_t t2 = ~t1;
+            return t2;
+        }
+        // code=0x58, function=((A xor C) and (A or B)), lowered=((A xor C) and (A or B)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x58>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = A ^ C;
+            const uint64_t t1 = A | B;
+            const uint64_t t2 = t0 & t1;
+            return t2;
+        }
+        // code=0x59, function=((not (A) and B) xor not (C)), lowered=((A notand B) xor not (C)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x59>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~A & B;
+            const uint64_t t1 = ~C;
+            const uint64_t t2 = t0 ^ t1;
+            return t2;
+        }
+        // code=0x5a, function=(A xor C), lowered=(A xor C), set=superopt_lat_xop
+        template<> __forceinline constexpr uint64_t ternary<0x5a>(const uint64_t A, const uint64_t, const uint64_t C) noexcept {
+            const uint64_t t0 = A ^ C;
+            return t0;
+        }
+        // code=0x5b, function=(not (A) xor (not (C) and (A or B))), lowered=(not (A) xor (C notand (A or B))), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x5b>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~A;
+            const uint64_t t1 = A | B;
+            const uint64_t t2 = ~C & t1;
+            const uint64_t t3 = t0 ^ t2;
+            return t3;
+        }
+        // code=0x5c, function=((A and C) xor (A or B)), lowered=((A and C) xor (A or B)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x5c>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = A & C;
+            const uint64_t t1 = A | B;
+            const uint64_t t2 = t0 ^ t1;
+            return t2;
+        }
+        // code=0x5d, function=((not (A) and B) or not (C)), lowered=((A notand B) or not (C)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x5d>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~A & B;
+            const uint64_t t1 = ~C;
+            const uint64_t t2 = t0 | t1;
+            return t2;
+        }
+        // code=0x5e, function=((not (A) and B) or (A xor C)), lowered=((A notand B) or (A xor C)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x5e>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~A & B;
+            const uint64_t t1 = A ^ C;
+            const uint64_t t2 = t0 | t1;
+            return t2;
+        }
+        // code=0x5f, function=not ((A and C)), lowered=not ((A and C)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x5f>(const uint64_t A, const uint64_t, const uint64_t C) noexcept {
+            const uint64_t t0 = A & C;
+            const uint64_t t1 = ~t0;
+            return t1;
+        }
+        // code=0x60, function=(A and (B xor C)), lowered=(A and (B xor C)), set=superopt_lat_xop
+        template<> __forceinline constexpr uint64_t ternary<0x60>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = B ^ C;
+            const uint64_t t1 = A & t0;
+            return t1;
+        }
+        // code=0x61, function=((not (A) or (B and C)) xor (B or C)), lowered=((not (A) or (B and C)) xor (B or C)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x61>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~A;
+            const uint64_t t1 = B & C;
+            const uint64_t t2 = t0 | t1;
+            const uint64_t t3 = B | C;
+            const uint64_t t4 = t2 ^ t3;
+            return t4;
+        }
+        // code=0x62, function=((B xor C) and (A or C)), lowered=((B xor C) and (A or C)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x62>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = B ^ C;
+            const uint64_t t1 = A | C;
+            const uint64_t t2 = t0 & t1;
+            return t2;
+        }
+        // code=0x63, function=(not (B) xor (not (C) and A)), lowered=(not (B) xor (C notand A)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x63>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~B;
+            const uint64_t t1 = ~C & A;
+            const uint64_t t2 = t0 ^ t1;
+            return t2;
+        }
+        // code=0x64, function=((B xor C) and (A or B)), lowered=((B xor C) and (A or B)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x64>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = B ^ C;
+            const uint64_t t1 = A | B;
+            const uint64_t t2 = t0 & t1;
+            return t2;
+        }
+        // code=0x65, function=((not (B) and A) xor not (C)), lowered=((B notand A) xor not (C)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x65>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~B & A;
+            const uint64_t t1 = ~C;
+            const uint64_t t2 = t0 ^ t1;
+            return t2;
+        }
+        // code=0x66, function=(B xor C), lowered=(B xor C), set=superopt_lat_xop
+        template<> __forceinline constexpr uint64_t ternary<0x66>(const uint64_t, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = B ^ C;
+            return t0;
+        }
+        // code=0x67, function=((not (B) and not (A)) or (B xor C)), lowered=((B notand not (A)) or (B xor C)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x67>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~A;
+            const uint64_t t1 = ~B & t0;
+            const uint64_t t2 = B ^ C;
+            const uint64_t t3 = t1 | t2;
+            return t3;
+        }
+        // code=0x68, function=((C and (A or B)) xor (A and B)), lowered=((C and (A or B)) xor (A and B)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x68>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = A | B;
+            const uint64_t t1 = C & t0;
+            const uint64_t t2 = A & B;
+            const uint64_t t3 = t1 ^ t2;
+            return t3;
+        }
+        // code=0x69, function=(not (A) xor (B xor C)), lowered=(not (A) xor (B xor C)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x69>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~A;
+            const uint64_t t1 = B ^ C;
+            const uint64_t t2 = t0 ^ t1;
+            return t2;
+        }
+        // code=0x6a, function=(C xor (A and B)), lowered=(C xor (A and B)), set=superopt_lat_xop
+        template<> __forceinline constexpr uint64_t ternary<0x6a>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = A & B;
+            const uint64_t t1 = C ^ t0;
+            return t1;
+        }
+        // code=0x6b, function=((not (B) and not (A)) or (C xor (A and B))), lowered=((B notand not (A)) or (C xor (A and B))), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x6b>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~A;
+            const uint64_t t1 = ~B & t0;
+            const uint64_t t2 = A & B;
+            const uint64_t t3 = C ^ t2;
+            const uint64_t t4 = t1 | t3;
+            return t4;
+        }
+        // code=0x6c, function=(B xor (A and C)), lowered=(B xor (A and C)), set=superopt_lat_xop
+        template<> __forceinline constexpr uint64_t ternary<0x6c>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = A & C;
+            const uint64_t t1 = B ^ t0;
+            return t1;
+        }
+        // code=0x6d, function=((not (C) and not (A)) or (B xor (A and C))), lowered=((C notand not (A)) or (B xor (A and C))), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x6d>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~A;
+            const uint64_t t1 = ~C & t0;
+            const uint64_t t2 = A & C;
+            const uint64_t t3 = B ^ t2;
+            const uint64_t t4 = t1 | t3;
+            return t4;
+        }
+        // code=0x6e, function=((not (A) and B) or (B xor C)), lowered=((A notand B) or (B xor C)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x6e>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~A & B;
+            const uint64_t t1 = B ^ C;
+            const uint64_t t2 = t0 | t1;
+            return t2;
+        }
+        // code=0x6f, function=(not (A) or (B xor C)), lowered=(not (A) or (B xor C)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x6f>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~A;
+            const uint64_t t1 = B ^ C;
+            const uint64_t t2 = t0 | t1;
+            return t2;
+        }
+        // code=0x70, function=(not ((B and C)) and A), lowered=((B and C) notand A), set=superopt_lat_xop
+        template<> __forceinline constexpr uint64_t ternary<0x70>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = B & C;
+            const uint64_t t1 = ~t0 & A;
+            return t1;
+        }
+        // code=0x71, function=((C or (A xor B)) xor (B or not (A))), lowered=((C or (A xor B)) xor (B or not (A))), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x71>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = A ^ B;
+            const uint64_t t1 = C | t0;
+            const uint64_t t2 = ~A;
+            const uint64_t t3 = B | t2;
+            const uint64_t t4 = t1 ^ t3;
+            return t4;
+        }
+        // code=0x72, function=((B and C) xor (A or C)), lowered=((B and C) xor (A or C)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x72>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = B & C;
+            const uint64_t t1 = A | C;
+            const uint64_t t2 = t0 ^ t1;
+            return t2;
+        }
+        // code=0x73, function=(not (B) or (not (C) and A)), lowered=(not (B) or (C notand A)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x73>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~B;
+            const uint64_t t1 = ~C & A;
+            const uint64_t t2 = t0 | t1;
+            return t2;
+        }
+        // code=0x74, function=((B and C) xor (A or B)), lowered=((B and C) xor (A or B)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x74>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = B & C;
+            const uint64_t t1 = A | B;
+            const uint64_t t2 = t0 ^ t1;
+            return t2;
+        }
+        // code=0x75, function=((not (B) and A) or not (C)), lowered=((B notand A) or not (C)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x75>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~B & A;
+            const uint64_t t1 = ~C;
+            const uint64_t t2 = t0 | t1;
+            return t2;
+        }
+        // code=0x76, function=((not (B) and A) or (B xor C)), lowered=((B notand A) or (B xor C)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x76>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~B & A;
+            const uint64_t t1 = B ^ C;
+            const uint64_t t2 = t0 | t1;
+            return t2;
+        }
+        // code=0x77, function=not ((B and C)), lowered=not ((B and C)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x77>(const uint64_t, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = B & C;
+            const uint64_t t1 = ~t0;
+            return t1;
+        }
+        // code=0x78, function=(A xor (B and C)), lowered=(A xor (B and C)), set=superopt_lat_xop
+        template<> __forceinline constexpr uint64_t ternary<0x78>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = B & C;
+            const uint64_t t1 = A ^ t0;
+            return t1;
+        }
+        // code=0x79, function=((not (B) and A) or (not (A) xor (B xor C))), lowered=((B notand A) or (not (A) xor (B xor C))), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x79>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~B & A;
+            const uint64_t t1 = ~A;
+            const uint64_t t2 = B ^ C;
+            const uint64_t t3 = t1 ^ t2;
+            const uint64_t t4 = t0 | t3;
+            return t4;
+        }
+        // code=0x7a, function=((not (B) and A) or (A xor C)), lowered=((B notand A) or (A xor C)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x7a>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~B & A;
+            const uint64_t t1 = A ^ C;
+            const uint64_t t2 = t0 | t1;
+            return t2;
+        }
+        // code=0x7b, function=(not (B) or (A xor C)), lowered=(not (B) or (A xor C)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x7b>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~B;
+            const uint64_t t1 = A ^ C;
+            const uint64_t t2 = t0 | t1;
+            return t2;
+        }
+        // code=0x7c, function=((A xor B) or (not (C) and A)), lowered=((A xor B) or (C notand A)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x7c>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = A ^ B;
+            const uint64_t t1 = ~C & A;
+            const uint64_t t2 = t0 | t1;
+            return t2;
+        }
+        // code=0x7d, function=((A xor B) or not (C)), lowered=((A xor B) or not (C)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x7d>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = A ^ B;
+            const uint64_t t1 = ~C;
+            const uint64_t t2 = t0 | t1;
+            return t2;
+        }
+        // code=0x7e, function=((A xor B) or (A xor C)), lowered=((A xor B) or (A xor C)), set=superopt_lat_xop
+        template<> __forceinline constexpr uint64_t ternary<0x7e>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = A ^ B;
+            const uint64_t t1 = A ^ C;
+            const uint64_t t2 = t0 | t1;
+            return t2;
+        }
+        // code=0x7f, function=not ((C and (A and B))), lowered=not ((C and (A and B))), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x7f>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = A & B;
+            const uint64_t t1 = C & t0;
+            const uint64_t t2 = ~t1;
+            return t2;
+        }
+        // code=0x80, function=(C and (A and B)), lowered=(C and (A and B)), set=superopt_lat_xop
+        template<> __forceinline constexpr uint64_t ternary<0x80>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = A & B;
+            const uint64_t t1 = C & t0;
+            return t1;
+        }
+        // code=0x81, function=(not ((A xor B)) and (C xor not (A))), lowered=((A xor B) notand (C xor not (A))), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x81>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = A ^ B;
+            const uint64_t t1 = ~A;
+            const uint64_t t2 = C ^ t1;
+            const uint64_t t3 = ~t0 & t2;
+            return t3;
+        }
+        // code=0x82, function=(not ((A xor B)) and C), lowered=((A xor B) notand C), set=superopt_lat_xop
+        template<> __forceinline constexpr uint64_t ternary<0x82>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = A ^ B;
+            const uint64_t t1 = ~t0 & C;
+            return t1;
+        }
+        // code=0x83, function=(not ((A xor B)) and (C or not (A))), lowered=((A xor B) notand (C or not (A))), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x83>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = A ^ B;
+            const uint64_t t1 = ~A;
+            const uint64_t t2 = C | t1;
+            const uint64_t t3 = ~t0 & t2;
+            return t3;
+        }
+        // code=0x84, function=(not ((A xor C)) and B), lowered=((A xor C) notand B), set=superopt_lat_xop
+        template<> __forceinline constexpr uint64_t ternary<0x84>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = A ^ C;
+            const uint64_t t1 = ~t0 & B;
+            return t1;
+        }
+        // code=0x85, function=(not ((A xor C)) and (B or not (A))), lowered=((A xor C) notand (B or not (A))), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x85>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = A ^ C;
+            const uint64_t t1 = ~A;
+            const uint64_t t2 = B | t1;
+            const uint64_t t3 = ~t0 & t2;
+            return t3;
+        }
+        // code=0x86, function=(not ((A xor (B and C))) and (B or C)), lowered=((A xor (B and C)) notand (B or C)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x86>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = B & C;
+            const uint64_t t1 = A ^ t0;
+            const uint64_t t2 = B | C;
+            const uint64_t t3 = ~t1 & t2;
+            return t3;
+        }
+        // code=0x87, function=(not (A) xor (B and C)), lowered=(not (A) xor (B and C)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x87>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~A;
+            const uint64_t t1 = B & C;
+            const uint64_t t2 = t0 ^ t1;
+            return t2;
+        }
+        // code=0x88, function=(B and C), lowered=(B and C), set=superopt_lat_xop
+        template<> __forceinline constexpr uint64_t ternary<0x88>(const uint64_t, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = B & C;
+            return t0;
+        }
+        // code=0x89, function=(not ((B xor C)) and (B or not (A))), lowered=((B xor C) notand (B or not (A))), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x89>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = B ^ C;
+            const uint64_t t1 = ~A;
+            const uint64_t t2 = B | t1;
+            const uint64_t t3 = ~t0 & t2;
+            return t3;
+        }
+        // code=0x8a, function=(not ((not (B) and A)) and C), lowered=((B notand A) notand C), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x8a>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~B & A;
+            const uint64_t t1 = ~t0 & C;
+            return t1;
+        }
+        // code=0x8b, function=((not (B) and not (A)) or (B and C)), lowered=((B notand not (A)) or (B and C)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x8b>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~A;
+            const uint64_t t1 = ~B & t0;
+            const uint64_t t2 = B & C;
+            const uint64_t t3 = t1 | t2;
+            return t3;
+        }
+        // code=0x8c, function=(not ((not (C) and A)) and B), lowered=((C notand A) notand B), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x8c>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~C & A;
+            const uint64_t t1 = ~t0 & B;
+            return t1;
+        }
+        // code=0x8d, function=((not (C) and not (A)) or (B and C)), lowered=((C notand not (A)) or (B and C)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x8d>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~A;
+            const uint64_t t1 = ~C & t0;
+            const uint64_t t2 = B & C;
+            const uint64_t t3 = t1 | t2;
+            return t3;
+        }
+        // code=0x8e, function=((A xor B) ? B : C), lowered=(((A xor B) and B) or ((A xor B) notand C)), set=superopt_lat_xop
+        template<> __forceinline constexpr uint64_t ternary<0x8e>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = A ^ B;
+            const uint64_t t1 = t0 & B;
+            const uint64_t t2 = ~t0 & C;
+            const uint64_t t3 = t1 | t2;
+            return t3;
+        }
+        // code=0x8f, function=(not (A) or (B and C)), lowered=(not (A) or (B and C)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x8f>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~A;
+            const uint64_t t1 = B & C;
+            const uint64_t t2 = t0 | t1;
+            return t2;
+        }
+        // code=0x90, function=(not ((B xor C)) and A), lowered=((B xor C) notand A), set=superopt_lat_xop
+        template<> __forceinline constexpr uint64_t ternary<0x90>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = B ^ C;
+            const uint64_t t1 = ~t0 & A;
+            return t1;
+        }
+        // code=0x91, function=(not ((B xor C)) and (A or not (B))), lowered=((B xor C) notand (A or not (B))), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x91>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = B ^ C;
+            const uint64_t t1 = ~B;
+            const uint64_t t2 = A | t1;
+            const uint64_t t3 = ~t0 & t2;
+            return t3;
+        }
+        // code=0x92, function=(not ((B xor (A and C))) and (A or C)), lowered=((B xor (A and C)) notand (A or C)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x92>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = A & C;
+            const uint64_t t1 = B ^ t0;
+            const uint64_t t2 = A | C;
+            const uint64_t t3 = ~t1 & t2;
+            return t3;
+        }
+        // code=0x93, function=(not (B) xor (A and C)), lowered=(not (B) xor (A and C)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x93>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~B;
+            const uint64_t t1 = A & C;
+            const uint64_t t2 = t0 ^ t1;
+            return t2;
+        }
+        // code=0x94, function=(not ((C xor (A and B))) and (A or B)), lowered=((C xor (A and B)) notand (A or B)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x94>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = A & B;
+            const uint64_t t1 = C ^ t0;
+            const uint64_t t2 = A | B;
+            const uint64_t t3 = ~t1 & t2;
+            return t3;
+        }
+        // code=0x95, function=(not (C) xor (A and B)), lowered=(not (C) xor (A and B)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x95>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~C;
+            const uint64_t t1 = A & B;
+            const uint64_t t2 = t0 ^ t1;
+            return t2;
+        }
+        // code=0x96, function=(C xor (A xor B)), lowered=(C xor (A xor B)), set=superopt_lat_xop
+        template<> __forceinline constexpr uint64_t ternary<0x96>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = A ^ B;
+            const uint64_t t1 = C ^ t0;
+            return t1;
+        }
+        // code=0x97, function=(not (A) xor (not ((B xor C)) and (A or B))), lowered=(not (A) xor ((B xor C) notand (A or B))), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x97>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~A;
+            const uint64_t t1 = B ^ C;
+            const uint64_t t2 = A | B;
+            const uint64_t t3 = ~t1 & t2;
+            const uint64_t t4 = t0 ^ t3;
+            return t4;
+        }
+        // code=0x98, function=(not ((B xor C)) and (A or B)), lowered=((B xor C) notand (A or B)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x98>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = B ^ C;
+            const uint64_t t1 = A | B;
+            const uint64_t t2 = ~t0 & t1;
+            return t2;
+        }
+        // code=0x99, function=(C xor not (B)), lowered=(C xor not (B)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x99>(const uint64_t, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~B;
+            const uint64_t t1 = C ^ t0;
+            return t1;
+        }
+        // code=0x9a, function=(C xor (not (B) and A)), lowered=(C xor (B notand A)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x9a>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~B & A;
+            const uint64_t t1 = C ^ t0;
+            return t1;
+        }
+        // code=0x9b, function=(not (B) xor (C and (A or B))), lowered=(not (B) xor (C and (A or B))), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x9b>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~B;
+            const uint64_t t1 = A | B;
+            const uint64_t t2 = C & t1;
+            const uint64_t t3 = t0 ^ t2;
+            return t3;
+        }
+        // code=0x9c, function=(B xor (not (C) and A)), lowered=(B xor (C notand A)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x9c>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~C & A;
+            const uint64_t t1 = B ^ t0;
+            return t1;
+        }
+        // code=0x9d, function=((not (A) and B) or (C xor not (B))), lowered=((A notand B) or (C xor not (B))), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x9d>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~A & B;
+            const uint64_t t1 = ~B;
+            const uint64_t t2 = C ^ t1;
+            const uint64_t t3 = t0 | t2;
+            return t3;
+        }
+        // code=0x9e, function=((B xor C) xor (A or (B and C))), lowered=((B xor C) xor (A or (B and C))), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x9e>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = B ^ C;
+            const uint64_t t1 = B & C;
+            const uint64_t t2 = A | t1;
+            const uint64_t t3 = t0 ^ t2;
+            return t3;
+        }
+        // code=0x9f, function=not ((A and (B xor C))), lowered=not ((A and (B xor C))), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0x9f>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = B ^ C;
+            const uint64_t t1 = A & t0;
+            const uint64_t t2 = ~t1;
+            return t2;
+        }
+        // code=0xa0, function=(A and C), lowered=(A and C), set=superopt_lat_xop
+        template<> __forceinline constexpr uint64_t ternary<0xa0>(const uint64_t A, const uint64_t, const uint64_t C) noexcept {
+            const uint64_t t0 = A & C;
+            return t0;
+        }
+        // code=0xa1, function=(not ((B and not (A))) and (C xor not (A))), lowered=((A notand B) notand (C xor not (A))), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0xa1>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~A & B;
+            const uint64_t t1 = ~A;
+            const uint64_t t2 = C ^ t1;
+            const uint64_t t3 = ~t0 & t2;
+            return t3;
+        }
+        // code=0xa2, function=(not ((not (A) and B)) and C), lowered=((A notand B) notand C), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0xa2>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~A & B;
+            const uint64_t t1 = ~t0 & C;
+            return t1;
+        }
+        // code=0xa3, function=((not (B) and not (A)) or (A and C)), lowered=((B notand not (A)) or (A and C)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0xa3>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~A;
+            const uint64_t t1 = ~B & t0;
+            const uint64_t t2 = A & C;
+            const uint64_t t3 = t1 | t2;
+            return t3;
+        }
+        // code=0xa4, function=(not ((A xor C)) and (A or B)), lowered=((A xor C) notand (A or B)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0xa4>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = A ^ C;
+            const uint64_t t1 = A | B;
+            const uint64_t t2 = ~t0 & t1;
+            return t2;
+        }
+        // code=0xa5, function=(C xor not (A)), lowered=(C xor not (A)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0xa5>(const uint64_t A, const uint64_t, const uint64_t C) noexcept {
+            const uint64_t t0 = ~A;
+            const uint64_t t1 = C ^ t0;
+            return t1;
+        }
+        // code=0xa6, function=(C xor (not (A) and B)), lowered=(C xor (A notand B)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0xa6>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~A & B;
+            const uint64_t t1 = C ^ t0;
+            return t1;
+        }
+        // code=0xa7, function=(not (A) xor (C and (A or B))), lowered=(not (A) xor (C and (A or B))), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0xa7>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~A;
+            const uint64_t t1 = A | B;
+            const uint64_t t2 = C & t1;
+            const uint64_t t3 = t0 ^ t2;
+            return t3;
+        }
+        // code=0xa8, function=(C and (A or B)), lowered=(C and (A or B)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0xa8>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = A | B;
+            const uint64_t t1 = C & t0;
+            return t1;
+        }
+        // code=0xa9, function=(not (C) xor (A or B)), lowered=(not (C) xor (A or B)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0xa9>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~C;
+            const uint64_t t1 = A | B;
+            const uint64_t t2 = t0 ^ t1;
+            return t2;
+        }
+        // code=0xaa, function=C, lowered=C, set=superopt_lat_xop
+        template<> __forceinline constexpr uint64_t ternary<0xaa>(const uint64_t, const uint64_t, const uint64_t C) noexcept {
+            return C;
+        }
+        // code=0xab, function=(C or (not (B) and not (A))), lowered=(C or (B notand not (A))), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0xab>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~A;
+            const uint64_t t1 = ~B & t0;
+            const uint64_t t2 = C | t1;
+            return t2;
+        }
+        // code=0xac, function=(A ? C : B), lowered=((A and C) or (A notand B)), set=superopt_lat_xop
+        template<> __forceinline constexpr uint64_t ternary<0xac>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = A & C;
+            const uint64_t t1 = ~A & B;
+            const uint64_t t2 = t0 | t1;
+            return t2;
+        }
+        // code=0xad, function=((B and C) or (C xor not (A))), lowered=((B and C) or (C xor not (A))), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0xad>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = B & C;
+            const uint64_t t1 = ~A;
+            const uint64_t t2 = C ^ t1;
+            const uint64_t t3 = t0 | t2;
+            return t3;
+        }
+        // code=0xae, function=(C or (not (A) and B)), lowered=(C or (A notand B)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0xae>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~A & B;
+            const uint64_t t1 = C | t0;
+            return t1;
+        }
+        // code=0xaf, function=(C or not (A)), lowered=(C or not (A)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0xaf>(const uint64_t A, const uint64_t, const uint64_t C) noexcept {
+            const uint64_t t0 = ~A;
+            const uint64_t t1 = C | t0;
+            return t1;
+        }
+        // code=0xb0, function=(not ((not (C) and B)) and A), lowered=((C notand B) notand A), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0xb0>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~C & B;
+            const uint64_t t1 = ~t0 & A;
+            return t1;
+        }
+        // code=0xb1, function=(not (A) xor (C or (A xor B))), lowered=(not (A) xor (C or (A xor B))), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0xb1>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~A;
+            const uint64_t t1 = A ^ B;
+            const uint64_t t2 = C | t1;
+            const uint64_t t3 = t0 ^ t2;
+            return t3;
+        }
+        // code=0xb2, function=((A xor B) ? A : C), lowered=(((A xor B) and A) or ((A xor B) notand C)), set=superopt_lat_xop
+        template<> __forceinline constexpr uint64_t ternary<0xb2>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = A ^ B;
+            const uint64_t t1 = t0 & A;
+            const uint64_t t2 = ~t0 & C;
+            const uint64_t t3 = t1 | t2;
+            return t3;
+        }
+        // code=0xb3, function=(not (B) or (A and C)), lowered=(not (B) or (A and C)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0xb3>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~B;
+            const uint64_t t1 = A & C;
+            const uint64_t t2 = t0 | t1;
+            return t2;
+        }
+        // code=0xb4, function=(A xor (not (C) and B)), lowered=(A xor (C notand B)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0xb4>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~C & B;
+            const uint64_t t1 = A ^ t0;
+            return t1;
+        }
+        // code=0xb5, function=((not (B) and A) or (C xor not (A))), lowered=((B notand A) or (C xor not (A))), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0xb5>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~B & A;
+            const uint64_t t1 = ~A;
+            const uint64_t t2 = C ^ t1;
+            const uint64_t t3 = t0 | t2;
+            return t3;
+        }
+        // code=0xb6, function=((B xor (A or C)) or (A and C)), lowered=((B xor (A or C)) or (A and C)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0xb6>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = A | C;
+            const uint64_t t1 = B ^ t0;
+            const uint64_t t2 = A & C;
+            const uint64_t t3 = t1 | t2;
+            return t3;
+        }
+        // code=0xb7, function=not ((B and (A xor C))), lowered=not ((B and (A xor C))), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0xb7>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = A ^ C;
+            const uint64_t t1 = B & t0;
+            const uint64_t t2 = ~t1;
+            return t2;
+        }
+        // code=0xb8, function=(B ? C : A), lowered=((B and C) or (B notand A)), set=superopt_lat_xop
+        template<> __forceinline constexpr uint64_t ternary<0xb8>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = B & C;
+            const uint64_t t1 = ~B & A;
+            const uint64_t t2 = t0 | t1;
+            return t2;
+        }
+        // code=0xb9, function=((C xor not (B)) or (A and C)), lowered=((C xor not (B)) or (A and C)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0xb9>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~B;
+            const uint64_t t1 = C ^ t0;
+            const uint64_t t2 = A & C;
+            const uint64_t t3 = t1 | t2;
+            return t3;
+        }
+        // code=0xba, function=(C or (not (B) and A)), lowered=(C or (B notand A)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0xba>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~B & A;
+            const uint64_t t1 = C | t0;
+            return t1;
+        }
+        // code=0xbb, function=(C or not (B)), lowered=(C or not (B)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0xbb>(const uint64_t, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~B;
+            const uint64_t t1 = C | t0;
+            return t1;
+        }
+        // code=0xbc, function=((A xor B) or (A and C)), lowered=((A xor B) or (A and C)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0xbc>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = A ^ B;
+            const uint64_t t1 = A & C;
+            const uint64_t t2 = t0 | t1;
+            return t2;
+        }
+        // code=0xbd, function=((A xor B) or (C xor not (A))), lowered=((A xor B) or (C xor not (A))), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0xbd>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = A ^ B;
+            const uint64_t t1 = ~A;
+            const uint64_t t2 = C ^ t1;
+            const uint64_t t3 = t0 | t2;
+            return t3;
+        }
+        // code=0xbe, function=(C or (A xor B)), lowered=(C or (A xor B)), set=superopt_lat_xop
+        template<> __forceinline constexpr uint64_t ternary<0xbe>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = A ^ B;
+            const uint64_t t1 = C | t0;
+            return t1;
+        }
+        // code=0xbf, function=(C or not ((A and B))), lowered=(C or not ((A and B))), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0xbf>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = A & B;
+            const uint64_t t1 = ~t0;
+            const uint64_t t2 = C | t1;
+            return t2;
+        }
+        // code=0xc0, function=(A and B), lowered=(A and B), set=superopt_lat_xop
+        template<> __forceinline constexpr uint64_t ternary<0xc0>(const uint64_t A, const uint64_t B, const uint64_t) noexcept {
+            const uint64_t t0 = A & B;
+            return t0;
+        }
+        // code=0xc1, function=(not ((C and not (A))) and (B xor not (A))), lowered=((A notand C) notand (B xor not (A))), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0xc1>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~A & C;
+            const uint64_t t1 = ~A;
+            const uint64_t t2 = B ^ t1;
+            const uint64_t t3 = ~t0 & t2;
+            return t3;
+        }
+        // code=0xc2, function=(not ((A xor B)) and (A or C)), lowered=((A xor B) notand (A or C)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0xc2>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = A ^ B;
+            const uint64_t t1 = A | C;
+            const uint64_t t2 = ~t0 & t1;
+            return t2;
+        }
+        // code=0xc3, function=(B xor not (A)), lowered=(B xor not (A)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0xc3>(const uint64_t A, const uint64_t B, const uint64_t) noexcept {
+            const uint64_t t0 = ~A;
+            const uint64_t t1 = B ^ t0;
+            return t1;
+        }
+        // code=0xc4, function=(not ((not (A) and C)) and B), lowered=((A notand C) notand B), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0xc4>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~A & C;
+            const uint64_t t1 = ~t0 & B;
+            return t1;
+        }
+        // code=0xc5, function=((not (C) and not (A)) or (A and B)), lowered=((C notand not (A)) or (A and B)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0xc5>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~A;
+            const uint64_t t1 = ~C & t0;
+            const uint64_t t2 = A & B;
+            const uint64_t t3 = t1 | t2;
+            return t3;
+        }
+        // code=0xc6, function=(B xor (not (A) and C)), lowered=(B xor (A notand C)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0xc6>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~A & C;
+            const uint64_t t1 = B ^ t0;
+            return t1;
+        }
+        // code=0xc7, function=(not (A) xor (B and (A or C))), lowered=(not (A) xor (B and (A or C))), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0xc7>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~A;
+            const uint64_t t1 = A | C;
+            const uint64_t t2 = B & t1;
+            const uint64_t t3 = t0 ^ t2;
+            return t3;
+        }
+        // code=0xc8, function=(B and (A or C)), lowered=(B and (A or C)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0xc8>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = A | C;
+            const uint64_t t1 = B & t0;
+            return t1;
+        }
+        // code=0xc9, function=(not (B) xor (A or C)), lowered=(not (B) xor (A or C)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0xc9>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~B;
+            const uint64_t t1 = A | C;
+            const uint64_t t2 = t0 ^ t1;
+            return t2;
+        }
+        // code=0xca, function=(A ? B : C), lowered=((A and B) or (A notand C)), set=superopt_lat_xop
+        template<> __forceinline constexpr uint64_t ternary<0xca>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = A & B;
+            const uint64_t t1 = ~A & C;
+            const uint64_t t2 = t0 | t1;
+            return t2;
+        }
+        // code=0xcb, function=((B and C) or (B xor not (A))), lowered=((B and C) or (B xor not (A))), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0xcb>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = B & C;
+            const uint64_t t1 = ~A;
+            const uint64_t t2 = B ^ t1;
+            const uint64_t t3 = t0 | t2;
+            return t3;
+        }
+        // code=0xcc, function=B, lowered=B, set=superopt_lat_xop
+        template<> __forceinline constexpr uint64_t ternary<0xcc>(const uint64_t, const uint64_t B, const uint64_t) noexcept {
+            return B;
+        }
+        // code=0xcd, function=(B or (not (C) and not (A))), lowered=(B or (C notand not (A))), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0xcd>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~A;
+            const uint64_t t1 = ~C & t0;
+            const uint64_t t2 = B | t1;
+            return t2;
+        }
+        // code=0xce, function=(B or (not (A) and C)), lowered=(B or (A notand C)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0xce>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~A & C;
+            const uint64_t t1 = B | t0;
+            return t1;
+        }
+        // code=0xcf, function=(B or not (A)), lowered=(B or not (A)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0xcf>(const uint64_t A, const uint64_t B, const uint64_t) noexcept {
+            const uint64_t t0 = ~A;
+            const uint64_t t1 = B | t0;
+            return t1;
+        }
+        // code=0xd0, function=(not ((not (B) and C)) and A), lowered=((B notand C) notand A), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0xd0>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~B & C;
+            const uint64_t t1 = ~t0 & A;
+            return t1;
+        }
+        // code=0xd1, function=(not (A) xor (B or (A xor C))), lowered=(not (A) xor (B or (A xor C))), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0xd1>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~A;
+            const uint64_t t1 = A ^ C;
+            const uint64_t t2 = B | t1;
+            const uint64_t t3 = t0 ^ t2;
+            return t3;
+        }
+        // code=0xd2, function=(A xor (not (B) and C)), lowered=(A xor (B notand C)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0xd2>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~B & C;
+            const uint64_t t1 = A ^ t0;
+            return t1;
+        }
+        // code=0xd3, function=((not (C) and A) or (B xor not (A))), lowered=((C notand A) or (B xor not (A))), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0xd3>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~C & A;
+            const uint64_t t1 = ~A;
+            const uint64_t t2 = B ^ t1;
+            const uint64_t t3 = t0 | t2;
+            return t3;
+        }
+        // code=0xd4, function=((A xor C) ? A : B), lowered=(((A xor C) and A) or ((A xor C) notand B)), set=superopt_lat_xop
+        template<> __forceinline constexpr uint64_t ternary<0xd4>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = A ^ C;
+            const uint64_t t1 = t0 & A;
+            const uint64_t t2 = ~t0 & B;
+            const uint64_t t3 = t1 | t2;
+            return t3;
+        }
+        // code=0xd5, function=(not (C) or (A and B)), lowered=(not (C) or (A and B)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0xd5>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~C;
+            const uint64_t t1 = A & B;
+            const uint64_t t2 = t0 | t1;
+            return t2;
+        }
+        // code=0xd6, function=((C xor (A or B)) or (A and B)), lowered=((C xor (A or B)) or (A and B)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0xd6>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = A | B;
+            const uint64_t t1 = C ^ t0;
+            const uint64_t t2 = A & B;
+            const uint64_t t3 = t1 | t2;
+            return t3;
+        }
+        // code=0xd7, function=not ((C and (A xor B))), lowered=not ((C and (A xor B))), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0xd7>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = A ^ B;
+            const uint64_t t1 = C & t0;
+            const uint64_t t2 = ~t1;
+            return t2;
+        }
+        // code=0xd8, function=(C ? B : A), lowered=((C and B) or (C notand A)), set=superopt_lat_xop
+        template<> __forceinline constexpr uint64_t ternary<0xd8>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = C & B;
+            const uint64_t t1 = ~C & A;
+            const uint64_t t2 = t0 | t1;
+            return t2;
+        }
+        // code=0xd9, function=(not (B) xor (C or (A and B))), lowered=(not (B) xor (C or (A and B))), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0xd9>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~B;
+            const uint64_t t1 = A & B;
+            const uint64_t t2 = C | t1;
+            const uint64_t t3 = t0 ^ t2;
+            return t3;
+        }
+        // code=0xda, function=((A xor C) or (A and B)), lowered=((A xor C) or (A and B)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0xda>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = A ^ C;
+            const uint64_t t1 = A & B;
+            const uint64_t t2 = t0 | t1;
+            return t2;
+        }
+        // code=0xdb, function=((A xor C) or (B xor not (A))), lowered=((A xor C) or (B xor not (A))), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0xdb>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = A ^ C;
+            const uint64_t t1 = ~A;
+            const uint64_t t2 = B ^ t1;
+            const uint64_t t3 = t0 | t2;
+            return t3;
+        }
+        // code=0xdc, function=(B or (not (C) and A)), lowered=(B or (C notand A)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0xdc>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~C & A;
+            const uint64_t t1 = B | t0;
+            return t1;
+        }
+        // code=0xdd, function=(B or not (C)), lowered=(B or not (C)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0xdd>(const uint64_t, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~C;
+            const uint64_t t1 = B | t0;
+            return t1;
+        }
+        // code=0xde, function=(B or (A xor C)), lowered=(B or (A xor C)), set=superopt_lat_xop
+        template<> __forceinline constexpr uint64_t ternary<0xde>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = A ^ C;
+            const uint64_t t1 = B | t0;
+            return t1;
+        }
+        // code=0xdf, function=(B or not ((A and C))), lowered=(B or not ((A and C))), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0xdf>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = A & C;
+            const uint64_t t1 = ~t0;
+            const uint64_t t2 = B | t1;
+            return t2;
+        }
+        // code=0xe0, function=(A and (B or C)), lowered=(A and (B or C)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0xe0>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = B | C;
+            const uint64_t t1 = A & t0;
+            return t1;
+        }
+        // code=0xe1, function=(not (A) xor (B or C)), lowered=(not (A) xor (B or C)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0xe1>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~A;
+            const uint64_t t1 = B | C;
+            const uint64_t t2 = t0 ^ t1;
+            return t2;
+        }
+        // code=0xe2, function=(B ? A : C), lowered=((B and A) or (B notand C)), set=superopt_lat_xop
+        template<> __forceinline constexpr uint64_t ternary<0xe2>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = B & A;
+            const uint64_t t1 = ~B & C;
+            const uint64_t t2 = t0 | t1;
+            return t2;
+        }
+        // code=0xe3, function=(not (A) xor (B or (A and C))), lowered=(not (A) xor (B or (A and C))), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0xe3>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~A;
+            const uint64_t t1 = A & C;
+            const uint64_t t2 = B | t1;
+            const uint64_t t3 = t0 ^ t2;
+            return t3;
+        }
+        // code=0xe4, function=(C ? A : B), lowered=((C and A) or (C notand B)), set=superopt_lat_xop
+        template<> __forceinline constexpr uint64_t ternary<0xe4>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = C & A;
+            const uint64_t t1 = ~C & B;
+            const uint64_t t2 = t0 | t1;
+            return t2;
+        }
+        // code=0xe5, function=(not (A) xor (C or (A and B))), lowered=(not (A) xor (C or (A and B))), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0xe5>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~A;
+            const uint64_t t1 = A & B;
+            const uint64_t t2 = C | t1;
+            const uint64_t t3 = t0 ^ t2;
+            return t3;
+        }
+        // code=0xe6, function=((B xor C) or (A and B)), lowered=((B xor C) or (A and B)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0xe6>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = B ^ C;
+            const uint64_t t1 = A & B;
+            const uint64_t t2 = t0 | t1;
+            return t2;
+        }
+        // code=0xe7, function=((B xor C) or (B xor not (A))), lowered=((B xor C) or (B xor not (A))), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0xe7>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = B ^ C;
+            const uint64_t t1 = ~A;
+            const uint64_t t2 = B ^ t1;
+            const uint64_t t3 = t0 | t2;
+            return t3;
+        }
+        // code=0xe8, function=((A xor B) ? C : A), lowered=(((A xor B) and C) or ((A xor B) notand A)), set=superopt_lat_xop
+        template<> __forceinline constexpr uint64_t ternary<0xe8>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = A ^ B;
+            const uint64_t t1 = t0 & C;
+            const uint64_t t2 = ~t0 & A;
+            const uint64_t t3 = t1 | t2;
+            return t3;
+        }
+        // code=0xe9, function=((not (B) and not (A)) xor (C or (A and B))), lowered=((B notand not (A)) xor (C or (A and B))), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0xe9>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~A;
+            const uint64_t t1 = ~B & t0;
+            const uint64_t t2 = A & B;
+            const uint64_t t3 = C | t2;
+            const uint64_t t4 = t1 ^ t3;
+            return t4;
+        }
+        // code=0xea, function=(C or (A and B)), lowered=(C or (A and B)), set=superopt_lat_xop
+        template<> __forceinline constexpr uint64_t ternary<0xea>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = A & B;
+            const uint64_t t1 = C | t0;
+            return t1;
+        }
+        // code=0xeb, function=(C or (B xor not (A))), lowered=(C or (B xor not (A))), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0xeb>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~A;
+            const uint64_t t1 = B ^ t0;
+            const uint64_t t2 = C | t1;
+            return t2;
+        }
+        // code=0xec, function=(B or (A and C)), lowered=(B or (A and C)), set=superopt_lat_xop
+        template<> __forceinline constexpr uint64_t ternary<0xec>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = A & C;
+            const uint64_t t1 = B | t0;
+            return t1;
+        }
+        // code=0xed, function=(B or (C xor not (A))), lowered=(B or (C xor not (A))), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0xed>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~A;
+            const uint64_t t1 = C ^ t0;
+            const uint64_t t2 = B | t1;
+            return t2;
+        }
+        // code=0xee, function=(B or C), lowered=(B or C), set=superopt_lat_xop
+        template<> __forceinline constexpr uint64_t ternary<0xee>(const uint64_t, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = B | C;
+            return t0;
+        }
+        // code=0xef, function=(not (A) or (B or C)), lowered=(not (A) or (B or C)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0xef>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~A;
+            const uint64_t t1 = B | C;
+            const uint64_t t2 = t0 | t1;
+            return t2;
+        }
+        // code=0xf0, function=A, lowered=A, set=superopt_lat_xop
+        template<> __forceinline constexpr uint64_t ternary<0xf0>(const uint64_t A, const uint64_t, const uint64_t) noexcept {
+            return A;
+        }
+        // code=0xf1, function=(A or (not (C) and not (B))), lowered=(A or (C notand not (B))), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0xf1>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~B;
+            const uint64_t t1 = ~C & t0;
+            const uint64_t t2 = A | t1;
+            return t2;
+        }
+        // code=0xf2, function=(A or (not (B) and C)), lowered=(A or (B notand C)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0xf2>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~B & C;
+            const uint64_t t1 = A | t0;
+            return t1;
+        }
+        // code=0xf3, function=(A or not (B)), lowered=(A or not (B)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0xf3>(const uint64_t A, const uint64_t B, const uint64_t) noexcept {
+            const uint64_t t0 = ~B;
+            const uint64_t t1 = A | t0;
+            return t1;
+        }
+        // code=0xf4, function=(A or (not (C) and B)), lowered=(A or (C notand B)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0xf4>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~C & B;
+            const uint64_t t1 = A | t0;
+            return t1;
+        }
+        // code=0xf5, function=(A or not (C)), lowered=(A or not (C)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0xf5>(const uint64_t A, const uint64_t, const uint64_t C) noexcept {
+            const uint64_t t0 = ~C;
+            const uint64_t t1 = A | t0;
+            return t1;
+        }
+        // code=0xf6, function=(A or (B xor C)), lowered=(A or (B xor C)), set=superopt_lat_xop
+        template<> __forceinline constexpr uint64_t ternary<0xf6>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = B ^ C;
+            const uint64_t t1 = A | t0;
+            return t1;
+        }
+        // code=0xf7, function=(A or not ((B and C))), lowered=(A or not ((B and C))), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0xf7>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = B & C;
+            const uint64_t t1 = ~t0;
+            const uint64_t t2 = A | t1;
+            return t2;
+        }
+        // code=0xf8, function=(A or (B and C)), lowered=(A or (B and C)), set=superopt_lat_xop
+        template<> __forceinline constexpr uint64_t ternary<0xf8>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = B & C;
+            const uint64_t t1 = A | t0;
+            return t1;
+        }
+        // code=0xf9, function=(A or (C xor not (B))), lowered=(A or (C xor not (B))), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0xf9>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~B;
+            const uint64_t t1 = C ^ t0;
+            const uint64_t t2 = A | t1;
+            return t2;
+        }
+        // code=0xfa, function=(A or C), lowered=(A or C), set=superopt_lat_xop
+        template<> __forceinline constexpr uint64_t ternary<0xfa>(const uint64_t A, const uint64_t, const uint64_t C) noexcept {
+            const uint64_t t0 = A | C;
+            return t0;
+        }
+        // code=0xfb, function=(not (B) or (A or C)), lowered=(not (B) or (A or C)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0xfb>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~B;
+            const uint64_t t1 = A | C;
+            const uint64_t t2 = t0 | t1;
+            return t2;
+        }
+        // code=0xfc, function=(A or B), lowered=(A or B), set=superopt_lat_xop
+        template<> __forceinline constexpr uint64_t ternary<0xfc>(const uint64_t A, const uint64_t B, const uint64_t) noexcept {
+            const uint64_t t0 = A | B;
+            return t0;
+        }
+        // code=0xfd, function=(not (C) or (A or B)), lowered=(not (C) or (A or B)), set=superopt_lat_bmi
+        template<> __forceinline constexpr uint64_t ternary<0xfd>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = ~C;
+            const uint64_t t1 = A | B;
+            const uint64_t t2 = t0 | t1;
+            return t2;
+        }
+        // code=0xfe, function=(C or (A or B)), lowered=(C or (A or B)), set=superopt_lat_xop
+        template<> __forceinline constexpr uint64_t ternary<0xfe>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            const uint64_t t0 = A | B;
+            const uint64_t t1 = C | t0;
+            return t1;
+        }
+        // code=0xff, function=1, lowered=1, set=superopt_lat_xop
+        template<> __forceinline constexpr uint64_t ternary<0xff>(const uint64_t, const uint64_t, const uint64_t) noexcept {
+            const uint64_t c1 = uint64_t(-1);
+            return c1;
+        }
+
+        // ternary_lat<k> is ternary<k>, unless a kernel with a shorter dependency chain exists
+        template<unsigned k> __forceinline constexpr uint64_t ternary_lat(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+            return ternary<k>(A, B, C);
+        }
+
+        // kernels<u>::ternary<k> is the kernel of microarchitecture u of ternarylogic::uarch;
+        // u = 0 is the generic model that counts instructions, the others follow py/lib/uarch.py
+        template<unsigned u> struct kernels {
+            template<unsigned k> static __forceinline constexpr uint64_t ternary(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                return x86_64_bmi::ternary<k>(A, B, C);
+            }
+            template<unsigned k> static __forceinline constexpr uint64_t ternary_lat(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                return x86_64_bmi::ternary_lat<k>(A, B, C);
+            }
+        };
+
+        // Intel Skylake, Kaby Lake, Coffee Lake (client): the kernels that are faster there than the generic ones
+        namespace skylake {
+
+            template<unsigned k> __forceinline constexpr uint64_t ternary(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                return x86_64_bmi::ternary<k>(A, B, C);
+            }
+
+            // code=0x01, function=(A nor (B or C)), lowered=not ((A or (B or C))), set=intel
+            template<> __forceinline constexpr uint64_t ternary<0x01>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B | C;
+                const uint64_t t1 = A | t0;
+                const uint64_t t2 = ~t1;
+                return t2;
+            }
+            // code=0x07, function=(A nor (B and C)), lowered=not ((A or (B and C))), set=intel
+            template<> __forceinline constexpr uint64_t ternary<0x07>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B & C;
+                const uint64_t t1 = A | t0;
+                const uint64_t t2 = ~t1;
+                return t2;
+            }
+            // code=0x08, function=((not (A) and B) and C), lowered=((A notand B) and C), set=automat
+            template<> __forceinline constexpr uint64_t ternary<0x08>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~A & B;
+                const uint64_t t1 = t0 & C;
+                return t1;
+            }
+            // code=0x09, function=(A nor (B xor C)), lowered=not ((A or (B xor C))), set=intel
+            template<> __forceinline constexpr uint64_t ternary<0x09>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B ^ C;
+                const uint64_t t1 = A | t0;
+                const uint64_t t2 = ~t1;
+                return t2;
+            }
+            // code=0x13, function=(B nor (A and C)), lowered=not ((B or (A and C))), set=intel
+            template<> __forceinline constexpr uint64_t ternary<0x13>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A & C;
+                const uint64_t t1 = B | t0;
+                const uint64_t t2 = ~t1;
+                return t2;
+            }
+            // code=0x15, function=(C nor (B and A)), lowered=not ((C or (B and A))), set=intel
+            template<> __forceinline constexpr uint64_t ternary<0x15>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B & A;
+                const uint64_t t1 = C | t0;
+                const uint64_t t2 = ~t1;
+                return t2;
+            }
+            // code=0x17, function=((B nor C) or (not (A) and (B xor C))), lowered=(not ((B or C)) or (A notand (B xor C))), set=optimized
+            template<> __forceinline constexpr uint64_t ternary<0x17>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B | C;
+                const uint64_t t1 = ~t0;
+                const uint64_t t2 = B ^ C;
+                const uint64_t t3 = ~A & t2;
+                const uint64_t t4 = t1 | t3;
+                return t4;
+            }
+            // code=0x1a, function=(A xor (C or (A and B))), lowered=(A xor (C or (A and B))), set=superopt_sse
+            template<> __forceinline constexpr uint64_t ternary<0x1a>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A & B;
+                const uint64_t t1 = C | t0;
+                const uint64_t t2 = A ^ t1;
+                return t2;
+            }
+            // code=0x1b, function=(A xor (C or (B xor not (A)))), lowered=(A xor (C or (B xor not (A)))), set=superopt_x86
+            template<> __forceinline constexpr uint64_t ternary<0x1b>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~A;
+                const uint64_t t1 = B ^ t0;
+                const uint64_t t2 = C | t1;
+                const uint64_t t3 = A ^ t2;
+                return t3;
+            }
+            // code=0x1c, function=(A xor (B or (A and C))), lowered=(A xor (B or (A and C))), set=superopt_sse
+            template<> __forceinline constexpr uint64_t ternary<0x1c>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A & C;
+                const uint64_t t1 = B | t0;
+                const uint64_t t2 = A ^ t1;
+                return t2;
+            }
+            // code=0x1d, function=(A xor (B or (C xor not (A)))), lowered=(A xor (B or (C xor not (A)))), set=superopt_x86
+            template<> __forceinline constexpr uint64_t ternary<0x1d>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~A;
+                const uint64_t t1 = C ^ t0;
+                const uint64_t t2 = B | t1;
+                const uint64_t t3 = A ^ t2;
+                return t3;
+            }
+            // code=0x20, function=((not (B) and A) and C), lowered=((B notand A) and C), set=automat
+            template<> __forceinline constexpr uint64_t ternary<0x20>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~B & A;
+                const uint64_t t1 = t0 & C;
+                return t1;
+            }
+            // code=0x21, function=(B nor (A xor C)), lowered=not ((B or (A xor C))), set=intel
+            template<> __forceinline constexpr uint64_t ternary<0x21>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A ^ C;
+                const uint64_t t1 = B | t0;
+                const uint64_t t2 = ~t1;
+                return t2;
+            }
+            // code=0x26, function=(B xor (C or (A and B))), lowered=(B xor (C or (A and B))), set=superopt_sse
+            template<> __forceinline constexpr uint64_t ternary<0x26>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A & B;
+                const uint64_t t1 = C | t0;
+                const uint64_t t2 = B ^ t1;
+                return t2;
+            }
+            // code=0x2c, function=(B xor (A and (B or C))), lowered=(B xor (A and (B or C))), set=superopt_sse
+            template<> __forceinline constexpr uint64_t ternary<0x2c>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B | C;
+                const uint64_t t1 = A & t0;
+                const uint64_t t2 = B ^ t1;
+                return t2;
+            }
+            // code=0x2e, function=(B ? (not (A) and B) : C), lowered=((B and (A notand B)) or (B notand C)), set=xop
+            template<> __forceinline constexpr uint64_t ternary<0x2e>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~A & B;
+                const uint64_t t1 = B & t0;
+                const uint64_t t2 = ~B & C;
+                const uint64_t t3 = t1 | t2;
+                return t3;
+            }
+            // code=0x31, function=not ((B or (C and not (A)))), lowered=not ((B or (A notand C))), set=superopt_x86
+            template<> __forceinline constexpr uint64_t ternary<0x31>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~A & C;
+                const uint64_t t1 = B | t0;
+                const uint64_t t2 = ~t1;
+                return t2;
+            }
+            // code=0x34, function=(B xor (A or (B and C))), lowered=(B xor (A or (B and C))), set=superopt_sse
+            template<> __forceinline constexpr uint64_t ternary<0x34>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B & C;
+                const uint64_t t1 = A | t0;
+                const uint64_t t2 = B ^ t1;
+                return t2;
+            }
+            // code=0x38, function=(A xor (B and (A or C))), lowered=(A xor (B and (A or C))), set=superopt_sse
+            template<> __forceinline constexpr uint64_t ternary<0x38>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A | C;
+                const uint64_t t1 = B & t0;
+                const uint64_t t2 = A ^ t1;
+                return t2;
+            }
+            // code=0x3a, function=(A ? (not (B) and A) : C), lowered=((A and (B notand A)) or (A notand C)), set=xop
+            template<> __forceinline constexpr uint64_t ternary<0x3a>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~B & A;
+                const uint64_t t1 = A & t0;
+                const uint64_t t2 = ~A & C;
+                const uint64_t t3 = t1 | t2;
+                return t3;
+            }
+            // code=0x3d, function=(A xor (B or not ((A or C)))), lowered=(A xor (B or not ((A or C)))), set=superopt_x86
+            template<> __forceinline constexpr uint64_t ternary<0x3d>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A | C;
+                const uint64_t t1 = ~t0;
+                const uint64_t t2 = B | t1;
+                const uint64_t t3 = A ^ t2;
+                return t3;
+            }
+            // code=0x3e, function=(A xor (B or (C and not (A)))), lowered=(A xor (B or (A notand C))), set=superopt_x86
+            template<> __forceinline constexpr uint64_t ternary<0x3e>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~A & C;
+                const uint64_t t1 = B | t0;
+                const uint64_t t2 = A ^ t1;
+                return t2;
+            }
+            // code=0x40, function=((not (C) and A) and B), lowered=((C notand A) and B), set=automat
+            template<> __forceinline constexpr uint64_t ternary<0x40>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~C & A;
+                const uint64_t t1 = t0 & B;
+                return t1;
+            }
+            // code=0x41, function=(C nor (B xor A)), lowered=not ((C or (B xor A))), set=intel
+            template<> __forceinline constexpr uint64_t ternary<0x41>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B ^ A;
+                const uint64_t t1 = C | t0;
+                const uint64_t t2 = ~t1;
+                return t2;
+            }
+            // code=0x46, function=(C xor (B or (A and C))), lowered=(C xor (B or (A and C))), set=superopt_sse
+            template<> __forceinline constexpr uint64_t ternary<0x46>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A & C;
+                const uint64_t t1 = B | t0;
+                const uint64_t t2 = C ^ t1;
+                return t2;
+            }
+            // code=0x4a, function=(C xor (A and (B or C))), lowered=(C xor (A and (B or C))), set=superopt_sse
+            template<> __forceinline constexpr uint64_t ternary<0x4a>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B | C;
+                const uint64_t t1 = A & t0;
+                const uint64_t t2 = C ^ t1;
+                return t2;
+            }
+            // code=0x4e, function=(C ? (not (A) and C) : B), lowered=((C and (A notand C)) or (C notand B)), set=xop
+            template<> __forceinline constexpr uint64_t ternary<0x4e>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~A & C;
+                const uint64_t t1 = C & t0;
+                const uint64_t t2 = ~C & B;
+                const uint64_t t3 = t1 | t2;
+                return t3;
+            }
+            // code=0x51, function=not ((C or (B and not (A)))), lowered=not ((C or (A notand B))), set=superopt_x86
+            template<> __forceinline constexpr uint64_t ternary<0x51>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~A & B;
+                const uint64_t t1 = C | t0;
+                const uint64_t t2 = ~t1;
+                return t2;
+            }
+            // code=0x52, function=(C xor (A or (B and C))), lowered=(C xor (A or (B and C))), set=superopt_sse
+            template<> __forceinline constexpr uint64_t ternary<0x52>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B & C;
+                const uint64_t t1 = A | t0;
+                const uint64_t t2 = C ^ t1;
+                return t2;
+            }
+            // code=0x58, function=(A xor (C and (A or B))), lowered=(A xor (C and (A or B))), set=superopt_sse
+            template<> __forceinline constexpr uint64_t ternary<0x58>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A | B;
+                const uint64_t t1 = C & t0;
+                const uint64_t t2 = A ^ t1;
+                return t2;
+            }
+            // code=0x5b, function=(A xor (C or not ((A or B)))), lowered=(A xor (C or not ((A or B)))), set=superopt_x86
+            template<> __forceinline constexpr uint64_t ternary<0x5b>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A | B;
+                const uint64_t t1 = ~t0;
+                const uint64_t t2 = C | t1;
+                const uint64_t t3 = A ^ t2;
+                return t3;
+            }
+            // code=0x5c, function=(A ? (not (C) and A) : B), lowered=((A and (C notand A)) or (A notand B)), set=xop
+            template<> __forceinline constexpr uint64_t ternary<0x5c>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~C & A;
+                const uint64_t t1 = A & t0;
+                const uint64_t t2 = ~A & B;
+                const uint64_t t3 = t1 | t2;
+                return t3;
+            }
+            // code=0x5e, function=(A xor (C or (B and not (A)))), lowered=(A xor (C or (A notand B))), set=superopt_x86
+            template<> __forceinline constexpr uint64_t ternary<0x5e>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~A & B;
+                const uint64_t t1 = C | t0;
+                const uint64_t t2 = A ^ t1;
+                return t2;
+            }
+            // code=0x62, function=(C xor (B and (A or C))), lowered=(C xor (B and (A or C))), set=superopt_sse
+            template<> __forceinline constexpr uint64_t ternary<0x62>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A | C;
+                const uint64_t t1 = B & t0;
+                const uint64_t t2 = C ^ t1;
+                return t2;
+            }
+            // code=0x64, function=(B xor (C and (A or B))), lowered=(B xor (C and (A or B))), set=superopt_sse
+            template<> __forceinline constexpr uint64_t ternary<0x64>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A | B;
+                const uint64_t t1 = C & t0;
+                const uint64_t t2 = B ^ t1;
+                return t2;
+            }
+            // code=0x67, function=(B xor (C or not ((A or B)))), lowered=(B xor (C or not ((A or B)))), set=superopt_x86
+            template<> __forceinline constexpr uint64_t ternary<0x67>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A | B;
+                const uint64_t t1 = ~t0;
+                const uint64_t t2 = C | t1;
+                const uint64_t t3 = B ^ t2;
+                return t3;
+            }
+            // code=0x69, function=(A xnor (B xor C)), lowered=not ((A xor (B xor C))), set=intel
+            template<> __forceinline constexpr uint64_t ternary<0x69>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B ^ C;
+                const uint64_t t1 = A ^ t0;
+                const uint64_t t2 = ~t1;
+                return t2;
+            }
+            // code=0x6b, function=((C xor not (A)) xor (B or (C and not (A)))), lowered=((C xor not (A)) xor (B or (A notand C))), set=superopt_x86
+            template<> __forceinline constexpr uint64_t ternary<0x6b>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~A;
+                const uint64_t t1 = C ^ t0;
+                const uint64_t t2 = ~A & C;
+                const uint64_t t3 = B | t2;
+                const uint64_t t4 = t1 ^ t3;
+                return t4;
+            }
+            // code=0x6d, function=((B and not (A)) or (C xor (B or not (A)))), lowered=((A notand B) or (C xor (B or not (A)))), set=superopt_x86
+            template<> __forceinline constexpr uint64_t ternary<0x6d>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~A & B;
+                const uint64_t t1 = ~A;
+                const uint64_t t2 = B | t1;
+                const uint64_t t3 = C ^ t2;
+                const uint64_t t4 = t0 | t3;
+                return t4;
+            }
+            // code=0x72, function=(C ? (not (B) and C) : A), lowered=((C and (B notand C)) or (C notand A)), set=xop
+            template<> __forceinline constexpr uint64_t ternary<0x72>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~B & C;
+                const uint64_t t1 = C & t0;
+                const uint64_t t2 = ~C & A;
+                const uint64_t t3 = t1 | t2;
+                return t3;
+            }
+            // code=0x74, function=(B ? (not (C) and B) : A), lowered=((B and (C notand B)) or (B notand A)), set=xop
+            template<> __forceinline constexpr uint64_t ternary<0x74>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~C & B;
+                const uint64_t t1 = B & t0;
+                const uint64_t t2 = ~B & A;
+                const uint64_t t3 = t1 | t2;
+                return t3;
+            }
+            // code=0x76, function=(B xor (C or (A and not (B)))), lowered=(B xor (C or (B notand A))), set=superopt_x86
+            template<> __forceinline constexpr uint64_t ternary<0x76>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~B & A;
+                const uint64_t t1 = C | t0;
+                const uint64_t t2 = B ^ t1;
+                return t2;
+            }
+            // code=0x79, function=((A and not (B)) or (C xor (A or not (B)))), lowered=((B notand A) or (C xor (A or not (B)))), set=superopt_x86
+            template<> __forceinline constexpr uint64_t ternary<0x79>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~B & A;
+                const uint64_t t1 = ~B;
+                const uint64_t t2 = A | t1;
+                const uint64_t t3 = C ^ t2;
+                const uint64_t t4 = t0 | t3;
+                return t4;
+            }
+            // code=0x87, function=(A xnor (B and C)), lowered=not ((A xor (B and C))), set=intel
+            template<> __forceinline constexpr uint64_t ternary<0x87>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B & C;
+                const uint64_t t1 = A ^ t0;
+                const uint64_t t2 = ~t1;
+                return t2;
+            }
+            // code=0x89, function=(not (B) xor (C or (A and not (B)))), lowered=(not (B) xor (C or (B notand A))), set=superopt_x86
+            template<> __forceinline constexpr uint64_t ternary<0x89>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~B;
+                const uint64_t t1 = ~B & A;
+                const uint64_t t2 = C | t1;
+                const uint64_t t3 = t0 ^ t2;
+                return t3;
+            }
+            // code=0x8b, function=((A and not (B)) xor (C or not (B))), lowered=((B notand A) xor (C or not (B))), set=superopt_lat_x86
+            template<> __forceinline constexpr uint64_t ternary<0x8b>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~B & A;
+                const uint64_t t1 = ~B;
+                const uint64_t t2 = C | t1;
+                const uint64_t t3 = t0 ^ t2;
+                return t3;
+            }
+            // code=0x93, function=(B xnor (A and C)), lowered=not ((B xor (A and C))), set=intel
+            template<> __forceinline constexpr uint64_t ternary<0x93>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A & C;
+                const uint64_t t1 = B ^ t0;
+                const uint64_t t2 = ~t1;
+                return t2;
+            }
+            // code=0x95, function=(C xnor (B and A)), lowered=not ((C xor (B and A))), set=intel
+            template<> __forceinline constexpr uint64_t ternary<0x95>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B & A;
+                const uint64_t t1 = C ^ t0;
+                const uint64_t t2 = ~t1;
+                return t2;
+            }
+            // code=0x97, function=(not ((A and B)) xor (C and (A or B))), lowered=(not ((A and B)) xor (C and (A or B))), set=superopt_x86
+            template<> __forceinline constexpr uint64_t ternary<0x97>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A & B;
+                const uint64_t t1 = ~t0;
+                const uint64_t t2 = A | B;
+                const uint64_t t3 = C & t2;
+                const uint64_t t4 = t1 ^ t3;
+                return t4;
+            }
+            // code=0x9b, function=((not (A) and C) or (B xor (C xor 1))), lowered=((A notand C) or (B xor (C xor 1))), set=automat
+            template<> __forceinline constexpr uint64_t ternary<0x9b>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~A & C;
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t1 = C ^ c1;
+                const uint64_t t2 = B ^ t1;
+                const uint64_t t3 = t0 | t2;
+                return t3;
+            }
+            // code=0xa3, function=((B and not (A)) xor (C or not (A))), lowered=((A notand B) xor (C or not (A))), set=superopt_x86
+            template<> __forceinline constexpr uint64_t ternary<0xa3>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~A & B;
+                const uint64_t t1 = ~A;
+                const uint64_t t2 = C | t1;
+                const uint64_t t3 = t0 ^ t2;
+                return t3;
+            }
+            // code=0xa7, function=((not (B) and C) or (A xor (C xor 1))), lowered=((B notand C) or (A xor (C xor 1))), set=automat
+            template<> __forceinline constexpr uint64_t ternary<0xa7>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~B & C;
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t1 = C ^ c1;
+                const uint64_t t2 = A ^ t1;
+                const uint64_t t3 = t0 | t2;
+                return t3;
+            }
+            // code=0xa9, function=(C xnor (B or A)), lowered=not ((C xor (B or A))), set=intel
+            template<> __forceinline constexpr uint64_t ternary<0xa9>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B | A;
+                const uint64_t t1 = C ^ t0;
+                const uint64_t t2 = ~t1;
+                return t2;
+            }
+            // code=0xb9, function=((B xnor C) or (A and not (B))), lowered=(not ((B xor C)) or (B notand A)), set=optimized
+            template<> __forceinline constexpr uint64_t ternary<0xb9>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B ^ C;
+                const uint64_t t1 = ~t0;
+                const uint64_t t2 = ~B & A;
+                const uint64_t t3 = t1 | t2;
+                return t3;
+            }
+            // code=0xc5, function=((C and not (A)) xor (B or not (A))), lowered=((A notand C) xor (B or not (A))), set=superopt_x86
+            template<> __forceinline constexpr uint64_t ternary<0xc5>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~A & C;
+                const uint64_t t1 = ~A;
+                const uint64_t t2 = B | t1;
+                const uint64_t t3 = t0 ^ t2;
+                return t3;
+            }
+            // code=0xc7, function=((not (C) and B) or (A xor (B xor 1))), lowered=((C notand B) or (A xor (B xor 1))), set=automat
+            template<> __forceinline constexpr uint64_t ternary<0xc7>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~C & B;
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t1 = B ^ c1;
+                const uint64_t t2 = A ^ t1;
+                const uint64_t t3 = t0 | t2;
+                return t3;
+            }
+            // code=0xc9, function=(B xnor (A or C)), lowered=not ((B xor (A or C))), set=intel
+            template<> __forceinline constexpr uint64_t ternary<0xc9>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A | C;
+                const uint64_t t1 = B ^ t0;
+                const uint64_t t2 = ~t1;
+                return t2;
+            }
+            // code=0xd4, function=((B and not (C)) or (A and (B xnor C))), lowered=((C notand B) or ((B xor C) notand A)), set=optimized
+            template<> __forceinline constexpr uint64_t ternary<0xd4>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~C & B;
+                const uint64_t t1 = B ^ C;
+                const uint64_t t2 = ~t1 & A;
+                const uint64_t t3 = t0 | t2;
+                return t3;
+            }
+            // code=0xe1, function=(A xnor (B or C)), lowered=not ((A xor (B or C))), set=intel
+            template<> __forceinline constexpr uint64_t ternary<0xe1>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B | C;
+                const uint64_t t1 = A ^ t0;
+                const uint64_t t2 = ~t1;
+                return t2;
+            }
+            // code=0xef, function=(B or ((A xor 1) or C)), lowered=(B or ((A xor 1) or C)), set=automat
+            template<> __forceinline constexpr uint64_t ternary<0xef>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t0 = A ^ c1;
+                const uint64_t t1 = t0 | C;
+                const uint64_t t2 = B | t1;
+                return t2;
+            }
+            // code=0xfb, function=(A or (not (B) or C)), lowered=(A or (not (B) or C)), set=optimized
+            template<> __forceinline constexpr uint64_t ternary<0xfb>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~B;
+                const uint64_t t1 = t0 | C;
+                const uint64_t t2 = A | t1;
+                return t2;
+            }
+            // code=0xfd, function=(A or (B or (C xor 1))), lowered=(A or (B or (C xor 1))), set=automat
+            template<> __forceinline constexpr uint64_t ternary<0xfd>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t0 = C ^ c1;
+                const uint64_t t1 = B | t0;
+                const uint64_t t2 = A | t1;
+                return t2;
+            }
+
+            template<unsigned k> __forceinline constexpr uint64_t ternary_lat(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                return x86_64_bmi::ternary_lat<k>(A, B, C);
+            }
+
+            // code=0x08, function=((not (A) and B) and C), lowered=((A notand B) and C), set=automat
+            template<> __forceinline constexpr uint64_t ternary_lat<0x08>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~A & B;
+                const uint64_t t1 = t0 & C;
+                return t1;
+            }
+            // code=0x17, function=((B nor C) or (not (A) and (B xor C))), lowered=(not ((B or C)) or (A notand (B xor C))), set=optimized
+            template<> __forceinline constexpr uint64_t ternary_lat<0x17>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B | C;
+                const uint64_t t1 = ~t0;
+                const uint64_t t2 = B ^ C;
+                const uint64_t t3 = ~A & t2;
+                const uint64_t t4 = t1 | t3;
+                return t4;
+            }
+            // code=0x20, function=((not (B) and A) and C), lowered=((B notand A) and C), set=automat
+            template<> __forceinline constexpr uint64_t ternary_lat<0x20>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~B & A;
+                const uint64_t t1 = t0 & C;
+                return t1;
+            }
+            // code=0x40, function=((not (C) and A) and B), lowered=((C notand A) and B), set=automat
+            template<> __forceinline constexpr uint64_t ternary_lat<0x40>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~C & A;
+                const uint64_t t1 = t0 & B;
+                return t1;
+            }
+            // code=0x6b, function=((C xor not (A)) xor (B or (C and not (A)))), lowered=((C xor not (A)) xor (B or (A notand C))), set=superopt_x86
+            template<> __forceinline constexpr uint64_t ternary_lat<0x6b>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~A;
+                const uint64_t t1 = C ^ t0;
+                const uint64_t t2 = ~A & C;
+                const uint64_t t3 = B | t2;
+                const uint64_t t4 = t1 ^ t3;
+                return t4;
+            }
+            // code=0x89, function=(not (B) xor (C or (A and not (B)))), lowered=(not (B) xor (C or (B notand A))), set=superopt_x86
+            template<> __forceinline constexpr uint64_t ternary_lat<0x89>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~B;
+                const uint64_t t1 = ~B & A;
+                const uint64_t t2 = C | t1;
+                const uint64_t t3 = t0 ^ t2;
+                return t3;
+            }
+            // code=0x8b, function=((A and not (B)) xor (C or not (B))), lowered=((B notand A) xor (C or not (B))), set=superopt_lat_x86
+            template<> __forceinline constexpr uint64_t ternary_lat<0x8b>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~B & A;
+                const uint64_t t1 = ~B;
+                const uint64_t t2 = C | t1;
+                const uint64_t t3 = t0 ^ t2;
+                return t3;
+            }
+            // code=0x97, function=(not ((A and B)) xor (C and (A or B))), lowered=(not ((A and B)) xor (C and (A or B))), set=superopt_x86
+            template<> __forceinline constexpr uint64_t ternary_lat<0x97>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A & B;
+                const uint64_t t1 = ~t0;
+                const uint64_t t2 = A | B;
+                const uint64_t t3 = C & t2;
+                const uint64_t t4 = t1 ^ t3;
+                return t4;
+            }
+            // code=0x9b, function=((not (A) and C) or (B xor (C xor 1))), lowered=((A notand C) or (B xor (C xor 1))), set=automat
+            template<> __forceinline constexpr uint64_t ternary_lat<0x9b>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~A & C;
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t1 = C ^ c1;
+                const uint64_t t2 = B ^ t1;
+                const uint64_t t3 = t0 | t2;
+                return t3;
+            }
+            // code=0xa3, function=((B and not (A)) xor (C or not (A))), lowered=((A notand B) xor (C or not (A))), set=superopt_x86
+            template<> __forceinline constexpr uint64_t ternary_lat<0xa3>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~A & B;
+                const uint64_t t1 = ~A;
+                const uint64_t t2 = C | t1;
+                const uint64_t t3 = t0 ^ t2;
+                return t3;
+            }
+            // code=0xa7, function=((not (B) and C) or (A xor (C xor 1))), lowered=((B notand C) or (A xor (C xor 1))), set=automat
+            template<> __forceinline constexpr uint64_t ternary_lat<0xa7>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~B & C;
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t1 = C ^ c1;
+                const uint64_t t2 = A ^ t1;
+                const uint64_t t3 = t0 | t2;
+                return t3;
+            }
+            // code=0xb9, function=((B xnor C) or (A and not (B))), lowered=(not ((B xor C)) or (B notand A)), set=optimized
+            template<> __forceinline constexpr uint64_t ternary_lat<0xb9>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B ^ C;
+                const uint64_t t1 = ~t0;
+                const uint64_t t2 = ~B & A;
+                const uint64_t t3 = t1 | t2;
+                return t3;
+            }
+            // code=0xc5, function=((C and not (A)) xor (B or not (A))), lowered=((A notand C) xor (B or not (A))), set=superopt_x86
+            template<> __forceinline constexpr uint64_t ternary_lat<0xc5>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~A & C;
+                const uint64_t t1 = ~A;
+                const uint64_t t2 = B | t1;
+                const uint64_t t3 = t0 ^ t2;
+                return t3;
+            }
+            // code=0xc7, function=((not (C) and B) or (A xor (B xor 1))), lowered=((C notand B) or (A xor (B xor 1))), set=automat
+            template<> __forceinline constexpr uint64_t ternary_lat<0xc7>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~C & B;
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t1 = B ^ c1;
+                const uint64_t t2 = A ^ t1;
+                const uint64_t t3 = t0 | t2;
+                return t3;
+            }
+            // code=0xd4, function=((B and not (C)) or (A and (B xnor C))), lowered=((C notand B) or ((B xor C) notand A)), set=optimized
+            template<> __forceinline constexpr uint64_t ternary_lat<0xd4>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~C & B;
+                const uint64_t t1 = B ^ C;
+                const uint64_t t2 = ~t1 & A;
+                const uint64_t t3 = t0 | t2;
+                return t3;
+            }
+
+        } // namespace skylake
+
+        template<> struct kernels<1> {
+            template<unsigned k> static __forceinline constexpr uint64_t ternary(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                return skylake::ternary<k>(A, B, C);
+            }
+            template<unsigned k> static __forceinline constexpr uint64_t ternary_lat(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                return skylake::ternary_lat<k>(A, B, C);
+            }
+        };
+
+        // Intel Ice Lake, Tiger Lake: the kernels that are faster there than the generic ones
+        namespace icelake {
+
+            template<unsigned k> __forceinline constexpr uint64_t ternary(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                return x86_64_bmi::ternary<k>(A, B, C);
+            }
+
+            // code=0x01, function=(A nor (B or C)), lowered=not ((A or (B or C))), set=intel
+            template<> __forceinline constexpr uint64_t ternary<0x01>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B | C;
+                const uint64_t t1 = A | t0;
+                const uint64_t t2 = ~t1;
+                return t2;
+            }
+            // code=0x07, function=(A nor (B and C)), lowered=not ((A or (B and C))), set=intel
+            template<> __forceinline constexpr uint64_t ternary<0x07>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B & C;
+                const uint64_t t1 = A | t0;
+                const uint64_t t2 = ~t1;
+                return t2;
+            }
+            // code=0x08, function=((not (A) and B) and C), lowered=((A notand B) and C), set=automat
+            template<> __forceinline constexpr uint64_t ternary<0x08>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~A & B;
+                const uint64_t t1 = t0 & C;
+                return t1;
+            }
+            // code=0x09, function=(A nor (B xor C)), lowered=not ((A or (B xor C))), set=intel
+            template<> __forceinline constexpr uint64_t ternary<0x09>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B ^ C;
+                const uint64_t t1 = A | t0;
+                const uint64_t t2 = ~t1;
+                return t2;
+            }
+            // code=0x0b, function=(not ((not (C) and B)) and (A xor 1)), lowered=((C notand B) notand (A xor 1)), set=superopt_lat_sse
+            template<> __forceinline constexpr uint64_t ternary<0x0b>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~C & B;
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t1 = A ^ c1;
+                const uint64_t t2 = ~t0 & t1;
+                return t2;
+            }
+            // code=0x0d, function=(not ((not (B) and C)) and (A xor 1)), lowered=((B notand C) notand (A xor 1)), set=superopt_lat_sse
+            template<> __forceinline constexpr uint64_t ternary<0x0d>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~B & C;
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t1 = A ^ c1;
+                const uint64_t t2 = ~t0 & t1;
+                return t2;
+            }
+            // code=0x0f, function=(A xor 1), lowered=(A xor 1), set=superopt_lat_xop
+            template<> __forceinline constexpr uint64_t ternary<0x0f>(const uint64_t A, const uint64_t, const uint64_t) noexcept {
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t0 = A ^ c1;
+                return t0;
+            }
+            // code=0x13, function=(B nor (A and C)), lowered=not ((B or (A and C))), set=intel
+            template<> __forceinline constexpr uint64_t ternary<0x13>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A & C;
+                const uint64_t t1 = B | t0;
+                const uint64_t t2 = ~t1;
+                return t2;
+            }
+            // code=0x15, function=(C nor (B and A)), lowered=not ((C or (B and A))), set=intel
+            template<> __forceinline constexpr uint64_t ternary<0x15>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B & A;
+                const uint64_t t1 = C | t0;
+                const uint64_t t2 = ~t1;
+                return t2;
+            }
+            // code=0x17, function=((B nor C) or (not (A) and (B xor C))), lowered=(not ((B or C)) or (A notand (B xor C))), set=optimized
+            template<> __forceinline constexpr uint64_t ternary<0x17>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B | C;
+                const uint64_t t1 = ~t0;
+                const uint64_t t2 = B ^ C;
+                const uint64_t t3 = ~A & t2;
+                const uint64_t t4 = t1 | t3;
+                return t4;
+            }
+            // code=0x19, function=(not ((A and B)) and (B xor (C xor 1))), lowered=((A and B) notand (B xor (C xor 1))), set=automat
+            template<> __forceinline constexpr uint64_t ternary<0x19>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A & B;
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t1 = C ^ c1;
+                const uint64_t t2 = B ^ t1;
+                const uint64_t t3 = ~t0 & t2;
+                return t3;
+            }
+            // code=0x1a, function=(A xor (C or (A and B))), lowered=(A xor (C or (A and B))), set=superopt_sse
+            template<> __forceinline constexpr uint64_t ternary<0x1a>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A & B;
+                const uint64_t t1 = C | t0;
+                const uint64_t t2 = A ^ t1;
+                return t2;
+            }
+            // code=0x1b, function=(A xor (C or (B xor not (A)))), lowered=(A xor (C or (B xor not (A)))), set=superopt_x86
+            template<> __forceinline constexpr uint64_t ternary<0x1b>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~A;
+                const uint64_t t1 = B ^ t0;
+                const uint64_t t2 = C | t1;
+                const uint64_t t3 = A ^ t2;
+                return t3;
+            }
+            // code=0x1c, function=(A xor (B or (A and C))), lowered=(A xor (B or (A and C))), set=superopt_sse
+            template<> __forceinline constexpr uint64_t ternary<0x1c>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A & C;
+                const uint64_t t1 = B | t0;
+                const uint64_t t2 = A ^ t1;
+                return t2;
+            }
+            // code=0x1d, function=(A xor (B or (C xor not (A)))), lowered=(A xor (B or (C xor not (A)))), set=superopt_x86
+            template<> __forceinline constexpr uint64_t ternary<0x1d>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~A;
+                const uint64_t t1 = C ^ t0;
+                const uint64_t t2 = B | t1;
+                const uint64_t t3 = A ^ t2;
+                return t3;
+            }
+            // code=0x20, function=((not (B) and A) and C), lowered=((B notand A) and C), set=automat
+            template<> __forceinline constexpr uint64_t ternary<0x20>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~B & A;
+                const uint64_t t1 = t0 & C;
+                return t1;
+            }
+            // code=0x21, function=(B nor (A xor C)), lowered=not ((B or (A xor C))), set=intel
+            template<> __forceinline constexpr uint64_t ternary<0x21>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A ^ C;
+                const uint64_t t1 = B | t0;
+                const uint64_t t2 = ~t1;
+                return t2;
+            }
+            // code=0x23, function=(not ((not (C) and A)) and (B xor 1)), lowered=((C notand A) notand (B xor 1)), set=superopt_lat_sse
+            template<> __forceinline constexpr uint64_t ternary<0x23>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~C & A;
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t1 = B ^ c1;
+                const uint64_t t2 = ~t0 & t1;
+                return t2;
+            }
+            // code=0x25, function=(not ((A and B)) and (A xor (C xor 1))), lowered=((A and B) notand (A xor (C xor 1))), set=automat
+            template<> __forceinline constexpr uint64_t ternary<0x25>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A & B;
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t1 = C ^ c1;
+                const uint64_t t2 = A ^ t1;
+                const uint64_t t3 = ~t0 & t2;
+                return t3;
+            }
+            // code=0x26, function=(B xor (C or (A and B))), lowered=(B xor (C or (A and B))), set=superopt_sse
+            template<> __forceinline constexpr uint64_t ternary<0x26>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A & B;
+                const uint64_t t1 = C | t0;
+                const uint64_t t2 = B ^ t1;
+                return t2;
+            }
+            // code=0x27, function=((B and C) xor (C or (A xor 1))), lowered=((B and C) xor (C or (A xor 1))), set=superopt_lat_sse
+            template<> __forceinline constexpr uint64_t ternary<0x27>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B & C;
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t1 = A ^ c1;
+                const uint64_t t2 = C | t1;
+                const uint64_t t3 = t0 ^ t2;
+                return t3;
+            }
+            // code=0x2c, function=(A ? (not (B) and C) : B), lowered=((A and (B notand C)) or (A notand B)), set=superopt_lat_xop
+            template<> __forceinline constexpr uint64_t ternary<0x2c>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~B & C;
+                const uint64_t t1 = A & t0;
+                const uint64_t t2 = ~A & B;
+                const uint64_t t3 = t1 | t2;
+                return t3;
+            }
+            // code=0x2d, function=((A xor 1) xor (not (B) and C)), lowered=((A xor 1) xor (B notand C)), set=superopt_lat_sse
+            template<> __forceinline constexpr uint64_t ternary<0x2d>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t0 = A ^ c1;
+                const uint64_t t1 = ~B & C;
+                const uint64_t t2 = t0 ^ t1;
+                return t2;
+            }
+            // code=0x2e, function=(B ? (not (A) and B) : C), lowered=((B and (A notand B)) or (B notand C)), set=xop
+            template<> __forceinline constexpr uint64_t ternary<0x2e>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~A & B;
+                const uint64_t t1 = B & t0;
+                const uint64_t t2 = ~B & C;
+                const uint64_t t3 = t1 | t2;
+                return t3;
+            }
+            // code=0x2f, function=((A xor 1) or (not (B) and C)), lowered=((A xor 1) or (B notand C)), set=superopt_lat_sse
+            template<> __forceinline constexpr uint64_t ternary<0x2f>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t0 = A ^ c1;
+                const uint64_t t1 = ~B & C;
+                const uint64_t t2 = t0 | t1;
+                return t2;
+            }
+            // code=0x31, function=not ((B or (C and not (A)))), lowered=not ((B or (A notand C))), set=superopt_x86
+            template<> __forceinline constexpr uint64_t ternary<0x31>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~A & C;
+                const uint64_t t1 = B | t0;
+                const uint64_t t2 = ~t1;
+                return t2;
+            }
+            // code=0x33, function=(B xor 1), lowered=(B xor 1), set=superopt_lat_xop
+            template<> __forceinline constexpr uint64_t ternary<0x33>(const uint64_t, const uint64_t B, const uint64_t) noexcept {
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t0 = B ^ c1;
+                return t0;
+            }
+            // code=0x34, function=(B xor (A or (B and C))), lowered=(B xor (A or (B and C))), set=superopt_sse
+            template<> __forceinline constexpr uint64_t ternary<0x34>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B & C;
+                const uint64_t t1 = A | t0;
+                const uint64_t t2 = B ^ t1;
+                return t2;
+            }
+            // code=0x35, function=((A and B) xor (A or (C xor 1))), lowered=((A and B) xor (A or (C xor 1))), set=superopt_lat_sse
+            template<> __forceinline constexpr uint64_t ternary<0x35>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A & B;
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t1 = C ^ c1;
+                const uint64_t t2 = A | t1;
+                const uint64_t t3 = t0 ^ t2;
+                return t3;
+            }
+            // code=0x38, function=(B ? (not (A) and C) : A), lowered=((B and (A notand C)) or (B notand A)), set=superopt_lat_xop
+            template<> __forceinline constexpr uint64_t ternary<0x38>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~A & C;
+                const uint64_t t1 = B & t0;
+                const uint64_t t2 = ~B & A;
+                const uint64_t t3 = t1 | t2;
+                return t3;
+            }
+            // code=0x39, function=((not (A) and C) xor (B xor 1)), lowered=((A notand C) xor (B xor 1)), set=superopt_lat_sse
+            template<> __forceinline constexpr uint64_t ternary<0x39>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~A & C;
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t1 = B ^ c1;
+                const uint64_t t2 = t0 ^ t1;
+                return t2;
+            }
+            // code=0x3a, function=(A ? (not (B) and A) : C), lowered=((A and (B notand A)) or (A notand C)), set=xop
+            template<> __forceinline constexpr uint64_t ternary<0x3a>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~B & A;
+                const uint64_t t1 = A & t0;
+                const uint64_t t2 = ~A & C;
+                const uint64_t t3 = t1 | t2;
+                return t3;
+            }
+            // code=0x3b, function=((not (A) and C) or (B xor 1)), lowered=((A notand C) or (B xor 1)), set=superopt_lat_sse
+            template<> __forceinline constexpr uint64_t ternary<0x3b>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~A & C;
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t1 = B ^ c1;
+                const uint64_t t2 = t0 | t1;
+                return t2;
+            }
+            // code=0x3d, function=(A xor (B or not ((A or C)))), lowered=(A xor (B or not ((A or C)))), set=superopt_x86
+            template<> __forceinline constexpr uint64_t ternary<0x3d>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A | C;
+                const uint64_t t1 = ~t0;
+                const uint64_t t2 = B | t1;
+                const uint64_t t3 = A ^ t2;
+                return t3;
+            }
+            // code=0x3e, function=(A xor (B or (C and not (A)))), lowered=(A xor (B or (A notand C))), set=superopt_x86
+            template<> __forceinline constexpr uint64_t ternary<0x3e>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~A & C;
+                const uint64_t t1 = B | t0;
+                const uint64_t t2 = A ^ t1;
+                return t2;
+            }
+            // code=0x40, function=((not (C) and A) and B), lowered=((C notand A) and B), set=automat
+            template<> __forceinline constexpr uint64_t ternary<0x40>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~C & A;
+                const uint64_t t1 = t0 & B;
+                return t1;
+            }
+            // code=0x41, function=(C nor (B xor A)), lowered=not ((C or (B xor A))), set=intel
+            template<> __forceinline constexpr uint64_t ternary<0x41>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B ^ A;
+                const uint64_t t1 = C | t0;
+                const uint64_t t2 = ~t1;
+                return t2;
+            }
+            // code=0x43, function=(not ((A and C)) and (A xor (B xor 1))), lowered=((A and C) notand (A xor (B xor 1))), set=automat
+            template<> __forceinline constexpr uint64_t ternary<0x43>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A & C;
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t1 = B ^ c1;
+                const uint64_t t2 = A ^ t1;
+                const uint64_t t3 = ~t0 & t2;
+                return t3;
+            }
+            // code=0x45, function=(not ((not (B) and A)) and (C xor 1)), lowered=((B notand A) notand (C xor 1)), set=superopt_lat_sse
+            template<> __forceinline constexpr uint64_t ternary<0x45>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~B & A;
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t1 = C ^ c1;
+                const uint64_t t2 = ~t0 & t1;
+                return t2;
+            }
+            // code=0x46, function=(C xor (B or (A and C))), lowered=(C xor (B or (A and C))), set=superopt_sse
+            template<> __forceinline constexpr uint64_t ternary<0x46>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A & C;
+                const uint64_t t1 = B | t0;
+                const uint64_t t2 = C ^ t1;
+                return t2;
+            }
+            // code=0x47, function=((B and C) xor (B or (A xor 1))), lowered=((B and C) xor (B or (A xor 1))), set=superopt_lat_sse
+            template<> __forceinline constexpr uint64_t ternary<0x47>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B & C;
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t1 = A ^ c1;
+                const uint64_t t2 = B | t1;
+                const uint64_t t3 = t0 ^ t2;
+                return t3;
+            }
+            // code=0x4a, function=(A ? (not (C) and B) : C), lowered=((A and (C notand B)) or (A notand C)), set=superopt_lat_xop
+            template<> __forceinline constexpr uint64_t ternary<0x4a>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~C & B;
+                const uint64_t t1 = A & t0;
+                const uint64_t t2 = ~A & C;
+                const uint64_t t3 = t1 | t2;
+                return t3;
+            }
+            // code=0x4b, function=((A xor 1) xor (not (C) and B)), lowered=((A xor 1) xor (C notand B)), set=superopt_lat_sse
+            template<> __forceinline constexpr uint64_t ternary<0x4b>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t0 = A ^ c1;
+                const uint64_t t1 = ~C & B;
+                const uint64_t t2 = t0 ^ t1;
+                return t2;
+            }
+            // code=0x4e, function=(C ? (not (A) and C) : B), lowered=((C and (A notand C)) or (C notand B)), set=xop
+            template<> __forceinline constexpr uint64_t ternary<0x4e>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~A & C;
+                const uint64_t t1 = C & t0;
+                const uint64_t t2 = ~C & B;
+                const uint64_t t3 = t1 | t2;
+                return t3;
+            }
+            // code=0x4f, function=((A xor 1) or (not (C) and B)), lowered=((A xor 1) or (C notand B)), set=superopt_lat_sse
+            template<> __forceinline constexpr uint64_t ternary<0x4f>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t0 = A ^ c1;
+                const uint64_t t1 = ~C & B;
+                const uint64_t t2 = t0 | t1;
+                return t2;
+            }
+            // code=0x51, function=not ((C or (B and not (A)))), lowered=not ((C or (A notand B))), set=superopt_x86
+            template<> __forceinline constexpr uint64_t ternary<0x51>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~A & B;
+                const uint64_t t1 = C | t0;
+                const uint64_t t2 = ~t1;
+                return t2;
+            }
+            // code=0x52, function=(C xor (A or (B and C))), lowered=(C xor (A or (B and C))), set=superopt_sse
+            template<> __forceinline constexpr uint64_t ternary<0x52>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B & C;
+                const uint64_t t1 = A | t0;
+                const uint64_t t2 = C ^ t1;
+                return t2;
+            }
+            // code=0x53, function=((A and C) xor (A or (B xor 1))), lowered=((A and C) xor (A or (B xor 1))), set=superopt_lat_sse
+            template<> __forceinline constexpr uint64_t ternary<0x53>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A & C;
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t1 = B ^ c1;
+                const uint64_t t2 = A | t1;
+                const uint64_t t3 = t0 ^ t2;
+                return t3;
+            }
+            // code=0x55, function=(C xor 1), lowered=(C xor 1), set=superopt_lat_xop
+            template<> __forceinline constexpr uint64_t ternary<0x55>(const uint64_t, const uint64_t, const uint64_t C) noexcept {
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t0 = C ^ c1;
+                return t0;
+            }
+            // code=0x58, function=(C ? (not (A) and B) : A), lowered=((C and (A notand B)) or (C notand A)), set=superopt_lat_xop
+            template<> __forceinline constexpr uint64_t ternary<0x58>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~A & B;
+                const uint64_t t1 = C & t0;
+                const uint64_t t2 = ~C & A;
+                const uint64_t t3 = t1 | t2;
+                return t3;
+            }
+            // code=0x59, function=((not (A) and B) xor (C xor 1)), lowered=((A notand B) xor (C xor 1)), set=superopt_lat_sse
+            template<> __forceinline constexpr uint64_t ternary<0x59>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~A & B;
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t1 = C ^ c1;
+                const uint64_t t2 = t0 ^ t1;
+                return t2;
+            }
+            // code=0x5b, function=(A xor (C or not ((A or B)))), lowered=(A xor (C or not ((A or B)))), set=superopt_x86
+            template<> __forceinline constexpr uint64_t ternary<0x5b>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A | B;
+                const uint64_t t1 = ~t0;
+                const uint64_t t2 = C | t1;
+                const uint64_t t3 = A ^ t2;
+                return t3;
+            }
+            // code=0x5c, function=(A ? (not (C) and A) : B), lowered=((A and (C notand A)) or (A notand B)), set=xop
+            template<> __forceinline constexpr uint64_t ternary<0x5c>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~C & A;
+                const uint64_t t1 = A & t0;
+                const uint64_t t2 = ~A & B;
+                const uint64_t t3 = t1 | t2;
+                return t3;
+            }
+            // code=0x5d, function=((not (A) and B) or (C xor 1)), lowered=((A notand B) or (C xor 1)), set=superopt_lat_sse
+            template<> __forceinline constexpr uint64_t ternary<0x5d>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~A & B;
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t1 = C ^ c1;
+                const uint64_t t2 = t0 | t1;
+                return t2;
+            }
+            // code=0x5e, function=(A xor (C or (B and not (A)))), lowered=(A xor (C or (A notand B))), set=superopt_x86
+            template<> __forceinline constexpr uint64_t ternary<0x5e>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~A & B;
+                const uint64_t t1 = C | t0;
+                const uint64_t t2 = A ^ t1;
+                return t2;
+            }
+            // code=0x62, function=(B ? (not (C) and A) : C), lowered=((B and (C notand A)) or (B notand C)), set=superopt_lat_xop
+            template<> __forceinline constexpr uint64_t ternary<0x62>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~C & A;
+                const uint64_t t1 = B & t0;
+                const uint64_t t2 = ~B & C;
+                const uint64_t t3 = t1 | t2;
+                return t3;
+            }
+            // code=0x63, function=((B xor 1) xor (not (C) and A)), lowered=((B xor 1) xor (C notand A)), set=superopt_lat_sse
+            template<> __forceinline constexpr uint64_t ternary<0x63>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t0 = B ^ c1;
+                const uint64_t t1 = ~C & A;
+                const uint64_t t2 = t0 ^ t1;
+                return t2;
+            }
+            // code=0x64, function=(C ? (not (B) and A) : B), lowered=((C and (B notand A)) or (C notand B)), set=superopt_lat_xop
+            template<> __forceinline constexpr uint64_t ternary<0x64>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~B & A;
+                const uint64_t t1 = C & t0;
+                const uint64_t t2 = ~C & B;
+                const uint64_t t3 = t1 | t2;
+                return t3;
+            }
+            // code=0x65, function=((not (B) and A) xor (C xor 1)), lowered=((B notand A) xor (C xor 1)), set=superopt_lat_sse
+            template<> __forceinline constexpr uint64_t ternary<0x65>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~B & A;
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t1 = C ^ c1;
+                const uint64_t t2 = t0 ^ t1;
+                return t2;
+            }
+            // code=0x67, function=(B xor (C or not ((A or B)))), lowered=(B xor (C or not ((A or B)))), set=superopt_x86
+            template<> __forceinline constexpr uint64_t ternary<0x67>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A | B;
+                const uint64_t t1 = ~t0;
+                const uint64_t t2 = C | t1;
+                const uint64_t t3 = B ^ t2;
+                return t3;
+            }
+            // code=0x69, function=(A xnor (B xor C)), lowered=not ((A xor (B xor C))), set=intel
+            template<> __forceinline constexpr uint64_t ternary<0x69>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B ^ C;
+                const uint64_t t1 = A ^ t0;
+                const uint64_t t2 = ~t1;
+                return t2;
+            }
+            // code=0x6b, function=((C xor not (A)) xor (B or (C and not (A)))), lowered=((C xor not (A)) xor (B or (A notand C))), set=superopt_x86
+            template<> __forceinline constexpr uint64_t ternary<0x6b>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~A;
+                const uint64_t t1 = C ^ t0;
+                const uint64_t t2 = ~A & C;
+                const uint64_t t3 = B | t2;
+                const uint64_t t4 = t1 ^ t3;
+                return t4;
+            }
+            // code=0x6d, function=((B and not (A)) or (C xor (B or not (A)))), lowered=((A notand B) or (C xor (B or not (A)))), set=superopt_x86
+            template<> __forceinline constexpr uint64_t ternary<0x6d>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~A & B;
+                const uint64_t t1 = ~A;
+                const uint64_t t2 = B | t1;
+                const uint64_t t3 = C ^ t2;
+                const uint64_t t4 = t0 | t3;
+                return t4;
+            }
+            // code=0x72, function=(C ? (not (B) and C) : A), lowered=((C and (B notand C)) or (C notand A)), set=xop
+            template<> __forceinline constexpr uint64_t ternary<0x72>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~B & C;
+                const uint64_t t1 = C & t0;
+                const uint64_t t2 = ~C & A;
+                const uint64_t t3 = t1 | t2;
+                return t3;
+            }
+            // code=0x73, function=((B xor 1) or (not (C) and A)), lowered=((B xor 1) or (C notand A)), set=superopt_lat_sse
+            template<> __forceinline constexpr uint64_t ternary<0x73>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t0 = B ^ c1;
+                const uint64_t t1 = ~C & A;
+                const uint64_t t2 = t0 | t1;
+                return t2;
+            }
+            // code=0x74, function=(B ? (not (C) and B) : A), lowered=((B and (C notand B)) or (B notand A)), set=xop
+            template<> __forceinline constexpr uint64_t ternary<0x74>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~C & B;
+                const uint64_t t1 = B & t0;
+                const uint64_t t2 = ~B & A;
+                const uint64_t t3 = t1 | t2;
+                return t3;
+            }
+            // code=0x75, function=((not (B) and A) or (C xor 1)), lowered=((B notand A) or (C xor 1)), set=superopt_lat_sse
+            template<> __forceinline constexpr uint64_t ternary<0x75>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~B & A;
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t1 = C ^ c1;
+                const uint64_t t2 = t0 | t1;
+                return t2;
+            }
+            // code=0x76, function=(B xor (C or (A and not (B)))), lowered=(B xor (C or (B notand A))), set=superopt_x86
+            template<> __forceinline constexpr uint64_t ternary<0x76>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~B & A;
+                const uint64_t t1 = C | t0;
+                const uint64_t t2 = B ^ t1;
+                return t2;
+            }
+            // code=0x79, function=((A and not (B)) or (C xor (A or not (B)))), lowered=((B notand A) or (C xor (A or not (B)))), set=superopt_x86
+            template<> __forceinline constexpr uint64_t ternary<0x79>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~B & A;
+                const uint64_t t1 = ~B;
+                const uint64_t t2 = A | t1;
+                const uint64_t t3 = C ^ t2;
+                const uint64_t t4 = t0 | t3;
+                return t4;
+            }
+            // code=0x81, function=(not ((A xor C)) and (A xor (B xor 1))), lowered=((A xor C) notand (A xor (B xor 1))), set=automat
+            template<> __forceinline constexpr uint64_t ternary<0x81>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A ^ C;
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t1 = B ^ c1;
+                const uint64_t t2 = A ^ t1;
+                const uint64_t t3 = ~t0 & t2;
+                return t3;
+            }
+            // code=0x83, function=(not ((A xor B)) and (C or (A xor 1))), lowered=((A xor B) notand (C or (A xor 1))), set=superopt_lat_sse
+            template<> __forceinline constexpr uint64_t ternary<0x83>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A ^ B;
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t1 = A ^ c1;
+                const uint64_t t2 = C | t1;
+                const uint64_t t3 = ~t0 & t2;
+                return t3;
+            }
+            // code=0x85, function=(not ((A xor C)) and (B or (A xor 1))), lowered=((A xor C) notand (B or (A xor 1))), set=superopt_lat_sse
+            template<> __forceinline constexpr uint64_t ternary<0x85>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A ^ C;
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t1 = A ^ c1;
+                const uint64_t t2 = B | t1;
+                const uint64_t t3 = ~t0 & t2;
+                return t3;
+            }
+            // code=0x87, function=(A xnor (B and C)), lowered=not ((A xor (B and C))), set=intel
+            template<> __forceinline constexpr uint64_t ternary<0x87>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B & C;
+                const uint64_t t1 = A ^ t0;
+                const uint64_t t2 = ~t1;
+                return t2;
+            }
+            // code=0x89, function=(not (B) xor (C or (A and not (B)))), lowered=(not (B) xor (C or (B notand A))), set=superopt_x86
+            template<> __forceinline constexpr uint64_t ternary<0x89>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~B;
+                const uint64_t t1 = ~B & A;
+                const uint64_t t2 = C | t1;
+                const uint64_t t3 = t0 ^ t2;
+                return t3;
+            }
+            // code=0x8b, function=((A and not (B)) xor (C or not (B))), lowered=((B notand A) xor (C or not (B))), set=superopt_lat_x86
+            template<> __forceinline constexpr uint64_t ternary<0x8b>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~B & A;
+                const uint64_t t1 = ~B;
+                const uint64_t t2 = C | t1;
+                const uint64_t t3 = t0 ^ t2;
+                return t3;
+            }
+            // code=0x8d, function=(C ? B : (A xor 1)), lowered=((C and B) or (C notand (A xor 1))), set=superopt_lat_xop
+            template<> __forceinline constexpr uint64_t ternary<0x8d>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = C & B;
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t1 = A ^ c1;
+                const uint64_t t2 = ~C & t1;
+                const uint64_t t3 = t0 | t2;
+                return t3;
+            }
+            // code=0x8e, function=((not (A) and (B or C)) or (B and C)), lowered=((A notand (B or C)) or (B and C)), set=superopt_lat_bmi
+            template<> __forceinline constexpr uint64_t ternary<0x8e>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B | C;
+                const uint64_t t1 = ~A & t0;
+                const uint64_t t2 = B & C;
+                const uint64_t t3 = t1 | t2;
+                return t3;
+            }
+            // code=0x91, function=(not ((B xor C)) and (A or (B xor 1))), lowered=((B xor C) notand (A or (B xor 1))), set=superopt_lat_sse
+            template<> __forceinline constexpr uint64_t ternary<0x91>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B ^ C;
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t1 = B ^ c1;
+                const uint64_t t2 = A | t1;
+                const uint64_t t3 = ~t0 & t2;
+                return t3;
+            }
+            // code=0x93, function=(B xnor (A and C)), lowered=not ((B xor (A and C))), set=intel
+            template<> __forceinline constexpr uint64_t ternary<0x93>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A & C;
+                const uint64_t t1 = B ^ t0;
+                const uint64_t t2 = ~t1;
+                return t2;
+            }
+            // code=0x95, function=(C xnor (B and A)), lowered=not ((C xor (B and A))), set=intel
+            template<> __forceinline constexpr uint64_t ternary<0x95>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B & A;
+                const uint64_t t1 = C ^ t0;
+                const uint64_t t2 = ~t1;
+                return t2;
+            }
+            // code=0x97, function=(not ((A and B)) xor (C and (A or B))), lowered=(not ((A and B)) xor (C and (A or B))), set=superopt_x86
+            template<> __forceinline constexpr uint64_t ternary<0x97>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A & B;
+                const uint64_t t1 = ~t0;
+                const uint64_t t2 = A | B;
+                const uint64_t t3 = C & t2;
+                const uint64_t t4 = t1 ^ t3;
+                return t4;
+            }
+            // code=0x9b, function=((not (A) and C) or (B xor (C xor 1))), lowered=((A notand C) or (B xor (C xor 1))), set=automat
+            template<> __forceinline constexpr uint64_t ternary<0x9b>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~A & C;
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t1 = C ^ c1;
+                const uint64_t t2 = B ^ t1;
+                const uint64_t t3 = t0 | t2;
+                return t3;
+            }
+            // code=0x9d, function=((not (A) and B) or (B xor (C xor 1))), lowered=((A notand B) or (B xor (C xor 1))), set=automat
+            template<> __forceinline constexpr uint64_t ternary<0x9d>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~A & B;
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t1 = C ^ c1;
+                const uint64_t t2 = B ^ t1;
+                const uint64_t t3 = t0 | t2;
+                return t3;
+            }
+            // code=0xa1, function=(not (A) xor (C or (B and not (A)))), lowered=(not (A) xor (C or (A notand B))), set=superopt_bmi
+            template<> __forceinline constexpr uint64_t ternary<0xa1>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~A;
+                const uint64_t t1 = ~A & B;
+                const uint64_t t2 = C | t1;
+                const uint64_t t3 = t0 ^ t2;
+                return t3;
+            }
+            // code=0xa3, function=((B and not (A)) xor (C or not (A))), lowered=((A notand B) xor (C or not (A))), set=superopt_x86
+            template<> __forceinline constexpr uint64_t ternary<0xa3>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~A & B;
+                const uint64_t t1 = ~A;
+                const uint64_t t2 = C | t1;
+                const uint64_t t3 = t0 ^ t2;
+                return t3;
+            }
+            // code=0xa7, function=((not (B) and C) or (A xor (C xor 1))), lowered=((B notand C) or (A xor (C xor 1))), set=automat
+            template<> __forceinline constexpr uint64_t ternary<0xa7>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~B & C;
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t1 = C ^ c1;
+                const uint64_t t2 = A ^ t1;
+                const uint64_t t3 = t0 | t2;
+                return t3;
+            }
+            // code=0xa9, function=(C xnor (B or A)), lowered=not ((C xor (B or A))), set=intel
+            template<> __forceinline constexpr uint64_t ternary<0xa9>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B | A;
+                const uint64_t t1 = C ^ t0;
+                const uint64_t t2 = ~t1;
+                return t2;
+            }
+            // code=0xad, function=((B and C) or (A xor (C xor 1))), lowered=((B and C) or (A xor (C xor 1))), set=automat
+            template<> __forceinline constexpr uint64_t ternary<0xad>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B & C;
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t1 = C ^ c1;
+                const uint64_t t2 = A ^ t1;
+                const uint64_t t3 = t0 | t2;
+                return t3;
+            }
+            // code=0xaf, function=(C or (A xor 1)), lowered=(C or (A xor 1)), set=superopt_lat_sse
+            template<> __forceinline constexpr uint64_t ternary<0xaf>(const uint64_t A, const uint64_t, const uint64_t C) noexcept {
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t0 = A ^ c1;
+                const uint64_t t1 = C | t0;
+                return t1;
+            }
+            // code=0xb1, function=(C ? A : (B xor 1)), lowered=((C and A) or (C notand (B xor 1))), set=superopt_lat_xop
+            template<> __forceinline constexpr uint64_t ternary<0xb1>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = C & A;
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t1 = B ^ c1;
+                const uint64_t t2 = ~C & t1;
+                const uint64_t t3 = t0 | t2;
+                return t3;
+            }
+            // code=0xb2, function=((not (B) and (A or C)) or (A and C)), lowered=((B notand (A or C)) or (A and C)), set=superopt_lat_bmi
+            template<> __forceinline constexpr uint64_t ternary<0xb2>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A | C;
+                const uint64_t t1 = ~B & t0;
+                const uint64_t t2 = A & C;
+                const uint64_t t3 = t1 | t2;
+                return t3;
+            }
+            // code=0xb5, function=((not (B) and A) or (A xor (C xor 1))), lowered=((B notand A) or (A xor (C xor 1))), set=automat
+            template<> __forceinline constexpr uint64_t ternary<0xb5>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~B & A;
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t1 = C ^ c1;
+                const uint64_t t2 = A ^ t1;
+                const uint64_t t3 = t0 | t2;
+                return t3;
+            }
+            // code=0xb9, function=((B xnor C) or (A and not (B))), lowered=(not ((B xor C)) or (B notand A)), set=optimized
+            template<> __forceinline constexpr uint64_t ternary<0xb9>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B ^ C;
+                const uint64_t t1 = ~t0;
+                const uint64_t t2 = ~B & A;
+                const uint64_t t3 = t1 | t2;
+                return t3;
+            }
+            // code=0xbb, function=(C or (B xor 1)), lowered=(C or (B xor 1)), set=superopt_lat_sse
+            template<> __forceinline constexpr uint64_t ternary<0xbb>(const uint64_t, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t0 = B ^ c1;
+                const uint64_t t1 = C | t0;
+                return t1;
+            }
+            // code=0xbd, function=((A xor B) or (A xor (C xor 1))), lowered=((A xor B) or (A xor (C xor 1))), set=automat
+            template<> __forceinline constexpr uint64_t ternary<0xbd>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A ^ B;
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t1 = C ^ c1;
+                const uint64_t t2 = A ^ t1;
+                const uint64_t t3 = t0 | t2;
+                return t3;
+            }
+            // code=0xc1, function=(not (A) xor (B or (C and not (A)))), lowered=(not (A) xor (B or (A notand C))), set=superopt_bmi
+            template<> __forceinline constexpr uint64_t ternary<0xc1>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~A;
+                const uint64_t t1 = ~A & C;
+                const uint64_t t2 = B | t1;
+                const uint64_t t3 = t0 ^ t2;
+                return t3;
+            }
+            // code=0xc5, function=((C and not (A)) xor (B or not (A))), lowered=((A notand C) xor (B or not (A))), set=superopt_x86
+            template<> __forceinline constexpr uint64_t ternary<0xc5>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~A & C;
+                const uint64_t t1 = ~A;
+                const uint64_t t2 = B | t1;
+                const uint64_t t3 = t0 ^ t2;
+                return t3;
+            }
+            // code=0xc7, function=((not (C) and B) or (A xor (B xor 1))), lowered=((C notand B) or (A xor (B xor 1))), set=automat
+            template<> __forceinline constexpr uint64_t ternary<0xc7>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~C & B;
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t1 = B ^ c1;
+                const uint64_t t2 = A ^ t1;
+                const uint64_t t3 = t0 | t2;
+                return t3;
+            }
+            // code=0xc9, function=(B xnor (A or C)), lowered=not ((B xor (A or C))), set=intel
+            template<> __forceinline constexpr uint64_t ternary<0xc9>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A | C;
+                const uint64_t t1 = B ^ t0;
+                const uint64_t t2 = ~t1;
+                return t2;
+            }
+            // code=0xcb, function=((B and C) or (A xor (B xor 1))), lowered=((B and C) or (A xor (B xor 1))), set=automat
+            template<> __forceinline constexpr uint64_t ternary<0xcb>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B & C;
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t1 = B ^ c1;
+                const uint64_t t2 = A ^ t1;
+                const uint64_t t3 = t0 | t2;
+                return t3;
+            }
+            // code=0xcf, function=(B or (A xor 1)), lowered=(B or (A xor 1)), set=superopt_lat_sse
+            template<> __forceinline constexpr uint64_t ternary<0xcf>(const uint64_t A, const uint64_t B, const uint64_t) noexcept {
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t0 = A ^ c1;
+                const uint64_t t1 = B | t0;
+                return t1;
+            }
+            // code=0xd1, function=(B ? A : (C xor 1)), lowered=((B and A) or (B notand (C xor 1))), set=superopt_lat_xop
+            template<> __forceinline constexpr uint64_t ternary<0xd1>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B & A;
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t1 = C ^ c1;
+                const uint64_t t2 = ~B & t1;
+                const uint64_t t3 = t0 | t2;
+                return t3;
+            }
+            // code=0xd3, function=((not (C) and A) or (A xor (B xor 1))), lowered=((C notand A) or (A xor (B xor 1))), set=automat
+            template<> __forceinline constexpr uint64_t ternary<0xd3>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~C & A;
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t1 = B ^ c1;
+                const uint64_t t2 = A ^ t1;
+                const uint64_t t3 = t0 | t2;
+                return t3;
+            }
+            // code=0xd4, function=((B and not (C)) or (A and (B xnor C))), lowered=((C notand B) or ((B xor C) notand A)), set=optimized
+            template<> __forceinline constexpr uint64_t ternary<0xd4>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~C & B;
+                const uint64_t t1 = B ^ C;
+                const uint64_t t2 = ~t1 & A;
+                const uint64_t t3 = t0 | t2;
+                return t3;
+            }
+            // code=0xd9, function=((A and B) or (B xor (C xor 1))), lowered=((A and B) or (B xor (C xor 1))), set=automat
+            template<> __forceinline constexpr uint64_t ternary<0xd9>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A & B;
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t1 = C ^ c1;
+                const uint64_t t2 = B ^ t1;
+                const uint64_t t3 = t0 | t2;
+                return t3;
+            }
+            // code=0xdb, function=((A xor C) or (A xor (B xor 1))), lowered=((A xor C) or (A xor (B xor 1))), set=automat
+            template<> __forceinline constexpr uint64_t ternary<0xdb>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A ^ C;
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t1 = B ^ c1;
+                const uint64_t t2 = A ^ t1;
+                const uint64_t t3 = t0 | t2;
+                return t3;
+            }
+            // code=0xdd, function=(B or (C xor 1)), lowered=(B or (C xor 1)), set=superopt_lat_sse
+            template<> __forceinline constexpr uint64_t ternary<0xdd>(const uint64_t, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t0 = C ^ c1;
+                const uint64_t t1 = B | t0;
+                return t1;
+            }
+            // code=0xe1, function=(A xnor (B or C)), lowered=not ((A xor (B or C))), set=intel
+            template<> __forceinline constexpr uint64_t ternary<0xe1>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B | C;
+                const uint64_t t1 = A ^ t0;
+                const uint64_t t2 = ~t1;
+                return t2;
+            }
+            // code=0xe3, function=((A and C) or (A xor (B xor 1))), lowered=((A and C) or (A xor (B xor 1))), set=automat
+            template<> __forceinline constexpr uint64_t ternary<0xe3>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A & C;
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t1 = B ^ c1;
+                const uint64_t t2 = A ^ t1;
+                const uint64_t t3 = t0 | t2;
+                return t3;
+            }
+            // code=0xe5, function=((A and B) or (A xor (C xor 1))), lowered=((A and B) or (A xor (C xor 1))), set=automat
+            template<> __forceinline constexpr uint64_t ternary<0xe5>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A & B;
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t1 = C ^ c1;
+                const uint64_t t2 = A ^ t1;
+                const uint64_t t3 = t0 | t2;
+                return t3;
+            }
+            // code=0xe7, function=((B xor C) or (A xor (B xor 1))), lowered=((B xor C) or (A xor (B xor 1))), set=automat
+            template<> __forceinline constexpr uint64_t ternary<0xe7>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B ^ C;
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t1 = B ^ c1;
+                const uint64_t t2 = A ^ t1;
+                const uint64_t t3 = t0 | t2;
+                return t3;
+            }
+            // code=0xe8, function=((C and (A or B)) or (A and B)), lowered=((C and (A or B)) or (A and B)), set=superopt_lat_bmi
+            template<> __forceinline constexpr uint64_t ternary<0xe8>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A | B;
+                const uint64_t t1 = C & t0;
+                const uint64_t t2 = A & B;
+                const uint64_t t3 = t1 | t2;
+                return t3;
+            }
+            // code=0xef, function=(B or ((A xor 1) or C)), lowered=(B or ((A xor 1) or C)), set=automat
+            template<> __forceinline constexpr uint64_t ternary<0xef>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t0 = A ^ c1;
+                const uint64_t t1 = t0 | C;
+                const uint64_t t2 = B | t1;
+                return t2;
+            }
+            // code=0xf3, function=(A or (B xor 1)), lowered=(A or (B xor 1)), set=superopt_lat_sse
+            template<> __forceinline constexpr uint64_t ternary<0xf3>(const uint64_t A, const uint64_t B, const uint64_t) noexcept {
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t0 = B ^ c1;
+                const uint64_t t1 = A | t0;
+                return t1;
+            }
+            // code=0xf5, function=(A or (C xor 1)), lowered=(A or (C xor 1)), set=superopt_lat_sse
+            template<> __forceinline constexpr uint64_t ternary<0xf5>(const uint64_t A, const uint64_t, const uint64_t C) noexcept {
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t0 = C ^ c1;
+                const uint64_t t1 = A | t0;
+                return t1;
+            }
+            // code=0xfb, function=(A or ((B xor 1) or C)), lowered=(A or ((B xor 1) or C)), set=automat
+            template<> __forceinline constexpr uint64_t ternary<0xfb>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t0 = B ^ c1;
+                const uint64_t t1 = t0 | C;
+                const uint64_t t2 = A | t1;
+                return t2;
+            }
+            // code=0xfd, function=(A or (B or (C xor 1))), lowered=(A or (B or (C xor 1))), set=automat
+            template<> __forceinline constexpr uint64_t ternary<0xfd>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t0 = C ^ c1;
+                const uint64_t t1 = B | t0;
+                const uint64_t t2 = A | t1;
+                return t2;
+            }
+
+            template<unsigned k> __forceinline constexpr uint64_t ternary_lat(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                return x86_64_bmi::ternary_lat<k>(A, B, C);
+            }
+
+            // code=0x08, function=((not (A) and B) and C), lowered=((A notand B) and C), set=automat
+            template<> __forceinline constexpr uint64_t ternary_lat<0x08>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~A & B;
+                const uint64_t t1 = t0 & C;
+                return t1;
+            }
+            // code=0x0b, function=(not ((not (C) and B)) and (A xor 1)), lowered=((C notand B) notand (A xor 1)), set=superopt_lat_sse
+            template<> __forceinline constexpr uint64_t ternary_lat<0x0b>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~C & B;
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t1 = A ^ c1;
+                const uint64_t t2 = ~t0 & t1;
+                return t2;
+            }
+            // code=0x0d, function=(not ((not (B) and C)) and (A xor 1)), lowered=((B notand C) notand (A xor 1)), set=superopt_lat_sse
+            template<> __forceinline constexpr uint64_t ternary_lat<0x0d>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~B & C;
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t1 = A ^ c1;
+                const uint64_t t2 = ~t0 & t1;
+                return t2;
+            }
+            // code=0x0f, function=(A xor 1), lowered=(A xor 1), set=superopt_lat_xop
+            template<> __forceinline constexpr uint64_t ternary_lat<0x0f>(const uint64_t A, const uint64_t, const uint64_t) noexcept {
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t0 = A ^ c1;
+                return t0;
+            }
+            // code=0x17, function=((B nor C) or (not (A) and (B xor C))), lowered=(not ((B or C)) or (A notand (B xor C))), set=optimized
+            template<> __forceinline constexpr uint64_t ternary_lat<0x17>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B | C;
+                const uint64_t t1 = ~t0;
+                const uint64_t t2 = B ^ C;
+                const uint64_t t3 = ~A & t2;
+                const uint64_t t4 = t1 | t3;
+                return t4;
+            }
+            // code=0x19, function=(not ((A and B)) and (B xor (C xor 1))), lowered=((A and B) notand (B xor (C xor 1))), set=automat
+            template<> __forceinline constexpr uint64_t ternary_lat<0x19>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A & B;
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t1 = C ^ c1;
+                const uint64_t t2 = B ^ t1;
+                const uint64_t t3 = ~t0 & t2;
+                return t3;
+            }
+            // code=0x1b, function=((A and C) xor (C or (B xor 1))), lowered=((A and C) xor (C or (B xor 1))), set=superopt_lat_sse
+            template<> __forceinline constexpr uint64_t ternary_lat<0x1b>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A & C;
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t1 = B ^ c1;
+                const uint64_t t2 = C | t1;
+                const uint64_t t3 = t0 ^ t2;
+                return t3;
+            }
+            // code=0x1d, function=((A and B) xor (B or (C xor 1))), lowered=((A and B) xor (B or (C xor 1))), set=superopt_lat_sse
+            template<> __forceinline constexpr uint64_t ternary_lat<0x1d>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A & B;
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t1 = C ^ c1;
+                const uint64_t t2 = B | t1;
+                const uint64_t t3 = t0 ^ t2;
+                return t3;
+            }
+            // code=0x20, function=((not (B) and A) and C), lowered=((B notand A) and C), set=automat
+            template<> __forceinline constexpr uint64_t ternary_lat<0x20>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~B & A;
+                const uint64_t t1 = t0 & C;
+                return t1;
+            }
+            // code=0x23, function=(not ((not (C) and A)) and (B xor 1)), lowered=((C notand A) notand (B xor 1)), set=superopt_lat_sse
+            template<> __forceinline constexpr uint64_t ternary_lat<0x23>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~C & A;
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t1 = B ^ c1;
+                const uint64_t t2 = ~t0 & t1;
+                return t2;
+            }
+            // code=0x25, function=(not ((A and B)) and (A xor (C xor 1))), lowered=((A and B) notand (A xor (C xor 1))), set=automat
+            template<> __forceinline constexpr uint64_t ternary_lat<0x25>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A & B;
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t1 = C ^ c1;
+                const uint64_t t2 = A ^ t1;
+                const uint64_t t3 = ~t0 & t2;
+                return t3;
+            }
+            // code=0x27, function=((B and C) xor (C or (A xor 1))), lowered=((B and C) xor (C or (A xor 1))), set=superopt_lat_sse
+            template<> __forceinline constexpr uint64_t ternary_lat<0x27>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B & C;
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t1 = A ^ c1;
+                const uint64_t t2 = C | t1;
+                const uint64_t t3 = t0 ^ t2;
+                return t3;
+            }
+            // code=0x2c, function=(A ? (not (B) and C) : B), lowered=((A and (B notand C)) or (A notand B)), set=superopt_lat_xop
+            template<> __forceinline constexpr uint64_t ternary_lat<0x2c>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~B & C;
+                const uint64_t t1 = A & t0;
+                const uint64_t t2 = ~A & B;
+                const uint64_t t3 = t1 | t2;
+                return t3;
+            }
+            // code=0x2d, function=((A xor 1) xor (not (B) and C)), lowered=((A xor 1) xor (B notand C)), set=superopt_lat_sse
+            template<> __forceinline constexpr uint64_t ternary_lat<0x2d>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t0 = A ^ c1;
+                const uint64_t t1 = ~B & C;
+                const uint64_t t2 = t0 ^ t1;
+                return t2;
+            }
+            // code=0x2e, function=(B ? (not (A) and B) : C), lowered=((B and (A notand B)) or (B notand C)), set=xop
+            template<> __forceinline constexpr uint64_t ternary_lat<0x2e>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~A & B;
+                const uint64_t t1 = B & t0;
+                const uint64_t t2 = ~B & C;
+                const uint64_t t3 = t1 | t2;
+                return t3;
+            }
+            // code=0x2f, function=((A xor 1) or (not (B) and C)), lowered=((A xor 1) or (B notand C)), set=superopt_lat_sse
+            template<> __forceinline constexpr uint64_t ternary_lat<0x2f>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t0 = A ^ c1;
+                const uint64_t t1 = ~B & C;
+                const uint64_t t2 = t0 | t1;
+                return t2;
+            }
+            // code=0x31, function=(not ((not (A) and C)) and (B xor 1)), lowered=((A notand C) notand (B xor 1)), set=superopt_lat_sse
+            template<> __forceinline constexpr uint64_t ternary_lat<0x31>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~A & C;
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t1 = B ^ c1;
+                const uint64_t t2 = ~t0 & t1;
+                return t2;
+            }
+            // code=0x33, function=(B xor 1), lowered=(B xor 1), set=superopt_lat_xop
+            template<> __forceinline constexpr uint64_t ternary_lat<0x33>(const uint64_t, const uint64_t B, const uint64_t) noexcept {
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t0 = B ^ c1;
+                return t0;
+            }
+            // code=0x35, function=((A and B) xor (A or (C xor 1))), lowered=((A and B) xor (A or (C xor 1))), set=superopt_lat_sse
+            template<> __forceinline constexpr uint64_t ternary_lat<0x35>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A & B;
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t1 = C ^ c1;
+                const uint64_t t2 = A | t1;
+                const uint64_t t3 = t0 ^ t2;
+                return t3;
+            }
+            // code=0x38, function=(B ? (not (A) and C) : A), lowered=((B and (A notand C)) or (B notand A)), set=superopt_lat_xop
+            template<> __forceinline constexpr uint64_t ternary_lat<0x38>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~A & C;
+                const uint64_t t1 = B & t0;
+                const uint64_t t2 = ~B & A;
+                const uint64_t t3 = t1 | t2;
+                return t3;
+            }
+            // code=0x39, function=((not (A) and C) xor (B xor 1)), lowered=((A notand C) xor (B xor 1)), set=superopt_lat_sse
+            template<> __forceinline constexpr uint64_t ternary_lat<0x39>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~A & C;
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t1 = B ^ c1;
+                const uint64_t t2 = t0 ^ t1;
+                return t2;
+            }
+            // code=0x3a, function=(A ? (not (B) and A) : C), lowered=((A and (B notand A)) or (A notand C)), set=xop
+            template<> __forceinline constexpr uint64_t ternary_lat<0x3a>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~B & A;
+                const uint64_t t1 = A & t0;
+                const uint64_t t2 = ~A & C;
+                const uint64_t t3 = t1 | t2;
+                return t3;
+            }
+            // code=0x3b, function=((not (A) and C) or (B xor 1)), lowered=((A notand C) or (B xor 1)), set=superopt_lat_sse
+            template<> __forceinline constexpr uint64_t ternary_lat<0x3b>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~A & C;
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t1 = B ^ c1;
+                const uint64_t t2 = t0 | t1;
+                return t2;
+            }
+            // code=0x3e, function=(A xor (B or (C and not (A)))), lowered=(A xor (B or (A notand C))), set=superopt_x86
+            template<> __forceinline constexpr uint64_t ternary_lat<0x3e>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~A & C;
+                const uint64_t t1 = B | t0;
+                const uint64_t t2 = A ^ t1;
+                return t2;
+            }
+            // code=0x40, function=((not (C) and A) and B), lowered=((C notand A) and B), set=automat
+            template<> __forceinline constexpr uint64_t ternary_lat<0x40>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~C & A;
+                const uint64_t t1 = t0 & B;
+                return t1;
+            }
+            // code=0x43, function=(not ((A and C)) and (A xor (B xor 1))), lowered=((A and C) notand (A xor (B xor 1))), set=automat
+            template<> __forceinline constexpr uint64_t ternary_lat<0x43>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A & C;
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t1 = B ^ c1;
+                const uint64_t t2 = A ^ t1;
+                const uint64_t t3 = ~t0 & t2;
+                return t3;
+            }
+            // code=0x45, function=(not ((not (B) and A)) and (C xor 1)), lowered=((B notand A) notand (C xor 1)), set=superopt_lat_sse
+            template<> __forceinline constexpr uint64_t ternary_lat<0x45>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~B & A;
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t1 = C ^ c1;
+                const uint64_t t2 = ~t0 & t1;
+                return t2;
+            }
+            // code=0x47, function=((B and C) xor (B or (A xor 1))), lowered=((B and C) xor (B or (A xor 1))), set=superopt_lat_sse
+            template<> __forceinline constexpr uint64_t ternary_lat<0x47>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B & C;
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t1 = A ^ c1;
+                const uint64_t t2 = B | t1;
+                const uint64_t t3 = t0 ^ t2;
+                return t3;
+            }
+            // code=0x4a, function=(A ? (not (C) and B) : C), lowered=((A and (C notand B)) or (A notand C)), set=superopt_lat_xop
+            template<> __forceinline constexpr uint64_t ternary_lat<0x4a>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~C & B;
+                const uint64_t t1 = A & t0;
+                const uint64_t t2 = ~A & C;
+                const uint64_t t3 = t1 | t2;
+                return t3;
+            }
+            // code=0x4b, function=((A xor 1) xor (not (C) and B)), lowered=((A xor 1) xor (C notand B)), set=superopt_lat_sse
+            template<> __forceinline constexpr uint64_t ternary_lat<0x4b>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t0 = A ^ c1;
+                const uint64_t t1 = ~C & B;
+                const uint64_t t2 = t0 ^ t1;
+                return t2;
+            }
+            // code=0x4e, function=(C ? (not (A) and C) : B), lowered=((C and (A notand C)) or (C notand B)), set=xop
+            template<> __forceinline constexpr uint64_t ternary_lat<0x4e>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~A & C;
+                const uint64_t t1 = C & t0;
+                const uint64_t t2 = ~C & B;
+                const uint64_t t3 = t1 | t2;
+                return t3;
+            }
+            // code=0x4f, function=((A xor 1) or (not (C) and B)), lowered=((A xor 1) or (C notand B)), set=superopt_lat_sse
+            template<> __forceinline constexpr uint64_t ternary_lat<0x4f>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t0 = A ^ c1;
+                const uint64_t t1 = ~C & B;
+                const uint64_t t2 = t0 | t1;
+                return t2;
+            }
+            // code=0x51, function=(not ((not (A) and B)) and (C xor 1)), lowered=((A notand B) notand (C xor 1)), set=superopt_lat_sse
+            template<> __forceinline constexpr uint64_t ternary_lat<0x51>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~A & B;
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t1 = C ^ c1;
+                const uint64_t t2 = ~t0 & t1;
+                return t2;
+            }
+            // code=0x53, function=((A and C) xor (A or (B xor 1))), lowered=((A and C) xor (A or (B xor 1))), set=superopt_lat_sse
+            template<> __forceinline constexpr uint64_t ternary_lat<0x53>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A & C;
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t1 = B ^ c1;
+                const uint64_t t2 = A | t1;
+                const uint64_t t3 = t0 ^ t2;
+                return t3;
+            }
+            // code=0x55, function=(C xor 1), lowered=(C xor 1), set=superopt_lat_xop
+            template<> __forceinline constexpr uint64_t ternary_lat<0x55>(const uint64_t, const uint64_t, const uint64_t C) noexcept {
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t0 = C ^ c1;
+                return t0;
+            }
+            // code=0x58, function=(C ? (not (A) and B) : A), lowered=((C and (A notand B)) or (C notand A)), set=superopt_lat_xop
+            template<> __forceinline constexpr uint64_t ternary_lat<0x58>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~A & B;
+                const uint64_t t1 = C & t0;
+                const uint64_t t2 = ~C & A;
+                const uint64_t t3 = t1 | t2;
+                return t3;
+            }
+            // code=0x59, function=((not (A) and B) xor (C xor 1)), lowered=((A notand B) xor (C xor 1)), set=superopt_lat_sse
+            template<> __forceinline constexpr uint64_t ternary_lat<0x59>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~A & B;
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t1 = C ^ c1;
+                const uint64_t t2 = t0 ^ t1;
+                return t2;
+            }
+            // code=0x5c, function=(A ? (not (C) and A) : B), lowered=((A and (C notand A)) or (A notand B)), set=xop
+            template<> __forceinline constexpr uint64_t ternary_lat<0x5c>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~C & A;
+                const uint64_t t1 = A & t0;
+                const uint64_t t2 = ~A & B;
+                const uint64_t t3 = t1 | t2;
+                return t3;
+            }
+            // code=0x5d, function=((not (A) and B) or (C xor 1)), lowered=((A notand B) or (C xor 1)), set=superopt_lat_sse
+            template<> __forceinline constexpr uint64_t ternary_lat<0x5d>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~A & B;
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t1 = C ^ c1;
+                const uint64_t t2 = t0 | t1;
+                return t2;
+            }
+            // code=0x5e, function=(A xor (C or (B and not (A)))), lowered=(A xor (C or (A notand B))), set=superopt_x86
+            template<> __forceinline constexpr uint64_t ternary_lat<0x5e>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~A & B;
+                const uint64_t t1 = C | t0;
+                const uint64_t t2 = A ^ t1;
+                return t2;
+            }
+            // code=0x62, function=(B ? (not (C) and A) : C), lowered=((B and (C notand A)) or (B notand C)), set=superopt_lat_xop
+            template<> __forceinline constexpr uint64_t ternary_lat<0x62>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~C & A;
+                const uint64_t t1 = B & t0;
+                const uint64_t t2 = ~B & C;
+                const uint64_t t3 = t1 | t2;
+                return t3;
+            }
+            // code=0x63, function=((B xor 1) xor (not (C) and A)), lowered=((B xor 1) xor (C notand A)), set=superopt_lat_sse
+            template<> __forceinline constexpr uint64_t ternary_lat<0x63>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t0 = B ^ c1;
+                const uint64_t t1 = ~C & A;
+                const uint64_t t2 = t0 ^ t1;
+                return t2;
+            }
+            // code=0x64, function=(C ? (not (B) and A) : B), lowered=((C and (B notand A)) or (C notand B)), set=superopt_lat_xop
+            template<> __forceinline constexpr uint64_t ternary_lat<0x64>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~B & A;
+                const uint64_t t1 = C & t0;
+                const uint64_t t2 = ~C & B;
+                const uint64_t t3 = t1 | t2;
+                return t3;
+            }
+            // code=0x65, function=((not (B) and A) xor (C xor 1)), lowered=((B notand A) xor (C xor 1)), set=superopt_lat_sse
+            template<> __forceinline constexpr uint64_t ternary_lat<0x65>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~B & A;
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t1 = C ^ c1;
+                const uint64_t t2 = t0 ^ t1;
+                return t2;
+            }
+            // code=0x6b, function=((C xor not (A)) xor (B or (C and not (A)))), lowered=((C xor not (A)) xor (B or (A notand C))), set=superopt_x86
+            template<> __forceinline constexpr uint64_t ternary_lat<0x6b>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~A;
+                const uint64_t t1 = C ^ t0;
+                const uint64_t t2 = ~A & C;
+                const uint64_t t3 = B | t2;
+                const uint64_t t4 = t1 ^ t3;
+                return t4;
+            }
+            // code=0x72, function=(C ? (not (B) and C) : A), lowered=((C and (B notand C)) or (C notand A)), set=xop
+            template<> __forceinline constexpr uint64_t ternary_lat<0x72>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~B & C;
+                const uint64_t t1 = C & t0;
+                const uint64_t t2 = ~C & A;
+                const uint64_t t3 = t1 | t2;
+                return t3;
+            }
+            // code=0x73, function=((B xor 1) or (not (C) and A)), lowered=((B xor 1) or (C notand A)), set=superopt_lat_sse
+            template<> __forceinline constexpr uint64_t ternary_lat<0x73>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t0 = B ^ c1;
+                const uint64_t t1 = ~C & A;
+                const uint64_t t2 = t0 | t1;
+                return t2;
+            }
+            // code=0x74, function=(B ? (not (C) and B) : A), lowered=((B and (C notand B)) or (B notand A)), set=xop
+            template<> __forceinline constexpr uint64_t ternary_lat<0x74>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~C & B;
+                const uint64_t t1 = B & t0;
+                const uint64_t t2 = ~B & A;
+                const uint64_t t3 = t1 | t2;
+                return t3;
+            }
+            // code=0x75, function=((not (B) and A) or (C xor 1)), lowered=((B notand A) or (C xor 1)), set=superopt_lat_sse
+            template<> __forceinline constexpr uint64_t ternary_lat<0x75>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~B & A;
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t1 = C ^ c1;
+                const uint64_t t2 = t0 | t1;
+                return t2;
+            }
+            // code=0x76, function=(B xor (C or (A and not (B)))), lowered=(B xor (C or (B notand A))), set=superopt_x86
+            template<> __forceinline constexpr uint64_t ternary_lat<0x76>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~B & A;
+                const uint64_t t1 = C | t0;
+                const uint64_t t2 = B ^ t1;
+                return t2;
+            }
+            // code=0x81, function=(not ((A xor C)) and (A xor (B xor 1))), lowered=((A xor C) notand (A xor (B xor 1))), set=automat
+            template<> __forceinline constexpr uint64_t ternary_lat<0x81>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A ^ C;
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t1 = B ^ c1;
+                const uint64_t t2 = A ^ t1;
+                const uint64_t t3 = ~t0 & t2;
+                return t3;
+            }
+            // code=0x83, function=(not ((A xor B)) and (C or (A xor 1))), lowered=((A xor B) notand (C or (A xor 1))), set=superopt_lat_sse
+            template<> __forceinline constexpr uint64_t ternary_lat<0x83>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A ^ B;
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t1 = A ^ c1;
+                const uint64_t t2 = C | t1;
+                const uint64_t t3 = ~t0 & t2;
+                return t3;
+            }
+            // code=0x85, function=(not ((A xor C)) and (B or (A xor 1))), lowered=((A xor C) notand (B or (A xor 1))), set=superopt_lat_sse
+            template<> __forceinline constexpr uint64_t ternary_lat<0x85>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A ^ C;
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t1 = A ^ c1;
+                const uint64_t t2 = B | t1;
+                const uint64_t t3 = ~t0 & t2;
+                return t3;
+            }
+            // code=0x89, function=(not (B) xor (C or (A and not (B)))), lowered=(not (B) xor (C or (B notand A))), set=superopt_x86
+            template<> __forceinline constexpr uint64_t ternary_lat<0x89>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~B;
+                const uint64_t t1 = ~B & A;
+                const uint64_t t2 = C | t1;
+                const uint64_t t3 = t0 ^ t2;
+                return t3;
+            }
+            // code=0x8b, function=(B ? C : (A xor 1)), lowered=((B and C) or (B notand (A xor 1))), set=superopt_lat_xop
+            template<> __forceinline constexpr uint64_t ternary_lat<0x8b>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B & C;
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t1 = A ^ c1;
+                const uint64_t t2 = ~B & t1;
+                const uint64_t t3 = t0 | t2;
+                return t3;
+            }
+            // code=0x8d, function=(C ? B : (A xor 1)), lowered=((C and B) or (C notand (A xor 1))), set=superopt_lat_xop
+            template<> __forceinline constexpr uint64_t ternary_lat<0x8d>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = C & B;
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t1 = A ^ c1;
+                const uint64_t t2 = ~C & t1;
+                const uint64_t t3 = t0 | t2;
+                return t3;
+            }
+            // code=0x8e, function=((not (A) and (B or C)) or (B and C)), lowered=((A notand (B or C)) or (B and C)), set=superopt_lat_bmi
+            template<> __forceinline constexpr uint64_t ternary_lat<0x8e>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B | C;
+                const uint64_t t1 = ~A & t0;
+                const uint64_t t2 = B & C;
+                const uint64_t t3 = t1 | t2;
+                return t3;
+            }
+            // code=0x91, function=(not ((B xor C)) and (A or (B xor 1))), lowered=((B xor C) notand (A or (B xor 1))), set=superopt_lat_sse
+            template<> __forceinline constexpr uint64_t ternary_lat<0x91>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B ^ C;
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t1 = B ^ c1;
+                const uint64_t t2 = A | t1;
+                const uint64_t t3 = ~t0 & t2;
+                return t3;
+            }
+            // code=0x97, function=(not ((A and B)) xor (C and (A or B))), lowered=(not ((A and B)) xor (C and (A or B))), set=superopt_x86
+            template<> __forceinline constexpr uint64_t ternary_lat<0x97>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A & B;
+                const uint64_t t1 = ~t0;
+                const uint64_t t2 = A | B;
+                const uint64_t t3 = C & t2;
+                const uint64_t t4 = t1 ^ t3;
+                return t4;
+            }
+            // code=0x9b, function=((not (A) and C) or (B xor (C xor 1))), lowered=((A notand C) or (B xor (C xor 1))), set=automat
+            template<> __forceinline constexpr uint64_t ternary_lat<0x9b>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~A & C;
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t1 = C ^ c1;
+                const uint64_t t2 = B ^ t1;
+                const uint64_t t3 = t0 | t2;
+                return t3;
+            }
+            // code=0x9d, function=((not (A) and B) or (B xor (C xor 1))), lowered=((A notand B) or (B xor (C xor 1))), set=automat
+            template<> __forceinline constexpr uint64_t ternary_lat<0x9d>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~A & B;
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t1 = C ^ c1;
+                const uint64_t t2 = B ^ t1;
+                const uint64_t t3 = t0 | t2;
+                return t3;
+            }
+            // code=0xa1, function=(not (A) xor (C or (B and not (A)))), lowered=(not (A) xor (C or (A notand B))), set=superopt_bmi
+            template<> __forceinline constexpr uint64_t ternary_lat<0xa1>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~A;
+                const uint64_t t1 = ~A & B;
+                const uint64_t t2 = C | t1;
+                const uint64_t t3 = t0 ^ t2;
+                return t3;
+            }
+            // code=0xa3, function=(A ? C : (B xor 1)), lowered=((A and C) or (A notand (B xor 1))), set=superopt_lat_xop
+            template<> __forceinline constexpr uint64_t ternary_lat<0xa3>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A & C;
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t1 = B ^ c1;
+                const uint64_t t2 = ~A & t1;
+                const uint64_t t3 = t0 | t2;
+                return t3;
+            }
+            // code=0xa7, function=((not (B) and C) or (A xor (C xor 1))), lowered=((B notand C) or (A xor (C xor 1))), set=automat
+            template<> __forceinline constexpr uint64_t ternary_lat<0xa7>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~B & C;
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t1 = C ^ c1;
+                const uint64_t t2 = A ^ t1;
+                const uint64_t t3 = t0 | t2;
+                return t3;
+            }
+            // code=0xad, function=((B and C) or (A xor (C xor 1))), lowered=((B and C) or (A xor (C xor 1))), set=automat
+            template<> __forceinline constexpr uint64_t ternary_lat<0xad>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B & C;
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t1 = C ^ c1;
+                const uint64_t t2 = A ^ t1;
+                const uint64_t t3 = t0 | t2;
+                return t3;
+            }
+            // code=0xaf, function=(C or (A xor 1)), lowered=(C or (A xor 1)), set=superopt_lat_sse
+            template<> __forceinline constexpr uint64_t ternary_lat<0xaf>(const uint64_t A, const uint64_t, const uint64_t C) noexcept {
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t0 = A ^ c1;
+                const uint64_t t1 = C | t0;
+                return t1;
+            }
+            // code=0xb1, function=(C ? A : (B xor 1)), lowered=((C and A) or (C notand (B xor 1))), set=superopt_lat_xop
+            template<> __forceinline constexpr uint64_t ternary_lat<0xb1>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = C & A;
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t1 = B ^ c1;
+                const uint64_t t2 = ~C & t1;
+                const uint64_t t3 = t0 | t2;
+                return t3;
+            }
+            // code=0xb2, function=((not (B) and (A or C)) or (A and C)), lowered=((B notand (A or C)) or (A and C)), set=superopt_lat_bmi
+            template<> __forceinline constexpr uint64_t ternary_lat<0xb2>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A | C;
+                const uint64_t t1 = ~B & t0;
+                const uint64_t t2 = A & C;
+                const uint64_t t3 = t1 | t2;
+                return t3;
+            }
+            // code=0xb5, function=((not (B) and A) or (A xor (C xor 1))), lowered=((B notand A) or (A xor (C xor 1))), set=automat
+            template<> __forceinline constexpr uint64_t ternary_lat<0xb5>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~B & A;
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t1 = C ^ c1;
+                const uint64_t t2 = A ^ t1;
+                const uint64_t t3 = t0 | t2;
+                return t3;
+            }
+            // code=0xb9, function=((A and C) or (B xor (C xor 1))), lowered=((A and C) or (B xor (C xor 1))), set=automat
+            template<> __forceinline constexpr uint64_t ternary_lat<0xb9>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A & C;
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t1 = C ^ c1;
+                const uint64_t t2 = B ^ t1;
+                const uint64_t t3 = t0 | t2;
+                return t3;
+            }
+            // code=0xbb, function=(C or (B xor 1)), lowered=(C or (B xor 1)), set=superopt_lat_sse
+            template<> __forceinline constexpr uint64_t ternary_lat<0xbb>(const uint64_t, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t0 = B ^ c1;
+                const uint64_t t1 = C | t0;
+                return t1;
+            }
+            // code=0xbd, function=((A xor B) or (A xor (C xor 1))), lowered=((A xor B) or (A xor (C xor 1))), set=automat
+            template<> __forceinline constexpr uint64_t ternary_lat<0xbd>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A ^ B;
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t1 = C ^ c1;
+                const uint64_t t2 = A ^ t1;
+                const uint64_t t3 = t0 | t2;
+                return t3;
+            }
+            // code=0xc1, function=(not (A) xor (B or (C and not (A)))), lowered=(not (A) xor (B or (A notand C))), set=superopt_bmi
+            template<> __forceinline constexpr uint64_t ternary_lat<0xc1>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~A;
+                const uint64_t t1 = ~A & C;
+                const uint64_t t2 = B | t1;
+                const uint64_t t3 = t0 ^ t2;
+                return t3;
+            }
+            // code=0xc5, function=(A ? B : (C xor 1)), lowered=((A and B) or (A notand (C xor 1))), set=superopt_lat_xop
+            template<> __forceinline constexpr uint64_t ternary_lat<0xc5>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A & B;
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t1 = C ^ c1;
+                const uint64_t t2 = ~A & t1;
+                const uint64_t t3 = t0 | t2;
+                return t3;
+            }
+            // code=0xc7, function=((not (C) and B) or (A xor (B xor 1))), lowered=((C notand B) or (A xor (B xor 1))), set=automat
+            template<> __forceinline constexpr uint64_t ternary_lat<0xc7>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~C & B;
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t1 = B ^ c1;
+                const uint64_t t2 = A ^ t1;
+                const uint64_t t3 = t0 | t2;
+                return t3;
+            }
+            // code=0xcb, function=((B and C) or (A xor (B xor 1))), lowered=((B and C) or (A xor (B xor 1))), set=automat
+            template<> __forceinline constexpr uint64_t ternary_lat<0xcb>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B & C;
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t1 = B ^ c1;
+                const uint64_t t2 = A ^ t1;
+                const uint64_t t3 = t0 | t2;
+                return t3;
+            }
+            // code=0xcf, function=(B or (A xor 1)), lowered=(B or (A xor 1)), set=superopt_lat_sse
+            template<> __forceinline constexpr uint64_t ternary_lat<0xcf>(const uint64_t A, const uint64_t B, const uint64_t) noexcept {
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t0 = A ^ c1;
+                const uint64_t t1 = B | t0;
+                return t1;
+            }
+            // code=0xd1, function=(B ? A : (C xor 1)), lowered=((B and A) or (B notand (C xor 1))), set=superopt_lat_xop
+            template<> __forceinline constexpr uint64_t ternary_lat<0xd1>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B & A;
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t1 = C ^ c1;
+                const uint64_t t2 = ~B & t1;
+                const uint64_t t3 = t0 | t2;
+                return t3;
+            }
+            // code=0xd3, function=((not (C) and A) or (A xor (B xor 1))), lowered=((C notand A) or (A xor (B xor 1))), set=automat
+            template<> __forceinline constexpr uint64_t ternary_lat<0xd3>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~C & A;
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t1 = B ^ c1;
+                const uint64_t t2 = A ^ t1;
+                const uint64_t t3 = t0 | t2;
+                return t3;
+            }
+            // code=0xd4, function=((B and not (C)) or (A and (B xnor C))), lowered=((C notand B) or ((B xor C) notand A)), set=optimized
+            template<> __forceinline constexpr uint64_t ternary_lat<0xd4>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~C & B;
+                const uint64_t t1 = B ^ C;
+                const uint64_t t2 = ~t1 & A;
+                const uint64_t t3 = t0 | t2;
+                return t3;
+            }
+            // code=0xd9, function=((A and B) or (B xor (C xor 1))), lowered=((A and B) or (B xor (C xor 1))), set=automat
+            template<> __forceinline constexpr uint64_t ternary_lat<0xd9>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A & B;
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t1 = C ^ c1;
+                const uint64_t t2 = B ^ t1;
+                const uint64_t t3 = t0 | t2;
+                return t3;
+            }
+            // code=0xdb, function=((A xor C) or (A xor (B xor 1))), lowered=((A xor C) or (A xor (B xor 1))), set=automat
+            template<> __forceinline constexpr uint64_t ternary_lat<0xdb>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A ^ C;
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t1 = B ^ c1;
+                const uint64_t t2 = A ^ t1;
+                const uint64_t t3 = t0 | t2;
+                return t3;
+            }
+            // code=0xdd, function=(B or (C xor 1)), lowered=(B or (C xor 1)), set=superopt_lat_sse
+            template<> __forceinline constexpr uint64_t ternary_lat<0xdd>(const uint64_t, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t0 = C ^ c1;
+                const uint64_t t1 = B | t0;
+                return t1;
+            }
+            // code=0xe3, function=((A and C) or (A xor (B xor 1))), lowered=((A and C) or (A xor (B xor 1))), set=automat
+            template<> __forceinline constexpr uint64_t ternary_lat<0xe3>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A & C;
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t1 = B ^ c1;
+                const uint64_t t2 = A ^ t1;
+                const uint64_t t3 = t0 | t2;
+                return t3;
+            }
+            // code=0xe5, function=((A and B) or (A xor (C xor 1))), lowered=((A and B) or (A xor (C xor 1))), set=automat
+            template<> __forceinline constexpr uint64_t ternary_lat<0xe5>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A & B;
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t1 = C ^ c1;
+                const uint64_t t2 = A ^ t1;
+                const uint64_t t3 = t0 | t2;
+                return t3;
+            }
+            // code=0xe7, function=((B xor C) or (A xor (B xor 1))), lowered=((B xor C) or (A xor (B xor 1))), set=automat
+            template<> __forceinline constexpr uint64_t ternary_lat<0xe7>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B ^ C;
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t1 = B ^ c1;
+                const uint64_t t2 = A ^ t1;
+                const uint64_t t3 = t0 | t2;
+                return t3;
+            }
+            // code=0xe8, function=((C and (A or B)) or (A and B)), lowered=((C and (A or B)) or (A and B)), set=superopt_lat_bmi
+            template<> __forceinline constexpr uint64_t ternary_lat<0xe8>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A | B;
+                const uint64_t t1 = C & t0;
+                const uint64_t t2 = A & B;
+                const uint64_t t3 = t1 | t2;
+                return t3;
+            }
+            // code=0xef, function=(B or ((A xor 1) or C)), lowered=(B or ((A xor 1) or C)), set=automat
+            template<> __forceinline constexpr uint64_t ternary_lat<0xef>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t0 = A ^ c1;
+                const uint64_t t1 = t0 | C;
+                const uint64_t t2 = B | t1;
+                return t2;
+            }
+            // code=0xf3, function=(A or (B xor 1)), lowered=(A or (B xor 1)), set=superopt_lat_sse
+            template<> __forceinline constexpr uint64_t ternary_lat<0xf3>(const uint64_t A, const uint64_t B, const uint64_t) noexcept {
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t0 = B ^ c1;
+                const uint64_t t1 = A | t0;
+                return t1;
+            }
+            // code=0xf5, function=(A or (C xor 1)), lowered=(A or (C xor 1)), set=superopt_lat_sse
+            template<> __forceinline constexpr uint64_t ternary_lat<0xf5>(const uint64_t A, const uint64_t, const uint64_t C) noexcept {
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t0 = C ^ c1;
+                const uint64_t t1 = A | t0;
+                return t1;
+            }
+            // code=0xfb, function=(A or ((B xor 1) or C)), lowered=(A or ((B xor 1) or C)), set=automat
+            template<> __forceinline constexpr uint64_t ternary_lat<0xfb>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t0 = B ^ c1;
+                const uint64_t t1 = t0 | C;
+                const uint64_t t2 = A | t1;
+                return t2;
+            }
+            // code=0xfd, function=(A or (B or (C xor 1))), lowered=(A or (B or (C xor 1))), set=automat
+            template<> __forceinline constexpr uint64_t ternary_lat<0xfd>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t c1 = uint64_t(-1);
+                const uint64_t t0 = C ^ c1;
+                const uint64_t t1 = B | t0;
+                const uint64_t t2 = A | t1;
+                return t2;
+            }
+
+        } // namespace icelake
+
+        template<> struct kernels<2> {
+            template<unsigned k> static __forceinline constexpr uint64_t ternary(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                return icelake::ternary<k>(A, B, C);
+            }
+            template<unsigned k> static __forceinline constexpr uint64_t ternary_lat(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                return icelake::ternary_lat<k>(A, B, C);
+            }
+        };
+
+        // AMD Zen 2: the kernels that are faster there than the generic ones
+        namespace zen2 {
+
+            template<unsigned k> __forceinline constexpr uint64_t ternary(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                return x86_64_bmi::ternary<k>(A, B, C);
+            }
+
+            // code=0x01, function=(A nor (B or C)), lowered=not ((A or (B or C))), set=intel
+            template<> __forceinline constexpr uint64_t ternary<0x01>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B | C;
+                const uint64_t t1 = A | t0;
+                const uint64_t t2 = ~t1;
+                return t2;
+            }
+            // code=0x07, function=(A nor (B and C)), lowered=not ((A or (B and C))), set=intel
+            template<> __forceinline constexpr uint64_t ternary<0x07>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B & C;
+                const uint64_t t1 = A | t0;
+                const uint64_t t2 = ~t1;
+                return t2;
+            }
+            // code=0x08, function=((not (A) and B) and C), lowered=((A notand B) and C), set=automat
+            template<> __forceinline constexpr uint64_t ternary<0x08>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~A & B;
+                const uint64_t t1 = t0 & C;
+                return t1;
+            }
+            // code=0x09, function=(A nor (B xor C)), lowered=not ((A or (B xor C))), set=intel
+            template<> __forceinline constexpr uint64_t ternary<0x09>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B ^ C;
+                const uint64_t t1 = A | t0;
+                const uint64_t t2 = ~t1;
+                return t2;
+            }
+            // code=0x13, function=(B nor (A and C)), lowered=not ((B or (A and C))), set=intel
+            template<> __forceinline constexpr uint64_t ternary<0x13>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A & C;
+                const uint64_t t1 = B | t0;
+                const uint64_t t2 = ~t1;
+                return t2;
+            }
+            // code=0x15, function=(C nor (B and A)), lowered=not ((C or (B and A))), set=intel
+            template<> __forceinline constexpr uint64_t ternary<0x15>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B & A;
+                const uint64_t t1 = C | t0;
+                const uint64_t t2 = ~t1;
+                return t2;
+            }
+            // code=0x17, function=((B nor C) or (not (A) and (B xor C))), lowered=(not ((B or C)) or (A notand (B xor C))), set=optimized
+            template<> __forceinline constexpr uint64_t ternary<0x17>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B | C;
+                const uint64_t t1 = ~t0;
+                const uint64_t t2 = B ^ C;
+                const uint64_t t3 = ~A & t2;
+                const uint64_t t4 = t1 | t3;
+                return t4;
+            }
+            // code=0x1a, function=(A xor (C or (A and B))), lowered=(A xor (C or (A and B))), set=superopt_sse
+            template<> __forceinline constexpr uint64_t ternary<0x1a>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A & B;
+                const uint64_t t1 = C | t0;
+                const uint64_t t2 = A ^ t1;
+                return t2;
+            }
+            // code=0x1b, function=(A xor (C or (B xor not (A)))), lowered=(A xor (C or (B xor not (A)))), set=superopt_x86
+            template<> __forceinline constexpr uint64_t ternary<0x1b>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~A;
+                const uint64_t t1 = B ^ t0;
+                const uint64_t t2 = C | t1;
+                const uint64_t t3 = A ^ t2;
+                return t3;
+            }
+            // code=0x1c, function=(A xor (B or (A and C))), lowered=(A xor (B or (A and C))), set=superopt_sse
+            template<> __forceinline constexpr uint64_t ternary<0x1c>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A & C;
+                const uint64_t t1 = B | t0;
+                const uint64_t t2 = A ^ t1;
+                return t2;
+            }
+            // code=0x1d, function=(A xor (B or (C xor not (A)))), lowered=(A xor (B or (C xor not (A)))), set=superopt_x86
+            template<> __forceinline constexpr uint64_t ternary<0x1d>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~A;
+                const uint64_t t1 = C ^ t0;
+                const uint64_t t2 = B | t1;
+                const uint64_t t3 = A ^ t2;
+                return t3;
+            }
+            // code=0x20, function=((not (B) and A) and C), lowered=((B notand A) and C), set=automat
+            template<> __forceinline constexpr uint64_t ternary<0x20>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~B & A;
+                const uint64_t t1 = t0 & C;
+                return t1;
+            }
+            // code=0x21, function=(B nor (A xor C)), lowered=not ((B or (A xor C))), set=intel
+            template<> __forceinline constexpr uint64_t ternary<0x21>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A ^ C;
+                const uint64_t t1 = B | t0;
+                const uint64_t t2 = ~t1;
+                return t2;
+            }
+            // code=0x26, function=(B xor (C or (A and B))), lowered=(B xor (C or (A and B))), set=superopt_sse
+            template<> __forceinline constexpr uint64_t ternary<0x26>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A & B;
+                const uint64_t t1 = C | t0;
+                const uint64_t t2 = B ^ t1;
+                return t2;
+            }
+            // code=0x2c, function=(B xor (A and (B or C))), lowered=(B xor (A and (B or C))), set=superopt_sse
+            template<> __forceinline constexpr uint64_t ternary<0x2c>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B | C;
+                const uint64_t t1 = A & t0;
+                const uint64_t t2 = B ^ t1;
+                return t2;
+            }
+            // code=0x31, function=not ((B or (C and not (A)))), lowered=not ((B or (A notand C))), set=superopt_x86
+            template<> __forceinline constexpr uint64_t ternary<0x31>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~A & C;
+                const uint64_t t1 = B | t0;
+                const uint64_t t2 = ~t1;
+                return t2;
+            }
+            // code=0x34, function=(B xor (A or (B and C))), lowered=(B xor (A or (B and C))), set=superopt_sse
+            template<> __forceinline constexpr uint64_t ternary<0x34>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B & C;
+                const uint64_t t1 = A | t0;
+                const uint64_t t2 = B ^ t1;
+                return t2;
+            }
+            // code=0x38, function=(A xor (B and (A or C))), lowered=(A xor (B and (A or C))), set=superopt_sse
+            template<> __forceinline constexpr uint64_t ternary<0x38>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A | C;
+                const uint64_t t1 = B & t0;
+                const uint64_t t2 = A ^ t1;
+                return t2;
+            }
+            // code=0x3d, function=(A xor (B or not ((A or C)))), lowered=(A xor (B or not ((A or C)))), set=superopt_x86
+            template<> __forceinline constexpr uint64_t ternary<0x3d>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A | C;
+                const uint64_t t1 = ~t0;
+                const uint64_t t2 = B | t1;
+                const uint64_t t3 = A ^ t2;
+                return t3;
+            }
+            // code=0x3e, function=(A xor (B or (C and not (A)))), lowered=(A xor (B or (A notand C))), set=superopt_x86
+            template<> __forceinline constexpr uint64_t ternary<0x3e>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~A & C;
+                const uint64_t t1 = B | t0;
+                const uint64_t t2 = A ^ t1;
+                return t2;
+            }
+            // code=0x40, function=((not (C) and A) and B), lowered=((C notand A) and B), set=automat
+            template<> __forceinline constexpr uint64_t ternary<0x40>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~C & A;
+                const uint64_t t1 = t0 & B;
+                return t1;
+            }
+            // code=0x41, function=(C nor (B xor A)), lowered=not ((C or (B xor A))), set=intel
+            template<> __forceinline constexpr uint64_t ternary<0x41>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B ^ A;
+                const uint64_t t1 = C | t0;
+                const uint64_t t2 = ~t1;
+                return t2;
+            }
+            // code=0x46, function=(C xor (B or (A and C))), lowered=(C xor (B or (A and C))), set=superopt_sse
+            template<> __forceinline constexpr uint64_t ternary<0x46>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A & C;
+                const uint64_t t1 = B | t0;
+                const uint64_t t2 = C ^ t1;
+                return t2;
+            }
+            // code=0x4a, function=(C xor (A and (B or C))), lowered=(C xor (A and (B or C))), set=superopt_sse
+            template<> __forceinline constexpr uint64_t ternary<0x4a>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B | C;
+                const uint64_t t1 = A & t0;
+                const uint64_t t2 = C ^ t1;
+                return t2;
+            }
+            // code=0x51, function=not ((C or (B and not (A)))), lowered=not ((C or (A notand B))), set=superopt_x86
+            template<> __forceinline constexpr uint64_t ternary<0x51>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~A & B;
+                const uint64_t t1 = C | t0;
+                const uint64_t t2 = ~t1;
+                return t2;
+            }
+            // code=0x52, function=(C xor (A or (B and C))), lowered=(C xor (A or (B and C))), set=superopt_sse
+            template<> __forceinline constexpr uint64_t ternary<0x52>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B & C;
+                const uint64_t t1 = A | t0;
+                const uint64_t t2 = C ^ t1;
+                return t2;
+            }
+            // code=0x58, function=(A xor (C and (A or B))), lowered=(A xor (C and (A or B))), set=superopt_sse
+            template<> __forceinline constexpr uint64_t ternary<0x58>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A | B;
+                const uint64_t t1 = C & t0;
+                const uint64_t t2 = A ^ t1;
+                return t2;
+            }
+            // code=0x5b, function=(A xor (C or not ((A or B)))), lowered=(A xor (C or not ((A or B)))), set=superopt_x86
+            template<> __forceinline constexpr uint64_t ternary<0x5b>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A | B;
+                const uint64_t t1 = ~t0;
+                const uint64_t t2 = C | t1;
+                const uint64_t t3 = A ^ t2;
+                return t3;
+            }
+            // code=0x5e, function=(A xor (C or (B and not (A)))), lowered=(A xor (C or (A notand B))), set=superopt_x86
+            template<> __forceinline constexpr uint64_t ternary<0x5e>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~A & B;
+                const uint64_t t1 = C | t0;
+                const uint64_t t2 = A ^ t1;
+                return t2;
+            }
+            // code=0x62, function=(C xor (B and (A or C))), lowered=(C xor (B and (A or C))), set=superopt_sse
+            template<> __forceinline constexpr uint64_t ternary<0x62>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A | C;
+                const uint64_t t1 = B & t0;
+                const uint64_t t2 = C ^ t1;
+                return t2;
+            }
+            // code=0x64, function=(B xor (C and (A or B))), lowered=(B xor (C and (A or B))), set=superopt_sse
+            template<> __forceinline constexpr uint64_t ternary<0x64>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A | B;
+                const uint64_t t1 = C & t0;
+                const uint64_t t2 = B ^ t1;
+                return t2;
+            }
+            // code=0x67, function=(B xor (C or not ((A or B)))), lowered=(B xor (C or not ((A or B)))), set=superopt_x86
+            template<> __forceinline constexpr uint64_t ternary<0x67>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A | B;
+                const uint64_t t1 = ~t0;
+                const uint64_t t2 = C | t1;
+                const uint64_t t3 = B ^ t2;
+                return t3;
+            }
+            // code=0x69, function=(A xnor (B xor C)), lowered=not ((A xor (B xor C))), set=intel
+            template<> __forceinline constexpr uint64_t ternary<0x69>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B ^ C;
+                const uint64_t t1 = A ^ t0;
+                const uint64_t t2 = ~t1;
+                return t2;
+            }
+            // code=0x6b, function=((C xor not (A)) xor (B or (C and not (A)))), lowered=((C xor not (A)) xor (B or (A notand C))), set=superopt_x86
+            template<> __forceinline constexpr uint64_t ternary<0x6b>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~A;
+                const uint64_t t1 = C ^ t0;
+                const uint64_t t2 = ~A & C;
+                const uint64_t t3 = B | t2;
+                const uint64_t t4 = t1 ^ t3;
+                return t4;
+            }
+            // code=0x6d, function=((B and not (A)) or (C xor (B or not (A)))), lowered=((A notand B) or (C xor (B or not (A)))), set=superopt_x86
+            template<> __forceinline constexpr uint64_t ternary<0x6d>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~A & B;
+                const uint64_t t1 = ~A;
+                const uint64_t t2 = B | t1;
+                const uint64_t t3 = C ^ t2;
+                const uint64_t t4 = t0 | t3;
+                return t4;
+            }
+            // code=0x76, function=(B xor (C or (A and not (B)))), lowered=(B xor (C or (B notand A))), set=superopt_x86
+            template<> __forceinline constexpr uint64_t ternary<0x76>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~B & A;
+                const uint64_t t1 = C | t0;
+                const uint64_t t2 = B ^ t1;
+                return t2;
+            }
+            // code=0x79, function=((A and not (B)) or (C xor (A or not (B)))), lowered=((B notand A) or (C xor (A or not (B)))), set=superopt_x86
+            template<> __forceinline constexpr uint64_t ternary<0x79>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~B & A;
+                const uint64_t t1 = ~B;
+                const uint64_t t2 = A | t1;
+                const uint64_t t3 = C ^ t2;
+                const uint64_t t4 = t0 | t3;
+                return t4;
+            }
+            // code=0x87, function=(A xnor (B and C)), lowered=not ((A xor (B and C))), set=intel
+            template<> __forceinline constexpr uint64_t ternary<0x87>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B & C;
+                const uint64_t t1 = A ^ t0;
+                const uint64_t t2 = ~t1;
+                return t2;
+            }
+            // code=0x89, function=(not (B) xor (C or (A and not (B)))), lowered=(not (B) xor (C or (B notand A))), set=superopt_x86
+            template<> __forceinline constexpr uint64_t ternary<0x89>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~B;
+                const uint64_t t1 = ~B & A;
+                const uint64_t t2 = C | t1;
+                const uint64_t t3 = t0 ^ t2;
+                return t3;
+            }
+            // code=0x8b, function=((A and not (B)) xor (C or not (B))), lowered=((B notand A) xor (C or not (B))), set=superopt_lat_x86
+            template<> __forceinline constexpr uint64_t ternary<0x8b>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~B & A;
+                const uint64_t t1 = ~B;
+                const uint64_t t2 = C | t1;
+                const uint64_t t3 = t0 ^ t2;
+                return t3;
+            }
+            // code=0x93, function=(B xnor (A and C)), lowered=not ((B xor (A and C))), set=intel
+            template<> __forceinline constexpr uint64_t ternary<0x93>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A & C;
+                const uint64_t t1 = B ^ t0;
+                const uint64_t t2 = ~t1;
+                return t2;
+            }
+            // code=0x95, function=(C xnor (B and A)), lowered=not ((C xor (B and A))), set=intel
+            template<> __forceinline constexpr uint64_t ternary<0x95>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B & A;
+                const uint64_t t1 = C ^ t0;
+                const uint64_t t2 = ~t1;
+                return t2;
+            }
+            // code=0x97, function=(not ((A and B)) xor (C and (A or B))), lowered=(not ((A and B)) xor (C and (A or B))), set=superopt_x86
+            template<> __forceinline constexpr uint64_t ternary<0x97>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A & B;
+                const uint64_t t1 = ~t0;
+                const uint64_t t2 = A | B;
+                const uint64_t t3 = C & t2;
+                const uint64_t t4 = t1 ^ t3;
+                return t4;
+            }
+            // code=0xa3, function=((B and not (A)) xor (C or not (A))), lowered=((A notand B) xor (C or not (A))), set=superopt_x86
+            template<> __forceinline constexpr uint64_t ternary<0xa3>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~A & B;
+                const uint64_t t1 = ~A;
+                const uint64_t t2 = C | t1;
+                const uint64_t t3 = t0 ^ t2;
+                return t3;
+            }
+            // code=0xa9, function=(C xnor (B or A)), lowered=not ((C xor (B or A))), set=intel
+            template<> __forceinline constexpr uint64_t ternary<0xa9>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B | A;
+                const uint64_t t1 = C ^ t0;
+                const uint64_t t2 = ~t1;
+                return t2;
+            }
+            // code=0xb9, function=((B xnor C) or (A and not (B))), lowered=(not ((B xor C)) or (B notand A)), set=optimized
+            template<> __forceinline constexpr uint64_t ternary<0xb9>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B ^ C;
+                const uint64_t t1 = ~t0;
+                const uint64_t t2 = ~B & A;
+                const uint64_t t3 = t1 | t2;
+                return t3;
+            }
+            // code=0xc5, function=((C and not (A)) xor (B or not (A))), lowered=((A notand C) xor (B or not (A))), set=superopt_x86
+            template<> __forceinline constexpr uint64_t ternary<0xc5>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~A & C;
+                const uint64_t t1 = ~A;
+                const uint64_t t2 = B | t1;
+                const uint64_t t3 = t0 ^ t2;
+                return t3;
+            }
+            // code=0xc9, function=(B xnor (A or C)), lowered=not ((B xor (A or C))), set=intel
+            template<> __forceinline constexpr uint64_t ternary<0xc9>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A | C;
+                const uint64_t t1 = B ^ t0;
+                const uint64_t t2 = ~t1;
+                return t2;
+            }
+            // code=0xd4, function=((B and not (C)) or (A and (B xnor C))), lowered=((C notand B) or ((B xor C) notand A)), set=optimized
+            template<> __forceinline constexpr uint64_t ternary<0xd4>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~C & B;
+                const uint64_t t1 = B ^ C;
+                const uint64_t t2 = ~t1 & A;
+                const uint64_t t3 = t0 | t2;
+                return t3;
+            }
+            // code=0xe1, function=(A xnor (B or C)), lowered=not ((A xor (B or C))), set=intel
+            template<> __forceinline constexpr uint64_t ternary<0xe1>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B | C;
+                const uint64_t t1 = A ^ t0;
+                const uint64_t t2 = ~t1;
+                return t2;
+            }
+            // code=0xfb, function=(A or (not (B) or C)), lowered=(A or (not (B) or C)), set=optimized
+            template<> __forceinline constexpr uint64_t ternary<0xfb>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~B;
+                const uint64_t t1 = t0 | C;
+                const uint64_t t2 = A | t1;
+                return t2;
+            }
+
+            template<unsigned k> __forceinline constexpr uint64_t ternary_lat(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                return x86_64_bmi::ternary_lat<k>(A, B, C);
+            }
+
+            // code=0x08, function=((not (A) and B) and C), lowered=((A notand B) and C), set=automat
+            template<> __forceinline constexpr uint64_t ternary_lat<0x08>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~A & B;
+                const uint64_t t1 = t0 & C;
+                return t1;
+            }
+            // code=0x17, function=((B nor C) or (not (A) and (B xor C))), lowered=(not ((B or C)) or (A notand (B xor C))), set=optimized
+            template<> __forceinline constexpr uint64_t ternary_lat<0x17>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B | C;
+                const uint64_t t1 = ~t0;
+                const uint64_t t2 = B ^ C;
+                const uint64_t t3 = ~A & t2;
+                const uint64_t t4 = t1 | t3;
+                return t4;
+            }
+            // code=0x20, function=((not (B) and A) and C), lowered=((B notand A) and C), set=automat
+            template<> __forceinline constexpr uint64_t ternary_lat<0x20>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~B & A;
+                const uint64_t t1 = t0 & C;
+                return t1;
+            }
+            // code=0x40, function=((not (C) and A) and B), lowered=((C notand A) and B), set=automat
+            template<> __forceinline constexpr uint64_t ternary_lat<0x40>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~C & A;
+                const uint64_t t1 = t0 & B;
+                return t1;
+            }
+            // code=0x6b, function=((C xor not (A)) xor (B or (C and not (A)))), lowered=((C xor not (A)) xor (B or (A notand C))), set=superopt_x86
+            template<> __forceinline constexpr uint64_t ternary_lat<0x6b>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~A;
+                const uint64_t t1 = C ^ t0;
+                const uint64_t t2 = ~A & C;
+                const uint64_t t3 = B | t2;
+                const uint64_t t4 = t1 ^ t3;
+                return t4;
+            }
+            // code=0x89, function=(not (B) xor (C or (A and not (B)))), lowered=(not (B) xor (C or (B notand A))), set=superopt_x86
+            template<> __forceinline constexpr uint64_t ternary_lat<0x89>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~B;
+                const uint64_t t1 = ~B & A;
+                const uint64_t t2 = C | t1;
+                const uint64_t t3 = t0 ^ t2;
+                return t3;
+            }
+            // code=0x8b, function=((A and not (B)) xor (C or not (B))), lowered=((B notand A) xor (C or not (B))), set=superopt_lat_x86
+            template<> __forceinline constexpr uint64_t ternary_lat<0x8b>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~B & A;
+                const uint64_t t1 = ~B;
+                const uint64_t t2 = C | t1;
+                const uint64_t t3 = t0 ^ t2;
+                return t3;
+            }
+            // code=0x97, function=(not ((A and B)) xor (C and (A or B))), lowered=(not ((A and B)) xor (C and (A or B))), set=superopt_x86
+            template<> __forceinline constexpr uint64_t ternary_lat<0x97>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A & B;
+                const uint64_t t1 = ~t0;
+                const uint64_t t2 = A | B;
+                const uint64_t t3 = C & t2;
+                const uint64_t t4 = t1 ^ t3;
+                return t4;
+            }
+            // code=0xa3, function=((B and not (A)) xor (C or not (A))), lowered=((A notand B) xor (C or not (A))), set=superopt_x86
+            template<> __forceinline constexpr uint64_t ternary_lat<0xa3>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~A & B;
+                const uint64_t t1 = ~A;
+                const uint64_t t2 = C | t1;
+                const uint64_t t3 = t0 ^ t2;
+                return t3;
+            }
+            // code=0xb9, function=((B xnor C) or (A and not (B))), lowered=(not ((B xor C)) or (B notand A)), set=optimized
+            template<> __forceinline constexpr uint64_t ternary_lat<0xb9>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B ^ C;
+                const uint64_t t1 = ~t0;
+                const uint64_t t2 = ~B & A;
+                const uint64_t t3 = t1 | t2;
+                return t3;
+            }
+            // code=0xc5, function=((C and not (A)) xor (B or not (A))), lowered=((A notand C) xor (B or not (A))), set=superopt_x86
+            template<> __forceinline constexpr uint64_t ternary_lat<0xc5>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~A & C;
+                const uint64_t t1 = ~A;
+                const uint64_t t2 = B | t1;
+                const uint64_t t3 = t0 ^ t2;
+                return t3;
+            }
+            // code=0xd4, function=((B and not (C)) or (A and (B xnor C))), lowered=((C notand B) or ((B xor C) notand A)), set=optimized
+            template<> __forceinline constexpr uint64_t ternary_lat<0xd4>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~C & B;
+                const uint64_t t1 = B ^ C;
+                const uint64_t t2 = ~t1 & A;
+                const uint64_t t3 = t0 | t2;
+                return t3;
+            }
+
+        } // namespace zen2
+
+        template<> struct kernels<3> {
+            template<unsigned k> static __forceinline constexpr uint64_t ternary(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                return zen2::ternary<k>(A, B, C);
+            }
+            template<unsigned k> static __forceinline constexpr uint64_t ternary_lat(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                return zen2::ternary_lat<k>(A, B, C);
+            }
+        };
+
+        // AMD Zen 3: the kernels that are faster there than the generic ones
+        namespace zen3 {
+
+            template<unsigned k> __forceinline constexpr uint64_t ternary(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                return x86_64_bmi::ternary<k>(A, B, C);
+            }
+
+            // code=0x01, function=(A nor (B or C)), lowered=not ((A or (B or C))), set=intel
+            template<> __forceinline constexpr uint64_t ternary<0x01>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B | C;
+                const uint64_t t1 = A | t0;
+                const uint64_t t2 = ~t1;
+                return t2;
+            }
+            // code=0x07, function=(A nor (B and C)), lowered=not ((A or (B and C))), set=intel
+            template<> __forceinline constexpr uint64_t ternary<0x07>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B & C;
+                const uint64_t t1 = A | t0;
+                const uint64_t t2 = ~t1;
+                return t2;
+            }
+            // code=0x09, function=(A nor (B xor C)), lowered=not ((A or (B xor C))), set=intel
+            template<> __forceinline constexpr uint64_t ternary<0x09>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B ^ C;
+                const uint64_t t1 = A | t0;
+                const uint64_t t2 = ~t1;
+                return t2;
+            }
+            // code=0x13, function=(B nor (A and C)), lowered=not ((B or (A and C))), set=intel
+            template<> __forceinline constexpr uint64_t ternary<0x13>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A & C;
+                const uint64_t t1 = B | t0;
+                const uint64_t t2 = ~t1;
+                return t2;
+            }
+            // code=0x15, function=(C nor (B and A)), lowered=not ((C or (B and A))), set=intel
+            template<> __forceinline constexpr uint64_t ternary<0x15>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B & A;
+                const uint64_t t1 = C | t0;
+                const uint64_t t2 = ~t1;
+                return t2;
+            }
+            // code=0x17, function=((B nor C) or (not (A) and (B xor C))), lowered=(not ((B or C)) or (A notand (B xor C))), set=optimized
+            template<> __forceinline constexpr uint64_t ternary<0x17>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B | C;
+                const uint64_t t1 = ~t0;
+                const uint64_t t2 = B ^ C;
+                const uint64_t t3 = ~A & t2;
+                const uint64_t t4 = t1 | t3;
+                return t4;
+            }
+            // code=0x1a, function=(A xor (C or (A and B))), lowered=(A xor (C or (A and B))), set=superopt_sse
+            template<> __forceinline constexpr uint64_t ternary<0x1a>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A & B;
+                const uint64_t t1 = C | t0;
+                const uint64_t t2 = A ^ t1;
+                return t2;
+            }
+            // code=0x1c, function=(A xor (B or (A and C))), lowered=(A xor (B or (A and C))), set=superopt_sse
+            template<> __forceinline constexpr uint64_t ternary<0x1c>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A & C;
+                const uint64_t t1 = B | t0;
+                const uint64_t t2 = A ^ t1;
+                return t2;
+            }
+            // code=0x21, function=(B nor (A xor C)), lowered=not ((B or (A xor C))), set=intel
+            template<> __forceinline constexpr uint64_t ternary<0x21>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A ^ C;
+                const uint64_t t1 = B | t0;
+                const uint64_t t2 = ~t1;
+                return t2;
+            }
+            // code=0x26, function=(B xor (C or (A and B))), lowered=(B xor (C or (A and B))), set=superopt_sse
+            template<> __forceinline constexpr uint64_t ternary<0x26>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A & B;
+                const uint64_t t1 = C | t0;
+                const uint64_t t2 = B ^ t1;
+                return t2;
+            }
+            // code=0x2c, function=(B xor (A and (B or C))), lowered=(B xor (A and (B or C))), set=superopt_sse
+            template<> __forceinline constexpr uint64_t ternary<0x2c>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B | C;
+                const uint64_t t1 = A & t0;
+                const uint64_t t2 = B ^ t1;
+                return t2;
+            }
+            // code=0x34, function=(B xor (A or (B and C))), lowered=(B xor (A or (B and C))), set=superopt_sse
+            template<> __forceinline constexpr uint64_t ternary<0x34>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B & C;
+                const uint64_t t1 = A | t0;
+                const uint64_t t2 = B ^ t1;
+                return t2;
+            }
+            // code=0x38, function=(A xor (B and (A or C))), lowered=(A xor (B and (A or C))), set=superopt_sse
+            template<> __forceinline constexpr uint64_t ternary<0x38>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A | C;
+                const uint64_t t1 = B & t0;
+                const uint64_t t2 = A ^ t1;
+                return t2;
+            }
+            // code=0x41, function=(C nor (B xor A)), lowered=not ((C or (B xor A))), set=intel
+            template<> __forceinline constexpr uint64_t ternary<0x41>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B ^ A;
+                const uint64_t t1 = C | t0;
+                const uint64_t t2 = ~t1;
+                return t2;
+            }
+            // code=0x46, function=(C xor (B or (A and C))), lowered=(C xor (B or (A and C))), set=superopt_sse
+            template<> __forceinline constexpr uint64_t ternary<0x46>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A & C;
+                const uint64_t t1 = B | t0;
+                const uint64_t t2 = C ^ t1;
+                return t2;
+            }
+            // code=0x4a, function=(C xor (A and (B or C))), lowered=(C xor (A and (B or C))), set=superopt_sse
+            template<> __forceinline constexpr uint64_t ternary<0x4a>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B | C;
+                const uint64_t t1 = A & t0;
+                const uint64_t t2 = C ^ t1;
+                return t2;
+            }
+            // code=0x52, function=(C xor (A or (B and C))), lowered=(C xor (A or (B and C))), set=superopt_sse
+            template<> __forceinline constexpr uint64_t ternary<0x52>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B & C;
+                const uint64_t t1 = A | t0;
+                const uint64_t t2 = C ^ t1;
+                return t2;
+            }
+            // code=0x58, function=(A xor (C and (A or B))), lowered=(A xor (C and (A or B))), set=superopt_sse
+            template<> __forceinline constexpr uint64_t ternary<0x58>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A | B;
+                const uint64_t t1 = C & t0;
+                const uint64_t t2 = A ^ t1;
+                return t2;
+            }
+            // code=0x62, function=(C xor (B and (A or C))), lowered=(C xor (B and (A or C))), set=superopt_sse
+            template<> __forceinline constexpr uint64_t ternary<0x62>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A | C;
+                const uint64_t t1 = B & t0;
+                const uint64_t t2 = C ^ t1;
+                return t2;
+            }
+            // code=0x64, function=(B xor (C and (A or B))), lowered=(B xor (C and (A or B))), set=superopt_sse
+            template<> __forceinline constexpr uint64_t ternary<0x64>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A | B;
+                const uint64_t t1 = C & t0;
+                const uint64_t t2 = B ^ t1;
+                return t2;
+            }
+            // code=0x69, function=(A xnor (B xor C)), lowered=not ((A xor (B xor C))), set=intel
+            template<> __forceinline constexpr uint64_t ternary<0x69>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B ^ C;
+                const uint64_t t1 = A ^ t0;
+                const uint64_t t2 = ~t1;
+                return t2;
+            }
+            // code=0x87, function=(A xnor (B and C)), lowered=not ((A xor (B and C))), set=intel
+            template<> __forceinline constexpr uint64_t ternary<0x87>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B & C;
+                const uint64_t t1 = A ^ t0;
+                const uint64_t t2 = ~t1;
+                return t2;
+            }
+            // code=0x93, function=(B xnor (A and C)), lowered=not ((B xor (A and C))), set=intel
+            template<> __forceinline constexpr uint64_t ternary<0x93>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A & C;
+                const uint64_t t1 = B ^ t0;
+                const uint64_t t2 = ~t1;
+                return t2;
+            }
+            // code=0x95, function=(C xnor (B and A)), lowered=not ((C xor (B and A))), set=intel
+            template<> __forceinline constexpr uint64_t ternary<0x95>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B & A;
+                const uint64_t t1 = C ^ t0;
+                const uint64_t t2 = ~t1;
+                return t2;
+            }
+            // code=0x97, function=(not ((A and B)) xor (C and (A or B))), lowered=(not ((A and B)) xor (C and (A or B))), set=superopt_x86
+            template<> __forceinline constexpr uint64_t ternary<0x97>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A & B;
+                const uint64_t t1 = ~t0;
+                const uint64_t t2 = A | B;
+                const uint64_t t3 = C & t2;
+                const uint64_t t4 = t1 ^ t3;
+                return t4;
+            }
+            // code=0xa9, function=(C xnor (B or A)), lowered=not ((C xor (B or A))), set=intel
+            template<> __forceinline constexpr uint64_t ternary<0xa9>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B | A;
+                const uint64_t t1 = C ^ t0;
+                const uint64_t t2 = ~t1;
+                return t2;
+            }
+            // code=0xc9, function=(B xnor (A or C)), lowered=not ((B xor (A or C))), set=intel
+            template<> __forceinline constexpr uint64_t ternary<0xc9>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A | C;
+                const uint64_t t1 = B ^ t0;
+                const uint64_t t2 = ~t1;
+                return t2;
+            }
+            // code=0xe1, function=(A xnor (B or C)), lowered=not ((A xor (B or C))), set=intel
+            template<> __forceinline constexpr uint64_t ternary<0xe1>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B | C;
+                const uint64_t t1 = A ^ t0;
+                const uint64_t t2 = ~t1;
+                return t2;
+            }
+            // code=0xfb, function=(A or (not (B) or C)), lowered=(A or (not (B) or C)), set=optimized
+            template<> __forceinline constexpr uint64_t ternary<0xfb>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~B;
+                const uint64_t t1 = t0 | C;
+                const uint64_t t2 = A | t1;
+                return t2;
+            }
+
+            template<unsigned k> __forceinline constexpr uint64_t ternary_lat(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                return x86_64_bmi::ternary_lat<k>(A, B, C);
+            }
+
+            // code=0x17, function=((B nor C) or (not (A) and (B xor C))), lowered=(not ((B or C)) or (A notand (B xor C))), set=optimized
+            template<> __forceinline constexpr uint64_t ternary_lat<0x17>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B | C;
+                const uint64_t t1 = ~t0;
+                const uint64_t t2 = B ^ C;
+                const uint64_t t3 = ~A & t2;
+                const uint64_t t4 = t1 | t3;
+                return t4;
+            }
+            // code=0x97, function=(not ((A and B)) xor (C and (A or B))), lowered=(not ((A and B)) xor (C and (A or B))), set=superopt_x86
+            template<> __forceinline constexpr uint64_t ternary_lat<0x97>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A & B;
+                const uint64_t t1 = ~t0;
+                const uint64_t t2 = A | B;
+                const uint64_t t3 = C & t2;
+                const uint64_t t4 = t1 ^ t3;
+                return t4;
+            }
+
+        } // namespace zen3
+
+        template<> struct kernels<4> {
+            template<unsigned k> static __forceinline constexpr uint64_t ternary(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                return zen3::ternary<k>(A, B, C);
+            }
+            template<unsigned k> static __forceinline constexpr uint64_t ternary_lat(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                return zen3::ternary_lat<k>(A, B, C);
+            }
+        };
+
+        // AMD Zen 4: the kernels that are faster there than the generic ones
+        namespace zen4 {
+
+            template<unsigned k> __forceinline constexpr uint64_t ternary(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                return x86_64_bmi::ternary<k>(A, B, C);
+            }
+
+            // code=0x01, function=(A nor (B or C)), lowered=not ((A or (B or C))), set=intel
+            template<> __forceinline constexpr uint64_t ternary<0x01>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B | C;
+                const uint64_t t1 = A | t0;
+                const uint64_t t2 = ~t1;
+                return t2;
+            }
+            // code=0x07, function=(A nor (B and C)), lowered=not ((A or (B and C))), set=intel
+            template<> __forceinline constexpr uint64_t ternary<0x07>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B & C;
+                const uint64_t t1 = A | t0;
+                const uint64_t t2 = ~t1;
+                return t2;
+            }
+            // code=0x09, function=(A nor (B xor C)), lowered=not ((A or (B xor C))), set=intel
+            template<> __forceinline constexpr uint64_t ternary<0x09>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B ^ C;
+                const uint64_t t1 = A | t0;
+                const uint64_t t2 = ~t1;
+                return t2;
+            }
+            // code=0x13, function=(B nor (A and C)), lowered=not ((B or (A and C))), set=intel
+            template<> __forceinline constexpr uint64_t ternary<0x13>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A & C;
+                const uint64_t t1 = B | t0;
+                const uint64_t t2 = ~t1;
+                return t2;
+            }
+            // code=0x15, function=(C nor (B and A)), lowered=not ((C or (B and A))), set=intel
+            template<> __forceinline constexpr uint64_t ternary<0x15>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B & A;
+                const uint64_t t1 = C | t0;
+                const uint64_t t2 = ~t1;
+                return t2;
+            }
+            // code=0x17, function=((B nor C) or (not (A) and (B xor C))), lowered=(not ((B or C)) or (A notand (B xor C))), set=optimized
+            template<> __forceinline constexpr uint64_t ternary<0x17>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B | C;
+                const uint64_t t1 = ~t0;
+                const uint64_t t2 = B ^ C;
+                const uint64_t t3 = ~A & t2;
+                const uint64_t t4 = t1 | t3;
+                return t4;
+            }
+            // code=0x1a, function=(A xor (C or (A and B))), lowered=(A xor (C or (A and B))), set=superopt_sse
+            template<> __forceinline constexpr uint64_t ternary<0x1a>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A & B;
+                const uint64_t t1 = C | t0;
+                const uint64_t t2 = A ^ t1;
+                return t2;
+            }
+            // code=0x1c, function=(A xor (B or (A and C))), lowered=(A xor (B or (A and C))), set=superopt_sse
+            template<> __forceinline constexpr uint64_t ternary<0x1c>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A & C;
+                const uint64_t t1 = B | t0;
+                const uint64_t t2 = A ^ t1;
+                return t2;
+            }
+            // code=0x21, function=(B nor (A xor C)), lowered=not ((B or (A xor C))), set=intel
+            template<> __forceinline constexpr uint64_t ternary<0x21>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A ^ C;
+                const uint64_t t1 = B | t0;
+                const uint64_t t2 = ~t1;
+                return t2;
+            }
+            // code=0x26, function=(B xor (C or (A and B))), lowered=(B xor (C or (A and B))), set=superopt_sse
+            template<> __forceinline constexpr uint64_t ternary<0x26>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A & B;
+                const uint64_t t1 = C | t0;
+                const uint64_t t2 = B ^ t1;
+                return t2;
+            }
+            // code=0x2c, function=(B xor (A and (B or C))), lowered=(B xor (A and (B or C))), set=superopt_sse
+            template<> __forceinline constexpr uint64_t ternary<0x2c>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B | C;
+                const uint64_t t1 = A & t0;
+                const uint64_t t2 = B ^ t1;
+                return t2;
+            }
+            // code=0x34, function=(B xor (A or (B and C))), lowered=(B xor (A or (B and C))), set=superopt_sse
+            template<> __forceinline constexpr uint64_t ternary<0x34>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B & C;
+                const uint64_t t1 = A | t0;
+                const uint64_t t2 = B ^ t1;
+                return t2;
+            }
+            // code=0x38, function=(A xor (B and (A or C))), lowered=(A xor (B and (A or C))), set=superopt_sse
+            template<> __forceinline constexpr uint64_t ternary<0x38>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A | C;
+                const uint64_t t1 = B & t0;
+                const uint64_t t2 = A ^ t1;
+                return t2;
+            }
+            // code=0x41, function=(C nor (B xor A)), lowered=not ((C or (B xor A))), set=intel
+            template<> __forceinline constexpr uint64_t ternary<0x41>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B ^ A;
+                const uint64_t t1 = C | t0;
+                const uint64_t t2 = ~t1;
+                return t2;
+            }
+            // code=0x46, function=(C xor (B or (A and C))), lowered=(C xor (B or (A and C))), set=superopt_sse
+            template<> __forceinline constexpr uint64_t ternary<0x46>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A & C;
+                const uint64_t t1 = B | t0;
+                const uint64_t t2 = C ^ t1;
+                return t2;
+            }
+            // code=0x4a, function=(C xor (A and (B or C))), lowered=(C xor (A and (B or C))), set=superopt_sse
+            template<> __forceinline constexpr uint64_t ternary<0x4a>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B | C;
+                const uint64_t t1 = A & t0;
+                const uint64_t t2 = C ^ t1;
+                return t2;
+            }
+            // code=0x52, function=(C xor (A or (B and C))), lowered=(C xor (A or (B and C))), set=superopt_sse
+            template<> __forceinline constexpr uint64_t ternary<0x52>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B & C;
+                const uint64_t t1 = A | t0;
+                const uint64_t t2 = C ^ t1;
+                return t2;
+            }
+            // code=0x58, function=(A xor (C and (A or B))), lowered=(A xor (C and (A or B))), set=superopt_sse
+            template<> __forceinline constexpr uint64_t ternary<0x58>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A | B;
+                const uint64_t t1 = C & t0;
+                const uint64_t t2 = A ^ t1;
+                return t2;
+            }
+            // code=0x62, function=(C xor (B and (A or C))), lowered=(C xor (B and (A or C))), set=superopt_sse
+            template<> __forceinline constexpr uint64_t ternary<0x62>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A | C;
+                const uint64_t t1 = B & t0;
+                const uint64_t t2 = C ^ t1;
+                return t2;
+            }
+            // code=0x64, function=(B xor (C and (A or B))), lowered=(B xor (C and (A or B))), set=superopt_sse
+            template<> __forceinline constexpr uint64_t ternary<0x64>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A | B;
+                const uint64_t t1 = C & t0;
+                const uint64_t t2 = B ^ t1;
+                return t2;
+            }
+            // code=0x69, function=(A xnor (B xor C)), lowered=not ((A xor (B xor C))), set=intel
+            template<> __forceinline constexpr uint64_t ternary<0x69>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B ^ C;
+                const uint64_t t1 = A ^ t0;
+                const uint64_t t2 = ~t1;
+                return t2;
+            }
+            // code=0x87, function=(A xnor (B and C)), lowered=not ((A xor (B and C))), set=intel
+            template<> __forceinline constexpr uint64_t ternary<0x87>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B & C;
+                const uint64_t t1 = A ^ t0;
+                const uint64_t t2 = ~t1;
+                return t2;
+            }
+            // code=0x93, function=(B xnor (A and C)), lowered=not ((B xor (A and C))), set=intel
+            template<> __forceinline constexpr uint64_t ternary<0x93>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A & C;
+                const uint64_t t1 = B ^ t0;
+                const uint64_t t2 = ~t1;
+                return t2;
+            }
+            // code=0x95, function=(C xnor (B and A)), lowered=not ((C xor (B and A))), set=intel
+            template<> __forceinline constexpr uint64_t ternary<0x95>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B & A;
+                const uint64_t t1 = C ^ t0;
+                const uint64_t t2 = ~t1;
+                return t2;
+            }
+            // code=0x97, function=(not ((A and B)) xor (C and (A or B))), lowered=(not ((A and B)) xor (C and (A or B))), set=superopt_x86
+            template<> __forceinline constexpr uint64_t ternary<0x97>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A & B;
+                const uint64_t t1 = ~t0;
+                const uint64_t t2 = A | B;
+                const uint64_t t3 = C & t2;
+                const uint64_t t4 = t1 ^ t3;
+                return t4;
+            }
+            // code=0xa9, function=(C xnor (B or A)), lowered=not ((C xor (B or A))), set=intel
+            template<> __forceinline constexpr uint64_t ternary<0xa9>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B | A;
+                const uint64_t t1 = C ^ t0;
+                const uint64_t t2 = ~t1;
+                return t2;
+            }
+            // code=0xc9, function=(B xnor (A or C)), lowered=not ((B xor (A or C))), set=intel
+            template<> __forceinline constexpr uint64_t ternary<0xc9>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A | C;
+                const uint64_t t1 = B ^ t0;
+                const uint64_t t2 = ~t1;
+                return t2;
+            }
+            // code=0xe1, function=(A xnor (B or C)), lowered=not ((A xor (B or C))), set=intel
+            template<> __forceinline constexpr uint64_t ternary<0xe1>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B | C;
+                const uint64_t t1 = A ^ t0;
+                const uint64_t t2 = ~t1;
+                return t2;
+            }
+            // code=0xfb, function=(A or (not (B) or C)), lowered=(A or (not (B) or C)), set=optimized
+            template<> __forceinline constexpr uint64_t ternary<0xfb>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = ~B;
+                const uint64_t t1 = t0 | C;
+                const uint64_t t2 = A | t1;
+                return t2;
+            }
+
+            template<unsigned k> __forceinline constexpr uint64_t ternary_lat(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                return x86_64_bmi::ternary_lat<k>(A, B, C);
+            }
+
+            // code=0x17, function=((B nor C) or (not (A) and (B xor C))), lowered=(not ((B or C)) or (A notand (B xor C))), set=optimized
+            template<> __forceinline constexpr uint64_t ternary_lat<0x17>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = B | C;
+                const uint64_t t1 = ~t0;
+                const uint64_t t2 = B ^ C;
+                const uint64_t t3 = ~A & t2;
+                const uint64_t t4 = t1 | t3;
+                return t4;
+            }
+            // code=0x97, function=(not ((A and B)) xor (C and (A or B))), lowered=(not ((A and B)) xor (C and (A or B))), set=superopt_x86
+            template<> __forceinline constexpr uint64_t ternary_lat<0x97>(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                const uint64_t t0 = A & B;
+                const uint64_t t1 = ~t0;
+                const uint64_t t2 = A | B;
+                const uint64_t t3 = C & t2;
+                const uint64_t t4 = t1 ^ t3;
+                return t4;
+            }
+
+        } // namespace zen4
+
+        template<> struct kernels<5> {
+            template<unsigned k> static __forceinline constexpr uint64_t ternary(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                return zen4::ternary<k>(A, B, C);
+            }
+            template<unsigned k> static __forceinline constexpr uint64_t ternary_lat(const uint64_t A, const uint64_t B, const uint64_t C) noexcept {
+                return zen4::ternary_lat<k>(A, B, C);
+            }
+        };
+
+    } // namespace x86_64_bmi
+
+} // namespace ternarylogic
+
+// eof
@@ -0,0 +1,89 @@
+#include <cstdlib>
+#include <cstdio>
+#include <cstdint>
+
+#include "ternary_vext.cpp"
+
+using namespace ternarylogic::vext;
+
+// every lane of every width must hold the function
+template <unsigned K, typename V, size_t N>
+void validate_vector(const char* name) {
+    V A, B, C;
+    for (size_t i = 0; i < N; i++) {
+        A[i] = 0xf0f0f0f0f0f0f0f0ull; // 0b1111_0000
+        B[i] = 0xccccccccccccccccull; // 0b1100_1100
+        C[i] = 0xaaaaaaaaaaaaaaaaull; // 0b1010_1010
+    }
+
+    const V R     = ternary<K>(A, B, C);
+    const V R_lat = ternary_lat<K>(A, B, C);
+
+    const uint64_t expected = 0x0101010101010101ull * K;
+    for (size_t i = 0; i < N; i++) {
+        if (R[i] != expected || R_lat[i] != expected) {
+            printf("%s[%zu] = %016llx, expected = %016llx\n", name, i, (unsigned long long)R[i], (unsigned long long)expected);
+            exit(1);
+        }
+    }
+}
+
+template <unsigned K>
+void validate() {
+    validate_vector<K, v128, 2>("v128");
+    validate_vector<K, v256, 4>("v256");
+    validate_vector<K, v512, 8>("v512");
+    validate_vector<K, v1024, 16>("v1024");
+
+    const uint8_t expected = K;
+    const uint8_t result   = ternary<K>(uint8_t(0xf0), uint8_t(0xcc), uint8_t(0xaa));
+    if (result != expected) {
+        printf("uint8_t = %02x, expected = %02x\n", result, expected);
+        exit(1);
+    }
+
+#if defined(__cpp_lib_experimental_parallel_simd)
+    validate_vector<K, simd, simd::size()>("simd");
+#endif
+}
+
+// the kernels are constexpr on the vector types as well
+static_assert(ternary<0xe8>(v128{ 0xf0, 0xf0 }, v128{ 0xcc, 0xcc }, v128{ 0xaa, 0xaa })[1] == 0xe8, "majority");
+
+
+void validate_all() {
+
+#define VALIDATE_4(shift) \
+    validate<0x00 + shift>(); \
+    validate<0x01 + shift>(); \
+    validate<0x02 + shift>(); \
+    validate<0x03 + shift>();
+
+#define VALIDATE_16(shift) \
+    VALIDATE_4(0x00 + shift) \
+    VALIDATE_4(0x04 + shift) \
+    VALIDATE_4(0x08 + shift) \
+    VALIDATE_4(0x0c + shift)
+
+    VALIDATE_16(0x00);
+    VALIDATE_16(0x10);
+    VALIDATE_16(0x20);
+    VALIDATE_16(0x30);
+    VALIDATE_16(0x40);
+    VALIDATE_16(0x50);
+    VALIDATE_16(0x60);
+    VALIDATE_16(0x70);
+    VALIDATE_16(0x80);
+    VALIDATE_16(0x90);
+    VALIDATE_16(0xa0);
+    VALIDATE_16(0xb0);
+    VALIDATE_16(0xc0);
+    VALIDATE_16(0xd0);
+    VALIDATE_16(0xe0);
+    VALIDATE_16(0xf0);
+}
+
+int main() {
+    validate_all();
+    puts("All OK");
+}
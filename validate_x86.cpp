@@ -4,6 +4,8 @@
 
 #include "ternary_x86_64.cpp"
 #include "ternary_x86_32.cpp"
+#include "ternary_x86_64_bmi.cpp"
+#include "ternary_x86_32_bmi.cpp"
 
 template <unsigned K>
 void validate() {
@@ -13,10 +15,14 @@ void validate() {
 
     const uint64_t R64 = ternarylogic::x86_64::ternary<K>(A, B, C);
     const uint64_t R32 = ternarylogic::x86_32::ternary<K>(A, B, C);
+    const uint64_t R64_BMI = ternarylogic::x86_64_bmi::ternary<K>(A, B, C);
+    const uint64_t R32_BMI = ternarylogic::x86_32_bmi::ternary<K>(A, B, C);
 
     const uint8_t expected = K;
     const uint8_t result64 = R64 & 0xff;
     const uint8_t result32 = R32 & 0xff;
+    const uint8_t result64_bmi = R64_BMI & 0xff;
+    const uint8_t result32_bmi = R32_BMI & 0xff;
 
     if (result64 != expected) {
         printf("result64 = %02x, expected = %02x\n", result64, expected);
@@ -27,6 +33,16 @@ void validate() {
         printf("result32 = %02x, expected = %02x\n", result32, expected);
         exit(1);
     }
+
+    if (result64_bmi != expected) {
+        printf("result64_bmi = %02x, expected = %02x\n", result64_bmi, expected);
+        exit(1);
+    }
+
+    if (result32_bmi != expected) {
+        printf("result32_bmi = %02x, expected = %02x\n", result32_bmi, expected);
+        exit(1);
+    }
 }
 
 